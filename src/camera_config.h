@@ -42,6 +42,6 @@ static camera_config_t camera_config = {
     .pixel_format = PIXFORMAT_GRAYSCALE,
     .frame_size = FRAMESIZE_HVGA,
     .jpeg_quality = 12,
-    .fb_count = 1,
+    .fb_count = 2,
     .grab_mode = CAMERA_GRAB_LATEST,
 };
@@ -0,0 +1,249 @@
+#include "corpus.h"
+#include <dirent.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include "pgm_frame.h"
+
+bool loadConfigFile(const char* path, unsigned int frame_width, unsigned int frame_height) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "Failed to open %s\n", path);
+        return false;
+    }
+    std::string text;
+    char chunk[1024];
+    size_t length;
+    while ((length = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        text.append(chunk, length);
+    }
+    fclose(file);
+
+    // Same capacity as the device, a config that does not fit there fails here too
+    StaticJsonDocument<4096> doc;
+    DeserializationError error = deserializeJson(doc, text);
+    if (error) {
+        fprintf(stderr, "Failed to parse %s: %s\n", path, error.c_str());
+        return false;
+    }
+    config = configFromJson(doc, frame_width, frame_height);
+    if (config.coefs.empty()) {
+        fprintf(stderr, "No rectangles in %s\n", path);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Read truth.txt of a set directory
+ */
+static bool corpusLoadSet(const std::string& dir, corpus_set_t& set) {
+    FILE* file = fopen((dir + "/truth.txt").c_str(), "r");
+    if (!file) {
+        return false;
+    }
+    set.dir = dir;
+    size_t slash = dir.find_last_of('/');
+    set.name = slash == std::string::npos ? dir : dir.substr(slash + 1);
+    char line[256];
+    while (fgets(line, sizeof(line), file)) {
+        char name[200], truth[32];
+        if (line[0] == '#' || sscanf(line, "%199s %31s", name, truth) != 2) {
+            continue;
+        }
+        set.frames.push_back({name, truth});
+    }
+    fclose(file);
+    std::sort(set.frames.begin(), set.frames.end(),
+              [](const corpus_frame_t& a, const corpus_frame_t& b) { return a.file < b.file; });
+    return !set.frames.empty();
+}
+
+bool corpusLoad(const char* root, std::vector<corpus_set_t>& sets) {
+    std::string path(root);
+    while (path.size() > 1 && path.back() == '/') {
+        path.pop_back();
+    }
+    corpus_set_t set;
+    if (corpusLoadSet(path, set)) {
+        sets.push_back(set);
+        return true;
+    }
+    DIR* dir = opendir(path.c_str());
+    if (!dir) {
+        return false;
+    }
+    std::vector<std::string> names;
+    while (dirent* entry = readdir(dir)) {
+        if (entry->d_name[0] != '.') {
+            names.push_back(entry->d_name);
+        }
+    }
+    closedir(dir);
+    std::sort(names.begin(), names.end());
+    for (const std::string& name : names) {
+        corpus_set_t set;
+        if (corpusLoadSet(path + "/" + name, set)) {
+            sets.push_back(set);
+        }
+    }
+    return !sets.empty();
+}
+
+size_t corpusCorrectDigits(const std::string& truth, const std::string& read) {
+    if (truth.size() != read.size()) {
+        return 0;
+    }
+    size_t correct = 0;
+    for (size_t i = 0; i < truth.size(); i++) {
+        correct += truth[i] == read[i];
+    }
+    return correct;
+}
+
+uint32_t corpusPercentile(std::vector<uint32_t> values, int percent) {
+    if (values.empty()) {
+        return 0;
+    }
+    size_t rank = (values.size() * percent + 99) / 100;
+    rank = std::min(std::max(rank, (size_t)1), values.size());
+    std::nth_element(values.begin(), values.begin() + rank - 1, values.end());
+    return values[rank - 1];
+}
+
+// Latency of every reading per stage
+struct corpus_latency_t {
+    std::vector<uint32_t> integral;
+    std::vector<uint32_t> scale;
+    std::vector<uint32_t> match;
+    std::vector<uint32_t> model;
+    std::vector<uint32_t> total;
+};
+
+static void addLatency(JsonObject object, const char* stage, const std::vector<uint32_t>& values) {
+    JsonObject latency = object.createNestedObject(stage);
+    latency["p50"] = corpusPercentile(values, 50);
+    latency["p95"] = corpusPercentile(values, 95);
+}
+
+static float ratio(size_t count, size_t total) {
+    return total ? (float)count / total : 0.0f;
+}
+
+bool corpusRun(const std::vector<corpus_set_t>& sets, FILE* report) {
+    size_t frame_count = 0;
+    for (const corpus_set_t& set : sets) {
+        frame_count += set.frames.size();
+    }
+    DynamicJsonDocument doc(8192 + frame_count * 192);
+#ifdef MODEL_GENERATED
+    doc["model"] = "generated";
+#else
+    doc["model"] = "interpreter";
+#endif
+    doc["batch"] = MODEL_BATCH;
+
+    corpus_latency_t latency;
+    // Model outputs with their true digit, the confidence temperature is fit on them
+    std::vector<float> logits;
+    std::vector<int> labels;
+    size_t frames = 0, digits = 0, correct_digits = 0, correct_readings = 0;
+    JsonArray set_results = doc.createNestedArray("sets");
+    for (const corpus_set_t& set : sets) {
+        JsonObject set_result = set_results.createNestedObject();
+        set_result["name"] = set.name;
+        JsonArray errors;
+        size_t set_digits = 0, set_correct_digits = 0, set_correct_readings = 0;
+        bool configured = false;
+        unsigned int width = 0, height = 0;
+        for (const corpus_frame_t& expected : set.frames) {
+            std::string path = set.dir + "/" + expected.file;
+            std::string read;
+            float confidence = 0;
+            gray_frame_t frame;
+            if (pgm_load(path.c_str(), &frame)) {
+                // Tables are built for the first frame of the set, which also resets all state
+                if (!configured) {
+                    width = frame.width;
+                    height = frame.height;
+                    configured = loadConfigFile((set.dir + "/config.json").c_str(), width, height);
+                }
+                frame_jobs_t frame_jobs;
+                reading_stats_t reading;
+                uint32_t start = readingMicros();
+                if (configured && frame.width == width && frame.height == height &&
+                    readFrame(&frame, false, frame_jobs, reading)) {
+                    uint32_t total_us = readingMicros() - start;
+                    for (int digit : frame_jobs.digits) {
+                        read += (char)('0' + digit);
+                    }
+                    confidence = readingConfidence(frame_jobs).confidence;
+                    for (size_t i = 0; i < frame_jobs.digits.size() && i < expected.truth.size(); i++) {
+                        char truth = expected.truth[i];
+                        if (frame_jobs.sources[i] == DIGIT_MODEL && truth >= '0' && truth <= '9') {
+                            logits.insert(logits.end(), &frame_jobs.logits[i * RANKING_CLASSES],
+                                          &frame_jobs.logits[(i + 1) * RANKING_CLASSES]);
+                            labels.push_back(truth - '0');
+                        }
+                    }
+                    latency.integral.push_back(reading.integral_us);
+                    latency.scale.push_back(reading.scale_us);
+                    latency.match.push_back(reading.match_us);
+                    latency.model.push_back(reading.model_us);
+                    latency.total.push_back(total_us);
+                }
+                pgm_free(&frame);
+            } else {
+                fprintf(stderr, "%s: not an 8-bit PGM frame\n", path.c_str());
+            }
+
+            size_t correct = corpusCorrectDigits(expected.truth, read);
+            set_digits += expected.truth.size();
+            set_correct_digits += correct;
+            if (read == expected.truth) {
+                set_correct_readings++;
+                continue;
+            }
+            if (errors.isNull()) {
+                errors = set_result.createNestedArray("errors");
+            }
+            JsonObject error = errors.createNestedObject();
+            error["frame"] = expected.file;
+            error["expected"] = expected.truth;
+            error["read"] = read;
+            error["confidence"] = confidence;
+        }
+        set_result["frames"] = set.frames.size();
+        set_result["digit_accuracy"] = ratio(set_correct_digits, set_digits);
+        set_result["reading_accuracy"] = ratio(set_correct_readings, set.frames.size());
+        fprintf(stderr, "%s: %u frames, digits %.4f, readings %.4f\n", set.name.c_str(),
+                (unsigned int)set.frames.size(), ratio(set_correct_digits, set_digits),
+                ratio(set_correct_readings, set.frames.size()));
+        frames += set.frames.size();
+        digits += set_digits;
+        correct_digits += set_correct_digits;
+        correct_readings += set_correct_readings;
+    }
+
+    doc["frames"] = frames;
+    doc["digits"] = digits;
+    doc["digit_accuracy"] = ratio(correct_digits, digits);
+    doc["reading_accuracy"] = ratio(correct_readings, frames);
+    doc["model_digits"] = labels.size();
+    doc["confidence_temperature"] = digit_ranking_fit_temperature(logits.data(), labels.data(), labels.size());
+    JsonObject latency_us = doc.createNestedObject("latency_us");
+    addLatency(latency_us, "integral", latency.integral);
+    addLatency(latency_us, "scale", latency.scale);
+    addLatency(latency_us, "match", latency.match);
+    addLatency(latency_us, "model", latency.model);
+    addLatency(latency_us, "total", latency.total);
+    if (doc.overflowed()) {
+        fprintf(stderr, "Report truncated\n");
+    }
+
+    std::string text;
+    serializeJsonPretty(doc, text);
+    fputs(text.c_str(), report);
+    fputc('\n', report);
+    return !latency.total.empty();
+}
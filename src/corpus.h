@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "reading.h"
+
+/**
+ * Regression corpus of recorded meter frames
+ *
+ * A set is a directory holding the config.json of one meter, its 8-bit PGM
+ * frames and truth.txt with a "<frame file> <reading>" line per frame. The
+ * frames of a set are read in name order through readFrame(), keeping cache,
+ * templates and odometer state between them as the device does.
+ */
+
+struct corpus_frame_t {
+    std::string file;
+    std::string truth;  // Expected digits
+};
+
+struct corpus_set_t {
+    std::string name;
+    std::string dir;
+    std::vector<corpus_frame_t> frames;
+};
+
+/**
+ * @brief Parse a config.json file for frames of given size
+ *
+ * @return false when the file is missing, malformed or has no rectangles
+ */
+bool loadConfigFile(const char* path, unsigned int frame_width, unsigned int frame_height);
+
+/**
+ * @brief Find sets in root, which is a set itself or a directory of sets
+ */
+bool corpusLoad(const char* root, std::vector<corpus_set_t>& sets);
+
+/**
+ * @brief Digits read right at their position, a wrong digit count matches nothing
+ */
+size_t corpusCorrectDigits(const std::string& truth, const std::string& read);
+
+/**
+ * @brief Nearest-rank percentile, 0 for no values
+ */
+uint32_t corpusPercentile(std::vector<uint32_t> values, int percent);
+
+/**
+ * @brief Replay all sets and write the JSON report
+ *
+ * Besides accuracy and latency the report holds the confidence_temperature
+ * that fits the model digits of all sets, ready to copy into config.json.
+ *
+ * @param sets Corpus
+ * @param report Report destination, fixed key order and one value per line so reports diff well
+ * @return false when no frame could be read
+ */
+bool corpusRun(const std::vector<corpus_set_t>& sets, FILE* report);
@@ -0,0 +1,133 @@
+#include "digit_ranking.h"
+#include <math.h>
+
+// Smallest probability of the float path, keeps the log finite
+#define RANKING_MIN_PROBABILITY 1e-6f
+// Search range and steps of the temperature fit
+#define RANKING_MIN_TEMPERATURE 0.05f
+#define RANKING_MAX_TEMPERATURE 20.0f
+#define RANKING_FIT_STEPS 60
+
+/**
+ * @brief Two largest values, ties to the lower index
+ */
+template <typename T>
+static void rank_top2(const T* values, digit_ranking_t* ranking) {
+    int top1 = values[1] > values[0] ? 1 : 0;
+    int top2 = 1 - top1;
+    for (int i = 2; i < RANKING_CLASSES; i++) {
+        if (values[i] > values[top1]) {
+            top2 = top1;
+            top1 = i;
+        } else if (values[i] > values[top2]) {
+            top2 = i;
+        }
+    }
+    ranking->top1 = top1;
+    ranking->top2 = top2;
+}
+
+/**
+ * @brief Margin and confidence from logits relative to the top one
+ *
+ * @param relative Logit of every class minus the logit of top1, all <= 0
+ */
+static void rank_confidence(const float* relative, float temperature, digit_ranking_t* ranking) {
+    ranking->margin = -relative[ranking->top2];
+    for (int i = 0; i < RANKING_CLASSES; i++) {
+        ranking->relative[i] = relative[i];
+    }
+    // Softmax of top1 is 1 / sum exp(l_i - l_top1), all terms <= 1 so nothing overflows
+    float sum = 0;
+    for (int i = 0; i < RANKING_CLASSES; i++) {
+        sum += expf(relative[i] / temperature);
+    }
+    ranking->confidence = 1.0f / sum;
+}
+
+void digit_ranking_logits_int8(const int8_t* logits, float scale, float temperature, digit_ranking_t* ranking) {
+    rank_top2(logits, ranking);
+    float relative[RANKING_CLASSES];
+    for (int i = 0; i < RANKING_CLASSES; i++) {
+        relative[i] = (logits[i] - logits[ranking->top1]) * scale;
+    }
+    rank_confidence(relative, temperature, ranking);
+}
+
+void digit_ranking_logits_float(const float* logits, float temperature, digit_ranking_t* ranking) {
+    rank_top2(logits, ranking);
+    float relative[RANKING_CLASSES];
+    for (int i = 0; i < RANKING_CLASSES; i++) {
+        relative[i] = logits[i] - logits[ranking->top1];
+    }
+    rank_confidence(relative, temperature, ranking);
+}
+
+void digit_ranking_probabilities_int8(const int8_t* probabilities,
+                                      int32_t zero_point,
+                                      float temperature,
+                                      digit_ranking_t* ranking) {
+    rank_top2(probabilities, ranking);
+    // Scale cancels out of the log ratio
+    float top = fmaxf(probabilities[ranking->top1] - zero_point, 0.5f);
+    float relative[RANKING_CLASSES];
+    for (int i = 0; i < RANKING_CLASSES; i++) {
+        relative[i] = logf(fmaxf(probabilities[i] - zero_point, 0.5f) / top);
+    }
+    rank_confidence(relative, temperature, ranking);
+}
+
+void digit_ranking_probabilities_float(const float* probabilities, float temperature, digit_ranking_t* ranking) {
+    rank_top2(probabilities, ranking);
+    float top = fmaxf(probabilities[ranking->top1], RANKING_MIN_PROBABILITY);
+    float relative[RANKING_CLASSES];
+    for (int i = 0; i < RANKING_CLASSES; i++) {
+        relative[i] = logf(fmaxf(probabilities[i], RANKING_MIN_PROBABILITY) / top);
+    }
+    rank_confidence(relative, temperature, ranking);
+}
+
+/**
+ * @brief Negative log-likelihood of all samples at one inverse temperature
+ */
+static double ranking_nll(const float* relative, const int* labels, size_t count, double inverse) {
+    double nll = 0;
+    for (size_t n = 0; n < count; n++) {
+        const float* row = relative + n * RANKING_CLASSES;
+        // All logits are <= 0 relative to top1, the sum is at least 1
+        double sum = 0;
+        for (int i = 0; i < RANKING_CLASSES; i++) {
+            sum += exp(row[i] * inverse);
+        }
+        nll += log(sum) - row[labels[n]] * inverse;
+    }
+    return nll;
+}
+
+float digit_ranking_fit_temperature(const float* relative, const int* labels, size_t count) {
+    if (count == 0) {
+        return 1.0f;
+    }
+    // NLL is convex in the inverse temperature, golden section search finds its minimum
+    const double ratio = 0.6180339887498949;
+    double low = 1.0 / RANKING_MAX_TEMPERATURE, high = 1.0 / RANKING_MIN_TEMPERATURE;
+    double a = high - ratio * (high - low), b = low + ratio * (high - low);
+    double nll_a = ranking_nll(relative, labels, count, a);
+    double nll_b = ranking_nll(relative, labels, count, b);
+    for (int step = 0; step < RANKING_FIT_STEPS; step++) {
+        if (nll_a < nll_b) {
+            high = b;
+            b = a;
+            nll_b = nll_a;
+            a = high - ratio * (high - low);
+            nll_a = ranking_nll(relative, labels, count, a);
+        } else {
+            low = a;
+            a = b;
+            nll_a = nll_b;
+            b = low + ratio * (high - low);
+            nll_b = ranking_nll(relative, labels, count, b);
+        }
+    }
+    return (float)(2.0 / (low + high));
+}
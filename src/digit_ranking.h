@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define RANKING_CLASSES 10
+
+/**
+ * @brief Best two digits of one model output and how sure the model is of the first
+ *
+ * Ranking compares the int8 values directly, quantization keeps their order.
+ * Ties go to the lower digit, so a flat output ranks 0 before 1 with a margin
+ * of 0 instead of passing for a confident 0.
+ */
+typedef struct {
+    int top1;
+    int top2;
+    float margin;      // Logit of top1 minus logit of top2, 0 on a tie
+    float confidence;  // Probability of top1 after temperature scaling, 0.1..1
+    float relative[RANKING_CLASSES];  // Logit of every class minus the logit of top1, before temperature
+} digit_ranking_t;
+
+/**
+ * @brief Rank logits, the int8 input of a softmax
+ *
+ * Logit differences are integer steps times scale, the zero point cancels out.
+ *
+ * @param temperature Softmax temperature of the confidence, 1 keeps the model's own probabilities
+ */
+void digit_ranking_logits_int8(const int8_t* logits, float scale, float temperature, digit_ranking_t* ranking);
+void digit_ranking_logits_float(const float* logits, float temperature, digit_ranking_t* ranking);
+
+/**
+ * @brief Rank softmax output of a model that still ends with the op
+ *
+ * Logits are recovered as log probabilities, an empty class counts as half a
+ * quantization step.
+ */
+void digit_ranking_probabilities_int8(const int8_t* probabilities,
+                                      int32_t zero_point,
+                                      float temperature,
+                                      digit_ranking_t* ranking);
+void digit_ranking_probabilities_float(const float* probabilities, float temperature, digit_ranking_t* ranking);
+
+/**
+ * @brief Temperature that minimizes the negative log-likelihood of labeled outputs
+ *
+ * @param relative RANKING_CLASSES relative logits per sample, as in digit_ranking_t
+ * @param labels True digit of every sample
+ * @param count Number of samples
+ * @return Temperature between 0.05 and 20, 1 without samples
+ */
+float digit_ranking_fit_temperature(const float* relative, const int* labels, size_t count);
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdlib.h>
+#ifdef ARDUINO
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+#endif
+
+/**
+ * @brief Allocator keeping container data in internal DRAM instead of PSRAM
+ *
+ * Plain malloc() in the native build.
+ */
+template <typename T>
+struct dram_allocator_t {
+    typedef T value_type;
+
+    dram_allocator_t() = default;
+    template <typename U>
+    dram_allocator_t(const dram_allocator_t<U>&) {}
+
+    T* allocate(size_t n) {
+#ifdef ARDUINO
+        void* data = heap_caps_malloc(n * sizeof(T), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (!data) {
+            // Still works from PSRAM, only slower
+            Serial.println("Out of internal DRAM, falling back to default heap");
+            data = malloc(n * sizeof(T));
+        }
+#else
+        void* data = malloc(n * sizeof(T));
+#endif
+        return static_cast<T*>(data);
+    }
+    void deallocate(T* data, size_t) { free(data); }
+};
+template <typename T, typename U>
+bool operator==(const dram_allocator_t<T>&, const dram_allocator_t<U>&) {
+    return true;
+}
+template <typename T, typename U>
+bool operator!=(const dram_allocator_t<T>&, const dram_allocator_t<U>&) {
+    return false;
+}
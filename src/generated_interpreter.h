@@ -0,0 +1,47 @@
+#pragma once
+
+#include "model_generated.h"
+#include "tensorflow/lite/c/common.h"
+
+/**
+ * @brief Generated model code behind the part of the MicroInterpreter interface used by the firmware
+ *
+ * Shapes, quantization and the arena are fixed at generation time, so there
+ * is nothing to parse, resolve or allocate at startup.
+ */
+class generated_interpreter_t {
+   public:
+    generated_interpreter_t() {
+        input_tensor.type = MODEL_GENERATED_INPUT_INT8 ? kTfLiteInt8 : kTfLiteFloat32;
+        input_tensor.data.data = model_generated_input();
+        input_tensor.dims = reinterpret_cast<TfLiteIntArray*>(input_dims);
+        input_tensor.params.scale = MODEL_GENERATED_INPUT_SCALE;
+        input_tensor.params.zero_point = MODEL_GENERATED_INPUT_ZERO_POINT;
+        input_tensor.bytes = sizeof(model_generated_input_t) * MODEL_GENERATED_BATCH *
+                             MODEL_GENERATED_INPUT_SIZE;
+
+        output_tensor.type = MODEL_GENERATED_OUTPUT_INT8 ? kTfLiteInt8 : kTfLiteFloat32;
+        output_tensor.data.data = const_cast<model_generated_output_t*>(model_generated_output());
+        output_tensor.dims = reinterpret_cast<TfLiteIntArray*>(output_dims);
+        output_tensor.params.scale = MODEL_GENERATED_OUTPUT_SCALE;
+        output_tensor.params.zero_point = MODEL_GENERATED_OUTPUT_ZERO_POINT;
+        output_tensor.bytes = sizeof(model_generated_output_t) * MODEL_GENERATED_BATCH *
+                              MODEL_GENERATED_OUTPUT_SIZE;
+    }
+
+    TfLiteStatus AllocateTensors() { return kTfLiteOk; }
+    TfLiteStatus Invoke() {
+        model_generated_invoke();
+        return kTfLiteOk;
+    }
+    TfLiteTensor* input(size_t) { return &input_tensor; }
+    TfLiteTensor* output(size_t) { return &output_tensor; }
+    size_t arena_used_bytes() const { return MODEL_GENERATED_ARENA_SIZE; }
+
+   private:
+    // Same layout as TfLiteIntArray
+    int input_dims[5] = {4, MODEL_GENERATED_BATCH, 28, 28, 1};
+    int output_dims[3] = {2, MODEL_GENERATED_BATCH, MODEL_GENERATED_OUTPUT_SIZE};
+    TfLiteTensor input_tensor = {};
+    TfLiteTensor output_tensor = {};
+};
@@ -0,0 +1,189 @@
+#ifndef PIO_UNIT_TESTING
+/**
+ * Command line reader of the native build
+ *
+ * Reads PGM frames with the rectangles of a config.json the same way the
+ * device reads camera frames, and prints the digits and the time of every
+ * stage. Runs under perf or valgrind like any other program:
+ *
+ *     pio run -e native
+ *     .pio/build/native/program data/config.json frames/ [--repeat 10]
+ *
+ * With --corpus it replays a regression corpus (see corpus.h) and writes the
+ * accuracy and latency report, to stdout or the --report file:
+ *
+ *     .pio/build/native/program --corpus corpus/ --report report.json
+ */
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "corpus.h"
+#include "pgm_frame.h"
+#include "reading.h"
+
+/**
+ * @brief PGM files among the arguments, directories are expanded in name order
+ */
+static std::vector<std::string> listFrames(const std::vector<const char*>& paths) {
+    std::vector<std::string> frames;
+    for (const char* path : paths) {
+        DIR* dir = opendir(path);
+        if (!dir) {
+            frames.push_back(path);
+            continue;
+        }
+        std::vector<std::string> names;
+        while (dirent* entry = readdir(dir)) {
+            size_t length = strlen(entry->d_name);
+            if (length > 4 && strcmp(entry->d_name + length - 4, ".pgm") == 0) {
+                names.push_back(std::string(path) + "/" + entry->d_name);
+            }
+        }
+        closedir(dir);
+        std::sort(names.begin(), names.end());
+        frames.insert(frames.end(), names.begin(), names.end());
+    }
+    return frames;
+}
+
+static bool setupModel() {
+    tensor_arena = (uint8_t*)malloc(ARENA_SIZE);
+#ifdef MODEL_GENERATED
+    interpreter.reset(new generated_interpreter_t());
+#else
+    interpreter.reset(new tflite::MicroInterpreter(firmwareModel(), modelResolver(), tensor_arena,
+                                                   ARENA_SIZE, nullptr, &op_profiler));
+    model_outputs_logits = modelOutputsLogits(firmwareModel());
+#endif
+    if (!tensor_arena || interpreter->AllocateTensors() != kTfLiteOk) {
+        fprintf(stderr, "Failed to allocate tensors\n");
+        return false;
+    }
+    if (!modelTensorsFit(interpreter->input(0), interpreter->output(0))) {
+        fprintf(stderr, "Model input/output are %s/%s, not the digit tensors of this build\n",
+                TfLiteTypeGetName(interpreter->input(0)->type),
+                TfLiteTypeGetName(interpreter->output(0)->type));
+        return false;
+    }
+    initInputLut();
+    return true;
+}
+
+/**
+ * @brief Replay a corpus and write its report
+ */
+static int runCorpus(const char* root, const char* report_path) {
+    std::vector<corpus_set_t> sets;
+    if (!corpusLoad(root, sets)) {
+        fprintf(stderr, "No set with a truth.txt in %s\n", root);
+        return 1;
+    }
+    if (!setupModel()) {
+        return 1;
+    }
+    FILE* report = report_path ? fopen(report_path, "w") : stdout;
+    if (!report) {
+        fprintf(stderr, "Failed to open %s\n", report_path);
+        return 1;
+    }
+    bool success = corpusRun(sets, report);
+    if (report != stdout) {
+        fclose(report);
+    }
+    return success ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+    if (argc >= 3 && strcmp(argv[1], "--corpus") == 0) {
+        const char* report_path = nullptr;
+        if (argc >= 5 && strcmp(argv[3], "--report") == 0) {
+            report_path = argv[4];
+        }
+        return runCorpus(argv[2], report_path);
+    }
+    std::vector<const char*> paths;
+    int repeat = 1;
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+            repeat = std::max(atoi(argv[++i]), 1);
+        } else {
+            paths.push_back(argv[i]);
+        }
+    }
+    if (argc < 3 || paths.empty()) {
+        fprintf(stderr, "Usage: %s config.json frame.pgm|directory... [--repeat N]\n"
+                        "       %s --corpus directory [--report file]\n",
+                argv[0], argv[0]);
+        return 2;
+    }
+    std::vector<std::string> frames = listFrames(paths);
+    gray_frame_t frame;
+    if (frames.empty() || !pgm_load(frames[0].c_str(), &frame)) {
+        fprintf(stderr, "No readable 8-bit PGM frame\n");
+        return 1;
+    }
+    // Resampling tables are built for the size of the first frame
+    unsigned int width = frame.width, height = frame.height;
+    pgm_free(&frame);
+    if (!setupModel() || !loadConfigFile(argv[1], width, height)) {
+        return 1;
+    }
+
+    reading_stats_t total = {};
+    unsigned int readings = 0;
+    for (const std::string& path : frames) {
+        if (!pgm_load(path.c_str(), &frame)) {
+            fprintf(stderr, "%s: not an 8-bit PGM frame\n", path.c_str());
+            continue;
+        }
+        if (frame.width != width || frame.height != height) {
+            fprintf(stderr, "%s: %ux%u, expected %ux%u\n", path.c_str(), frame.width,
+                    frame.height, width, height);
+            pgm_free(&frame);
+            continue;
+        }
+        for (int i = 0; i < repeat; i++) {
+            frame_jobs_t frame_jobs;
+            reading_stats_t reading;
+            if (!readFrame(&frame, false, frame_jobs, reading)) {
+                fprintf(stderr, "%s: reading failed\n", path.c_str());
+                break;
+            }
+            std::string value;
+            for (int digit : frame_jobs.digits) {
+                value += (char)('0' + digit);
+            }
+            reading_confidence_t confidence = readingConfidence(frame_jobs);
+            printf("%s %s confidence %.3f, integral %u us, scale %u us, match %u us, model %u us\n",
+                   path.c_str(), value.c_str(), confidence.confidence, reading.integral_us,
+                   reading.scale_us, reading.match_us, reading.model_us);
+            total.integral_us += reading.integral_us;
+            total.scale_us += reading.scale_us;
+            total.match_us += reading.match_us;
+            total.model_us += reading.model_us;
+            readings++;
+        }
+        pgm_free(&frame);
+    }
+    if (readings == 0) {
+        return 1;
+    }
+
+    uint32_t total_us = total.integral_us + total.scale_us + total.match_us + total.model_us;
+    printf("\n%u readings, mean integral %.1f us, scale %.1f us, match %.1f us, model %.1f us\n",
+           readings, (float)total.integral_us / readings, (float)total.scale_us / readings,
+           (float)total.match_us / readings, (float)total.model_us / readings);
+    printf("%.1f readings per second\n", total_us ? readings * 1e6f / total_us : 0.0f);
+    for (int i = 0; i < op_profiler.op_count(); i++) {
+        const op_profile_t& op = op_profiler.op(i);
+        printf("node %2d %-16s mean %8llu ns, min %8u ns, max %8u ns\n", i, op.tag,
+               (unsigned long long)(op.cycles.total / op.cycles.count), op.cycles.min,
+               op.cycles.max);
+    }
+    return 0;
+}
+#endif
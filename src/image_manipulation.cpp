@@ -1,4 +1,5 @@
 #include "image_manipulation.h"
+#include <math.h>
 
 /**
  * Original Bilinear interpolation code from https://rosettacode.org/wiki/Bilinear_interpolation
@@ -24,7 +25,10 @@ void putpixel(out_image_t* image, unsigned int x, unsigned int y, uint8_t color)
     image->pixels[(y * image->w) + x] = color;
 }
 
-void scale(in_image_t* src, out_image_t* dst, unsigned int newWidth, unsigned int newHeight) {
+/**
+ * @brief Float implementation, kept as a reference for the fixed-point path
+ */
+void scale_reference(in_image_t* src, out_image_t* dst, unsigned int newWidth, unsigned int newHeight) {
     int x, y;
     for (x = 0, y = 0;; x++) {
         if (x >= newWidth) {
@@ -46,3 +50,645 @@ void scale(in_image_t* src, out_image_t* dst, unsigned int newWidth, unsigned in
         putpixel(dst, x, y, result);
     }
 }
+
+/**
+ * @brief Compute source taps of one axis
+ *
+ * Same mapping as the float path (x / newSize * size - 0.5), evaluated in
+ * integers. Unlike the float path, taps are clamped to the section instead of
+ * extrapolating past its first and last pixel.
+ */
+static void scale_axis_init(scale_tap_t* taps, unsigned int size, unsigned int newSize) {
+    const int32_t last = (int32_t)(size - 1) << SCALE_WEIGHT_BITS;
+    for (unsigned int i = 0; i < newSize; i++) {
+        // (2 * i * size - newSize) / (2 * newSize) in Q8, rounded to nearest
+        int32_t numerator = (int32_t)(2 * i * size) - (int32_t)newSize;
+        int32_t g = 0;
+        if (numerator > 0) {
+            g = ((numerator << SCALE_WEIGHT_BITS) + (int32_t)newSize) / (int32_t)(2 * newSize);
+        }
+        if (g > last) {
+            g = last;
+        }
+        taps[i].index = g >> SCALE_WEIGHT_BITS;
+        taps[i].weight = g & (SCALE_WEIGHT_ONE - 1);
+        taps[i].next = (taps[i].index + 1u < size) ? 1 : 0;
+    }
+}
+
+/**
+ * @brief Compute box filter bin edges of one axis
+ */
+static void scale_bins_init(uint16_t* bins, unsigned int size, unsigned int newSize) {
+    for (unsigned int i = 0; i <= newSize; i++) {
+        bins[i] = i * size / newSize;
+    }
+}
+
+/**
+ * @brief End of box filter bin
+ *
+ * Every bin covers at least one source pixel, so an axis that is upscaled
+ * while the other one is box filtered still samples correctly.
+ */
+static inline unsigned int scale_bin_end(const uint16_t* bins, unsigned int i) {
+    return bins[i + 1] > bins[i] ? bins[i + 1] : bins[i] + 1;
+}
+
+void scale_coefs_init(scale_coefs_t* coefs,
+                      unsigned int sectionWidth,
+                      unsigned int sectionHeight,
+                      unsigned int newWidth,
+                      unsigned int newHeight) {
+    coefs->sectionWidth = sectionWidth;
+    coefs->sectionHeight = sectionHeight;
+    coefs->w = newWidth;
+    coefs->h = newHeight;
+    // Bilinear only looks at 2x2 source pixels, switch to box filter when that would alias
+    if (sectionWidth > SCALE_BOX_RATIO * newWidth || sectionHeight > SCALE_BOX_RATIO * newHeight) {
+        coefs->mode = SCALE_MODE_BOX;
+    } else {
+        coefs->mode = SCALE_MODE_BILINEAR;
+    }
+    scale_axis_init(coefs->x, sectionWidth, newWidth);
+    scale_axis_init(coefs->y, sectionHeight, newHeight);
+    scale_bins_init(coefs->binX, sectionWidth, newWidth);
+    scale_bins_init(coefs->binY, sectionHeight, newHeight);
+}
+
+/**
+ * @brief Affine transform mapping output pixels of a rotated rectangle to the frame
+ *
+ * @param matrix Output, source = [m0 m1 m2; m3 m4 m5] * [u v 1]
+ * @param angle Clockwise rotation around the rectangle center in degrees
+ */
+void affine_from_rectangle(float matrix[6],
+                           float x,
+                           float y,
+                           float width,
+                           float height,
+                           float angle,
+                           unsigned int newWidth,
+                           unsigned int newHeight) {
+    const float radians = angle * (float)M_PI / 180.0f;
+    const float c = cosf(radians);
+    const float s = sinf(radians);
+    const float sx = width / newWidth;
+    const float sy = height / newHeight;
+    // Center of the first output pixel relative to the rectangle center
+    const float lx = 0.5f * sx - 0.5f * width;
+    const float ly = 0.5f * sy - 0.5f * height;
+    const float cx = x + 0.5f * width;
+    const float cy = y + 0.5f * height;
+    matrix[0] = c * sx;
+    matrix[1] = -s * sy;
+    matrix[2] = cx + c * lx - s * ly - 0.5f;
+    matrix[3] = s * sx;
+    matrix[4] = c * sy;
+    matrix[5] = cy + s * lx + c * ly - 0.5f;
+}
+
+static inline int32_t to_q16(float value) {
+    return (int32_t)lroundf(value * 65536.0f);
+}
+
+void scale_coefs_init_affine(scale_coefs_t* coefs,
+                             const float matrix[6],
+                             unsigned int newWidth,
+                             unsigned int newHeight,
+                             unsigned int frameWidth,
+                             unsigned int frameHeight) {
+    coefs->mode = SCALE_MODE_AFFINE;
+    coefs->sectionWidth = 0;
+    coefs->sectionHeight = 0;
+    coefs->w = newWidth;
+    coefs->h = newHeight;
+    coefs->affine.x = to_q16(matrix[2]);
+    coefs->affine.y = to_q16(matrix[5]);
+    coefs->affine.ux = to_q16(matrix[0]);
+    coefs->affine.uy = to_q16(matrix[3]);
+    coefs->affine.vx = to_q16(matrix[1]);
+    coefs->affine.vy = to_q16(matrix[4]);
+
+    // Output is a parallelogram in the frame, its corners bound every tap. Checked on the
+    // rounded Q16 steps the walk adds up, a corner at 0.0 may land just below it.
+    const int64_t max_x = ((int64_t)frameWidth - 1) * 65536 - 1;
+    const int64_t max_y = ((int64_t)frameHeight - 1) * 65536 - 1;
+    coefs->affine.clamp = false;
+    for (unsigned int corner = 0; corner < 4; corner++) {
+        int64_t u = (corner & 1) ? newWidth - 1 : 0;
+        int64_t v = (corner & 2) ? newHeight - 1 : 0;
+        int64_t x = coefs->affine.x + v * coefs->affine.vx + u * coefs->affine.ux;
+        int64_t y = coefs->affine.y + v * coefs->affine.vy + u * coefs->affine.uy;
+        if (x < 0 || y < 0 || x > max_x || y > max_y) {
+            coefs->affine.clamp = true;
+        }
+    }
+}
+
+/**
+ * @brief Projective transform mapping a width x height rectangle onto a quad
+ *
+ * @param matrix Output, [x y w] = [m0 m1 m2; m3 m4 m5; m6 m7 1] * [u v 1]
+ * @param corners Quad corners in the frame, clockwise from top-left as x, y pairs
+ * @return false when the corners are degenerate
+ */
+bool homography_from_quad(float matrix[9], const float corners[8], float width, float height) {
+    const double u[4] = {0, width, width, 0};
+    const double v[4] = {0, 0, height, height};
+
+    // Two equations per corner in the 8 unknowns, solved by Gaussian elimination
+    double a[8][9];
+    for (int i = 0; i < 4; i++) {
+        const double x = corners[2 * i];
+        const double y = corners[2 * i + 1];
+        double* rx = a[2 * i];
+        double* ry = a[2 * i + 1];
+        rx[0] = u[i], rx[1] = v[i], rx[2] = 1, rx[3] = 0, rx[4] = 0, rx[5] = 0;
+        rx[6] = -u[i] * x, rx[7] = -v[i] * x, rx[8] = x;
+        ry[0] = 0, ry[1] = 0, ry[2] = 0, ry[3] = u[i], ry[4] = v[i], ry[5] = 1;
+        ry[6] = -u[i] * y, ry[7] = -v[i] * y, ry[8] = y;
+    }
+    for (int col = 0; col < 8; col++) {
+        int pivot = col;
+        for (int row = col + 1; row < 8; row++) {
+            if (fabs(a[row][col]) > fabs(a[pivot][col])) {
+                pivot = row;
+            }
+        }
+        if (fabs(a[pivot][col]) < 1e-9) {
+            return false;
+        }
+        for (int k = 0; k < 9; k++) {
+            double tmp = a[col][k];
+            a[col][k] = a[pivot][k];
+            a[pivot][k] = tmp;
+        }
+        for (int row = 0; row < 8; row++) {
+            if (row == col) {
+                continue;
+            }
+            double factor = a[row][col] / a[col][col];
+            for (int k = col; k < 9; k++) {
+                a[row][k] -= factor * a[col][k];
+            }
+        }
+    }
+    for (int i = 0; i < 8; i++) {
+        matrix[i] = a[i][8] / a[i][i];
+    }
+    matrix[8] = 1;
+    return true;
+}
+
+/**
+ * @brief Build per-pixel remap table of cells cut from a homography-rectified strip
+ *
+ * The strip is cells * out_w wide and out_h high, cell i covers its columns
+ * [i * out_w, (i + 1) * out_w). Entries are stored cell after cell so every
+ * cell is a contiguous out_w * out_h table.
+ */
+void remap_init_homography(uint32_t* offsets,
+                           uint16_t* weights,
+                           const float matrix[9],
+                           unsigned int cells,
+                           unsigned int newWidth,
+                           unsigned int newHeight,
+                           unsigned int frameWidth,
+                           unsigned int frameHeight) {
+    const float max_x = frameWidth - 1.001f;
+    const float max_y = frameHeight - 1.001f;
+    for (unsigned int cell = 0; cell < cells; cell++) {
+        for (unsigned int y = 0; y < newHeight; y++) {
+            for (unsigned int x = 0; x < newWidth; x++) {
+                // Pixel centers on both sides
+                const float u = cell * newWidth + x + 0.5f;
+                const float v = y + 0.5f;
+                const float w = matrix[6] * u + matrix[7] * v + matrix[8];
+                float sx = (matrix[0] * u + matrix[1] * v + matrix[2]) / w - 0.5f;
+                float sy = (matrix[3] * u + matrix[4] * v + matrix[5]) / w - 0.5f;
+                sx = sx < 0 ? 0 : (sx > max_x ? max_x : sx);
+                sy = sy < 0 ? 0 : (sy > max_y ? max_y : sy);
+
+                const unsigned int xi = (unsigned int)sx;
+                const unsigned int yi = (unsigned int)sy;
+                const unsigned int wx = (unsigned int)((sx - xi) * SCALE_WEIGHT_ONE);
+                const unsigned int wy = (unsigned int)((sy - yi) * SCALE_WEIGHT_ONE);
+                *offsets++ = yi * frameWidth + xi;
+                *weights++ = wx | (wy << 8);
+            }
+        }
+    }
+}
+
+void scale_coefs_init_remap(scale_coefs_t* coefs,
+                            const uint32_t* offsets,
+                            const uint16_t* weights,
+                            unsigned int newWidth,
+                            unsigned int newHeight) {
+    coefs->mode = SCALE_MODE_REMAP;
+    coefs->sectionWidth = 0;
+    coefs->sectionHeight = 0;
+    coefs->w = newWidth;
+    coefs->h = newHeight;
+    coefs->remapOffsets = offsets;
+    coefs->remapWeights = weights;
+}
+
+/**
+ * @brief Writes resampled pixels to an 8-bit image
+ */
+struct pixel_writer_t {
+    uint8_t* pixels;
+    unsigned int stride;
+
+    inline void put(unsigned int x, unsigned int y, uint8_t value) {
+        pixels[y * stride + x] = value;
+    }
+};
+
+/**
+ * @brief Writes resampled pixels straight to a model input tensor
+ */
+template <typename T, bool with_preview>
+struct tensor_writer_t {
+    T* data;
+    const T* lut;
+    uint8_t* preview;
+    unsigned int stride;
+
+    inline void put(unsigned int x, unsigned int y, uint8_t value) {
+        data[y * stride + x] = lut[value];
+        if (with_preview) {
+            preview[y * stride + x] = value;
+        }
+    }
+};
+
+/**
+ * @brief Keeps resampled pixels in the preview and gathers contrast statistics
+ */
+struct contrast_writer_t {
+    uint8_t* preview;
+    contrast_t* contrast;
+    unsigned int stride;
+
+    inline void put(unsigned int x, unsigned int y, uint8_t value) {
+        preview[y * stride + x] = value;
+        contrast->min = value < contrast->min ? value : contrast->min;
+        contrast->max = value > contrast->max ? value : contrast->max;
+        contrast->sum += value;
+    }
+};
+
+/**
+ * @brief Integer-only bilinear interpolation of one output row using precomputed taps
+ */
+template <typename Writer>
+static inline void scale_bilinear_row(in_image_t* src,
+                                      Writer& out,
+                                      const scale_coefs_t* coefs,
+                                      unsigned int y) {
+    const scale_tap_t ty = coefs->y[y];
+    const uint8_t* row0 = src->pixels + (ty.index + src->offsetY) * src->w + src->offsetX;
+    const uint8_t* row1 = row0 + ty.next * src->w;
+    for (unsigned int x = 0; x < coefs->w; x++) {
+        const scale_tap_t tx = coefs->x[x];
+        uint32_t top = row0[tx.index] * (SCALE_WEIGHT_ONE - tx.weight) +
+                       row0[tx.index + tx.next] * tx.weight;
+        uint32_t bottom = row1[tx.index] * (SCALE_WEIGHT_ONE - tx.weight) +
+                          row1[tx.index + tx.next] * tx.weight;
+        out.put(x, y,
+                (top * (SCALE_WEIGHT_ONE - ty.weight) + bottom * ty.weight) >>
+                    (2 * SCALE_WEIGHT_BITS));
+    }
+}
+
+/**
+ * @brief Whether the integral image covers every bin of the section
+ */
+static inline bool scale_box_covered(const in_image_t* src,
+                                     const scale_coefs_t* coefs,
+                                     const integral_image_t* integral) {
+    return integral && src->offsetX >= integral->x && src->offsetY >= integral->y &&
+           src->offsetX - integral->x + coefs->sectionWidth <= integral->w &&
+           src->offsetY - integral->y + coefs->sectionHeight <= integral->h;
+}
+
+/**
+ * @brief Area-averaging downscale of one output row using the frame integral image
+ *
+ * Each output pixel costs four table lookups regardless of the bin size, the
+ * frame itself is not read.
+ */
+template <typename Writer>
+static inline void scale_box_integral_row(in_image_t* src,
+                                          Writer& out,
+                                          const scale_coefs_t* coefs,
+                                          const integral_image_t* integral,
+                                          unsigned int y) {
+    const unsigned int y0 = coefs->binY[y];
+    const unsigned int h = scale_bin_end(coefs->binY, y) - y0;
+    for (unsigned int x = 0; x < coefs->w; x++) {
+        const unsigned int x0 = coefs->binX[x];
+        const unsigned int w = scale_bin_end(coefs->binX, x) - x0;
+        out.put(x, y,
+                integral_image_mean(integral, src->offsetX + x0, src->offsetY + y0, w, h));
+    }
+}
+
+/**
+ * @brief Bilinear interpolation of one output row along an affine walk
+ *
+ * Source position only advances by fixed-point adds, so a rotated section
+ * costs the same as an axis-aligned one.
+ */
+template <typename Writer, bool clamp>
+static inline void scale_affine_row(in_image_t* src,
+                                    Writer& out,
+                                    const scale_coefs_t* coefs,
+                                    unsigned int y) {
+    const scale_affine_t* affine = &coefs->affine;
+    int32_t sx = affine->x + (int32_t)y * affine->vx;
+    int32_t sy = affine->y + (int32_t)y * affine->vy;
+    const int32_t max_x = ((int32_t)(src->w - 1) << 16) - 1;
+    const int32_t max_y = ((int32_t)(src->h - 1) << 16) - 1;
+    for (unsigned int x = 0; x < coefs->w; x++, sx += affine->ux, sy += affine->uy) {
+        int32_t px = sx;
+        int32_t py = sy;
+        if (clamp) {
+            px = px < 0 ? 0 : (px > max_x ? max_x : px);
+            py = py < 0 ? 0 : (py > max_y ? max_y : py);
+        }
+        const uint8_t* p = src->pixels + (py >> 16) * src->w + (px >> 16);
+        const uint32_t wx = (px >> (16 - SCALE_WEIGHT_BITS)) & (SCALE_WEIGHT_ONE - 1);
+        const uint32_t wy = (py >> (16 - SCALE_WEIGHT_BITS)) & (SCALE_WEIGHT_ONE - 1);
+        uint32_t top = p[0] * (SCALE_WEIGHT_ONE - wx) + p[1] * wx;
+        uint32_t bottom = p[src->w] * (SCALE_WEIGHT_ONE - wx) + p[src->w + 1] * wx;
+        out.put(x, y, (top * (SCALE_WEIGHT_ONE - wy) + bottom * wy) >> (2 * SCALE_WEIGHT_BITS));
+    }
+}
+
+/**
+ * @brief Bilinear interpolation of one output row through a per-pixel remap table
+ */
+template <typename Writer>
+static inline void scale_remap_row(in_image_t* src,
+                                   Writer& out,
+                                   const scale_coefs_t* coefs,
+                                   unsigned int y) {
+    const uint32_t* offsets = coefs->remapOffsets + y * coefs->w;
+    const uint16_t* weights = coefs->remapWeights + y * coefs->w;
+    for (unsigned int x = 0; x < coefs->w; x++) {
+        const uint8_t* p = src->pixels + offsets[x];
+        const uint32_t wx = weights[x] & 0xff;
+        const uint32_t wy = weights[x] >> 8;
+        uint32_t top = p[0] * (SCALE_WEIGHT_ONE - wx) + p[1] * wx;
+        uint32_t bottom = p[src->w] * (SCALE_WEIGHT_ONE - wx) + p[src->w + 1] * wx;
+        out.put(x, y, (top * (SCALE_WEIGHT_ONE - wy) + bottom * wy) >> (2 * SCALE_WEIGHT_BITS));
+    }
+}
+
+/**
+ * @brief Resample one output row
+ *
+ * Box mode reads the integral image, a section it does not cover is sampled
+ * bilinear instead of reading past the table.
+ */
+template <typename Writer>
+static inline void scale_row(in_image_t* src,
+                             Writer& out,
+                             const scale_coefs_t* coefs,
+                             const integral_image_t* integral,
+                             unsigned int y) {
+    if (coefs->mode == SCALE_MODE_REMAP) {
+        scale_remap_row(src, out, coefs, y);
+    } else if (coefs->mode == SCALE_MODE_BOX && scale_box_covered(src, coefs, integral)) {
+        scale_box_integral_row(src, out, coefs, integral, y);
+    } else if (coefs->mode == SCALE_MODE_AFFINE) {
+        if (coefs->affine.clamp) {
+            scale_affine_row<Writer, true>(src, out, coefs, y);
+        } else {
+            scale_affine_row<Writer, false>(src, out, coefs, y);
+        }
+    } else {
+        scale_bilinear_row(src, out, coefs, y);
+    }
+}
+
+template <typename Writer>
+static void scale_rows(in_image_t* src,
+                       Writer& out,
+                       const scale_coefs_t* coefs,
+                       const integral_image_t* integral) {
+    for (unsigned int y = 0; y < coefs->h; y++) {
+        scale_row(src, out, coefs, integral, y);
+    }
+}
+
+void scale_fixed(in_image_t* src, out_image_t* dst, const scale_coefs_t* coefs) {
+    pixel_writer_t out = {.pixels = dst->pixels, .stride = dst->w};
+    for (unsigned int y = 0; y < coefs->h; y++) {
+        scale_bilinear_row(src, out, coefs, y);
+    }
+}
+
+void scale_box(in_image_t* src,
+               out_image_t* dst,
+               const scale_coefs_t* coefs,
+               const integral_image_t* integral) {
+    pixel_writer_t out = {.pixels = dst->pixels, .stride = dst->w};
+    bool covered = scale_box_covered(src, coefs, integral);
+    for (unsigned int y = 0; y < coefs->h; y++) {
+        if (covered) {
+            scale_box_integral_row(src, out, coefs, integral, y);
+        } else {
+            scale_bilinear_row(src, out, coefs, y);
+        }
+    }
+}
+
+void scale(in_image_t* src,
+           out_image_t* dst,
+           const scale_coefs_t* coefs,
+           const integral_image_t* integral) {
+    pixel_writer_t out = {.pixels = dst->pixels, .stride = dst->w};
+    scale_rows(src, out, coefs, integral);
+}
+
+void tensor_lut_init(tensor_lut_t* lut, tensor_format_t format, float scale, int zero_point) {
+    lut->format = format;
+    for (int i = 0; i < 256; i++) {
+        // Model expects pixels normalized to [0, 1]
+        float value = i / 255.0f;
+        lut->f32[i] = value;
+        int32_t quantized = (int32_t)roundf(value / scale) + zero_point;
+        if (quantized < INT8_MIN) {
+            quantized = INT8_MIN;
+        } else if (quantized > INT8_MAX) {
+            quantized = INT8_MAX;
+        }
+        lut->i8[i] = quantized;
+    }
+}
+
+/**
+ * @brief Convert the raw section kept in the preview to the tensor with contrast normalized
+ */
+template <typename T>
+static void contrast_apply(tensor_image_t* dst, const T* lut, unsigned int count) {
+    contrast_t* contrast = dst->contrast;
+    if (contrast->polarity == POLARITY_AUTO) {
+        // Digits cover the minority of the section, so the mean leans to the background
+        contrast->inverted = contrast->sum > (contrast->min + contrast->max) * count / 2;
+    } else {
+        contrast->inverted = contrast->polarity == POLARITY_INVERT;
+    }
+
+    unsigned int range = contrast->max - contrast->min;
+    range = range < CONTRAST_MIN_RANGE ? CONTRAST_MIN_RANGE : range;
+    uint8_t stretch[256];
+    T combined[256];
+    for (unsigned int i = contrast->min; i <= contrast->max; i++) {
+        unsigned int value = ((i - contrast->min) * 255 + range / 2) / range;
+        value = contrast->inverted ? 255 - value : value;
+        stretch[i] = value;
+        combined[i] = lut[value];
+    }
+
+    T* data = (T*)dst->data;
+    for (unsigned int i = 0; i < count; i++) {
+        data[i] = combined[dst->preview[i]];
+        dst->preview[i] = stretch[dst->preview[i]];
+    }
+}
+
+/**
+ * @brief Resample given output rows straight to a tensor
+ *
+ * With contrast normalization, the tensor is written once the last row of the
+ * section is done.
+ */
+template <typename T>
+static void scale_to_tensor_typed(in_image_t* src,
+                                  tensor_image_t* dst,
+                                  const T* lut,
+                                  const scale_coefs_t* coefs,
+                                  const integral_image_t* integral,
+                                  unsigned int y0,
+                                  unsigned int y1) {
+    if (dst->contrast) {
+        if (y0 == 0) {
+            dst->contrast->min = 255;
+            dst->contrast->max = 0;
+            dst->contrast->sum = 0;
+        }
+        contrast_writer_t out = {dst->preview, dst->contrast, coefs->w};
+        for (unsigned int y = y0; y < y1; y++) {
+            scale_row(src, out, coefs, integral, y);
+        }
+        if (y1 == coefs->h) {
+            contrast_apply(dst, lut, coefs->w * coefs->h);
+        }
+    } else if (dst->preview) {
+        tensor_writer_t<T, true> out = {(T*)dst->data, lut, dst->preview, coefs->w};
+        for (unsigned int y = y0; y < y1; y++) {
+            scale_row(src, out, coefs, integral, y);
+        }
+    } else {
+        tensor_writer_t<T, false> out = {(T*)dst->data, lut, nullptr, coefs->w};
+        for (unsigned int y = y0; y < y1; y++) {
+            scale_row(src, out, coefs, integral, y);
+        }
+    }
+}
+
+static void scale_to_tensor_rows(in_image_t* src,
+                                 tensor_image_t* dst,
+                                 const scale_coefs_t* coefs,
+                                 const integral_image_t* integral,
+                                 unsigned int y0,
+                                 unsigned int y1) {
+    if (dst->lut->format == TENSOR_FORMAT_INT8) {
+        scale_to_tensor_typed(src, dst, dst->lut->i8, coefs, integral, y0, y1);
+    } else {
+        scale_to_tensor_typed(src, dst, dst->lut->f32, coefs, integral, y0, y1);
+    }
+}
+
+void scale_to_tensor(in_image_t* src,
+                     tensor_image_t* dst,
+                     const scale_coefs_t* coefs,
+                     const integral_image_t* integral) {
+    scale_to_tensor_rows(src, dst, coefs, integral, 0, coefs->h);
+}
+
+/**
+ * @brief First frame row read by given output row of a job
+ */
+static inline unsigned int scale_job_source_row(const scale_job_t* job, unsigned int y) {
+    if (job->coefs->mode == SCALE_MODE_BOX) {
+        return job->src.offsetY + job->coefs->binY[y];
+    }
+    if (job->coefs->mode == SCALE_MODE_AFFINE) {
+        // Topmost end of the row
+        const scale_affine_t* affine = &job->coefs->affine;
+        int32_t first = affine->y + (int32_t)y * affine->vy;
+        int32_t last = first + (int32_t)(job->coefs->w - 1) * affine->uy;
+        int32_t top = (first < last ? first : last) >> 16;
+        return top > 0 ? top : 0;
+    }
+    if (job->coefs->mode == SCALE_MODE_REMAP) {
+        const uint32_t* offsets = job->coefs->remapOffsets + y * job->coefs->w;
+        uint32_t first = offsets[0];
+        uint32_t last = offsets[job->coefs->w - 1];
+        return (first < last ? first : last) / job->src.w;
+    }
+    return job->src.offsetY + job->coefs->y[y].index;
+}
+
+/**
+ * @brief Resample several sections of one frame in a single top to bottom walk
+ *
+ * Output rows of all jobs are merged by the frame row they start reading at,
+ * so the framebuffer is streamed once in order instead of being revisited
+ * from the top for every section.
+ */
+void scale_multi_to_tensor(scale_job_t* jobs, unsigned int count) {
+    // Process large job lists in chunks to keep the progress table on stack
+    while (count > SCALE_MAX_JOBS) {
+        scale_multi_to_tensor(jobs, SCALE_MAX_JOBS);
+        jobs += SCALE_MAX_JOBS;
+        count -= SCALE_MAX_JOBS;
+    }
+
+    unsigned int rows[SCALE_MAX_JOBS] = {0};
+    while (true) {
+        // Pick the job whose next output row starts highest in the frame
+        int next = -1;
+        unsigned int next_row = 0;
+        for (unsigned int i = 0; i < count; i++) {
+            if (rows[i] >= jobs[i].coefs->h) {
+                continue;
+            }
+            unsigned int row = scale_job_source_row(&jobs[i], rows[i]);
+            if (next < 0 || row < next_row) {
+                next = i;
+                next_row = row;
+            }
+        }
+        if (next < 0) {
+            break;
+        }
+
+        // Emit all consecutive rows of that job starting at the same frame row
+        scale_job_t* job = &jobs[next];
+        unsigned int y0 = rows[next];
+        unsigned int y1 = y0 + 1;
+        while (y1 < job->coefs->h && scale_job_source_row(job, y1) == next_row) {
+            y1++;
+        }
+        scale_to_tensor_rows(&job->src, &job->dst, job->coefs, job->integral, y0, y1);
+        rows[next] = y1;
+    }
+}
@@ -1,6 +1,26 @@
 #pragma once
 
 #include <stdint.h>
+#include "integral_image.h"
+
+// Fixed-point precision of the bilinear weights (Q8)
+#define SCALE_WEIGHT_BITS 8
+#define SCALE_WEIGHT_ONE (1 << SCALE_WEIGHT_BITS)
+// Largest supported output side (model input is 28x28)
+#define SCALE_MAX_OUTPUT 28
+// Downscale ratio above which box filtering is used instead of bilinear
+#define SCALE_BOX_RATIO 2
+// Sections merged into one frame walk at a time
+#define SCALE_MAX_JOBS 32
+// Smallest pixel range stretched to full scale, flatter sections are not amplified further
+#define CONTRAST_MIN_RANGE 32
+
+typedef enum {
+    SCALE_MODE_BILINEAR,
+    SCALE_MODE_BOX,
+    SCALE_MODE_AFFINE,
+    SCALE_MODE_REMAP,
+} scale_mode_t;
 
 typedef struct {
     uint8_t* pixels;
@@ -18,4 +38,155 @@ typedef struct {
     unsigned int h;
 } out_image_t;
 
-void scale(in_image_t* in_image, out_image_t* out_image, unsigned int out_w, unsigned int out_h);
+/**
+ * @brief Source tap of one output column/row
+ */
+typedef struct {
+    uint16_t index;  // First source pixel, relative to the section
+    uint8_t next;    // Distance to the second source pixel (0 on the last pixel)
+    uint8_t weight;  // Weight of the second source pixel in SCALE_WEIGHT_ONE units
+} scale_tap_t;
+
+/**
+ * @brief Affine walk through the frame in Q16 coordinates
+ */
+typedef struct {
+    int32_t x;   // Source position of the first output pixel
+    int32_t y;
+    int32_t ux;  // Source step per output column
+    int32_t uy;
+    int32_t vx;  // Source step per output row
+    int32_t vy;
+    bool clamp;  // Some taps fall outside of the frame and need clamping
+} scale_affine_t;
+
+/**
+ * @brief Precomputed coefficients for one (section size -> output size) pair
+ *
+ * Bilinear mode uses the taps, box mode averages the source pixels between
+ * consecutive bin edges with four lookups in the frame integral image. Affine mode walks the frame in absolute coordinates
+ * and remap mode gathers through a per-pixel table of absolute offsets, both
+ * ignore the section offset and size.
+ */
+typedef struct {
+    scale_mode_t mode;
+    unsigned int sectionWidth;
+    unsigned int sectionHeight;
+    unsigned int w;
+    unsigned int h;
+    scale_tap_t x[SCALE_MAX_OUTPUT];
+    scale_tap_t y[SCALE_MAX_OUTPUT];
+    uint16_t binX[SCALE_MAX_OUTPUT + 1];
+    uint16_t binY[SCALE_MAX_OUTPUT + 1];
+    scale_affine_t affine;
+    const uint32_t* remapOffsets;  // Frame offset of the top-left tap of every output pixel
+    const uint16_t* remapWeights;  // Horizontal weight in low byte, vertical in high byte
+} scale_coefs_t;
+
+typedef enum {
+    TENSOR_FORMAT_FLOAT32,
+    TENSOR_FORMAT_INT8,
+} tensor_format_t;
+
+/**
+ * @brief Conversion of 8-bit pixels to model input values
+ */
+typedef struct {
+    tensor_format_t format;
+    float f32[256];
+    int8_t i8[256];
+} tensor_lut_t;
+
+typedef enum {
+    POLARITY_KEEP,    // Section is already bright digits on dark background
+    POLARITY_INVERT,  // Section is always dark digits on bright background
+    POLARITY_AUTO,    // Decide per section from its mean brightness
+} polarity_t;
+
+/**
+ * @brief Contrast stretch and polarity normalization of one section
+ *
+ * Statistics are gathered while the section is resampled, the output is then
+ * converted through a single 256-entry table that applies the stretch, the
+ * inversion and the tensor conversion together.
+ */
+typedef struct {
+    polarity_t polarity;
+    uint8_t min;    // Darkest output pixel
+    uint8_t max;    // Brightest output pixel
+    uint32_t sum;   // Sum of output pixels
+    bool inverted;  // Result of polarity detection
+} contrast_t;
+
+/**
+ * @brief Model input tensor as a resampling destination
+ */
+typedef struct {
+    void* data;               // Tensor data, float or int8 depending on lut->format
+    const tensor_lut_t* lut;  // Pixel conversion
+    uint8_t* preview;         // Optional 8-bit copy of the output, NULL when not needed
+    contrast_t* contrast;     // Optional normalization, needs preview to hold the raw output
+} tensor_image_t;
+
+/**
+ * @brief One section of a multi-section resampling pass
+ */
+typedef struct {
+    in_image_t src;
+    const scale_coefs_t* coefs;
+    tensor_image_t dst;
+    const integral_image_t* integral;  // Frame integral image covering the section, box mode only
+} scale_job_t;
+
+void scale_coefs_init(scale_coefs_t* coefs,
+                      unsigned int sectionWidth,
+                      unsigned int sectionHeight,
+                      unsigned int out_w,
+                      unsigned int out_h);
+void affine_from_rectangle(float matrix[6],
+                           float x,
+                           float y,
+                           float width,
+                           float height,
+                           float angle,
+                           unsigned int out_w,
+                           unsigned int out_h);
+void scale_coefs_init_affine(scale_coefs_t* coefs,
+                             const float matrix[6],
+                             unsigned int out_w,
+                             unsigned int out_h,
+                             unsigned int frame_w,
+                             unsigned int frame_h);
+bool homography_from_quad(float matrix[9], const float corners[8], float width, float height);
+void remap_init_homography(uint32_t* offsets,
+                           uint16_t* weights,
+                           const float matrix[9],
+                           unsigned int cells,
+                           unsigned int out_w,
+                           unsigned int out_h,
+                           unsigned int frame_w,
+                           unsigned int frame_h);
+void scale_coefs_init_remap(scale_coefs_t* coefs,
+                            const uint32_t* offsets,
+                            const uint16_t* weights,
+                            unsigned int out_w,
+                            unsigned int out_h);
+void scale_fixed(in_image_t* in_image, out_image_t* out_image, const scale_coefs_t* coefs);
+void scale_box(in_image_t* in_image,
+               out_image_t* out_image,
+               const scale_coefs_t* coefs,
+               const integral_image_t* integral);
+void scale_reference(in_image_t* in_image,
+                     out_image_t* out_image,
+                     unsigned int out_w,
+                     unsigned int out_h);
+void scale(in_image_t* in_image,
+           out_image_t* out_image,
+           const scale_coefs_t* coefs,
+           const integral_image_t* integral);
+void tensor_lut_init(tensor_lut_t* lut, tensor_format_t format, float scale, int zero_point);
+void scale_to_tensor(in_image_t* in_image,
+                     tensor_image_t* tensor_image,
+                     const scale_coefs_t* coefs,
+                     const integral_image_t* integral);
+void scale_multi_to_tensor(scale_job_t* jobs, unsigned int count);
@@ -0,0 +1,55 @@
+#include "integral_image.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Set covered area, growing the table only when it does not fit
+ *
+ * @return false when the table could not be allocated
+ */
+bool integral_image_reserve(integral_image_t* integral,
+                            unsigned int x,
+                            unsigned int y,
+                            unsigned int w,
+                            unsigned int h) {
+    const size_t entries = (size_t)(w + 1) * (h + 1);
+    if (entries > integral->capacity) {
+        uint32_t* sums = (uint32_t*)realloc(integral->sums, entries * sizeof(uint32_t));
+        if (!sums) {
+            return false;
+        }
+        integral->sums = sums;
+        integral->capacity = entries;
+    }
+    integral->x = x;
+    integral->y = y;
+    integral->w = w;
+    integral->h = h;
+    // First row never changes
+    memset(integral->sums, 0, (w + 1) * sizeof(uint32_t));
+    return true;
+}
+
+/**
+ * @brief Compute the table of the covered area in one row-order pass over the frame
+ */
+void integral_image_build(integral_image_t* integral, const uint8_t* pixels, unsigned int stride) {
+    const unsigned int w = integral->w;
+    const uint8_t* row = pixels + integral->y * stride + integral->x;
+    uint32_t* previous = integral->sums;
+    for (unsigned int r = 0; r < integral->h; r++, row += stride) {
+        uint32_t* current = previous + w + 1;
+        uint32_t running = 0;
+        current[0] = 0;
+        for (unsigned int c = 0; c < w; c++) {
+            running += row[c];
+            current[c + 1] = previous[c + 1] + running;
+        }
+        previous = current;
+    }
+}
+
+void integral_image_free(integral_image_t* integral) {
+    free(integral->sums);
+    memset(integral, 0, sizeof(*integral));
+}
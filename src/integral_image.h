@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Summed-area table of a part of the frame
+ *
+ * Entry (x, y) holds the sum of all pixels above and left of it, the first
+ * row and column are zero so any box sum takes four lookups.
+ */
+typedef struct {
+    uint32_t* sums;   // (w + 1) * (h + 1) entries
+    size_t capacity;  // Allocated entries, kept across frames
+    unsigned int x;   // Covered area in frame coordinates
+    unsigned int y;
+    unsigned int w;
+    unsigned int h;
+} integral_image_t;
+
+bool integral_image_reserve(integral_image_t* integral,
+                            unsigned int x,
+                            unsigned int y,
+                            unsigned int w,
+                            unsigned int h);
+void integral_image_build(integral_image_t* integral, const uint8_t* pixels, unsigned int stride);
+void integral_image_free(integral_image_t* integral);
+
+/**
+ * @brief Sum of pixels of a box given in frame coordinates, must lie inside the covered area
+ */
+static inline uint32_t integral_image_sum(const integral_image_t* integral,
+                                          unsigned int x,
+                                          unsigned int y,
+                                          unsigned int w,
+                                          unsigned int h) {
+    const unsigned int stride = integral->w + 1;
+    const uint32_t* top = integral->sums + (y - integral->y) * stride + (x - integral->x);
+    const uint32_t* bottom = top + h * stride;
+    return bottom[w] - bottom[0] - top[w] + top[0];
+}
+
+/**
+ * @brief Mean of pixels of a box given in frame coordinates
+ */
+static inline uint8_t integral_image_mean(const integral_image_t* integral,
+                                          unsigned int x,
+                                          unsigned int y,
+                                          unsigned int w,
+                                          unsigned int h) {
+    const uint32_t area = w * h;
+    return (integral_image_sum(integral, x, y, w, h) + area / 2) / area;
+}
@@ -0,0 +1,508 @@
+#include "kernels.h"
+#include <math.h>
+
+/**
+ * Fixed-point helpers, same as gemmlowp and the TFLM common code
+ */
+
+static inline int32_t saturating_rounding_doubling_high_mul(int32_t a, int32_t b) {
+    if (a == b && a == INT32_MIN) {
+        return INT32_MAX;
+    }
+    int64_t ab = (int64_t)a * (int64_t)b;
+    int32_t nudge = ab >= 0 ? (1 << 30) : (1 - (1 << 30));
+    return (int32_t)((ab + nudge) / (1ll << 31));
+}
+
+static inline int32_t rounding_divide_by_pot(int32_t x, int exponent) {
+    const int32_t mask = (int32_t)((1ll << exponent) - 1);
+    const int32_t remainder = x & mask;
+    const int32_t threshold = (mask >> 1) + (x < 0 ? 1 : 0);
+    return (x >> exponent) + (remainder > threshold ? 1 : 0);
+}
+
+static inline int32_t saturating_left_shift(int32_t x, int exponent) {
+    const int32_t threshold = (int32_t)((1ll << (31 - exponent)) - 1);
+    if (x > threshold) {
+        return INT32_MAX;
+    }
+    if (x < -threshold) {
+        return INT32_MIN;
+    }
+    return (int32_t)((uint32_t)x << exponent);
+}
+
+int32_t multiply_by_quantized_multiplier(int32_t x, int32_t multiplier, int shift) {
+    const int left_shift = shift > 0 ? shift : 0;
+    const int right_shift = shift > 0 ? 0 : -shift;
+    return rounding_divide_by_pot(
+        saturating_rounding_doubling_high_mul(x * (1 << left_shift), multiplier), right_shift);
+}
+
+static inline int32_t clamp(int32_t value, int32_t low, int32_t high) {
+    return value < low ? low : (value > high ? high : value);
+}
+
+/**
+ * @brief exp(x) for x in [-1/4, 0), Q0.31 in and out
+ */
+static int32_t exp_on_interval_between_negative_one_quarter_and_0_excl(int32_t a) {
+    const int32_t constant_term = 1895147668;     // exp(-1/8)
+    const int32_t constant_1_over_3 = 715827883;  // 1/3
+    // Taylor expansion around -1/8
+    const int32_t x = a + (1 << 28);
+    const int32_t x2 = saturating_rounding_doubling_high_mul(x, x);
+    const int32_t x3 = saturating_rounding_doubling_high_mul(x2, x);
+    const int32_t x4 = saturating_rounding_doubling_high_mul(x2, x2);
+    const int32_t x4_over_4 = rounding_divide_by_pot(x4, 2);
+    const int32_t x4_over_24_plus_x3_over_6_plus_x2_over_2 = rounding_divide_by_pot(
+        saturating_rounding_doubling_high_mul(x4_over_4 + x3, constant_1_over_3) + x2, 1);
+    return constant_term + saturating_rounding_doubling_high_mul(
+                               constant_term, x + x4_over_24_plus_x3_over_6_plus_x2_over_2);
+}
+
+/**
+ * @brief exp(x) for x <= 0, input Q5.26, output Q0.31
+ */
+static int32_t exp_on_negative_values(int32_t a) {
+    const int fractional_bits = 26;
+    const int32_t one_quarter = 1 << (fractional_bits - 2);
+    const int32_t mask = one_quarter - 1;
+    const int32_t a_mod_quarter_minus_one_quarter = (a & mask) - one_quarter;
+    int32_t result = exp_on_interval_between_negative_one_quarter_and_0_excl(
+        saturating_left_shift(a_mod_quarter_minus_one_quarter, 5));
+    const int32_t remainder = a_mod_quarter_minus_one_quarter - a;
+
+    // Barrel shifter over the integer part, multipliers are exp(-2^exponent)
+    static const int32_t multipliers[] = {1672461947, 1302514674, 790015084, 290630308,
+                                          39332535,   720401,     242};
+    for (int exponent = -2; exponent <= 4; exponent++) {
+        if (remainder & (1 << (fractional_bits + exponent))) {
+            result = saturating_rounding_doubling_high_mul(result, multipliers[exponent + 2]);
+        }
+    }
+    return a == 0 ? INT32_MAX : result;
+}
+
+/**
+ * @brief 1 / (1 + x) for x in [0, 1), Q0.31 in and out
+ */
+static int32_t one_over_one_plus_x_for_x_in_0_1(int32_t a) {
+    // Rounding half sum of a and one
+    const int64_t sum = (int64_t)a + INT32_MAX;
+    const int32_t half_denominator = (int32_t)((sum + (sum >= 0 ? 1 : -1)) / 2);
+    // Newton-Raphson division in Q2.29
+    const int32_t constant_48_over_17 = 1515870810;
+    const int32_t constant_neg_32_over_17 = -1010580540;
+    int32_t x = constant_48_over_17 +
+                saturating_rounding_doubling_high_mul(half_denominator, constant_neg_32_over_17);
+    for (int i = 0; i < 3; i++) {
+        const int32_t half_denominator_times_x = saturating_rounding_doubling_high_mul(half_denominator, x);
+        const int32_t one_minus_half_denominator_times_x = (1 << 29) - half_denominator_times_x;
+        x = x + saturating_left_shift(
+                    saturating_rounding_doubling_high_mul(x, one_minus_half_denominator_times_x), 2);
+    }
+    return saturating_left_shift(x, 1);
+}
+
+static inline int count_leading_zeros(uint32_t x) {
+    return x == 0 ? 32 : __builtin_clz(x);
+}
+
+void kernel_quantize_int8(const float* input, int8_t* output, int size, float scale, int32_t zero_point) {
+    const double scale_double = scale;
+    for (int i = 0; i < size; i++) {
+        const int32_t unclamped = (int32_t)round(input[i] / scale_double) + zero_point;
+        output[i] = clamp(unclamped, INT8_MIN, INT8_MAX);
+    }
+}
+
+void kernel_dequantize_int8(const int8_t* input, float* output, int size, float scale, int32_t zero_point) {
+    const double scale_double = scale;
+    for (int i = 0; i < size; i++) {
+        output[i] = (float)(scale_double * (input[i] - zero_point));
+    }
+}
+
+void kernel_conv2d_int8(const conv_params_t* p,
+                        const int8_t* input,
+                        const int8_t* filter,
+                        const int32_t* bias,
+                        int8_t* output) {
+    for (int batch = 0; batch < p->batches; batch++) {
+        const int8_t* batch_input = input + batch * p->input_h * p->input_w * p->input_c;
+        for (int out_y = 0; out_y < p->output_h; out_y++) {
+            const int in_y_origin = out_y * p->stride_h - p->pad_h;
+            for (int out_x = 0; out_x < p->output_w; out_x++) {
+                const int in_x_origin = out_x * p->stride_w - p->pad_w;
+                for (int out_c = 0; out_c < p->output_c; out_c++) {
+                    int32_t acc = 0;
+                    for (int filter_y = 0; filter_y < p->filter_h; filter_y++) {
+                        const int in_y = in_y_origin + filter_y;
+                        if (in_y < 0 || in_y >= p->input_h) {
+                            continue;
+                        }
+                        for (int filter_x = 0; filter_x < p->filter_w; filter_x++) {
+                            const int in_x = in_x_origin + filter_x;
+                            if (in_x < 0 || in_x >= p->input_w) {
+                                continue;
+                            }
+                            const int8_t* in = batch_input + (in_y * p->input_w + in_x) * p->input_c;
+                            const int8_t* f =
+                                filter + ((out_c * p->filter_h + filter_y) * p->filter_w + filter_x) * p->input_c;
+                            for (int in_c = 0; in_c < p->input_c; in_c++) {
+                                acc += f[in_c] * (in[in_c] + p->input_offset);
+                            }
+                        }
+                    }
+                    if (bias) {
+                        acc += bias[out_c];
+                    }
+                    acc = multiply_by_quantized_multiplier(acc, p->multipliers[out_c], p->shifts[out_c]);
+                    acc += p->output_offset;
+                    *output++ = clamp(acc, p->act_min, p->act_max);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Convolutions specialized for the two TMNIST layers
+ *
+ * Both run without padding, so every filter tap lands inside the input and
+ * the input offset term sum(filter * input_offset) is a per-channel constant.
+ * It is folded into the bias once, leaving plain int8 multiply-accumulates in
+ * the inner loops. Integer sums are order independent, the result is the
+ * same as the reference kernel bit for bit.
+ */
+
+bool kernel_conv2d_has_specialized(const conv_params_t* p) {
+    if (p->stride_h != 1 || p->stride_w != 1 || p->pad_h != 0 || p->pad_w != 0) {
+        return false;
+    }
+    if (p->filter_h == 4 && p->filter_w == 4 && p->input_c == 1) {
+        return true;
+    }
+    return p->filter_h == 3 && p->filter_w == 3 && p->input_c % 4 == 0 && p->output_c % 2 == 0;
+}
+
+void kernel_conv2d_fold_bias(const conv_params_t* p,
+                             const int8_t* filter,
+                             const int32_t* bias,
+                             int32_t* folded_bias) {
+    const int filter_size = p->filter_h * p->filter_w * p->input_c;
+    for (int out_c = 0; out_c < p->output_c; out_c++) {
+        int32_t sum = 0;
+        for (int i = 0; i < filter_size; i++) {
+            sum += filter[out_c * filter_size + i];
+        }
+        folded_bias[out_c] = (bias ? bias[out_c] : 0) + sum * p->input_offset;
+    }
+}
+
+static inline int8_t requantize(const conv_params_t* p, int32_t acc, int out_c) {
+    acc = multiply_by_quantized_multiplier(acc, p->multipliers[out_c], p->shifts[out_c]);
+    return clamp(acc + p->output_offset, p->act_min, p->act_max);
+}
+
+/**
+ * @brief 4x4 filter over a single channel input
+ *
+ * The 16 input taps of an output pixel are loaded once into locals and
+ * reused for all output channels.
+ */
+static void conv2d_4x4x1_int8(const conv_params_t* p,
+                              const int8_t* input,
+                              const int8_t* filter,
+                              const int32_t* folded_bias,
+                              int8_t* output) {
+    const int w = p->input_w;
+    for (int batch = 0; batch < p->batches; batch++) {
+        const int8_t* batch_input = input + batch * p->input_h * w;
+        for (int out_y = 0; out_y < p->output_h; out_y++) {
+            for (int out_x = 0; out_x < p->output_w; out_x++) {
+                const int8_t* in = batch_input + out_y * w + out_x;
+                const int32_t x0 = in[0], x1 = in[1], x2 = in[2], x3 = in[3];
+                in += w;
+                const int32_t x4 = in[0], x5 = in[1], x6 = in[2], x7 = in[3];
+                in += w;
+                const int32_t x8 = in[0], x9 = in[1], x10 = in[2], x11 = in[3];
+                in += w;
+                const int32_t x12 = in[0], x13 = in[1], x14 = in[2], x15 = in[3];
+
+                const int8_t* f = filter;
+                for (int out_c = 0; out_c < p->output_c; out_c++, f += 16) {
+                    int32_t acc = folded_bias[out_c];
+                    acc += f[0] * x0 + f[1] * x1 + f[2] * x2 + f[3] * x3;
+                    acc += f[4] * x4 + f[5] * x5 + f[6] * x6 + f[7] * x7;
+                    acc += f[8] * x8 + f[9] * x9 + f[10] * x10 + f[11] * x11;
+                    acc += f[12] * x12 + f[13] * x13 + f[14] * x14 + f[15] * x15;
+                    *output++ = requantize(p, acc, out_c);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief 3x3 filter over a multi-channel input, two output channels at a time
+ *
+ * In NHWC each filter row covers 3 * input_c contiguous input bytes, so the
+ * patch is three straight runs. Every loaded input value feeds two channels.
+ */
+static void conv2d_3x3_int8(const conv_params_t* p,
+                            const int8_t* input,
+                            const int8_t* filter,
+                            const int32_t* folded_bias,
+                            int8_t* output) {
+    const int row_stride = p->input_w * p->input_c;
+    const int run = 3 * p->input_c;
+    const int filter_size = 3 * run;
+    for (int batch = 0; batch < p->batches; batch++) {
+        const int8_t* batch_input = input + batch * p->input_h * row_stride;
+        for (int out_y = 0; out_y < p->output_h; out_y++) {
+            for (int out_x = 0; out_x < p->output_w; out_x++) {
+                const int8_t* patch = batch_input + out_y * row_stride + out_x * p->input_c;
+                for (int out_c = 0; out_c < p->output_c; out_c += 2) {
+                    const int8_t* f0 = filter + out_c * filter_size;
+                    const int8_t* f1 = f0 + filter_size;
+                    int32_t acc0 = folded_bias[out_c];
+                    int32_t acc1 = folded_bias[out_c + 1];
+                    for (int row = 0; row < 3; row++) {
+                        const int8_t* in = patch + row * row_stride;
+                        for (int i = 0; i < run; i += 4, in += 4, f0 += 4, f1 += 4) {
+                            const int32_t a = in[0], b = in[1], c = in[2], d = in[3];
+                            acc0 += f0[0] * a + f0[1] * b + f0[2] * c + f0[3] * d;
+                            acc1 += f1[0] * a + f1[1] * b + f1[2] * c + f1[3] * d;
+                        }
+                    }
+                    output[out_c] = requantize(p, acc0, out_c);
+                    output[out_c + 1] = requantize(p, acc1, out_c + 1);
+                }
+                output += p->output_c;
+            }
+        }
+    }
+}
+
+void kernel_conv2d_specialized_int8(const conv_params_t* p,
+                                    const int8_t* input,
+                                    const int8_t* filter,
+                                    const int32_t* folded_bias,
+                                    int8_t* output) {
+    if (p->filter_h == 4) {
+        conv2d_4x4x1_int8(p, input, filter, folded_bias, output);
+    } else {
+        conv2d_3x3_int8(p, input, filter, folded_bias, output);
+    }
+}
+
+void kernel_max_pool_int8(const pool_params_t* p, const int8_t* input, int8_t* output) {
+    for (int batch = 0; batch < p->batches; batch++) {
+        const int8_t* batch_input = input + batch * p->input_h * p->input_w * p->channels;
+        for (int out_y = 0; out_y < p->output_h; out_y++) {
+            const int in_y_origin = out_y * p->stride_h - p->pad_h;
+            const int filter_y_start = in_y_origin < 0 ? -in_y_origin : 0;
+            const int filter_y_end =
+                p->filter_h < p->input_h - in_y_origin ? p->filter_h : p->input_h - in_y_origin;
+            for (int out_x = 0; out_x < p->output_w; out_x++) {
+                const int in_x_origin = out_x * p->stride_w - p->pad_w;
+                const int filter_x_start = in_x_origin < 0 ? -in_x_origin : 0;
+                const int filter_x_end =
+                    p->filter_w < p->input_w - in_x_origin ? p->filter_w : p->input_w - in_x_origin;
+                for (int channel = 0; channel < p->channels; channel++) {
+                    int32_t max = INT8_MIN;
+                    for (int filter_y = filter_y_start; filter_y < filter_y_end; filter_y++) {
+                        for (int filter_x = filter_x_start; filter_x < filter_x_end; filter_x++) {
+                            const int in_y = in_y_origin + filter_y;
+                            const int in_x = in_x_origin + filter_x;
+                            const int8_t value = batch_input[(in_y * p->input_w + in_x) * p->channels + channel];
+                            max = value > max ? value : max;
+                        }
+                    }
+                    *output++ = clamp(max, p->act_min, p->act_max);
+                }
+            }
+        }
+    }
+}
+
+bool kernel_conv2d_pool_can_fuse(const conv_params_t* conv, const pool_params_t* pool) {
+    return conv->pad_h == 0 && conv->pad_w == 0 && pool->pad_h == 0 && pool->pad_w == 0 &&
+           pool->batches == conv->batches && pool->input_h == conv->output_h &&
+           pool->input_w == conv->output_w && pool->channels == conv->output_c &&
+           (pool->output_h - 1) * pool->stride_h + pool->filter_h <= pool->input_h &&
+           (pool->output_w - 1) * pool->stride_w + pool->filter_w <= pool->input_w;
+}
+
+int kernel_conv2d_pool_scratch_size(const conv_params_t* conv, const pool_params_t* pool) {
+    return pool->filter_h * conv->output_w * conv->output_c;
+}
+
+void kernel_conv2d_pool_int8(const conv_params_t* conv,
+                             const pool_params_t* pool,
+                             const int8_t* input,
+                             const int8_t* filter,
+                             const int32_t* bias,
+                             int8_t* scratch,
+                             int8_t* output) {
+    // Band of convolution rows feeding one row of pooling windows
+    conv_params_t band = *conv;
+    band.batches = 1;
+    band.output_h = pool->filter_h;
+    band.input_h = (pool->filter_h - 1) * conv->stride_h + conv->filter_h;
+    const bool specialized = kernel_conv2d_has_specialized(conv);
+    const int channels = conv->output_c;
+    const int band_row = conv->output_w * channels;
+    const int input_row = conv->input_w * conv->input_c;
+
+    for (int batch = 0; batch < conv->batches; batch++) {
+        const int8_t* batch_input = input + batch * conv->input_h * input_row;
+        for (int out_y = 0; out_y < pool->output_h; out_y++) {
+            const int8_t* band_input = batch_input + out_y * pool->stride_h * conv->stride_h * input_row;
+            if (specialized) {
+                kernel_conv2d_specialized_int8(&band, band_input, filter, bias, scratch);
+            } else {
+                kernel_conv2d_int8(&band, band_input, filter, bias, scratch);
+            }
+            for (int out_x = 0; out_x < pool->output_w; out_x++) {
+                const int8_t* window = scratch + out_x * pool->stride_w * channels;
+                for (int channel = 0; channel < channels; channel++) {
+                    output[channel] = INT8_MIN;
+                }
+                for (int filter_y = 0; filter_y < pool->filter_h; filter_y++) {
+                    for (int filter_x = 0; filter_x < pool->filter_w; filter_x++) {
+                        const int8_t* in = window + filter_y * band_row + filter_x * channels;
+                        for (int channel = 0; channel < channels; channel++) {
+                            output[channel] = in[channel] > output[channel] ? in[channel] : output[channel];
+                        }
+                    }
+                }
+                for (int channel = 0; channel < channels; channel++) {
+                    output[channel] = clamp(output[channel], pool->act_min, pool->act_max);
+                }
+                output += channels;
+            }
+        }
+    }
+}
+
+void kernel_fully_connected_int8(const fully_connected_params_t* p,
+                                 const int8_t* input,
+                                 const int8_t* filter,
+                                 const int32_t* bias,
+                                 int8_t* output) {
+    // Each weight row is read once per tile of batches, every digit of the tile accumulates
+    // its own dot product from the same weight
+    int32_t acc[KERNEL_FC_BATCH_TILE];
+    for (int out_c = 0; out_c < p->output_size; out_c++) {
+        const int8_t* f = filter + out_c * p->input_size;
+        for (int first = 0; first < p->batches; first += KERNEL_FC_BATCH_TILE) {
+            const int tile = p->batches - first < KERNEL_FC_BATCH_TILE ? p->batches - first
+                                                                       : KERNEL_FC_BATCH_TILE;
+            const int8_t* in = input + first * p->input_size;
+            for (int b = 0; b < tile; b++) {
+                acc[b] = bias ? bias[out_c] : 0;
+            }
+            if (tile == 1) {
+                // Single digit keeps the plain dot product the compiler vectorizes
+                for (int d = 0; d < p->input_size; d++) {
+                    acc[0] += (f[d] + p->filter_offset) * (in[d] + p->input_offset);
+                }
+            } else {
+                for (int d = 0; d < p->input_size; d++) {
+                    const int32_t weight = f[d] + p->filter_offset;
+                    for (int b = 0; b < tile; b++) {
+                        acc[b] += weight * (in[b * p->input_size + d] + p->input_offset);
+                    }
+                }
+            }
+            for (int b = 0; b < tile; b++) {
+                int32_t value = multiply_by_quantized_multiplier(acc[b], p->multiplier, p->shift);
+                value += p->output_offset;
+                output[(first + b) * p->output_size + out_c] = clamp(value, p->act_min, p->act_max);
+            }
+        }
+    }
+}
+
+void kernel_fully_connected_sparse_int8(const fully_connected_params_t* p,
+                                        const int8_t* input,
+                                        const sparse_matrix_t* filter,
+                                        const int32_t* folded_bias,
+                                        int8_t* output) {
+    // Same batch tiling as the dense kernel, the values and steps of a row are read once per tile
+    int32_t acc[KERNEL_FC_BATCH_TILE];
+    for (int first = 0; first < p->batches; first += KERNEL_FC_BATCH_TILE) {
+        const int tile = p->batches - first < KERNEL_FC_BATCH_TILE ? p->batches - first
+                                                                   : KERNEL_FC_BATCH_TILE;
+        const int8_t* in = input + first * p->input_size;
+        const int8_t* value = filter->values;
+        const uint8_t* step = filter->col_steps;
+        for (int out_c = 0; out_c < p->output_size; out_c++) {
+            const int8_t* end = value + filter->row_lengths[out_c];
+            int column = 0;
+            for (int b = 0; b < tile; b++) {
+                acc[b] = folded_bias[out_c];
+            }
+            for (; value < end; value++, step++) {
+                column += *step;
+                for (int b = 0; b < tile; b++) {
+                    acc[b] += *value * in[b * p->input_size + column];
+                }
+            }
+            for (int b = 0; b < tile; b++) {
+                int32_t result = multiply_by_quantized_multiplier(acc[b], p->multiplier, p->shift);
+                result += p->output_offset;
+                output[(first + b) * p->output_size + out_c] = clamp(result, p->act_min, p->act_max);
+            }
+        }
+    }
+}
+
+void kernel_softmax_int8(const softmax_params_t* p, const int8_t* input, int8_t* output) {
+    // Differences are Q5.26, the sum of exponentials Q12.19
+    const int accumulation_integer_bits = 12;
+    for (int batch = 0; batch < p->batches; batch++) {
+        const int8_t* in = input + batch * p->size;
+        int8_t* out = output + batch * p->size;
+
+        int32_t max_in_row = INT8_MIN;
+        for (int c = 0; c < p->size; c++) {
+            max_in_row = in[c] > max_in_row ? in[c] : max_in_row;
+        }
+
+        int32_t sum_of_exps = 0;
+        for (int c = 0; c < p->size; c++) {
+            const int32_t input_diff = in[c] - max_in_row;
+            if (input_diff >= p->diff_min) {
+                const int32_t input_diff_rescaled = saturating_rounding_doubling_high_mul(
+                    input_diff * (1 << p->input_left_shift), p->input_multiplier);
+                sum_of_exps += rounding_divide_by_pot(exp_on_negative_values(input_diff_rescaled),
+                                                      accumulation_integer_bits);
+            }
+        }
+
+        // Reciprocal of the sum
+        const int headroom_plus_one = count_leading_zeros((uint32_t)sum_of_exps);
+        const int num_bits_over_unit = accumulation_integer_bits - headroom_plus_one;
+        const int32_t shifted_sum_minus_one =
+            (int32_t)(((uint32_t)sum_of_exps << headroom_plus_one) - ((uint32_t)1 << 31));
+        const int32_t shifted_scale = one_over_one_plus_x_for_x_in_0_1(shifted_sum_minus_one);
+
+        for (int c = 0; c < p->size; c++) {
+            const int32_t input_diff = in[c] - max_in_row;
+            if (input_diff >= p->diff_min) {
+                const int32_t input_diff_rescaled = saturating_rounding_doubling_high_mul(
+                    input_diff * (1 << p->input_left_shift), p->input_multiplier);
+                const int32_t exp_in_0 = exp_on_negative_values(input_diff_rescaled);
+                const int32_t unsat_output = rounding_divide_by_pot(
+                    saturating_rounding_doubling_high_mul(shifted_scale, exp_in_0), num_bits_over_unit + 31 - 8);
+                out[c] = clamp(unsat_output + INT8_MIN, INT8_MIN, INT8_MAX);
+            } else {
+                out[c] = INT8_MIN;
+            }
+        }
+    }
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Integer kernels of the TMNIST graph
+ *
+ * Arithmetic follows the TFLM reference kernels step by step (same rounding,
+ * same saturation), so the generated graph is bit-exact with the interpreter.
+ * Tensors are NHWC, convolution filters OHWI.
+ */
+
+typedef struct {
+    int batches;
+    int input_h;
+    int input_w;
+    int input_c;
+    int filter_h;
+    int filter_w;
+    int output_h;
+    int output_w;
+    int output_c;
+    int stride_h;
+    int stride_w;
+    int pad_h;
+    int pad_w;
+    int32_t input_offset;  // Negated input zero point
+    int32_t output_offset;
+    int32_t act_min;
+    int32_t act_max;
+    const int32_t* multipliers;  // Per output channel
+    const int32_t* shifts;
+} conv_params_t;
+
+typedef struct {
+    int batches;
+    int input_h;
+    int input_w;
+    int channels;
+    int filter_h;
+    int filter_w;
+    int output_h;
+    int output_w;
+    int stride_h;
+    int stride_w;
+    int pad_h;
+    int pad_w;
+    int32_t act_min;
+    int32_t act_max;
+} pool_params_t;
+
+typedef struct {
+    int batches;
+    int input_size;
+    int output_size;
+    int32_t input_offset;
+    int32_t filter_offset;
+    int32_t output_offset;
+    int32_t multiplier;
+    int32_t shift;
+    int32_t act_min;
+    int32_t act_max;
+} fully_connected_params_t;
+
+/**
+ * @brief Pruned weight matrix, non-zero values row by row
+ *
+ * Column indices are stored as the step from the previous value of the row
+ * (the first step is the column itself). Gaps over 255 are bridged by zero
+ * values with a step of 255.
+ */
+typedef struct {
+    const int8_t* values;
+    const uint8_t* col_steps;
+    const uint16_t* row_lengths;  // Values per output row
+} sparse_matrix_t;
+
+typedef struct {
+    int batches;
+    int size;
+    int32_t input_multiplier;
+    int32_t input_left_shift;
+    int32_t diff_min;
+} softmax_params_t;
+
+int32_t multiply_by_quantized_multiplier(int32_t x, int32_t multiplier, int shift);
+
+void kernel_quantize_int8(const float* input, int8_t* output, int size, float scale, int32_t zero_point);
+void kernel_dequantize_int8(const int8_t* input, float* output, int size, float scale, int32_t zero_point);
+void kernel_conv2d_int8(const conv_params_t* params,
+                        const int8_t* input,
+                        const int8_t* filter,
+                        const int32_t* bias,
+                        int8_t* output);
+bool kernel_conv2d_has_specialized(const conv_params_t* params);
+void kernel_conv2d_fold_bias(const conv_params_t* params,
+                             const int8_t* filter,
+                             const int32_t* bias,
+                             int32_t* folded_bias);
+void kernel_conv2d_specialized_int8(const conv_params_t* params,
+                                    const int8_t* input,
+                                    const int8_t* filter,
+                                    const int32_t* folded_bias,
+                                    int8_t* output);
+void kernel_max_pool_int8(const pool_params_t* params, const int8_t* input, int8_t* output);
+
+/**
+ * @brief Convolution followed by max pooling, without the full convolution output
+ *
+ * The convolution rows under one row of pooling windows are computed into
+ * scratch and pooled right away. Bias must be folded with
+ * kernel_conv2d_fold_bias() when kernel_conv2d_has_specialized(conv).
+ */
+bool kernel_conv2d_pool_can_fuse(const conv_params_t* conv, const pool_params_t* pool);
+int kernel_conv2d_pool_scratch_size(const conv_params_t* conv, const pool_params_t* pool);
+void kernel_conv2d_pool_int8(const conv_params_t* conv,
+                             const pool_params_t* pool,
+                             const int8_t* input,
+                             const int8_t* filter,
+                             const int32_t* bias,
+                             int8_t* scratch,
+                             int8_t* output);
+// Digits accumulated together per weight row by the fully connected kernels, a batch of up to
+// this many streams the weights once
+#define KERNEL_FC_BATCH_TILE 8
+
+void kernel_fully_connected_int8(const fully_connected_params_t* params,
+                                 const int8_t* input,
+                                 const int8_t* filter,
+                                 const int32_t* bias,
+                                 int8_t* output);
+/**
+ * @brief Fully connected layer over a sparse_matrix_t filter
+ *
+ * Needs filter_offset 0 and the input offset folded into the bias:
+ * folded_bias = bias + input_offset * sum of the row. Result is the same as
+ * kernel_fully_connected_int8() on the dense matrix.
+ */
+void kernel_fully_connected_sparse_int8(const fully_connected_params_t* params,
+                                        const int8_t* input,
+                                        const sparse_matrix_t* filter,
+                                        const int32_t* folded_bias,
+                                        int8_t* output);
+void kernel_softmax_int8(const softmax_params_t* params, const int8_t* input, int8_t* output);
@@ -6,85 +6,126 @@
 #include <NTPClient.h>
 #include <WiFi.h>
 #include <WiFiUdp.h>
+#include <esp_heap_caps.h>
 #include <esp_task_wdt.h>
 #include "camera_config.h"
 #include "config.h"
 #include "esp_camera.h"
-#include "image_manipulation.h"
+#include "kernels.h"
 #include "model_data.h"
+#include "model_store.h"
+#include "reading.h"
 #include "soc/rtc_wdt.h"
 #include "tensorflow/lite/micro/micro_interpreter.h"
-#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
-
-// Config structs
-struct rectangle_t {
-    unsigned int x;
-    unsigned int y;
-    unsigned int width;
-    unsigned int height;
+
+// What the inference task does with a frame, the camera and the model are only used by the tasks
+enum capture_action_t : uint8_t { CAPTURE_READ, CAPTURE_IMAGE, CAPTURE_BENCHMARK };
+
+// Frames wanted from the capture task
+struct capture_request_t {
+    AsyncWebServerRequest* request;  // NULL for background and burst readings
+    uint16_t burst;                  // Frames back to back, 0 for a single reading
+    uint8_t retry;                   // Low-confidence attempts before this background reading
+    capture_action_t action;
+};
+
+// Captured frame handed to the inference task, which returns it to the camera driver
+struct frame_t {
+    camera_fb_t* pic;
+    AsyncWebServerRequest* request;
+    bool burst;
+    uint8_t retry;
+    capture_action_t action;
 };
-struct config_t {
-    std::vector<rectangle_t> rectangles;
+
+// Busy time of both pipeline stages during the last burst
+struct pipeline_stats_t {
+    bool active;
+    uint16_t frames;
+    uint16_t captured;
+    uint16_t processed;
+    uint16_t failed;
+    int64_t start_us;
+    int64_t end_us;
+    uint64_t buffer_wait_us;  // Capture waiting for inference to return a frame buffer
+    uint64_t capture_us;      // Waiting for the camera driver to fill a free buffer
+    uint64_t stall_us;    // Capture blocked on a full frame queue
+    uint64_t inference_us;
 };
 
 // Global variables
-config_t config;
-QueueHandle_t queue;
-QueueHandle_t background_queue;
+QueueHandle_t capture_queue;
+QueueHandle_t frame_queue;
 WiFiUDP ntpUDP;
 NTPClient timeClient(ntpUDP);
 AsyncWebServer server(80);
-std::unique_ptr<tflite::MicroInterpreter> interpreter;
-#define ARENA_SIZE 1024 * 32
-uint8_t tensor_arena[ARENA_SIZE];
+const tflite::MicroOpResolver* op_resolver;
 bool running = false;
+pipeline_stats_t pipeline_stats = {};
+// Model mapped from the flash partition, empty when the firmware copy runs
+model_store_t model_store = {};
+model_writer_t model_writer;
+// Upload writing the partition, it holds model_lock until the restart
+AsyncWebServerRequest* model_upload = nullptr;
+bool model_erased = false;
+// Held by every reading and by a model upload until the restart
+SemaphoreHandle_t model_lock;
+// Frame buffers not held by the pipeline, taken before and given after each camera frame
+SemaphoreHandle_t free_frame_buffers;
+bool restart_pending = false;
+#define BENCHMARK_ITERATIONS 16
+// Random digits the generated model code is checked on against the interpreter
+#define GENERATED_CHECK_SAMPLES 16
+#define BURST_MAX_FRAMES 1000
+// Longest a web request waits for a running reading before answering 503
+#define MODEL_LOCK_WAIT_MS 100
 
 /**
  * @brief Parse config from LittleFS
  *
- * @return config_t Parsed config
+ * @param doc Filled with the parsed config
+ * @return true on success
  */
-config_t parseConfig() {
+bool parseConfig(JsonDocument& doc) {
     // Load config from LittleFS
     File file = LittleFS.open("/config.json", FILE_READ);
     if (!file) {
         Serial.println("Failed to open file in reading mode");
-        return {};
+        return false;
     }
 
-    StaticJsonDocument<2048> doc;
-
     // Parse config
     DeserializationError error = deserializeJson(doc, file);
+    file.close();
     if (error) {
         Serial.println("Failed to parse config");
-        return {};
+        return false;
     }
+    return true;
+}
 
-    config_t config;
-    // Parse rectangles
-    for (JsonObject rectangle : doc["rectangles"].as<JsonArray>()) {
-        unsigned rectangle_x = rectangle["x"];
-        unsigned rectangle_y = rectangle["y"];
-        unsigned rectangle_width = rectangle["width"];
-        unsigned rectangle_height = rectangle["height"];
-        config.rectangles.push_back({.x = rectangle_x,
-                                     .y = rectangle_y,
-                                     .width = rectangle_width,
-                                     .height = rectangle_height});
-    }
-    file.close();
-    return config;
+/**
+ * @brief Replace the config with the one in LittleFS
+ *
+ * The inference task uses the resampling tables, the integral image and the
+ * reading state reset by configFromJson() while it holds model_lock, so the
+ * caller has to hold the lock.
+ */
+void loadConfig() {
+    StaticJsonDocument<4096> doc;
+    bool parsed = parseConfig(doc);
+    const resolution_info_t& frame = resolution[camera_config.frame_size];
+    config = parsed ? configFromJson(doc, frame.width, frame.height) : config_t{};
 }
 
 /**
- * @brief Task that pushes to queue every 1 minute
+ * @brief Task that requests a background reading every 1 minute
  */
 void processTimer(void* _) {
     // Push to queue every 1 minute
     while (running) {
-        uint8_t dummy = 0;
-        if (xQueueSend(background_queue, &dummy, 10) != pdPASS) {
+        capture_request_t capture = {nullptr, 0, 0, CAPTURE_READ};
+        if (xQueueSend(capture_queue, &capture, 10) != pdPASS) {
             Serial.println("Failed to send request to queue");
         }
         vTaskDelay(60000 / portTICK_PERIOD_MS);
@@ -92,6 +133,359 @@ void processTimer(void* _) {
     vTaskDelete(NULL);
 }
 
+/**
+ * @brief Grayscale frame of a camera frame buffer
+ */
+gray_frame_t grayFrame(const camera_fb_t* pic) {
+    return {.buf = pic->buf,
+            .width = (unsigned int)pic->width,
+            .height = (unsigned int)pic->height};
+}
+
+/**
+ * @brief Measure preprocessing of all rectangles on given frame
+ *
+ * @param pic Captured frame
+ * @param doc JSON document to fill with per rectangle results
+ */
+void benchmarkPreprocessing(camera_fb_t* pic, JsonDocument& doc) {
+    gray_frame_t frame = grayFrame(pic);
+    const integral_image_t* integral = buildIntegral(&frame);
+    uint8_t reference_data[28 * 28];
+    uint8_t fixed_data[28 * 28];
+    out_image_t reference_image = {.pixels = reference_data, .w = 28, .h = 28};
+    out_image_t fixed_image = {.pixels = fixed_data, .w = 28, .h = 28};
+
+    JsonArray results = doc.createNestedArray("rectangles");
+    for (size_t i = 0; i < config.coefs.size(); i++) {
+        JsonObject result = results.createNestedObject();
+        static const char* mode_names[] = {"bilinear", "box", "affine", "remap"};
+        const scale_coefs_t* coefs = &config.coefs[i];
+        result["mode"] = mode_names[coefs->mode];
+        // Only axis-aligned rectangles sample from a section
+        if (coefs->mode != SCALE_MODE_BILINEAR && coefs->mode != SCALE_MODE_BOX) {
+            continue;
+        }
+
+        const rectangle_t& rectangle = config.rectangles[i];
+        in_image_t in_image = {
+            .pixels = pic->buf,
+            .w = pic->width,
+            .h = pic->height,
+            .offsetX = rectangle.x,
+            .offsetY = rectangle.y,
+            .sectionWidth = rectangle.width,
+            .sectionHeight = rectangle.height,
+        };
+
+        uint32_t start = ESP.getCycleCount();
+        for (int i = 0; i < BENCHMARK_ITERATIONS; i++) {
+            scale(&in_image, &fixed_image, coefs, integral);
+        }
+        result["fixed_cycles"] = (ESP.getCycleCount() - start) / BENCHMARK_ITERATIONS;
+
+        // The float reference is bilinear, box mode has nothing to compare against
+        if (coefs->mode != SCALE_MODE_BILINEAR) {
+            continue;
+        }
+        start = ESP.getCycleCount();
+        for (int i = 0; i < BENCHMARK_ITERATIONS; i++) {
+            scale_reference(&in_image, &reference_image, 28, 28);
+        }
+        result["reference_cycles"] = (ESP.getCycleCount() - start) / BENCHMARK_ITERATIONS;
+
+        // Largest difference between float and fixed-point output. Outputs left of or above the
+        // first source pixel center are skipped, the float path extrapolates there.
+        int max_diff = 0;
+        for (int y = (28 + 2 * rectangle.height - 1) / (2 * rectangle.height); y < 28; y++) {
+            for (int x = (28 + 2 * rectangle.width - 1) / (2 * rectangle.width); x < 28; x++) {
+                int diff = abs(reference_data[y * 28 + x] - fixed_data[y * 28 + x]);
+                if (diff > max_diff) {
+                    max_diff = diff;
+                }
+            }
+        }
+        result["max_diff"] = max_diff;
+    }
+
+    // Integral image is built once per frame and shared by all rectangles
+    uint32_t start = ESP.getCycleCount();
+    for (int i = 0; i < BENCHMARK_ITERATIONS; i++) {
+        buildIntegral(&frame);
+    }
+    doc["integral_cycles"] = (ESP.getCycleCount() - start) / BENCHMARK_ITERATIONS;
+
+    // Compare separate walk per rectangle with one shared walk over the frame
+    frame_jobs_t frame_jobs;
+    prepareJobs(&frame, frame_jobs, false, buildIntegral(&frame));
+
+    start = ESP.getCycleCount();
+    for (int i = 0; i < BENCHMARK_ITERATIONS; i++) {
+        for (auto& job : frame_jobs.jobs) {
+            scale_multi_to_tensor(&job, 1);
+        }
+    }
+    doc["per_rectangle_cycles"] = (ESP.getCycleCount() - start) / BENCHMARK_ITERATIONS;
+
+    start = ESP.getCycleCount();
+    for (int i = 0; i < BENCHMARK_ITERATIONS; i++) {
+        scale_multi_to_tensor(frame_jobs.jobs.data(), frame_jobs.jobs.size());
+    }
+    doc["single_walk_cycles"] = (ESP.getCycleCount() - start) / BENCHMARK_ITERATIONS;
+    for (size_t i = 0; i < frame_jobs.contrasts.size(); i++) {
+        results[i]["inverted"] = frame_jobs.contrasts[i].inverted;
+    }
+    doc["table_bytes"] = config.coefs.size() * sizeof(scale_coefs_t) +
+                         config.remap_offsets.size() * sizeof(uint32_t) +
+                         config.remap_weights.size() * sizeof(uint16_t);
+    doc["integral_bytes"] = frame_integral.capacity * sizeof(uint32_t);
+}
+
+/**
+ * @brief Compare per digit latency of batched and unbatched inference on given frame
+ *
+ * @param pic Captured frame
+ * @param doc JSON document to fill with results
+ */
+void benchmarkInference(camera_fb_t* pic, JsonDocument& doc) {
+    gray_frame_t frame = grayFrame(pic);
+    frame_jobs_t frame_jobs;
+    prepareJobs(&frame, frame_jobs, false, buildIntegral(&frame));
+    scale_multi_to_tensor(frame_jobs.jobs.data(), frame_jobs.jobs.size());
+    size_t count = max(frame_jobs.jobs.size(), (size_t)1);
+
+    // Digits may have been resampled straight into the input tensor, which the batched run
+    // overwrites with its activations, keep them for the unbatched run
+    const TfLiteTensor* batched_input = interpreter->input(0);
+    std::vector<uint8_t> inputs(batched_input->data.raw,
+                                batched_input->data.raw + batched_input->bytes);
+
+    uint32_t start = micros();
+    inferDigits(interpreter.get(), frame_jobs);
+    uint32_t batched_us = (micros() - start) / count;
+
+    doc["batch"] = MODEL_BATCH;
+    doc["batched_us_per_digit"] = batched_us;
+    Serial.printf("Inference per digit: batched %u us (batch %u)\n", batched_us, MODEL_BATCH);
+
+    // Unbatched run needs the single digit model in its own temporary arena, the batch model has
+    // int8 input/output like tmnist_model_int8_tflite
+#if MODEL_BATCH > 1 && !defined(MODEL_GENERATED)
+    uint8_t* arena = (uint8_t*)malloc(ARENA_SIZE_FOR(1));
+    if (!arena) {
+        return;
+    }
+    tflite::MicroInterpreter single(tflite::GetModel(tmnist_model_int8_tflite), *op_resolver,
+                                    arena, ARENA_SIZE_FOR(1));
+    if (single.AllocateTensors() != kTfLiteOk) {
+        doc["unbatched_skipped"] = "Failed to allocate tensors";
+    } else if (single.input(0)->type != batched_input->type ||
+               single.input(0)->bytes * MODEL_BATCH != batched_input->bytes) {
+        // Resampled digits are in the format of the batch model, a batch model uploaded with float
+        // input is not comparable
+        doc["unbatched_skipped"] = "Single digit model has a different input type";
+    } else {
+        memcpy(batched_input->data.raw, inputs.data(), inputs.size());
+        frame_jobs.digits.assign(frame_jobs.jobs.size(), -1);
+        start = micros();
+        inferDigits(&single, frame_jobs);
+        uint32_t unbatched_us = (micros() - start) / count;
+        doc["unbatched_us_per_digit"] = unbatched_us;
+        Serial.printf("Inference per digit: unbatched %u us\n", unbatched_us);
+    }
+    free(arena);
+#endif
+}
+
+/**
+ * @brief Cycles of the reference and the specialized kernel on one convolution layer
+ *
+ * Runs both on random data of the layer shape and checks the outputs are identical.
+ *
+ * @param result JSON object to fill with cycle counts
+ * @return false if out of memory
+ */
+bool benchmarkConvLayer(int input_size, int input_c, int filter_size, int output_c, JsonObject result) {
+    conv_params_t params = {};
+    params.batches = 1;
+    params.input_h = input_size;
+    params.input_w = input_size;
+    params.input_c = input_c;
+    params.filter_h = filter_size;
+    params.filter_w = filter_size;
+    params.output_h = input_size - filter_size + 1;
+    params.output_w = input_size - filter_size + 1;
+    params.output_c = output_c;
+    params.stride_h = 1;
+    params.stride_w = 1;
+    params.input_offset = 128;
+    params.output_offset = -128;
+    params.act_min = -128;
+    params.act_max = 127;
+
+    const int input_bytes = input_size * input_size * input_c;
+    const int filter_bytes = output_c * filter_size * filter_size * input_c;
+    const int output_bytes = params.output_h * params.output_w * output_c;
+    int8_t* input = (int8_t*)malloc(input_bytes);
+    int8_t* filter = (int8_t*)malloc(filter_bytes);
+    int8_t* reference = (int8_t*)malloc(output_bytes);
+    int8_t* specialized = (int8_t*)malloc(output_bytes);
+    int32_t* channels = (int32_t*)malloc(4 * output_c * sizeof(int32_t));
+    bool ok = input && filter && reference && specialized && channels;
+    if (ok) {
+        int32_t* bias = channels;
+        int32_t* folded_bias = channels + output_c;
+        int32_t* multipliers = channels + 2 * output_c;
+        int32_t* shifts = channels + 3 * output_c;
+        esp_fill_random(input, input_bytes);
+        esp_fill_random(filter, filter_bytes);
+        for (int c = 0; c < output_c; c++) {
+            bias[c] = (int32_t)(esp_random() % 20000) - 10000;
+            multipliers[c] = (1 << 30) + (esp_random() >> 2);
+            shifts[c] = -8 - (int32_t)(esp_random() % 4);
+        }
+        params.multipliers = multipliers;
+        params.shifts = shifts;
+        kernel_conv2d_fold_bias(&params, filter, bias, folded_bias);
+
+        uint32_t start = ESP.getCycleCount();
+        kernel_conv2d_int8(&params, input, filter, bias, reference);
+        uint32_t reference_cycles = ESP.getCycleCount() - start;
+        start = ESP.getCycleCount();
+        kernel_conv2d_specialized_int8(&params, input, filter, folded_bias, specialized);
+        uint32_t specialized_cycles = ESP.getCycleCount() - start;
+
+        result["reference_cycles"] = reference_cycles;
+        result["specialized_cycles"] = specialized_cycles;
+        result["identical"] = memcmp(reference, specialized, output_bytes) == 0;
+        Serial.printf("Conv %dx%dx%d->%d: reference %u cycles, specialized %u cycles\n", filter_size,
+                      filter_size, input_c, output_c, reference_cycles, specialized_cycles);
+    }
+    free(input);
+    free(filter);
+    free(reference);
+    free(specialized);
+    free(channels);
+    return ok;
+}
+
+#if !defined(MODEL_GENERATED) && MODEL_GENERATED_OUTPUT_LOGITS && MODEL_GENERATED_OUTPUT_INT8
+/**
+ * @brief Cycles of the interpreter and the generated model code, checks both give the same logits
+ *
+ * The generated code is compiled into every build. It ends at the int8 logits like
+ * tmnist_model_int8_tflite, which the interpreter runs with the resolver of this build. Pixels
+ * of whole 1/255 steps quantize exactly to value - 128, so float and int8 inputs agree.
+ *
+ * @param result JSON object to fill with cycle counts
+ * @return false if out of memory
+ */
+bool benchmarkGenerated(JsonObject result) {
+    uint8_t* arena = (uint8_t*)malloc(ARENA_SIZE_FOR(1));
+    if (!arena) {
+        return false;
+    }
+    tflite::MicroInterpreter reference(tflite::GetModel(tmnist_model_int8_tflite), *op_resolver,
+                                       arena, ARENA_SIZE_FOR(1));
+    bool ok = reference.AllocateTensors() == kTfLiteOk &&
+              reference.output(0)->bytes == MODEL_GENERATED_OUTPUT_SIZE;
+    if (ok) {
+        TfLiteTensor* input = reference.input(0);
+        uint32_t mismatches = 0;
+        uint64_t reference_cycles = 0;
+        uint64_t generated_cycles = 0;
+        for (int sample = 0; sample < GENERATED_CHECK_SAMPLES; sample++) {
+            // Smooth blob plus noise, so activations do not all saturate
+            int cx = esp_random() % 28, cy = esp_random() % 28, radius = 3 + esp_random() % 10;
+            model_generated_input_t* generated = model_generated_input();
+            for (int i = 0; i < MODEL_GENERATED_INPUT_SIZE; i++) {
+                int dx = i % 28 - cx, dy = i / 28 - cy;
+                int value = (dx * dx + dy * dy < radius * radius ? 200 : 20) + esp_random() % 56;
+                input->data.int8[i] = value - 128;
+#if MODEL_GENERATED_INPUT_INT8
+                generated[i] = value - 128;
+#else
+                generated[i] = value / 255.0f;
+#endif
+            }
+            uint32_t start = ESP.getCycleCount();
+            reference.Invoke();
+            reference_cycles += ESP.getCycleCount() - start;
+            start = ESP.getCycleCount();
+            model_generated_invoke();
+            generated_cycles += ESP.getCycleCount() - start;
+            if (memcmp(reference.output(0)->data.int8, model_generated_output(),
+                       MODEL_GENERATED_OUTPUT_SIZE) != 0) {
+                mismatches++;
+            }
+        }
+        result["samples"] = GENERATED_CHECK_SAMPLES;
+        result["mismatches"] = mismatches;
+        result["identical"] = mismatches == 0;
+        result["interpreter_cycles"] = (uint32_t)(reference_cycles / GENERATED_CHECK_SAMPLES);
+        result["generated_cycles"] = (uint32_t)(generated_cycles / GENERATED_CHECK_SAMPLES);
+        Serial.printf("Generated model: %u of %d samples differ, interpreter %u cycles, "
+                      "generated %u cycles\n",
+                      mismatches, GENERATED_CHECK_SAMPLES,
+                      (uint32_t)(reference_cycles / GENERATED_CHECK_SAMPLES),
+                      (uint32_t)(generated_cycles / GENERATED_CHECK_SAMPLES));
+    }
+    free(arena);
+    return ok;
+}
+#endif
+
+/**
+ * @brief Compare reference and specialized kernels of both TMNIST convolution layers
+ *
+ * Interpreter builds also check the generated model code against the interpreter.
+ *
+ * @param doc JSON document to fill with results
+ */
+void benchmarkKernels(JsonDocument& doc) {
+    JsonObject kernels = doc.createNestedObject("conv_kernels");
+    benchmarkConvLayer(28, 1, 4, 32, kernels.createNestedObject("conv_4x4x1_32"));
+    benchmarkConvLayer(12, 32, 3, 64, kernels.createNestedObject("conv_3x3x32_64"));
+#if !defined(MODEL_GENERATED) && MODEL_GENERATED_OUTPUT_LOGITS && MODEL_GENERATED_OUTPUT_INT8
+    if (!benchmarkGenerated(doc.createNestedObject("generated_model"))) {
+        doc["generated_model"]["error"] = "Out of memory or the int8 model does not fit this build";
+    }
+#endif
+}
+
+/**
+ * @brief Check that a model runs with the resolver and has the digit tensors of this build
+ *
+ * @param model Model to check, allocated once in the tensor arena
+ * @param resolver Operations of this build
+ * @return true when the interpreter can use it
+ */
+bool modelFits(const tflite::Model* model, const tflite::MicroOpResolver& resolver) {
+    if (model->version() != TFLITE_SCHEMA_VERSION) {
+        return false;
+    }
+    tflite::MicroInterpreter probe(model, resolver, tensor_arena, ARENA_SIZE);
+    if (probe.AllocateTensors() != kTfLiteOk) {
+        return false;
+    }
+    return modelTensorsFit(probe.input(0), probe.output(0));
+}
+
+/**
+ * @brief Add min, mean and max cycles to JSON object
+ */
+void addCycleStats(JsonObject object, const cycle_stats_t& stats) {
+    object["count"] = stats.count;
+    object["min"] = stats.min;
+    object["mean"] = stats.count ? (uint32_t)(stats.total / stats.count) : 0;
+    object["max"] = stats.max;
+}
+
+// Pipeline tasks, defined after the reading functions they run
+void captureTask(void* _);
+void inferenceTask(void* _);
+void requestCapture(AsyncWebServerRequest* request, capture_action_t action);
+
 /**
  * @brief Setup function
  */
@@ -116,9 +510,12 @@ void setup() {
     Serial.print("IP Address: ");
     Serial.println(WiFi.localIP());
 
-    // Setup queues for image processing
-    queue = xQueueCreate(1, sizeof(AsyncWebServerRequest*));
-    background_queue = xQueueCreate(1, sizeof(uint8_t*));
+    // Setup queues for image processing. With two frame buffers and one frame in the queue the
+    // capture task can only run one frame ahead of inference before the driver runs dry.
+    capture_queue = xQueueCreate(2, sizeof(capture_request_t));
+    frame_queue = xQueueCreate(1, sizeof(frame_t));
+    model_lock = xSemaphoreCreateMutex();
+    free_frame_buffers = xSemaphoreCreateCounting(camera_config.fb_count, camera_config.fb_count);
 
     // Setup camera
     if (ESP_OK != esp_camera_init(&camera_config)) {
@@ -126,8 +523,12 @@ void setup() {
         return;
     }
 
+#ifdef MODEL_GENERATED
+    // Generated code has the model compiled in, nothing to parse or plan
+    static generated_interpreter_t static_interpreter;
+#else
     // Setup model
-    const tflite::Model* model = tflite::GetModel(tmnist_model_tflite);
+    const tflite::Model* model = firmwareModel();
     if (model->version() != TFLITE_SCHEMA_VERSION) {
         Serial.print("Model provided is schema version ");
         Serial.print(model->version());
@@ -136,19 +537,35 @@ void setup() {
     }
 
     // Add operation resolver
-    static tflite::MicroMutableOpResolver<8> resolver;
-    resolver.AddReadVariable();
-    resolver.AddQuantize();
-    resolver.AddFullyConnected();
-    resolver.AddSoftmax();
-    resolver.AddDequantize();
-    resolver.AddConv2D();
-    resolver.AddMaxPool2D();
-    resolver.AddReshape();
+    const tflite::MicroOpResolver& resolver = modelResolver();
+    op_resolver = &resolver;
+
+    // Large batches do not fit internal DRAM, slower PSRAM still works
+    tensor_arena = (uint8_t*)heap_caps_malloc(ARENA_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!tensor_arena) {
+        Serial.println("Tensor arena does not fit internal DRAM, using PSRAM");
+        tensor_arena = (uint8_t*)heap_caps_malloc(ARENA_SIZE, MALLOC_CAP_SPIRAM);
+    }
+
+    // Model uploaded to the partition replaces the firmware copy, read in place from flash
+    if (model_store_open(&model_store, MODEL_STORE_PARTITION)) {
+        const tflite::Model* stored = tflite::GetModel(model_store.data);
+        if (modelFits(stored, resolver)) {
+            model = stored;
+            Serial.printf("Model from partition: %u bytes, CRC %08x\n", model_store.size,
+                          model_store.crc);
+        } else {
+            Serial.println("Model in partition does not fit this build, using firmware model");
+            model_store_close(&model_store);
+        }
+    }
 
     // Setup interpreter
-    static tflite::MicroInterpreter static_interpreter(model, resolver, tensor_arena, ARENA_SIZE);
-    interpreter = std::move(std::unique_ptr<tflite::MicroInterpreter>(&static_interpreter));
+    static tflite::MicroInterpreter static_interpreter(model, resolver, tensor_arena, ARENA_SIZE,
+                                                       nullptr, &op_profiler);
+    model_outputs_logits = modelOutputsLogits(model);
+#endif
+    interpreter = std::move(std::unique_ptr<model_interpreter_t>(&static_interpreter));
     if (interpreter->AllocateTensors() != kTfLiteOk) {
         Serial.println("Failed to allocate tensors");
         return;
@@ -157,9 +574,20 @@ void setup() {
         Serial.print("Used bytes: ");
         Serial.println(interpreter->arena_used_bytes());
     }
+    if (!modelTensorsFit(interpreter->input(0), interpreter->output(0))) {
+        Serial.printf("Model input/output are %s/%s, not the digit tensors of this build\n",
+                      TfLiteTypeGetName(interpreter->input(0)->type),
+                      TfLiteTypeGetName(interpreter->output(0)->type));
+        return;
+    }
+
+    // Prepare conversion of pixels to model input
+    initInputLut();
 
     // Parse config
-    config = parseConfig();
+    xSemaphoreTake(model_lock, portMAX_DELAY);
+    loadConfig();
+    xSemaphoreGive(model_lock);
 
     // Add CORS headers
     DefaultHeaders::Instance().addHeader("Access-Control-Allow-Origin", "*");
@@ -182,9 +610,17 @@ void setup() {
         nullptr,
         [](AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
             Serial.printf("Received %d bytes of data\n", len);
+            // Web server task must not block behind a reading or on the lock held by a model
+            // upload, nothing is written while the pipeline is busy
+            if (xSemaphoreTake(model_lock, MODEL_LOCK_WAIT_MS / portTICK_PERIOD_MS) != pdTRUE) {
+                Serial.println("Pipeline busy, config not saved");
+                request->send(503, "text/plain", "Busy, try again");
+                return;
+            }
             // Save request body json to LittleFS
             File file = LittleFS.open("/config.json", FILE_WRITE);
             if (!file) {
+                xSemaphoreGive(model_lock);
                 Serial.println("Failed to open file in writing mode");
                 request->send(200, "text/plain", "Failed to open file in writing mode");
                 return;
@@ -198,32 +634,114 @@ void setup() {
             Serial.println("Written to config");
 
             // Parse config
-            config = parseConfig();
+            loadConfig();
+            xSemaphoreGive(model_lock);
             request->send(200, "text/plain", "Config saved");
         });
 
     // Get image from camera
     server.on("/api/image", HTTP_GET, [](AsyncWebServerRequest* request) {
         request->client()->setRxTimeout(60000);
-        AsyncResponseStream* response = request->beginResponseStream("application/octet-stream");
-        camera_fb_t* pic = esp_camera_fb_get();
-        esp_camera_fb_return(pic);
-        pic = esp_camera_fb_get();
-        for (auto rectangle : config.rectangles) {
-            uint8_t image_data[28 * 28] = {0};
-            response->write(image_data, 28 * 28);
-        }
-        response->write(pic->buf, pic->len);
+        requestCapture(request, CAPTURE_IMAGE);
+    });
+
+    // Benchmark preprocessing on current camera image
+    server.on("/api/benchmark", HTTP_GET, [](AsyncWebServerRequest* request) {
+        request->client()->setRxTimeout(60000);
+        requestCapture(request, CAPTURE_BENCHMARK);
+    });
+
+    // Template cascade statistics
+    server.on("/api/cascade", HTTP_GET, [](AsyncWebServerRequest* request) {
+        const cascade_stats_t& stats = cascade_stats;
+        DynamicJsonDocument doc(512);
+        doc["enabled"] = config.cascade;
+        doc["threshold"] = config.cascade_threshold;
+        doc["readings"] = stats.readings;
+        doc["digits"] = stats.digits;
+        doc["fast_digits"] = stats.fast_digits;
+        doc["model_us_per_digit"] = stats.model_us_per_digit;
+        doc["saved_us_per_reading"] = stats.readings ? stats.saved_us / stats.readings : 0;
+        JsonObject last = doc.createNestedObject("last");
+        last["digits"] = stats.last_digits;
+        last["fast_digits"] = stats.last_fast_digits;
+        last["match_us"] = stats.last_match_us;
+        last["model_us"] = stats.last_model_us;
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        serializeJson(doc, *response);
+        request->send(response);
+    });
+
+    // Digit cache counters
+    server.on("/api/cache", HTTP_GET, [](AsyncWebServerRequest* request) {
+        DynamicJsonDocument doc(1024);
+        doc["enabled"] = config.cache;
+        doc["distance"] = config.cache_distance;
+        doc["hits"] = digit_cache.hits;
+        doc["misses"] = digit_cache.misses;
+        JsonArray digits = doc.createNestedArray("digits");
+        for (const digit_cache_entry_t& entry : digit_cache.entries) {
+            digits.add(entry.digit);
+        }
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        serializeJson(doc, *response);
+        request->send(response);
+    });
+
+    // Odometer mode counters
+    server.on("/api/odometer", HTTP_GET, [](AsyncWebServerRequest* request) {
+        DynamicJsonDocument doc(1024);
+        doc["enabled"] = config.odometer;
+        doc["readings"] = odometer.readings;
+        doc["classified"] = odometer.classified;
+        doc["classified_per_reading"] =
+            odometer.readings ? (float)odometer.classified / odometer.readings : 0;
+        JsonArray ages = doc.createNestedArray("ages");
+        for (const odometer_digit_t& digit : odometer.digits) {
+            ages.add(digit.age);
+        }
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        serializeJson(doc, *response);
         request->send(response);
-        esp_camera_fb_return(pic);
     });
 
     // Infer current camera image
     server.on("/api/inference", HTTP_GET, [](AsyncWebServerRequest* request) {
         request->client()->setRxTimeout(60000);
-        if (xQueueSend(queue, &request, 10) != pdPASS) {
-            Serial.println("Failed to send request to queue");
+        requestCapture(request, CAPTURE_READ);
+    });
+
+    // Cycles per operator and memory use, cycles divide by cpu_mhz to microseconds
+    server.on("/api/profile", HTTP_GET, [](AsyncWebServerRequest* request) {
+        DynamicJsonDocument doc(4096);
+        doc["cpu_mhz"] = ESP.getCpuFreqMHz();
+        JsonArray ops = doc.createNestedArray("ops");
+        for (int i = 0; i < op_profiler.op_count(); i++) {
+            const op_profile_t& op = op_profiler.op(i);
+            JsonObject entry = ops.createNestedObject();
+            entry["node"] = i;
+            entry["op"] = op.tag ? op.tag : "";
+            addCycleStats(entry, op.cycles);
         }
+        addCycleStats(doc.createNestedObject("invoke"), op_profiler.invoke_cycles());
+        addCycleStats(doc.createNestedObject("reading"), op_profiler.reading_cycles());
+        JsonObject memory = doc.createNestedObject("memory");
+        memory["arena_size"] = ARENA_SIZE;
+        memory["arena_used_bytes"] = interpreter->arena_used_bytes();
+        memory["free_heap"] = ESP.getFreeHeap();
+        memory["min_free_heap"] = ESP.getMinFreeHeap();
+        memory["max_alloc_heap"] = ESP.getMaxAllocHeap();
+        memory["free_psram"] = ESP.getFreePsram();
+        memory["min_free_psram"] = ESP.getMinFreePsram();
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        serializeJson(doc, *response);
+        request->send(response);
+    });
+
+    // Start profiling over
+    server.on("/api/profile", HTTP_DELETE, [](AsyncWebServerRequest* request) {
+        op_profiler.reset();
+        request->send(200, "text/plain", "Profile reset");
     });
 
     // Delete log
@@ -248,9 +766,154 @@ void setup() {
         request->send(200, "text/plain", "Started");
     });
 
+    // Model in use
+    server.on("/api/model", HTTP_GET, [](AsyncWebServerRequest* request) {
+        DynamicJsonDocument doc(256);
+        doc["source"] = model_store.data ? "partition" : "firmware";
+        doc["size"] = model_store.size;
+        doc["crc"] = String(model_store.crc, HEX);
+        doc["capacity"] = model_store_capacity(MODEL_STORE_PARTITION);
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        serializeJson(doc, *response);
+        request->send(response);
+    });
+
+    // Replace the model in the partition, body is the .tflite file, crc the hex CRC-32 of it
+    server.on(
+        "/api/model", HTTP_POST,
+        [](AsyncWebServerRequest* request) {
+            // The body handler answers uploads, it is never called for an empty body
+            if (request->contentLength() == 0) {
+                request->send(400, "text/plain", "Empty model");
+            }
+        },
+        nullptr,
+        [](AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+            if (index == 0) {
+                Serial.printf("Receiving model of %u bytes\n", total);
+                // Readings must not run on a mapped model while its flash is rewritten. The
+                // web server task never waits for the lock, a running reading or another
+                // upload holding it on this same task get the upload rejected instead.
+                if (model_upload || xSemaphoreTake(model_lock, 0) != pdTRUE) {
+                    Serial.println("Pipeline busy, model upload rejected");
+                } else {
+                    model_upload = request;
+                }
+            }
+            // Body of a rejected upload is dropped, it is answered once complete
+            if (request != model_upload) {
+                if (index + len >= total) {
+                    request->send(503, "text/plain", "Busy, try again");
+                }
+                return;
+            }
+            if (index == 0) {
+                model_writer = {};
+                model_writer.failed = true;
+                model_erased = false;
+                // Nothing is erased for an upload rejected up front
+                if (request->hasParam("crc") &&
+                    total <= model_store_capacity(MODEL_STORE_PARTITION)) {
+                    model_erased = true;
+                    model_writer_begin(&model_writer, MODEL_STORE_PARTITION, total);
+                }
+                // A dropped upload leaves an erased partition, the firmware model takes over
+                request->onDisconnect([request]() {
+                    if (model_upload == request) {
+                        model_upload = nullptr;
+                        restart_pending = true;
+                    }
+                });
+            }
+            model_writer_write(&model_writer, data, len);
+            if (index + len < total) {
+                return;
+            }
+
+            model_upload = nullptr;
+            uint32_t crc = 0;
+            if (request->hasParam("crc")) {
+                crc = strtoul(request->getParam("crc")->value().c_str(), nullptr, 16);
+            }
+            if (model_writer_finish(&model_writer, crc)) {
+                Serial.println("Model saved, restarting");
+                request->send(200, "text/plain", "Model saved, restarting");
+                restart_pending = true;
+                return;
+            }
+            Serial.println("Model upload failed");
+            request->send(400, "text/plain", "Model upload failed");
+            if (model_erased && model_store.data) {
+                restart_pending = true;
+            } else {
+                xSemaphoreGive(model_lock);
+            }
+        });
+
     // Stop background capture
     server.on("/api/stop", HTTP_POST, [](AsyncWebServerRequest* request) { running = false; });
 
+    // Read frames back to back to measure pipeline throughput. Nothing is logged, but the digit
+    // cache, template cascade and odometer update on burst frames as on any reading, so the
+    // throughput includes their work and the following readings start from the burst's state
+    server.on("/api/burst", HTTP_POST, [](AsyncWebServerRequest* request) {
+        if (pipeline_stats.active) {
+            request->send(409, "text/plain", "Burst already running");
+            return;
+        }
+        long frames = 20;
+        if (request->hasParam("frames")) {
+            frames = request->getParam("frames")->value().toInt();
+        }
+        if (frames < 1 || frames > BURST_MAX_FRAMES) {
+            request->send(400, "text/plain", "Frames out of range");
+            return;
+        }
+        pipeline_stats = {};
+        pipeline_stats.active = true;
+        pipeline_stats.frames = frames;
+        pipeline_stats.start_us = esp_timer_get_time();
+        capture_request_t capture = {nullptr, (uint16_t)frames, 0, CAPTURE_READ};
+        if (xQueueSend(capture_queue, &capture, 10) != pdPASS) {
+            pipeline_stats.active = false;
+            request->send(503, "text/plain", "Capture queue full");
+            return;
+        }
+        request->send(200, "text/plain", "Burst started");
+    });
+
+    // Throughput and stage utilization of the last burst
+    server.on("/api/burst", HTTP_GET, [](AsyncWebServerRequest* request) {
+        const pipeline_stats_t& stats = pipeline_stats;
+        int64_t end_us = stats.active ? esp_timer_get_time() : stats.end_us;
+        float elapsed_us = end_us > stats.start_us ? end_us - stats.start_us : 0;
+        DynamicJsonDocument doc(512);
+        doc["active"] = stats.active;
+        doc["frames"] = stats.frames;
+        doc["captured"] = stats.captured;
+        doc["processed"] = stats.processed;
+        doc["failed"] = stats.failed;
+        doc["elapsed_ms"] = elapsed_us / 1000;
+        if (elapsed_us > 0) {
+            doc["readings_per_second"] = stats.processed * 1e6f / elapsed_us;
+            // Share of the wall time each stage spent on its work, in percent
+            doc["capture_busy"] = 100 * stats.capture_us / elapsed_us;
+            doc["capture_buffer_wait"] = 100 * stats.buffer_wait_us / elapsed_us;
+            doc["capture_stall"] = 100 * stats.stall_us / elapsed_us;
+            doc["inference_busy"] = 100 * stats.inference_us / elapsed_us;
+        }
+        if (stats.captured) {
+            doc["capture_ms_per_frame"] = stats.capture_us / 1000.0f / stats.captured;
+            doc["buffer_wait_ms_per_frame"] = stats.buffer_wait_us / 1000.0f / stats.captured;
+        }
+        if (stats.processed) {
+            doc["inference_ms_per_frame"] = stats.inference_us / 1000.0f / stats.processed;
+        }
+        AsyncResponseStream* response = request->beginResponseStream("application/json");
+        serializeJson(doc, *response);
+        request->send(response);
+    });
+
     // Serve static files
     server.serveStatic("/", LittleFS, "/");
 
@@ -268,166 +931,249 @@ void setup() {
 
     // Start NTP client
     timeClient.begin();
+
+    // Capture fills the next frame buffer on the protocol core while inference runs on the
+    // application core
+    xTaskCreatePinnedToCore(captureTask, "captureTask", 4096, NULL, 1, NULL, 0);
+    xTaskCreatePinnedToCore(inferenceTask, "inferenceTask", 16384, NULL, 1, NULL, 1);
 }
 
 /**
- * @brief Process image and send response
+ * @brief Run inference on all rectangles of given frame
+ *
+ * @param pic Captured frame
+ * @param response Response to write 28x28 previews to, NULL when not needed
+ * @param value Recognized digits
+ * @param confidence Least confident digit of the reading
+ * @return true on success
  */
-void processImage() {
-    AsyncWebServerRequest* request;
-    if (xQueueReceive(queue, &request, 10)) {
-        AsyncResponseStream* response = request->beginResponseStream("application/octet-stream");
-        String value = "";
-
-        // Begin response
-        uint8_t out_image_data[28 * 28] = {0};
-        out_image_t out_image = {
-            .pixels = out_image_data,
-            .w = 28,
-            .h = 28,
-        };
-        camera_fb_t* pic = esp_camera_fb_get();
-        esp_camera_fb_return(pic);
-        pic = esp_camera_fb_get();
-
-        // Loop through all rectangles
-        for (auto rectangle : config.rectangles) {
-            in_image_t in_image = {
-                .pixels = pic->buf,
-                .w = pic->width,
-                .h = pic->height,
-                .offsetX = rectangle.x,
-                .offsetY = rectangle.y,
-                .sectionWidth = rectangle.width,
-                .sectionHeight = rectangle.height,
-            };
-            scale(&in_image, &out_image, 28, 28);
-
-            // Obtain a pointer to the model's input tensor
-            TfLiteTensor* input = interpreter->input(0);
-
-            // Set input data
-            for (int i = 0; i < 784; i++) {
-                input->data.f[i] = out_image_data[i] / 255.0;
-            }
-
-            // Run inference
-            if (interpreter->Invoke() != kTfLiteOk) {
-                Serial.println("Failed to invoke tflite");
-                return;
-            }
+bool readDigits(camera_fb_t* pic,
+                AsyncResponseStream* response,
+                String& value,
+                reading_confidence_t& confidence) {
+    gray_frame_t frame = grayFrame(pic);
+    // Only the inference task reads digits, its buffers are kept and reused between readings
+    static frame_jobs_t frame_jobs;
+    reading_stats_t reading;
+    if (!readFrame(&frame, response != nullptr, frame_jobs, reading)) {
+        return false;
+    }
+    for (size_t i = 0; i < frame_jobs.digits.size(); i++) {
+        value += String(frame_jobs.digits[i]);
+    }
+    confidence = readingConfidence(frame_jobs);
+    if (response) {
+        for (const scale_job_t& job : frame_jobs.jobs) {
+            response->write(job.dst.preview, 28 * 28);
+        }
+    }
+    return true;
+}
 
-            // Obtain a pointer to the output tensor
-            TfLiteTensor* output = interpreter->output(0);
+/**
+ * @brief Append value to log with its confidence and the runner-up reading
+ *
+ * @param value Recognized digits
+ * @param confidence Least confident digit of the reading
+ */
+void logValue(const String& value, const reading_confidence_t& confidence) {
+    File file = LittleFS.open("/log.txt", FILE_APPEND);
+    if (!file) {
+        Serial.println("Failed to open log");
+        return;
+    }
+    file.print("[");
+    file.print(timeClient.getFormattedDate());
+    file.print("] ");
+    file.print(value);
+    file.printf(" %.2f", confidence.confidence);
+    if (confidence.runner_up >= 0) {
+        // Same reading with the second choice of the model at the least confident digit
+        String alternative = value;
+        alternative.setCharAt(confidence.position, '0' + confidence.runner_up);
+        file.print(" ");
+        file.print(alternative);
+    }
+    file.println();
+    file.close();
+}
 
-            // Find max value
-            int max_index = 0;
-            float max_value = 0;
-            for (int i = 0; i < 10; i++) {
-                if (output->data.f[i] > max_value) {
-                    max_value = output->data.f[i];
-                    max_index = i;
-                }
+/**
+ * @brief Capture task, hands frames to the inference task through frame_queue
+ *
+ * Blocks on the full queue while inference is behind, so at most one frame waits.
+ */
+void captureTask(void* _) {
+    capture_request_t capture;
+    while (true) {
+        if (!xQueueReceive(capture_queue, &capture, portMAX_DELAY)) {
+            continue;
+        }
+        bool burst = capture.burst > 0;
+        if (!burst) {
+            // Drop the frame buffered since the last reading
+            xSemaphoreTake(free_frame_buffers, portMAX_DELAY);
+            camera_fb_t* stale = esp_camera_fb_get();
+            if (stale) {
+                esp_camera_fb_return(stale);
             }
-            value += String(max_index);
-            response->write(out_image_data, 28 * 28);
+            xSemaphoreGive(free_frame_buffers);
         }
-
-        File file = LittleFS.open("/log.txt", FILE_APPEND);
-        if (!file) {
-            Serial.println("Failed to open log");
-            return;
+        for (uint16_t i = 0; i < (burst ? capture.burst : 1); i++) {
+            // esp_camera_fb_get() also blocks while inference holds every buffer, that wait
+            // is counted apart so capture time only covers the driver filling a buffer
+            int64_t wait_start = esp_timer_get_time();
+            xSemaphoreTake(free_frame_buffers, portMAX_DELAY);
+            int64_t start = esp_timer_get_time();
+            frame_t frame = {esp_camera_fb_get(), capture.request, burst, capture.retry,
+                             capture.action};
+            int64_t captured = esp_timer_get_time();
+            if (!frame.pic) {
+                Serial.println("Camera capture failed");
+                xSemaphoreGive(free_frame_buffers);
+            }
+            // The inference task still answers the request and closes the burst
+            xQueueSend(frame_queue, &frame, portMAX_DELAY);
+            if (burst) {
+                pipeline_stats.captured++;
+                pipeline_stats.buffer_wait_us += start - wait_start;
+                pipeline_stats.capture_us += captured - start;
+                pipeline_stats.stall_us += esp_timer_get_time() - captured;
+            }
         }
-        file.print("[");
-        file.print(timeClient.getFormattedDate());
-        file.print("] ");
-        file.println(value);
-        file.close();
-
-        response->write(pic->buf, pic->len);
-        request->send(response);
-        esp_camera_fb_return(pic);
     }
 }
 
 /**
- * @brief Process image in background
+ * @brief Queue a frame for a web request, the inference task answers it
  */
-void processImageBackground() {
-    uint8_t dummy;
-    while (xQueueReceive(background_queue, &dummy, 10)) {
-        Serial.println("Processing image in background");
-        String value = "";
-        // Begin response
-        uint8_t out_image_data[28 * 28] = {0};
-        out_image_t out_image = {
-            .pixels = out_image_data,
-            .w = 28,
-            .h = 28,
-        };
-        camera_fb_t* pic = esp_camera_fb_get();
-        esp_camera_fb_return(pic);
-        pic = esp_camera_fb_get();
-
-        // Loop through all rectangles
-        for (auto rectangle : config.rectangles) {
-            in_image_t in_image = {
-                .pixels = pic->buf,
-                .w = pic->width,
-                .h = pic->height,
-                .offsetX = rectangle.x,
-                .offsetY = rectangle.y,
-                .sectionWidth = rectangle.width,
-                .sectionHeight = rectangle.height,
-            };
-            scale(&in_image, &out_image, 28, 28);
-
-            // Obtain a pointer to the model's input tensor
-            TfLiteTensor* input = interpreter->input(0);
-
-            // Set input data
-            for (int i = 0; i < 784; i++) {
-                input->data.f[i] = out_image_data[i] / 255.0;
-            }
+void requestCapture(AsyncWebServerRequest* request, capture_action_t action) {
+    capture_request_t capture = {request, 0, 0, action};
+    if (xQueueSend(capture_queue, &capture, 10) != pdPASS) {
+        Serial.println("Failed to send request to queue");
+        request->send(503, "text/plain", "Capture queue full");
+    }
+}
 
-            // Run inference
-            if (interpreter->Invoke() != kTfLiteOk) {
-                Serial.println("Failed to invoke tflite");
-                return;
-            }
+/**
+ * @brief Send a captured frame behind empty previews, the layout of a reading response
+ */
+void sendImage(const frame_t& frame) {
+    if (!frame.pic) {
+        frame.request->send(500, "text/plain", "Camera capture failed");
+        return;
+    }
+    AsyncResponseStream* response = frame.request->beginResponseStream("application/octet-stream");
+    uint8_t image_data[28 * 28] = {0};
+    for (size_t i = 0; i < config.coefs.size(); i++) {
+        response->write(image_data, 28 * 28);
+    }
+    response->write(frame.pic->buf, frame.pic->len);
+    frame.request->send(response);
+}
 
-            // Obtain a pointer to the output tensor
-            TfLiteTensor* output = interpreter->output(0);
+/**
+ * @brief Benchmark preprocessing and inference on a captured frame and the kernels
+ */
+void sendBenchmark(const frame_t& frame) {
+    if (!frame.pic) {
+        frame.request->send(500, "text/plain", "Camera capture failed");
+        return;
+    }
+    DynamicJsonDocument doc(4096);
+    benchmarkPreprocessing(frame.pic, doc);
+    benchmarkInference(frame.pic, doc);
+    benchmarkKernels(doc);
+    AsyncResponseStream* response = frame.request->beginResponseStream("application/json");
+    serializeJson(doc, *response);
+    frame.request->send(response);
+}
 
-            // Find max value
-            int max_index = 0;
-            float max_value = 0;
-            for (int i = 0; i < 10; i++) {
-                if (output->data.f[i] > max_value) {
-                    max_value = output->data.f[i];
-                    max_index = i;
+/**
+ * @brief Read digits of a captured frame and send response or log the value
+ *
+ * @param frame Captured frame, returned to the camera driver
+ */
+void processFrame(const frame_t& frame) {
+    String value = "";
+    reading_confidence_t confidence;
+    if (frame.action == CAPTURE_IMAGE) {
+        sendImage(frame);
+    } else if (frame.action == CAPTURE_BENCHMARK) {
+        sendBenchmark(frame);
+    } else if (frame.request) {
+        AsyncResponseStream* response =
+            frame.request->beginResponseStream("application/octet-stream");
+        // Begin response with previews of all rectangles
+        if (frame.pic && readDigits(frame.pic, response, value, confidence)) {
+            if (confidence.confidence >= config.min_confidence) {
+                logValue(value, confidence);
+            }
+            response->write(frame.pic->buf, frame.pic->len);
+            frame.request->send(response);
+        } else {
+            delete response;
+            frame.request->send(500, "text/plain", "Failed to read digits");
+        }
+    } else if (frame.burst) {
+        int64_t start = esp_timer_get_time();
+        if (!frame.pic || !readDigits(frame.pic, nullptr, value, confidence)) {
+            pipeline_stats.failed++;
+        }
+        pipeline_stats.inference_us += esp_timer_get_time() - start;
+        if (++pipeline_stats.processed == pipeline_stats.frames) {
+            pipeline_stats.end_us = esp_timer_get_time();
+            pipeline_stats.active = false;
+            Serial.printf("Burst: %u frames, %.2f readings/s\n", pipeline_stats.processed,
+                          pipeline_stats.processed * 1e6f /
+                              (pipeline_stats.end_us - pipeline_stats.start_us));
+        }
+    } else {
+        Serial.println("Processing image in background");
+        // Nobody looks at the previews here, skip them
+        if (frame.pic && readDigits(frame.pic, nullptr, value, confidence)) {
+            Serial.printf("Read %s, confidence %.2f\n", value.c_str(), confidence.confidence);
+            if (confidence.confidence >= config.min_confidence) {
+                logValue(value, confidence);
+            } else if (frame.retry < config.retries) {
+                // Glare or a rolling digit passes in a moment, read a new frame
+                capture_request_t capture = {nullptr, 0, (uint8_t)(frame.retry + 1), CAPTURE_READ};
+                if (xQueueSend(capture_queue, &capture, 0) != pdPASS) {
+                    Serial.println("Failed to send retry to queue");
                 }
+            } else {
+                Serial.printf("Not logged, confidence still low after %u retries\n",
+                              config.retries);
             }
-            value += String(max_index);
         }
-        File file = LittleFS.open("/log.txt", FILE_APPEND);
-        if (!file) {
-            Serial.println("Failed to open log");
-            return;
+    }
+    if (frame.pic) {
+        esp_camera_fb_return(frame.pic);
+        xSemaphoreGive(free_frame_buffers);
+    }
+}
+
+/**
+ * @brief Inference task, processes frames in capture order
+ */
+void inferenceTask(void* _) {
+    frame_t frame;
+    while (true) {
+        if (xQueueReceive(frame_queue, &frame, portMAX_DELAY)) {
+            xSemaphoreTake(model_lock, portMAX_DELAY);
+            processFrame(frame);
+            xSemaphoreGive(model_lock);
         }
-        file.print("[");
-        file.print(timeClient.getFormattedDate());
-        file.print("] ");
-        file.println(value);
-        file.close();
-        esp_camera_fb_return(pic);
-        // Wait 1 minute
-        vTaskDelay(60000 / portTICK_PERIOD_MS);
     }
 }
 
 void loop() {
     timeClient.update();
-    processImage();
-    processImageBackground();
+    if (restart_pending) {
+        // Let the response go out, the new model is mapped at boot
+        delay(1000);
+        ESP.restart();
+    }
+    // Capture and inference run in their own tasks
+    vTaskDelay(100 / portTICK_PERIOD_MS);
 }
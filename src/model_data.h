@@ -1,3 +1,10 @@
 #pragma once
 
 extern const unsigned char tmnist_model_tflite[];
+extern unsigned int tmnist_model_tflite_len;
+// Same model with int8 input and logits output, see train/edit_model.py
+extern const unsigned char tmnist_model_int8_tflite[];
+#if MODEL_BATCH > 1
+// Int8 model with a batch dimension of MODEL_BATCH
+extern const unsigned char tmnist_model_batch_tflite[];
+#endif
@@ -0,0 +1,6958 @@
+// Generated by train/generate_inference.py from tmnist_model_pruned.tflite, do not edit
+
+#include "model_generated.h"
+#include "kernels.h"
+
+// sequential/conv2d/Conv2D [32, 4, 4, 1]
+alignas(4) static const int8_t tensor_11[512] = {
+    102, 8, 59, 102, 11, 71, 57, 43, 7, -48, 7, 52, -106, -127, -127, -54,
+    -10, -33, 55, 46, 64, 62, 71, 14, -4, 69, 7, -18, 28, -64, -107, -127,
+    -31, -48, -24, 20, -127, -46, -34, 78, -39, 4, 84, 54, 92, 82, -22, -59,
+    76, 89, -9, -43, -1, 85, -3, -83, 9, 47, 118, 91, -122, -127, 35, 8,
+    -105, -16, 43, 99, 33, 91, 112, 6, 6, 127, 102, -44, 25, -99, -119, -5,
+    -20, 35, 56, 75, -54, -110, -127, -73, 32, -49, -31, -26, 41, 103, 72, 8,
+    -87, 48, 85, 14, -72, -17, 113, -62, 34, -33, 127, -42, -100, -116, 28, -27,
+    12, -62, -43, -35, -58, -68, -70, -28, 0, -26, 3, 14, 50, 127, 100, 70,
+    53, 25, -6, 36, -6, -21, -52, -76, -62, -82, -110, -64, 17, 71, 127, 76,
+    10, -94, -127, -71, 23, -19, -97, -27, 51, 32, -36, 79, 7, 104, 28, 83,
+    92, 63, 40, 22, -17, 53, 28, -69, -75, -50, 127, 33, -115, -100, 32, -69,
+    101, 43, 70, 80, 58, 11, 39, 51, -74, -81, -70, -7, -108, -92, -101, -127,
+    -104, -56, 114, 127, 41, 86, 100, -43, 37, 42, -61, -102, 27, 4, -110, -73,
+    47, 73, -48, -50, -112, 51, -61, -15, -26, 122, -58, -75, -127, 49, 84, 67,
+    127, 60, -90, -112, 69, -87, -27, 52, 78, -65, -66, 16, 53, 51, 117, -25,
+    44, 95, 53, -5, 19, 98, -54, -75, 58, 21, -30, -99, 16, -20, -127, -47,
+    18, -1, -80, -66, 44, 19, -112, -127, 63, 119, -19, -116, 8, 118, 39, -3,
+    -6, 54, -10, 48, -12, 102, 54, -21, 40, -13, 36, -87, -45, -66, -127, -112,
+    76, -2, -84, -127, 22, 18, -20, -87, 81, 81, 30, -35, -36, 93, 1, 8,
+    -83, 92, 48, -5, 28, 53, -38, -69, -6, -127, 75, 76, -101, -94, 49, 19,
+    -8, -86, -127, -65, 19, 75, 62, 46, -16, 82, 43, 4, -36, -22, -56, 37,
+    -2, 15, -96, -25, -17, 96, 33, -32, -127, 12, 67, 70, 6, 88, -1, 0,
+    37, 90, -25, 40, -80, 92, -39, 77, -97, 61, 12, 100, -127, -95, -111, -51,
+    1, -48, 105, 81, -92, -87, 119, 60, -127, -97, 124, 122, -83, 58, 94, 115,
+    121, 116, 76, 38, -19, -21, 79, 57, -63, -38, -86, -67, -79, -127, -104, -31,
+    42, 41, 26, 41, -117, 30, 59, 79, -127, -62, 9, 94, 1, -25, 60, -9,
+    -55, -22, 101, 58, -79, 68, 96, -30, -54, -5, 127, -61, 86, -51, 3, 109,
+    78, 58, -11, -72, 37, 9, -127, -10, -28, -117, -75, 65, -63, -25, 43, 79,
+    57, -35, -25, 23, 63, 53, 54, 88, -48, -14, -7, 46, -92, -45, -127, -74,
+    -104, 92, -111, -46, -82, 1, 107, 22, 88, 69, 7, 71, -12, 114, 127, -51,
+    -16, -92, -88, -59, -10, -41, -84, -76, 127, 37, 9, 18, 64, 86, 26, 57,
+    -121, -2, 74, -29, -95, 127, 23, -45, -47, 76, 35, -101, -65, 94, 4, -33,
+};
+
+// sequential/conv2d_1/Conv2D [64, 3, 3, 32]
+alignas(4) static const int8_t tensor_9[18432] = {
+    6, 10, -17, 24, 55, 42, 35, 1, 26, -28, 40, -30, -44, 28, -15, -51,
+    42, -32, 20, 10, 2, -11, 23, 29, 26, -12, 27, -57, -9, 17, -20, 21,
+    -68, -32, -56, 33, -37, 69, -54, 3, 97, 5, -50, -70, -13, 32, -6, -37,
+    78, -29, 42, 10, -22, 14, -47, -5, -65, -42, -52, -30, -46, 21, 37, -11,
+    15, -54, 51, -72, -13, 112, -8, 39, 57, -1, -56, 35, 29, -7, 14, -14,
+    15, -40, 8, -25, -31, -49, -19, -63, 17, -63, -16, -40, -13, -19, 46, -35,
+    53, 11, -13, 34, 25, 28, 37, -98, -29, -78, 33, 14, 65, -26, -4, -23,
+    -117, 16, -51, 20, 9, -37, 40, -24, 45, 35, -1, -58, 28, 8, -59, -12,
+    47, 14, -47, 49, -22, -72, 35, -50, -37, 21, 64, 4, -64, 27, 19, -63,
+    -16, 3, 29, 46, 77, 31, 54, -8, 36, 32, 28, -65, 45, 14, -60, -50,
+    -37, -27, -69, 25, -37, 127, -12, 7, 56, 25, 45, -74, -46, -1, 5, -35,
+    61, -25, 24, 1, 49, 20, -31, -33, -55, -28, -13, -104, 24, -10, 28, 33,
+    -29, 11, 57, -19, -65, 63, -53, -32, 3, 34, -33, -43, -7, -45, 4, 20,
+    62, -31, 13, -50, -16, -22, -61, -65, -44, -67, -16, -26, -37, -4, 87, 18,
+    17, 9, 45, -36, 18, 118, -12, -77, 10, -26, -10, -4, 16, 2, -40, -31,
+    -14, -22, -58, -38, -58, -33, 37, 24, 52, -12, -32, -73, 39, -33, -63, -33,
+    69, 20, -52, 56, -21, 10, 37, -103, -12, -46, 62, 0, -6, 2, -25, -13,
+    -9, -10, -11, 27, 32, 38, 17, 48, 67, 27, 7, -77, 47, 31, -88, 2,
+    -53, -32, -39, -28, 18, 31, -40, 6, 59, -14, -51, -44, -82, 5, -12, -16,
+    34, -7, -21, -17, 1, -36, -14, -62, -52, -24, -31, -104, -25, 29, -6, -10,
+    -41, -31, -9, -16, -29, 23, -48, -6, 24, -14, -1, 28, -64, -41, 4, 7,
+    0, -42, -29, 7, -22, -8, -11, -53, 29, -39, 0, -51, -49, -34, 42, -58,
+    -27, -10, 16, -45, -67, -5, -31, -21, -27, 6, -49, -33, -12, 10, -9, -6,
+    -20, -25, -15, -28, -4, -4, -41, -53, -61, 16, -13, -13, -23, -11, -17, 9,
+    1, 7, -78, -12, -10, 69, -32, -10, 65, -12, 3, -21, 13, 22, 12, 2,
+    20, 10, 21, -31, 60, -15, 23, -7, 15, -14, 5, -127, 2, -13, -43, -3,
+    31, -16, -6, 12, -20, 13, -1, 2, 1, 13, 9, 54, -44, -7, -23, -40,
+    35, 30, -2, 6, 26, 31, 35, -36, 50, -11, 22, -31, 14, -22, -9, -61,
+    13, -21, -32, 14, 29, -12, -26, -44, 20, 21, 6, -70, 19, 21, 37, -51,
+    17, -20, 27, -32, 34, 29, -15, -10, -67, -32, 14, -5, 31, 36, -12, 63,
+    2, 12, -2, 7, 38, 64, -38, -81, 3, -36, 12, 17, 37, 19, -45, -16,
+    -19, 17, 16, 7, 33, 15, 17, -2, 51, 2, 27, 14, -9, -15, 25, -28,
+    21, 1, 3, 25, -28, 81, 12, -75, -21, -15, -6, -12, 12, 29, -5, 7,
+    -10, 12, -2, -3, 22, -43, 27, 21, 0, 34, -11, -49, -4, -4, 0, 2,
+    15, 6, -6, 18, -28, 44, 19, -62, -4, 12, -7, -33, -9, 65, -14, 3,
+    79, 23, 31, 39, 26, 31, 33, 35, 13, 10, 18, -91, 25, 11, 17, 63,
+    5, 12, 30, -11, -7, -13, 8, -15, -17, 1, -6, 6, 8, 11, 4, 0,
+    14, -3, -4, 17, 19, 25, 12, 3, -23, 33, 17, -43, 8, 0, -23, 24,
+    15, 10, 10, 34, 5, 12, 37, 4, 16, 7, 37, 36, 1, 16, 13, 6,
+    27, 23, 1, 13, 13, 26, 11, 26, 27, 13, 20, -21, -5, 4, -27, 63,
+    0, 7, -27, 7, 9, 6, -5, 26, 21, 3, -13, 16, -25, 17, 25, 52,
+    42, 3, 21, -30, 0, 3, -7, -32, 15, -9, -3, 16, -12, 13, 25, -2,
+    37, 1, -24, 10, 19, 18, 9, -39, 22, -23, 29, 55, -5, -19, -17, 5,
+    -20, 21, -9, -18, -20, -14, 18, -18, 46, 1, -17, -25, 33, -23, -4, -10,
+    40, 29, -50, 22, -1, 22, 7, 2, 8, -27, 16, 20, -10, -12, -11, -2,
+    -16, 7, -7, 6, 10, -18, -2, -4, 50, 2, -22, -14, 28, -19, -46, -23,
+    1, 6, -127, 10, 11, 7, -18, -20, 45, -50, -4, 40, -13, -33, 2, 42,
+    -11, -3, -9, -32, -14, -51, 12, -21, 5, -27, -22, 64, 19, -28, -59, 5,
+    -23, -26, -27, -22, -46, 51, -33, 45, 4, 10, -31, 25, -53, -13, 3, -8,
+    -10, -2, -22, -28, -19, -5, -4, -16, 11, -16, -42, -12, -22, -25, 21, -25,
+    7, -22, -13, -41, -67, 34, -30, 6, -2, -7, -38, -3, -23, 1, -11, -14,
+    26, -37, -23, -25, -11, -36, -45, -45, 20, -45, -33, -18, -8, -24, 23, -47,
+    -29, -57, 1, -38, -57, 1, -58, 27, -2, -14, -3, -6, -75, -6, -13, -14,
+    9, -29, -48, -39, -22, -46, -31, -52, 29, -42, -45, 48, -23, -15, 14, -49,
+    -28, -25, -12, -4, -24, 11, -7, -24, 47, 15, -23, -34, 11, 37, -34, -16,
+    61, 11, -11, 4, -8, -18, -54, 10, -77, -25, 30, -59, 22, 13, -13, 38,
+    -64, -30, -31, -24, -59, 103, -56, 63, 81, -22, -19, -12, -65, 22, 37, 21,
+    -29, -5, -23, -32, -60, -19, -69, -53, -39, -68, 1, -67, -23, 13, 25, -45,
+    -14, -80, -18, -70, -4, 27, -62, 43, 15, 1, -40, 68, -16, 27, -51, -51,
+    -9, -54, 4, -1, -61, -34, -16, 15, 27, -40, -29, -8, -33, -12, -26, -42,
+    46, -24, -63, 33, -3, -66, 2, -127, -83, -54, 9, -6, -9, -60, 32, 24,
+    -100, -27, -37, 39, -9, 31, 46, 8, 60, 24, -10, -31, 49, -22, -90, 38,
+    -5, 51, -29, 46, -21, -31, 23, -70, -93, -10, -13, -28, -6, -32, -28, -28,
+    -7, 40, 22, 43, 75, -22, 20, 39, -9, 11, -2, -60, 42, 24, 60, 25,
+    6, 24, -58, 17, -13, -32, 8, -67, -85, 52, 1, -95, -36, -40, -38, -29,
+    21, -51, -10, 19, -12, -20, 10, -5, -55, 9, -4, -78, 36, 30, 34, 28,
+    37, 7, -30, -41, 2, -12, -65, -84, -20, -13, -30, -35, 6, -24, -8, -29,
+    -10, -33, -70, 12, -111, 7, -18, -8, -7, -39, -18, -5, -55, -43, -26, 19,
+    34, -2, 2, 26, -32, 77, 56, -90, -20, -10, -15, 23, -1, 31, -5, 23,
+    24, 15, 5, 33, -78, -29, 3, 23, 27, 36, 22, -35, -33, -35, -79, 60,
+    48, -16, 20, -16, 17, -45, 22, -53, -9, -29, 32, -2, -36, 21, -20, 73,
+    34, 8, -9, -13, -15, 5, 52, 0, 30, 43, 2, -83, -19, 10, -27, -3,
+    22, 27, -43, -40, -1, -17, -51, -11, 28, -4, 4, 115, 56, -45, -26, 5,
+    10, 39, -3, 0, 39, 32, 40, -27, 18, -12, 12, 86, 69, -18, -51, 105,
+    -35, -21, -21, -3, -28, 29, 46, 14, 69, 45, -19, -6, -82, 53, 25, 14,
+    17, 6, -5, -21, 52, -20, 42, -16, 8, 33, 1, -1, -2, 17, -5, 41,
+    -3, 0, 28, 16, 55, 73, 23, 110, 35, 35, 15, -6, -57, 50, -16, -67,
+    8, 27, -17, 2, 82, 52, 30, 45, -63, -27, 23, -19, 49, 19, 42, 30,
+    -22, 1, -9, -36, -79, 54, 12, -48, 25, -90, 32, 38, -43, -15, -21, -12,
+    -30, 5, -60, -30, -25, -6, 29, -4, 50, 20, -74, -56, -27, -16, -34, 10,
+    -18, -52, -41, 14, -26, 7, 5, -38, 24, -59, 26, 59, -44, -37, 15, 25,
+    -6, 43, -33, -67, -39, -5, -7, -42, 38, -10, 17, -32, 49, -41, -123, 28,
+    96, 80, -53, -16, -18, -4, 55, -35, 23, -109, 10, 76, 19, -73, -17, -5,
+    -111, 47, -46, -31, 45, 21, 38, 25, 64, 30, 30, -41, 99, -68, -125, 32,
+    -9, -76, -24, 14, -71, 27, -14, -8, 13, -8, -11, 27, -52, 8, -9, -43,
+    38, -19, -25, -46, 6, 17, -80, -4, -80, -67, -9, 31, -28, -8, 8, 21,
+    -9, -66, -9, -85, -79, -38, -1, -24, -5, -15, -65, 17, -75, -49, -28, -43,
+    26, -47, 18, -45, 33, -10, -82, -61, -96, -60, -53, -26, -44, -43, 47, -39,
+    32, -52, -66, -101, -37, 8, -94, -72, -74, -33, -36, 15, -9, -99, -37, 18,
+    49, 12, -57, -110, -60, -119, -94, -102, 5, -109, -57, -27, -62, -127, 24, -123,
+    -10, -21, -25, -47, -53, -24, -58, -56, -57, 2, 9, -12, -74, -15, 40, 1,
+    12, -8, 19, -12, 5, 13, 1, -8, -64, 9, 3, -42, -28, -40, -5, -69,
+    -18, 18, 54, 40, 44, -17, 22, 11, 15, -20, -19, -37, -54, 48, -1, -40,
+    -13, 1, -12, 12, 15, 14, 39, 34, -43, -25, 30, -35, 9, 4, -2, 93,
+    30, 39, 7, -5, -10, 67, 3, 87, 34, 42, 46, -13, 3, 28, 38, 62,
+    13, 10, 2, 16, 41, 31, 0, 13, 25, -6, 9, -53, 17, 66, 48, 77,
+    15, 7, -111, -7, -18, 3, -37, -58, 11, -50, 15, 68, 12, -11, 11, -10,
+    11, -6, 11, -19, -7, 3, -6, -11, 48, -22, -56, -83, 8, -48, -68, -49,
+    92, 17, -66, -22, -16, 80, 61, -37, -7, -67, -6, 111, 41, -14, -19, -35,
+    -45, 38, -59, -38, 20, 4, 31, -8, 94, 1, -4, -102, 41, -70, -34, -12,
+    39, 76, -125, 17, 44, 56, 27, -55, 71, -103, 40, 63, 75, -41, -33, 30,
+    -24, 29, -4, 2, -23, -63, 51, -66, 76, 27, -15, 38, 96, -53, -39, 27,
+    -85, -36, -33, -7, -55, 42, -45, 18, 20, 17, -68, -19, -116, -12, 0, -58,
+    8, -24, -16, -41, 10, 5, -40, -3, -40, -61, 0, 56, -50, -18, 11, -2,
+    -57, -111, -28, -10, -93, 47, -82, 1, 20, 9, -86, -26, -35, -42, -34, -41,
+    69, -62, -17, -19, 29, -49, -73, -54, -30, -83, -31, -12, -36, -44, 69, -14,
+    -66, -127, -73, -24, -123, 90, -28, -29, -41, 53, -63, 13, -77, -28, -66, 11,
+    113, -101, -1, -40, 8, -47, -69, -113, 26, -66, -103, -9, -37, -5, 35, -57,
+    69, -37, 29, 41, 9, -99, 42, -76, -54, -50, 46, -15, -36, 5, -26, -23,
+    5, -27, -6, 5, -12, -19, 7, 6, 34, 31, 21, -74, 26, -19, -52, -54,
+    -67, -37, -29, 11, 2, -26, 6, -25, -25, -7, 17, -46, -34, 18, 29, 27,
+    17, -22, 45, -20, -24, 31, 35, 29, -73, 35, 13, -34, -33, 36, 4, -10,
+    -54, 51, -48, -31, 13, -41, 5, -5, -24, 18, -6, 4, 53, 3, 25, 3,
+    33, -13, 22, -20, -42, -24, -10, -52, -54, -38, -34, -32, -45, 21, 32, 29,
+    15, -55, 29, 32, -14, -76, -4, -24, -75, -17, 4, -9, -64, 23, -6, -48,
+    -66, -20, -17, 12, -28, -5, 21, 47, -41, 45, 18, -18, 15, -15, 0, -28,
+    -37, 8, -22, 28, 2, -29, 13, -71, -45, -29, 22, -80, -6, 41, -11, 34,
+    23, -9, -4, 7, 3, 34, 35, -2, -86, 1, 10, -74, -4, 13, 4, -11,
+    -57, 3, -61, 9, -6, -9, -41, 5, 37, 49, -7, -16, 7, -33, -10, 37,
+    19, -15, 10, -4, -37, -31, -36, -45, -28, -15, 23, -13, -23, 5, 31, 14,
+    24, 29, 66, 24, 2, -12, 18, -37, -93, 8, -4, -41, 16, -30, 14, -25,
+    -81, -24, -34, 39, 37, 10, 10, 37, -40, 12, 33, -20, 26, -6, -46, 17,
+    -27, 1, -51, 26, 20, -127, 14, -114, -63, -6, 7, -58, -46, 15, 9, 6,
+    21, 3, 11, -5, -11, 39, 40, 5, -33, 26, 30, 20, -38, 48, -25, 25,
+    -68, 30, -85, 0, -1, -49, -7, -10, -53, 1, -17, -44, -23, -20, 26, 17,
+    28, 23, 39, -43, -1, -2, -23, 8, -80, 13, -21, -65, -58, 26, 19, 26,
+    -16, 15, -38, 6, -32, 24, -16, 20, -37, 79, -6, -19, -86, -19, 1, -52,
+    74, -47, 18, -9, 60, 28, 3, 28, 24, 6, -34, -57, 35, 44, 37, -37,
+    -102, 25, 28, -55, -36, 72, -25, -2, 45, 67, -26, -45, 19, -14, 3, -75,
+    27, -25, -22, -57, 50, 28, -29, -59, -44, -60, 12, -94, 5, -5, 92, -28,
+    -41, -12, -42, -39, -68, 41, -6, -5, 44, 54, -69, 7, 42, -10, -24, -24,
+    64, -59, 21, -58, -26, -35, -19, -37, 16, -42, -37, 55, -3, 29, 47, 11,
+    -26, 27, -40, -5, 15, -55, 1, -79, -115, -35, 48, -42, 33, 27, 6, -15,
+    34, 16, 27, 35, -11, 26, -1, 13, -36, 47, 39, -15, -7, -10, 3, 34,
+    -20, 47, -72, 0, 6, -56, -16, -73, -125, -15, 16, -26, -33, -45, -8, 50,
+    -37, 12, -11, -50, 18, 23, 9, -42, -7, -19, -2, -101, -20, 23, -8, -41,
+    29, -14, -39, -22, 2, -50, -47, 6, 14, 62, -24, 30, -46, -29, 13, 11,
+    -32, -20, 23, 34, 37, 15, 61, 5, 15, -42, -11, 120, 44, -17, 22, -4,
+    -12, 44, -39, -1, 52, -48, 61, -95, -95, -37, 28, -35, 44, 4, -50, 40,
+    19, 37, -10, -17, 4, 17, -29, -15, 41, 17, 40, -55, -4, -8, -17, 38,
+    -22, -8, -78, 12, 12, -75, -25, -127, -54, -58, -9, -39, -3, -14, 17, 58,
+    -15, 12, -19, 14, -43, -56, -28, -34, -28, 22, 18, -22, -5, -49, -81, -53,
+    -10, -62, 54, -27, -57, -20, -20, -7, -16, -23, -47, -7, -62, 16, -29, -23,
+    -40, -36, -31, -37, 5, 27, 32, 15, -26, -1, -27, 47, 11, 5, -57, -21,
+    -16, 60, -45, -3, 8, -74, -4, -56, -53, -39, -28, 4, 26, -10, 15, 59,
+    47, 36, 37, -36, 2, -17, -37, -37, -41, -28, 20, 2, 10, 2, -11, 35,
+    21, 9, -43, -16, -5, -51, -45, -90, -7, -62, -25, 2, 10, -32, -15, 30,
+    34, 4, -13, -44, -29, -65, -42, -25, 7, -18, -51, -24, -24, -71, -51, -43,
+    -23, -47, 9, -10, 14, -47, 24, -9, -1, -40, -9, -44, -44, -6, -5, -33,
+    -52, -33, -35, 32, -37, 4, -12, 19, -11, -13, -8, 75, 16, -6, -7, -4,
+    43, 22, -111, 24, -33, -33, 4, -12, 35, -25, -12, 60, -5, -11, 1, 14,
+    -22, 32, -17, -27, -53, -36, -15, -40, 14, -19, -10, 80, 27, -23, -61, 7,
+    -14, -13, -9, -16, -76, -22, -33, 34, 12, 56, -62, -42, -42, 25, 11, -4,
+    -30, -6, -6, -36, -20, -22, -39, 17, -43, -15, -54, 112, -15, -49, 53, -5,
+    -44, 17, 59, -1, -8, 8, 10, -9, -47, 16, 2, -127, 80, -33, -15, 0,
+    -56, -1, -19, -21, -30, 3, -37, -17, -99, 29, 15, 47, -37, -22, -45, 68,
+    -63, -45, 6, -50, -5, 33, -62, 18, 55, 4, -17, -45, 23, -24, -21, -28,
+    10, -35, -20, -46, -43, 22, -52, 1, -32, 3, -15, 57, -26, 20, 31, -25,
+    -21, -12, 78, -40, -38, -12, -5, 55, -21, 45, -55, -70, 11, 37, -17, 6,
+    -10, 15, -25, -6, 8, -13, -22, 30, -74, 15, 14, 120, -21, -22, 44, -10,
+    -82, 53, 7, -33, 3, -65, 29, -38, -35, -64, -23, -116, 62, 18, -65, 70,
+    -20, 7, 16, -29, -31, 28, -21, 15, -62, 14, -25, 16, -36, 33, -63, 87,
+    24, -21, -43, 24, 33, 7, 8, -33, 15, 18, -9, 35, -36, 1, -16, -65,
+    -27, 7, -21, -15, 62, -22, 51, 1, 40, 26, 3, -83, 25, -14, -6, -19,
+    -61, -1, -29, 18, -9, 12, -32, -43, 47, 5, -21, -55, 4, 13, -25, -21,
+    75, 11, 39, 25, 34, -36, -43, -7, 12, 10, 12, -71, -36, -28, -5, 16,
+    -28, -44, -42, -38, -18, 29, -31, -6, -13, -4, -4, -19, 43, -14, 22, -25,
+    -6, -22, -22, -39, -41, -51, -52, -42, 31, -1, -11, -12, -26, -8, -21, -41,
+    70, 12, 2, 26, -12, 70, -35, -44, 20, -85, -15, 26, 32, -61, -17, 13,
+    -52, 22, -5, -1, 21, 4, 40, -2, 62, 6, -33, -59, 23, -4, -37, -45,
+    55, 1, -34, 34, -29, -19, 49, -49, -54, 7, 29, 16, -69, 34, 18, -54,
+    20, -24, 37, 40, 48, -11, 4, -8, 60, 22, -9, -104, -5, -17, -31, 15,
+    -75, 8, -61, 28, -24, 41, 24, 10, -9, 18, -1, -73, -20, 12, 14, -58,
+    72, -11, 31, -33, 3, -7, -35, -1, -37, -3, -28, -127, -20, -4, 40, 5,
+    -5, -6, 24, -46, -10, 22, -47, 1, 47, 12, -22, -4, -13, 10, -18, -19,
+    10, 6, -5, -48, -42, -14, -59, -34, -35, -55, -52, 46, -35, -15, 43, -12,
+    32, 5, 54, -16, 27, 36, 38, -56, -9, -66, -9, -14, -18, 2, -60, -26,
+    -22, 9, -24, -3, -8, -22, 36, 9, 4, 26, 15, -122, -17, -1, -51, 23,
+    26, -9, -15, 46, -2, 23, 15, -55, 14, -33, 26, -26, 5, 50, 24, -17,
+    36, 36, 5, 23, 43, 6, 53, 19, 30, -12, 20, -69, 38, -29, 9, -14,
+    -8, -8, 17, 43, 25, 2, 23, 36, 35, -2, 9, -29, -40, 38, -4, -17,
+    1, 13, 8, -7, -9, 14, 38, 10, -1, 2, -15, 29, 29, -8, 9, 17,
+    -5, 25, 47, -8, -9, -8, -23, -24, 2, -30, -3, 3, 23, -6, 18, -36,
+    -21, 23, -10, 6, -1, -2, 25, 6, 1, -17, -9, -127, 12, 12, 7, -34,
+    19, 25, -28, 9, 4, -53, 3, -43, -71, -43, 21, -32, 11, 8, -41, -2,
+    -2, 3, -23, 0, 16, -11, 8, 4, 10, -5, 11, -107, 20, -20, -36, -25,
+    38, 31, -38, 1, 40, 43, 33, 8, 5, -26, 42, -1, -9, 13, -58, -34,
+    -70, 36, -35, -22, 3, 2, 33, 0, 12, -3, 35, -48, 14, -27, -33, -22,
+    48, 4, -17, -6, 13, 63, 0, 0, 75, -41, -7, 50, 35, 8, -1, 18,
+    -65, 32, -33, -13, -31, -16, 29, -8, 56, 8, 2, -9, -6, -29, -24, -62,
+    -5, -37, -19, -11, 2, 28, 8, -36, 32, -19, 16, -14, -47, 19, -27, -37,
+    -8, -34, -14, 1, -38, 14, -3, 5, -20, 23, 19, -51, -12, 10, -40, 8,
+    -17, -66, 9, -33, -46, 52, -37, -10, -53, 20, -34, -25, -35, -11, -29, -28,
+    64, -22, 3, -19, 9, -14, -37, -30, -14, -11, 3, -65, -9, -22, 32, 26,
+    13, 3, 38, 3, -22, 11, -8, -28, -29, -16, -16, -22, -19, -9, -26, -14,
+    -3, -45, -9, 16, 17, 0, 2, 12, -6, -2, -30, 46, 30, -5, -3, -9,
+    21, 19, 20, 5, 7, 16, 16, -47, 16, -1, 4, -56, 8, 16, 12, -14,
+    -5, 14, -10, 3, 52, 6, -3, -19, -19, 3, 23, -42, -5, -18, -26, 19,
+    57, 4, -21, -24, 2, -34, -29, -24, -73, -37, -40, -17, 2, -35, 20, -9,
+    -22, -13, 33, 4, 68, 5, 38, -42, 2, -18, 19, -17, -6, -10, -16, -17,
+    24, -34, -37, 11, 26, -28, 52, -26, -11, -37, 35, -38, -36, 8, -13, -24,
+    -41, -28, 6, 21, -35, -16, 16, 14, 34, -46, -10, -47, -6, -31, -3, 51,
+    -4, -11, 19, -8, -23, -17, 27, -57, 10, -24, 37, -116, -65, 14, 15, -46,
+    -27, -34, -27, 8, -24, 24, -1, 39, -33, 32, 31, 21, 13, -9, -65, -30,
+    83, -3, -35, 13, -16, 74, 12, 26, 109, -3, -5, 33, -7, 36, 8, 26,
+    -5, -16, 5, -10, -71, 7, 9, 3, 99, -27, 6, 40, -27, -24, 8, -74,
+    -60, -12, 89, 19, -29, 35, -48, 54, 60, -8, -5, -35, -85, 22, 58, -47,
+    -44, -30, 3, 4, -55, 1, 8, -15, -22, 12, 24, 127, -43, -2, -18, -82,
+    -8, 23, 76, -36, 31, 13, -20, -25, -73, -6, -38, -121, 98, -2, -16, 11,
+    -78, 13, -43, 15, 16, 18, -49, -15, -103, 22, 24, -32, -8, 18, -73, 39,
+    -1, 0, 122, -7, 34, 12, -9, 55, 92, 12, -57, 1, 40, 10, 18, -25,
+    -73, 33, -24, -27, 74, -1, -19, -8, 23, -11, -21, 71, 21, 43, 26, -48,
+    14, 54, 71, -49, 41, -36, -27, 34, 1, 14, -52, -2, 118, -33, -21, -45,
+    -119, 47, -11, -15, 54, -2, -6, -22, 0, 23, -27, 40, 26, 51, -21, 44,
+    -46, 60, -19, -47, 29, -126, -13, -96, 46, -116, -44, 20, 123, -51, -35, 97,
+    33, 46, -17, -18, -37, -3, -72, -69, -36, -11, 8, 44, -74, -11, -94, 19,
+    -50, -13, -12, -63, -12, 40, -82, 37, -9, 15, -82, -7, -46, -32, 15, -70,
+    5, -60, -3, -30, 8, -2, -77, -32, -11, -73, -25, 16, -6, 12, 40, -48,
+    -52, -49, 75, -33, -33, 33, -37, 33, -32, 24, -62, -36, -4, 10, -37, -62,
+    -21, -34, -39, 22, 24, 8, -26, 1, -40, -29, 10, 28, -17, 17, 29, -30,
+    -80, -10, 34, -24, 14, 25, -25, 17, -18, -9, -5, -55, -10, 0, -45, -54,
+    -12, -32, 5, 7, 56, -9, -30, 8, -48, 5, -14, -24, -10, 28, 5, 3,
+    20, 2, -40, -13, -3, -28, -24, -30, 58, -50, -19, 33, 41, -52, -20, -2,
+    -22, -1, -29, -38, 1, -37, 27, -12, 39, -35, -3, -3, -14, -33, -27, -70,
+    7, -29, -26, 18, 18, -15, 16, -43, 3, 2, 23, -9, 20, 3, -1, -33,
+    -21, -18, -23, 30, 50, 4, 22, 37, -20, 28, 29, 21, 16, -13, -30, -8,
+    -20, -17, -17, 14, 33, -21, 30, -62, -73, -11, 29, -4, 9, -29, -13, 40,
+    -1, 1, -10, 9, 6, 4, -15, -1, -3, 9, 14, 32, 1, 34, -41, 49,
+    17, -63, -2, -20, -46, 35, 9, 7, -23, -11, -25, 19, -12, -36, -24, 5,
+    15, 13, -2, 1, -2, -1, -5, 13, 51, -10, -5, 42, -37, -44, -4, -63,
+    -58, -63, 44, 25, -9, -50, 29, -34, -46, 26, -6, -15, -61, -7, -12, -27,
+    -11, -22, -25, 31, 24, -1, -2, 39, -7, 21, 14, 46, -41, 30, -13, 64,
+    -82, 3, -29, 11, 25, -68, 0, -127, -125, -29, 29, -40, -3, -11, 52, 73,
+    66, 27, 18, -29, -24, 14, 1, -18, -10, 0, -3, -95, -31, 17, -12, 72,
+    52, -30, -24, 32, 9, -50, -4, -64, 19, -43, 3, -13, -24, 11, -8, -9,
+    -79, -26, -7, 66, 42, -2, 52, 45, 36, 17, 20, 49, 53, -51, -69, -74,
+    -56, 7, 9, -25, 35, 4, -3, -15, -37, 1, 17, -92, -1, 6, 27, 4,
+    44, -7, 34, 15, 59, -13, 28, 14, -69, -23, 8, -33, 22, 45, 38, 60,
+    -103, 55, 51, 18, 26, 65, -60, -15, 36, 44, -20, -38, 8, 38, 26, 6,
+    43, -59, 36, -23, 34, -20, -55, -34, -108, -36, -16, -76, -22, -26, 40, 19,
+    30, -17, 11, 16, -36, 28, 33, -58, 8, -81, 25, 2, 8, -10, -48, 12,
+    -86, -9, -67, 13, -53, -30, -6, -14, 22, -9, 15, -76, -28, -53, -46, 22,
+    49, 18, -14, 58, 12, 13, 78, 25, -11, 2, 71, 11, -16, 5, 14, 6,
+    -42, 10, -25, -4, -48, -7, 32, -14, 37, 41, 2, -105, 82, -13, -53, 16,
+    40, 8, -53, -9, 42, 75, -8, 26, 64, -1, -11, -2, -1, 36, 44, -62,
+    -12, -17, 8, 31, 16, 40, 49, -24, -2, 31, -6, -93, 37, 29, 4, 37,
+    -24, -20, 14, -36, -41, 39, 1, 8, 41, -63, -27, -27, -46, -60, -68, -81,
+    -43, -54, -29, -22, -1, -26, -46, -14, 27, -66, -52, 23, 22, -58, -20, -19,
+    41, -36, -24, -40, -33, 82, -35, -34, 74, -58, 24, 62, -15, -46, -64, -6,
+    8, 27, -41, -29, -25, -11, 9, -36, 39, 6, -46, -127, 13, -35, -21, -23,
+    23, -8, -76, 11, -1, 56, -4, -86, -18, -90, 49, -11, -16, -34, -54, -3,
+    -2, 21, -43, 3, -1, 16, 23, 1, 42, 13, 0, -45, -10, -41, -24, -32,
+    -13, -2, 23, -32, -18, 83, -7, 7, 42, -1, 22, 15, -39, -25, 4, -16,
+    31, 10, 0, -10, -20, 10, 6, -7, -5, -39, -11, 11, -30, -54, -21, -8,
+    33, -28, 5, -26, -43, 77, 34, 64, 71, -21, 54, -14, -14, 36, 28, -45,
+    38, 15, 5, -14, -7, 17, 43, 7, -9, 0, -32, 37, -43, 20, -19, 3,
+    -17, 17, 46, -2, 16, 45, 5, 15, 8, 38, -11, -34, 16, 45, 45, -8,
+    32, -7, 35, 3, 4, 11, 43, -18, -18, 16, -29, -55, 17, 35, 20, 53,
+    -6, 9, -17, -41, -30, -12, 11, -18, -95, -37, -39, -42, 22, -59, -1, 0,
+    -75, -41, -13, -14, 34, -46, -37, -54, -15, 6, -60, -37, 17, -9, -17, 24,
+    18, 50, 38, -17, 10, 23, 31, -3, 1, 3, 32, 34, 2, 4, -22, -23,
+    -67, 49, -17, -33, 20, -19, 4, 7, 26, -2, -18, -26, 36, -11, -34, 58,
+    53, 6, -13, 22, 43, 41, -11, 12, 40, -20, -25, 55, 39, -25, 28, 35,
+    -10, 64, 13, -13, -1, -27, 51, -43, 2, -8, -35, -2, 27, -5, -26, -21,
+    -40, -4, -81, -22, -58, 46, -7, 17, 32, -1, -7, 45, -23, -8, -50, -69,
+    -50, -37, 6, -38, 12, 2, -31, -63, 33, -51, 8, -9, 14, -11, 24, -82,
+    34, 10, -47, -53, -5, 127, -7, 68, 40, -36, -51, 48, 46, -11, -40, -29,
+    27, -23, -34, -43, -17, -68, -4, -48, 35, -7, 0, -15, -17, -43, 36, -13,
+    -15, -19, -26, -19, -11, 115, -24, 6, 69, -15, 25, 9, -6, 3, -10, -25,
+    -23, 35, 1, -50, -21, -70, -17, -71, 48, -56, -1, 34, 23, -64, -18, -35,
+    21, -105, 19, -53, -92, 33, -10, -5, -56, 38, -33, 0, -120, -57, -37, -7,
+    67, -45, -27, -3, -41, 9, -39, -19, 6, -39, -58, -37, 67, -69, -31, -83,
+    -56, -110, -2, -54, 25, -17, 49, -87, -48, -42, 23, -35, -82, -2, -75, 26,
+    30, -54, -26, -14, -30, -45, -4, -43, -60, -45, 13, 19, -58, 14, -44, 66,
+    -85, 13, -4, 26, -12, -94, 39, -97, -79, 3, 30, -72, 24, -17, -2, -7,
+    -71, -65, -15, 37, -52, 44, -49, 45, -69, -14, -33, -59, -79, 13, -82, 31,
+    32, -24, 104, 13, -36, 93, 2, 10, 112, 45, 3, -5, 8, 32, -29, -85,
+    -1, -78, -41, -47, 17, -27, -17, 35, -8, -27, 28, 8, -29, 38, 44, -64,
+    -87, -66, 19, -5, 20, 30, 48, 9, 35, -49, 0, -12, -2, -24, -25, 42,
+    3, -37, 44, 31, 19, 48, -7, 20, -55, 41, -24, -48, -73, 26, -25, -1,
+    -28, 23, 19, 40, 7, -37, -15, -91, 23, -54, 12, -30, 23, 0, 7, -42,
+    -119, -9, -9, 52, -58, 35, -2, 55, -51, 2, -19, 123, -3, 16, -74, 85,
+    52, -11, 2, 35, -10, 5, 31, 28, 69, 27, -31, 56, -2, 10, -32, 43,
+    -70, -25, -7, 10, 57, 51, 11, -1, 39, 5, -32, 55, 9, 9, -56, 58,
+    13, 2, 30, -30, 20, -77, -15, -16, 17, 12, -42, -33, -55, 51, 0, 40,
+    1, -62, -5, 37, 39, -31, -15, -27, 16, 45, -55, 75, 11, -53, -124, 28,
+    -88, 36, 38, 35, -4, -103, -12, -95, -6, -127, 47, -24, 40, 41, 5, 37,
+    -13, 30, 31, -38, 31, 49, -65, -6, -107, 55, -11, -81, -32, 23, -45, 31,
+    -3, -42, 27, 16, -1, -21, 23, 28, -17, 2, -15, -64, -29, -14, -33, -7,
+    24, 2, 21, 0, -24, 29, -17, 6, -67, 11, -9, -33, 16, -10, -47, -17,
+    20, -25, 35, 5, -15, 15, 49, 28, 19, 22, -13, -5, -39, 11, 24, -23,
+    -26, -1, 22, 40, -14, -13, 53, 46, -51, 24, 40, 19, 21, 33, -22, 32,
+    -4, 39, 47, -6, 38, -29, 29, -33, -57, -39, -12, -17, 47, 3, 5, 44,
+    27, 33, 36, 19, 28, 0, 30, 19, -12, 9, 42, -58, -15, -3, -26, 71,
+    41, 4, -68, -23, -14, -38, 16, 2, 12, -36, 15, 40, 26, -5, -6, 4,
+    -104, -19, -61, 10, -12, -46, -13, -41, 60, -20, 3, -51, 13, -39, -86, -47,
+    82, 39, -41, -10, 11, -13, 29, -32, -12, -96, 45, 53, 12, -45, -5, 11,
+    -127, 44, -54, 10, 2, -49, 27, -21, 28, 14, -23, -38, 57, -37, -90, -12,
+    73, 34, -42, -2, 5, 20, 26, -32, 43, -78, 4, 74, 8, -46, -44, 2,
+    -113, 22, -49, 0, -65, -61, 0, -27, 42, 7, -7, 12, 30, -12, -98, -31,
+    -63, -69, -73, -42, -61, 44, -68, 19, 7, -29, -58, -18, -80, -47, -74, -66,
+    -80, -47, -21, -58, -14, -11, -70, -46, -11, -43, -25, 68, -45, -71, 20, -81,
+    -54, -42, -15, -17, -30, 51, -32, 47, 62, 47, -66, -15, -3, -15, -49, -59,
+    -8, -52, -27, -32, -13, -6, -39, -27, -26, -30, 4, 105, -55, -11, 63, -52,
+    -66, -40, 76, -48, -46, 101, -52, 77, 94, 16, -9, -67, -36, 31, 23, -24,
+    42, -81, 33, 19, -17, 39, -75, -40, 0, -35, -2, 90, -70, 36, 76, 7,
+    44, 28, -11, -12, 18, 24, -19, 4, -28, 11, -12, 15, 73, -42, -28, -8,
+    -11, -36, 7, -49, 2, -52, -22, -9, 80, -22, -24, -103, 9, -12, -18, 9,
+    -4, 23, 10, 9, -14, 57, -23, 8, 27, -13, 24, 23, 7, 16, 48, -3,
+    56, -39, -29, 29, -51, 10, -9, -5, 42, -21, -35, 61, -53, 10, -6, -19,
+    -15, -70, 116, 1, -62, 57, -61, 79, 21, 43, -8, -52, -67, 29, -14, -49,
+    -52, -69, -4, -15, -15, -3, -17, -13, 25, 6, -14, 60, -63, -33, 20, -83,
+    -55, -10, 63, -34, -47, 40, -58, 33, 121, 7, -37, -83, -29, 31, 35, -55,
+    -13, -71, -10, 5, -49, 8, -10, -28, -67, 3, -21, 109, -48, 0, -4, -60,
+    -17, 17, 82, -29, -34, 28, -73, 55, 53, 52, -1, -11, 53, -10, 30, -9,
+    -51, 36, -4, -8, 24, 14, -17, -43, -14, -9, -59, 50, -33, 18, -38, -2,
+    14, -1, 60, -31, 35, -111, 9, -86, -50, -34, 7, -50, 57, -13, -12, 13,
+    -79, 33, -11, 11, 30, -13, 18, 15, -6, -15, 7, 23, 11, -28, -17, -28,
+    53, 43, 47, 14, 66, -7, 4, 64, 18, 18, -9, -22, 47, -5, -4, -25,
+    -115, -16, -15, 24, 89, 14, 35, -29, 26, -2, -34, -33, 59, 27, -43, 30,
+    1, 56, 1, -2, -11, -5, 44, -76, -46, -47, -46, 23, 94, -39, -47, 37,
+    -16, 23, -41, 17, 49, -34, -21, -33, -23, -66, -51, -70, -22, -2, -62, -6,
+    -30, -50, -38, -9, -49, -66, 24, -51, 57, -25, 8, 34, -21, -26, -34, 20,
+    -78, 1, -42, 9, -51, -62, -55, -25, 36, 16, -26, 127, -5, -85, -76, -26,
+    77, 23, 0, -16, 56, -52, -3, -5, -32, -102, 30, 33, 26, -15, -63, -43,
+    -80, 13, -70, -3, 12, 6, 39, -24, 46, -26, 38, -18, 41, -13, -66, -91,
+    36, 21, -63, 55, 54, -71, 9, -6, 9, -59, 16, 93, 33, -54, -43, -21,
+    -48, 76, 28, -23, -32, -37, 30, -18, 41, -1, -4, 36, 58, -37, -107, -36,
+    16, -25, -71, -19, 15, 34, -1, 11, 47, -40, -16, 34, -23, -66, 9, 18,
+    -38, -6, 15, -21, -15, -16, -34, -45, -2, -12, -55, 108, 33, -54, -61, -32,
+    -44, -92, 62, -47, -62, 78, -40, 118, 30, 47, -66, -13, 1, -16, -25, -37,
+    39, -22, -14, -39, -12, -39, -42, -33, 6, -42, 12, 17, -93, -29, 88, -127,
+    -21, -18, 23, -54, -49, 91, -62, 57, 89, 17, -23, -14, 15, 47, -43, -28,
+    26, 4, -12, 2, -29, -19, -43, -67, 40, -17, 14, 44, -69, 27, 15, -75,
+    -53, -5, -17, -27, -48, 59, -40, 53, 10, -47, -15, -3, -21, 7, -15, -51,
+    -2, -31, -9, -18, -7, -35, -29, -14, -8, -12, -36, -21, 4, 16, -4, -61,
+    -31, 23, 51, 6, 4, -65, 24, -31, -93, 48, 36, -84, -16, 37, -8, 2,
+    59, -15, 35, 40, 2, 49, 36, 12, -37, 25, 37, -30, 54, 21, 47, 49,
+    12, 30, 24, 46, 37, 6, 43, 13, -39, 27, -26, -90, 1, 55, -37, -18,
+    34, 15, 50, -2, 27, 29, 5, -9, -17, 41, -10, -41, 52, 37, 35, 64,
+    -60, 2, 14, 14, -37, -32, -15, -57, -90, -16, -18, -75, -3, 18, 18, -6,
+    27, 10, -25, -12, 11, 11, -64, -35, -86, -29, 3, -63, -4, -3, -9, 27,
+    54, -36, 10, -15, -3, 17, 13, -6, -13, -22, 19, 46, 1, 3, -23, -40,
+    4, -5, -39, -20, -45, -16, 12, 8, 45, 6, 5, -34, 33, -18, -30, -91,
+    11, -77, 0, -20, -27, -69, -6, -73, -54, -20, 5, -39, -72, 28, -12, -41,
+    0, -46, 24, 25, -21, 8, 43, 22, 28, 7, 24, -77, -29, -2, -24, 12,
+    2, -4, -16, -16, -7, -47, 35, -94, -39, -2, 33, -58, -11, 35, 16, -13,
+    -3, 14, -21, 21, -52, 6, -23, 12, -77, 41, -9, -33, 22, 13, -94, 12,
+    16, 14, 1, -9, 9, 41, -12, 40, 13, 2, 15, 21, 21, -51, -45, -32,
+    -32, -48, -37, -34, -25, 8, 42, 42, -19, 14, -11, -34, 2, -46, -11, -36,
+    9, -40, -10, -15, 13, -71, 16, -23, -67, -33, 3, -68, -44, 5, -36, -45,
+    -42, -26, 3, -10, 15, -17, 29, -20, -37, 28, 11, 5, -24, 22, -63, -6,
+    -19, -36, -21, 30, 3, -72, -23, -57, -36, -61, 24, -16, -8, 10, -34, -10,
+    -29, -4, -26, -27, 10, 27, -8, 30, -76, 29, -15, -55, -21, 15, -62, -1,
+    40, 16, 10, -3, -38, -41, -16, 39, -4, 7, -11, -34, -36, -7, -27, 2,
+    -59, 1, -22, 25, -1, 18, -4, -7, -17, 37, 21, 7, 9, -2, -39, -30,
+    -4, -4, 4, 9, 13, -70, -5, -11, -46, -27, -19, -95, -10, 24, -45, 0,
+    -45, 20, 19, 19, 21, 22, -1, 14, -65, -29, 13, 41, 1, -27, -24, 57,
+    -40, -26, 12, -26, -10, -127, 27, -92, -99, -86, 18, -95, 35, 18, 23, -28,
+    22, -3, 14, 1, 4, 24, -3, 19, -55, 36, -16, -40, 1, 5, -35, 63,
+    16, -1, 15, 2, -31, -60, -28, -56, -39, 15, -42, -8, -45, -14, -34, -18,
+    21, 2, -43, 12, 34, -58, 15, -5, 24, -23, 13, -122, 57, -34, -33, -50,
+    2, -66, -72, 20, -4, -86, 76, -45, -48, 10, 18, -57, -108, 34, -21, 11,
+    82, 17, 57, 2, 28, -5, 33, 35, -34, 10, 39, -74, 22, -12, -17, 28,
+    -67, -8, -28, 33, -3, -26, 12, 15, 0, 37, 19, -87, 0, -30, 2, 14,
+    5, -33, 39, -12, -44, -30, -13, -29, -105, -13, 20, -1, -45, 28, -3, -21,
+    38, -22, 5, -12, 1, 60, -7, 7, 35, -37, -32, 2, -18, -8, 7, 51,
+    -49, 0, -52, -26, -70, -17, -14, 0, 50, 29, 16, 1, 54, -60, -23, -123,
+    5, -73, 12, 19, -34, -26, -7, 9, -40, 2, 35, -73, -109, 14, -33, 15,
+    36, 15, -12, 15, -51, 34, 42, 33, -25, 31, -21, -89, 13, -27, -7, 77,
+    -64, 26, 28, -2, 23, -12, -1, -16, -52, -2, -14, -74, 39, -10, 24, -8,
+    -4, 30, -15, -16, 10, 27, -28, -17, -77, 36, -12, -16, -38, 38, -24, -17,
+    14, 7, 56, -60, -18, 5, -71, 60, 78, 16, -52, -83, -32, -46, 36, 19,
+    -9, -28, -40, -40, 17, -9, 0, -34, -77, -5, -27, 22, 21, -7, 33, -29,
+    -25, -12, 80, 34, 9, -50, 31, -26, -41, -59, 19, -123, 16, 27, -101, 1,
+    -33, 10, 10, 25, 8, 41, -20, 24, -69, -28, 28, -72, -51, 45, -70, 51,
+    -41, 24, -36, -34, 42, -127, 31, -81, -55, -37, 10, -33, 33, -36, -35, 12,
+    29, -21, -12, 1, -24, 11, -49, -34, -7, 13, 32, -103, -59, 6, -6, -26,
+    -8, -34, 2, -52, -58, 78, -38, 56, 64, 13, -49, 16, -65, 30, -40, -28,
+    9, -20, -26, -59, -72, -1, -37, -24, 24, -52, -44, -31, -9, -16, 17, -8,
+    34, -33, -1, -40, -22, 48, -13, 40, 58, -16, 1, 57, -6, -15, -24, -11,
+    -3, 9, -23, -50, -53, -54, 46, -12, 67, -13, -4, -40, 30, -24, 43, -35,
+    39, -12, -43, -13, -11, 34, 8, -2, -11, -34, -4, 29, -18, -10, -32, -34,
+    -38, 13, -48, 2, -48, -17, 33, -35, 77, 2, 5, -69, 48, -38, -15, -19,
+    -44, 2, -11, 6, 10, 21, -9, 41, 10, 24, -8, -19, -13, 5, -18, -1,
+    38, -10, -17, 22, 33, 16, -12, -16, -45, -1, -1, 32, 5, -11, 42, 24,
+    -54, -7, 0, 2, -28, 37, -5, 14, 11, 0, -13, -74, -36, 24, -20, -40,
+    26, -40, 5, 7, 49, 22, -24, -8, -72, -31, -8, 12, -18, -19, 41, 15,
+    -73, -68, -17, -23, -45, 38, -16, 17, -45, -8, 11, -127, -64, -9, -25, -36,
+    26, -80, -11, -12, 0, -17, -21, -32, -57, -23, -4, -10, -36, -12, 33, -18,
+    4, -23, -25, -15, -24, -14, -3, -46, 3, -46, -5, 32, -1, 14, 8, 36,
+    -29, 23, -24, -3, -6, 15, 26, 11, 45, 17, -27, 29, 23, -38, -41, 25,
+    17, -30, 9, 0, -8, -8, 18, -70, -21, -31, 24, 8, -33, 24, 12, 19,
+    35, 16, 3, 22, 22, 26, 13, 23, 5, 3, 24, 29, -5, -4, -39, 82,
+    -51, -41, -12, 27, 3, -11, 0, -14, -15, -12, 22, -22, 8, -2, 28, -6,
+    -15, -3, -2, 15, 19, 15, 8, 25, -19, 26, -14, 68, -17, 26, -3, 39,
+    38, -23, 42, -33, 5, 10, -12, -29, 23, -20, 14, 15, -5, -36, 16, -25,
+    -56, -3, -39, 34, 17, -9, 36, 30, 19, 18, -6, 46, 43, 22, -33, -17,
+    12, 15, -2, 33, 20, -2, 3, -47, 36, -29, 6, -53, -52, -15, -10, -20,
+    12, -19, -32, 20, 20, 33, 15, -22, -4, 26, 2, -21, 53, 32, -23, 38,
+    -87, 34, -39, 7, -19, 43, -49, 34, 21, -9, -46, -92, 28, 13, -10, -31,
+    10, 28, 14, -31, -31, -37, -2, -11, -69, -38, -21, -23, -11, 21, -15, 10,
+    49, -11, -11, -44, -20, -7, 20, -69, 28, -93, -11, 2, 39, -30, -43, 10,
+    -34, 1, -32, 18, -21, 12, 4, 14, 25, -37, -33, -84, 33, -2, -54, 11,
+    49, -33, 14, 17, 27, 60, 30, 10, 65, 12, 38, 60, 26, -30, -19, -12,
+    -72, -13, 16, 4, -33, 12, -5, -26, 28, -28, 24, -42, 43, -21, 4, -20,
+    8, -28, -80, 19, -15, 57, 59, -18, 98, 51, 29, -17, -68, 49, 28, -16,
+    43, 34, 46, 0, 46, 16, -20, -11, 10, 28, -1, -127, 25, 8, 30, -26,
+    29, -16, -25, -3, -61, 31, -48, -5, 17, -5, -3, -3, 17, -53, -3, -23,
+    32, -27, -2, 16, -37, -40, -48, -28, 23, -16, 12, -10, -35, -40, 18, 6,
+    38, -17, 61, -29, -9, 23, -18, -43, -16, -16, -32, 9, 24, 1, -20, -50,
+    -5, -16, -3, -37, -38, -51, -44, 0, -9, 10, -36, -41, -6, -21, -31, -61,
+    -15, -12, -9, -25, -15, -47, 19, -50, -19, -2, 40, -52, 2, 20, -2, 19,
+    41, 42, -41, -6, -9, 18, 30, -25, -14, 5, -27, -62, 31, -23, -51, 31,
+    84, 27, -35, 38, -6, 92, 78, -59, 34, -38, 52, 103, -25, 14, -59, 18,
+    -30, 14, -39, -37, 77, -7, 60, 51, 104, 24, 54, -107, 52, -25, -85, -29,
+    28, 23, -109, 40, 29, 15, 14, -72, 32, -41, 78, 62, 17, 55, 10, 37,
+    13, 34, 49, 20, 39, 5, 54, 32, 61, 59, 34, -99, 65, -26, -14, 8,
+    26, -11, -27, 6, 35, 15, -31, -20, -8, 33, -49, -54, 16, -13, -8, 39,
+    23, -18, 1, -29, 39, -20, -1, 20, -4, -39, -53, 53, 38, -5, 34, -29,
+    -32, -56, 76, 4, -76, 57, -57, 49, -12, 4, -48, 25, -43, -17, -85, -54,
+    13, -30, -50, -49, 28, -38, -26, -21, 24, 23, -78, -29, -7, -37, 89, -97,
+    -73, -46, -41, 26, -47, 52, -26, 32, 33, -1, -9, -54, -26, 15, -66, -35,
+    -48, -45, -66, 0, -46, -19, -61, -60, 24, -30, -50, -14, -79, -37, -14, -10,
+    -7, 21, 26, 3, -25, 33, -54, 61, 85, 87, 15, 1, 12, 22, 14, -68,
+    14, -22, -29, 25, -12, 17, 22, 4, 21, -24, -7, 30, 30, 33, 68, -127,
+    -86, -27, -35, -10, -87, -9, -88, -45, -84, -27, -26, -79, 18, 13, -42, -3,
+    98, -41, -25, -30, -33, 11, -37, 3, 18, -41, -49, 89, -92, -19, 67, -13,
+    -88, -89, 13, -18, -87, -30, -38, -23, -24, 25, -4, -57, -59, -36, -39, -46,
+    -15, -115, -68, 7, -19, -5, -35, 35, -6, 5, -8, 108, -43, 1, -50, 18,
+    40, 30, 36, -11, 32, 12, 3, -11, -64, 12, -36, -28, 53, -1, 39, -42,
+    -12, 21, -60, -36, 9, -27, -12, 28, -35, 37, 42, -110, 57, -26, -12, -56,
+    18, 10, -11, -10, -35, 59, -22, 10, -18, 30, -28, 0, -19, -3, 15, -1,
+    47, -33, 31, -19, -22, -31, -26, -38, -39, -25, 4, -73, 13, -20, 26, 20,
+    -23, 4, -17, -18, -34, -15, 18, -48, -4, 16, -15, -78, -42, -6, 9, -11,
+    -15, -31, -19, -14, -3, -46, 22, 10, -35, -17, 7, 15, 8, -6, 15, -63,
+    -41, -20, -32, 26, 7, 39, 2, 15, 28, 4, 38, -101, -48, -4, 26, -17,
+    28, -10, 25, 15, -6, -14, 6, 1, -72, -31, -24, 26, 1, 0, -17, 38,
+    -1, 22, -65, 15, 22, -46, 26, -53, -21, -22, 34, -30, -45, 14, -11, 6,
+    74, -1, 34, -30, 5, 18, -24, -17, 12, 4, 31, -79, -12, 15, -11, 20,
+    1, -12, -1, -45, -30, -50, 17, -44, -68, 48, -39, -63, -15, -52, 44, -14,
+    30, 6, 6, 3, -10, -21, -13, 27, -45, 17, -40, -6, -14, -57, -1, -63,
+    -23, -11, -32, 31, -11, 8, 70, -4, -28, 20, 50, -13, -4, 32, -17, -6,
+    13, 15, -10, -17, 28, 42, 1, 32, 8, -1, 25, -3, -5, 14, -53, 87,
+    -56, -8, -83, 10, -14, -60, 22, -51, -84, -28, 26, -30, -29, -12, 16, 13,
+    21, 32, 32, 20, -23, 23, 0, -38, -11, -8, 20, -92, -34, 31, 15, 67,
+    12, 14, 9, -54, -51, -127, -26, -76, -72, 40, -52, -17, -63, -38, 8, 11,
+    23, -42, -23, 5, 19, -37, 37, -2, -25, -28, -44, -20, 33, -63, 11, -16,
+    -35, -55, -21, 18, -13, -95, 68, -64, 7, -44, 3, -72, -25, 56, -31, -15,
+    17, 7, 0, 4, 45, 21, 37, 39, -36, 15, 30, -36, 7, 21, -55, 107,
+    -93, -14, -14, -67, -71, 96, -127, 37, 15, 62, -105, -54, -3, 24, -6, -30,
+    21, -3, -9, 0, 41, -10, -56, -33, -72, -56, -68, 82, -50, -33, 69, -73,
+    -122, -50, 80, -57, 3, 20, 13, 41, 6, -22, -66, -32, -7, 9, -8, -51,
+    -62, -55, -13, -38, 9, 29, -39, 3, -82, -36, -43, 17, -65, -2, 0, 37,
+    -51, 16, 1, -17, 41, -1, -38, -48, -5, -74, -5, -26, 78, -68, 1, -47,
+    -70, 15, -49, -11, 7, -12, -50, -30, -66, -9, 32, -36, -13, -9, -41, 22,
+    32, 25, 62, 36, -29, -14, -27, 11, 47, 47, -37, -6, 78, -6, -41, -21,
+    -45, 5, -18, -11, 67, 21, -6, -1, 51, -7, -2, 94, 68, -28, 1, -23,
+    -19, -9, -28, 3, 30, -28, 2, -23, 10, -5, 40, 33, 69, -6, -62, -7,
+    -9, 6, -39, 52, -30, 6, 21, 8, -5, 28, 4, -40, -21, 3, -70, 70,
+    -65, -4, -50, -17, 26, -19, -8, -66, 3, 20, 1, 25, -33, -78, 17, 17,
+    1, -2, 16, -40, 22, -63, -31, -29, 10, 0, -15, -31, 30, -34, -25, -5,
+    46, -6, 100, 45, 2, 35, 35, -26, 13, 29, -10, 4, 52, -17, 0, 12,
+    50, 31, 23, 43, 61, -38, 15, -27, 40, 48, 18, 21, 8, -7, -21, 14,
+    -21, -16, 29, 43, 20, 26, 75, -39, 40, -23, 56, -22, 27, 48, -54, 33,
+    75, 6, -32, 20, 39, 33, 64, 55, 24, -23, 16, -48, 30, 4, 16, 86,
+    11, 22, -69, -22, -33, 75, -11, 9, 53, 42, -21, 44, -31, 5, -25, -20,
+    46, -20, -40, -14, -10, 11, -37, -27, 30, -45, -38, -91, 35, 22, 22, -77,
+    60, 35, 41, -26, 37, 127, 16, 26, -8, -35, 20, 22, 45, -14, -42, -6,
+    -15, 27, -45, -38, 16, -29, 43, -29, 56, 44, 6, -81, 12, -58, 30, -24,
+    81, -27, -54, 41, 18, -69, 8, -74, -53, -42, 15, 26, 13, 34, -19, -52,
+    -33, -7, -51, 31, 27, 43, 47, 20, 98, 11, 10, -49, 50, -10, -106, -22,
+    15, 1, -33, 42, -8, -35, 30, -66, -6, -10, 2, -85, -56, 23, 44, 1,
+    21, 35, 18, 16, -21, -25, -8, 30, -33, 20, 29, -55, 51, 25, -23, 9,
+    47, -36, 52, -39, -10, 73, -76, 28, 110, 10, 15, 12, -68, 6, -44, 16,
+    22, -44, -40, -4, 1, 4, -3, -31, 12, 4, -28, 39, -18, -39, 36, -33,
+    -5, -71, 57, -35, -30, 42, -6, -40, 12, -60, -33, -41, -1, 14, -63, -66,
+    -68, -55, -42, -23, 22, -28, 16, 18, -11, 18, -20, -67, -48, -32, -5, -30,
+    -24, -58, -29, 53, 22, -75, 69, -72, -67, -51, 41, -95, -31, -15, 6, -16,
+    4, -4, 27, -10, 22, -18, -15, 14, -68, 31, 23, -92, 1, 34, -79, 57,
+    22, 9, 59, 11, 14, 35, -6, 27, 31, -29, -28, 17, 5, -41, -4, -36,
+    -37, 2, -37, -14, -8, -33, -31, 1, -20, -14, -24, 68, 21, -14, -24, 15,
+    34, 37, 29, -41, -34, 17, -6, -67, 8, -28, -23, -50, 6, -41, -17, -17,
+    -66, -15, -31, 0, -23, -4, -32, 19, -37, -26, -34, 3, -15, -1, -47, 27,
+    30, -20, 1, 44, -3, -38, 7, -111, -26, -89, 0, -50, -30, 13, -39, -28,
+    -17, 3, -5, 47, 7, 12, 27, 54, -21, 22, -16, -92, 53, 41, -125, 21,
+    -57, 63, -59, -37, 7, -42, -5, -65, -72, -29, -33, -84, 5, -42, 20, 30,
+    57, 25, 30, -61, -16, 17, -12, -15, -59, -32, 11, -46, -34, -8, 20, 18,
+    26, -8, -25, -32, 14, -14, -14, -51, -29, 39, -31, -44, -35, -18, -16, -5,
+    19, 12, -25, -24, 24, 3, 24, -13, -12, -36, 0, -3, 73, -8, 35, -29,
+    -56, 1, -33, -2, -15, -24, 3, 32, -29, 38, 28, -90, 26, 12, 34, -25,
+    16, -37, 42, -12, 24, -5, -7, 44, -22, -3, -4, 0, -3, 12, -18, -9,
+    -116, 1, -127, 20, -8, -86, -46, -59, -21, 1, -31, -78, 10, -13, 63, 61,
+    58, 37, 55, -38, -56, 16, -96, -103, -109, -38, -29, -95, -23, 28, -16, -31,
+    28, -16, -14, -42, -4, -35, -7, 15, 18, -5, 21, -23, 21, -10, -5, -10,
+    -16, -39, 15, 6, -23, -42, 7, -2, -41, -21, -26, 38, 30, -37, 11, -14,
+    -26, 30, 13, -14, 22, 8, 1, -44, -62, 0, 55, -116, 54, 47, -28, -15,
+    -30, -5, -8, 20, 16, 21, 36, 2, -63, 32, 5, -9, 7, -18, -66, 34,
+    -68, -36, -39, 50, 3, 15, -20, 63, 44, 77, -17, -115, -57, 69, 68, 31,
+    63, 19, 13, 1, 52, 24, 14, -54, -67, -40, -33, -81, -40, 59, 58, -28,
+    -63, -27, 107, -12, 27, 51, -19, 76, 85, 78, -46, -98, 11, 32, 43, 8,
+    29, -17, 27, -20, 32, 30, 27, -27, -77, -6, -3, -16, 7, 41, 53, -19,
+    -13, 43, 87, -4, 19, -55, -4, -32, -9, -92, -32, -29, 74, -46, -58, 66,
+    -6, 40, -48, -52, -45, 16, -40, 26, -17, -34, 25, -15, -18, 30, -61, 92,
+    31, -51, 60, -32, 48, 113, -4, 65, 127, 23, -30, 56, 82, 1, 0, 15,
+    -41, 29, -42, -33, 24, -16, 23, -59, 65, 0, -16, 81, 56, -55, -28, 81,
+    67, -27, 72, -2, 17, 31, 42, -69, 21, -83, 57, 68, 7, -35, -23, 19,
+    -63, -35, -44, -2, 37, -42, 0, 4, 72, 58, 14, 19, -11, -10, -75, -4,
+    -46, -31, -107, -37, 6, -12, 31, -43, 4, -88, 46, -6, 13, -12, -39, 51,
+    31, -20, -49, -5, -12, -31, 23, -18, -7, 14, 20, -75, -29, -40, -67, 39,
+    41, -6, -63, -65, -25, -32, 14, -114, -20, -2, -40, 6, 10, 10, 9, 11,
+    -18, -50, -51, 6, 37, 4, -50, -18, 38, -74, -5, 55, 19, -11, -23, -66,
+    8, 1, -42, -19, -5, -6, 8, -55, -23, -37, -26, -35, 18, -27, -76, -10,
+    -44, -8, -24, 50, -52, -16, 22, -6, 6, 29, -20, -7, 9, 8, 11, -8,
+    -79, -45, -53, 18, -24, -9, -20, -116, -13, -25, 16, -85, -72, 25, 21, -19,
+    34, -1, -2, -58, 44, -15, -47, -40, -57, -64, 18, -84, -72, 1, -17, -33,
+    24, -71, -13, -17, -106, -10, -92, -53, -7, -61, -43, 63, -86, -66, -37, -6,
+    -65, -9, -54, -94, -106, -23, -40, -78, -7, -33, -50, 70, -18, -85, -51, -52,
+    44, -36, -3, -31, 20, 30, 42, -51, 41, -4, -12, 51, -9, -41, -35, -61,
+    -36, -40, -41, 16, -45, -56, 31, -39, 62, -28, -33, -4, 57, -53, -71, -53,
+    22, 2, -26, -23, -41, -37, 30, -101, -44, 13, -38, 21, -64, -16, -11, 4,
+    -14, -24, -61, 0, 19, 9, 38, 11, -11, 4, 2, -2, -18, 9, -15, 7,
+    66, 6, -62, -3, -22, -34, 13, -31, -29, 12, 65, 78, 8, 29, -27, -40,
+    -37, 31, -1, 6, 16, -1, 12, 29, 88, 33, -7, 18, 31, 19, -20, -26,
+    -2, -29, 15, 37, -12, -26, -31, -24, -4, 25, -18, -39, 7, 24, 11, -14,
+    77, 16, 18, -15, 32, 20, 40, 14, -26, -16, -5, -25, 30, 22, 37, 17,
+    -36, 23, 22, 17, 5, 11, 4, 34, 45, 45, -15, -35, 12, 20, 37, 8,
+    27, 0, 10, -2, 22, -10, -15, -21, -6, -48, -12, -21, 1, -5, 27, 34,
+    -28, -60, 27, 22, -10, -7, -8, -7, -74, -45, 3, -36, 16, 24, -35, 3,
+    -94, -8, 1, 22, 9, -9, -9, -18, -6, -12, -6, -49, -32, 24, -59, -6,
+    18, 17, -14, 13, 26, -59, 14, -71, -70, -9, 7, -15, -13, -7, -20, -3,
+    25, 17, 7, -15, 5, -10, -14, 11, 4, 30, -25, -21, 14, 24, -40, 6,
+    -13, -28, -69, 4, 7, 10, 35, -40, 9, 67, 26, -55, 10, 37, 14, 24,
+    15, 25, 12, -16, -1, 2, 37, -2, -21, -20, -7, -100, 21, -25, 45, 76,
+    -13, -8, -21, 10, 0, -80, -12, -76, -88, -45, -17, 27, -12, -29, -18, -23,
+    -66, 6, -46, 0, -2, 5, 19, -44, -29, -29, -9, 13, 4, -8, 0, 24,
+    -5, -18, -34, 10, 28, -44, 28, -95, -72, -41, 0, 35, -51, 0, 10, 16,
+    10, -28, -33, 13, -39, 22, 35, -21, 18, 20, 17, -46, 23, -27, -44, -37,
+    -22, -3, -79, 21, 24, -11, 39, -96, 25, 9, 27, 10, -7, 27, -16, -10,
+    52, -27, -9, 15, 15, -10, 28, 18, -27, 7, 14, -127, -14, 3, 0, 28,
+    -2, 7, 7, 6, -12, 15, 27, 9, -17, -16, 11, -18, -5, 25, -14, 31,
+    9, 14, 13, 21, 15, 23, 7, -6, -41, 18, -5, -40, -15, -6, -6, 29,
+    4, -28, -13, 14, 13, -3, -12, -4, 12, 32, 28, -1, -8, 22, 16, -11,
+    29, -1, 29, 11, 3, 0, 14, -1, 11, 19, -8, -29, 42, -12, -4, 17,
+    25, 38, 2, -7, 28, -13, 13, -14, -5, -26, -7, -2, 38, 28, -29, 16,
+    -16, 42, -4, 23, 12, 16, 24, 12, 17, 6, 17, -127, -5, 20, -7, 83,
+    30, 6, -44, -2, -29, -10, 10, -63, -6, -18, 20, 44, 23, -10, 22, -4,
+    -21, 12, -12, -17, -18, -28, -5, 8, 26, -24, 8, 25, -2, 0, -50, -9,
+    33, 21, -50, -10, -7, 27, -20, -35, -10, -46, 13, 48, 9, -12, -23, 4,
+    -19, -15, -17, -20, -30, -34, 14, 13, 36, -5, -15, -5, 41, -12, -52, 6,
+    34, -4, -35, -3, -13, 22, -3, -29, 15, -21, -15, 14, 63, -14, -14, 33,
+    -24, 29, -18, -31, -15, -46, -18, -36, 55, 6, 19, 26, -11, -53, -34, 24,
+    -9, -35, -62, -27, -37, 24, -45, 4, 11, -10, -39, 7, -54, -21, 14, -8,
+    16, -6, -21, -15, -51, 3, -35, -3, 14, -22, -31, 44, -3, -19, 12, 6,
+    -15, -40, -23, -43, -40, -3, -18, -3, 19, -19, -49, 4, -10, -55, -37, -36,
+    -4, -37, -30, -51, -44, -42, -17, -46, -5, -42, -45, -4, -37, -48, -15, -38,
+    -38, -64, -38, -24, -31, 26, -3, 22, 31, 26, -40, -59, -48, -3, -3, -34,
+    5, -45, -36, 3, -34, 12, -18, -39, -5, -24, -27, 87, -54, -23, 12, -20,
+    72, -21, 13, -28, -17, -109, -17, -72, -68, -18, -24, -50, -85, -37, -38, 10,
+    22, -6, -4, 31, -53, -16, 19, 54, -40, -11, 9, -16, 13, -26, -84, -32,
+    -68, -24, -71, 13, 24, -85, 28, -72, -42, -32, 20, -127, -30, 41, -4, 43,
+    69, 13, 40, 35, -37, -4, 1, 29, -103, -26, 32, -103, -59, -15, -18, 68,
+    -95, -23, -68, 3, -11, -57, -41, -22, -32, 41, -18, -45, -12, -41, 23, -14,
+    -15, -30, 16, 3, -63, -23, -39, -3, -90, -40, -36, 51, -87, -1, 37, 6,
+    41, -42, 61, -8, -22, -37, -40, -22, -7, 1, -40, -30, -77, -31, 26, -8,
+    -37, -67, -2, -34, -58, -5, 3, 31, -47, 9, -22, -41, 56, -51, 13, -66,
+    -62, -62, -22, 42, -18, -45, 49, -25, -47, 13, -17, -69, -47, 56, -22, 32,
+    70, 1, -10, 1, -10, 40, 9, 28, -15, -8, 1, -56, -55, 8, -19, 48,
+    -82, 40, -26, -13, 18, 6, -34, 22, 32, 69, -29, -61, 28, -50, -13, -6,
+    -8, -4, -6, -20, 1, 17, -12, -23, -68, 24, 9, 41, -21, 32, 32, -39,
+    -16, 3, 14, -30, -33, 40, -3, 41, 27, 57, -36, -62, -30, 1, -3, -18,
+    -3, -34, -22, 11, 22, -39, 22, -16, -57, -37, -23, -63, 8, -26, 61, -56,
+    -32, 0, 11, 25, 18, -71, -9, -62, -23, -29, -10, -97, -30, 38, -48, 4,
+    -23, 18, 11, 6, -7, 37, 27, 17, -33, 36, 34, -72, -31, 37, -82, 39,
+    4, 11, -35, -15, 26, -31, 37, -4, 51, 17, -1, -38, 57, -12, 37, 22,
+    2, 38, 46, -37, 27, -29, -2, 27, -63, -16, 18, -9, -41, 18, 41, -38,
+    -46, 30, 41, -8, -19, 9, 36, -16, -17, 47, -3, 0, -27, 12, 16, 4,
+    54, -4, 2, -3, -22, 30, -23, 35, -42, -22, -25, -44, 20, 15, 38, 29,
+    3, 13, 5, -10, 3, -3, 1, -41, -86, -32, -22, 5, 33, -58, -3, 34,
+    5, 20, -4, -7, -15, -17, -25, -32, -27, -33, -7, -45, 24, -17, -1, 7,
+    41, 2, 4, -3, 0, -42, 67, -53, -13, -29, 20, -14, 18, 11, -22, 14,
+    -2, 7, 2, 26, 48, 33, 36, 47, -19, 19, -2, 57, 61, 27, -50, 54,
+    -27, 10, 3, -2, -14, -38, 26, -15, -33, -16, 32, 20, 4, -20, -16, 4,
+    25, 12, 31, 15, -11, 2, -34, -15, -11, 24, 12, -14, 21, 25, 4, 21,
+    -45, 31, -27, -34, -7, -74, -45, -88, -70, -8, -42, -43, -13, -43, 3, 34,
+    29, 16, -1, -59, -13, -51, -16, -24, -57, -51, -10, -8, -14, -41, 16, -28,
+    8, -52, 19, 41, 8, -66, 50, -88, -48, -44, 39, -43, -2, 34, -27, -25,
+    -18, -18, -39, 9, 30, 0, 42, 24, -43, 9, 11, -14, 14, -10, -95, 48,
+    -51, -1, -37, 7, 18, -57, 30, -19, 0, -37, 38, -20, -11, -15, -16, -9,
+    6, 1, 19, 18, -23, -28, -39, -5, -39, -20, 0, 45, -63, 24, -42, 49,
+    -27, -6, -44, -70, -70, -60, -33, -78, -35, 0, -17, 8, -31, -27, 16, -8,
+    39, -11, -5, -26, -20, -22, 4, -11, -33, -37, -47, -30, -22, -27, 10, 72,
+    75, -1, 29, -12, 34, -46, 28, -127, -36, -94, -1, 51, 4, -15, -36, -40,
+    -1, -16, -54, -17, -30, -11, 53, -1, 38, 24, 4, -103, 72, -33, -71, 45,
+    49, 29, -32, 78, 5, -45, 56, -63, -68, -17, 66, 83, -25, 70, -20, 8,
+    66, 22, 53, 52, 51, 0, 24, 21, 60, -19, -38, -108, 82, -1, 25, 5,
+    51, 0, -37, 0, 19, 30, 27, -60, -27, -39, 48, 45, -31, 72, -8, -30,
+    -81, 49, 7, 61, -1, -27, 67, 34, 9, 67, 13, -62, 44, -32, -2, 20,
+    56, 73, -2, 6, 18, -12, 46, -49, 14, 0, 71, 47, 24, 45, 48, -13,
+    -21, 69, -21, 11, 13, 32, 41, 41, 64, -1, 38, -42, 42, 11, -43, 64,
+    55, -22, -101, -44, -46, 27, -3, 35, 62, -30, 24, 109, -63, -4, 19, 18,
+    -14, 27, -9, -10, -72, 7, -14, -56, 107, 4, -31, 2, -9, -89, -22, -40,
+    42, -29, -12, 9, 8, 101, 11, 72, 50, -30, 14, 47, -47, -10, -54, -68,
+    -23, 20, -48, -83, 6, -72, -46, -9, 56, -17, -21, -11, -14, -40, 34, -96,
+    25, 5, -3, -51, 23, 66, -11, 16, 64, -56, -32, 11, 67, -41, -80, 28,
+    -119, 28, -36, -12, -67, -41, 11, -41, 63, -5, -28, 46, 47, -24, -90, -10,
+    10, -35, -9, -76, -84, -32, -13, -18, -48, -12, -41, -10, -43, -2, -37, -96,
+    -31, -77, -5, 11, -30, -33, -31, -66, 19, -44, -33, 59, -41, 9, 26, -3,
+    -91, -82, -60, 11, -47, 11, -24, 19, -67, 35, -8, -61, -52, -7, -59, -72,
+    21, -59, 17, -41, 13, -23, -32, -25, 14, -50, -48, 57, -96, -26, -34, 11,
+    -127, -38, -59, -6, -88, 20, -22, 21, 27, 22, -55, -100, -42, -14, -36, 0,
+    -4, -38, -10, -60, -23, -23, -60, -24, -69, -79, -51, 62, -31, 14, 9, 14,
+    -8, 10, 15, -9, -8, -45, 4, -20, 10, 9, -8, -24, 15, -45, 22, -21,
+    -71, -7, -20, -10, -56, -1, -32, 43, 6, -18, -37, 127, -12, -38, -48, -30,
+    14, 29, 30, 20, 50, -39, 47, -45, -11, -51, -4, 41, 40, -6, -11, 28,
+    -50, 1, -11, -7, -47, 5, 47, 9, 36, 20, 42, 6, -8, 13, -64, 73,
+    41, 57, -57, -14, -13, -127, 28, -101, 43, -57, 30, 37, -8, 4, 20, 63,
+    -17, 46, 14, -23, -36, -30, 13, -45, 24, -12, 29, 58, -6, -16, -100, 50,
+    -99, 3, 11, -5, 12, -13, -25, -26, 44, -20, -55, -49, 20, 6, -32, -28,
+    15, 13, -35, -49, -1, -2, -25, -20, -87, 14, -30, -6, 19, -19, -19, 35,
+    8, 8, 5, -67, -24, 36, -23, 11, 40, -5, -22, 11, 72, 14, 27, -21,
+    -28, -22, -31, -57, -83, -51, -41, -48, 8, -53, -16, -16, -27, -7, -27, 54,
+    -26, -42, -48, -58, -74, 22, -32, 29, 38, -4, -23, 94, -30, -27, 7, 3,
+    -30, -15, -40, -63, -68, -20, -67, -78, 0, -35, -57, -1, 7, -14, -35, 7,
+    -57, 27, -11, 37, 46, 66, 10, 5, 48, 41, 26, -48, 23, 74, 0, -79,
+    -9, -11, 27, 14, 34, 47, 17, 3, -65, -17, -6, -80, 8, -5, 25, 44,
+    -57, 25, 67, 4, -11, 65, -41, 41, 94, 61, -6, -69, 15, 2, 48, -19,
+    32, -51, 46, -1, 8, -19, 26, -7, -93, -51, -54, -20, 50, 1, 68, 15,
+    -26, 2, 30, 24, -11, 65, 22, 28, 0, 24, -25, -57, -65, 0, -41, -15,
+    45, -23, 30, -17, 38, 10, 25, -74, -22, -52, -48, -108, 56, 18, 60, 16,
+    -51, -2, 2, 29, 6, -94, 39, -53, -96, -26, -5, -40, -2, -21, 18, 22,
+    -16, 6, 22, 17, -23, 27, 22, 19, -36, 13, 21, -12, 1, -15, -25, -11,
+    -42, 1, -17, 33, -13, -55, 22, -41, -19, -40, -23, -12, 21, 22, 11, -2,
+    1, 1, -26, 7, -18, -24, 37, 26, -61, 36, 22, -6, 25, 20, -6, 3,
+    31, 33, -16, 3, 15, 44, -9, 29, 3, 2, 20, 48, 60, -26, 21, -8,
+    -1, 20, -9, -26, 21, -14, -9, -10, 35, 18, 34, 14, -13, 26, -13, -17,
+    -29, -3, -34, 32, 14, -49, 25, -77, -27, -8, 26, -26, -7, -27, -8, -12,
+    -28, -35, 13, 15, -7, 24, 1, 9, -47, -16, -26, 31, -50, -15, -25, -11,
+    -24, 32, -1, -11, 0, -38, -11, -110, -46, -36, -35, -29, 24, 20, 0, -4,
+    -4, 1, -13, -12, 14, 32, 15, 3, -64, -13, -6, -1, 4, 6, -14, 20,
+    12, 54, -24, -28, 13, -39, 14, -59, -28, -45, 23, 20, 70, -49, 2, 18,
+    19, 55, -29, -5, 24, -32, -23, -39, 47, -29, -24, 40, 20, 1, -61, 9,
+    -54, -29, -5, 17, 31, -104, 17, -61, -71, 4, 18, -76, 7, -4, -33, 36,
+    -31, -42, 33, 28, -24, 32, -18, 1, -71, 24, 38, 88, -30, -16, -86, 35,
+    -89, 4, -10, -35, 16, -117, -30, -127, -62, -6, -4, -105, 10, 9, -11, 22,
+    31, 13, 29, -28, -38, 18, 5, -16, -57, 22, 4, -33, -95, 20, -24, 21,
+    -19, 25, -104, -30, -31, -55, -76, -85, -48, -34, -39, 25, 11, -56, -14, 49,
+    41, 3, -24, -68, -63, -50, -42, -66, 11, -51, 1, -23, -24, -15, -49, -2,
+    6, -13, -37, -13, -22, -95, -45, -108, -91, -16, -4, -46, 48, -46, 46, 29,
+    33, 40, 41, -39, -40, 15, 6, -56, -13, -1, 5, -64, -5, 11, 41, 12,
+    65, 14, -16, -14, 38, 65, 32, -96, -86, -14, 34, 38, 17, -5, -3, 2,
+    -51, -30, 15, -7, -32, 5, 6, 38, 36, 27, 19, -42, 67, -24, -69, 84,
+    -10, -36, -75, 5, -2, -82, 11, -124, -110, -35, 40, -39, -80, -1, 1, -25,
+    42, -39, 27, -3, 35, -4, -20, -10, 53, 6, -12, 4, 22, -4, -10, -21,
+    -25, 60, -52, -4, -39, -101, -70, -58, -75, 4, -54, -37, 44, 0, 36, 42,
+    43, 3, 28, -36, -62, -39, -22, -26, -61, -72, -30, -8, -38, -2, -5, -49,
+    26, -9, -30, 2, -38, -46, -22, 10, -14, -30, -43, -54, -69, -1, -71, -61,
+    -62, -8, -72, -36, -36, 9, -44, -10, -2, -11, -11, 19, -24, -44, 13, -35,
+    -105, -5, -2, 18, 13, 5, -23, -21, 35, 38, -24, -106, -20, 39, -21, -17,
+    -60, -4, -35, 26, -51, 31, -54, 41, -65, 30, -9, -31, -19, 13, -36, 20,
+    -33, -15, 24, 20, -49, 18, -61, 78, 64, 41, -54, -10, -59, 66, 13, -21,
+    25, -22, 40, -27, -29, 17, -34, -39, -60, -61, -16, -4, -23, 26, 17, -71,
+    -24, -40, 104, 12, -23, 88, -81, 89, 97, 10, -17, -80, -18, 6, -26, -42,
+    -91, -16, -21, 21, 20, 35, -14, 3, -28, -15, -36, 89, -45, 47, 13, -62,
+    -12, 18, 113, -38, 60, -38, -27, -5, -64, -25, -17, -56, 127, -1, -44, 85,
+    -98, 77, -24, -8, 51, 54, -15, -14, -47, 35, 34, -60, -60, 31, -35, 50,
+    -24, -27, -10, 20, 27, -20, 34, -34, -2, -37, 18, -36, -9, 22, -37, -19,
+    -1, -32, 17, 29, 23, 7, -15, 19, -55, 12, 1, 1, -23, -1, -28, -16,
+    -40, 0, -32, -37, -24, 45, -53, 14, -9, 36, -17, -27, 1, 16, 27, 3,
+    66, -9, 30, -29, -12, -21, -27, -40, -41, -25, -22, -65, -14, -20, 44, -16,
+    21, -24, -3, -27, -20, 51, -2, 36, -25, -2, -23, 17, -27, -11, 0, -1,
+    24, -24, -31, -48, -19, -19, 16, -51, -4, -29, -51, -36, -21, -28, 22, 9,
+    24, -27, -58, 33, 27, -127, 8, -90, -57, -43, 15, 18, -16, -1, -27, 1,
+    -40, 21, -19, 39, -1, -7, 32, -1, 42, 26, 24, -67, -1, -17, -86, 1,
+    28, 1, -47, 54, -21, -27, -13, -1, 1, 42, 16, -31, -10, 29, 17, -29,
+    44, 12, 23, 38, 10, 34, 53, -6, -1, 22, -8, -86, 14, 18, 51, -9,
+    -41, -34, 14, 1, -34, 38, -5, 35, -13, 15, 5, -79, 21, 9, 18, -43,
+    58, 3, 2, 4, -8, -1, -3, -18, -25, 0, 7, -99, -24, -4, 42, 6,
+    26, -3, 9, -3, -29, 22, -9, -38, -41, -25, -23, 32, -22, -37, -37, -45,
+    -55, -24, -59, -23, -33, -50, -7, -13, 3, -27, 1, -25, 5, -16, -66, -56,
+    11, -7, -46, 51, -5, 23, 16, -54, -45, -1, 48, -28, 6, -3, -25, -29,
+    27, 21, 4, 14, 4, -16, 41, 18, 25, 12, -10, -79, 36, 8, -39, 33,
+    -4, 4, -11, 25, 5, 36, 20, 11, -3, 37, -4, -26, -51, 9, -10, 2,
+    52, -35, 0, -3, 41, 22, -14, -10, -1, -11, -14, -73, 4, -17, 32, 11,
+    -6, -24, -74, 30, -8, 14, -21, -66, 9, -9, -15, -84, -45, -26, 33, -44,
+    62, -39, 34, 22, 31, 11, 23, 14, -45, -25, -20, -68, -29, 23, 15, -8,
+    -46, -6, -14, 10, -41, 81, -81, -3, -31, 51, -37, -65, -8, 14, 43, 17,
+    77, -41, 46, -43, -17, -29, -17, -73, -14, -20, -11, -75, -69, 12, 80, 0,
+    4, -37, 42, -24, -19, 12, 4, 14, -57, -22, -3, -48, -32, -42, -53, -57,
+    -38, -15, -55, -20, -27, -24, -16, -4, 23, 30, -11, -17, -47, -31, 15, -2,
+    34, -63, -53, 45, 16, -75, -8, -127, -63, -57, 6, -27, -63, -8, -2, -34,
+    -73, -9, 25, 13, -15, -16, 28, 26, 47, 32, 12, -86, -10, -14, -92, -21,
+    -41, 32, -51, -11, -22, -28, -46, 5, -5, 11, 14, -75, -21, 34, 34, 4,
+    87, 18, 32, 15, 18, 33, -35, -37, -28, -13, -29, -42, -1, -16, 54, -1,
+    -85, -32, 33, -24, -41, 58, 15, -8, 23, 16, -35, -41, 39, -39, -32, -41,
+    -1, 8, 15, -4, -49, -17, 7, 14, -71, -35, 5, -47, -58, 10, 48, -22,
+    42, -1, 1, -5, -24, -30, 35, -62, -65, -44, 41, -25, 3, -41, -27, -29,
+    -90, -12, -57, -2, -29, 2, 48, 34, -3, -25, -18, -61, 7, -34, -64, -29,
+    -2, -32, -34, 47, 18, -31, -30, -78, -42, -9, -24, -43, 25, -2, -11, -9,
+    61, 2, 25, 11, 24, 24, 27, 1, -33, -14, -31, -100, 25, 11, -6, 52,
+    1, 13, -45, -30, 20, 1, 20, -36, 8, 16, -3, -34, 26, 8, -2, 21,
+    -4, 9, 16, -9, 16, -37, -25, -48, -2, -18, -16, 24, -25, 12, 38, 29,
+    -17, -46, -18, -39, -37, 27, -2, 57, 53, 11, -5, 25, -26, 32, -2, -26,
+    12, 5, -4, -28, 9, -30, -48, -62, 58, -46, -42, -31, -10, 20, 27, -50,
+    -89, 1, -44, 20, -47, 62, -40, 75, 94, 71, -27, -49, -18, 37, -30, 3,
+    -8, -16, 7, -16, 21, 24, -63, -34, 38, -54, -15, 25, 2, -16, -4, -27,
+    -65, -23, 66, 16, -21, 83, 4, 86, 51, 29, -33, -52, 13, 30, -42, -14,
+    -28, -53, -25, -30, 20, -8, -32, 17, -32, -55, -38, 23, -48, 3, 22, -2,
+    -54, -12, 4, -54, 5, 53, -41, 2, -13, 8, -45, 46, -8, -6, 15, 28,
+    -64, -25, -42, -45, 13, -38, -33, -45, -4, -40, -19, -9, -38, 0, 13, 12,
+    15, 22, 13, -50, 18, 22, -34, -22, 27, -6, 24, 76, 11, -21, -23, -6,
+    -120, 56, -19, 3, 31, 20, 11, -30, 53, 1, -36, 38, 67, 19, -43, 25,
+    41, 62, 45, 9, 6, -75, 14, -39, -77, -50, 61, 45, 93, -48, -52, 5,
+    -44, 32, 16, -18, 50, 27, 20, -21, 58, -12, 29, 72, 64, 9, -56, 64,
+    -38, -36, -35, -21, -40, 27, 3, -25, -10, 30, -20, 21, 5, -36, 39, -11,
+    -49, 3, 50, -9, 23, -24, 9, -36, -14, -40, -24, -38, -4, 3, 48, -37,
+    -38, -18, -2, -15, -65, 73, -29, -73, -8, -10, -23, 58, -24, -4, -56, -2,
+    -28, -28, 2, -47, 4, -55, -50, -26, -18, 15, -8, -26, -61, -59, -11, -23,
+    25, -5, -101, -30, -16, 29, 14, -30, 5, -36, -4, 3, 47, -70, -62, 57,
+    -9, -19, -73, -77, -127, -55, -3, -67, 21, -29, 4, 8, -64, -77, 8, 10,
+    -14, -22, -31, -5, -4, 98, 11, 38, 92, 7, -18, -28, -61, 48, 13, -10,
+    38, -3, 34, 23, 24, -28, -37, -8, -8, -47, -7, -71, -22, 11, 24, 29,
+    -32, -31, 14, -20, -18, 78, -51, 4, 92, 12, -28, -9, -13, 11, 12, -16,
+    35, -42, -21, -25, -35, -16, -52, -28, -6, -41, -4, -73, -64, -8, 22, -9,
+    -16, -71, -6, -26, -40, 56, -8, 34, -2, -23, -22, 55, 0, -12, 22, -11,
+    -6, -32, 1, -23, -30, -37, -4, -25, 33, 3, -11, 10, -25, -13, -4, 20,
+    25, 31, -65, 38, 24, 0, -3, -20, 26, 3, 11, 36, 28, -19, -33, 5,
+    -63, 32, -11, 11, 52, 21, 9, -23, 48, 22, 8, -1, 48, -36, -55, -16,
+    22, 26, -22, 30, -4, -7, 12, 11, 38, 32, 5, 50, 6, -27, -33, -39,
+    7, 11, -3, 10, 46, 27, 24, -11, 67, 22, -8, -62, 23, -28, 14, -27,
+    -38, -23, -11, 33, 2, 70, -8, 25, -18, 30, -8, -50, -15, -18, -33, -25,
+    19, -25, 0, 36, 6, 18, 5, -10, -9, 16, -1, -100, 10, -8, 20, -13,
+    -16, -47, 44, 0, -44, 39, -48, 26, -25, 25, -3, -20, 15, -26, -9, 16,
+    22, -43, -7, 26, -1, 5, -42, -21, 4, -29, -37, -19, -30, -18, 29, 4,
+    7, -40, 27, 15, -12, -9, 6, -66, -61, -18, -5, -52, -28, -8, -30, 13,
+    32, 22, -13, 15, -36, -1, -40, 2, 37, 18, 4, -64, -42, 13, -46, 2,
+    -9, -32, -1, 41, -18, -2, 30, -91, -27, -20, 20, -1, -62, 30, 35, -19,
+    17, 14, 29, 8, -11, 28, 1, 18, -16, 31, 22, -127, 14, 24, 3, 18,
+    57, -53, -9, -12, -25, -127, 7, -71, -95, -58, 14, -14, -67, -25, -3, -24,
+    15, -28, -42, 35, -46, -40, 36, 47, 9, 26, 29, -52, 57, -40, -37, -64,
+    -30, -67, -34, 7, 15, -21, -2, -42, 1, -24, -3, -69, -46, 40, 26, 12,
+    30, -28, 40, 24, -45, 5, 22, 29, -65, 21, -17, -97, -5, 23, -11, 34,
+    -48, -14, -87, -48, -42, 13, -65, 6, -12, 24, -14, -18, -6, 1, 0, 9,
+    29, -11, 2, -40, -66, -50, -40, -84, -27, -57, -31, -16, -78, -40, 36, 7,
+    71, -10, 35, -41, -33, 41, 5, 31, 32, 0, -31, 25, -3, -35, -30, -16,
+    14, -61, -53, 8, -46, -20, 2, -3, -15, 32, -25, -82, 39, -43, 7, -29,
+    32, -39, -24, 17, -4, -21, 52, -10, -12, 7, 40, -62, -59, 56, 0, -56,
+    36, 4, -3, 19, -1, 29, 40, 27, 1, 13, -11, -119, -9, -2, -40, 18,
+    -79, 12, -42, -9, -10, 32, -56, 51, 45, 38, 8, -65, -61, 8, 27, -1,
+    41, -35, 26, 9, 22, 11, -26, -32, -87, -7, -40, -64, -14, 14, 66, -9,
+    35, -7, 48, -71, -40, 40, -43, -52, -17, -33, -9, 2, 22, -54, -23, 2,
+    5, -24, -49, -31, -15, -43, 11, -24, 14, -2, -49, -53, 56, -12, 21, -10,
+    -8, -19, -6, 7, -3, 24, 8, -53, 16, -67, 20, 3, -38, 25, -54, -51,
+    -53, 13, -47, 36, 29, 25, 25, 19, -1, 21, 16, -72, 9, 29, -82, 2,
+    -30, 34, -53, 7, 2, 12, 1, -28, -34, 30, 32, -16, 3, 26, 16, 20,
+    32, 17, 18, -41, 9, 3, 30, -28, -4, -3, 2, -52, -3, -12, 21, -30,
+    47, -40, -36, -28, 0, 12, 16, -75, -73, -10, -40, 27, -12, -24, -10, -26,
+    26, -17, -25, -28, 4, -34, -7, -12, -1, -35, -30, -121, 56, -25, -6, -37,
+    29, 17, -21, 7, -12, -115, 28, -86, -95, -74, 53, -23, -44, 1, -60, -47,
+    7, 19, -13, 28, 44, 4, 68, 38, 39, 13, -25, -127, 9, -1, -99, 13,
+    -39, 15, -65, 24, -34, -24, -28, -80, 2, 18, 22, -80, 30, 11, 33, 17,
+    45, 21, -10, -7, 11, 15, 38, -18, -40, 22, -27, -60, -37, -26, 16, 14,
+    -49, -6, -9, -16, -18, 37, -34, 22, 42, 44, 4, -20, 11, 5, -22, -17,
+    27, -29, 9, 23, -45, -17, -50, -31, 19, -34, -7, 53, -9, -12, 26, -24,
+    -81, 0, 81, -36, 0, 50, -14, -2, 25, 6, -2, -81, 15, 27, -15, 30,
+    -33, -22, -18, -16, -62, -12, 8, 18, -48, -6, -13, 100, -50, 15, -7, 56,
+    -23, -1, 48, 19, 24, -46, 5, -48, 0, -7, 12, 19, 44, 0, 4, 29,
+    -33, 52, -26, -18, 8, 5, 17, 26, 5, -1, 16, 116, 2, -48, -35, 15,
+    -1, 9, 81, 6, 24, 39, -17, 11, 39, -4, 23, -1, 58, 23, 2, -24,
+    -24, 22, 7, 17, 40, 32, 41, 1, -27, -13, -7, 39, 27, 39, 14, 33,
+    -17, 59, -2, -33, 24, -37, 13, -81, -18, -52, -36, -1, 44, -13, -2, 46,
+    -17, 16, -29, -24, -28, -15, -57, 5, -49, 1, 26, 78, -40, 26, -32, 72,
+    24, 29, -14, -21, 5, -31, -1, -80, 78, -51, -15, 14, 75, -38, 16, 4,
+    -48, 17, -55, -52, -15, -40, -51, -53, 17, -56, 14, 83, -24, -58, -87, -21,
+    26, -20, -11, 27, 18, -64, 25, -72, -84, -33, 20, -2, 2, 6, 12, -21,
+    -49, 4, 15, 10, 42, 14, 47, -7, 11, 24, -9, -58, 46, 17, -43, 15,
+    -27, -22, -44, 0, 8, 3, 20, -72, -57, -15, 13, -45, 22, 48, 3, 33,
+    36, 19, 15, 30, 6, -14, 15, -17, 6, 7, 6, -127, -8, -15, 4, 49,
+    -62, -11, -31, -16, -9, -20, -31, -18, -48, -18, -25, -28, -38, -31, 27, 4,
+    -17, -8, -17, 13, 9, -7, -59, -38, -24, -2, 18, -47, 3, -15, 28, 1,
+    53, -18, 28, 13, -4, 4, -31, -54, -23, -51, 1, 25, 8, -13, -21, 9,
+    -74, -1, -31, 3, -21, -14, 22, -7, 60, 25, -16, -27, 46, -57, -48, -68,
+    36, -50, -53, 22, 4, 3, 41, 11, 27, 12, 29, -41, -5, 52, -13, 0,
+    10, -10, -8, 52, 0, 21, 13, 38, 5, -5, 26, -26, -21, -18, -31, -9,
+    -37, 14, 34, -18, -26, 45, -7, -5, 14, 9, -21, -48, -28, -1, 25, -12,
+    -17, 12, 8, 12, -2, 13, 1, -27, -24, -18, -14, 1, -22, 32, 36, -21,
+    -31, -13, 62, -60, -21, 10, -68, 40, 7, -12, -61, 25, -30, 3, 4, -26,
+    -33, -54, -40, 3, -20, -1, -49, -20, -30, -36, -48, 64, -10, -12, 22, -36,
+    -11, 0, 57, 13, -2, -51, 0, 9, -54, -9, 21, -26, 0, 14, -27, -2,
+    -14, -11, -26, 28, -9, 14, -9, -7, 2, -9, 21, 3, -20, 29, -56, 18,
+    21, 41, 3, 3, 27, -37, 7, -21, -19, 19, 26, 5, 44, -6, 21, 2,
+    -3, 45, 5, -24, 31, -18, 0, 0, -7, 8, 13, -49, 28, -14, -29, 15,
+    -74, -90, 5, 18, -3, 29, -11, -23, -1, -24, 41, -80, -52, 30, -15, -59,
+    -98, -26, -55, 34, -19, -7, 18, 9, -28, 50, 24, 117, 15, -19, -47, -39,
+    -75, 25, 23, 24, 44, 30, -36, -17, -13, -42, 10, -87, 2, -6, -6, 32,
+    -5, -13, -40, 11, -12, 2, 0, 39, -34, 4, 14, 61, 38, 45, -86, 55,
+    19, 5, 5, 13, 47, -22, -28, -8, 51, -72, 22, 35, 54, -29, -14, 1,
+    44, 10, 0, 14, -11, 0, -45, -36, 23, 37, -6, -77, -49, -35, -40, 21,
+    -58, 47, 127, -37, -3, -17, 2, 8, -48, -9, -16, -75, 69, 36, -44, -14,
+    -61, 10, -34, -21, -5, 19, -26, -3, -78, 42, 23, 107, 31, 40, -29, 91,
+    2, 67, 36, -6, 53, -47, 20, -98, -87, -43, -41, -9, 116, -61, 8, 72,
+    -17, 66, -20, 23, -40, 24, -44, -9, -16, -43, 28, 19, -39, -3, -87, 94,
+    45, 21, -101, 39, -5, -65, -37, -118, 13, 10, 45, 72, -30, 7, 15, 15,
+    1, 48, 15, -20, -25, -27, 25, -42, 47, -9, 3, 101, 27, -25, -26, -29,
+    -59, 29, -28, -27, 43, -47, -3, -62, -38, -62, -8, -39, 77, 20, 48, 31,
+    14, 20, 17, -39, -77, 26, -60, 28, -15, 25, 52, 84, -83, 19, -89, 123,
+    11, 13, -72, -65, 13, -56, -87, -51, 19, -2, -39, 10, -2, -70, 75, 67,
+    -11, 3, -1, -17, -26, -50, -58, -9, 58, -13, -18, 67, -9, -25, -18, 23,
+    2, -59, -66, -13, -89, -54, -38, -36, 31, -68, -47, 58, -101, -9, -59, -46,
+    -56, -61, -84, -31, -37, -66, 3, -29, 45, 0, -66, 69, -39, -44, -49, -7,
+    -24, -11, -8, -9, 0, 66, -28, -12, -10, 39, -26, -31, 37, -23, 15, -4,
+    15, 0, 5, -37, -30, -34, 5, -82, -40, -16, -19, -81, -26, 22, 36, -20,
+    9, 13, 40, -3, -14, 24, 5, 14, -39, 2, 7, 11, -11, -20, -5, -14,
+    2, -35, -47, -23, -20, -36, 16, -20, 49, -37, -22, 5, 23, -48, 28, -41,
+    -10, 2, -9, -38, -38, -24, 6, -37, -41, -1, -15, 23, -28, 8, -25, -26,
+    -29, 35, -6, -18, 29, -34, -1, 2, 4, -42, -40, 1, 23, -2, -48, -1,
+    29, 32, -41, 29, 10, -2, 21, 27, 80, 17, 32, 2, -3, 41, 26, -8,
+    60, -18, 15, -10, 38, -16, -1, -34, 29, -13, -25, -127, 23, 28, 6, -6,
+    -31, -47, 23, 24, -23, 40, 13, 7, 78, 47, -18, -49, -20, 21, 19, -54,
+    0, -38, 24, 13, 17, -35, 1, -17, -35, -13, -29, -10, 19, 9, 52, -58,
+    -33, -22, 10, 22, -41, 42, 12, 15, 34, 14, -22, 12, -16, -23, -25, -6,
+    -26, 4, 1, -8, 14, -19, -12, -16, -8, 16, -22, -16, -21, 5, 3, 14,
+    27, 2, -55, -8, -15, 47, 19, -90, 33, -37, 17, 30, -2, 28, -1, -24,
+    -72, 19, -1, -4, 57, 4, 52, 3, 71, 15, -39, -64, 27, -39, -34, -38,
+    -12, -18, -62, 18, -43, 36, 16, -54, 22, 12, 22, 7, 6, 2, -16, -5,
+    17, -23, 19, 17, 69, -21, -12, 11, 32, 11, 7, -7, 20, -4, -35, 35,
+    5, -32, -38, 1, 7, 71, 3, -65, 40, -25, -3, -1, 33, 8, -11, -28,
+    -6, 0, -16, 13, 25, 1, -6, -10, -9, 25, 13, -38, 8, 14, 19, 23,
+    -52, -50, 45, 2, -40, 64, -74, 33, 92, 85, -71, 35, -22, -23, 57, -21,
+    -22, -55, -43, -55, 32, 34, -57, -32, -23, -18, -65, 92, -45, -3, -8, -82,
+    -116, -11, 127, 1, 2, -2, -36, 16, 7, -7, -41, -83, 14, -25, 14, -32,
+    -105, -65, -48, 25, -18, 10, -12, 6, -99, -17, -32, 46, -54, 49, -50, -6,
+    -25, 92, 64, 18, 81, -74, 9, -15, 5, -61, -36, -40, 115, -35, -28, 40,
+    -44, 56, -15, 18, 57, -20, -8, 43, -49, -12, 34, -59, -16, 19, -64, 21,
+    -3, 14, 107, 22, 48, -67, -7, 89, -12, 20, 26, -39, 35, -36, -52, -13,
+    -44, 38, -11, -2, 0, -20, -29, 29, -21, -28, -42, 76, -2, 3, 36, 42,
+    -38, 26, -2, -34, 14, -46, 25, -74, -59, -19, 32, -58, 26, -39, -81, 23,
+    -58, 24, -29, 6, -17, -1, -55, 20, -8, 35, -39, 15, 28, 3, -57, -31,
+    -63, 48, -53, 30, 37, -21, -28, -82, 5, -68, -7, -33, 26, 22, -33, 50,
+    32, 2, -15, -45, -40, -36, 9, 22, -46, 25, -8, -32, 1, -3, -35, 1,
+    57, -31, -4, 31, 28, 27, 66, -43, 49, -73, 32, 75, -27, 21, -1, -45,
+    -85, -10, -12, 40, 18, -23, 51, 53, 103, 51, 13, 63, 20, -22, -22, 40,
+    6, -32, -67, -7, -29, -41, -2, -55, -51, -112, 24, 1, -57, -20, -44, 34,
+    -21, 13, 12, -28, 2, -29, -33, -15, -5, 37, -29, -70, -26, 14, -45, 58,
+    -18, -2, -104, -22, -19, -27, -3, -94, -39, -29, 27, -4, 22, -3, 28, 2,
+    41, -35, -18, -10, -31, 7, 16, -40, -4, 1, 34, -62, -51, -41, -46, -10,
+    -32, -54, 16, -69, -55, 20, -12, 48, -14, 60, -55, -65, -62, -52, -36, -62,
+    42, -45, -13, -36, 8, 9, -46, -32, -54, 12, -59, 33, 5, -23, 25, -30,
+    -53, -30, -4, -37, 8, 0, 43, -10, -25, -18, -5, -90, -22, -11, -78, -21,
+    -12, -10, -47, 45, -70, 35, -21, 50, -39, -16, -15, -5, -27, -20, -36, -7,
+    -102, 37, 57, 8, 17, 1, -27, -12, 32, -5, 4, -59, 27, 43, 15, 9,
+    -45, 16, -19, 14, 0, 47, -30, -24, -79, -15, -16, 53, -17, 13, -33, 4,
+    -22, -51, 71, 23, -33, 19, -74, 24, -72, 25, -55, -50, 13, -44, 22, 12,
+    -18, -29, 14, -25, 15, 22, -8, -42, -53, 17, -13, 14, -13, 12, -5, -31,
+    -73, -21, 62, -17, -11, -4, 3, 24, -38, 0, -42, -59, 24, 45, -43, -53,
+    -23, -24, 0, 3, -10, -15, -28, 20, -127, 40, 32, 18, 3, 33, -32, -7,
+    -25, 57, 70, 28, 0, -19, -12, -21, -72, -79, -51, 23, 95, -25, 15, 16,
+    -55, 17, -28, -27, 23, 0, -4, -31, 8, 2, 6, 16, -32, 31, -63, -12,
+    6, -10, 54, -10, -6, -49, -47, -30, -26, -46, -13, 33, 24, 14, -27, 31,
+    -59, 10, 15, 17, -6, -12, -32, -37, -33, 26, 12, 45, -54, 5, -50, -52,
+    -19, -79, 48, -34, 27, -70, 0, -78, 15, -120, 6, -58, -12, 51, -3, -35,
+    -38, -19, -31, -21, 6, 23, 1, 39, -41, 3, -3, -42, -51, 46, -112, 70,
+    -3, 33, -110, -57, -2, 37, -72, -40, 45, 12, -38, 20, 52, -40, 47, 71,
+    47, 44, -7, -55, -79, -14, -49, -27, -17, -54, -16, -75, -14, 3, 15, -6,
+    68, -36, -32, -21, 47, 83, 19, 10, 75, -20, 42, 70, 35, 4, 7, 18,
+    -24, -12, -56, -15, 10, 3, -4, -39, 20, 0, 42, 26, -3, -21, -24, 54,
+    45, -8, -53, 32, -20, 11, 4, -47, 21, 12, 30, 39, -19, 0, 16, -8,
+    1, -19, -10, 20, 31, 10, 44, -31, 87, -5, -27, -9, 35, -29, 17, -38,
+    3, -44, -11, 49, 12, -35, 24, -49, -6, 15, 48, -103, -42, 33, 11, -12,
+    9, -9, 35, -25, 18, 41, 3, 16, -56, 7, -38, -16, -4, 23, -18, 6,
+    51, -60, -35, 7, -54, -1, -46, -32, 43, -60, 21, 45, -56, 3, 5, 1,
+    7, -15, -31, 9, 17, -18, 19, -37, 39, 16, -29, 57, -13, -9, 17, -3,
+    -10, -43, -25, 11, -37, -15, 10, -27, -15, -17, 15, 6, -89, 20, -2, -64,
+    -74, -67, -60, 27, -8, -4, -25, 21, -28, 16, -2, 12, -23, -39, -7, -43,
+    -31, 17, -35, -4, 35, -48, 5, -58, -4, -42, -6, -99, 17, 5, 30, 33,
+    -12, -2, 34, -23, 7, 19, 12, 6, -63, -4, -29, -58, -41, 7, -62, 54,
+    -43, -56, 18, -53, -46, -38, -51, -12, -56, 23, -35, -12, -72, -43, -45, -3,
+    40, -38, 4, -36, -17, -31, -72, -45, -2, -25, -46, 49, -35, -24, -8, -33,
+    -37, -16, 33, 3, 23, -57, 53, -49, -88, 15, -7, -87, -31, 24, -1, -72,
+    -44, -50, -57, -8, 7, -3, 10, -7, -102, 26, 2, 62, -12, 23, -2, -22,
+    -55, 35, 2, -4, 25, -96, 50, -127, -112, -50, -13, -108, -35, 45, 32, 12,
+    39, 0, 36, 21, 5, 25, 3, -10, -71, 33, -11, -44, -2, -8, -42, 57,
+    -18, 21, -48, -26, -72, -6, 9, -21, 21, 21, 14, -51, -13, -4, 13, 9,
+    41, 2, -20, -56, -69, -39, 2, 13, -26, -20, -6, 16, -49, -88, 1, 12,
+    19, -11, -7, -38, -51, 12, -51, 2, -23, 6, -45, 8, 24, -29, -26, -21,
+    -24, -35, -47, 39, -13, -37, -25, 4, 16, 24, -16, 16, 32, -53, 27, -37,
+    -11, -46, 28, 2, 9, 10, 61, 34, 8, 6, 60, -71, -67, -9, 18, -22,
+    -27, -44, 9, 23, 19, 26, 40, 29, -29, 52, 11, -79, 20, -21, -71, 3,
+    -75, -24, -36, -68, 2, -40, -4, -31, -60, 33, -36, -17, 7, -20, -19, 21,
+    -8, 0, -10, -32, -34, -28, -47, -41, -49, -47, -30, 11, -12, -27, 29, -21,
+    -25, -41, 58, -37, -72, -14, -41, -8, -11, 51, -50, -62, -43, -36, 12, -37,
+    -39, -87, 3, -23, -22, 4, -52, 13, -99, 15, -53, 85, -63, -16, 48, 19,
+    -21, -12, 29, -27, 40, 7, 52, 14, -46, 7, 10, -91, 74, -20, -79, -10,
+    29, 31, -38, -6, -20, 30, -38, 65, -60, 43, 20, -49, 9, 39, -40, 42,
+    -32, 7, 3, 16, -21, 17, -2, 49, 68, 48, -6, -17, 28, -30, 27, -6,
+    26, -45, -8, 13, -40, -11, -36, 30, -35, 10, -49, 55, -35, -3, 48, -77,
+    -69, -21, 49, 19, -40, -15, -16, 30, 24, 20, -42, -73, -49, -7, -33, -51,
+    -73, -55, -19, 11, -2, 23, -28, 37, -125, 0, 24, 28, 7, 0, 2, -11,
+    -98, 38, 39, -50, 48, -121, -2, -61, -111, -73, -18, -51, 14, -12, -43, 66,
+    15, 9, -6, -13, -69, 37, -92, -21, -127, -40, -12, -50, -30, 21, -82, 90,
+    -32, -36, -22, -7, 11, -101, 23, -86, -99, 10, 33, -127, -48, 11, 32, -4,
+    20, -32, -17, 12, -6, 4, 15, 7, -80, 3, 26, 28, 18, 22, -35, 29,
+    -41, 45, 26, -9, -20, -63, -53, -55, -51, -2, -28, -27, 58, 20, 50, 35,
+    17, -16, 32, 6, -5, 12, 26, -31, -26, -20, 2, -12, -2, 20, 18, 13,
+    69, 3, 31, -24, 3, -38, 11, -40, -26, -47, 6, 63, 63, -55, -8, 4,
+    39, -2, -6, -5, -13, -16, -11, 11, 31, 17, -17, 17, 5, -32, -54, 53,
+    -5, -57, -16, 19, 5, -80, 25, -59, -45, -37, 38, -63, -32, -4, -18, -52,
+    -4, -28, -17, -4, 0, -24, -1, -2, -41, 14, 4, -45, 20, -22, -92, -4,
+    -38, -22, -14, 1, -22, -15, -3, 21, -2, 24, 4, -61, 19, 42, 43, 20,
+    23, 16, 4, -23, -42, 32, -2, -18, -49, -21, 7, -56, -37, 37, 27, 43,
+    -24, -41, 1, -19, -18, 13, -30, 32, 40, 48, -36, -20, 22, -4, -16, -20,
+    64, 6, 36, -8, -20, -7, -14, 1, -4, -41, -12, -61, -8, -12, 33, 23,
+    -5, -20, -10, 7, 0, -98, 1, -81, -67, -54, 35, -43, -20, 9, -3, -24,
+    -49, -36, 0, 35, 12, -7, 42, 41, -51, -6, 6, -57, 19, 21, -68, 1,
+    -4, -7, 1, 1, 15, -42, -9, -16, -10, 24, 9, -19, -46, 19, 43, 8,
+    14, -25, 18, -8, -2, 39, 9, -22, -64, 30, 29, -89, 30, 34, 26, 16,
+    -10, 16, -15, 12, 3, 39, -19, 17, 4, 22, 26, -30, -22, -5, 8, -13,
+    36, -6, 5, 3, -4, 30, -7, -32, -58, -23, 3, -92, 19, 32, 38, -21,
+    103, -36, -17, -34, -59, 4, -38, 12, -51, -32, -21, 52, 18, 30, 26, -37,
+    12, -35, -44, 22, 50, -22, 49, -15, 65, 32, -2, -18, 0, 14, -13, -12,
+    -4, -28, 15, 0, 12, 1, -9, -11, -13, 27, 30, -38, -43, -4, -33, -31,
+    17, 12, 40, 8, 39, 46, 4, -5, 22, -28, -23, -5, -34, 21, 33, -26,
+    -1, -6, -7, -43, -42, 23, -7, 18, -45, 44, -33, 1, -26, 12, 2, -35,
+    3, -33, -34, 29, 18, 37, 20, 4, -23, -16, -45, -26, 15, 16, -30, -2,
+    75, -41, 78, 0, -11, -9, -36, 33, -17, -17, -32, -93, -26, 26, 27, -88,
+    -42, -37, 0, 34, -11, -32, 30, 6, 42, -6, -25, -14, 47, 23, -18, 12,
+    14, -28, 23, 20, -24, -63, 7, -76, -63, -12, 7, -101, -39, 20, -43, -36,
+    23, 27, -22, 10, 23, 44, -17, 9, -32, 42, -2, -73, -21, -23, 3, -8,
+    -41, -20, 1, -17, -13, -82, 33, -8, -44, -33, -23, -22, -38, 22, -22, -40,
+    -48, 9, 9, -1, -37, -26, 3, 25, -57, 24, -12, -73, -2, -2, 13, -23,
+    54, -23, 52, -2, -29, 0, 5, 9, -31, -7, 22, 15, -14, 1, -4, 10,
+    26, 1, -38, 10, 54, 12, 16, 2, 39, -43, -33, -83, 8, -27, 16, 3,
+    5, -63, -48, -2, 32, -33, 38, -120, -3, -6, 36, -35, -1, 52, -10, 27,
+    15, -10, 9, 28, 4, 1, 11, 1, -14, -7, -40, -34, -37, 9, -24, 66,
+    -71, -17, -59, 34, 6, -51, 33, -49, -53, -12, 12, -46, -77, 12, -42, 23,
+    -54, -47, -49, 3, -28, -29, -7, 12, -38, -19, -12, -127, -67, 2, -37, -1,
+    -48, -29, -46, -13, -24, 6, -44, -74, -17, -2, 19, -46, -16, -36, -55, -63,
+    -18, -56, -15, -9, -61, -12, -19, 12, -49, -7, -32, 26, -49, -10, -20, -106,
+    18, -16, 56, 17, -36, -22, 62, -70, -24, -11, 32, -36, 12, -40, 24, -21,
+    27, 22, -12, 7, 5, 8, 60, 39, -24, 33, 10, 77, 47, 20, -33, 3,
+    -27, 6, -15, 29, -12, -35, -13, 3, 6, 48, -36, 15, 28, 23, -10, 49,
+    34, 21, -19, 18, 42, 44, 35, -29, -22, -27, -30, -27, 2, 3, 35, 83,
+    -39, -21, 11, 5, -28, -77, -41, -39, -25, 2, -7, -58, -40, -8, -59, -23,
+    -9, -24, -11, -24, -14, -14, -8, -46, -25, 7, -4, 25, 14, -2, -46, 15,
+    -9, -8, 29, -20, -17, -28, 33, -46, -44, -5, 32, -42, -8, -19, -21, 9,
+    11, 19, 18, -14, 21, -19, 23, -23, -31, -30, -7, 3, 24, -29, -53, 56,
+    -15, 19, -88, -30, 11, 59, -37, -53, -6, 35, -40, -11, 26, 54, 26, -9,
+    28, 16, -26, -7, -23, 33, 18, -6, 38, -17, -9, 1, 0, 31, 24, 47,
+    -67, -3, -34, -2, -50, -73, -34, -53, -53, -38, -57, -6, -38, -26, -36, -29,
+    -8, 10, -1, -43, -37, -21, -21, 1, -57, -40, -40, -11, 5, -19, -52, -4,
+    -32, -65, 8, 14, 14, -127, -2, -104, -94, -29, 2, -30, -20, 30, -23, -13,
+    -33, 1, -24, 3, -43, -11, 7, 11, -87, -31, 24, -59, 27, -2, -68, 53,
+    -63, -19, -49, -56, -44, -90, -17, -106, -69, 30, -62, -45, -5, -26, 40, 16,
+    18, -15, 6, -34, -35, -2, 10, -42, -20, -17, -55, -35, -42, -3, 22, 58,
+    -22, 16, -18, 7, -7, 81, 4, 45, 45, 32, -40, -34, 7, -9, -14, -33,
+    52, 13, 31, -30, 20, 19, -46, -32, 18, -14, -33, -60, -39, -14, 16, -34,
+    21, -8, 25, -13, -20, 90, -67, 19, 15, 7, -44, 31, 31, -6, -9, -11,
+    12, -31, 16, -62, -44, -30, -27, -44, 15, -11, -23, -81, 1, -21, 37, -42,
+    98, 24, 53, 14, 1, 16, 33, -70, -23, -38, 5, 70, 19, -56, -46, -38,
+    -65, 31, -72, -32, -48, -9, 31, -1, 53, 17, 14, -16, 62, -70, -17, -29,
+    45, -26, -62, 43, -3, -109, 13, -92, -57, -35, -8, -24, -32, 12, -11, -14,
+    -20, -2, -8, 16, 35, 8, 2, 7, 25, 2, 10, 24, 29, 6, -16, -32,
+    -95, -29, -13, 55, -4, 42, 9, -4, 34, 33, 24, -127, -22, 30, 15, -13,
+    77, -27, 4, 58, 29, 32, -20, -6, -69, -35, 0, 9, -23, 1, 60, 30,
+    -103, -67, 30, -47, -18, 62, -24, 28, 40, 20, -54, -49, -33, -4, -9, -55,
+    71, -35, 17, -27, -29, -32, -77, -28, -31, -45, -38, -30, -65, 29, 17, -24,
+    -6, -2, 13, -37, -7, 14, -4, -35, -55, -48, -6, -16, 10, -38, -15, -3,
+    -14, 12, -3, -23, -61, -8, 21, 7, -11, 1, -3, -32, 23, -13, -31, -39,
+    35, 10, -20, 35, 28, -96, 42, -106, -60, -41, 12, -11, -34, 27, 0, -10,
+    27, 28, -7, -5, 31, 10, 40, 31, -7, 11, 0, -52, -12, 17, -48, 39,
+    -20, -5, -44, 0, -15, -20, 10, -60, -28, 11, 48, -50, -3, 31, 13, -31,
+    38, -19, 40, 50, 54, 37, 15, -1, -4, 36, 39, -48, 33, 31, 2, 67,
+    19, 24, -26, -7, -4, -70, 26, -22, -53, -13, -11, 21, 25, -8, 3, 31,
+    32, -28, -8, -11, -9, -5, 6, -13, -41, -41, -20, 21, -25, 3, -7, -42,
+    63, -40, -20, -8, 12, -53, 25, -60, -102, -52, 3, -28, -20, -28, -49, -69,
+    -49, -31, -2, -15, 13, 6, 50, 19, 11, -4, 17, -108, 4, -14, -38, 33,
+    -15, -68, -20, 31, -12, -121, 18, -103, -93, -48, 6, -127, -41, 16, -6, -5,
+    42, 4, 44, 4, -23, 2, 18, 40, -92, 39, 2, -82, -25, 35, -42, 42,
+    -24, -35, 2, 12, -18, -34, -13, -43, -13, -2, -42, 22, -42, -27, 32, 7,
+    0, 5, -12, -5, -75, -27, -49, -37, -33, 14, -31, -36, 9, -45, 10, -56,
+    37, -39, -25, 12, -22, 15, -15, 25, -14, -48, -32, -38, -25, 24, -44, -5,
+    -57, 4, 3, 27, -46, 2, 23, 1, -13, 15, 16, -61, 14, -42, -24, -11,
+    -39, -22, -4, 18, 13, -22, 13, -28, 20, -30, 16, -97, -56, 45, -32, 9,
+    -1, -4, -10, 13, -26, 1, -8, 54, -89, 21, 23, -97, -25, 41, -89, 36,
+    -9, -33, -2, 31, 15, 67, 2, 51, 103, 50, -23, -57, -96, -16, 2, -81,
+    61, -56, 21, 10, 43, -13, 1, -1, -34, -10, 1, -88, 12, 35, 37, -26,
+    15, -5, 55, -20, 2, 34, -38, 74, 40, 51, -58, -94, -30, -21, 17, -29,
+    11, -31, -9, -32, 40, 27, 15, 20, -38, 25, 17, -42, 8, 2, 59, -53,
+    4, -17, 59, 34, -2, -38, 29, -34, -9, -50, -30, -76, -41, 40, -16, -36,
+    -32, 30, -10, 40, 27, 36, 39, 55, -37, 48, -14, -121, 10, 40, -56, 0,
+    67, 38, 12, 25, 1, 15, 49, 40, 49, 15, 35, -18, -22, -15, 25, -13,
+    -40, 4, -11, 44, -26, -14, 67, 20, 45, 37, 28, -126, 13, -23, 6, -3,
+    79, 58, -3, -6, 53, 34, 47, -1, 52, -32, -2, 31, 61, 22, 51, 36,
+    -35, 59, 0, 8, -3, 45, 29, 4, 44, 25, 9, -42, 47, -7, -14, -1,
+    73, 43, -55, 9, -6, -30, -7, -91, 67, -82, 32, 25, 44, -26, -2, 25,
+    -46, 32, -2, 15, -69, 11, 33, -49, 82, 28, -25, -13, 0, -8, -67, 1,
+    73, -32, -32, -46, -15, 77, -49, 7, -4, -62, 35, 82, 20, -33, -38, -36,
+    -46, 41, -4, -37, 10, -43, 19, -61, 64, 22, 2, -66, -9, -31, -26, -4,
+    36, -27, -85, -23, -11, 14, -48, 74, 74, -58, -23, 46, -8, 6, -29, -11,
+    -94, -6, -67, -22, -24, -35, -21, -53, 80, -31, 5, 123, -48, -21, -23, -64,
+    -67, -77, 20, -58, -39, 36, -50, 28, 87, -19, -49, -33, -19, 12, 4, 6,
+    -43, -43, -2, -46, -35, 21, -52, -2, -15, -67, 5, 95, -80, -8, -48, -42,
+    -127, -69, -41, -30, -28, -4, -76, 33, -22, 43, -72, -32, -85, -42, -42, -68,
+    -11, -53, -39, -10, -6, -41, -75, -75, -48, -75, -51, 14, -84, 14, 16, -25,
+    -80, -55, 46, -42, -52, 5, 7, -13, -38, 25, -25, -111, -64, 3, -35, 3,
+    -36, -105, -26, 3, -10, 27, -20, 22, -69, -13, -49, 88, -14, -39, -23, -90,
+    -85, 28, 32, 24, 6, -31, -16, 26, -11, 9, -33, -58, 9, 42, 7, 25,
+    18, -33, 2, 24, 57, 26, -42, 1, -98, 21, -17, 77, 9, 64, -3, 71,
+    -62, -91, 28, -37, -94, 45, 4, 35, 26, 70, 1, 36, -68, 21, -22, -14,
+    -10, -57, -30, -41, -23, -13, -26, -16, 81, -47, -58, 37, -13, 15, -23, -43,
+    -76, -18, 60, 1, -68, 70, -67, 94, 102, 84, 20, -59, -66, 20, -6, -54,
+    -55, -42, 15, -2, 24, 56, 27, -26, -54, -43, -36, 120, 18, 28, 1, 18,
+    1, 28, 21, 10, -14, -2, 34, -26, 61, -55, -79, 19, -3, -9, 16, 0,
+    -2, -7, -29, 4, 28, 46, -46, 33, -103, -5, 1, -11, -28, 20, 11, 32,
+    62, -1, 92, -2, 15, 45, 9, 11, 0, 23, -10, 70, 55, -25, -5, -39,
+    -29, 19, 37, -53, 4, 8, -27, -53, -2, -43, -12, -1, 37, 36, 22, -18,
+    77, 28, 16, -35, 12, 4, -5, -24, -58, -62, 37, 55, 78, -44, -76, 32,
+    -87, 20, -1, -24, 74, -30, 17, 33, 22, -12, 14, -45, 21, 0, 14, 61,
+    63, 69, -13, 12, 14, -127, 25, -114, 22, -35, 15, 26, 32, -10, -42, 47,
+    -94, 53, -74, -12, -5, -35, 28, -28, 73, 27, 3, 10, 8, 26, -110, 38,
+    29, -39, -53, 3, -6, 25, 20, -46, 3, -83, -21, 43, -29, -4, 2, 20,
+    -52, 3, -31, -33, -17, -64, 21, 0, 44, -2, -21, -124, -29, -41, -51, -26,
+    66, -29, -52, 1, -30, 15, -8, -18, 83, -109, 34, 63, -6, -6, 0, -21,
+    -93, -10, -10, 23, -40, 1, 35, -21, 45, 2, -36, 25, -14, -39, -116, -12,
+    -48, -60, -115, -15, -48, -9, -68, -16, 34, -92, -22, -3, -77, -37, -6, -33,
+    -78, -5, -69, -89, -62, -88, -68, -97, -14, -17, -40, 1, -20, -74, -52, 34,
+    30, -49, -17, -53, 0, 64, -44, 39, -17, 10, -50, 24, -30, -13, -31, -50,
+    -14, -38, -24, -46, 11, 11, -16, -85, 1, -61, -44, -37, 20, -46, -11, -66,
+    36, 16, -51, -14, 29, 48, 7, -20, -33, -54, -22, 34, -10, -58, -68, -35,
+    -3, 11, -7, 19, -78, -71, 48, -10, 24, -30, 36, -127, 26, -64, -65, -84,
+    75, -31, -58, 69, -13, -9, 38, -50, 8, -57, 37, 67, -57, 15, -23, -69,
+    13, -5, 23, 24, 22, -15, 48, 17, 52, -14, 33, -44, 42, 10, -56, -77,
+    -92, 2, -41, 1, -10, 30, -49, 62, 32, 5, -52, -53, -38, -3, 0, -71,
+    -4, -67, 10, 36, 0, 8, -37, -38, -93, 2, -1, 97, -3, 26, -5, -18,
+    -97, -19, 25, -31, -90, 61, -40, 63, 77, 63, -45, -89, 10, 14, 6, -57,
+    0, -92, -9, -8, 9, -7, -66, -48, -21, 11, -30, 89, -67, -1, 19, -43,
+    1, -6, 10, -53, -1, 67, -29, 15, -2, -33, -30, 15, -12, 13, -33, -95,
+    -29, 0, -46, 14, 3, -23, -46, -16, 34, -11, -48, -84, -46, 18, -34, -24,
+    19, 10, 10, 46, -19, 3, -5, -32, -18, -4, -12, -31, -20, 3, 31, -41,
+    1, -31, 15, 27, 12, 5, -17, 13, 12, 11, 5, -5, 3, 31, 32, 17,
+    -62, 1, 28, 25, 14, -27, 46, -12, 26, 6, 2, -53, 51, 20, 35, 20,
+    47, 0, 36, 41, 67, 43, 24, 37, -57, 20, 27, 112, 3, 32, 53, 24,
+    -55, 4, 10, 13, 32, -10, -11, -2, 30, 44, -34, -89, 69, 25, 37, 29,
+    57, -18, 4, -13, 20, 20, -51, 2, -103, 17, -18, 53, -71, 57, 32, 63,
+    -94, -44, -32, 1, -4, 43, -16, -49, -8, -10, -36, -100, -9, -19, -12, -23,
+    44, -31, 28, -4, -6, -19, -17, -26, -114, -7, -21, -72, -63, 8, -20, 17,
+    -16, 13, 15, -15, -5, -21, -42, -12, -32, -19, -35, -19, 43, 7, 28, 10,
+    44, -3, -33, -58, -15, -12, -49, -77, -38, -30, -23, -57, -63, 20, 10, 34,
+    82, 33, -20, -20, 21, -10, 25, -32, -35, -44, -15, 60, 30, -42, -50, -23,
+    -17, 14, -69, -7, -12, -52, 11, -40, 51, -22, -7, 6, 9, -62, -6, 2,
+    65, -14, -13, 43, 3, -53, 50, -73, 30, 17, 47, -2, -52, -12, -5, -51,
+    -45, 35, 10, 4, -6, -8, 49, -29, 17, -10, 42, -127, 36, -18, -63, 36,
+    -41, -5, -52, 33, -2, 52, -37, 46, 85, 32, -10, -88, -12, 64, 53, 7,
+    49, -2, 40, -26, 28, 33, 21, -39, -125, 7, -44, -36, 10, 32, 6, 10,
+    -72, -18, 27, -51, -28, 41, -43, 8, 63, 60, -64, -81, 23, -19, 27, 0,
+    14, -49, 38, -41, -15, 9, -25, -15, -89, -53, -54, -3, -57, 5, 17, 10,
+    -14, -25, 46, -22, -22, 72, -1, -17, 23, -9, 18, 30, 27, -28, -27, 17,
+    -94, 45, -50, -12, 8, 2, 49, -11, 18, 21, -30, -92, 18, 17, -68, -19,
+    24, 18, -35, 3, 15, -22, 4, -73, -46, -20, 35, 23, -24, 21, 3, -43,
+    9, 26, 5, -30, 39, -1, 42, -36, 17, 35, -32, -71, 20, -10, -69, -39,
+    26, 14, -73, 34, 39, 33, 12, -52, 55, 38, 12, -29, 39, 46, -21, 12,
+    22, 3, 24, 31, 55, 41, -24, 4, 26, 8, -1, -42, 13, 23, 10, 27,
+    68, 3, 55, 5, 14, 57, -21, -25, 5, -87, 21, 51, -36, -39, -36, -74,
+    -52, -10, -76, -6, -50, -62, 25, -29, 44, -17, -37, -63, 51, -71, -34, -74,
+    36, -16, -25, 4, -4, -43, 39, -71, -72, -86, -6, 42, -9, -32, -28, -45,
+    -68, 5, -55, -2, 31, -40, 11, -16, 16, 18, 16, 41, 30, -13, -48, -54,
+    47, -20, -42, 8, 48, -74, 61, -61, -85, 13, 6, -5, -23, -28, -13, 29,
+    -31, -28, 7, 21, 76, 29, 7, 46, -22, 10, 35, 64, 80, -27, -48, -38,
+    -127, -88, 31, 13, -68, 122, -10, 47, 50, 40, -64, -94, -9, 10, -6, -49,
+    35, -92, 49, 30, 5, -17, -76, 21, -82, -31, -29, -57, -49, 43, 74, 6,
+    -38, -46, 55, -31, -33, 21, -39, 25, 39, 13, -69, -36, -25, -14, -10, -50,
+    28, -69, 20, 2, -27, 1, -48, -63, -14, -22, 0, -73, -57, -16, -4, -22,
+    8, -77, -40, 22, -35, -5, 13, -56, -29, -31, 12, -77, -21, -32, -2, 39,
+    -23, 4, -37, -17, -27, -14, 20, 21, -32, 39, -1, -23, 26, -38, -44, -32,
+    61, 34, -3, 58, 47, -31, 35, -59, -32, 33, 31, 11, -14, 14, 24, -3,
+    64, 59, 49, 40, 24, 41, 33, 44, 20, 27, 41, -15, 92, 46, 40, 67,
+    -46, -2, -24, 46, 14, 29, -45, -61, -52, 26, 29, -44, -35, 9, 24, -11,
+    80, 30, 61, -27, 25, 6, 24, -13, -45, -11, -17, -32, 25, 24, 60, 46,
+    -71, -3, 38, -12, -2, 39, -2, -31, -36, 9, -35, -77, -17, -30, -39, -37,
+    -4, -42, 1, -13, -2, -2, 27, -11, -109, -10, 27, 3, -1, -20, -28, 23,
+    -5, -18, -81, 24, 11, -26, -6, 19, 0, 27, -20, -11, 8, -25, 40, 7,
+    -37, 23, -10, -11, -51, 12, -59, -34, -3, 5, -31, 36, -27, -2, 35, -105,
+    -110, -80, 80, -42, -45, -4, -79, 35, 40, -20, 4, -106, -63, 42, 2, -75,
+    -127, 5, -33, 45, 5, -1, -10, 0, -116, 6, -18, 112, -52, 25, -58, -73,
+    -1, 61, 110, 7, 46, -70, -4, -38, -56, -31, -68, -9, 41, -31, -28, -3,
+    -117, 57, 4, 20, -8, 48, -52, 20, -88, 18, -22, 30, -49, 34, -87, -4,
+    -1, -34, 37, 64, 6, -63, -31, 0, -8, 5, -27, -50, -26, -27, 38, -81,
+    -118, -35, 12, 23, 50, -17, -8, 42, -15, 6, -44, 99, 47, -16, -66, -87,
+    -22, 12, 16, -6, 11, -100, 17, -56, -113, -54, -16, -44, 115, -35, 5, -26,
+    -89, 29, -43, 40, 27, -12, -13, 1, -44, -27, 26, -58, -21, 43, -47, 31,
+    49, 14, -79, 20, 47, -71, 30, -77, -36, -9, 42, -15, 80, -46, 2, 12,
+    -20, 42, -32, 39, 0, -26, 1, 2, 14, -11, -4, 40, -35, -27, -74, -18,
+    -5, 2, 10, -37, -16, 40, 51, -26, 32, -33, -7, -33, 71, -4, -21, -28,
+    -79, -20, -19, -36, -56, 14, -13, -24, -32, 38, 10, -65, 44, 7, -72, -17,
+    54, -3, -46, 17, 21, 99, 15, -24, 76, -40, 6, 62, 28, -16, 22, 42,
+    67, 55, -34, 4, -26, -48, 12, -36, 12, 36, 20, -58, 58, -57, 5, 30,
+    31, -31, 15, 25, -28, 77, -48, 50, 50, 55, 36, -26, -86, -26, 18, 6,
+    21, -21, -55, -63, -25, -60, 28, 42, 57, -12, 12, 6, 63, 14, 68, -54,
+    -13, -31, -51, -65, -30, -16, 16, -45, -53, -59, 7, 41, -36, -48, -27, -3,
+    60, 11, -13, -32, -8, -20, -2, -15, 2, -42, -21, -53, 6, -63, -35, -73,
+    25, -103, 14, 24, -1, -41, 47, -99, -16, 7, 40, -46, -58, -30, 16, -58,
+    -28, -35, 19, 0, 16, 27, 22, 29, -13, 33, -6, 48, 52, -34, -38, -47,
+    -70, 17, -12, 30, -30, -31, -9, -72, -11, 44, 47, -115, -7, 45, 51, 20,
+    79, 32, 42, 18, -10, 32, 31, 29, -95, 23, 3, 43, 9, 22, 35, 91,
+    -27, 10, -10, -81, -61, 23, -54, 19, -36, -8, -60, 23, -79, -68, 14, 10,
+    48, 2, -6, -33, -26, -14, -14, -8, -50, -66, -79, -9, 18, -59, 32, -27,
+    3, -123, -19, -2, -12, -96, 9, -46, -50, -43, 36, -127, -21, -10, -69, -62,
+    -44, -37, -50, 23, -2, 31, 38, 44, -37, 30, 43, -3, 2, -29, -50, 75,
+    -105, 14, -6, -3, -10, -54, 17, -88, -38, -2, 42, -67, 5, 61, 23, 11,
+    15, 17, -11, -17, -9, -12, 29, 42, -73, -26, 13, 19, -25, -9, -48, 75,
+    -27, -23, 15, -62, -45, 18, -33, -15, -21, 11, -57, -93, -43, -19, 35, 15,
+    56, -43, 45, -63, 36, 7, -49, -24, -99, -75, -70, -25, -7, 9, 100, -20,
+    -28, -9, 66, -1, -21, -67, 48, -3, -100, -40, 1, -114, 0, 11, -25, -47,
+    0, -49, 5, 35, 33, -32, 6, 41, -116, 40, 19, -11, 56, -4, -57, 99,
+    -3, 2, -14, 8, 35, -83, -9, -88, -58, -62, -36, -78, 34, 67, 56, 8,
+    53, 27, -5, 15, 43, 24, 48, -3, -99, -8, -4, 31, -23, 50, -12, 47,
+    -68, -1, -6, 13, -38, -7, 17, -58, -4, -48, -16, -76, -27, -3, -8, -5,
+    -24, 39, -16, 4, 14, -28, 22, -16, -55, -3, -17, -85, -40, -14, -10, -9,
+    -61, -32, -60, -12, 6, -23, -41, 13, -26, -8, -63, 24, 50, 16, 29, 27,
+    42, 17, 3, 0, 6, -17, -44, -39, 6, -32, -35, -74, -24, -33, 31, -8,
+    -43, -66, -71, -4, -84, 14, 15, 28, -18, -8, -42, 34, -41, -3, -6, 41,
+    17, -42, -25, -70, -53, -10, -58, -88, 17, -23, -56, 47, -25, -31, 24, -41,
+    85, -24, -83, 56, 12, -56, 27, -52, -29, -21, 53, -8, -19, 1, -13, 2,
+    -26, -6, 7, 14, 42, -2, 6, -21, -10, -28, -20, -127, 53, -41, -46, -28,
+    -29, -6, -82, 20, -23, 18, -8, 45, 64, 34, -20, -86, -77, 49, 53, -39,
+    87, 31, -17, 32, 27, 13, 56, -13, -65, -21, -12, -77, 14, 12, -1, 0,
+    -34, -44, -13, -35, -41, 14, 37, 18, 44, 33, -60, -106, -29, -19, -22, -53,
+    60, -26, 47, -26, -31, 29, -12, -1, -61, -55, -6, -103, -46, 41, 51, -30,
+    57, -48, -59, -20, -5, 36, -46, -51, 29, -75, 42, 23, -17, -19, -14, -70,
+    -107, 28, -55, 10, -2, 1, 46, 7, 32, 13, 18, -14, 32, -1, -101, -38,
+    28, 11, -64, 17, -31, 72, -34, -64, 13, 22, -37, -18, -39, 15, 4, 19,
+    -22, 29, -39, 9, 68, 15, 3, -14, 32, 15, -21, -83, 51, -10, -44, -10,
+    -1, 22, -77, 14, -39, 66, -10, -76, 11, 5, 11, 22, 41, 38, -29, -4,
+    -36, 19, -29, 1, 43, 40, 1, -60, 67, -2, -28, -88, 24, 8, 0, 51,
+    -2, 1, -16, -11, -5, 4, -37, -13, -83, -77, -53, 9, -39, -19, -75, -17,
+    -64, -67, -31, -19, -54, -49, -18, -53, -19, -62, -36, -95, 10, -38, -34, -84,
+    68, 12, 36, 59, 20, -67, 23, -60, 22, 1, 22, 3, 43, -6, -31, -63,
+    -50, 10, -61, 23, -14, -15, 66, 46, 10, 35, 13, 22, 65, 2, -57, -43,
+    20, 21, -19, 41, 11, -11, 23, 17, 54, 2, 52, -75, 9, -11, 67, -6,
+    54, -2, 18, 49, 45, -14, 56, 16, -10, 3, 29, 21, 19, 44, -20, 76,
+    -60, -50, -31, -21, -45, -21, -30, -50, -51, -22, -15, -10, -20, -15, -53, -27,
+    8, -12, -17, -80, -57, -39, -75, -72, -52, -34, -76, -77, -46, -17, 47, -69,
+    50, -40, -50, -53, -16, 10, -40, -65, -56, -80, -43, 69, 13, -66, -56, -100,
+    -42, -34, -55, -3, -14, -83, 20, 4, 17, 5, -47, -89, 42, -80, -31, -104,
+    70, 20, -22, 32, 44, 44, 86, -97, -27, -40, 61, -4, -39, 23, 2, -24,
+    0, 48, 7, 21, 1, -25, 43, -31, 59, 16, 33, -59, 41, -44, -97, -10,
+    -17, -33, 53, 53, 4, 75, 42, 66, 125, 43, -3, -127, -59, 86, 28, 6,
+    76, -52, 22, 22, 32, 29, 62, -3, -89, -51, 8, -85, 10, 57, 73, 30,
+    9, -53, 34, -9, -45, 109, -95, 66, 73, 66, -86, 3, -15, -23, 3, -41,
+    59, -68, 6, -29, -26, -7, -62, -95, -3, -55, -86, -55, -15, 26, 58, -73,
+    50, -43, 2, -27, -20, 28, 14, -46, 43, -37, 22, 43, 51, -66, -79, -46,
+    -64, 2, -46, -37, 15, -16, -22, -2, 54, -27, -30, -69, -20, -19, -37, 6,
+};
+
+// sequential/dense_1/MatMul [50, 128]
+alignas(4) static const int8_t tensor_5[6400] = {
+    37, -41, -71, -43, -35, 6, 1, 68, 4, 44, 30, 77, 17, -17, 2, 87,
+    33, -62, 53, 16, 47, 23, -50, -50, 55, -73, -32, -51, 49, -71, -55, -33,
+    -21, 60, 21, 18, -29, 60, 74, 45, 18, 14, 34, 16, 58, 34, 45, 35,
+    23, 60, -48, -40, -48, -43, -29, -1, -32, -14, 31, -72, 8, -13, -7, 20,
+    24, -45, -48, -34, -25, -59, -8, 46, 51, -35, 27, 23, 47, -38, -70, -30,
+    -4, 27, 60, 69, -37, -51, 27, -29, -20, -47, -36, 18, -65, -9, 59, -55,
+    7, 56, -10, -54, -79, -76, -38, 8, -59, 43, -34, 57, -25, 83, -57, -16,
+    52, 117, -31, -47, 3, -77, 67, -45, 71, -17, -12, -1, -1, 60, 33, -7,
+    21, 19, -26, -28, -57, 3, -36, 5, -43, -38, -22, -26, 54, -59, 45, -24,
+    64, -14, -65, 36, -4, 46, 51, -82, 57, 43, -23, -55, -10, 54, -66, 0,
+    8, 33, -12, -16, -34, 45, 18, 71, -15, 48, -28, -32, 34, -37, 36, 63,
+    37, -47, -32, 75, -9, 71, -21, -7, 33, 10, 72, -29, -36, 20, 54, -9,
+    72, -32, -49, 51, 74, 21, 37, -51, -62, -1, -41, -39, 39, 52, 0, 23,
+    -22, -60, 7, 14, -38, 8, 69, -16, 31, 42, 17, -7, 19, 47, 10, 23,
+    50, 41, 66, 39, 25, -12, 16, 13, -7, -43, -15, 17, -52, 10, 62, 9,
+    43, -35, 48, 2, 14, -52, -49, -8, -51, 24, 59, 27, 67, 0, -45, -9,
+    -19, 61, 39, -30, 62, 11, -34, 39, 60, 19, 26, -13, -21, -29, 9, -61,
+    55, 41, -62, 32, 8, 30, 56, -7, 5, 0, 25, -42, -9, 23, 25, 17,
+    7, -39, -41, -59, -3, -93, -42, 63, 51, -13, -6, 40, -8, 33, 57, -18,
+    -51, 70, -63, -30, -7, -28, -43, 43, -56, -62, -33, 71, -26, -47, -62, 18,
+    -22, 16, -30, -44, 35, 9, 21, 15, 8, -73, 4, 50, 3, -36, 52, 30,
+    6, 0, 15, -56, -52, 13, 65, 61, 33, -24, -10, 26, -34, -9, 63, 31,
+    19, 44, 44, -48, 37, 14, 48, 3, -4, -86, 6, 7, -52, -58, 58, -54,
+    -76, 8, 24, 40, 15, -3, 7, 0, -26, 39, -39, 68, 28, 50, 57, 0,
+    59, -60, 38, 35, 43, -23, 11, -65, -21, 25, 13, -24, 75, -47, 13, 51,
+    14, 14, 52, 45, 14, 42, -48, -25, -49, 11, 13, 37, 14, -1, 10, 49,
+    25, -38, 21, -45, 38, -70, -25, 22, -35, -19, 22, 4, -75, -18, -69, -31,
+    -18, 0, -25, 4, -73, 64, 14, -28, -37, 52, -4, 66, -42, -35, 62, 52,
+    7, -2, -39, -6, -60, 42, -12, 25, -11, 25, 3, -60, 51, 5, 35, -34,
+    8, 37, -60, 54, 21, -1, -32, 44, 46, -7, -24, 3, -16, 32, -28, -57,
+    52, 66, -10, -59, 21, -26, -42, -87, 12, 43, -33, -57, 57, 57, 28, 35,
+    -10, 15, 22, 8, 8, -20, 43, 42, 13, 36, 2, -19, -1, 17, -25, 65,
+    23, 64, 10, 24, 65, -36, 36, -11, -36, -34, 11, 18, 36, -47, 56, -57,
+    62, -37, -34, 44, -67, 5, 42, -15, 58, 49, 20, 41, -8, 57, 56, -20,
+    -10, -71, 6, 0, 69, -70, 36, 61, 19, 5, 76, 47, -66, -37, -59, -25,
+    -48, 40, -5, -7, 43, 28, -68, 43, 39, -61, -27, 46, -9, -37, -108, 34,
+    46, -56, -9, 22, 39, -11, -26, 21, 54, -16, 38, -29, 11, 2, -36, -14,
+    55, 32, 53, -2, 73, 2, 104, 54, -1, 70, -28, 45, 37, -43, 25, 52,
+    39, -27, -50, -21, 36, 47, 3, -7, 62, -19, 61, -14, -28, 19, 18, -3,
+    -1, -48, 19, -31, 50, -23, 49, 52, -39, -26, -51, -25, -56, -10, 42, 53,
+    -34, 65, -36, 50, 0, 24, 31, 50, 64, 41, 37, 65, 58, 5, 8, 10,
+    -34, -45, -28, 12, -41, 5, 37, -8, -27, 39, 19, 39, -55, -12, 18, -44,
+    -7, 64, 6, 40, 21, 37, -48, -27, 0, -33, -27, -34, 60, -23, 60, -11,
+    49, -62, -35, 54, 10, 17, 58, 42, -14, 36, 16, 56, -37, 27, 7, 57,
+    20, 38, -74, 13, 64, 15, 8, -53, 35, 38, -54, 38, -4, 40, -17, -1,
+    55, 31, -33, -37, 50, -24, -58, 21, 25, -49, 20, 31, 34, -36, 43, -7,
+    -10, -10, -57, -10, 23, 12, -25, 29, 39, 80, 38, 32, -48, -6, -10, 23,
+    19, -13, 32, -35, 10, -76, -30, 37, 19, -52, -17, -60, 49, 10, -74, -34,
+    84, -83, -27, 28, 22, -11, 38, -61, -13, 41, 68, -36, 85, -29, -71, 41,
+    -8, 78, -11, -27, -9, 64, 1, 21, 4, 51, -14, -37, -36, -49, 29, 60,
+    -45, -58, -20, -25, -60, 51, -56, -12, -29, 55, -66, 11, 60, -28, 13, -39,
+    55, -40, -26, -41, 12, 3, 59, 8, 25, 2, -38, 9, 10, 51, 94, -54,
+    49, 54, 65, 37, -2, -4, 67, -17, 5, 60, -10, 3, -2, -24, -43, -31,
+    38, 47, -26, -53, -52, -16, -85, -20, 53, 62, -11, -16, 83, 93, 33, -44,
+    17, -31, -32, -26, 20, 40, 35, 76, 59, 59, -36, 11, 17, 25, 54, -50,
+    17, -55, -2, -22, -56, -42, -21, 0, 29, 25, 49, 47, -10, 1, -1, -65,
+    -39, 25, -72, 29, -51, 59, 45, -30, -46, 33, -38, -40, -10, 42, -41, 53,
+    67, -16, -7, 35, 18, -29, -7, -56, 22, 44, 59, -47, -13, -83, -46, -10,
+    -12, 35, -6, -4, -5, 43, -34, -56, 56, -6, -81, -10, 28, 30, 21, -52,
+    -35, 20, -41, 44, 0, -21, 47, 44, 25, -46, -19, -43, 29, 30, -56, -62,
+    4, 22, 2, -25, -35, 45, -36, -57, -77, 67, 45, -50, -8, -18, -29, 18,
+    56, -47, -35, -46, -37, 47, 41, -46, -29, -35, -17, -75, 26, -9, 36, 27,
+    56, 43, -3, 30, -30, 2, -1, -57, 26, 40, -56, -8, 29, 23, -9, -21,
+    -49, 47, 11, -30, 52, -22, 26, -4, -38, -47, 42, 39, 7, -33, -24, -1,
+    28, 59, 12, 14, 16, 9, -13, -60, 7, 68, 55, 41, -7, -3, -2, 5,
+    -50, 27, 65, 70, 8, -75, -53, -45, -58, -46, 15, 18, 43, 53, -31, -32,
+    30, 12, -20, 29, -27, -4, 8, -64, -43, -22, 24, -62, 70, 50, 57, -15,
+    -47, 0, 47, -62, -31, -31, 63, -56, -17, 19, -48, -10, 101, -50, -10, 2,
+    -59, -3, -53, -6, 1, 1, 24, 74, 8, -58, 22, 16, 20, 54, -20, 48,
+    69, -25, 64, -37, -29, 9, -24, 17, 4, -2, -100, 5, -86, 18, -22, -45,
+    42, -36, -31, -42, -57, 39, -76, 29, -35, 9, 20, 13, 59, 32, -63, 74,
+    68, 14, 6, 24, -11, -16, 41, 59, -40, 62, 25, -1, 25, 0, 49, 35,
+    -80, -77, -37, -39, -1, 54, 30, -7, 4, -63, 24, 15, 52, 48, 55, -19,
+    -42, -60, 45, -82, -13, -50, 10, 24, -63, 38, -11, 23, -15, 53, -60, 80,
+    -40, -50, -46, 15, 1, 29, 54, -14, 40, 82, 54, -14, -37, 58, -3, 71,
+    -3, -78, 33, 85, -1, 65, -8, 35, 37, 29, -1, -5, -45, -50, 51, -19,
+    -9, 45, -13, 13, -9, 26, 11, 7, -33, 94, -28, -53, -18, -1, -12, -104,
+    -31, -40, 39, 18, 43, 44, -33, -13, -27, 46, -81, 32, -12, 63, 33, -34,
+    8, 41, 47, 87, 75, -19, 0, -61, -48, 20, 55, -40, 34, -15, -3, 24,
+    -14, 4, -8, -32, 8, 49, -68, 56, -16, -36, -18, -21, 56, 1, -62, 12,
+    -79, 5, -17, -48, 37, 30, 20, 10, 12, 50, -38, 58, -36, 69, -33, -20,
+    29, 35, 53, 46, -2, 24, -7, 41, 24, -1, -32, -20, -32, -42, -20, -20,
+    -28, -5, 43, 28, -1, -28, 4, -67, -1, 63, -36, 41, -47, 23, -29, 48,
+    72, -88, -18, -67, 25, -26, 64, -10, 45, 22, 62, 16, -55, 13, -44, -40,
+    -18, 49, -26, -22, 63, 20, 37, 58, -17, 56, 11, 30, 41, -13, -58, -34,
+    -1, -13, 44, 53, -48, -18, -59, 36, -53, 3, -26, 53, -114, 29, -44, 29,
+    65, -49, -59, -20, 58, -30, -16, 45, -90, 60, 9, -27, 15, -51, 40, -20,
+    -28, 88, -6, -48, -6, 57, -61, 39, -59, 14, 9, 12, -12, -70, -56, 43,
+    -83, 14, -11, 12, 70, 14, -16, -25, -31, -2, -57, -40, 33, -42, 8, -45,
+    54, -8, 49, 20, 51, -32, -41, -5, -3, 46, 53, 27, 4, 34, -7, -48,
+    47, -34, -13, 55, -35, 2, -29, -4, -9, 22, -29, 44, -65, 46, -33, 48,
+    -3, -73, 72, 40, -22, -32, 30, 65, 60, 62, -3, 11, 80, -12, 3, 52,
+    42, 73, -17, -31, -65, 24, -4, -2, 22, 9, -17, 42, -32, 36, 49, -65,
+    59, -5, 28, -59, -40, 46, -29, -49, -33, -4, -44, -73, -52, 53, -19, -18,
+    35, 13, 39, -35, -50, -36, -52, 3, 39, 2, 37, -14, -15, -28, -4, -48,
+    -45, -18, -8, 32, 2, 31, 29, 3, -44, 57, 6, 14, 17, 73, 69, -20,
+    19, -25, 34, -48, -43, 43, 56, 56, 31, 37, 36, 37, -7, 63, 7, -27,
+    -6, -3, -18, 9, -47, 22, -47, -47, -58, 19, 22, 48, 2, 46, -33, 59,
+    40, 59, 42, 44, 27, -28, 11, 66, -49, 12, 36, -11, 47, 49, 23, 44,
+    -30, 60, 15, -23, -22, -21, 40, 49, 60, -43, -24, 24, -54, 20, 19, -18,
+    12, -48, 22, 46, 27, 50, -26, 8, -38, -47, -2, -28, -49, -25, -13, 66,
+    -39, -61, 9, 44, -26, -1, 38, 23, -36, 5, -41, 43, -16, -1, -5, -27,
+    -20, 17, 23, 30, -41, -8, 58, 10, -99, -52, 47, 66, -14, 44, -5, -51,
+    -48, 12, -25, -33, -12, -65, 52, 21, 33, 60, -55, 51, -24, 6, -6, 41,
+    -64, 62, 12, -16, 46, -20, 55, -6, -25, -64, 39, 38, 22, 20, -44, -27,
+    -25, 64, 3, -61, 39, 47, 59, 23, 45, -29, -8, -11, 20, 13, -35, 24,
+    -11, -9, -50, 55, -24, 3, 45, 50, 84, 7, -37, -35, 69, 18, 16, -7,
+    26, -41, 31, -24, 108, 81, 24, 88, 53, 11, -3, -37, -47, -12, -47, -70,
+    43, -20, -57, 78, 28, 46, -44, -15, -71, 61, 65, -1, 29, -14, -50, -32,
+    -10, -72, 35, 22, -38, -31, 6, 13, 41, 52, -55, 8, -22, -17, -49, -21,
+    2, -53, 33, 25, -13, 36, 57, 15, -59, -30, 9, -1, 45, -52, 39, 24,
+    -9, -7, -55, -21, 59, -55, 31, 30, 19, -2, 64, 61, 60, -18, -40, -39,
+    20, 44, 57, 42, 31, 0, -38, -68, -80, 20, -9, 37, 79, -97, -2, 37,
+    3, 50, 4, 38, 36, -23, -37, 48, -20, -12, -30, -46, -76, -32, 34, 16,
+    12, 29, -4, -58, -69, -23, -63, -9, -27, -88, -16, -25, -54, -24, 30, 10,
+    41, 15, -77, -103, -57, -36, -14, -41, -11, -60, 23, 46, -22, 19, 22, 55,
+    22, 34, -63, -22, 50, -22, 18, 16, 18, -30, -51, 59, 35, 23, -21, -50,
+    -5, -15, 15, -75, -9, -58, -35, -34, -34, -44, -4, -19, -61, 17, 20, -12,
+    -21, -45, -63, 28, 29, 49, -40, 23, -46, 46, -40, 6, 17, 47, -46, 41,
+    28, 0, 20, -4, -62, -28, 50, -46, -24, 27, -13, -33, -19, -52, 29, -70,
+    -95, -36, 38, -62, 55, -30, 4, -23, 18, 65, 50, 65, -30, 17, 57, 34,
+    77, 13, 38, -50, 40, -39, -26, 27, -27, -46, -8, 41, -23, -1, 35, -64,
+    -54, 51, 39, -49, 36, -8, -51, -57, -20, 21, 18, -14, 16, 35, -24, 13,
+    12, -27, -63, -29, -17, -5, 35, 43, -16, 15, 15, 26, -26, -46, -53, 69,
+    -57, 61, 10, -41, 28, 61, 2, 49, 32, 66, 0, -51, 15, 18, 48, -122,
+    87, -38, 5, -27, 27, 28, -68, -32, -12, 61, -12, -37, -46, -50, -75, 35,
+    -6, -21, 18, -56, 14, -52, -57, 42, -80, 17, -49, 17, -38, -10, 33, 17,
+    -23, -25, -24, -39, -58, 16, -6, 53, -19, -46, 58, 20, -33, 56, 2, 61,
+    -34, 17, 57, -11, 44, -22, -24, 12, -90, 14, -31, -7, -4, 38, 38, 49,
+    69, 89, 5, 48, 5, 55, -58, 10, 33, 77, 40, -43, -62, 43, 21, -27,
+    -40, 8, -52, -50, -53, 26, -36, -13, -30, -56, 3, 6, -49, -37, -87, -8,
+    -37, 21, -61, 19, -3, -73, 45, -10, 66, -36, 0, -60, 0, -13, 0, 34,
+    12, -1, 5, -1, 35, 23, 37, 31, 57, -24, -58, 11, 33, 70, 3, 88,
+    48, 33, 4, -61, -78, -38, 12, -41, 28, 51, 72, -57, -28, -54, -38, -47,
+    -3, 5, -30, -38, -58, -6, -7, 66, 52, 53, 5, 35, -52, 61, 60, -64,
+    -26, 31, 57, -48, -43, 72, 21, 49, 14, 25, 55, -49, 21, 36, 23, 26,
+    4, 49, -58, 10, -44, -34, -56, -9, -16, -30, -26, 36, -39, -1, -24, 28,
+    47, -9, -25, 45, -23, -40, 52, 8, 20, 29, -34, 34, -29, 28, -23, 42,
+    -32, -24, 0, 56, -2, 27, 3, -51, 2, -54, -7, -25, 16, -28, -4, -23,
+    33, -21, 14, -53, 28, -6, -15, 6, -11, -2, 4, -7, 3, 56, -53, 17,
+    -66, -6, 21, 5, 42, 43, -16, 3, -55, -42, -44, -52, 55, -8, -13, 49,
+    -14, -16, -45, 12, -50, -41, -25, 38, -51, -29, 27, -59, 41, -26, -1, -6,
+    46, -28, -22, -28, 10, -10, -29, -2, -14, -37, -56, 29, 7, 45, -26, -12,
+    -29, -34, 50, -59, 23, -51, -4, 12, -47, -52, -42, 9, -25, 20, 1, 32,
+    -40, -32, -62, 40, -34, 22, 6, 22, 22, 7, 9, -20, -53, 0, 23, 55,
+    27, 35, -84, -71, -40, -12, -22, -49, 14, 7, 47, -21, -1, -48, 1, -26,
+    -14, 33, 26, -60, -55, -14, -63, -40, -7, -12, 9, -35, -6, -45, 35, 24,
+    -57, 52, -53, 5, -5, 30, -41, -38, 45, -63, -56, -46, -13, 48, -31, -27,
+    13, 36, -15, 39, -62, 10, -51, 12, -17, -53, -23, -10, 21, -59, 22, 30,
+    -40, -2, -8, -35, -26, 53, 11, -63, -8, -49, -12, 12, -66, 10, 58, 48,
+    22, -39, 2, -61, 39, -21, 12, -3, -64, -17, 41, 8, -43, 10, -12, -56,
+    -34, 4, 52, 47, 7, 47, 7, 39, 20, 0, -72, -11, 41, 43, -27, -51,
+    -16, -9, -39, -33, 20, 31, 28, -60, -12, 65, 8, 24, -46, 14, -11, -16,
+    23, 42, 51, 35, -10, 74, 56, 49, 16, 39, 53, -68, 51, -8, -37, 45,
+    -34, -15, -21, 37, 48, 0, -43, 46, -48, -9, -17, 32, 4, 28, 38, -21,
+    45, 48, -16, -90, -32, 33, -24, 36, -7, 40, -28, -19, -7, -42, -28, -73,
+    -74, -25, -42, 39, 50, 30, 78, -1, -45, -58, -19, 39, -14, 60, -62, 47,
+    68, 6, 26, 34, -82, -62, 64, 57, -36, 6, 46, 17, -119, -8, -5, 4,
+    32, -50, 0, -37, -49, -20, -39, 78, -66, -27, -61, 0, 65, 52, -35, -69,
+    -14, 11, -5, -28, 49, 8, 9, 6, 49, 7, 68, 14, 22, -30, 3, -37,
+    21, -17, 38, -5, -66, -41, -44, 11, 54, 58, 13, -45, 19, 16, 14, -71,
+    8, 59, 15, 26, 33, 29, -20, -30, -46, -48, -33, -12, -52, 12, 56, -14,
+    -27, 17, 0, -14, 32, -43, 39, 35, 36, 22, 57, 38, -21, -53, 17, 21,
+    48, -52, -5, 48, -41, -12, -41, -48, 15, 54, 8, 25, -73, 33, 8, 50,
+    51, -36, 61, -4, -9, 23, -30, 18, 57, 20, 21, 8, 49, 34, -47, -45,
+    -25, 21, -24, -11, -16, 39, -23, 35, -33, -19, 20, 10, 0, -23, -53, 51,
+    24, 19, 52, -3, 53, 50, -2, -21, -68, 12, 21, -25, 37, 38, 29, 44,
+    -42, 3, 14, -38, -43, 46, -31, 18, 11, -4, 7, -4, 45, -24, 42, -49,
+    62, 4, 63, -10, -53, -18, -39, -6, 33, 11, 3, 49, 43, 29, -49, 67,
+    41, -25, 63, 70, -40, -13, -59, -35, -22, 12, -8, 12, -5, 56, 62, -56,
+    48, 56, 36, 22, -10, 17, 36, 22, -60, -3, -49, -34, -18, 5, 10, 34,
+    48, 65, 35, -54, 63, -61, -34, -19, -56, 40, 17, 73, 55, 24, -55, 71,
+    -62, 35, -2, -33, 29, -37, 38, -13, 58, -46, -11, -8, 49, -43, 31, 74,
+    7, -15, 39, -5, -33, -42, -27, -1, -39, 32, 54, 57, -27, -87, -29, 57,
+    18, -45, 33, -37, 33, 38, 25, 16, 92, -20, -15, -24, -18, 3, -10, -8,
+    37, -34, 44, -13, -7, -19, 77, 63, 28, -23, -14, -3, 41, -35, -39, 36,
+    -40, -49, 5, 50, -49, 36, 26, -10, 24, -46, -30, -45, 8, 27, -44, -8,
+    -45, 44, -15, 11, 14, -31, 36, -6, -46, -25, -41, -11, 44, 21, 40, -26,
+    24, 22, -46, -43, 11, 30, -31, -49, -66, 31, 28, -20, -18, 18, -51, -51,
+    -23, -43, -52, -42, 3, -53, -56, -2, 3, -30, -68, 45, -2, 29, -31, 1,
+    43, 29, 0, 1, -70, 32, -24, 50, -65, 10, -58, -29, -37, 10, -59, 11,
+    -63, -62, -25, 16, -13, -59, 14, 17, -49, 20, -65, -7, 12, -10, -54, -12,
+    3, 55, -48, 6, 8, 35, -63, -39, 10, -55, 19, -23, 42, -15, -63, -5,
+    -41, 40, -50, -2, 12, -65, -5, 18, -30, -1, -15, -2, 51, 5, 26, 33,
+    -78, 48, -47, 46, 42, -36, -52, -34, -33, -79, 22, -31, -27, 15, -24, -59,
+    -2, 1, 2, -32, 40, 23, 19, -6, 18, -23, 34, 32, 8, -45, 53, 8,
+    29, 33, -49, 18, 58, -14, -17, 19, 77, 16, 53, 32, 11, 9, 38, -52,
+    -34, -5, 8, -5, 91, -40, -13, 46, -19, 16, 20, 63, 22, -13, -34, 16,
+    65, -16, 18, -17, 9, -56, -1, -78, -20, -36, 58, 45, -59, 10, -19, 33,
+    -92, 41, 66, -34, -25, -41, 3, -8, 52, 28, -9, -67, -32, 10, 33, 28,
+    12, 19, 38, 27, 56, -33, -44, 4, 50, -7, -27, 14, 61, -55, 32, -33,
+    13, 27, -58, -15, 63, 51, -74, 20, 9, 4, 53, 13, 76, -11, 35, -37,
+    -8, 1, 3, 46, 29, -12, -20, 4, -16, -53, -53, 42, 30, 46, 16, 21,
+    -34, 49, 19, 29, 46, -16, 16, -4, 52, 36, -9, -17, 35, -46, -41, 34,
+    19, -17, -8, 19, -26, -35, 31, -44, 9, -44, 2, 14, -34, 51, -39, 51,
+    -24, -68, 19, 16, -72, -34, 65, -36, -28, -5, 33, -3, 20, -6, 1, 43,
+    -91, 16, -63, -56, 2, 53, 37, -3, -3, 31, -26, -84, -27, -51, 4, -40,
+    24, 26, -17, -24, 7, -21, -19, 21, -12, -42, -52, 12, -57, 8, 32, 48,
+    -26, -11, -7, -31, 22, 3, -59, -5, -35, 29, -37, -39, -48, 38, -70, -16,
+    -22, 8, 52, -18, -42, -24, 6, 43, -16, -80, -35, -56, -67, 49, 12, -14,
+    -12, 2, -74, 44, 11, -50, 23, -17, 40, 18, -65, 37, 5, 39, 32, 62,
+    -34, -37, 13, 27, -40, 28, 54, -45, -6, 25, -22, 2, 1, 20, -66, 46,
+    28, -48, 50, -36, 6, 38, -72, 35, 43, -1, 33, -30, -11, 21, -95, -20,
+    -12, 68, -48, -50, -2, -37, 58, 4, -7, -70, 22, 55, 33, 18, -68, 8,
+    18, -37, 2, -10, 39, 19, -28, 40, -71, -23, -2, -12, 30, 39, -17, 44,
+    38, 53, -12, -34, -11, -34, 54, 51, 17, 54, 38, -3, -21, 60, 40, 4,
+    46, 54, -69, -41, 24, -69, 25, -35, 50, 15, 6, -38, -41, 32, 23, -37,
+    -61, 48, 2, 14, -47, 19, 75, -6, -20, -42, -3, 25, -30, -5, -47, -58,
+    37, -22, -51, 46, -53, -17, -2, -15, -15, 60, -2, -40, 126, -15, 11, 26,
+    56, 25, -40, 37, -23, -11, 50, 27, -10, -29, -5, 41, 18, -18, -9, -8,
+    -45, -40, -48, 50, -43, -44, 50, -43, -59, -78, -59, 15, 11, 29, 7, 30,
+    40, 44, -26, -62, -22, -74, -38, -2, 20, -28, 9, -8, -41, -42, -9, -29,
+    -21, 62, 23, 31, -35, 23, 54, -38, 10, -40, 32, -4, -13, -62, -32, -8,
+    64, 42, -30, -34, -48, 39, -6, -52, -26, -39, 4, -11, -49, -31, -9, 1,
+    -22, -47, 16, -40, -22, 34, 59, 26, -23, 102, 25, -28, 44, -80, -44, -13,
+    -25, -56, -42, -19, -46, 55, -37, 24, 32, 3, 43, 24, -31, -61, -9, 36,
+    -24, -25, -43, -35, -68, 34, 73, -37, 77, -7, 23, -19, -28, 3, -12, 11,
+    -13, 39, -49, 21, 55, -19, 27, -7, 60, 30, 54, -39, 57, -78, 65, -18,
+    -29, 52, -18, 22, -30, -16, -21, 19, 1, -55, -51, -58, 12, 13, -46, 18,
+    15, -42, 8, -37, 28, 26, 18, 3, -33, -46, 63, 39, 4, 7, -36, -76,
+    -77, -99, -26, 40, 4, 32, 30, -23, -21, 45, -46, 69, -48, 4, -50, 28,
+    32, -5, 42, -32, -25, -40, 20, -31, -33, -55, -79, 16, -13, 34, -8, 4,
+    8, 18, -43, 10, 38, -29, 32, 65, -12, 67, -27, 22, 1, -19, 7, 8,
+    64, 20, 4, 29, 37, 1, 27, -27, -34, -30, 28, -47, 31, -56, 53, -25,
+    25, -44, -59, 4, 74, -26, -68, -65, 26, 77, 32, -17, 18, -59, 33, 6,
+    55, 75, -31, 33, 50, 16, -62, -39, -4, 26, -8, 22, -60, 32, 0, -41,
+    30, -51, 50, 23, 37, -5, -4, 13, -33, -20, 0, 1, 36, 24, -29, -1,
+    4, -36, -21, -42, -63, -29, -14, -15, 3, 66, 7, 41, 44, -13, -23, 36,
+    -20, -25, 48, 0, 10, 19, -36, 15, -42, 1, 48, 43, -18, 12, 7, -40,
+    -18, 73, 6, -19, 25, -8, 77, 13, 7, 35, 6, 8, -75, 0, 0, -24,
+    23, -26, -33, -75, 43, 9, 16, 29, -30, 10, 25, -52, -36, 13, -43, 31,
+    -73, 1, 23, -4, -46, 21, 61, -24, -80, -34, 94, 68, 3, -5, 65, -28,
+    49, 11, -78, -17, -29, -56, 43, -16, -65, 32, -54, -40, 26, 23, 58, 20,
+    -51, -29, -22, 35, -11, -39, -21, 38, 35, -47, 53, 58, 17, -4, 40, -45,
+    50, -39, -2, -11, 55, 90, -40, -68, 24, 37, 44, 44, 36, -26, -16, -15,
+    47, -50, 36, 55, -25, -38, 79, 49, 18, 62, 1, -43, 49, -16, -4, -60,
+    -31, -30, 21, -39, 40, -43, -31, -31, 50, 65, 33, -12, -2, -13, 31, -14,
+    49, -44, 0, 43, 58, -52, -74, 31, 20, -26, -77, 13, 66, 112, 18, -57,
+    42, -8, 40, -46, -31, -16, -18, -12, 29, 39, 19, -53, 3, -36, 67, -53,
+    -35, -27, 10, 0, 48, -6, -21, 40, 21, -49, -51, 14, -61, 44, -25, 51,
+    -65, -22, 25, -27, -31, -26, -36, 16, 47, -50, 21, 43, 3, -41, -31, -31,
+    15, -33, -45, -5, -19, -8, -26, -26, 49, -41, 30, 19, -43, 35, -28, -47,
+    0, -55, -45, -33, -31, -79, 55, -30, 29, 44, 72, -5, -76, -8, -20, 7,
+    30, 23, -18, -1, 72, 13, -46, 15, 28, -7, 17, 60, -5, 30, -35, 24,
+    57, -43, 38, -8, -3, 42, 47, 34, 43, 0, -28, -39, -57, 88, 16, 76,
+    -43, 61, 20, 34, 4, 15, -3, 32, -49, 51, -37, 49, -69, -39, -1, -7,
+    -6, -28, -16, 36, 21, -14, -32, -3, 55, 46, -55, -15, -15, 25, 14, 27,
+    20, 14, -16, 21, 10, 67, 18, -6, -47, 50, 62, -57, 11, 26, -51, 47,
+    11, -55, 77, 9, 35, 30, -43, 41, -15, -39, 19, 5, -23, 49, -3, -34,
+    -58, -46, 4, -22, -40, 1, 54, -5, -50, -53, 45, 1, -26, 63, 49, 73,
+    32, -69, -25, 10, -9, 39, -47, 54, 13, 39, 49, 52, -21, -14, 28, 25,
+    -50, -40, -46, -30, 47, 80, -59, 59, -27, -20, -71, 22, -3, -25, 7, 16,
+    -33, 36, 45, 69, 55, 2, 59, -47, -19, -15, 66, 52, -12, -21, 30, 56,
+    -70, -5, -53, -44, 66, 30, -1, 36, 29, 21, -21, 71, -4, 93, 30, -23,
+    -20, 37, 29, -37, 70, 23, 89, -22, -14, -12, 50, 47, 69, -26, 36, -21,
+    20, 28, 5, -26, 45, -25, -41, 33, -29, 56, 2, 45, -48, 64, 58, -35,
+    -6, 104, -11, -50, -11, -20, -33, 47, -42, 26, -9, 54, 18, -54, -1, -62,
+    -34, -74, -30, -41, 50, -50, -59, 2, -15, 59, -43, 61, -30, 13, -31, -55,
+    30, -40, 18, -13, 50, -55, -6, -57, 48, -7, 77, 57, 5, 27, 30, 42,
+    65, -17, 43, -28, 59, -26, -60, -53, 70, 51, 77, -45, -37, -32, -26, 5,
+    12, 9, -36, 57, -15, -38, 1, 43, 16, -23, -27, 58, -43, 75, 69, -17,
+    76, -2, 43, 49, -62, -33, -34, -61, 58, 33, 22, 0, 32, -82, -12, 12,
+    23, -18, 6, 59, 8, 59, 29, 23, 94, 20, -27, -5, 22, -32, 69, 59,
+    -5, -21, 3, -36, 0, 79, -29, 38, 14, -19, -41, -25, 78, 68, 30, 81,
+    -12, -86, 46, 10, -21, 40, 80, -10, 0, -56, 62, -54, -14, -25, -5, -29,
+    -64, -25, -49, -83, -20, -24, 26, -5, 15, -47, -25, -31, 59, 20, -60, 3,
+    -51, 7, 35, 31, -8, 17, -40, -10, -63, 58, 40, 47, 54, -5, 33, -44,
+    49, -49, -64, -20, -21, -23, -12, 41, -11, -17, 23, -23, 43, 36, -17, -16,
+    -61, 71, -14, -3, 43, -2, 8, -16, -39, -24, -21, -61, 40, -27, -7, 34,
+    29, 46, 12, 45, 65, 56, 81, 7, -28, -52, -83, 28, 33, 3, 50, -30,
+    -5, 25, 1, 38, 45, 52, -34, 2, 8, 20, -27, -24, 32, -43, -34, -30,
+    -57, -16, -57, -31, -19, -67, -41, 11, -37, -11, -13, 6, -45, -22, -29, 6,
+    92, 82, -9, -1, -24, 51, 19, 63, 6, 16, 64, 33, 22, -51, -25, 4,
+    65, -46, 19, 59, -35, -31, 33, 16, -40, -29, 32, 24, -57, -27, 43, -19,
+    -12, 24, -27, -29, -27, -58, -28, -26, -33, -6, -35, -33, -7, -28, 29, -32,
+    59, 62, 60, -49, -30, 63, -21, -1, 58, 23, 35, 70, -55, 25, -11, 52,
+    23, -64, 23, 75, 18, -48, 8, -22, -37, -7, 60, 63, 40, 0, -52, 55,
+    70, 4, 57, 30, -6, -26, -28, 1, 28, -48, -5, 31, -39, -24, 21, 35,
+    -32, 2, -25, -1, -26, -22, 21, 12, -5, -17, -39, 0, 29, -18, 61, -27,
+    51, -36, -44, 52, 31, 58, 25, 7, 68, 28, -49, -43, 71, -35, -18, 18,
+    42, -90, 56, 25, 52, 65, -14, 19, 45, 48, 4, 42, -34, -15, -33, -43,
+    -52, -39, 67, 62, 13, -71, -39, -35, -10, -41, -11, -48, 51, 75, -23, 5,
+    -44, 43, 2, 9, -53, 11, -40, -55, 12, -2, 34, -7, -28, 39, -59, 66,
+    -69, -57, -63, 76, -94, 46, -42, 37, 28, 62, 5, 5, 45, -40, -18, 53,
+    30, -23, -39, -61, 2, 0, -23, -48, -19, -14, -56, -68, 59, 40, 10, -9,
+    -64, 11, -58, -42, 71, -19, 38, 57, -18, -2, 8, 47, 62, 69, -20, 18,
+    -58, -13, -8, -9, -27, -49, -29, -80, -55, -27, 78, 19, 10, 38, 13, 87,
+    71, -46, 45, 59, -32, -22, 30, 11, 47, 58, -25, -69, -45, -65, -17, 56,
+    28, -14, 60, 18, 16, -19, -41, -55, 43, 61, -43, -49, 37, 51, 36, 80,
+    29, -25, 56, 77, 49, -51, 46, -54, -39, 78, 16, -22, -27, -10, 41, -4,
+    0, -43, 27, -24, -59, -14, 57, 4, -29, -16, -49, 15, -25, 19, -59, 59,
+    -67, 71, 3, -43, -67, -23, 20, -42, 45, -32, -19, -35, 11, 38, 63, -14,
+    1, -47, 14, 31, -22, 42, 30, 20, -41, 39, 24, 24, -37, -29, -4, -14,
+    4, 76, 12, 46, -21, -13, -32, 8, 45, 55, -6, 40, 73, 70, 41, -1,
+    -23, 58, -62, -57, 16, 21, -15, 2, 87, 26, 57, 25, 44, -36, 25, -33,
+    -39, -11, -54, -46, 51, 63, 84, 5, -36, 33, -9, -21, -39, -32, 49, 13,
+    26, 20, 30, -13, 17, -22, 5, -27, 90, 4, -23, 3, 0, 45, 6, -27,
+    -48, -31, -52, -6, 9, 27, -28, -35, 44, -63, -21, -4, 38, -10, 3, 58,
+    48, -46, 36, -32, 68, -8, -4, 74, -24, 67, 70, -55, 25, 29, -46, 59,
+    -73, -9, -40, 10, 31, 73, -69, -62, 45, -58, 10, 67, 5, 0, 18, 18,
+    6, -2, -70, -33, 6, 46, -58, -34, 8, 6, -57, 1, -26, -23, 48, 86,
+    -14, -11, 15, 32, 38, 52, -18, -33, 2, -3, -3, 79, 31, -10, -6, 47,
+    -52, 58, 5, -11, -27, 21, 10, -3, -23, 81, -33, -50, 55, -11, -21, 22,
+    6, -39, -22, 1, -8, 30, 38, -58, 14, -27, -13, -54, -60, 51, -26, 5,
+    39, 1, 3, -58, -5, 34, -75, 8, -65, -20, -39, 3, 47, 46, -33, 37,
+    65, -21, 7, -20, -47, 30, -40, 36, 18, 61, -25, -61, -32, 66, 55, -8,
+    -37, -39, 6, -9, 5, -80, -13, -13, 28, -58, 15, -48, -69, 39, -35, -52,
+    2, 83, -10, -52, -5, 61, -42, -18, -47, -2, 18, 51, 30, -14, -45, -46,
+    -3, -39, -6, 18, 33, -53, 9, 46, -35, 35, 5, 72, 5, -37, 43, 15,
+    26, 67, 45, 56, -62, 30, 23, -31, 45, -16, 86, 26, -78, -57, 19, 8,
+    31, 14, -8, -76, -9, -2, -17, 2, 16, -25, -33, 54, 40, 21, 12, -3,
+    -6, 16, 27, -14, 11, 26, -34, 27, -29, 66, -40, 56, 2, 48, -31, 18,
+    -58, -46, 33, 32, 20, -35, 27, 18, 51, -1, -12, 41, -9, 30, 34, -21,
+    -12, 69, -58, 6, 51, 42, 36, -18, -67, 24, -45, 65, 5, 17, 4, 1,
+    10, -53, -38, -27, -20, 30, 22, -102, 54, 12, 7, 24, 7, 25, -38, -26,
+    -4, -43, -56, -69, 53, -20, -5, -10, 5, -4, 46, 44, 74, 42, -53, 64,
+    -46, 3, -53, 48, -68, -16, 18, 28, 78, -66, -34, -51, 5, -21, 2, -67,
+    40, 27, 42, -28, -54, -29, 26, 18, 51, 33, -14, -24, -105, -47, 50, 41,
+    54, 44, -47, -52, 66, -44, 27, 67, -53, -29, -3, 50, 9, -16, -6, 60,
+    9, 50, -27, 13, 6, -14, -64, 40, -17, -34, 43, 25, 29, -60, -15, 25,
+    4, 59, -21, -40, -43, 3, 3, 47, 62, 4, -29, 29, 32, -56, -23, 6,
+    -60, -12, 34, 17, 2, 58, -61, -36, -40, 71, -33, -46, -51, 1, 11, 42,
+    -21, 70, 50, 2, -35, -46, -1, 12, 10, 40, -21, 26, -51, 3, -41, 15,
+    -59, 65, 9, 59, -55, -1, 20, -26, -15, 5, -35, 54, -88, 10, 73, -16,
+    44, -46, -78, -53, 28, 16, 30, -52, -12, -37, 53, 51, -52, 38, 69, 33,
+    2, -10, -52, -50, -12, 33, -15, 50, -44, 61, 65, 15, 20, 43, -16, 12,
+    35, 1, 19, 5, -50, -17, 16, -25, 85, -48, 58, 43, -30, -10, -20, 23,
+    -47, -42, 5, 40, 33, 30, 14, 45, 64, -59, -30, 49, 53, -27, -56, 43,
+    62, 44, -63, 37, -36, -35, 0, 1, 31, 38, -49, 15, 103, -50, -45, 69,
+    -52, -34, 77, -24, -35, -48, -20, 62, 36, -11, 0, -10, -18, -1, 21, 66,
+    -18, 42, -34, 13, -46, 69, 20, -50, -13, 6, 44, -14, 29, -10, 36, -22,
+    -23, -37, -4, 51, -99, -55, 59, 55, -62, -43, -62, 38, 41, -6, -38, -58,
+    -71, -8, -23, 4, 23, -53, 30, 28, 52, 63, -15, -18, 60, 27, 70, -119,
+    21, 37, 8, 65, 62, -62, -68, -41, -58, 60, -49, -11, 35, 26, -21, -6,
+    30, 20, 6, -7, 37, -72, 21, -37, 18, 8, 53, -36, -7, 57, 15, 3,
+    51, 31, -60, 18, 7, -59, 4, 53, 17, 48, -6, 52, -72, -5, -20, -13,
+    -30, -10, -50, 4, -18, -4, 42, 29, -49, 1, -63, -66, 75, 38, -47, 0,
+    -21, 49, -46, -4, 17, 11, 45, 55, 0, -58, 20, -81, -22, 69, 59, -39,
+    50, 35, 25, -59, -50, -3, -36, -24, -22, -40, 7, 2, 49, -18, 20, -25,
+    -16, -29, -44, -4, 10, 13, -5, 30, 12, 8, -25, 53, -58, 55, -95, -71,
+    -53, 3, 19, -83, 17, -37, -50, 35, 57, -45, -31, -57, -12, 57, 23, 41,
+    19, 42, -41, -10, 57, 51, -7, 5, -47, 27, -44, 16, -66, 28, 46, -22,
+    -6, 23, -49, -52, 53, -49, -45, -21, -64, 50, -13, 21, -28, 2, 5, -3,
+    18, -80, 19, -8, -9, -11, -78, -12, 67, -39, 7, -33, -65, -30, -17, -2,
+    52, -6, 27, -46, 47, -30, 22, -59, -47, -1, -60, 36, -26, -34, -70, -55,
+    -29, 41, 3, 9, -56, -24, -40, -32, -12, -34, 57, 4, -49, -61, -44, -33,
+    -31, 7, 0, 25, -21, -60, 45, -48, 44, -49, -29, -10, 17, -37, 37, 2,
+    14, 16, 29, 3, -60, -26, -16, 32, 45, -68, -34, 39, -28, -24, -43, -77,
+    -27, -69, -57, -66, -65, -60, 46, -33, 22, 55, 20, 26, -25, -59, -21, 4,
+    -35, 41, -60, -56, 46, -21, -53, 34, -34, 15, -44, 45, -7, 51, -12, -9,
+    42, -40, 13, -13, 11, -67, -34, -44, -27, 29, -2, -46, -14, 29, -30, 8,
+    -38, 43, 4, 6, -53, 26, -62, -20, 26, -52, 37, -18, 1, 35, 43, -37,
+    -41, 20, -23, 45, 11, 0, -54, -58, 54, -38, -14, -18, 38, 1, 41, 12,
+    -18, -12, 7, 3, -62, -77, 28, 35, -37, -71, 33, -46, 66, 26, 39, 3,
+    -49, -49, -3, -9, 41, -28, 41, 34, 4, 62, 20, -28, -9, 43, 13, 40,
+    -34, -46, 27, 12, 43, 34, -40, 35, 54, -29, -75, -28, 91, -17, -68, 5,
+    64, -37, 18, -60, 49, -56, 66, -56, 67, -38, 38, 12, 8, -2, 50, 22,
+    5, 35, -35, -52, -24, -59, -20, 48, -38, 19, -49, -5, -65, 89, -38, -21,
+    33, -13, 41, -61, -8, 70, -9, -19, 49, -42, -36, 38, 49, -80, -46, 10,
+    18, -48, 51, -41, -10, 64, 37, 47, -53, -5, -84, -13, -29, -32, 45, 26,
+    -11, -14, 44, 11, 2, -14, -5, 47, 6, 54, 34, 27, -23, -18, -71, 62,
+    -11, -6, 72, -37, -46, -66, 28, -15, -24, -26, -18, -33, 64, -65, 62, 24,
+    -63, 45, -9, 33, -8, -21, -31, -24, 51, -55, -50, 39, 53, -16, -7, -1,
+    27, -21, 10, -51, -33, -66, -4, 55, 50, 67, 47, -61, 2, -43, 45, 38,
+    -30, 28, 42, 13, -1, -34, 53, 51, -31, -59, 56, -10, 1, -29, -54, 16,
+    13, -23, -25, 54, 30, 42, -61, 5, -34, -56, -29, -83, 21, -44, -34, -17,
+    53, -8, 72, 16, -29, 43, -29, 127, 29, 21, -46, -4, 49, -22, 16, -1,
+    68, 37, 17, 1, -18, 25, 49, -38, -19, -30, 15, 14, 14, -36, 56, 44,
+    -60, 75, 41, -35, -1, 5, -64, 12, 34, -15, 72, 59, -13, -45, -67, 33,
+    -65, 8, 25, -15, 16, 2, -30, -13, -36, -44, 60, -20, -26, 13, -26, -79,
+    -30, 9, 19, 3, -21, 33, -22, 16, 9, -11, 31, -12, 29, -1, -3, 38,
+    7, -48, 14, -60, 66, 44, -17, -27, 36, 1, -58, 3, 16, -49, 12, 29,
+    5, -3, -61, -4, 52, 6, -19, -35, -67, 0, -27, -41, 6, 34, 29, 94,
+    37, -51, -10, -51, -18, -50, -39, 51, -35, -7, -36, 54, -31, -76, -41, -11,
+    -1, -7, -4, -13, -23, 0, 48, -43, 52, -8, -65, -31, -42, -77, -27, 15,
+    33, -9, 49, -46, -33, -44, 46, 30, -34, -39, 57, -40, 68, -12, 29, -20,
+    80, -76, 32, -18, 21, -24, 35, 23, 53, -15, -20, -36, -71, 11, -17, 53,
+    -15, -49, -6, 4, 28, -65, 43, 6, -33, 5, -37, 10, 71, -6, 4, -2,
+    64, 44, 41, 33, -12, -29, 45, 74, -4, -10, -37, 27, -42, 43, -26, 58,
+    39, -43, 61, -36, -31, 73, -36, 39, -21, -25, -46, 42, -69, 31, -10, -39,
+    4, -5, 61, -17, 52, 1, 0, 42, 45, -60, -1, -26, 11, 20, -60, 87,
+    -48, -38, 35, -45, 29, 11, 87, -15, -64, -6, 3, 58, -48, 83, 37, -33,
+    -54, -37, -10, -24, 37, -39, 27, 40, -8, -43, 18, -22, 0, 7, -32, -28,
+    -2, -9, -23, 49, 43, 13, 14, 14, -38, -40, -2, 39, 48, -25, 11, -62,
+    8, -6, -29, 51, -33, 42, 11, 68, -7, 34, -21, -38, -35, -30, -47, 37,
+    11, -60, 59, 69, -2, -38, -30, 57, 8, 38, 21, 33, 54, -54, 77, 41,
+    33, 56, 48, -6, 54, 76, 14, -2, 28, -51, -6, -5, -15, 44, 44, 13,
+    20, 44, 7, 35, -22, -62, 63, 61, 42, 8, 67, -6, 84, -9, -18, -15,
+    -23, 49, 64, -45, -51, -25, 69, 71, 47, -62, -16, 33, 43, -45, -30, 26,
+    -32, 11, -36, 64, 52, 60, -36, 20, 11, 44, 22, -58, 51, 29, 42, -52,
+    40, 27, 58, -36, -30, -19, 8, 86, 38, 28, -25, 64, 40, 51, -27, 20,
+    70, 28, 52, 28, 36, 54, 68, -47, 51, 65, -38, -8, -5, 37, -13, -48,
+    27, 6, 58, 31, 16, -52, -6, -29, 20, -35, 33, -15, -6, 22, 4, -56,
+    -24, -6, -58, -17, 44, 9, -53, -9, -4, 28, -4, 9, 59, 56, -18, 45,
+    -38, -7, 27, -10, 30, -20, -44, -51, -39, 31, 0, -45, -10, -23, -58, -42,
+    -4, -51, -52, 46, -4, 44, 43, -29, 11, -33, 0, 43, 6, -46, -3, -35,
+    -8, 60, 11, 39, -21, 23, 34, 34, 48, -27, 51, 11, 22, 18, 29, -48,
+    -40, 45, 9, -17, 27, -59, 14, 24, -7, -49, -57, 25, -49, 53, -4, -25,
+    -38, 10, 10, 30, 31, 65, -13, 70, -81, 36, 13, 12, -26, -55, 1, -3,
+    51, 19, 9, -40, 24, 32, 48, -6, 21, 59, 18, 4, 25, -31, 54, 17,
+};
+
+// sequential/dense_1/BiasAdd/ReadVariableOp [50]
+alignas(4) static const int32_t tensor_4[50] = {
+    566, -16, 106, 66, 501, -105, -293, -1,
+    271, 279, 44, 79, 161, 396, -126, 285,
+    -204, -36, -118, 150, -61, 138, -128, 5,
+    -143, 58, 114, 83, -80, 154, 352, 170,
+    60, -112, 153, 0, 1, -97, 220, 211,
+    28, 291, -10, -90, 200, 49, -16, -105,
+    216, -113,
+};
+
+// sequential/dense_2/MatMul [10, 50]
+alignas(4) static const int8_t tensor_3[500] = {
+    53, 40, -60, 22, 36, -54, 3, 38, -46, 19, 4, 43, 48, -31, -20, 74,
+    53, 15, -10, -56, -19, -44, -56, -46, -15, -85, -24, -41, -22, -26, 57, -65,
+    53, -5, 39, -4, -83, -56, 49, 66, -71, -60, -46, 4, -56, 12, -78, -55,
+    -45, 14, 4, -27, -30, 1, -57, 63, 74, -15, -15, -87, -52, -56, -35, -57,
+    -1, -67, -26, -28, -53, -7, -18, 71, 54, 31, 0, -26, 40, -50, -72, -28,
+    -38, -65, 54, -9, 80, -83, -8, 42, -24, -67, 33, 38, 43, -19, -30, 63,
+    -5, -56, 77, -58, -105, 12, 16, 27, -55, 54, 66, -63, 51, -102, 80, 12,
+    -31, -6, 52, 41, 0, 58, 19, 88, -4, -31, 15, 32, -8, 8, 58, -30,
+    77, -90, -5, 22, -26, -4, 3, 21, -6, -127, -16, 24, -3, -98, -73, -2,
+    18, 57, -17, 22, -37, 48, -95, -11, -62, -57, -73, -30, 66, 35, -2, 68,
+    5, 64, 0, 15, 2, -24, -20, 58, -81, -41, -68, -38, -17, 62, 23, 37,
+    28, -76, -63, 70, -65, 3, -42, -22, -56, -90, -4, -73, -87, -61, -13, 9,
+    40, 44, 56, 60, 45, 9, 71, 2, -8, 50, 45, 31, 43, -78, -57, 47,
+    -6, -38, -70, -51, 10, -72, -71, -32, 74, 17, 29, 67, -76, 0, -45, -58,
+    -53, 63, 22, -51, 14, -54, 43, 17, -52, 28, 48, 70, 38, -10, 71, -51,
+    59, -21, -23, 38, 34, -71, -36, 50, -50, -10, -15, 46, -35, -7, -10, 54,
+    52, 22, -95, 47, -35, -73, 73, 8, -15, -85, -72, 56, 4, 0, 51, -54,
+    -17, -81, 3, -43, -74, 20, -33, 13, -70, 71, -78, 46, 9, 64, -46, -6,
+    -28, -9, 9, -11, -8, 9, -18, -23, -50, 53, -35, 54, -8, 53, 48, -21,
+    5, 65, -53, 1, -87, 24, 37, -69, 1, 38, 3, -83, -80, -3, -22, 33,
+    -10, -4, 4, 67, 2, -27, -67, 32, -4, -74, 58, 24, 40, 0, 57, -58,
+    -102, -23, -25, -25, 22, -35, -61, 64, 3, -81, -23, -8, -76, -13, 76, -28,
+    -25, -24, -1, 23, -41, 16, 79, -23, 68, -86, 38, 18, -6, 18, -76, 14,
+    9, 52, -64, 13, 14, -47, 32, -61, 11, 37, -53, -6, -20, -61, -72, 35,
+    19, 7, -66, 8, -33, 37, -34, -5, -40, 56, -18, 45, -12, 21, 47, -16,
+    -85, -50, 9, -59, 55, -37, -66, -33, 40, -15, 41, 28, 17, -5, -7, -36,
+    -67, -11, 21, -74, -25, -20, 17, 30, -7, -46, -79, -13, -48, -76, 27, 61,
+    20, -15, 43, 29, -41, -35, 5, 66, -54, -79, 10, 44, 80, 8, -47, 35,
+    48, 44, -74, -78, -22, 69, 0, 27, 3, -43, 21, 66, 53, 20, -61, -68,
+    -7, 62, -56, 22, 61, -42, -44, -8, 29, -30, 11, 58, -10, 18, -4, 51,
+    6, 38, -37, 26, -40, 54, 32, -19, -36, 22, 16, 36, 4, -42, 53, -70,
+    -40, -82, -3, -11,
+};
+
+// sequential/dense_2/BiasAdd/ReadVariableOp [10]
+alignas(4) static const int32_t tensor_2[10] = {
+    -13, 20, -216, 17, 11, -21, 54, 106,
+    55, -43,
+};
+
+static const int32_t op_1_multipliers[32] = {2077631604, 2123819968, 1519457401, 1579443648, 1356525625, 1266602850, 2110025868, 1230833056, 1229936592, 1162126555, 1917916411, 1169615246, 2043232711, 1461553652, 1366287185, 1825118918, 1233041589, 1774095246, 1617615557, 1468308726, 1116988788, 1504876817, 1777275933, 1215179284, 2001518984, 1603834302, 1824768911, 1897145329, 2129224210, 1074136275, 2081538109, 1915337457};
+static const int32_t op_1_shifts[32] = {-9, -9, -8, -9, -9, -8, -9, -8, -8, -8, -9, -8, -9, -9, -9, -9, -8, -9, -9, -9, -8, -9, -9, -9, -9, -9, -10, -8, -9, -9, -9, -9};
+static constexpr conv_params_t op_1_params = {
+    .batches = 1,
+    .input_h = 28,
+    .input_w = 28,
+    .input_c = 1,
+    .filter_h = 4,
+    .filter_w = 4,
+    .output_h = 25,
+    .output_w = 25,
+    .output_c = 32,
+    .stride_h = 1,
+    .stride_w = 1,
+    .pad_h = 0,
+    .pad_w = 0,
+    .input_offset = 128,
+    .output_offset = -128,
+    .act_min = -128,
+    .act_max = 127,
+    .multipliers = op_1_multipliers,
+    .shifts = op_1_shifts,
+};
+
+static const int32_t op_1_folded_bias[32] = {7936, 522, -3446, 20081, 25414, -7253, -14867, -639, -9506, -2863, -2933, -21974, -1527, -13023, 11409, -12925, -8101, -22579, -4060, -20239, -7090, 7203, -17329, 38618, -16053, 11303, 18970, -17414, -10228, 29417, -776, -14273};
+
+static constexpr pool_params_t op_1_pool_params = {
+    .batches = 1,
+    .input_h = 25,
+    .input_w = 25,
+    .channels = 32,
+    .filter_h = 2,
+    .filter_w = 2,
+    .output_h = 12,
+    .output_w = 12,
+    .stride_h = 2,
+    .stride_w = 2,
+    .pad_h = 0,
+    .pad_w = 0,
+    .act_min = -128,
+    .act_max = 127,
+};
+
+static const int32_t op_2_multipliers[64] = {1762943555, 1754277898, 1374007734, 1434574513, 1316438526, 1505702613, 2011033809, 1439140689, 1937835765, 1869317002, 1127236915, 1669854355, 1995936495, 1525972188, 1613231762, 1171596926, 1856096366, 1526476855, 1586779780, 1756223541, 1540004023, 1208115055, 1659120864, 1365488284, 2101748480, 1570857799, 1713459151, 1631620279, 1383300572, 1751178987, 1221347294, 1771116391, 1117344643, 1333468826, 1671322431, 1830210713, 1561653399, 1162049239, 1834767964, 1563804154, 2116019180, 1081843554, 1811018625, 2138726732, 1453906805, 2060174357, 1299347862, 1536028031, 1690443606, 1568785097, 1106993140, 1467056853, 1721100709, 2056497108, 1849414648, 1606634912, 1217661931, 1660733687, 1674374932, 1823005992, 1416129850, 1560567960, 1460565805, 1759003100};
+static const int32_t op_2_shifts[64] = {-10, -10, -9, -10, -10, -10, -10, -10, -10, -10, -9, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -9, -10, -10, -10, -10, -10, -10, -10, -10, -9, -10, -9, -10, -10, -10, -10, -9, -10, -10, -10, -9, -10, -10, -10, -10, -10, -10, -10, -10, -9, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10, -10};
+static constexpr conv_params_t op_2_params = {
+    .batches = 1,
+    .input_h = 12,
+    .input_w = 12,
+    .input_c = 32,
+    .filter_h = 3,
+    .filter_w = 3,
+    .output_h = 10,
+    .output_w = 10,
+    .output_c = 64,
+    .stride_h = 1,
+    .stride_w = 1,
+    .pad_h = 0,
+    .pad_w = 0,
+    .input_offset = 128,
+    .output_offset = -128,
+    .act_min = -128,
+    .act_max = 127,
+    .multipliers = op_2_multipliers,
+    .shifts = op_2_shifts,
+};
+
+static const int32_t op_2_folded_bias[64] = {-134775, -163198, -144892, -350424, -346843, -324031, -290680, -309700, -365921, -194880, -140345, -134552, -295948, -197447, -80312, -327409, -292284, -208799, -206529, -399578, -374840, -190743, -157774, -235343, -278287, -116466, -239423, -239305, -450563, -125876, -217255, -411367, -266073, -237330, -175515, -347775, -376955, -224052, -399627, -276244, -116961, -359334, -171527, -184003, -249963, -104885, -267955, -408513, -302285, -437347, -226614, -290852, -448359, -197739, -354855, -273407, -294733, -210973, -224226, -234992, -260638, -380065, -362500, -366343};
+
+static constexpr pool_params_t op_2_pool_params = {
+    .batches = 1,
+    .input_h = 10,
+    .input_w = 10,
+    .channels = 64,
+    .filter_h = 2,
+    .filter_w = 2,
+    .output_h = 5,
+    .output_w = 5,
+    .stride_h = 2,
+    .stride_w = 2,
+    .pad_h = 0,
+    .pad_w = 0,
+    .act_min = -128,
+    .act_max = 127,
+};
+
+static constexpr fully_connected_params_t op_4_params = {
+    .batches = 1,
+    .input_size = 1600,
+    .output_size = 128,
+    .input_offset = 128,
+    .filter_offset = 0,
+    .output_offset = -128,
+    .multiplier = 1218594033,
+    .shift = -10,
+    .act_min = -128,
+    .act_max = 127,
+};
+
+// sequential/dense/MatMul [128, 1600], 40980 of 204800 weights non-zero
+static const int8_t op_4_values[40980] = {
+    -35, -44, 33, -50, -35, -43, -45, -40, -44, -34, 39, 42, -31, -68, -29, -40,
+    -62, -27, 52, -26, -39, -42, -36, 47, -40, -27, -45, 92, 97, 57, -34, 27,
+    43, 31, -38, 34, -28, 33, -35, 30, 44, -56, 50, 31, -27, -33, -62, 54,
+    -56, 38, 47, 29, 29, -26, 44, 77, 29, 42, 34, 58, 41, 27, -28, 32,
+    -27, 30, -35, -26, 37, 30, 42, 29, -31, -32, -57, 35, -43, -36, 40, 30,
+    -26, 68, 30, -65, -37, 45, -31, -73, -33, 28, -46, 80, -47, 42, -40, 40,
+    -30, -34, -32, -35, -37, -70, -72, -53, -41, -27, 30, -36, -55, 49, -61, -27,
+    -28, -44, -47, -49, -46, -40, -35, -55, -41, -32, -43, -39, -30, -53, 33, 29,
+    -54, -60, -44, -45, -56, -41, 76, -39, 30, 32, 31, -40, 43, -31, 36, 34,
+    45, 31, -33, 47, 28, 34, -29, 47, 54, 35, 30, 51, 30, -59, 47, -30,
+    51, -28, 53, 29, -35, -61, 33, 31, 34, 28, -37, -52, 60, 43, 52, 61,
+    28, 58, -44, -30, 43, 55, -30, 34, 40, 35, 28, -40, 26, -70, 42, -47,
+    -52, -48, 36, 47, 27, 39, -31, -28, -56, 28, -45, 33, -62, -41, -55, -31,
+    63, 32, -26, -68, -57, 47, -59, -28, -47, -38, 45, 31, 27, -43, -57, -34,
+    32, -30, -35, -46, -39, -46, -27, -33, 46, -28, -42, 35, -55, 41, 54, 84,
+    41, -38, -57, 32, 48, 35, 41, -36, 29, 26, -27, 66, 52, -33, -38, -31,
+    -27, 60, -52, -44, -28, -35, 101, 65, -33, 57, 35, -49, -46, 45, 29, 55,
+    38, -27, -58, 30, 45, 26, -27, -54, -34, 32, 56, -40, 41, 45, -38, 31,
+    -35, -32, -31, 46, 32, -43, 53, 47, -57, -49, 26, 30, -33, -61, -41, 29,
+    -38, -50, 41, 39, 29, 30, -39, 26, -28, -34, 81, -34, 26, 45, 26, 28,
+    -30, -26, 32, 60, -41, 41, -28, 28, -26, 46, 31, -35, -27, -35, -34, -39,
+    47, -43, 49, -47, 35, -34, -41, 39, 31, 42, -48, -40, 50, -65, 85, 42,
+    42, -46, -42, 40, -30, 44, -50, -30, -62, 40, 43, -64, -37, 58, 41, -64,
+    -52, -41, -35, 28, -94, -56, -39, -52, -35, -32, -26, -38, -68, -30, -59, -34,
+    -50, 46, -69, -31, -28, 43, 27, 53, 28, 48, 74, -30, 40, -28, 42, -54,
+    -28, 36, -54, 36, -56, -79, 42, 41, 26, -39, -31, 26, 52, -33, -37, 27,
+    37, -36, 35, 30, 28, 47, -32, -50, -57, -36, 34, 31, 36, 26, 29, -31,
+    27, 28, 31, 33, -27, 33, -34, -38, -29, 31, -33, 68, 41, 45, 56, 65,
+    -32, 28, 37, 31, -32, 28, 49, 39, 27, 39, 27, 26, 43, -31, -28, -41,
+    -29, -43, 35, -50, 26, -60, 29, -54, -40, -26, 26, -27, 35, -33, -72, -29,
+    -72, -36, 41, -50, -93, -46, -44, -38, 36, 42, 34, 41, 32, -39, 30, 30,
+    44, 28, 50, 54, 42, 51, -27, 26, -48, 42, 26, 43, -41, -28, -27, 52,
+    31, -41, 42, 30, 33, -63, -52, 28, -30, 66, 36, 29, 29, 37, 32, 44,
+    38, 32, -28, -34, -27, 30, -26, 81, 26, 55, 36, -27, -26, 29, -33, -48,
+    -56, -31, 45, -73, 26, 28, -50, -72, -46, -58, -26, 49, -34, -27, -59, -37,
+    -61, -27, -39, -38, -78, -40, 44, -44, -53, -71, -29, -49, -27, -31, 26, -48,
+    -55, -34, 44, -58, -39, -33, 32, -37, -48, -33, -34, 53, -26, -42, 39, 42,
+    26, -26, 31, -61, 26, 31, 30, 35, -26, 46, 35, -42, 29, 40, 40, 32,
+    26, 37, 76, -58, 34, 26, 28, -68, 33, 33, -42, -80, 63, -40, 28, 27,
+    29, 56, -44, 33, 36, 27, -30, 63, 35, 44, 30, 42, 27, 31, 45, 36,
+    30, 27, 30, 26, 44, 31, 35, 29, 34, 31, -55, -50, -30, -48, -27, -56,
+    27, 30, -38, -29, 43, -29, 27, 36, -35, 27, -28, 32, 34, 27, 28, -45,
+    -29, 26, -33, -26, 37, 46, -31, 41, 35, 41, -27, -35, -39, 55, -26, -32,
+    35, 34, 38, 37, 36, -54, 26, -32, -43, -33, -79, -42, 36, 40, -31, -43,
+    -32, -35, -59, -31, 34, -31, 51, 39, 40, -42, 38, -26, 35, 35, 43, -31,
+    -50, 37, 31, 41, 36, -56, -35, 29, -32, -49, -86, 32, 34, 38, -35, -41,
+    -41, -31, -40, 52, 52, 41, 39, 41, 40, 33, 27, -54, 27, -28, -39, -51,
+    34, 28, 32, 32, -68, 34, -31, 31, -30, -41, -51, 30, -50, 49, 26, -27,
+    32, 36, -30, -65, -64, 37, 45, 26, 49, -46, 41, 26, -34, 37, 38, -28,
+    -28, -29, 39, 39, 32, -58, 54, -36, -91, -26, 28, 58, 30, -51, -53, 43,
+    -78, -26, -47, 50, 42, -51, -26, -84, 32, 30, 61, -28, -32, 36, 39, 35,
+    33, -53, -88, -43, 50, -47, -39, -38, 38, -33, 42, -32, -69, -47, 47, -83,
+    34, 39, 41, -36, 61, 47, -39, 42, 47, 52, -54, 57, -58, -29, 33, 34,
+    -33, -26, 32, -31, -65, -51, -45, 38, 52, -44, 35, -31, 27, -40, 53, -27,
+    -47, -30, 26, -28, 35, -43, -26, -38, 30, -43, 52, 30, -42, 29, 35, -43,
+    51, 32, 30, 27, -48, 32, 48, -26, -27, -26, 31, 26, 26, 43, -27, -43,
+    -56, -33, -36, -32, -32, 34, -36, -35, -26, -26, -34, -30, -26, -46, -27, 37,
+    29, -54, 49, 35, -26, 46, -37, 28, -44, -47, 55, 48, -32, -48, -34, 27,
+    39, -35, -44, -26, -44, -38, -26, 32, -29, -29, 30, -36, -28, 39, -35, 45,
+    -31, -28, -27, 31, 57, 38, 33, 29, 30, -27, 33, 41, 44, -28, 28, -28,
+    39, 39, -56, -29, -60, -36, -29, 35, -28, 34, -51, 28, -59, 40, -61, 40,
+    31, -27, -28, 26, 29, 26, -31, -35, 35, 42, -27, 34, -41, -27, -28, -32,
+    -34, -37, -32, -36, -27, 28, -27, 27, -56, 28, -56, -26, -29, -62, -44, -87,
+    28, -34, -71, -36, -31, -38, -33, -72, -58, -57, -28, -75, -38, 31, 26, -31,
+    -39, -31, 71, -44, -48, -29, -27, -28, 26, 31, -34, -65, 29, -28, -36, 26,
+    27, 26, 29, -30, 29, 65, 33, 34, 28, 50, 42, 29, 37, 56, -72, 32,
+    -29, 38, 40, -35, -32, -39, -32, 37, -29, 37, 29, -41, -27, -34, 28, 34,
+    56, 47, 39, -30, -37, 26, -31, -33, 43, -66, 43, 76, 61, 35, -46, -27,
+    64, 37, -36, 56, 28, -41, 33, -68, -31, -27, 36, 34, 28, -28, 30, -68,
+    32, 31, 46, 53, 26, 28, -27, 29, -38, -37, 34, 27, 39, -43, 30, 33,
+    -28, 28, -31, -30, -28, 27, 37, 60, 35, 26, 27, -31, 32, 28, -27, -28,
+    -38, -27, -39, 32, -37, 43, -32, 32, -37, 68, 33, -42, -39, 55, 34, -30,
+    33, -27, 32, 31, 55, 28, 47, 44, 74, 26, 45, 32, 26, -59, 46, -26,
+    26, -30, 39, 28, 35, -28, -54, 34, -37, -28, -30, -29, -36, -32, 28, -29,
+    -29, -30, 31, 47, -41, 26, -29, 29, 46, 36, 31, 52, 33, 27, 29, 37,
+    36, -26, 34, 78, 71, 27, 56, -27, 29, -41, 26, -29, -27, -48, -38, -31,
+    -43, -39, 30, -30, 36, 31, 31, 30, -36, -54, -36, -29, 29, -40, 34, 33,
+    -32, -26, -27, -32, -26, 28, 33, 48, -26, 31, -49, -31, -39, -35, 28, -49,
+    44, 39, 39, 27, 49, -28, 47, 38, 27, 28, 26, 33, 43, 30, -47, 27,
+    48, 45, 52, 33, -35, -33, -48, 28, -32, -27, 38, -28, -30, -26, 32, -27,
+    -32, -55, 29, 29, -36, 28, -27, 34, 38, 34, -32, 38, 75, 29, -29, -28,
+    -34, -42, -29, 29, 26, -33, 31, 38, 27, -35, -29, 35, 44, 27, 28, -40,
+    34, -38, -45, -28, -41, -61, 29, -49, -37, -34, -52, -31, -68, 33, -28, -58,
+    -36, 28, 50, -28, -28, -26, -29, -31, 39, -27, 37, 40, 31, -28, 27, 29,
+    -36, -33, 33, -31, -45, -35, -28, -32, -28, -30, 31, 34, 28, 33, -29, -54,
+    36, -39, 32, 30, 36, 26, -29, 36, 29, -48, -32, -45, 37, -45, 39, -62,
+    -58, -31, 44, 42, 41, 35, -40, 36, -37, 32, 37, 48, 46, 32, 42, -29,
+    26, 35, -38, 26, 34, 33, -45, 51, 26, 29, 26, 38, 38, -29, 33, -47,
+    44, -27, 41, -41, 30, -46, -36, 36, 55, 46, 32, 37, -29, 27, 31, 30,
+    47, 36, 39, -26, -64, 27, 37, 48, 27, 28, 26, -29, 26, 60, 49, -36,
+    39, 28, -29, 29, 33, 50, 28, 59, -37, 52, 33, 40, 42, -43, 29, -33,
+    -26, 38, 47, 50, -29, -47, 32, 28, -35, -52, -30, -36, 42, -38, 27, -37,
+    43, -35, 32, -26, -33, -54, 32, -39, 64, 37, -40, -49, -37, 31, 52, 68,
+    31, 28, 47, 41, -41, 35, -36, 49, 39, -27, -41, 52, -27, 27, 39, -36,
+    -29, -32, -38, -43, -33, -42, 32, -30, 39, 26, 27, 32, -28, -26, -40, -47,
+    37, -26, -36, -30, -41, -35, 37, 34, -37, -33, -55, 29, 36, -36, -38, -35,
+    -26, -60, 40, 49, -27, -46, 28, -33, 44, -29, -45, 39, 32, -28, 33, -40,
+    -49, 36, -28, 55, 26, 37, 37, 31, 33, 30, 29, 41, 52, 33, -40, -29,
+    69, 54, -38, -27, 56, 27, 26, 34, 30, 30, -37, -28, -34, -26, 31, 33,
+    -29, 35, -29, -31, 45, -38, -55, -40, 29, 30, 38, 41, -31, 33, -48, 29,
+    26, 29, -35, 26, 27, 40, 42, 54, 40, 38, 30, 30, 34, 52, -26, -26,
+    -30, -29, -28, -31, -30, -29, -27, -27, -26, -30, -27, -27, -29, -27, -27, -27,
+    -26, -30, -26, -29, -27, -26, -27, -26, -27, -29, -29, -26, -28, -26, -26, -28,
+    -27, -27, -28, -27, -27, -26, -31, -30, -26, -30, -26, -27, -27, -28, -27, -26,
+    -30, -27, -27, -30, -26, -29, -32, -29, -26, -30, -28, -28, -26, -27, -27, -27,
+    -29, -26, -29, -29, -27, -27, -27, -27, 27, 40, 29, 67, 32, -28, 27, 26,
+    37, 56, 39, 41, 26, -29, 49, 40, 32, 36, 31, 27, 31, -44, 28, 81,
+    -27, 36, -32, 28, 28, 34, 32, -64, -68, -50, -40, -41, -31, 36, -42, -29,
+    -33, -45, -41, -97, -38, 31, -46, 41, -32, -34, -26, -27, -69, 39, -29, -42,
+    -42, 27, 50, -30, -34, -27, -35, 40, -30, 38, 35, 38, -36, -27, 35, -36,
+    45, -37, 29, 28, 39, -39, 29, 37, 28, 27, -52, -26, 33, 62, 34, -28,
+    31, 28, 44, 36, 34, 35, 34, -32, 33, 49, 26, -53, 31, 26, 37, 30,
+    -35, 28, -38, 65, 35, -29, 39, -31, -46, 32, -30, 33, 68, 40, -37, 30,
+    40, 28, -33, 30, 45, 30, 29, 53, 28, 28, -28, -34, 46, 28, 43, 29,
+    -32, 28, 38, -53, -30, 68, -32, -35, 35, 36, 30, 72, -26, 30, -26, -28,
+    48, 38, 50, 37, -27, -36, -28, -27, 44, -36, -32, -35, -29, -44, 30, -42,
+    30, -28, 26, -41, -29, -28, -46, -33, 32, -35, -30, 28, -36, -34, -30, -37,
+    -46, -27, -32, 57, 29, -29, 28, 26, -48, 26, -30, 32, 35, 28, -39, 26,
+    -53, -39, 41, -35, -35, -31, -30, 26, -28, 26, 28, -29, -26, -29, -43, -36,
+    39, -30, 27, 46, 32, -33, -35, -40, 36, -46, -26, -48, -28, -29, 28, 27,
+    -35, -39, -32, -36, -33, -59, 27, -28, -39, -31, 27, -44, -36, -38, 35, -33,
+    -35, -38, -36, -35, -35, -28, -28, -31, -38, -31, -28, -37, -30, -38, -35, -30,
+    34, -28, -30, -26, -36, -27, 32, -35, -28, 30, 31, -36, 32, 28, -42, -41,
+    -35, -29, -29, -34, -26, -34, -47, -48, -26, 44, -29, -30, -30, -38, -29, 32,
+    -33, -31, -27, 26, -28, -31, -31, -28, 34, 29, 36, 29, 26, 30, 49, 28,
+    47, -41, -31, -29, -40, -28, -28, -26, -42, -31, 45, 31, 26, 32, 43, 44,
+    -34, -26, -26, -28, 30, 27, -29, 38, 29, 40, 45, 31, 56, -35, 29, -42,
+    43, -42, -26, -39, 53, 32, 64, 38, -36, -31, 38, 58, 72, 26, 31, 34,
+    41, 37, 26, 27, 26, -95, 45, 64, 29, 61, 47, -32, 30, 88, 29, 32,
+    28, 33, 34, -26, 26, 26, 26, -55, 52, -26, 61, 28, 37, 32, 41, -27,
+    43, 27, -27, -30, 36, 29, 66, 45, 45, -28, -33, 37, 44, 33, -52, 38,
+    44, 45, 43, 28, 43, 32, 36, 30, -34, -52, 35, 59, 29, 38, 47, 39,
+    64, 29, 47, 38, 33, 27, -32, -33, 30, 52, 55, 29, -28, -37, 31, 26,
+    -30, -37, -44, 34, 27, 27, -29, 73, 26, 47, 32, -27, 33, 68, 58, 37,
+    32, 29, 36, 30, 34, -29, -41, 62, -32, -29, -35, 27, -41, 52, 70, -42,
+    50, -34, 31, 30, -33, -36, 35, 34, -43, -30, 26, 30, 44, -31, -49, 49,
+    44, 33, 39, -29, -41, -39, 28, -28, -40, -39, 38, -50, 58, 27, 42, 36,
+    33, 36, -41, 41, 34, -34, -32, -42, -34, -30, -46, 28, 34, -52, 41, 33,
+    -26, -48, -31, -47, -35, 29, 26, -44, -28, -26, 34, 29, -40, 46, 26, 30,
+    48, -30, 58, 32, 57, -35, 37, 30, 31, -32, -34, -26, -44, 69, -52, 29,
+    34, -40, -50, 36, 28, -31, 26, -26, 26, 39, 36, -32, -31, -32, -39, -42,
+    29, -69, 27, -49, -30, 37, 29, 34, 30, -33, 45, -59, 27, 36, 38, 50,
+    -36, 51, -42, 26, 27, 42, -30, 34, -33, -33, -38, -31, -65, -36, 41, -26,
+    -30, 28, -38, 26, 27, 26, -29, -33, 28, -37, 26, -44, -31, -41, 30, 26,
+    -26, 29, 45, 54, -40, 40, 31, 28, -33, 32, 34, 38, 48, -26, 26, -48,
+    55, 38, -34, 33, 26, 28, -28, 28, 33, -31, 51, 32, 42, 30, -36, 26,
+    30, -31, -41, 43, 30, 34, 42, 34, 26, 30, -29, 31, -29, 29, -41, 53,
+    -27, 51, 26, 33, 30, 42, 31, -27, 26, -39, 28, -36, 27, 32, -40, -35,
+    32, 32, 26, 35, -60, 41, 42, -36, 47, -27, 36, 34, 41, -29, 42, -27,
+    26, 41, -29, -26, 26, 27, 31, -39, -27, 26, 30, -55, 36, 27, -26, 47,
+    -32, 30, -26, 28, -73, -67, -29, -33, -51, 27, -29, 28, -57, 44, 34, -43,
+    28, -41, 33, -31, 38, 40, 28, 38, 27, -26, -30, -30, -48, 36, 46, 35,
+    36, -43, 29, 43, 36, 31, 28, -43, -46, 32, 32, -26, 61, 27, 41, 32,
+    29, 29, 41, 33, 42, -32, -50, -42, 45, -34, -39, 37, 43, -35, -37, 41,
+    35, 30, 40, 40, 70, 51, 46, -31, -31, 28, 37, -46, 28, 38, 37, 33,
+    -29, 37, 28, 46, 44, 51, 56, 29, 40, 34, -34, 28, 31, 50, -38, -27,
+    39, -48, -54, 31, 43, 27, 32, 38, 42, 40, -47, 45, 36, 41, -26, 51,
+    -34, 30, 26, -46, -29, 35, -28, 28, 42, 27, 27, -30, 32, -31, -33, 34,
+    27, -35, -29, -62, -49, 38, 27, 34, -30, 39, -51, -33, -34, 53, -42, 52,
+    51, 43, -32, -27, 42, -34, 41, -31, -32, -48, -39, -27, -41, -34, -39, -71,
+    34, 59, -26, 33, -31, -26, 28, -66, -43, 39, -30, -33, -27, 32, -36, 33,
+    -43, -44, -44, -32, -34, -49, -48, -27, -35, -32, -37, -28, -32, -35, -34, -27,
+    -32, -33, 26, -32, -37, -27, 45, -36, 30, 31, 36, -30, -43, 26, -33, -26,
+    -31, -49, -27, -33, 31, -49, -39, -31, -33, -56, -29, -36, 26, -31, -36, -43,
+    -33, 33, -28, -33, -28, -26, -30, -42, -44, -33, -32, 44, -26, -36, 39, -28,
+    -51, 26, 33, 26, 31, -32, -33, 28, 26, -34, 32, 43, 60, 32, -33, 31,
+    28, 26, -43, -26, 32, 50, 28, 27, 26, 33, 59, 32, 31, 40, 34, -35,
+    37, 31, 26, 56, 40, 33, 28, 34, -32, 27, 40, 31, -30, 32, 27, 36,
+    49, -27, 27, 36, 39, 30, 33, 49, 35, -37, -29, 33, 26, -52, 29, 31,
+    46, 28, 37, 35, 26, 28, 36, 29, 27, 34, 34, 28, 30, 48, -28, 31,
+    -43, 29, 26, 26, 48, 35, 26, 59, 31, 30, 38, 34, -42, -47, 30, 40,
+    28, -40, 29, 34, 36, 35, 37, 43, 29, 32, -44, 28, -55, -52, 28, 40,
+    50, 43, -44, 27, 41, 78, 88, 26, 32, 31, 31, -30, 46, -40, 61, 46,
+    40, -40, -32, -44, 48, -30, 38, 50, 78, 46, 27, 63, -26, 33, 26, 45,
+    29, 56, 49, 37, -27, -44, -28, 39, -30, -29, 33, 26, -27, 42, 42, 45,
+    32, 38, 27, -26, 26, 31, 39, -33, -37, 29, 30, -30, -36, 26, -54, 31,
+    -48, -34, -40, -62, 29, -39, -30, 41, -52, -28, -29, -35, 42, -32, 36, -61,
+    -79, 34, 32, 29, 29, -28, -49, 37, 38, 29, -46, -29, 33, -37, -44, -94,
+    39, 39, -30, 28, 64, -27, -42, -30, 63, 70, -38, -33, -32, 26, -27, 31,
+    -27, 26, -36, -31, -37, 50, 61, -36, 37, 29, 29, 28, 30, -59, -36, -36,
+    30, -37, -30, 53, -41, -33, -30, -31, 32, 36, -31, -43, 30, 35, -57, -34,
+    -42, -36, -26, -31, 35, -45, -55, -53, -28, -30, 27, -42, -54, -46, -42, -56,
+    -51, 46, -42, -51, -26, -30, -35, 28, 39, -30, -31, -37, 43, 40, -33, -30,
+    26, -29, -48, -61, -29, 32, 37, -35, -30, -32, -34, -44, 27, 58, -37, 29,
+    26, -28, 41, 44, 34, 27, -29, -32, -31, 27, -41, 36, 38, 27, 41, -27,
+    81, 48, 36, 34, 41, 37, -35, 28, -28, -30, -36, -34, 48, 28, 44, -43,
+    43, 29, 48, -27, 60, 39, -37, 26, -43, 27, 28, 36, 50, -27, -47, 27,
+    36, -31, 27, -46, -51, 39, -30, -26, -41, 61, 55, -72, -26, 32, 45, -61,
+    40, 32, 26, -44, 35, 34, 43, 33, 31, 37, -41, 37, 34, -28, 32, 32,
+    31, 38, 31, 49, 26, 31, 45, 62, -32, 28, 111, 31, 32, 47, 29, 34,
+    28, 27, 29, 33, 33, -27, -35, 35, -26, 26, -38, 28, 46, 52, 52, 30,
+    37, -41, 33, 29, 54, -31, -32, 27, 31, 39, -37, 47, 34, -55, 54, 29,
+    34, 64, 42, -39, 53, 34, 37, -45, 48, -29, 47, 45, 40, 26, -29, -29,
+    -31, -34, 36, 28, 31, 34, 27, -30, 27, -46, -43, 33, 38, -32, 26, -37,
+    37, -26, -30, 55, -50, 48, -34, 31, 27, 30, 32, 28, 38, 37, 26, 44,
+    35, 44, -48, -26, -42, 33, 27, 26, 35, -45, -67, -31, -34, 43, -56, 29,
+    -37, 36, 34, 28, -45, 30, 35, -27, -53, 30, 31, 41, 39, -44, 35, 30,
+    -48, 30, -26, 44, 33, -39, -28, 37, -38, 26, 43, 31, 37, 50, -59, -35,
+    -32, -26, -30, 42, -35, -45, 29, -29, -26, 30, -32, 66, -36, -29, -26, 26,
+    -54, 44, 28, 26, 30, -29, 31, 31, -29, -37, 34, 57, 31, 29, -26, 29,
+    -43, -31, 28, 38, -27, 51, 29, 41, -35, 55, -28, 50, -32, -38, -33, -34,
+    -32, -50, -28, -65, -36, -41, -45, -29, -62, 32, -26, -44, 29, -27, 26, -34,
+    -67, -34, 29, -37, 37, -66, -30, -28, -36, 27, 31, 38, -34, -41, -87, 27,
+    27, 36, 28, 30, 31, -31, -52, 37, 28, 31, 38, 28, 31, 34, -27, 32,
+    50, 29, -27, -29, -37, 42, 35, -26, -26, 33, 42, 30, 48, 27, -32, 30,
+    -29, -27, 26, -36, 27, -27, 36, 33, 30, 38, -49, 30, 31, -34, -42, -28,
+    -46, -41, 36, -26, 27, 50, 28, -33, 28, -38, 27, -41, -31, 35, 47, 63,
+    30, 36, 39, -28, 27, 50, -32, 47, 72, 41, 45, 54, 25, 26, 43, -41,
+    53, 54, 31, 63, 61, 34, 46, 46, 55, -27, 25, 27, 25, 30, 63, 29,
+    27, 33, 49, 34, 35, 31, 35, 35, 29, 68, 44, -28, 25, 30, 41, 42,
+    28, 28, -30, 29, 44, -30, 43, 30, -31, -26, 27, -27, -38, 35, -63, 69,
+    32, 63, 29, -32, -26, 31, -49, -29, -41, -31, -32, 32, 34, -30, 38, -40,
+    27, 27, -30, 26, 29, 31, -27, 63, 43, -32, 39, 29, 63, 34, 33, 30,
+    32, 85, 25, 40, 44, 32, 32, 48, 27, 27, -28, 27, -27, 35, 32, 25,
+    25, -25, 40, 36, 48, 34, 26, 44, 36, -30, 37, 30, -29, 32, -27, 45,
+    27, 63, 25, 34, -25, -45, -29, -42, 39, 35, 33, 26, 42, 54, -53, 25,
+    31, 46, -33, -25, 31, 27, 30, 45, 42, 35, 32, 39, 25, 32, 55, 28,
+    26, 46, 45, 25, 57, 26, 43, -32, 46, 39, 76, 32, 49, 25, -25, -60,
+    42, 25, 32, 36, -45, 60, -36, 61, 29, 41, 48, 42, 33, 55, 33, 58,
+    -50, 42, -60, 57, 27, 51, 31, 28, -26, 27, -36, 40, -27, 45, 25, 44,
+    25, -49, 41, -61, -31, 43, -25, -28, 44, -29, -54, -33, 43, 38, 41, -29,
+    32, 44, -39, 29, 37, 43, -26, 25, 26, -26, 29, 54, -29, 25, -38, 35,
+    27, -28, 32, 27, 30, 41, 49, 38, 31, -32, 41, 25, 27, 34, 32, 36,
+    26, -47, 30, -34, -34, -48, 32, 34, -70, 27, -27, 37, 27, 29, -28, -41,
+    -29, -35, -30, 34, -32, -30, -27, -32, -37, 53, 27, -31, -27, 26, -38, 29,
+    -40, -43, 33, 48, 38, 34, 26, 35, -70, -47, -28, -44, -38, -35, 32, -35,
+    -63, -30, -26, -32, -28, -57, 29, -50, -56, -27, 35, 37, -25, -39, -44, -33,
+    -25, -39, -34, 43, -42, 29, -26, 43, 38, -40, -27, -46, 55, -41, 26, -51,
+    56, 29, -26, -49, -39, -53, -27, -39, -31, 27, -28, -34, -25, -36, -38, -36,
+    -51, -58, -40, 25, -37, -30, -45, -31, -43, -36, -28, -30, -38, -28, -25, 29,
+    28, -48, 30, -32, 36, -33, 27, 37, -26, -41, -27, 36, 39, -34, 40, -31,
+    47, 27, 37, -27, -26, -48, -41, 25, -28, -25, -42, 25, 25, -32, -25, -34,
+    -53, -32, -28, -38, -33, 60, 48, 41, 45, -30, -28, 51, -30, -38, -32, 48,
+    26, 52, -30, 47, 25, 79, 31, 29, 32, -48, 47, 44, -37, -70, -37, -43,
+    -30, 36, 33, -40, -42, -30, -30, -32, -28, 31, 26, 51, -25, -53, -52, -34,
+    -34, -57, -60, 40, -32, -32, -32, -40, -26, -32, -35, -50, -73, -61, -37, -36,
+    46, -39, -35, -59, -72, -42, -70, -51, 44, -72, -30, -51, -54, -33, -25, -65,
+    -49, -33, -46, -78, 41, -28, -30, 42, -39, 27, -57, 41, -40, -30, -66, -66,
+    28, -30, 44, 32, 71, -27, -27, -56, -78, -37, -30, -49, 25, -54, -69, -37,
+    -62, 38, -85, 64, -27, 71, -40, 25, -31, 28, 30, -41, -49, 61, 38, 80,
+    -100, -28, -52, -52, -33, -25, 50, -30, -46, -44, -25, -42, 52, 30, 45, 28,
+    26, 31, 34, 25, -28, -40, 46, 39, -34, 36, 56, -33, 40, 34, 76, 35,
+    26, -29, 26, -52, -28, -50, 37, -36, -31, 27, -35, 36, -27, 34, 29, -47,
+    35, -30, -29, -27, 29, 29, 43, -48, -28, -38, -72, -45, 47, -33, 37, -30,
+    -35, -40, 44, 39, -51, 42, -34, -65, -32, -38, -59, -27, 29, -36, -62, 28,
+    38, -53, -39, -25, -46, -46, -53, -25, 49, -42, -32, -53, -69, -49, -38, -53,
+    -97, -37, -25, 30, -46, 51, 38, 64, -43, -52, -60, -66, -48, -32, -46, -36,
+    -42, -47, -35, -26, -38, -68, -59, 25, -45, -56, -60, -48, -43, 42, -56, -39,
+    -27, -25, -60, -44, -33, 30, 71, 35, -45, -31, 44, -28, 66, -32, -37, -26,
+    68, -30, -49, 34, 28, -32, -37, -37, 29, -47, -38, -45, 60, -64, 55, -58,
+    -45, -33, 52, -39, 29, -26, -31, -44, 29, 44, 32, -37, -37, -29, -50, -34,
+    36, -29, 43, -36, -47, 28, 36, 27, 42, 27, -25, 26, 36, 38, 29, -26,
+    -35, -50, 29, 25, 26, 33, -46, 38, 33, -39, -39, -31, -37, 29, -36, 27,
+    -37, 29, 32, 42, -42, -27, 27, 30, -52, 42, -37, -50, -27, 53, -29, -39,
+    -42, 52, 51, -30, 33, -38, 26, -36, 53, -32, -25, -31, -27, -36, 26, 43,
+    26, 43, -71, 46, -25, 33, -64, -25, -39, -61, -34, -31, 33, 32, -44, 31,
+    -33, -43, 37, -33, -42, 38, -36, -25, -40, -41, 67, -29, -38, -32, -38, -48,
+    -57, -33, 37, -31, 29, 28, 27, -50, -47, 34, 26, 46, -30, 37, 42, 32,
+    39, 46, -47, 30, 48, 33, 37, -41, -30, 25, -35, 34, -45, 34, -27, 30,
+    -32, -45, -29, -46, -26, 53, 29, -26, 45, 44, 29, 46, 33, -35, 26, 30,
+    28, 36, -33, -25, 31, 27, 52, 35, 40, 51, -42, -26, -40, 36, 30, 28,
+    -33, 42, 35, 40, 50, -26, -38, -27, -44, 27, -32, 40, -41, 27, 25, -58,
+    49, 30, -25, -28, 30, -49, -42, 50, -54, -29, -57, -43, -34, -38, -31, -25,
+    50, -61, -41, -48, -70, -37, -38, -35, 29, -39, 25, 37, -25, 34, 35, 56,
+    -29, 66, 31, -30, -48, -32, 38, -56, -26, -33, -25, -35, -31, 29, -38, -32,
+    -33, 48, 51, 37, 37, -30, 29, 34, 52, -40, -36, -27, -37, 43, -36, -35,
+    38, 32, 50, 46, 34, 35, -28, 27, 25, 63, 27, 31, 30, 45, 28, -29,
+    -43, 44, 55, 42, 28, 34, 83, 26, 42, -37, 35, -36, -33, -34, 41, 27,
+    -25, 25, -38, 41, 38, -38, 35, -42, -29, -41, 54, -41, 38, 67, -36, 38,
+    52, 27, -42, -43, -44, -46, -26, -46, -26, -28, -31, -40, -58, -52, -52, -44,
+    -36, 26, -39, -51, -36, -37, -25, -32, -26, -49, 26, -71, -44, 26, -46, -41,
+    25, -27, 45, 47, -37, -29, -40, -46, -30, -36, -27, 43, -36, -31, 31, -30,
+    -37, -40, 26, -38, -37, -45, 30, -30, -25, 61, 26, -26, -25, -40, 25, -33,
+    -36, 36, 34, 45, 41, 32, 40, 36, -67, 35, 27, -38, 26, 36, 38, 35,
+    29, 36, 42, 28, 27, 30, 33, 30, 51, 42, -40, -37, -58, 25, 41, 29,
+    27, 45, 31, 92, -25, 47, 25, 28, 27, 28, 32, -49, -46, -39, 25, 34,
+    -38, -57, -43, 25, -26, -27, -65, -41, -28, -28, -25, -40, -70, -26, -50, -27,
+    -29, -48, -38, 40, -31, 34, 32, -30, 52, -29, 27, -25, 26, -27, -33, -34,
+    27, 37, 33, -29, -27, -26, 30, 27, -26, -27, 29, 39, -31, -40, 25, 38,
+    40, 43, 27, 66, -27, -28, 40, -27, 36, 33, 30, 37, 31, 33, -26, -39,
+    25, 35, -35, -41, 37, 30, -43, -30, 30, 28, 25, -34, 56, -33, 45, 39,
+    -29, 38, 31, -26, 26, 27, 29, 43, 32, 28, 32, 32, 32, 38, 34, 28,
+    39, -36, -65, -32, 36, -25, 53, -45, -40, -32, 31, 44, -31, -29, -28, -36,
+    27, -29, -29, -29, 50, -28, 54, 50, 26, 26, -32, 34, 54, 34, 30, -25,
+    47, -52, -33, 38, -25, -27, 31, -44, 30, 34, -35, -27, 33, 28, 33, -33,
+    35, 29, 37, -25, 26, 32, 31, -37, -31, -28, -35, 49, -28, 33, -32, -33,
+    47, -35, 38, 28, -48, -32, 25, 34, -47, -50, 46, -33, 33, -26, -33, 25,
+    -52, 62, 49, 28, -28, 46, 40, 67, -25, -26, -27, 29, -29, -35, 25, 36,
+    -26, 26, -30, -35, -32, 28, 29, 34, 41, 35, 38, 40, 27, -31, -46, 33,
+    41, 28, 33, -34, 35, -30, 26, -28, 28, -29, 38, 34, 37, -29, -28, -30,
+    -27, 32, -28, -34, 30, 25, -61, 44, -40, -26, -25, 33, 32, 41, 61, -26,
+    30, 26, 47, -33, -28, 26, -28, 40, -30, -31, -44, -28, 36, -33, 36, -30,
+    -32, 33, -45, -32, 25, -31, -26, -33, -33, -32, 26, 49, 32, 26, -42, -30,
+    -48, -37, -43, -47, -29, -41, -30, -32, -50, 28, -32, -33, -30, 34, -27, 35,
+    38, -29, -26, -33, -34, -50, -27, -33, 35, -28, 52, -44, -26, -27, -34, -42,
+    -37, -42, -55, -36, -30, -26, -27, -28, -26, 31, -56, -29, -37, 29, 25, 26,
+    39, -52, -31, -25, 26, -27, -30, -29, 33, 30, 26, 25, 29, -26, 36, -28,
+    -52, 30, -25, 29, -25, -28, -69, -29, -31, 27, 32, -44, -27, 30, -38, 42,
+    -30, -43, -65, -28, -45, -42, -68, -35, -26, -36, -32, -37, 43, -29, 30, -35,
+    -53, -43, -37, -58, 54, 36, -33, -32, -75, -38, -31, 25, -54, -88, 35, -29,
+    -27, 26, 33, 49, -38, -36, -28, -52, -26, -27, -29, -40, 27, 36, -35, -29,
+    -26, 54, -25, 28, -50, -32, 41, 27, -25, 33, 30, 27, 25, 27, -25, -31,
+    33, -27, 38, 38, 27, 27, 35, 37, 52, -25, 50, 40, 32, 25, -30, 74,
+    75, 33, 29, 32, 41, 36, -47, -26, 43, 33, -29, -67, 33, 34, 39, -65,
+    -48, -36, -35, -32, 27, -32, -39, 27, -45, -41, -25, -27, -26, -47, -29, -30,
+    39, -61, -35, -26, -31, 31, -29, -30, 32, -27, -26, -30, 41, 34, -34, 29,
+    27, -25, 54, 30, 36, -30, 48, 34, 25, -43, 27, 66, -31, 29, 54, 39,
+    -37, 31, 41, 88, -40, 56, -30, -49, 58, 29, 41, 42, 28, 31, 25, 26,
+    29, 41, 53, 28, 26, 31, 32, -35, 26, 27, -40, -25, 27, -29, -46, -49,
+    36, 26, 38, -30, 26, -30, 66, -49, -31, -29, -37, 39, -28, 28, -30, -27,
+    -25, 35, 34, 31, 30, 30, -27, -41, 25, -39, 39, -32, -42, -62, 30, -40,
+    -30, -36, -31, -70, -63, -33, 26, -31, -54, -35, -27, 50, 44, 34, -25, -31,
+    65, -43, -31, -29, -26, 31, -39, 30, 33, 27, 52, -36, 49, 30, -25, 27,
+    30, 27, 32, 28, -27, 31, 26, 34, -28, -26, 29, 26, 35, -29, -34, 25,
+    -33, -27, -33, 27, 34, -32, 60, -27, 33, -31, -53, -26, -53, 31, 29, -29,
+    -30, -29, -66, 34, -69, 28, -57, -28, -34, -32, -34, -54, -51, -42, 50, -42,
+    -62, -27, -25, -26, -26, 25, 29, -45, -36, -36, -31, -40, -48, 55, 45, 26,
+    35, 33, 33, 56, 41, -28, 59, 44, 54, 33, 38, 26, -34, -48, 54, 30,
+    33, -26, 30, -26, 34, 33, 26, 35, 27, 26, -41, -32, 36, -28, 30, 32,
+    29, 27, 34, 35, -32, 43, -28, -33, -33, 42, -29, -55, 25, -29, 30, -29,
+    26, -38, -26, -32, -27, 51, 28, 28, 30, 38, 54, -25, -32, 25, -36, -27,
+    36, -29, 52, -45, 32, 27, -28, -32, -32, 32, 51, -47, 38, -27, -38, 34,
+    27, 31, 25, -44, -32, 30, 46, -32, 27, 26, 31, -30, 29, 29, -34, 29,
+    -25, -32, -29, -29, -26, 82, -28, -30, -25, -28, -28, -28, -33, 47, -33, -38,
+    -33, 72, -27, -32, 41, 43, 27, 25, -27, 30, 47, 45, 44, -43, -45, -26,
+    32, 39, -32, -26, -25, -31, -32, 33, 27, 34, -44, -28, -30, -28, -27, -27,
+    25, 27, -25, -37, -33, 37, -31, 34, -35, -33, -31, -39, -33, 34, -25, 32,
+    42, 39, 31, 40, 33, 28, -26, 25, -52, -64, -48, -27, -31, 43, -28, -33,
+    26, 41, -64, -30, 25, 26, -25, -32, -26, -33, -38, -62, 40, 27, -28, -29,
+    -33, 32, 32, 52, 25, 36, 36, 25, 64, -26, 26, 29, 34, 41, 58, 28,
+    -29, 43, -33, 41, 25, 40, 42, 51, 35, 31, 30, 43, 26, -32, 37, 32,
+    26, 29, 25, -33, -41, 28, 28, 25, -39, -28, -30, -34, 25, -48, -65, 27,
+    -40, -30, -47, -51, -31, -27, -40, -35, -36, -38, -28, -36, -52, -68, -36, -39,
+    -29, 27, 33, 64, 45, -25, -30, 29, 66, 29, -29, 47, 52, -27, 26, 46,
+    -38, 26, 30, 42, -31, -41, -51, 30, 50, -28, 70, 66, -38, -29, -47, -30,
+    54, 25, 26, 41, -32, 37, 41, 34, -32, 25, -38, -37, 34, -37, -32, 32,
+    -37, 40, 36, -37, -28, -40, -35, 33, 50, 27, -42, -36, -27, 30, -27, -40,
+    -58, -30, -33, -38, -40, 25, -60, 27, -31, -27, -63, -46, -31, 33, 42, -31,
+    36, -28, -39, 30, 37, 26, 44, -25, 43, -49, 34, -46, -34, -26, -44, -32,
+    -29, 31, 38, 26, 26, 55, -29, -27, -28, 26, 33, -33, 35, 28, 37, 26,
+    -34, -31, 26, 29, 32, 27, -45, -33, -36, 34, -35, -31, 33, -42, -29, 27,
+    -43, -25, -31, -29, -47, -30, -29, 28, -29, 32, -27, -25, -37, -49, 41, -27,
+    -25, -32, -31, 28, -34, -29, 30, 32, -25, 27, -25, 27, -34, 33, -31, -31,
+    -36, -37, 25, 35, -31, -39, -27, -34, 42, -54, -48, 33, 29, -33, -32, -44,
+    -25, -42, -33, 79, 48, -27, 42, 30, -33, -27, 34, 27, 51, -40, -25, -39,
+    -62, -77, -28, 28, 46, 31, 30, 30, 42, 35, -64, -47, 60, -25, 46, -26,
+    -32, -33, 28, -29, 50, -32, -34, -38, 27, 31, 36, 25, -40, 27, -33, -28,
+    39, -33, 36, -28, 43, 27, -33, 45, -42, -43, 26, -33, 25, 27, 27, -40,
+    -34, 38, 27, -35, -33, 34, 25, 58, 28, 29, 25, -33, 25, -27, 45, -26,
+    44, 25, -34, -32, -25, 66, 31, 76, 42, 32, -40, -34, -31, -27, 27, 51,
+    56, 25, -26, 42, -25, -35, 26, -33, 37, -56, 33, -75, -40, 53, -34, 27,
+    -28, 25, -27, 34, 34, 28, -29, -37, -57, -65, -42, -30, 35, -42, -25, -54,
+    -28, -27, -28, 27, 27, -31, -26, -34, 34, -28, -44, 28, -31, -27, 43, -25,
+    -30, 41, -25, -26, 25, 38, 26, 46, 26, 67, 30, -28, -34, 39, 38, -30,
+    34, -28, -26, 31, 28, 29, -34, 30, 29, -56, -31, 34, 30, -36, -26, -31,
+    29, -26, -25, -32, 27, 35, -40, -38, -26, 31, -25, 25, 29, -26, -32, -25,
+    27, 25, -29, 32, 25, -41, -25, 27, 25, 45, 50, 27, -37, -25, -52, 32,
+    -26, 51, 32, 29, 49, 32, 27, 30, -26, 26, 43, 53, 49, 30, -31, 51,
+    25, -25, 42, 35, 27, -26, -32, 30, -34, 30, 25, 46, 27, 26, -28, -29,
+    -30, -38, 32, 40, 48, -30, 29, 34, 64, 50, 39, 25, 56, 28, -34, -59,
+    42, 29, 26, 25, 29, 26, -29, 25, -28, 46, 31, -26, 36, 30, 37, 48,
+    28, -36, 46, 26, 25, 32, 36, -44, -28, -40, -92, 50, 35, -47, 58, -27,
+    -28, 25, 43, 25, 29, -33, -35, 45, 48, -29, 43, 34, -65, 29, 45, -66,
+    47, -64, -26, -33, 35, -68, -40, 30, -71, 25, -27, -29, 25, 40, -47, -56,
+    -77, -25, -25, -25, -44, -29, -29, 33, 28, 32, 25, 34, 48, -42, -32, -38,
+    -50, 35, -46, 63, 26, -27, -25, -25, 25, -43, 26, 49, -48, 35, 27, -35,
+    27, 29, -60, -27, 40, 46, -38, 36, -30, -33, -50, -25, -50, 27, -33, 31,
+    -42, -30, -58, 25, 34, -29, -42, -53, -38, -40, -33, -53, -41, -42, -29, 28,
+    -30, -27, 27, -42, -49, 26, -47, 37, 27, 31, 26, 42, -33, -33, 28, -45,
+    31, -36, 36, 25, 36, -31, 27, 45, 25, 32, 25, 28, -29, 35, 31, 30,
+    56, -34, 46, -31, -31, 40, 49, -33, -32, 30, 42, 52, -28, 40, -32, -26,
+    -31, -31, 56, 25, 33, 91, 49, -34, 33, 33, 32, 28, 59, 77, -34, -28,
+    40, -37, 26, 32, 33, -43, -39, 42, -26, 25, -27, -58, -27, 38, 43, 46,
+    36, 33, -25, -57, 29, 53, -49, 26, -29, 29, 36, -47, -45, 37, 28, -25,
+    -43, -38, 62, 34, 36, -41, 32, -38, 26, 26, 51, -37, 28, -39, 25, -44,
+    31, 26, -29, -33, 39, -29, -25, -55, -37, 56, 48, -44, -31, -33, 55, 29,
+    -30, 26, 41, -29, -29, 37, 41, 33, 43, -57, -35, 26, -35, -25, -51, 54,
+    42, -41, 45, -38, -60, -45, -36, 25, -39, -26, -36, -49, -52, -38, -29, -28,
+    28, -28, -28, 41, -25, -27, -39, -32, 27, -35, 34, -26, -30, -43, -42, 34,
+    -27, -40, -31, 32, -32, -41, -28, -50, 31, -34, -28, -49, -39, 25, -68, -50,
+    -29, -34, 25, 28, -31, -75, -42, -31, -29, -28, 51, -32, -45, -30, 29, -28,
+    37, -33, -61, -41, 59, -34, -47, -44, 52, 29, 55, -31, 29, -69, -51, -36,
+    34, -37, -30, -51, 48, -56, -58, 31, -40, -33, -37, 48, 66, 42, -46, -50,
+    47, -33, 39, 44, 33, 30, -49, -25, -27, -30, 25, 31, 49, -84, -37, 38,
+    -31, -37, -30, -27, 51, -30, -34, -52, -26, -42, -32, -43, 29, -32, -52, 29,
+    -40, 61, -53, -35, -56, 42, 35, 60, -101, 26, 25, -54, 33, -44, 34, -64,
+    46, 57, 35, -31, -34, 36, 34, 26, 54, -50, -25, -39, 34, 29, 30, 68,
+    -29, -49, 25, 35, -31, 39, 33, 25, 33, 44, 59, -37, 38, 26, 44, 34,
+    -29, 52, 35, 28, 26, 25, 26, 42, 36, 36, 30, 33, 58, 27, -36, -25,
+    46, 35, 27, -25, 25, 36, -36, 25, 29, -26, 30, 32, 26, -30, -36, 28,
+    47, 33, 42, 42, 37, -28, -39, 27, 26, -45, 28, -30, 34, 27, 25, 29,
+    25, 66, -28, -31, -31, -52, -25, 29, 50, -29, 26, -25, 25, -46, 38, 57,
+    44, -26, 45, 75, 26, 45, -30, 43, 44, 30, 26, 26, 29, 25, 35, 63,
+    43, 27, 46, -32, 50, 55, 25, 33, -36, 44, 32, -37, 48, -27, 25, 32,
+    34, 29, 26, 28, 46, -30, 26, 32, -29, 61, 48, 39, 26, 38, 33, -32,
+    27, 32, 45, 56, 48, 46, -32, 38, -56, -59, -49, -49, -36, -32, 36, 28,
+    -58, 25, 39, -31, -49, 35, 28, 46, 25, 39, 40, 43, 83, -36, -51, 30,
+    -26, -32, 41, 38, 37, -26, 48, 25, 47, 39, -31, -35, -38, -41, -32, 28,
+    25, 40, 32, 55, -27, -34, 48, 30, 45, -31, 28, -26, 28, -38, 29, 32,
+    29, 25, -28, 26, 33, -26, 52, -27, 26, 30, 31, 30, 33, 31, -25, -32,
+    41, 33, -27, 34, -27, 55, 33, 25, -29, 27, -26, 42, 35, -28, -29, -31,
+    32, -26, -26, -49, 28, 26, -48, 37, 34, 33, 36, -46, -41, -27, 33, 43,
+    -26, -56, -77, -32, -65, 33, -73, -39, -34, -31, 31, 27, 30, 70, -29, 29,
+    27, -25, -66, -37, 44, 55, 33, -33, 30, 31, 46, 25, 30, 57, 78, 25,
+    31, 26, 29, 27, -40, 30, -25, 30, -28, 29, -38, -29, 45, -29, -25, 29,
+    39, 62, -31, 36, 44, -32, 47, 42, 41, -38, 31, 29, 32, -26, 27, 46,
+    -36, -40, 35, 51, -27, 32, 33, -30, -42, 37, 25, 35, -27, -29, -48, -47,
+    -28, -39, -30, 28, -38, -34, 34, -58, -31, -31, -35, -34, -58, -29, 36, -28,
+    31, 32, 49, -30, -26, -35, -28, 44, -32, 31, -31, 27, 42, 26, 33, -26,
+    42, -33, 35, 27, 29, -26, 28, 41, 28, -44, 27, -32, 32, 47, -32, 38,
+    25, 34, 32, 27, -31, 30, 31, 42, -34, 49, 37, -30, 29, -25, -29, -29,
+    40, 32, -33, 26, -28, -36, -25, -36, -29, -35, -27, -45, -43, -29, -36, -31,
+    27, -55, 30, -40, 25, -32, -25, 31, 38, 26, 28, 40, 26, -77, 28, -39,
+    -25, 26, -28, -26, -25, -37, 40, 31, 41, 53, 33, 28, 27, 25, -26, 25,
+    55, 45, -32, 25, 26, 27, 32, 26, 25, -41, 41, -32, 48, 45, -31, -29,
+    26, -25, -28, -43, -39, -30, 29, 25, -26, 29, 40, 27, -25, 27, 46, 49,
+    28, 61, -51, 36, 26, 27, 26, 56, 33, 49, 47, 25, 35, 26, 32, -32,
+    25, 34, 39, 41, -26, 36, 37, 32, 31, -29, 36, 45, 31, -33, 28, 33,
+    44, 35, 25, 30, -27, -26, -42, 28, 29, 33, -30, 33, 34, 26, 37, 29,
+    48, -29, -34, 32, -27, 86, -40, 55, 50, 33, 37, 55, 25, 29, 26, 63,
+    30, -38, 36, 33, 55, 43, 31, 59, 73, 58, -29, 57, 43, 45, 29, 25,
+    42, 26, -25, 28, 41, 45, 32, 25, 45, 25, 39, 25, -29, 25, 43, 32,
+    42, 46, 33, 52, 35, 28, 45, -27, 47, 34, 31, 40, 26, -32, 29, -26,
+    29, 38, 29, 25, 25, 31, 52, 27, -25, 28, 28, 26, 32, -31, 34, 44,
+    -26, 32, -35, -50, -26, -28, -29, 28, 33, 37, -25, -38, 29, 68, 34, -33,
+    -38, 70, 40, 32, -34, 39, -41, 25, -28, 59, -26, 49, 66, -37, -28, -47,
+    -28, 34, 35, -50, 25, -29, -36, -26, 27, 36, 25, 36, 40, -42, -27, -52,
+    32, -29, -35, -51, -45, -26, -48, -36, 51, -38, -29, 41, -36, -48, 37, 37,
+    34, 29, -27, -42, -61, 44, -41, -30, -36, 28, -26, -41, -49, -27, -32, -33,
+    -29, -33, -34, 37, -31, -38, 28, 26, -40, -36, 25, -28, -43, 49, -40, 28,
+    -28, 26, 30, -40, -29, 34, -31, 40, 35, -60, -26, -28, -25, 52, -26, -26,
+    -28, 60, -34, 36, 39, 38, 25, -25, 34, -35, 36, -30, 50, -39, -36, 38,
+    34, 34, -40, 33, 41, -39, 40, 38, 36, 47, 32, 78, 32, -35, -65, -42,
+    27, -34, 37, 29, -35, -56, 25, -32, -29, 26, -41, 32, 28, -36, -31, -29,
+    47, 44, 44, -30, 46, 47, 43, -39, 29, 56, 33, -44, 37, 55, 28, 76,
+    42, 35, -26, -32, -46, -29, -68, 60, 28, 64, 35, 86, 34, -32, 38, -25,
+    26, 25, -36, -25, 30, -34, 50, 25, 27, 26, -29, 28, -27, -26, -25, -27,
+    -26, -27, 28, 41, 27, -26, 27, -26, 38, 25, 31, 36, -26, -28, 26, -26,
+    -29, -27, 29, 33, -26, -27, -27, -26, -28, -26, -25, -30, -29, -26, 26, -29,
+    27, -25, 25, -28, -25, 39, 26, 35, 26, 31, 26, 40, 30, -29, -34, -33,
+    -54, -25, 31, -30, -25, -40, -27, -25, -28, 32, -29, -51, 30, 48, 33, 28,
+    -25, -51, -58, -31, 34, -26, -25, 26, -27, 27, 45, 28, 41, 26, 28, -29,
+    -35, -29, 36, 28, -32, 40, -28, -34, 33, 68, -25, -31, -32, -31, 71, 32,
+    31, 32, -25, 36, 27, 25, 41, -33, 44, -25, 29, 31, 33, 41, 37, -34,
+    -25, -30, -33, 47, -27, 41, -31, -31, 26, -40, -26, -25, 29, -32, 25, -35,
+    -42, -38, -26, -28, -48, 27, 29, -29, -26, -27, -28, -33, 39, 26, 26, -51,
+    31, -30, 28, -29, -35, -27, 30, 33, 35, 51, -29, -36, -28, -30, -27, 29,
+    29, -40, -30, 27, 28, -34, -34, -25, -28, -35, -30, 28, -25, 56, 27, 34,
+    -33, 38, 26, 30, -31, 27, 33, 62, -32, 27, -31, 29, 25, -26, 49, 29,
+    30, 35, 29, -33, -46, 26, -27, 43, -33, 26, 25, -27, -41, 36, -51, -42,
+    -29, 36, -27, -45, 29, 56, 42, 32, 61, -41, 45, -30, -40, 48, 41, 34,
+    27, -27, -39, 28, 37, -40, -29, 31, 39, 30, -38, 77, 75, 25, 38, 37,
+    -34, -30, 28, 28, 32, 60, -35, 37, -28, -28, 28, 29, 26, 41, 52, 47,
+    44, 27, 28, 33, 43, -26, -46, -25, -43, 32, 33, 30, -33, -29, -40, 43,
+    42, 45, 49, 33, 59, -27, 29, -31, -27, -32, -26, -28, 42, 29, 68, 26,
+    -28, -37, 41, -26, 26, 82, 27, -26, -32, -25, 28, -37, 29, 28, -40, -32,
+    36, -33, 54, 44, -25, -56, -25, 32, 37, 25, -26, -29, -41, 26, 32, -36,
+    -52, -36, -25, 30, -52, 38, -30, -25, -37, -34, -28, -33, -49, 29, -48, 29,
+    33, -41, 29, 27, -38, 28, -57, 41, -29, 28, -53, 33, 32, 41, -51, -44,
+    -31, -48, 42, 32, 25, 25, -35, -33, -41, 51, 31, 25, 26, -36, 42, 52,
+    29, 30, 30, 37, 25, 25, 32, 26, -26, 44, 25, 35, -27, 38, 0, -26,
+    -25, -25, -25, -26, 0, -26, -33, -44, -33, 28, 33, -33, -37, -34, -34, -52,
+    31, -26, -35, 27, -26, -28, 37, -37, -29, -26, 30, -33, 32, -31, -39, -28,
+    -42, -36, -28, -55, -33, -27, -29, -25, -26, -36, -37, -41, -26, -40, -28, 25,
+    25, -25, -33, -32, -34, -26, 27, -29, -32, 27, 25, -28, -35, -25, -30, -26,
+    -27, -33, -29, 33, -25, -37, -26, -33, -49, -41, 28, -32, 25, 28, -38, 28,
+    30, -27, -28, 30, -34, -34, -43, -27, -36, -40, -31, 30, -25, -42, -34, -33,
+    -37, -27, -37, -29, 25, -36, 27, -25, -28, -44, -37, -34, -35, 27, 27, -36,
+    -25, -28, -46, -33, -48, -31, -39, -37, -32, -25, 25, -43, -30, -34, -31, -30,
+    -32, -26, -26, -39, -34, -27, -35, -25, 29, -36, -26, -27, -27, -31, -53, -27,
+    -41, -31, -39, -26, -34, -28, -46, -25, -33, 33, -27, -29, -25, -32, -27, 25,
+    -36, 32, -37, 27, -33, 25, 28, -33, -29, -30, 32, -34, -32, -29, 27, -38,
+    -26, -53, -28, -34, -27, -26, -30, -28, -33, -27, -30, -35, -27, 27, -30, -26,
+    32, -28, -25, -25, -36, -32, -28, -33, -35, 28, -45, 26, -26, -28, 36, -29,
+    -29, -47, -26, -38, -26, -29, -28, -37, -28, -42, -32, -28, -27, -33, -27, -31,
+    -43, -30, 33, -31, -31, -28, 25, -25, -27, 27, -31, -25, -27, -29, -32, -27,
+    -50, 34, -33, -25, -27, -29, -25, -28, -26, -31, -25, -27, -30, -31, -26, -25,
+    -33, -29, -25, -28, -27, -33, -34, -26, -32, -26, -29, -28, -25, -25, -30, -27,
+    -25, -26, -25, -25, -28, -30, -25, -28, -25, -31, -25, -26, -26, -31, -25, -29,
+    -29, -26, -26, -27, -32, -27, -29, -30, -34, -32, -25, -29, -29, -25, -26, -30,
+    -25, -25, -32, -26, -30, -28, -26, -32, -25, -25, 26, -27, -27, -28, -26, 25,
+    -25, -30, -27, -37, -32, -30, -33, -31, -31, -31, -29, -28, -25, -25, -29, -30,
+    26, -30, -32, -29, -25, -29, -26, -32, -26, -27, -27, -31, -27, -28, -28, -28,
+    -31, -25, -30, -25, -29, -32, -44, -34, 36, -27, -27, -39, -44, -39, -30, -47,
+    -26, -53, -46, -29, -40, 38, -32, 47, -65, -49, -43, -31, -26, -32, -34, -40,
+    -67, -31, -25, -28, -38, -27, -39, 29, -34, 34, 45, -92, -32, -31, -29, 28,
+    -56, 39, 36, -30, -25, 25, 29, 39, -37, 27, 35, 35, -28, 26, -56, 75,
+    36, -54, -54, -42, 38, 27, -35, 31, 26, -48, 61, -28, -38, -58, -31, -50,
+    39, -42, 40, -49, 28, 25, -27, 55, 52, -36, -55, -66, -38, -39, -45, -42,
+    -36, -28, -38, -33, -26, -29, -30, -48, -28, -37, -27, -33, 27, 51, -33, -32,
+    -29, -32, 41, 40, -34, 25, -35, -44, -27, -37, -35, -41, 27, -35, 37, 25,
+    -45, -34, -49, -61, -35, 25, -25, 41, -30, -42, -29, 37, -25, -51, -30, 43,
+    -47, -38, 25, 32, -48, -43, -29, 29, -25, 51, -35, -39, 32, 27, -28, -38,
+    -25, 49, 38, -39, -25, 41, -30, -25, -32, -56, 32, 29, 25, -30, -32, -34,
+    28, 27, 25, -47, 41, -25, 32, -48, 37, 44, 33, 32, 39, -32, 37, 44,
+    -30, -57, 51, 61, -33, 55, 74, 48, -39, -29, -42, -32, -26, 27, 62, -39,
+    29, 41, -33, -45, -27, 35, 26, 30, -34, 39, -60, 57, -41, 33, 41, -27,
+    -41, 28, -30, 40, -27, -36, -30, 35, 30, 46, -30, -46, 31, -26, 25, -25,
+    29, 29, 27, 69, -40, 61, 64, 27, 33, 27, 29, 25, 26, 32, 50, 30,
+    56, 31, 74, 28, 47, -27, 25, 25, 30, -46, 51, -30, -33, 27, 28, -27,
+    27, 43, 46, 27, -35, -27, 44, -28, 25, -31, -38, -25, 26, 28, -38, 44,
+    -26, -25, 69, 32, -33, 25, -43, -27, 35, -31, 42, 62, 35, 37, 26, -31,
+    60, -34, 30, 38, 36, 28, 32, 29, 31, -44, 25, 32, 49, 54, -47, 30,
+    30, 43, 74, 47, -29, 25, 27, 26, 30, 36, 30, 26, 37, 32, 33, 32,
+    25, 27, -28, 35, -26, -27, -28, 49, -42, -29, -29, -35, 55, -37, 26, -26,
+    25, 44, -29, 38, 47, 32, -46, -39, 31, 56, 43, 45, 29, 28, -29, 25,
+    30, 33, 46, -37, -25, -59, 36, -43, -25, 45, 36, 31, 37, 54, 52, 30,
+    47, 42, 28, 26, 26, 47, -44, -54, -28, 27, 28, 29, -50, 48, 45, 56,
+    31, 27, 27, -40, 33, 37, -47, -27, -29, -27, -27, -26, -28, -31, -29, -25,
+    -29, -25, -25, -26, -25, -27, -28, -28, 0, -25, -25, -31, -26, -25, -27, -30,
+    -30, -25, -28, -31, -29, -26, -27, -28, -28, -27, -27, -25, 64, 36, -28, 57,
+    -25, -33, 45, 47, 29, -33, 35, -27, 31, -46, 31, -27, 26, -25, -26, 38,
+    -51, -30, -55, 39, 28, 33, -25, -35, -30, 27, 29, 28, -31, 25, 27, 39,
+    -41, -27, -26, 37, -38, 40, 26, 27, -25, -52, -27, 27, -28, -49, 28, -36,
+    34, -26, 26, -44, 39, 40, 25, 41, 46, 58, 36, 34, -27, 31, 35, 30,
+    27, 30, -29, 31, 40, 45, 27, -48, 27, 56, 41, 26, 51, 30, -35, 55,
+    -37, 30, 26, 33, 31, 30, 45, 26, 30, -30, -32, 26, 26, -30, 26, 30,
+    -29, 40, 39, 34, 47, 38, 29, 25, 40, 25, 37, 37, 45, 39, 31, -75,
+    -34, -30, -52, 26, -27, 48, -27, -27, 26, 29, -34, 36, 30, -37, -53, 38,
+    45, 26, -50, 29, 38, -33, -70, 28, -28, 29, 34, 27, 77, 31, -25, 25,
+    29, 26, 51, -40, 28, 29, -39, -32, 26, -33, -27, -51, -26, -27, -46, -31,
+    38, -45, 25, -34, -37, 26, -94, -48, -38, -29, 30, -28, 29, -25, -43, -37,
+    38, -32, 28, 36, -40, -25, 27, 30, 27, 32, -42, -35, 40, 33, 39, 71,
+    38, 47, 32, 29, -45, -35, -39, -35, -25, -28, -33, 37, 32, 32, -31, 31,
+    -41, -28, -35, -45, 41, -40, -54, 28, -50, -39, 29, -40, 33, -26, 27, 25,
+    -26, -56, 36, -65, -33, -32, -27, -40, -31, -34, -36, -29, 31, 32, 33, -43,
+    -44, 31, 26, -25, 31, 28, 32, 27, -39, -27, -30, 28, 26, 59, 28, 47,
+    25, -38, 36, 27, -36, 37, 31, 34, 32, -26, -26, -25, 46, 39, -72, 28,
+    30, 40, -32, 44, 82, -31, -37, -57, 27, -25, 50, 33, 33, -34, 34, 30,
+    -43, 31, -31, 31, 27, -30, 32, 27, 46, 26, 35, 42, 38, 44, 25, 30,
+    -29, -26, 40, 27, 26, 61, 35, -34, 49, -30, -39, -32, 36, 31, -25, 29,
+    -33, 30, 42, -47, 40, -32, 43, -26, -42, -26, -31, 36, 33, -38, -42, -45,
+    -33, -36, -40, 41, -30, -33, 32, -48, -43, -26, -25, 34, -33, 44, 28, 32,
+    -36, -36, 26, 27, 29, 28, 39, -27, 27, -36, 61, 69, -35, -34, -35, -44,
+    50, -31, -39, -30, 30, 35, 49, 38, 46, 34, 32, 34, -39, 50, -39, 37,
+    34, 25, 60, 32, 36, 25, 35, 25, 25, 26, 31, 26, 66, 29, 34, 28,
+    41, 34, -62, -47, -44, 30, -52, -37, -25, 28, -43, -41, 54, -60, -32, -39,
+    52, 63, 26, -46, -27, -30, -41, -26, -32, -39, -66, -40, -32, 26, 29, -32,
+    71, 33, 26, 33, -25, -28, 28, -27, 70, -32, 28, -27, 45, 38, -42, 37,
+    27, 37, 56, 39, -42, 30, 43, 25, -40, 27, 40, -41, 29, 25, -28, -38,
+    27, 31, 44, 27, 38, 37, -43, -69, -32, -32, 33, 30, 28, 38, 27, 51,
+    -25, -30, 30, 26, -26, 38, -34, -27, 32, 31, -38, 39, 27, 29, -34, 52,
+    33, -56, 28, -33, 31, 34, 26, 63, -38, 45, -27, 33, -28, 74, 27, -27,
+    33, 27, 38, 42, 48, 27, -69, -38, -40, -36, -42, -32, -45, 63, 29, -28,
+    -47, -26, -31, -26, 35, -45, 47, -82, -26, -31, -47, -29, -34, -53, -38, 71,
+    69, -27, -32, 27, -28, 30, 27, 29, -30, 37, 27, -30, -44, 60, 50, 26,
+    28, 44, 30, 40, 35, -25, -38, 30, 28, 41, 40, -27, 28, -26, -35, -28,
+    -37, -25, 29, -40, 25, -39, 26, 26, -34, 41, -41, 34, 32, -25, -38, -26,
+    25, -40, -28, 59, -31, 33, 32, -39, -37, 32, 62, 49, -28, 26, 26, 31,
+    -31, -33, -32, -30, 36, -25, 47, -35, 53, 28, 29, -28, 39, -27, 26, 26,
+    28, 36, 34, 34, -38, 31, -28, 47, 26, -27, 32, -32, 28, 31, 33, -38,
+    -32, 28, -30, 26, 36, -31, -38, 36, -30, -44, -31, -25, -28, 28, -29, -29,
+    31, 38, -31, -29, -25, -30, -33, 39, -33, 28, -26, -33, -29, -28, -31, -37,
+    41, -30, 25, -26, 29, 26, -32, -43, -41, -25, -32, -32, 27, 26, 36, -35,
+    -52, 28, 30, 29, 30, -30, -31, 27, -40, -25, -35, -33, -38, -35, -28, 27,
+    -34, -25, -27, -48, -40, -34, -27, -42, -44, -31, -36, 26, -25, -37, -34, -29,
+    -47, -27, -30, -37, -36, -28, -27, -25, -25, -36, -27, -27, -27, -29, -38, -26,
+    -44, -71, -25, 35, 26, 30, -35, -27, 29, -62, 35, 25, 30, 28, 47, -26,
+    36, 53, 33, -27, 27, 43, 31, 31, -33, 50, 40, 31, 25, 28, 35, 28,
+    36, -25, 45, -47, -51, -33, 39, -39, -44, -41, -33, -46, -69, -42, -45, -75,
+    -36, 26, -62, -29, -61, -72, -33, 46, -37, 28, -25, -35, -31, -32, -57, -32,
+    -30, 58, 59, -46, -64, -38, -32, 29, 39, 33, -45, 84, -67, 31, -29, -28,
+    40, 55, 35, -74, 27, -28, -28, 31, 28, 29, -35, 34, -28, 70, 41, 28,
+    28, -42, -34, 35, 35, 31, 49, 66, 43, 26, -26, 31, -25, 64, 40, -27,
+    35, -26, -40, -27, -47, -54, -63, 38, 35, 25, -36, 26, -38, -55, -38, -54,
+    31, 54, 54, 32, 31, 27, 32, 32, -53, -34, 41, 33, 33, -37, 27, 32,
+    -42, -39, 30, 28, 41, 45, 27, 27, -66, -33, 28, 36, 27, 27, -25, 52,
+    33, 44, 38, -26, 69, 26, 42, 25, 35, -25, -26, -27, 27, 40, 32, -26,
+    26, 29, 28, 26, 53, 85, 31, 99, 32, -25, 41, 39, 25, 44, 56, 33,
+    33, 28, 49, 29, 91, 42, 33, 35, 34, 37, -39, 42, 36, 37, 43, 27,
+    26, 28, 28, -38, 27, -27, -28, -52, -37, -31, 31, 29, 36, 31, 50, 25,
+    27, 60, 27, 26, 28, 38, 25, -26, 28, -33, 30, 33, 35, 29, 33, 27,
+    56, 45, -30, -45, 44, 25, -29, -27, -34, -29, 47, 31, 35, 30, 27, -29,
+    -25, 28, 32, -36, -26, -30, 27, 29, -30, -28, -50, -40, 27, -31, -49, 26,
+    35, -33, 25, -26, 26, -36, 44, -36, -31, 29, 26, -38, -25, -26, 27, 26,
+    -25, 32, 47, -41, 32, 31, 29, 32, 40, 27, 37, 29, -45, -31, 45, -30,
+    28, 51, -32, -39, -28, -42, -32, 25, 27, -27, 45, -39, -35, 27, -41, -53,
+    -26, -28, -39, 25, -29, -30, -32, -53, -28, -26, -35, -49, -28, 30, 53, 29,
+    37, 28, 32, -45, 49, -28, -26, -27, -47, -33, -30, 38, 46, 33, 59, 30,
+    43, 28, 31, 66, -29, 69, -50, -55, 40, 38, 38, 26, 34, 27, 32, 57,
+    28, 48, 33, -26, -52, -25, 37, 33, 33, 32, -30, 26, -61, -35, -25, -32,
+    -48, -57, -25, -39, 27, -34, -32, 26, -66, 44, -25, -33, -25, -43, -38, 28,
+    25, -27, -53, -28, -36, 45, -33, 33, -28, 33, 39, 45, 25, 25, 29, 42,
+    36, -25, 35, 55, 38, 47, 33, -43, -26, 30, 39, -29, -36, -26, -35, -44,
+    52, -30, -25, 64, -34, -26, 41, -36, -26, -30, -75, -51, -32, -64, -57, -75,
+    -25, -52, -25, -69, -42, -30, -75, -60, 67, -27, -33, -25, 32, 39, -39, -35,
+    -37, -30, -36, 32, -61, 32, -31, -86, -30, 31, -42, 44, -81, -27, 29, 37,
+    31, 40, 30, 29, -30, -26, -30, 34, -37, 30, 34, -29, 29, 31, 44, 29,
+    27, 30, 26, 33, 28, 26, -26, 25, -43, -34, 30, -26, -42, 48, 32, 25,
+    -28, -33, -31, 27, 28, -55, 41, -29, -53, 27, -38, 29, -35, -32, -27, -52,
+    -35, -51, -56, -33, 43, -33, -27, -27, -32, -28, -42, -31, -42, -31, -25, -25,
+    -25, -28, -53, -35, -33, 36, 25, 40, 28, -25, 40, 30, -32, -44, -25, 46,
+    27, -32, -37, -26, 40, -34, 58, 51, -25, 37, -25, -33, -33, -33, -50, 29,
+    37, -37, 33, -33, 35, -26, -39, 34, -31, 38, 28, 25, -32, 28, 34, -30,
+    46, -33, 57, -31, 29, 42, -61, 32, 26, 67, -25, 34, 38, -44, 63, 63,
+    -41, 31, 31, -31, 25, 67, -48, -26, 38, 51, 40, -27, 25, 26, 45, 70,
+    30, 30, 53, 26, 27, -29, 34, 39, 57, 31, 26, 34, 40, 39, 56, 35,
+    31, 39, 36, -35, 27, 27, 57, 27, 31, 48, 28, 36, 29, 37, 25, 32,
+    29, 40, 27, 41, 31, 37, -37, 35, 32, 37, 30, 32, -26, 26, 32, 51,
+    27, 36, 38, -34, -25, 25, 28, 34, -27, 32, 35, 46, 40, 38, 28, 33,
+    32, 50, 36, 26, 34, -25, 57, 38, 30, 25, 28, -64, 36, 26, 25, 34,
+    31, 36, -47, 26, 42, 28, -54, -35, 43, 28, -31, 37, 27, -34, 25, -48,
+    30, 28, 35, 32, 77, -28, 39, -47, -38, 28, 30, -38, 25, 29, -28, 26,
+    27, 28, 28, -34, 26, 33, 51, -26, 48, 45, 31, 37, -66, 36, 40, -34,
+    -32, -26, 30, 27, 36, 30, 34, 44, 31, 29, 32, 47, -32, 26, -29, 29,
+    -34, 34, 33, 27, 30, 26, -31, 25, 28, 38, 62, -27, -29, -39, -48, -40,
+    35, 31, 43, 52, -44, -40, -33, -29, -32, -36, -25, -31, -30, -52, -29, -54,
+    -59, 26, 34, 38, -25, 36, -35, -33, -31, -25, 34, -39, 25, -30, -26, 25,
+    -40, 41, -39, -28, -33, -25, -25, -31, -28, 29, -26, -50, -25, 30, 28, 26,
+    29, -53, 38, -43, -28, 27, -31, 28, -29, -29, 38, 39, -25, 30, -29, -56,
+    -25, 41, 26, -29, -41, -49, -48, -26, -63, -26, -40, 28, 32, -26, -35, -35,
+    35, -26, -36, 26, 66, -38, -33, 35, -34, -30, -25, 38, 29, -57, 26, 27,
+    38, -28, -37, 32, 43, 28, 26, 36, -32, -44, -39, -31, 35, -28, 25, 30,
+    28, 31, -25, -50, 31, 45, -33, -44, 52, 37, -35, -25, -45, 49, -34, 47,
+    25, -31, 32, -31, 35, 43, -33, 33, -31, 29, 29, -25, 26, 25, 27, -55,
+    -59, -27, -31, 48, 38, -35, 37, 31, -28, -26, 40, -35, 33, -68, 25, 33,
+    -40, -28, 31, 62, 34, 33, 29, 29, 42, -51, 35, 50, 37, 55, 25, -27,
+    54, -40, 70, 36, 79, 35, 25, -45, 44, 28, 38, -37, 67, 32, 51, 29,
+    36, 28, -51, 43, -56, -31, -31, 39, 27, 30, -34, 39, 48, 69, -34, 36,
+    45, 27, 39, 65, 26, -39, -38, 48, 56, 50, 28, -36, 37, 44, 28, 36,
+    33, 27, 26, 32, 37, -32, 46, 32, 34, 37, 25, -32, -33, 27, -30, -25,
+    32, 39, -51, 26, -53, -40, -32, -59, 40, 60, 25, 25, 35, 29, 47, 38,
+    41, 40, 26, 36, 40, -38, 59, 40, 39, -44, -37, -25, -38, 29, -33, -36,
+    -40, -28, 31, 35, -30, -25, 32, 25, 29, 26, -39, -27, 25, 30, 25, 25,
+    30, -25, -25, 81, 28, 26, 26, 25, -25, -47, 28, -35, -40, -31, -34, -34,
+    -38, 35, -35, -28, 42, -30, 25, -25, -28, -30, -35, -43, 27, -46, -26, -30,
+    -27, -28, -25, -25, 25, -34, -26, 25, -26, -28, -25, -27, -28, -27, -27, -25,
+    -27, -27, -26, -27, -28, -31, -28, -30, -28, -25, 29, -29, -25, -30, -26, -25,
+    -25, 32, -25, 25, -25, -27, -26, -30, -28, -28, -25, -25, -25, -26, -28, -28,
+    -26, -28, -25, -31, -27, -32, -29, -31, -32, -25, 28, -33, 44, 25, -38, 48,
+    38, 25, 26, 51, 31, 33, 29, 45, 36, -35, 27, -34, -29, 27, 26, 27,
+    -27, 33, -41, 42, 25, 49, 72, -29, -29, -76, -43, 27, -31, 25, -28, -36,
+    26, 25, -27, -30, -39, 50, 35, 44, 28, -33, 50, -25, -35, -34, -31, 31,
+    -27, 29, 27, 36, -38, 27, -39, 36, 77, -30, 34, 40, 35, -29, 31, 28,
+    58, -41, -48, 46, 43, 32, 30, 27, 28, -38, 26, 37, 27, 41, 46, 48,
+    32, 31, 37, -31, 30, 39, -41, 39, 32, 39, 51, 40, 47, 27, 53, -37,
+    42, 58, 47, 33, 29, 45, -27, -52, 32, 70, 39, 31, -25, 28, 52, 35,
+    30, -30, -25, 46, 29, 29, 33, 42, 32, 34, -26, 26, 35, 36, 43, 25,
+    -36, 44, 36, -33, -40, -67, 40, 30, -48, 51, -38, -46, 32, 32, -35, 34,
+    33, -31, 66, -28, 60, 26, 45, 39, 46, -50, 28, -42, -36, 38, -27, 27,
+    47, 33, 40, -25, -26, 35, 45, -47, -56, 46, 39, 38, -32, 30, -55, 39,
+    37, 39, -30, 34, 49, -42, 25, -28, 27, 29, -67, 46, 35, -40, 39, -28,
+    -28, -52, 40, 27, -32, 31, 29, -35, -38, -45, 40, -37, -47, -36, -46, -28,
+    26, 40, -41, -37, 36, 48, 28, 35, 25, 37, -45, -35, -26, 32, 41, 44,
+    25, 34, -56, 30, -52, 27, 27, 26, -32, -31, -37, -28, -62, 27, -38, -49,
+    40, -36, -37, 42, -44, -32, -28, 32, -31, -45, -30, -37, 25, -45, 34, 53,
+    -30, 48, 29, 49, 28, 40, 53, -36, -27, -43, 26, -25, 34, -26, 32, -34,
+    37, -27, -38, -32, 28, -38, -27, -42, 26, 29, -30, -38, 35, -26, 36, -48,
+    -26, 28, -25, -80, -37, -27, -59, 25, -33, -31, -30, -27, -39, 27, -27, 27,
+    -26, -34, 74, 32, 27, -26, 39, 52, -26, -35, 44, -26, 26, 37, -46, -35,
+    35, 26, 51, 32, -39, -32, 43, 36, 25, 30, 25, -33, 29, -31, -38, 32,
+    42, -44, -35, -25, 28, 28, -28, -43, -25, -29, -29, -40, -27, 41, 0, 0,
+    0, 0, 0, -25, -25, -27, -25, -25, 0, -28, -25, -26, -27, 34, 31, 30,
+    31, 36, 53, 28, 29, 29, 27, -32, -29, -27, -29, 29, -27, 25, 29, 28,
+    38, -25, 25, 27, -32, -30, -26, -26, 35, -31, -26, -36, -39, -39, -38, -27,
+    -26, -38, -36, -30, -35, 40, -29, 31, -26, -36, 44, -26, -29, -42, -41, 28,
+    30, 26, -50, 32, 44, -27, 27, 33, 56, 25, -28, -36, 32, 40, 25, -30,
+    -26, 37, -29, -31, 25, 29, -25, 39, 38, 43, -25, -28, 25, -29, 56, 40,
+    37, 29, -25, -36, -31, -54, 39, -33, 29, -50, -25, -40, -26, -26, 25, -26,
+    -34, 32, -61, -46, -36, -35, -69, -28, -34, -62, -38, 32, 33, 32, 34, 25,
+    -44, -33, 42, 27, 31, -28, 29, -29, 29, 26, 28, 34, -30, -28, 26, 34,
+    -32, -28, 33, -27, -26, -29, -25, -32, -42, 28, 48, -33, -26, -34, -45, -43,
+    -27, -26, 35, -34, -31, -34, 41, -29, -33, -27, -51, -32, -33, -35, -30, -30,
+    -27, -26, -56, -44, -37, -36, 31, -29, -33, -43, 27, -37, -25, 38, 39, 25,
+    32, 28, -28, -37, -31, 37, -27, -36, -35, -26, -29, -25, 27, -25, 25, -27,
+    -27, 42, 37, -44, 34, 53, -25, -26, -38, 26, -26, -26, -33, 31, -45, 38,
+    -25, -29, 27, -35, -41, -64, -29, -39, -31, -25, -42, -29, -28, -50, -26, -32,
+    36, 26, 38, -39, -43, 37, 34, 29, -34, -29, 48, 32, 30, -34, 51, -26,
+    -32, 28, -29, 28, 34, -43, 30, -25, -28, 26, -26, -27, -33, 30, 26, -29,
+    25, 29, 35, -28, -36, -27, -26, -61, -27, 30, -30, -32, -27, -37, -47, -35,
+    32, -33, 27, 34, 29, 26, 30, 25, -28, 27, 39, 26, 27, 41, 36, 43,
+    29, 29, 37, 52, -32, 52, 25, 32, 27, -40, 27, 54, 30, 25, -31, 29,
+    38, -40, 30, 26, 32, -31, 35, -41, 35, -62, 41, -25, 33, -31, -36, 35,
+    34, -27, 33, 28, 38, 27, -34, 29, 60, 38, -37, 34, 38, 41, 28, -26,
+    26, 39, 33, 48, -36, -26, -28, -27, -33, 49, -26, 31, 31, -32, 34, -34,
+    -31, -44, 47, 30, -34, -25, 36, 48, 33, -42, -41, 42, 25, 55, 25, -43,
+    -42, 50, -35, -40, -39, 35, -31, 33, -30, 29, 57, -36, -29, 60, -47, 25,
+    -36, -32, -37, 40, -40, 37, 42, -32, -32, -52, 27, 35, 29, 33, 44, 25,
+    -40, 31, 37, 25, -26, 25, 30, 26, 36, -33, 62, 28, 31, 25, -33, -27,
+    27, 37, 25, 38, 49, 32, 61, 57, -27, -28, -30, 40, 33, -34, -28, 30,
+    55, -29, -29, -36, -31, -54, -49, 29, -27, -35, -28, -28, 56, 28, 72, -25,
+    -41, 31, 31, -33, 56, -47, 41, -34, 38, 44, -36, -25, -37, -55, -39, -27,
+    -29, -44, 29, -28, 50, 29, -29, -56, 25, -27, -29, 25, 30, 67, 28, 30,
+    27, 26, -36, 42, 31, 45, 34, 29, 34, -37, -38, -58, 36, 31, -38, 28,
+    27, -36, -42, -47, -38, -29, -30, -39, -25, -35, 51, 30, 29, 60, -27, 29,
+    -26, -33, 31, 57, 28, -45, 32, -26, -27, 28, -25, 53, 37, 29, -32, -27,
+    25, 29, -58, -53, -38, -33, 43, 31, -33, -25, 28, 40, 25, 81, 32, -25,
+    -25, 28, 27, -36, 33, 33, 33, -27, 29, 30, -29, 25, 34, 27, -28, 28,
+    45, 50, -28, 26, 29, -33, 30, -26, -26, 29, -31, -36, -45, -32, -73, -27,
+    -36, -27, 33, -38, -30, 26, -38, -34, -88, -97, -57, 33, 29, 40, 37, 48,
+    26, -25, -42, -29, 53, 41, 35, 35, 40, -27, 29, 38, -35, -42, -32, 25,
+    42, -27, 45, 37, -37, 27, -27, -67, -28, 25, 33, -44, -39, -30, -41, -48,
+    -44, -81, -37, -39, -26, -52, -31, -30, -57, -52, -29, -34, -45, -27, -42, -43,
+    -32, -35, -34, 34, -29, -38, -32, -37, -42, -30, -45, -89, -116, -31, -43, -25,
+    -50, 25, -35, -37, -84, -28, -31, -69, -31, -33, -46, -39, -28, -56, -79, -41,
+    41, 55, 45, 47, 28, 43, 36, 35, 39, 37, 30, 39, -28, 26, 38, 34,
+    -30, -26, -38, -25, 31, 30, 27, -26, -31, 52, 28, -26, -37, -31, -33, -48,
+    -31, -63, -28, 26, -35, -26, 28, 27, 58, 49, -26, -34, -47, 45, -27, -25,
+    -26, -42, -39, 32, 34, 31, 51, 35, 33, 30, -28, -44, 40, 28, -31, 27,
+    32, 33, 33, 50, 26, 30, 28, 26, 36, 26, 30, 25, 41, 28, 39, -25,
+    41, 30, 29, 35, 50, 26, -37, 26, 26, 34, -26, 25, 36, -34, 27, 39,
+    46, -36, 39, -28, 28, 30, 28, -40, -27, -30, 28, 31, 28, 41, 26, 33,
+    -25, 27, 53, 34, -34, 37, -28, 39, 31, 29, -29, -43, -29, 28, -32, -65,
+    29, 25, 35, 37, -28, 36, -29, -27, -44, 35, 40, 36, -43, -31, -48, -26,
+    28, 32, -29, 38, 46, 36, -55, -37, -40, -50, 27, -48, 67, 27, 28, 41,
+    -28, 41, 28, 27, 34, 31, -29, 44, 38, 27, 38, -38, 37, -47, 34, 25,
+    32, 35, -48, 26, 26, 27, 42, -27, 25, 30, 31, -29, -32, -35, -28, 25,
+    -27, 26, 25, -32, 29, 25, -35, -51, 34, 26, -56, -27, -32, -27, 32, 37,
+    33, 36, -27, 32, 38, 27, -33, 28, 41, 28, -27, -25, 27, 32, 26, -46,
+    27, 30, -35, 26, 31, -33, 34, -48, 37, 53, -36, 36, 25, 25, 29, -26,
+    25, -40, 47, 34, -37, -26, -30, -28, -37, -27, 34, -32, -35, -28, -25, -31,
+    -28, -31, 28, -40, -44, 29, 29, -25, 26, -29, 32, 70, -32, -25, -36, -29,
+    -30, 34, 50, -28, -30, -26, -28, 32, -35, 26, -30, -28, -25, -42, -29, -34,
+    -31, -31, 26, -34, 32, 25, 25, -26, -27, 25, 42, 29, -27, -40, 28, 34,
+    -25, 28, 37, 36, -28, 50, -48, 29, 25, 28, 29, -30, -74, 35, 42, -40,
+    49, -32, 40, -39, 25, 31, 36, 31, -74, -25, 41, -26, 26, -29, -44, 37,
+    49, 33, 26, -73, 35, 41, 26, -25, 44, -27, 45, 26, 25, 37, 30, 25,
+    47, 30, -25, 38, 40, -27, 27, 56, 26, -32, 44, 31, -27, 72, 44, 40,
+    58, -26, -31, -32, -64, 41, 25, 32, 75, -26, 50, 32, -39, -37, -35, -26,
+    -26, -71, -36, -54, -38, -31, 32, -26, -25, -60, -54, -33, -54, -40, -43, 28,
+    -52, 32, -30, -29, -32, -52, -30, -40, -52, -38, -62, 27, -30, -37, -29, -68,
+    -50, 27, -58, -34, -46, -45, -25, -44, -47, -50, -42, -38, -40, 57, -25, 36,
+    -38, 34, 37, -27, -42, -31, 33, -28, 26, -33, -44, -43, -36, -25, -31, -35,
+    -25, 58, -29, -33, 32, -36, -52, -37, 43, 27, 56, 25, -31, -36, 68, 50,
+    35, -40, -62, -30, 34, -49, 39, -26, -26, -30, -25, -32, -52, 25, 34, -65,
+    37, -30, -35, -30, 35, 26, 38, -69, 27, 40, 26, -31, -36, 35, 32, 30,
+    37, -37, 47, 28, -32, -38, -32, -26, -26, 42, -34, -39, -35, 43, 30, 32,
+    28, 30, 30, -33, 42, -29, 38, 55, 40, 31, 26, 48, 26, 32, -26, 27,
+    31, 50, 33, -32, 53, 38, -28, -25, -52, 43, 89, 70, 29, 36, -29, 34,
+    46, -31, 30, 29, 26, -35, -59, 53, -26, 71, 103, -27, 48, 27, 56, 25,
+    26, 27, 27, 33, 27, 29, 33, 32, 51, 28, 32, 55, 50, 38, -37, 34,
+    32, 37, 30, 29, 28, -28, 30, -28, -32, -26, 30, 32, 37, 27, 30, 31,
+    28, 30, 25, 27, -25, 35, -27, -38, 25, -26, 28, 36, 30, 32, -41, -39,
+    36, 43, -27, 31, -49, 33, 29, 27, 42, 28, 35, -47, -27, 42, 30, 56,
+    30, 26, -26, -29, -39, 45, -52, 36, -30, -29, -35, 39, 36, 45, -34, -36,
+    -30, 36, 27, -28, 38, 26, 41, 28, -25, 26, 34, 46, 30, -27, -28, -57,
+    -26, -32, -41, -34, 29, -29, -26, -25, -25, -31, -28, -30, 27, 35, 25, -38,
+    -36, 25, 25, -40, 65, -31, -34, -35, -33, -27, -26, -30, -33, -37, -47, -46,
+    26, 26, -28, -31, -33, 33, -44, 39, -25, -29, 39, 25, 54, 33, 55, 32,
+    50, -27, 33, 65, 62, -32, 28, 43, -29, -36, -41, -36, -33, 62, 44, -47,
+    -32, 42, 59, -40, -29, -38, -36, 30, -25, -27, -25, 36, 59, -32, -30, -42,
+    -32, -25, 29, 27, -41, -30, -25, 33, -30, 64, 34, 26, 31, -33, 65, 40,
+    30, -39, 78, 28, 53, 32, 39, 30, -25, 26, 41, 37, 56, 29, 42, -34,
+    -59, 29, 33, -30, 37, -47, 33, 26, 30, 36, -30, -39, 34, -37, -37, 57,
+    -57, 28, -29, 27, 70, 27, 28, 50, -30, -31, 50, -29, -36, -25, 25, -26,
+    34, 27, 47, 38, 43, 25, 25, 26, 42, -39, 33, -28, 33, -29, -31, 29,
+    26, -32, -37, -27, -28, -39, 37, -45, -29, 29, 25, -33, -28, -35, 27, -62,
+    -38, -43, -27, -33, -50, -43, -27, 28, -28, -90, -30, -60, 42, 26, -43, 29,
+    -71, 37, -35, 42, -65, -43, -32, -70, 25, -29, 26, -28, -27, 25, 47, -30,
+    -28, 44, 26, -65, 31, -36, -27, -31, 34, 53, 28, -25, 25, -25, 48, -46,
+    -26, 26, 29, 25, -50, 59, 44, -61, -58, 56, 32, -30, -28, -50, -26, 55,
+    -31, 31, 45, -73, -46, 26, 32, -28, -47, 30, 26, -26, 30, -43, -39, -68,
+    -47, -25, -34, 27, 27, 28, -50, -34, 48, 33, 27, 26, 54, -41, 35, 47,
+    32, 30, 42, 52, 29, -51, 30, 52, -37, -28, -32, -26, 28, 26, 38, 56,
+    -27, 30, 30, -33, 25, -28, 33, -29, 31, -42, -29, -28, -57, -36, 47, 25,
+    40, 27, 35, -29, 36, 41, 28, 28, -25, 32, 39, 32, -25, -29, -31, 33,
+    28, 28, 37, 29, 30, 36, -34, 38, 38, -34, -26, 25, -39, -29, 30, 32,
+    -39, -30, 25, 34, -27, -46, -37, -26, -28, -28, 29, 30, -32, 32, 41, 45,
+    -37, 41, 28, 38, -25, 29, -26, -32, 27, -27, 25, 29, 41, 26, -52, -31,
+    27, -31, -35, -40, -26, 47, 32, -29, 25, 27, -34, 28, 46, -37, -26, -27,
+    -28, -27, 44, -35, -62, -65, -29, -40, 29, 64, -26, -28, -35, -27, -58, -26,
+    -32, 34, 41, 33, -49, 30, -27, 31, 27, -28, 25, 30, 35, 46, 32, -27,
+    113, 26, 27, 43, 34, 42, 39, -28, 72, 25, 57, 26, 32, 49, 27, -28,
+    26, 40, 43, 26, 26, 25, 98, 40, 42, 25, 44, 32, 30, 65, -29, 57,
+    37, -48, 57, 36, -29, 45, 25, -25, -40, -34, 61, 88, -30, 35, -25, -25,
+    -26, 88, 34, -30, -46, 40, -25, -32, -69, -32, -29, 31, -32, -29, -33, 27,
+    27, -37, 65, -30, -36, -61, 33, 38, 57, -36, -26, 27, -43, -27, 41, 37,
+    -46, -30, -26, -35, -35, 26, -34, -38, -27, 25, -29, 33, -27, 27, -44, -33,
+    -29, -34, 35, 39, 28, -29, 26, 26, 46, 30, -33, -59, 25, -28, 38, -29,
+    26, 36, 27, 33, 69, -42, -27, 28, -36, -43, 40, 50, 35, 32, -38, -32,
+    34, -44, 33, 27, 29, -25, -50, -47, 30, -36, 33, -41, -27, 48, -66, -38,
+    -29, 56, -35, -32, -26, 49, 47, -39, -34, 26, -43, -56, -43, -53, -30, 27,
+    32, 30, 29, 39, -28, 51, 42, 39, 31, -32, -25, -36, 45, 31, -36, 26,
+    42, 28, 29, 32, 44, 41, -32, -30, 29, 45, 27, -39, -25, 37, 43, 26,
+    31, 34, 27, 36, 27, 39, 25, 59, 25, 45, 37, -41, 30, -42, 27, -29,
+    26, -26, -39, -31, 35, 54, -50, -52, -32, 31, -28, -27, 30, 38, -29, -28,
+    -45, -28, -64, -46, -38, -28, 27, -31, 44, 31, 39, 32, 26, 27, 36, -31,
+    -46, 42, 32, 32, 28, 53, 39, -65, -44, 63, -59, 54, 41, 39, 30, 79,
+    29, 34, 32, 28, 35, 27, 27, 35, -25, 34, 42, -28, 34, 50, 26, 41,
+    49, 44, 29, 34, -25, 26, -25, 51, -46, -30, -34, -40, -36, 36, -38, -45,
+    -91, 43, -25, 30, 26, 52, 35, -29, -34, -35, -37, -65, 27, 49, -53, 42,
+    53, -27, 36, -31, -48, -25, 31, 31, 31, 25, 25, -31, -26, 33, -34, 26,
+    37, -25, 26, 28, 30, -36, 35, -34, -58, 26, 43, -36, 33, -37, -43, 26,
+    36, 44, -26, -30, 28, -25, -28, -49, -25, -25, 26, -33, -63, -90, -34, 32,
+    -25, 72, -31, -58, -73, 35, -31, 32, 36, -42, 33, -30, -25, -43, 49, 56,
+    -41, -25, -27, -32, -31, -32, -25, -25, -27, -26, -48, -28, -32, 25, -30, 61,
+    26, -31, 45, -35, -27, 42, 56, -27, 35, -33, 25, -41, 37, -42, 26, 27,
+    38, 25, 55, 28, 59, 43, -34, 29, 46, 25, 26, 25, -38, 32, 30, -26,
+    31, -25, -35, 28, 32, 39, 47, -28, 27, -28, -25, -39, 27, 28, -25, -61,
+    -53, 28, -52, -33, -56, 52, 44, -25, -34, 29, -33, -44, -55, -45, 36, 37,
+    40, 54, -36, 45, -29, -26, -66, -28, -43, -43, -48, 78, -25, -33, -61, -39,
+    63, -55, 65, -41, 49, 26, 37, 50, -25, 28, 34, -28, 29, 45, 44, -26,
+    27, 29, 27, 26, 36, 34, 34, 40, -30, 43, 37, 30, 28, -29, 37, -36,
+    -28, -39, 27, 53, 34, -27, 26, 42, 39, -28, 47, 51, -30, -25, 46, -46,
+    -51, 26, 29, -61, 37, 27, 27, 53, -27, -67, -59, 29, 30, 31, -26, 30,
+    38, 26, -25, -39, 31, 34, -34, 52, 38, -87, -33, -41, 32, 38, 59, -40,
+    26, 37, -27, -42, 26, -35, 31, 31, 41, -32, 41, -54, 35, 64, 47, 35,
+    27, 25, 34, 29, -67, -33, 33, -47, 52, 29, 25, -27, 39, 45, 31, 30,
+    26, 49, 41, 36, 33, 26, 39, 57, 32, -26, 50, -32, 25, 36, -40, 26,
+    -29, 32, -26, 48, 25, -39, -25, 29, 32, 43, 48, -25, 35, 36, 27, 33,
+    -39, 38, 36, 26, 50, 40, -27, 42, -25, 38, -30, 37, 26, -25, 29, 46,
+    26, -42, -26, 60, 25, 29, -25, -37, 41, 32, -26, -30, -47, -38, -54, 25,
+    -45, 29, 42, 40, 27, 32, 30, -31, -27, 61, 37, 34, -26, 42, -35, -27,
+    28, 35, -33, 32, 41, -29, 29, 41, 36, 38, -31, 32, -26, 39, 32, -26,
+    -48, 33, 41, -37, 34, 50, 26, 29, 67, 29, -30, 47, 25, 35, -27, -34,
+    -29, -45, -36, -32, -35, -31, -26, -26, -51, 36, -52, -26, 29, -31, 32, 42,
+    -45, 40, -29, -33, 38, -28, 28, 42, 27, -32, 34, 32, -28, -30, 29, 36,
+    41, -31, -33, 34, 33, -35, 26, 29, -28, -50, 40, 25, 45, 43, -33, -50,
+    -44, -31, 35, -43, -47, 27, -32, -28, 31, 54, -36, -42, -61, -26, 30, -26,
+    40, 36, 25, 26, 45, 36, -26, 25, 28, 35, 56, 44, 28, -31, -26, 34,
+    48, 32, 38, 29, 36, 31, 36, -44, 40, 40, 31, 41, 83, -42, 37, 29,
+    -33, -29, 31, 26, 43, 85, 79, 25, -25, 39, 34, 33, 29, 60, 33, 41,
+    51, 43, -29, 25, -48, 29, 30, 26, 26, -29, 28, 48, 36, 33, -46, 35,
+    27, 41, -28, 25, 27, -82, -40, 41, 47, 47, 32, -50, -36, 27, -27, 30,
+    -36, 26, 35, 59, 30, -33, 41, 32, -28, -51, -26, 28, -26, 26, 36, -26,
+    26, 33, -27, 27, 38, 26, 46, -36, -44, -37, 44, 26, 30, -48, -29, 26,
+    50, 40, 53, -27, -38, 49, -27, -27, 67, 27, 29, -34, 29, 27, -27, 25,
+    42, -26, 25, 110, 26, 72, -53, -31, 43, 67, 41, -37, -46, 34, -25, -25,
+    57, -38, -27, 41, -27, -28, 46, 46, -55, 37, 33, 39, -31, 35, 28, 27,
+    34, -53, 39, 38, -31, 32, 33, -27, 30, -33, 31, 43, 26, 33, 40, 63,
+    37, 33, -35, 51, -42, 34, 36, 47, 35, -33, -30, 28, -25, 65, 41, 68,
+    31, 54, -44, -31, 83, 49, -47, -32, 45, -30, -40, -41, 31, 40, 59, -26,
+    40, -30, -53, 49, 38, -29, -28, -33, 70, 48, 25, 27, -65, -30, 26, 47,
+    -27, 44, -25, 36, -34, -36, -30, -35, 50, -27, 37, 54, -37, -49, -37, -25,
+    -49, -39, -29, 36, -45, -31, 54, -37, 31, 54, 27, 29, -44, -30, 36, -43,
+    39, -34, 25, 37, 35, 26, 27, -27, 49, 43, 26, -26, 27, 27, 27, 30,
+    -28, 37, 28, 45, 43, -25, 27, -53, -28, 28, 26, -48, -39, 34, 48, 29,
+    -53, -36, -36, -43, -53, -45, -60, -29, -31, -39, -36, -28, -28, -25, 33, -29,
+    33, -31, 28, 36, 32, -26, 48, -41, 25, -42, -42, 25, 30, 28, -26, 28,
+    36, 29, 26, 54, 40, -29, 29, 27, 47, -32, -40, 36, 29, -26, 26, -41,
+    30, 35, 44, -29, 37, 42, -26, -35, 52, 27, 26, -56, -26, 38, -35, 32,
+    -31, 27, 39, -54, 40, 32, 38, 31, -26, -28, 32, -33, 40, 35, -25, -28,
+    -36, 36, -28, 36, 26, 48, 40, -27, 28, -30, -26, -43, 26, -28, 45, -26,
+    30, 29, 25, 31, -34, -30, -26, 25, 25, 27, 36, 75, 45, 27, 26, 29,
+    41, 27, 30, 27, 58, 31, 27, 42, 27, 38, 27, 30, 51, 50, 26, 33,
+    30, 27, 31, 26, 35, 25, 27, 37, 29, -25, 32, -46, -26, 26, -63, 44,
+    29, -25, -31, -38, -34, -64, 35, 30, 59, -41, -52, -25, -42, -56, -30, -26,
+    32, -66, -33, -30, -33, 32, -51, -32, 44, -41, 48, 32, 61, -48, -48, 25,
+    75, -33, -46, 26, 35, -27, 29, 37, -58, 26, -33, 38, 56, 39, 27, 32,
+    31, 31, 32, 28, 29, 26, -32, 33, 49, 39, 40, 25, -28, -26, 61, -28,
+    -25, 31, 32, 32, 36, 36, 26, -30, 31, 33, -31, 27, 32, -33, -32, 25,
+    -27, 31, 30, 45, 33, -32, 25, 35, 28, -31, 27, 29, 48, 28, 65, 50,
+    25, 34, 37, 42, -32, 42, 26, 39, -63, 55, 33, -43, 29, 27, 34, 26,
+    35, 32, -49, 40, 43, 34, 26, 28, 33, -52, 42, 26, 43, -25, -44, 32,
+    33, -36, -43, -28, -37, 37, -28, -25, -30, 45, 50, -26, 35, 27, 25, -29,
+    -36, -29, 43, 28, 34, 37, -26, -27, 55, 26, 44, 50, -26, 43, 42, -30,
+    38, 26, 47, 26, 41, 32, -25, 25, 47, 28, -34, 41, 50, -32, 54, 31,
+    55, 33, -26, 33, -25, -29, 27, -38, 29, -25, -27, 34, 50, 26, 30, -49,
+    30, -43, -72, -35, -31, 36, 25, -26, -40, 28, -43, -30, -25, -34, 25, -29,
+    -47, 25, 49, 26, 35, -29, -28, 25, -35, -27, -25, 33, -41, 33, 29, 53,
+    25, 25, 27, -25, -30, -31, 31, 41, -25, -42, 37, -33, 41, 46, -26, 37,
+    -28, 35, 31, -29, 25, 27, 28, 28, 37, -35, 47, 27, 29, 35, 41, 25,
+    -31, -29, 35, -26, -36, -35, -27, -32, 27, -29, -29, -37, -28, -25, -31, -36,
+    -30, -28, -29, 29, -28, -32, 38, 27, -29, -43, 25, -27, -28, 35, 36, -37,
+    29, -43, -29, -37, 29, -25, -28, -26, 34, 28, -44, -29, -26, 34, -25, 25,
+    -30, -32, 48, -33, -34, -26, 44, 29, 26, -35, 55, -39, 37, 44, -34, -34,
+    29, 42, -26, 55, -25, -31, -31, 33, 66, -35, -28, -34, -27, 34, 27, 27,
+    25, 41, 46, -31, -35, 44, 27, -25, 30, 41, 28, 33, -31, 46, 26, 28,
+    -50, 68, 30, 37, 28, -28, 52, -33, 42, 30, 85, -27, 28, -27, 33, 37,
+    28, 56, 50, 58, 27, 59, 34, 25, 52, 34, 43, 34, 28, 27, 35, 26,
+    32, 50, 25, 31, 31, 37, 35, 42, 33, 42, 45, -27, -28, -27, 35, -70,
+    37, -26, 34, 26, 30, -35, -33, -27, -27, 32, 38, -30, 33, 25, 27, 29,
+    -38, -29, 32, 48, -27, -46, 25, -47, 62, 32, 63, -36, -37, -36, 65, 34,
+    44, -27, -42, 25, -59, -28, -48, 29, 64, -25, -90, -40, 51, -40, -35, 33,
+    -30, -69, -44, -32, 25, 75, 35, -29, 30, 26, 35, 37, -50, 30, 25, -29,
+    -48, -52, -54, -30, 36, 34, 25, 35, 54, 32, 26, 35, 50, 30, -50, -61,
+    31, -26, 36, -28, 29, -25, 32, 27, 39, 25, 28, 49, 29, -52, 32, 30,
+    33, 43, 27, -37, -34, 57, -39, 35, 33, -28, -25, -31, 31, 27, -45, 25,
+    31, -78, 61, -86, 35, 52, 33, -32, -65, -49, 48, -44, 51, 26, 60, -25,
+    -34, 25, -49, -31, 28, 36, -26, -28, -29, -32, -45, -26, 29, -25, -29, -25,
+    -60, 42, 29, -41, 31, 25, 37, -34, 25, 28, 28, 55, 35, 54, -29, -38,
+    -45, -65, -28, 30, 27, 26, -27, 29, -36, 28, -25, 26, 28, 43, 33, 35,
+    -52, 28, -29, 38, 41, 70, 43, -33, 27, 36, 25, 27, 30, 26, 29, -26,
+    36, -30, -39, 46, 43, -53, -26, 36, -34, -54, 40, 42, -53, 45, 44, 50,
+    28, 29, -37, 25, 26, 26, 31, 38, 29, -32, -37, 34, -28, 31, 28, 29,
+    41, -25, -31, 27, -39, -47, 31, -43, 30, 33, 27, 30, 37, 29, 48, -31,
+    44, 35, -26, 26, -30, -31, 29, -29, -33, -31, -63, 30, 29, -26, -48, -39,
+    39, -49, 27, 25, 38, 25, -27, 31, 26, -32, -26, 30, 32, -35, -26, -33,
+    -30, -38, -55, -32, -37, -27, -27, 27, -38, -36, -39, -33, 33, -27, -43, -30,
+    34, 28, -26, -34, -29, -56, -52, -46, 27, -30, 52, 35, -41, -47, -26, -26,
+    65, -36, -32, -29, -31, -56, -25, 28, 41, -28, 39, -35, 32, -42, 39, -38,
+    -30, 34, 25, -26, 29, -28, -32, 44, -62, -33, -36, -25, -27, -26, 27, -34,
+    -37, 26, -30, -44, -40, -27, 31, 44, -46, -33, 29, 30, 42, 30, -44, -29,
+    -28, -29, -53, -27, -38, 30, 30, 29, -36, 33, 33, 48, 30, 27, -29, 33,
+    -38, -54, 39, 38, 31, -73, 29, 25, -49, -25, 25, -27, 29, 25, 33, -41,
+    30, -36, 31, 41, -27, 53, -26, 32, -55, -25, 32, 57, 55, 37, -42, 30,
+    -55, 53, 33, -27, 28, -27, 28, 28, 41, -29, -59, 33, 26, 35, -34, -39,
+    45, 47, -53, -36, -35, -32, -27, 36, 30, 30, -64, 29, 33, 35, -27, 36,
+    29, 28, -35, 38, 26, 33, -27, 28, 41, 27, 28, 62, -34, -27, 37, 30,
+    25, 50, 25, 26, 50, 83, 27, -25, 32, 29, -29, 27, 42, 33, 45, 36,
+    25, 25, 46, 31, -29, -26, 45, 36, -35, 79, 26, -27, 29, 29, -44, 42,
+    29, 37, 31, -50, 53, -30, -26, -29, 36, 36, 31, -27, 47, 35, 36, 28,
+    51, -26, -37, 28, 31, -49, 25, -26, 27, 39, -54, 39, 29, -49, 32, -30,
+    36, 30, 31, 25, 46, -43, -45, 25, 26, 56, -31, -43, -55, -85, 38, 27,
+    39, -27, 34, -33, -36, -85, 39, -44, 31, 36, 26, 53, 64, 39, 42, 52,
+    42, 26, 45, -25, -37, 51, -25, 40, 35, -30, -41, 50, -28, 28, 29, 39,
+    35, -35, 29, -35, 28, -33, -31, -33, 37, -28, 33, 30, -32, -30, -56, -29,
+    -51, -32, -29, 27, -32, -84, -47, -36, -25, -52, -34, -28, -33, -34, -39, -27,
+    -58, -26, -31, -29, 29, 25, 28, -36, 27, -32, 28, -30, -28, 30, 48, 28,
+    -27, -27, -25, 59, -27, 28, 25, 41, 25, 27, -35, 27, -27, 28, -27, -49,
+    29, 44, 38, 34, -40, -35, 44, 34, 97, -27, 29, -43, 47, -56, -32, 33,
+    27, 36, 28, 54, 32, 51, -26, 93, -25, -31, 84, 29, 49, -34, 35, -29,
+    28, 26, 26, 30, -31, 32, 32, 27, 34, 47, -29, -28, 30, -26, 25, -38,
+    27, -27, 41, -29, -35, 25, -61, -44, 27, 29, -32, 26, 25, 32, -32, 43,
+    29, -30, 25, -26, 39, -34, -27, 26, -29, -45, -41, 40, 38, -27, 26, 26,
+    27, 55, -35, -25, 35, -42, -29, 28, 36, 32, -44, 27, 34, 25, -54, 30,
+    -40, -38, -40, -26, 40, 34, 34, -30, -25, -31, -29, 25, -32, 33, -30, -37,
+    -28, -37, -39, 34, 30, 26, -39, 25, -25, -32, -41, -38, 41, 43, -52, 27,
+    -28, -31, -41, -28, 34, -29, 26, -51, 28, 46, 27, -37, 25, -34, 28, -45,
+    30, -25, -38, -45, -33, 35, 29, -28, -31, 25, -50, 30, -55, -36, -41, 27,
+    -42, -28, -33, -27, -26, -55, 29, -33, 37, -26, 25, 31, -32, 35, -39, -36,
+    -37, 37, -27, -41, -38, -36, -29, -35, 43, 26, -33, 27, 41, -30, 28, -25,
+    25, -38, 35, -25, -29, 28, 43, -25, -35, -34, 31, 28, -35, 39, 25, 33,
+    47, 31, 25, 30, 36, -43, -36, -30, -33, 51, -25, 28, -34, -35, 28, 29,
+    25, 32, 43, -30, 30, 33, 26, 27, 28, -41, 32, -27, 26, 29, 44, 26,
+    -31, 26, 59, 29, 36, -37, -28, 39, 30, 31, 38, 27, 32, 35, 25, 32,
+    77, 28, 39, 26, 41, 27, -30, 40, 27, 46, 40, 30, 39, 34, -29, 36,
+    32, 35, -26, 27, -25, -35, -26, -25, -31, -41, -31, -81, -43, -26, -28, -26,
+    -30, -34, -28, 35, -26, -30, -34, -42, 44, -36, -40, -25, -25, -27, 59, -30,
+    -28, -26, 25, 27, 34, -33, 28, 32, -30, 28, 35, 35, -37, 31, 67, 36,
+    -30, 50, -26, -31, 26, 27, -27, -25, 26, 27, -35, 30, 25, 47, -50, 29,
+    -35, -29, -30, -26, -58, -28, 35, -29, 46, -36, -47, -29, 34, 46, 31, -28,
+    27, 25, -30, -37, 28, 28, -25, -49, -79, -54, 58, -29, -34, -27, -26, 60,
+    25, 56, 40, 36, -29, 34, -43, 38, 30, 26, 37, -31, 32, -62, -46, -34,
+    31, 73, -51, -41, 37, -30, -35, -31, -36, 35, 25, -34, 31, 38, -35, 32,
+    -27, 57, 43, -26, -36, -58, -48, -32, 57, -42, -32, -39, -44, -31, -32, -26,
+    35, 37, -28, -38, -44, -37, -32, -77, 34, -29, -33, -50, -26, 38, 35, 33,
+    27, 41, 47, -41, 38, 28, 62, 32, 32, 34, 35, -38, 30, -28, 41, -43,
+    34, -26, 27, -32, 28, 25, -34, 41, -31, 28, 28, -43, 26, -38, -30, -31,
+    27, -35, -40, -38, -32, -27, 29, 38, -30, 27, 29, -30, 35, -43, -27, 26,
+    -49, 36, 55, -33, -32, 32, -48, 33, 60, 25, 43, -40, 35, 41, 50, 41,
+    48, 37, 38, 42, 35, 39, 40, 27, 27, 44, -25, 26, 31, 30, 26, 37,
+    38, 42, 38, -41, 31, 27, 26, -55, -30, 30, 30, 38, -31, -26, 28, -37,
+    -27, -31, -33, -27, 44, -36, -27, 42, 33, -26, 42, -42, -29, -36, 26, -31,
+    -38, -25, 30, 38, 30, -35, -28, -52, -43, 69, 34, 25, 33, -30, -34, -26,
+    43, -28, 30, 31, 28, 28, 31, 38, 49, -28, 30, 28, 26, 39, 30, 37,
+    38, 63, -29, 26, 27, 34, 28, -34, 30, 30, -41, 27, 31, -26, 28, 25,
+    -27, 41, 33, 31, -35, -40, 25, -26, -30, -45, 35, -46, 42, 81, -63, -45,
+    -40, -36, -45, -46, -48, 51, 27, 25, 34, -34, 41, 54, -30, 28, -29, 51,
+    -44, 37, 39, 30, 27, 25, -40, 35, 37, 60, 58, 42, 34, -54, 25, -32,
+    29, 28, 56, 31, -28, 26, -43, 42, 39, -27, 36, 31, -41, -49, 56, -43,
+    30, 28, 30, -26, -30, 30, 27, 36, 30, 26, -27, -30, -36, -30, 31, -31,
+    31, -58, -29, 29, -61, -26, -36, -27, -42, -34, -45, 28, 27, -29, -46, -25,
+    27, 50, 29, -30, 28, 41, -26, -28, -25, -25, 25, -52, -27, 51, 47, 26,
+    59, -34, 45, 26, 80, -25, 27, 43, 27, 51, -32, 33, 58, 25, 46, 51,
+    28, -63, 48, 27, 29, -31, 26, 35, 33, 34, -25, 28, -53, -35, -46, 36,
+    -77, 26, 25, -34, 32, -28, 33, -36, -28, -50, -27, -32, 51, -61, -41, 45,
+    36, -42, 30, -32, -46, -27, -30, 26, 31, 34, 30, -35, -43, -31, 37, -36,
+    -34, -46, 32, 35, 37, -47, 29, 25, -32, -28, 29, -36, -43, -38, -26, 39,
+    -40, -34, -26, -29, -35, -36, 42, -32, -30, -36, -25, -51, -34, 25, -28, -32,
+    27, -28, -36, -42, -34, -35, -39, -31, -37, 33, -32, -34, -70, -29, 41, 26,
+    28, -28, -30, 38, -26, 31, 36, 26, 39, -37, -45, -26, -29, -45, -34, 34,
+    -31, -56, -39, 35, -25, -37, -30, 34, 26, 29, -38, 27, 31, 25, -26, -27,
+    30, -46, -56, -37, -34, -35, 28, -39, -29, -54, -30, -37, -28, 27, -79, -41,
+    25, -27, 29, -29, 25, 37, 36, -32, 31, -57, -28, -27, 25, -42, 31, 25,
+    48, 58, -28, 40, 27, 29, 25, 29, -27, -28, 31, 31, -31, -34, -33, 42,
+    32, 48, -26, 26, -32, 37, -25, 37, 35, -27, -32, -32, 28, -44, 38, 26,
+    30, 26, 31, -25, -33, 28, 28, 30, -33, 38, 55, 25, -42, -26, -31, -25,
+    38, 34, 28, -38, 34, 29, -33, 26, 64, -63, 36, 29, 88, 31, -35, 26,
+    34, 44, 25, 27, 31, 30, -40, 47, 39, -27, 26, 25, -26, 26, 33, 27,
+    25, 27, 33, 27, 34, 32, 31, 27, 33, -37, 27, -28, -25, 34, 37, -30,
+    26, 31, -29, 40, -27, 56, 29, 25, 42, 45, -31, -27, 31, 27, -37, -25,
+    28, 31, 33, -27, 26, -35, -41, 25, -26, -58, 30, 27, 32, 25, 26, 30,
+    36, 48, 32, 41, 26, -30, 32, 27, 30, 26, 36, 34, 29, 27, 31, -46,
+    36, -29, 25, 27, 37, -27, -51, 36, 32, 41, -39, 27, -25, 30, -57, -38,
+    -38, -26, -32, -25, 38, -25, 34, -41, -35, -26, -25, -28, -29, 29, -40, 25,
+    -50, -27, -32, 25, 41, -32, -40, -49, 34, -27, -35, 43, 30, 31, 28, 35,
+    -49, -37, 29, -44, -55, -28, 26, 33, -32, -32, -46, -38, 28, 32, 30, -32,
+    -27, 31, 47, -42, -55, -33, -46, -42, 39, 36, -37, -26, 31, -33, -31, 52,
+    -26, -37, -40, 35, 58, -33, -25, -34, -27, -34, -44, 29, -29, -28, -66, 27,
+    35, -33, 30, 27, 27, -28, -42, -48, -41, 39, -35, -31, -25, 31, -37, 27,
+    -50, 57, -42, -27, 30, 29, 46, -65, -78, -31, 28, 28, 29, 27, 54, 36,
+    -56, -27, -29, -71, -25, -62, -27, -50, 26, -32, 33, -45, 41, 31, -49, -39,
+    53, -27, -34, 31, 32, -50, -32, -35, -39, -35, 32, -32, -64, -33, -38, -44,
+    30, -29, -26, 33, -25, 50, 25, 37, -28, 26, 28, 27, -38, 34, 44, 29,
+    37, 47, 37, -25, 31, 44, -41, -55, -42, -30, 26, 27, -40, 25, 35, -37,
+    33, 26, -59, -35, 41, -39, 29, 25, 30, 54, 36, 52, 29, 38, -47, -48,
+    42, 38, 57, 32, 53, -41, -34, -46, -27, 43, -25, 62, -26, 44, 25, -46,
+    -64, -47, -39, -44, -29, -39, 26, 29, -41, -26, 41, 35, -27, 46, 36, -35,
+    33, 73, -29, 30, -67, -40, -28, -25, 29, 49, -66, 76, 45, 55, 33, 33,
+    32, 34, 28, -31, 27, 25, -48, -50, -47, -33, -72, -52, -27, -28, -42, -39,
+    -38, -68, -44, -65, -25, 29, 34, -47, -38, 59, 28, -76, -36, -25, -49, -27,
+    33, 28, -32, 35, -28, 25, 29, -30, -29, 42, 31, 32, 29, 25, 27, 25,
+    -32, 30, 34, -38, 36, -26, 37, -49, -29, -49, -48, -48, 29, -36, 28, 25,
+    35, -27, 32, 31, -34, -31, 25, -28, -42, -29, -47, -25, 46, 26, 35, 36,
+    41, -32, -38, -32, 44, 29, 25, -25, -27, -27, 39, 29, -95, -32, -54, -29,
+    34, -37, -28, -43, -43, 30, -35, 73, -27, -27, 56, -39, 40, -35, 36, 25,
+    -26, -47, 26, -39, 30, -27, -28, 27, -52, -75, -58, -50, -33, 42, -32, -31,
+    -30, -29, -26, 27, 33, -72, -46, 40, -36, -36, -26, 25, -28, -37, -31, 47,
+    -29, 43, 32, -29, -31, 28, -49, -44, -42, -33, -44, 28, 37, 39, 42, 33,
+    89, 30, 27, -32, 31, 37, 26, -31, 25, 26, 83, 36, 29, -32, -30, 37,
+    26, 44, -33, 46, -30, 39, 38, -37, 32, 51, -41, -37, -46, -31, -44, -30,
+    -39, 32, -33, -29, -25, -29, -32, -25, -35, 34, -36, -29, 28, 32, -28, 30,
+    53, 34, 39, -36, 36, 63, -30, 30, 37, 38, 37, 42, -60, -26, 37, -26,
+    -56, 33, -31, 26, -37, -44, -35, -29, 27, -28, -25, -29, -29, -74, 39, 26,
+    27, -39, -35, 34, 28, 29, -33, -28, -55, -68, 28, 27, 38, 40, 30, 31,
+    -100, -33, -28, -90, 38, -35, -34, 26, -76, -27, -27, -55, -52, 41, 38, 30,
+    29, 40, 34, -48, 25, -38, -46, 45, 38, -65, 35, 54, 53, -40, 45, -26,
+    29, -55, 37, 26, -36, 37, -46, -28, 33, -42, -28, 26, -27, 53, 37, 26,
+    30, -26, 30, 33, -65, 29, 31, -42, 46, 50, -37, -36, 27, 30, 50, 29,
+    -44, -32, 29, -32, -63, -34, 25, -34, -31, 31, -48, -37, -33, -27, -45, 33,
+    28, -36, 38, -41, -39, 54, 39, 33, -69, -52, -78, 43, -49, 49, -47, -33,
+    -48, 31, 28, 49, 38, -51, -101, -32, -87, -25, 30, 27, -26, 25, -27, -31,
+    27, -47, -73, -61, -52, 35, -30, -51, 99, -56, 36, -27, 48, 32, -33, -42,
+    28, 34, 68, 69, -59, -43, -43, 29, -36, -35, 27, 28, -35, -44, -38, 37,
+    37, 45, 53, 55, 45, 26, -31, -26, 30, 33, 25, 33, -26, 41, 25, 31,
+    -26, 35, 32, 31, -31, 40, 36, 27, 33, 42, 27, 30, 44, -31, 25, 26,
+    26, 26, 34, 29, -37, 45, -35, -54, -43, 27, -30, -36, -37, -43, -50, -43,
+    36, -35, -43, -48, 28, -26, -34, -37, 31, 41, -55, -40, -30, 32, -40, -26,
+    40, 42, 35, -26, -29, 32, 26, 26, 32, 42, -73, -33, 34, 27, -35, -30,
+    28, -31, -26, 40, 43, 51, 31, -55, 43, 34, -32, 28, 36, -30, 34, 26,
+    37, -62, -51, -31, 30, 48, -31, -26, 26, -33, 46, 32, -25, 26, 41, 57,
+    30, 38, -52, -44, -33, -44, -36, 31, -27, -30, -41, -25, 31, -60, 26, -33,
+    34, 26, -67, 27, 68, -77, 59, -84, 25, 32, -27, 36, 37, -35, -44, -36,
+    25, -25, -45, 28, -32, -27, 30, -25, -25, 37, 27, -31, 34, -30, -25, -31,
+    26, -25, 42, 28, -31, 31, 43, -28, 41, 43, 31, 54, -29, 34, 38, 26,
+    -30, 31, -26, 61, -52, -30, 26, 40, 29, 26, -71, 36, 43, -41, -38, 47,
+    -34, 81, 39, -41, -39, -28, -55, -98, 31, -27, -80, -100, -28, -106, -91, -28,
+    -70, -65, -66, -71, -38, 30, -33, -35, -51, 27, -47, -38, -60, 29, -26, -35,
+    -66, -43, -41, 25, -44, -31, -63, 37, 34, 50, -59, 34, 56, -77, 27, 26,
+    29, -53, 28, 65, 32, 39, -76, -25, 48, 29, -29, -27, -39, -26, -25, 37,
+    27, -45, -42, 28, 28, 25, 51, 38, -31, -36, -43, -71, 38, -27, -43, -38,
+    -40, -45, -64, 32, -26, -52, -27, -28, -75, 26, -50, 42, -33, 72, 31, 46,
+    44, 32, -28, 26, 49, -43, -39, -44, -43, -36, 54, -44, -42, 31, -34, -28,
+    -53, 45, -38, 32, -28, -44, -34, 35, 32, -25, -36, 31, 33, -31, -30, 26,
+    31, 38, 43, -27, 39, 37, 25, -36, 27, 25, -43, 59, 43, -40, 30, 26,
+    -60, -32, 28, 36, 26, -38, 35, 32, 42, 29, 35, 30, 33, 25, 26, 27,
+    34, 28, 35, 29, -38, -25, -25, 35, -30, 32, 48, 38, 40, -34, 32, 32,
+    -27, 59, 39, -28, 25, 31, 28, -28, -31, 28, -36, 38, 46, -29, 39, 48,
+    27, 38, 41, 26, -31, 37, -30, -25, 27, 33, 38, -30, 31, -31, 31, -36,
+    -27, -45, -27, 34, -34, 47, 42, 36, 26, -32, 28, 29, 25, 31, 28, 28,
+    32, 26, 25, 27, 35, 26, 33, 41, -25, 37, 34, 34, -36, -38, 32, 30,
+    32, 40, 37, 32, 27, -27, 58, 29, 42, 31, 28, 39, -37, -32, 45, -54,
+    -39, -42, -30, 27, 29, -31, -26, -39, -35, -31, -29, 25, -26, 25, 26, -29,
+    -30, 27, -47, -27, -32, -28, 38, 43, 30, -38, 47, 31, 28, 35, 42, 29,
+    67, 37, 29, 25, 38, -25, 29, -38, 50, -27, 36, -25, -27, -30, 28, 25,
+    47, 47, 26, -27, 33, -26, 25, 33, 28, 38, 61, 29, 44, 47, 27, 39,
+    45, -27, 30, 40, -26, 30, 29, 29, 31, 32, -45, -46, 57, -36, -60, -30,
+    -47, -46, 27, 30, -32, -31, 39, 31, 29, 46, 36, 66, 36, 27, 40, 29,
+    -25, 26, 25, 44, 29, -27, 54, 52, 82, -29, 42, -25, 47, -31, -36, 48,
+    31, 33, -26, 30, 25, -27, 39, 43, 36, -35, 48, -30, 25, 28, -58, -25,
+    43, 25, -34, 40, 36, 26, -35, 28, -48, -32, 40, -33, -28, -25, -50, -29,
+    27, 32, 26, 37, 37, 25, 41, 29, 36, 33, -32, 29, -55, -26, 28, 61,
+    -27, -31, -40, 47, -60, 39, 45, 31, 35, 32, 31, 54, 73, 50, 55, 35,
+    40, -44, -35, 25, 34, -27, 29, -37, 25, 29, 82, -39, -41, -25, -29, -31,
+    -29, 41, -38, 66, 51, -34, -29, -28, 47, -31, 39, 39, -40, -26, 40, 30,
+    -38, -31, -37, -25, -28, 28, -49, -30, -35, 32, 33, -39, -31, -25, -53, -64,
+    -40, -40, 44, 36, 30, 33, -45, 41, -26, 25, 34, 56, 37, -29, 29, 28,
+    30, -36, -25, -36, 37, -26, 38, -27, -31, 25, 47, -27, 29, -28, 25, -29,
+    -33, -40, -34, 29, -44, -44, 27, -26, -45, 41, -33, 30, 30, -25, -30, -36,
+    45, 35, 27, 28, 33, 34, 38, 28, 48, -28, -29, 34, 49, -26, -41, -34,
+    -30, -40, -25, -35, 30, -28, 56, 26, -32, -34, 25, -32, 36, -26, 30, 54,
+    -28, 34, -33, 28, 31, 46, 30, 29, -25, -49, -28, -39, -27, -42, -28, 39,
+    -27, -36, 28, -33, -25, -57, 27, -40, 28, 36, 46, -32, -26, 42, -29, 35,
+    -40, -39, -29, 32, -32, -44, 28, 46, 37, -37, -39, -29, -26, -28, 42, -27,
+    25, 33, -30, -36, -38, -34, -27, -28, 49, 35, -34, -32, -37, -28, -41, -38,
+    -30, -35, -45, 36, -49, -26, -43, -55, -31, -28, -41, -27, -33, -38, -36, -52,
+    45, 37, 36, 25, 43, 58, 62, 38, 39, 35, 34, 44, 26, 26, 30, 55,
+    36, 27, 32, 29, 49, 31, 25, 75, 27, 26, -29, 58, 55, 26, 36, -27,
+    28, -49, -29, 30, 31, 30, -61, 47, -46, 64, -25, -54, 28, 28, 45, -73,
+    -31, 40, 31, 61, 29, 36, -26, 27, -29, -28, 25, 28, 38, 37, 36, -27,
+    31, 27, 77, 40, 32, 49, 29, 27, 57, 25, 37, 47, 32, 34, -70, 25,
+    41, 25, 29, -25, 42, 43, 30, -52, 27, -25, 26, -30, -47, -25, 45, 36,
+    -25, -25, 33, -44, 32, -87, -38, -29, -32, 43, -30, -27, -31, -30, 67, -26,
+    81, -37, 27, 40, -28, -29, 30, 25, 35, -34, 25, 25, -45, -39, 32, -31,
+    45, 35, 30, -32, -26, 32, 25, 43, 30, 65, -29, 25, -31, 27, 48, 31,
+    32, -62, 29, -32, 48, 48, -38, 25, 27, -49, 48, 43, -26, -25, 88, -26,
+    -41, -28, -33, -33, 37, 45, -34, -26, -32, -39, -42, -44, -65, -38, -35, -52,
+    -32, -29, -37, 45, 49, -27, -27, -46, -37, -30, 30, 29, -27, 27, 40, -39,
+    -29, -33, -47, 26, -49, 28, -31, -31, -29, -30, -30, 30, 46, 45, 31, 29,
+    -28, -40, -43, 35, -32, 30, 33, 30, 50, 25, 25, -27, 42, 43, 26, -29,
+    -27, -30, -27, 45, 28, 34, 36, -26, 48, 29, 39, 27, 28, -29, -69, -27,
+    53, -41, -32, -27, -41, -42, -29, 32, 27, -26, -53, -59, 50, -29, -51, -25,
+    39, -25, -25, -33, 36, 43, -34, 38, 29, 28, -30, 39, -29, 29, 34, 26,
+    28, 38, 34, 25, 39, -25, 34, -32, -26, 31, -43, -30, 29, -25, 32, 38,
+    -38, 26, 40, -25, 53, 45, 64, -46, 33, 35, 35, 42, 76, 26, 32, 31,
+    46, -33, 50, -40, 30, -37, 49, 25, 40, 27, -30, 43, 25, 45, 29, 33,
+    26, -26, 37, -27, 29, 30, -57, -48, -27, -34, 26, 44, 37, 36, 26, 41,
+    -25, 26, 31, 25, -71, -37, 30, 33, 26, -31, 31, 25, 44, -25, 28, -26,
+    34, -49, 28, 46, -45, -37, 28, 30, 26, -33, 32, -31, -32, 28, 31, 29,
+    -28, 46, -26, 39, 35, -30, 37, -30, -25, -37, -26, -25, 29, -34, 26, 43,
+    -41, -31, -30, -31, 32, -38, 36, -26, -29, 25, 28, 44, 35, 29, -42, 39,
+    -27, -30, -62, 26, -28, -53, -52, -25, 41, -38, -32, -29, -51, -33, -27, -37,
+    -40, 25, -28, 26, 32, 60, -46, -36, -35, -82, -30, 48, -37, 30, 25, 28,
+    28, -29, 31, 35, -30, 35, 25, 28, 31, -29, -32, 27, 25, -25, -28, 29,
+    39, 39, -33, 27, -52, 37, -43, -27, -31, 40, 26, -56, -33, -31, -41, -35,
+    -26, 39, -40, -25, -40, 28, -41, 33, 43, -27, -26, -31, 30, 31, 27, 41,
+    41, -45, -28, 30, 30, 29, -29, 30, 29, -28, -40, -32, 45, 27, -27, -29,
+    -28, -27, -30, -32, -29, -27, 25, 34, -47, -48, -28, 39, -26, -35, 38, -40,
+    -44, -36, 26, 25, -26, 29, -39, -31, -30, 39, 31, 54, -35, 33, 38, -27,
+    -52, -62, 25, 41, 51, -25, 43, -26, 71, -41, 25, 82, 42, -28, 33, 63,
+    28, 27, -47, 31, 27, -31, -37, 53, -32, 37, -27, -34, -55, -28, -36, 37,
+    46, -36, 35, 53, -27, -35, 33, -29, 31, -36, -27, -25, 36, -25, 32, -30,
+    28, -42, 35, 28, -32, -28, 27, -25, -35, -25, -38, -37, -43, -29, 26, 38,
+    46, 30, 84, 39, -25, 34, -29, -56, 45, 25, -29, 49, 54, -41, -57, -71,
+    38, 25, 44, -55, 26, 40, 43, -75, -46, 26, 35, 68, 47, 89, 35, -25,
+    -35, -35, -29, 27, 31, 33, -25, -32, 25, -37, 33, 28, -37, 47, 38, -26,
+    43, 33, -38, 27, 30, -41, 53, 31, -30, 27, -43, 36, 39, 45, 29, -33,
+    -25, 25, 33, 28, 47, 25, 28, 25, -45, -28, 41, 41, 36, 31, -29, 53,
+    27, 41, -27, 25, -26, 25, 38, 45, -36, 39, 28, 34, 30, 28, 34, 40,
+    30, 26, -41, 83, 30, 32, 50, 26, 38, -27, 29, -29, 41, 28, -44, 25,
+    32, -42, 44, 37, 37, -50, 50, 29, -25, 58, 39, 43, 33, -56, -35, -26,
+    56, 65, -32, -40, 60, 45, -47, -32, 39, 25, 28, 41, 37, 25, -35, 42,
+    62, 45, 37, 30, 39, 33, 27, 28, 25, -29, 51, -26, 36, 26, -26, 41,
+    26, -37, -30, 25, -28, 28, 45, -30, -41, -28, -29, -29, 27, -26, 32, -29,
+    -25, 29, 29, -35, -33, 38, 35, 38, -28, 34, 31, 28, 34, 28, 27, -45,
+    30, 26, 51, 30, 28, 71, 46, 30, 32, 49, 33, 27, 41, -34, -34, 32,
+    -27, 26, 26, 35, 40, 34, 36, 25, 27, -52, 42, 29, -29, -35, 34, 41,
+    84, 35, -27, 39, 55, -48, -29, 37, 39, -28, 36, 33, -29, -30, 26, 29,
+    -27, 29, 39, 39, 38, 49, 47, 27, -30, 39, -32, -30, -29, 26, 25, 28,
+    26, 29, -60, 43, -30, 37, 25, -44, -40, -34, -48, 25, 26, -44, 32, 36,
+    -34, -30, 38, 36, 26, -44, -28, -38, -30, -37, 26, 29, -35, -27, 25, 34,
+    -57, -28, 28, 29, 49, 37, 28, -40, -42, 28, -25, -29, 61, 68, -30, -29,
+    -32, 25, -26, -48, 35, 31, -55, 36, -35, -38, 41, 32, 30, 30, 49, 38,
+    39, -26, 28, -44, -25, -35, 44, -27, -52, -30, -30, 36, 40, 32, 27, 58,
+    -52, 33, -25, 25, -28, 35, -26, 29, -39, -35, -27, 34, -32, 34, 34, -44,
+    -29, -32, -48, -38, -36, -36, -27, -28, -27, 25, -42, -25, 34, -26, -25, -26,
+    -32, -66, -34, 48, 25, -45, 32, 36, 47, 39, 34, 58, 29, 45, 39, 59,
+    -25, 36, -41, -35, -28, 38, -33, 34, -35, 30, 25, -31, -55, -27, 36, -31,
+    -29, 53, -40, -30, -40, 48, -28, 52, -31, -26, 29, -35, 44, -41, 48, -31,
+    25, -33, -36, 33, 32, -32, -35, -31, 26, -44, 27, -33, -44, 29, 27, -27,
+    -54, 40, 30, -27, 52, -41, -58, 33, 29, -39, -27, 30, 31, -25, 25, -44,
+    -27, -25, 27, 42, 28, 26, 30, 32, 38, 45, -27, 35, -39, 28, 39, 33,
+    25, 43, 27, -33, 30, 37, 26, 26, -26, 28, 29, 59, 36, 35, -44, -37,
+    -25, 42, -42, 25, -36, -25, -27, -39, -28, -40, 40, -33, 44, -29, -38, -32,
+    -33, -29, -50, 32, 32, 30, -64, -34, -25, -40, 40, -25, 25, 29, 39, -42,
+    27, -25, -32, -26, -25, -39, 48, -25, -25, -32, 26, -25, -56, -25, 26, 25,
+    72, 36, 43, 29, 42, 39, 27, 34, -27, 33, 40, 27, 36, 33, 28, 31,
+    61, 47, 46, -38, 28, 28, 52, 27, 50, 29, 36, 36, -61, 49, 28, -25,
+    33, 54, -25, 29, 28, 28, 43, -34, 39, 30, 35, 35, -26, -64, 27, -27,
+    -25, 32, 26, 28, -32, 36, -28, 39, 25, 27, -45, 25, 25, 48, 35, 28,
+    47, 27, 25, -35, 39, -29, -37, 33, -31, -25, -28, -61, -34, -40, 34, 29,
+    35, -51, 50, -25, 36, 27, -26, 26, 48, 27, 27, -74, -56, 30, 28, -74,
+    -48, -25, -28, -25, -28, 25, 57, 29, 37, 38, -26, -25, 35, -26, 31, 40,
+    27, -51, 31, 26, -27, -56, -50, -25, -44, -26, -26, -26, -29, -34, -25, -25,
+    29, 39, -62, -25, -38, -44, -25, -36, -39, -31, -34, -33, -28, -27, -45, -30,
+    -41, -38, 40, -47, -25, -25, 27, 39, -26, -40, -45, -44, 43, -44, 30, -36,
+    -36, -42, -26, 40, -26, 41, -50, 25, 29, -50, 32, -28, 26, -34, -37, -27,
+    -57, -68, -30, 36, 32, -59, 29, 61, 42, -51, 50, -55, -35, -26, 25, -35,
+    -56, -50, 31, 34, -29, 37, 32, 37, 78, 31, -25, 37, 80, -51, 47, 43,
+    38, 33, -42, 73, -40, 36, 29, 27, -46, 26, -50, 25, -44, -33, -68, -29,
+    -36, -45, -70, 48, 40, 40, 33, -31, -32, 25, 30, 38, -40, -26, -43, -26,
+    28, -25, -35, -48, -26, -42, -26, 63, -30, 39, -26, -40, 30, -52, -38, 46,
+    25, -26, 35, 37, 34, -35, -39, -34, 26, -41, -37, 40, 58, -27, -46, 70,
+    33, 25, 32, -36, 37, -30, -31, -26, 35, 38, -40, -42, 33, 33, -31, 38,
+    -27, -34, -28, -27, 29, 31, -27, 29, -31, 26, 30, 37, 49, 30, 30, 43,
+    40, -34, 45, -42, 43, 45, 29, 26, -52, -45, 40, -44, 26, 39, -25, 43,
+    45, -33, 33, 37, 39, 31, 44, 62, 50, 35, -33, 29, -31, 29, -31, -45,
+    -28, -27, -25, -55, -39, -25, 26, -30, 27, 32, 48, 50, -35, -29, -25, 28,
+    -31, 59, 41, 27, 35, -26, 27, 25, 29, 30, 45, 33, -32, 64, 31, 30,
+    27, 35, 48, -30, 46, 63, -27, -42, 51, 25, -31, 29, -35, -44, -26, 27,
+    29, -30, 30, -27, -51, -38, -25, -25, 26, -32, -27, -31, 29, -27, -39, 25,
+    -30, -44, 30, -64, -35, -30, 28, -27, -40, -49, -42, 29, -34, 33, -39, 77,
+    -58, 28, 31, -38, 32, 27, -32, -31, -29, 31, 50, 29, 38, 28, -50, 33,
+    -31, 50, 48, 44, -29, 49, 27, 45, 33, 35, -26, 41, -26, -36, -26, -32,
+    27, -30, 25, -28, -73, -27, -26, 34, -25, -32, -25, -39, 29, 42, 44, 25,
+    39, 31, 43, -42, 30, -34, 30, 25, 43, -76, 35, 26, -28, -45, -36, 25,
+    29, 25, -33, -28, -36, 29, 72, -30, 25, 41, -37, -27, -45, 40, 50, 25,
+    29, 30, 27, 40, -31, -52, 32, 40, 27, 39, 36, 25, 28, 38, 38, 55,
+    27, 51, 41, 29, 49, 40, 33, 31, 25, -30, -27, 34, 40, 29, -32, 30,
+    -25, -27, 26, -29, -29, 29, 26, -50, -40, 38, 39, 36, 28, -32, -40, 28,
+    29, -35, -56, -44, -46, 26, -25, -41, -27, 35, 39, -46, 27, 37, -29, -39,
+    27, -47, 26, -46, -27, -31, 29, -41, -40, -25, 31, 25, -36, -36, -37, -25,
+    -30, 29, -28, 34, 46, -25, -30, -36, -32, -30, -40, 44, 36, 31, 30, 31,
+    28, -29, 32, -37, -43, -28, -25, -29, -29, -39, 29, -35, 33, -31, -33, -26,
+    54, -48, -44, 26, -26, -32, -29, -31, -34, 36, -29, 38, -25, 36, -32, -28,
+    34, -25, 27, -47, -25, 42, -34, 64, 38, -30, -34, -25, -27, -34, 36, -32,
+    37, 36, 31, 58, 60, 35, 30, -42, -36, 48, 43, 26, 25, 34, -35, 30,
+    33, 30, 27, -27, 33, 52, 30, 31, 25, 53, 36, -27, -26, 41, 34, 65,
+    -26, 27, -28, 45, 34, 41, 82, 29, 49, 25, 40, -32, 34, 25, 30, -56,
+    -29, 26, 26, -38, 41, -27, -37, -36, 29, 31, -45, -62, -25, -58, -33, 27,
+    26, 43, -70, 25, -25, 27, -51, 35, -34, -81, -49, 34, 47, -25, -27, 48,
+    -27, -29, 37, -33, -68, -25, -35, 37, -28, -33, -36, -36, 34, 41, -26, 50,
+    37, -30, -25, -25, -38, 52, -29, -51, 33, -36, 40, -34, -38, 28, 29, 54,
+    33, -33, -47, 28, -27, -41, -31, -57, -26, 89, 62, -25, 32, -28, 47, -41,
+    45, -30, -25, 36, 50, -31, 62, -33, 32, -35, -36, -60, 35, 54, -28, -32,
+    40, -35, -52, -27, 29, 49, -36, -27, -33, 31, 40, -42, 27, -68, 27, 29,
+    -32, 37, 44, -25, 36, -25, -58, -63, -44, -25, -82, -26, -48, -41, -32, 42,
+    -31, 25, -26, 43, -57, -44, -32, -26, -31, -45, -35, 25, -55, -25, -35, -41,
+    39, -39, -25, -53, -28, -26, -40, -36, -38, 27, -43, 30, -38, 27, -26, -45,
+    25, 37, -29, -26, 31, -30, -27, -36, 30, 32, -30, -28, 26, 38, 40, 25,
+    34, 26, 38, -46, -30, -30, 39, 28, -30, 59, 46, -31, -28, 33, 25, -45,
+    25, 27, -30, 40, -28, 26, 25, -32, -26, -32, -35, -58, -28, -34, -53, -28,
+    28, -42, -68, -28, -46, -34, -31, -33, -33, 26, -32, -53, 28, 36, -31, -28,
+    34, 45, -29, 25, 51, -39, 34, 36, 47, 29, -30, 30, -35, 30, -26, 59,
+    36, 39, -25, -51, -29, 32, 25, 35, 46, 27, 27, -37, 45, 26, 28, 32,
+    27, 34, -48, -66, -29, -32, -49, 28, -35, -27, -52, -40, -37, 35, -38, -26,
+    -34, -26, 40, -28, -25, 25, -28, -33, -69, -40, -27, 32, -26, 46, -39, -26,
+    29, -31, -31, 34, -36, -32, -37, -26, -39, -25, -32, -32, -39, 27, -30, -36,
+    40, 56, -49, -32, 26, 34, -25, -33, -42, -29, -64, -26, -30, 34, 35, -51,
+    -30, -27, -36, -56, -45, -36, 27, -53, -25, 0, -25, 0, -27, 0, 0, -25,
+    31, -29, -61, -64, -31, -35, 25, 31, -28, -32, 36, -28, 34, -30, 27, -35,
+    -27, -31, 27, 26, -27, 58, 60, 45, 48, -33, -55, 34, 27, 56, 37, -50,
+    32, 26, 25, 28, -29, 40, 42, 37, -27, 42, -27, -30, -30, -36, 36, -34,
+    -36, 37, -31, 25, 25, -26, -27, -32, -35, 38, -31, -47, 40, -31, 49, -31,
+    25, -31, -41, 35, -31, -27, -30, 36, 52, -34, -37, -37, -36, 45, -28, -43,
+    -33, -30, -42, 26, -25, -30, 25, -36, -32, 34, -27, -53, -27, -28, -65, -43,
+    -30, 28, -31, 40, -25, 44, 28, -32, -35, 32, -26, -32, -32, 29, 27, 28,
+    -28, -34, -38, -30, 33, -29, 27, 28, 40, -51, -31, -66, -38, -29, -34, -55,
+    -25, -29, -26, -53, -49, -48, -81, -46, 40, 27, 40, -34, -56, -41, -40, -25,
+    29, -35, -56, 35, 31, -30, -44, -74, 34, -31, -44, -29, -26, -25, -39, -34,
+    -45, 30, -40, 31, -25, -27, -35, -26, -36, -25, -29, -37, -36, 42, -31, -38,
+    -44, -35, -55, -33, -27, -37, -37, -34, 70, -26, -34, -48, -26, -33, -28, 59,
+    -26, -36, 28, 40, 30, 49, -35, -27, 28, 27, 27, -34, -36, 27, 32, -65,
+    -66, -42, -75, -44, -31, -49, -46, -31, 28, 26, -27, -31, -34, -26, -46, -29,
+    -44, -37, -27, 35, 26, -78, -35, -71, -27, -30, 31, 32, 33, -37, -33, 26,
+    32, -49, -32, -43, -31, -30, -40, 48, 36, -26, -32, -44, -28, 26, -27, -34,
+    25, -44, -28, -33, 54, -25, 48, 26, -54, -43, -37, 37, -39, -52, 30, -28,
+    31, -40, 55, 31, -44, 26, 33, -61, -43, -33, -38, 40, 29, -31, 46, -25,
+    32, -29, 33, -37, 31, 32, -36, -34, -29, -25, -38, 55, -41, -25, 27, 25,
+    31, -26, 29, 32, 28, -50, 34, 29, -49, 45, -26, -46, 47, -31, -30, -45,
+    29, -46, -29, -46, 41, -44, 31, 31, 31, -35, -28, -44, 33, -28, -28, -45,
+    32, 25, 37, 26, -45, 38, 32, -40, -28, 29, 33, 41, -29, -31, -37, 27,
+    30, 25, -46, 29, 37, 33, 36, 42, 35, 27, 29, 31, 56, 36, 30, 27,
+    -37, 44, 34, -41, 33, -27, 47, 52, 26, -29, -35, 50, 38, 32, 31, 35,
+    37, 27, 65, 35, 37, 50, 26, 57, -40, 30, -47, -49, 28, -42, 37, 36,
+    -39, -41, 25, -36, 51, -37, -28, -33, -33, -27, 30, -44, -56, 32, -41, -26,
+    -48, -51, -25, -28, 33, -47, -46, -29, 42, -27, 28, 33, -32, -26, -42, -29,
+    25, -45, -25, -25, 29, -39, 32, 34, -30, 30, -33, 25, 57, -28, 29, 37,
+    -30, 31, 53, 31, -40, 25, -36, 25, 25, 31, -42, 25, 35, 31, 28, -29,
+    38, 32, -29, -31, 32, -30, -36, -31, -40, -28, 41, -28, 28, 27, 32, -49,
+    27, -42, 28, -54, 32, 38, -50, 32, -31, 28, -41, -52, -42, -26, -41, 34,
+    -26, 26, -41, -33, 27, 52, -27, 74, 32, 25, 37, -47, -56, -43, 47, 27,
+    -53, -46, -38, 33, 47, -40, 36, -35, 36, 28, -51, -25, 52, 32, 61, -61,
+    -28, 44, 25, -32, -28, 35, 33, 38, -27, 49, 49, 51, -27, 41, -26, 37,
+    31, 42, 26, 62, 39, 37, -58, -27, -31, -44, -33, 25, -26, -31, 36, 25,
+    -25, -35, 32, -40, -42, -26, 56, -29, -55, 55, 54, -25, -29, -35, 41, 37,
+    30, -33, -33, -40, 42, -35, 36, 48, 29, 28, 32, -36, -25, 25, 38, -85,
+    37, 30, 34, -45, -76, 50, 39, 33, -35, -33, 31, 36, 32, 26, 28, -31,
+    -27, -43, 39, 26, -53, 31, -30, 28, 43, 41, -30, 25, 42, 36, -30, 26,
+    -32, 31, 34, 25, 30, 51, 61, 60, 42, 27, 31, 42, 34, -25, -29, -25,
+    36, 54, -55, -36, -38, -35, -31, -55, 33, 31, 28, 36, -72, -42, 72, -64,
+    -31, -55, 38, -42, 40, -28, -56, 47, 27, -26, -35, -34, 30, -33, 27, 29,
+    -34, -28, -39, 26, -37, -32, -28, -28, -31, -38, -28, -50, -26, 29, -45, -25,
+    -26, -26, 26, -40, -30, -25, 27, -35, 36, -43, -50, 39, 25, 29, -28, 28,
+    37, 28, -29, -38, -51, -30, 36, -28, 35, -56, -32, -45, -33, -31, 48, -32,
+    30, 25, -31, -28, 29, -25, -58, 25, -34, 41, -29, -36, 27, -34, -28, 29,
+    -32, -35, -25, 46, -38, -36, -26, -25, -25, -30, -30, 26, -44, 38, 49, 29,
+    31, 28, -39, 31, 36, 46, 29, -71, 36, 29, 25, 34, -28, -25, -52, 39,
+    30, 26, 27, -25, 25, 25, -29, 35, 27, -27, -25, 37, 41, -25, 25, 31,
+    28, 40, 35, 34, 30, 33, 45, 27, 28, 40, 31, -27, -27, -28, -30, 50,
+    -44, 41, -26, -31, -29, -28, -27, 25, -28, -36, -35, -37, -26, -45, -34, -26,
+    -39, 38, -29, -62, -28, 32, 25, 27, -30, 29, -38, 29, -32, -30, 27, 30,
+    30, -47, 26, 25, 31, 50, -40, 30, -32, 51, -26, 25, -25, 32, 31, 28,
+    -25, 37, 26, 44, 62, -31, 31, 71, 33, -29, 44, -59, 45, -27, -41, 27,
+    -30, -31, -56, 28, -39, -41, 29, 33, -29, -29, -40, 29, -27, -31, -28, 33,
+    -29, -34, -34, 36, 28, -30, 36, -27, 25, -42, -36, -33, -44, -33, -41, 33,
+    -32, 28, 32, -31, -75, -53, -30, -50, -29, 30, 67, 42, -46, 30, -35, -31,
+    52, -35, -37, -30, -25, -55, -38, -50, -57, 53, -25, 29, 27, -45, -40, 28,
+    -64, -33, -31, 36, 25, -37, 29, -28, -47, 53, 60, -26, -27, 25, 62, -51,
+    -37, -27, -27, -34, -28, -30, -25, 26, 50, 39, -29, 28, 31, -31, -38, 29,
+    -35, 35, 25, 32, -29, -28, 26, 29, 33, 56, 39, 32, 42, 44, 46, 25,
+    -41, 54, 37, 33, 50, 52, -27, -46, 44, 85, 25, -26, 39, 40, -45, 36,
+    -34, 35, 63, 59, 29, 62, -49, 63, 39, 27, -28, -31, 30, 28, 26, 29,
+    32, -38, -67, 38, 25, 35, 37, 87, 28, 53, 34, 52, 39, 34, -34, -33,
+    -32, -74, 30, 38, -26, -31, -62, -44, -31, -42, -32, -34, -43, -58, 47, -33,
+    35, 68, 36, 28, 26, 34, 25, -31, -35, 25, -27, 25, 44, 29, 44, 49,
+    29, 28, 29, -26, 48, -28, 27, 26, 32, 38, 29, 30, 29, 40, 42, 37,
+    32, 32, 46, 28, 25, 27, 34, 35, 37, 37, 35, 30, 26, 28, 40, 28,
+    31, 26, -37, 38, 30, 35, 25, 35, 40, -35, -29, 29, 36, 45, 29, 33,
+    30, 35, -25, 37, 29, -29, 26, 46, -28, 25, -26, 35, -44, 31, 36, 41,
+    42, 35, 29, 45, 48, 32, 26, 51, 48, -28, 30, 35, 29, 35, 31, 28,
+    52, 44, 59, -31, 27, -27, 26, 25, -26, 28, -31, 34, -37, -32, 32, 25,
+    26, 35, 45, -33, -30, 47, 71, 34, -26, 27, 40, 28, -30, 43, -31, 25,
+    -40, 77, 27, -30, -27, 27, -33, 27, -27, 28, 29, 25, -29, -25, 33, 34,
+    27, -45, 25, -31, -59, 66, -25, 25, 46, -32, 31, -35, 26, 49, 38, -25,
+    35, -28, -46, 27, -31, 39, 26, 32, -52, -32, -27, 52, 28, -36, 49, 29,
+    -34, -25, -25, -31, -28, 30, -44, -27, -28, 34, -28, -29, -31, -31, -33, 30,
+    -31, -31, 54, -45, -43, -47, 30, 31, -32, -46, 37, 43, -44, 33, 34, -25,
+    -34, -32, -71, 48, 29, 32, -28, 51, 43, -36, 28, 51, 53, -28, -32, 62,
+    45, 25, -35, 52, 73, -40, -27, -28, -34, -30, -50, -47, -26, 30, -48, 31,
+    58, 37, 41, 45, 26, 25, -25, -25, -34, 52, -52, -34, -32, -38, -44, -35,
+    -30, 27, -37, -33, -31, -25, 26, 25, -35, -38, 27, -25, 30, 25, 45, -27,
+    -32, 26, -54, -42, 36, -26, 26, 26, -28, 32, 26, 30, -48, -31, -31, -45,
+    -41, -27, -33, -34, 29, -39, -34, -31, -39, -33, -41, 28, 55, -28, 30, 33,
+    -25, 28, -26, 31, -36, 26, 28, -30, -39, -26, 25, 48, -38, 30, -34, -29,
+    37, -32, 31, 38, -25, 37, -29, 44, 25, -25, -25, 31, 45, 26, 37, 49,
+    33, 32, -48, 25, -46, 34, -35, 46, 29, -25, 31, -46, 38, 26, 43, -30,
+    31, 26, 32, -26, 49, -31, -33, 28, 39, 44, 36, 27, 26, 43, 25, 25,
+    31, 26, 28, 40, -27, 36, 25, 30, 29, 27, 33, -41, -30, -42, 34, -32,
+    26, 31, -59, -45, 27, 33, 33, -34, 35, -29, 35, -37, -31, -28, 41, -30,
+    25, -31, -46, 45, -44, -33, -35, -25, -39, -30, 62, 26, -35, -42, -33, -26,
+    25, -31, -50, -36, -27, 38, 39, -41, -33, 27, -35, 31, -32, 40, 44, 26,
+    -27, -35, -57, -41, 28, -38, 25, 64, -55, 29, 31, 51, -30, -41, 39, 33,
+    48, -43, 25, 25, -30, -32, -34, 27, -51, -40, 28, 36, -32, 35, 35, -27,
+    32, -26, 25, 32, 27, 30, -26, -29, -29, 26, 25, 27, 44, 34, 28, 44,
+    28, -34, -38, -42, -31, -29, -49, -40, -28, -48, -29, -48, -34, -58, -31, -37,
+    25, -34, -26, -47, -38, -46, -28, -29, -32, -40, -45, -67, -27, -43, -55, -29,
+    -25, -50, -26, -52, 25, -44, -26, -29, -25, -35, -25, -33, -33, -54, -68, -34,
+    -34, -53, -34, 28, -41, 28, -31, -35, 33, -36, 25, -66, -40, -33, -30, -30,
+    -42, 38, -48, -28, 26, -54, -39, -30, -31, -37, -36, 29, -27, -48, -37, -36,
+    43, -27, -40, -40, -37, -37, -33, 30, -37, 29, 26, -29, -25, -28, -58, -34,
+    -30, -40, -33, 39, -34, -43, -45, -58, -32, -38, -31, -35, 27, -58, 27, -30,
+    -28, 27, 29, -27, -70, -34, -62, -25, -28, 50, 71, -39, -56, -43, -42, -33,
+    25, -25, 36, -27, -26, -28, -25, -29, -44, 40, -34, -26, -37, 26, -37, -25,
+    -46, -29, -30, -26, -35, 26, 42, 28, 51, -51, 28, 58, 26, 28, 29, -35,
+    -33, 28, -36, 35, -34, 27, -49, 40, -33, 30, -30, 41, 40, 37, 35, -31,
+    -25, -34, 35, 25, -37, -43, -48, 25, 33, -48, -36, 42, 48, 42, -62, 36,
+    47, -29, 29, -55, -31, -47, -40, 38, -45, -44, -26, -36, -33, 41, 27, 34,
+    43, 34, -43, -48, 31, -30, 68, 44, 29, 31, 25, 36, 53, -25, -33, -44,
+    -25, -26, 36, -34, -37, 49, 44, 49, -44, -31, 29, -58, -27, -42, -28, -31,
+    -30, -33, 59, 32, -33, -28, -26, -35, -26, -48, 40, 34, -31, 46, -31, -38,
+    25, 42, 26, -27, -32, 26, 40, 44, 45, -28, 44, 34, -42, -25, 25, -43,
+    -50, -44, -27, 26, -26, 26, -38, -26, -34, 36, 40, 41, -25, 40, 25, 42,
+    28, 36, 43, 39, 69, 28, 41, 47, 50, 46, 34, 58, 26, 36, 36, 61,
+    49, 29, 37, 34, 41, 27, 35, -27, -27, -47, 35, -26, -28, -29, -27, 25,
+    -25, -33, -28, -38, 40, 34, 31, 30, 27, 28, 32, 29, -52, -36, -46, -32,
+    -30, 43, 33, 35, -31, 42, 30, 44, 26, 29, 52, 33, 32, 25, 35, 38,
+    43, 28, -41, -46, 26, 83, 25, -28, -30, -32, -27, -25, -32, -28, 45, -41,
+    34, 25, 25, -36, -34, -51, -40, -37, -31, -33, -29, -34, -30, -32, 27, -25,
+    39, -41, -39, 40, -52, -42, -28, 28, 29, -40, 40, 25, 39, 34, 33, -29,
+    35, -25, 33, 37, -28, 25, 37, 28, -51, 36, 25, 36, -35, 34, 48, 29,
+    -31, 29, -72, 48, 30, 42, 35, 63, 31, -30, 31, -50, 41, 38, 25, 34,
+    -47, 57, -44, -26, -35, 29, -25, -47, -27, -30, -49, 31, -58, 45, -40, 45,
+    37, 25, -34, -29, -34, 34, -27, -28, -33, 36, -49, 40, -26, -52, -32, 35,
+    -35, -25, -53, -55, -38, -52, 30, -32, -33, -28, -35, -29, -38, -34, 30, 27,
+    -27, 33, -55, 29, 50, 53, -29, 41, 56, 36, 26, 27, 40, 25, -27, 35,
+    32, 29, -25, -38, 36, 26, 48, 27, -27, 25, -35, -33, -26, 27, -25, -27,
+    -25, 26, 28, 25, -42, -28, -45, -26, -27, -29, -27, 47, -39, 26, -39, 39,
+    -36, 36, -32, -31, -38, 30, 31, -50, 25, 26, 41, 25, -25, 50, -32, 26,
+    -30, 77, -41, 28, -28, -26, -27, -30, 32, -36, 50, -40, -42, -26, -36, -37,
+    28, -33, -52, -28, 41, -36, 25, -30, -61, 43, -27, -25, -27, -31, -42, -27,
+    -32, -80, -42, 42, 29, 35, 26, 36, 28, 39, -35, 34, -25, -48, -25, -30,
+    -30, 39, 35, 27, -26, 27, 27, 73, 41, 27, 30, 58, -27, 25, 33, 64,
+    -25, 36, 25, -26, -26, -30, 27, -34, -52, 28, -26, -27, -25, 29, 33, -42,
+    -26, 27, -37, -31, 30, -32, -36, 33, 42, -37, 32, 25, 25, 29, 33, -50,
+    48, 28, 48, 29, 43, -52, -34, 27, 41, 30, -32, 27, 25, -30, 29, 29,
+    27, 27, 28, -42, -25, -42, -33, -26, -32, -35, -26, -28, -25, -57, 27, 27,
+    82, -31, -25, 34, -34, 42, 33, 30, 30, 26, 31, -27, 36, 35, 43, -25,
+    39, 31, -29, 27, 27, -25, 62, 40, 26, 33, 29, 33, 38, 33, -26, 35,
+    -41, 29, -28, -53, 36, -31, -33, -42, 32, -27, 28, -45, -27, -28, 63, 37,
+    58, -45, -25, -25, -41, -25, -32, 67, 28, -27, -35, -34, -33, -47, -29, 33,
+    -37, 27, 25, -25, -39, -40, -38, -26, 30, -33, -36, -28, 44, 27, 25, 40,
+    -36, 34, -39, -47, -31, -32, 40, -36, -30, -34, 45, -29, 60, -25, 38, 34,
+    37, -40, 26, 49, -33, -27, -69, -25, -26, -35, -25, 28, 30, -41, 41, -35,
+    -30, -32, 26, -31, 30, 35, 34, 25, 30, -26, 34, -35, 47, -38, -28, -37,
+    -29, 25, -26, 42, -25, -35, 29, 25, -31, -31, -30, 26, 43, 38, 30, -30,
+    -25, 33, 26, 36, 28, 34, 32, 34, 44, 68, -35, 30, 32, 25, 29, 51,
+    30, 40, -37, 28, 26, 38, 26, 38, 34, 48, 28, 26, 27, 30, 40, 25,
+    25, 39, -55, 38, -49, 41, 52, 36, 47, 86, 29, 26, 32, 27, -29, 44,
+    32, -27, -25, -35, 26, 46, -56, -31, -37, -25, -34, 29, -56, -32, -41, 27,
+    34, 25, 26, 29, -30, 25, -25, 42, 34, 34, -35, 42, -29, 27, 27, -45,
+    -45, 75, 25, 32, 26, -36, -28, -42, -37, -28, -33, 30, -34, -35, -44, 32,
+    41, 27, -31, 26, -29, -33, -36, -33, -36, -28, -25, -25, -53, 29, -30, 25,
+    27, -27, -28, 41, 37, 26, 28, -36, 41, -31, 36, -30, -27, 34, 31, -31,
+    32, 44, -25, 25, 32, -26, 26, 31, -35, 40, 36, -41, -31, 25, -41, 29,
+    -28, -38, -28, -25, -29, 27, -42, 33, -43, -79, 26, 61, 40, 25, 87, -47,
+    28, 28, -30, 29, 34, 31, 27, -29, 33, -26, -41, -34, 27, -30, 37, -57,
+    -32, -33, -57, -39, 32, -27, -25, -39, -26, -34, 32, 28, 32, 30, -26, -30,
+    -41, -29, -45, -30, -27, -26, -29, -32, -36, -35, -26, -31, -25, -30, 25, 32,
+    -39, 39, -31, 41, 37, -25, 29, -54, -27, 38, 32, -26, 33, 36, 34, -30,
+    47, -77, -26, -38, 27, -33, -36, -25, -26, -41, -25, -42, -29, -37, 33, -44,
+    -42, -25, -27, -46, -69, -44, 39, -26, -41, -31, 32, 34, -63, -34, 33, 36,
+    -26, 38, 34, 27, 29, -32, 25, 40, 43, 26, 26, -25, 25, -28, 26, 57,
+    -29, 25, 43, 29, 37, -36, -32, 31, -38, -30, -26, 27, -26, -39, -25, 25,
+    30, 39, -32, 32, 27, 44, 49, 28, 26, -28, -29, 27, 26, 37, 54, -25,
+    -26, 48, -25, 29, 31, -25, 29, -28, 32, 44, 27, 28, 26, -30, 28, -37,
+    41, 33, -25, 31, 34, 25, 34, 52, -44, 30, -46, 31, 44, 28, 25, 41,
+    25, 25, 25, 36, 61, 37, 32, 59, -28, 56, -28, -25, 40, 40, -27, 44,
+    -27, 28, -32, 41, 29, 26, -33, 53, 36, -50, -38, -26, -32, -28, 30, -25,
+    41, 28, 25, 27, 26, 35, 29, 29, -28, -32, 32, -27, 31, 35, -30, -38,
+    -27, 27, 29, -26, 29, -41, -33, 41, 43, -47, 41, 28, -26, -38, 32, -33,
+    -35, -32, 45, 43, -25, -69, -27, 36, -32, -38, -28, -30, 25, -30, -37, -28,
+    -27, 29, 25, 27, 44, -37, 30, 27, 33, -29, 33, -26, 35, -25, 25, 28,
+    27, 45, 25, -26, -27, 26, 28, 26, -40, 50, -45, 32, 27, -32, 38, -27,
+    28, -34, 28, -33, -54, -34, 31, 70, -32, -31, 28, -29, -31, -27, -38, -46,
+    -37, -33, -30, -29, 26, -31, -38, 95, -37, -25, 33, -28, 75, -39, -46, 36,
+    -28, -25, -38, 30, -25, 45, 28, 25, 28, 34, -30, 32, 29, 81, 30, 29,
+    26, 59, 25, 26, -77, -28, 29, 31, 26, -32, 33, 29, 26, 49, 66, 27,
+    -39, -30, 26, 44, -32, 58, -46, 35, -37, 36, 52, 25, -39, -36, -63, -39,
+    -47, 32, -32, -35, 28, -28, -45, -27, -27, 27, 51, -27, -32, 41, 67, -29,
+    -33, -44, -29, 55, 35, -28, -38, -34, -56, -79, -28, 27, -26, 30, -32, -60,
+    36, 35, -35, 41, 65, -26, 27, -36, 28, -26, -33, -33, -32, -46, -35, 43,
+    -25, 39, -39, -39, -35, -77, -32, -31, 26, 28, 28, -33, 35, 81, 39, -34,
+    -28, 33, 28, 31, 51, -25, 37, -28, -38, -54, -28, -30, -48, -70, -32, -46,
+    -48, -32, -48, 25, -63, 31, -26, -58, 51, 44, 39, -45, -33, 28, -33, 26,
+    75, 34, 35, -28, -34, 26, 49, 40, -42, -31, -38, -29, -44, -31, -42, -39,
+    -35, 31, -41, 89, 56, 25, -30, -36, 34, 30, 43, 26, 25, -33, -33, 27,
+    30, 66, 54, 30, 42, 27, -52, -64, 27, -32, 29, 41, 26, -32, -38, -37,
+    -27, 29, -30, -42, -33, -39, 34, -46, -78, -40, 46, -26, 62, 38, 25, -42,
+    -43, -35, -48, -25, -25, 25, 25, -50, -42, 26, -28, 37, -28, -50, -36, -36,
+    44, -32, -40, -26, 31, 44, 42, -33, 33, 32, 56, 31, 42, 40, 57, 29,
+    -40, -25, 25, 35, 30, 30, -30, 28, 37, -28, 28, -31, -34, -37, 26, -25,
+    27, -32, 28, 27, -51, 31, -27, 41, -30, 37, 32, 27, -32, -31, 51, -27,
+    33, -31, -34, 32, 59, -33, 41, 62, 40, 35, 25, 25, 32, 29, 42, 37,
+    -40, 28, 44, 29, 31, 34, 33, -29, 41, 32, 28, 29, -29, 28, 28, -34,
+    -45, 28, 28, -25, 33, 32, 28, 36, 26, 26, 25, 38, 42, 29, -27, -28,
+    -27, -40, 50, 41, 26, 50, 42, 29, -29, 38, 34, 42, -25, 47, 52, 43,
+    29, 44, 37, 29, -33, 26, 38, 30, 40, 30, -40, 31, -25, 26, 31, -45,
+    30, 36, 44, 60, 57, 30, 41, 51, 34, 31, 29, 37, 38, 32, 75, 32,
+    30, 43, 41, 32, 59, -27, 52, 42, -28, 26, 35, 25, 48, -29, 25, 26,
+    33, -47, -25, 30, 27, -58, -36, 29, 54, 42, -27, -43, 27, -36, -28, -28,
+    -45, -27, 26, 28, 32, -42, -33, 39, 31, -43, 25, 25, 25, -46, -57, 33,
+    38, 48, 33, 30, -29, -28, 28, -28, 32, -38, 69, 35, 25, 26, 29, 32,
+    40, 52, -30, -27, 31, 54, -34, -31, -30, -25, -25, 27, 28, -30, -31, -31,
+    26, 30, 35, 25, 35, 27, 41, 25, 38, -66, 41, -47, -47, 38, 58, 35,
+    26, -25, -33, 35, 51, 58, 34, 36, -34, 45, -50, 42, -32, -27, 33, 29,
+    33, 30, 36, 119, 74, -35, 25, 49, 34, 95, 27, 30, 60, -46, -26, -29,
+    -25, -31, 25, -48, 35, -37, -28, 25, -36, -25, 38, -36, -35, 33, -37, -32,
+    -32, -28, 29, -32, -30, -26, -25, 29, 38, -41, -30, 30, -32, -26, -36, -29,
+    27, 33, -37, -41, -28, -28, -37, 34, -34, 59, 31, 28, 36, 52, -44, -30,
+    -45, 33, -26, -71, 28, 29, -30, -26, -50, 33, -45, 30, 32, -49, -50, 52,
+    -26, 66, -70, -62, 41, -35, 32, 40, -34, 26, -27, 32, -26, 47, 44, 37,
+    -55, 76, -43, -46, 37, 50, -41, -29, 32, -31, -33, -32, -28, -28, -26, 29,
+    -30, -33, -31, 38, -50, -44, -37, -39, 26, 34, 26, 28, 37, -46, -35, 40,
+    -35, -58, 47, -41, 29, -32, -37, 38, -55, -31, -31, -26, -29, -29, 25, -26,
+    31, 31, 35, 29, 34, 34, 46, -43, 30, 40, -32, -30, -30, -26, -37, 49,
+    -29, 29, -27, -26, 28, 25, -28, 30, 31, 29, -26, 26, 39, -27, -27, -26,
+    25, -75, -30, -25, -29, -47, -32, -26, -31, -42, -31, -43, -29, -28, 39, 40,
+    -25, -26, -30, 32, -32, 26, 31, -27, -29, 52, -26, 38, -38, -53, 29, -26,
+    44, -27, -25, 32, -56, -36, 42, 40, 28, -31, -38, -28, -31, -39, 25, 26,
+    -51, -28, -26, 26, -25, -45, 75, -35, -26, 45, -75, -26, -25, -30, -27, 25,
+    50, -32, -32, -33, -32, 81, -25, 25, 26, 37, 69, -28, 30, 29, 47, 37,
+    -40, 45, 25, -33, -68, 50, 33, -48, 47, -43, 30, -25, -32, -42, -39, -25,
+    32, -49, -28, -46, 27, 29, 31, -63, -26, -29, -33, 26, -30, 41, 26, -37,
+    -38, 25, 39, -29, 56, 38, 37, -31, -27, 39, 34, 32, -46, 43, 26, 27,
+    25, -35, -36, -33, -33, 50, -28, 26, -35, 28, 33, 27, 37, -33, 25, 38,
+    25, 45, 46, 29, 41, 27, -26, 35, 47, 31, 36, 36, 29, -55, 31, 68,
+    28, -39, 40, -26, -31, 36, -27, 49, -39, -48, -35, 51, 26, -29, -35, 52,
+    -34, -29, -27, 29, 29, -63, 40, 97, 28, 29, 26, -46, 29, -26, 27, 41,
+    -34, -42, -42, 31, 30, 56, -31, -27, 35, -47, 30, -61, 27, -34, 25, -30,
+    -32, 25, 38, -28, -32, -30, 29, -93, 34, 54, 40, 26, 26, -26, 39, -45,
+    37, 32, 27, 27, 26, -27, 34, 32, 28, 58, 63, -35, 30, 60, 38, 33,
+    39, 27, 40, 36, -38, -35, -27, -29, 25, -40, -67, -25, -32, -28, 38, 30,
+    -46, -50, -49, 35, -73, -30, 80, 59, 42, -51, 25, 32, -88, -42, 78, 28,
+    -26, -27, -38, 38, 85, -26, -29, 68, -44, -26, -30, 43, 48, -25, -26, -25,
+    -30, -32, -35, -25, -36, 33, -33, -34, 35, -25, 35, -31, -46, -27, 25, -41,
+    37, 34, 30, 32, -36, -36, -33, 25, 26, -34, -33, 25, 35, 30, -36, 25,
+    -28, 28, 29, 34, -36, 43, -26, 41, 65, 35, 46, -47, 46, 25, 72, 32,
+    43, 33, 40, 25, 34, 42, -26, 25, 26, 26, 27, 27, 39, 34, 26, 27,
+    26, 52, -29, 27, -29, 29, -46, 26, 34, -26, -28, 38, 46, -47, -31, 38,
+    27, -32, -30, 37, 37, -45, -28, -26, 42, 27, -36, 35, 37, 33, 25, 31,
+    -37, 27, -26, -52, 26, -40, 27, -26, -27, -27, 36, -34, 28, 30, 35, 31,
+    32, 38, -26, 48, 32, 27, -32, 35, 32, -33, 27, 33, 29, 43, -31, -27,
+    28, 30, 25, 38, -49, 37, 40, 42, -36, 27, 29, 25, 29, -30, -30, 26,
+    -34, 39, 30, -42, 29, 29, 78, 26, -25, -41, 37, -26, -26, -27, 28, -46,
+    -40, 36, -34, -33, -33, 34, -42, -35, -32, -26, 48, 47, -30, -58, -38, -43,
+    -31, 26, -28, -25, -27, 30, -41, -26, -38, -31, 42, 36, -53, 30, -26, -34,
+    -30, -41, -29, -31, -35, -37, 51, 28, 28, 42, 38, 25, -30, -38, -29, 36,
+    45, 27, 51, 35, -38, 28, -33, 27, -31, 32, 55, 52, 33, 41, 39, 28,
+    -58, -33, -30, 28, 37, -36, -38, 27, -31, -47, 34, -32, 43, -50, -32, -26,
+    29, 62, 52, -33, -30, -72, -26, -31, 27, -31, -27, 86, 41, -33, -28, -25,
+    -28, -27, -42, -41, 26, -25, -35, -34, -25, 34, -30, -26, -33, -25, -26, -35,
+    -42, -48, -31, 33, 29, -31, -29, -57, -30, 37, 25, 26, 50, -38, 33, -47,
+    28, 54, 26, -39, 25, 25, 40, 55, 26, 39, 51, 38, -57, -26, -36, 32,
+    26, -59, -32, 25, -32, -37, 27, 60, -60, -28, 36, 30, 25, 56, 30, -46,
+    -29, -33, -28, -31, -41, 33, -28, 31, -25, 52, 28, -31, 31, -26, -35, -35,
+    -40, -31, 33, 41, 37, 29, 30, -72, 36, -33, -25, 28, 43, 37, 25, -25,
+    32, -36, -50, -54, -36, 47, 28, 34, 32, 49, 31, -26, 25, 31, -68, -41,
+    27, 29, 26, -35, 43, -39, -29, -46, 57, -30, 25, 27, 26, 28, -32, 31,
+    33, -45, -27, 47, -63, -26, -25, -27, 25, -36, -49, -80, -92, -95, -49, 33,
+    -30, 29, -41, -49, -60, -92, -61, 40, 27, -40, 28, 41, -42, 29, -25, 26,
+    29, 27, 25, -59, -44, -26, 25, -28, -56, 41, 26, -32, 28, -50, -32, 30,
+    -42, -28, -31, 41, 36, 27, 42, -36, -34, 41, 26, 26, 42, -67, -27, -29,
+    -47, -32, -88, 32, -30, 27, -30, -26, -28, -30, -64, 27, -36, -31, 35, -51,
+    -32, -78, -73, -25, -29, -43, -34, -27, -27, -36, -67, -28, -83, 29, -30, 29,
+    30, 27, -25, -28, 38, 42, 32, 27, 26, 34, 49, 47, 46, 39, 26, -33,
+    45, 46, 37, 26, 30, 29, 34, 27, -28, 27, 32, 25, 71, 51, 34, 26,
+    31, 27, -26, -36, -36, 39, -29, 31, 34, -28, 57, 26, 36, 28, -26, -27,
+    -30, -35, 46, 30, 32, 45, 26, 26, 45, -26, -45, -37, -27, 28, -25, 26,
+    45, 65, -29, 59, 60, 69, -30, 29, 71, 61, 67, -34, -29, -40, 30, 30,
+    -25, 39, 58, 26, -48, 27, -30, -31, -45, -43, 31, 42, -37, -25, 25, 42,
+    25, 28, -35, 26, -25, 27, 26, -30, 26, -45, 54, 33, 30, 29, 26, 46,
+    -25, -50, -39, -37, 30, -28, -36, 39, -25, -26, -31, -36, -77, -27, 41, -27,
+    -32, -41, 29, 38, 56, -30, -40, -43, 30, -65, -25, -43, 27, -46, -29, -65,
+    120, 74, -26, 44, -49, -39, 31, 26, 29, 29, 40, 26, -32, -25, -26, -41,
+    -34, 34, 28, -30, -30, 37, 32, 40, 30, 28, 32, -37, -26, 31, 29, 25,
+    30, 31, 28, -27, -30, -37, 51, -25, 35, 38, -29, 32, -34, -37, -38, -66,
+    88, -36, -33, -36, 48, 31, 40, -40, -31, 34, 32, -28, -37, -26, -28, 72,
+    49, -42, -70, -47, -36, 31, -30, -29, -45, -42, -58, -26, -37, -35, 34, 31,
+    -39, -41, -42, 29, -49, -25, -34, -41, 33, 50, 25, -30, -32, -47, -44, 39,
+    33, -27, -53, 39, -37, 37, 26, 39, -40, -39, 31, -47, 38, -29, -35, 34,
+    32, -26, -32, -31, 25, -27, -26, -36, 52, -34, 44, -26, 47, -33, 39, 25,
+    52, 34, 36, -34, -36, -32, 25, 59, -33, 64, 25, -33, -27, -28, 49, 35,
+    32, 27, -25, -28, 44, 35, -28, -32, 25, 33, -28, 35, 25, 47, 37, 27,
+    25, 27, -27, 27, 26, -39, 33, -28, -27, 33, -33, -38, 25, 26, -42, 25,
+    25, 29, -25, -28, 28, 40, 34, 29, 37, 36, 35, 41, 26, 32, 25, 35,
+    -28, -51, -53, -48, -28, -53, 28, 26, -32, -25, -42, -54, -37, -28, -25, -53,
+    -43, -35, 29, -40, -39, 32, 33, -47, -45, -56, 29, -41, -28, -34, -29, -40,
+    -30, -26, 37, 35, 25, 32, 40, -41, 37, 25, 28, 34, 52, 33, -29, 41,
+    -60, 26, 27, 30, 32, 40, 26, 32, 25, 75, -30, 30, 45, -32, -27, 32,
+    -35, 35, -34, -25, 26, 28, -40, 34, -31, -31, -41, 50, 43, -27, -28, 27,
+    -27, 33, 32, -27, -44, -37, -28, -26, 41, 35, -31, -29, -26, -36, 41, 27,
+    -33, -26, 26, -31, -35, -36, 28, 28, -36, 29, 42, 53, -32, 26, 56, 25,
+    34, 50, -25, -38, -33, -35, 26, -46, 32, -27, -41, -27, -30, -41, -40, -73,
+    -49, -26, 29, -33, -41, -31, -42, -43, 29, -92, -36, 28, -35, -34, -50, -46,
+    29, 26, -86, -53, 30, 26, -42, 38, 30, -35, 29, 25, 30, 28, -25, 42,
+    39, 32, -30, -31, -27, -27, -47, 34, 41, 29, 26, -29, 29, 27, -44, -25,
+    35, -26, 33, 26, 40, -28, 32, 33, -45, -40, -27, -68, -52, 71, -29, 30,
+    -26, -57, -35, 27, -28, -34, -40, -33, -26, 35, -39, -85, -29, -42, 43, 32,
+    29, -46, -53, -37, -32, -28, -44, 31, 27, -42, -40, -35, -26, -38, -35, -40,
+    -39, -57, 31, 28, -29, 30, -63, 32, -26, -33, 29, -26, 26, 35, 27, 44,
+    -27, -46, -25, -27, -31, 35, 29, -32, 33, 30, -30, 30, 25, -25, -31, 27,
+    -34, -31, 28, 44, -39, 32, 45, 28, 32, 27, 38, 35, 61, 27, -37, -28,
+    -29, 26, 40, 55, -32, 27, 27, 27, 34, 32, -25, -37, 31, 38, 25, -28,
+    27, 29, 29, 26, -47, 30, -27, -27, -25, -26, 31, 26, 26, 28, 46, 37,
+    27, 34, 47, 35, 29, 46, 30, 32, -27, 32, 34, 26, 27, 25, 45, 36,
+    30, 27, -28, -28, -25, -26, -28, -27, -25, -32, -25, -35, -30, -33, -25, -30,
+    -27, -28, -28, -26, -27, 0, -28, -27, -31, -25, -29, 63, -27, -26, -37, -28,
+    33, -27, -25, 28, -26, -31, 25, 25, 29, -28, -54, 25, -27, -39, -46, 25,
+    33, 37, -57, -38, -26, -42, -48, 35, 33, 25, 41, -25, 37, 43, 85, -33,
+    -32, -28, -37, 25, 30, 32, 27, 25, 56, -32, -45, -31, -41, 43, 30, 30,
+    25, 37, 26, 41, 29, 35, 27, 37, -30, -26, -62, -29, -25, 27, -28, 26,
+    -26, -37, -39, -27, -34, 34, 61, 37, 37, -25, -37, -33, 47, -49, 27, 47,
+    -32, 50, 45, 33, -28, 71, 51, -33, -26, 26, -33, -36, 64, 32, -31, -28,
+    -33, -25, -25, -26, 35, -54, -28, 49, -25, -33, -49, -26, -33, -32, -38, 39,
+    -41, 30, -28, -35, -40, -47, -26, 31, 33, -38, -31, -48, -27, 41, -29, -41,
+    -40, -31, -29, -35, -25, 66, 28, 27, 30, 39, 32, -36, 30, 28, 26, 28,
+    31, 35, -79, 41, 30, -47, 26, -48, 37, 75, 34, 40, 35, 47, 26, 28,
+    27, 34, 30, -40, 27, 52, 54, -36, 25, -48, -72, -29, -31, -54, -35, -25,
+    33, 39, -44, 37, 27, 37, 27, -71, -53, -37, -30, -49, -34, 34, 45, 29,
+    27, 48, -57, -42, -32, 32, -57, -25, 30, 28, -40, -27, -25, 40, 35, 29,
+    35, -31, 37, -38, 32, 55, -34, 27, 37, 26, 44, 36, 33, -27, 49, 44,
+    53, 79, 32, 44, 33, 48, 44, -34, 31, -41, 27, 34, 40, -28, 55, -27,
+    -28, -29, -25, 42, 30, 32, 26, -31, -28, 26, -30, 30, -54, -31, 29, 57,
+    27, -30, -48, -59, -26, -35, 29, -30, -29, 34, -40, 25, -59, 55, 32, 41,
+    33, -29, 32, -36, 42, -26, 38, -37, -25, -43, 27, -38, 36, -36, 32, -40,
+    25, -32, -27, -28, -28, -33, 27, -33, 32, 43, -29, 30, -32, 29, -33, 39,
+    39, -35, -26, 29, 26, 54, -29, -44, -39, -28, -26, 27, 36, 27, 39, -30,
+    -43, 46, 33, 34, 29, -31, -34, 30, 48, -34, 33, -46, 27, -35, -26, 30,
+    39, -54, 29, -69, -31, 48, 30, 52, -38, 29, 37, -32, -36, 26, 35, 26,
+    41, -33, 29, 31, 47, 42, 31, 56, 27, 40, 33, 52, 29, -41, 45, 35,
+    -28, -28, 60, 40, 31, 47, -27, -26, 35, -54, -32, -44, -56, -34, -43, -42,
+    -31, -32, -43, 31, -65, 30, -34, -25, -46, -34, -68, -31, -44, -48, -29, -27,
+    -37, -46, -52, -25, -29, -46, -37, -55, -26, -44, -26, -56, -78, -29, 38, -88,
+    -40, 37, -39, -28, -38, -36, 38, 26, -55, -26, -28, -27, 25, 44, -45, 57,
+    -29, 28, 25, 47, -40, 44, 52, 44, -38, 41, 52, 43, 25, 35, 28, 36,
+    25, 45, 35, 25, 37, -32, -28, -26, 37, -25, -37, -27, -26, -26, -59, -26,
+    -36, -47, -41, 37, -37, -34, -46, -27, -47, -27, -27, 37, -45, -27, -83, -29,
+    30, -29, -35, 29, 30, -33, -41, -31, -40, -26, -25, -32, 27, -41, -44, 28,
+    -57, -50, 27, 65, 73, -31, -33, 36, -28, -35, 33, 48, -26, 56, -35, -36,
+    -30, 37, -59, -50, 33, 32, -56, 40, 32, 28, 29, 28, -26, 36, 32, -25,
+    -38, 60, -52, -40, 33, 59, 57, 28, 33, 37, -45, -27, -38, 39, -43, 25,
+    -26, -73, 30, -30, -33, -37, -42, 34, -42, -28, 39, -28, -38, -29, 28, -29,
+    -44, -25, -26, -43, 29, -37, 33, 29, -38, 33, 33, 27, -32, 30, 36, -31,
+    26, 33, -39, 45, 26, 27, -43, -31, -27, 51, 35, 43, -25, -51, 34, -29,
+    -26, -26, 26, -28, 36, 36, 44, -43, -40, 47, -33, 33, 40, 33, -34, -31,
+    -33, -34, 25, -32, 25, 32, 30, 36, -30, 36, 32, -50, 30, 34, 37, 26,
+    41, -35, 27, 27, 36, 29, 28, -28, -29, -35, 25, -27, -36, -45, 27, -45,
+    25, 33, -40, -58, -30, 39, 35, -25, 50, -40, -64, -28, 47, -64, 25, 27,
+    25, 30, -59, 32, 56, 36, 41, -27, -26, 50, -36, 31, 27, 25, -34, 30,
+    -40, 27, 25, -27, 32, -28, 29, 27, 31, 58, -42, -39, -25, 25, -25, -28,
+    -33, 25, 31, -26, 49, -38, 36, 40, 37, -25, 39, -44, -29, -35, -35, -75,
+    -40, -51, -35, -33, -56, 27, -49, 37, 29, -33, -43, -37, 69, 28, -53, 37,
+    -35, 26, -26, -50, 31, 25, 25, 27, -48, -30, -44, 30, -29, 30, 26, -26,
+    -29, 40, -33, -29, -30, 36, 26, 56, -26, -29, -26, -29, -39, -26, -30, 32,
+    -33, 35, -26, 25, -58, -42, 36, -31, -29, 37, 32, -37, -26, -27, 35, -42,
+    36, 26, -59, -25, 34, 31, 25, 33, 50, 33, -33, -34, 29, -53, 25, -39,
+    37, 36, -37, 44, 42, 42, -28, 47, -34, -48, -32, 27, 50, 46, -31, -27,
+    46, -26, 46, -33, 34, 38, -34, -64, 39, -34, 27, 27, 28, 25, -89, -45,
+    -40, 51, 32, -63, -53, -44, 38, -36, -31, 41, -29, 27, 53, -34, -39, -48,
+    -31, 91, 33, 40, -42, 44, 42, -69, -33, -32, -55, 35, 33, -32, 28, 65,
+    79, 36, 27, -27, -45, -41, 72, -39, -38, -34, 49, 63, -38, 36, -36, 62,
+    28, -54, 67, -47, 70, -76, -33, -43, 34, -34, 27, 47, 43, -62, -37, -53,
+    -52, 49, 93, -26, 25, 35, -26, -25, -42, -99, -35, -26, -52, -49, 38, -41,
+    35, -62, -41, 44, -28, 40, -55, 40, -37, -38, 41, -29, -30, 28, -51, -46,
+    -36, 44, -70, 54, 26, -32, -28, -26, 32, 29, 35, -26, 40, 35, 34, 30,
+    44, -39, 27, -38, -35, -43, -27, -54, -30, -38, -51, -31, -25, -30, -27, -70,
+    -27, -46, 57, 26, -58, -25, -42, -32, -33, 57, -28, 48, -39, -66, -26, 59,
+    -32, 27, -50, -34, 38, 32, -39, -47, -43, 48, 50, 66, 29, 51, 33, -36,
+    -48, 80, 39, 50, 33, 38, 29, -36, 31, 39, -36, -40, 45, -60, 29, -45,
+    -25, -30, -50, -61, -42, -62, -30, 28, 50, -42, -58, -42, -39, -30, -56, 61,
+    34, -25, 43, -40, -42, 40, -25, 31, -39, -56, -63, -37, 31, -37, -31, -28,
+    41, -58, -28, -34, -41, 27, -45, -32, 65, -40, -54, -72, 63, 40, -35, 58,
+    -71, 49, 29, 33, 29, 31, 59, -33, -28, 50, -78, 36, 76, 78, 52, 28,
+    31, 61, 55, -29, 26, 40, 31, 26, 38, -25, -73, 52, -27, -27, -77, 37,
+    -47, -69, -44, -50, -37, -62, 42, -47, -51, 25, -32, 56, 42, -27, 27, -65,
+    43, -39, 30, -105, 51, 69, 25, 45, 36, 31, -32, 26, 32, 37, -32, -29,
+    -81, 27, -37, 31, -50, 27, 46, 57, 55, 47, 31, 39, 37, -47, 59, 36,
+    40, 52, 31, 27, -38, -66, 38, 51, -25, 26, 27, 29, 29, -51, 39, 66,
+    76, 41, -46, 26, 38, 47, 49, 39, -27, 47, 55, -27, 51, 34, -49, 59,
+    31, -44, -54, 41, 78, 54, 77, 29, 61, 31, -27, 63, -26, 30, 66, 62,
+    28, 50, 72, 36, 48, 25, 48, 38, 25, 26, -38, 42, 46, -72, 46, 32,
+    30, 31, 34, 56, 41, 37, 63, 53, 36, 79, 59, 50, 28, 49, 26, 34,
+    32, -35, -50, 49, 30, -36, -46, 41, -38, 43, -54, -32, -31, 39, -50, -30,
+    -35, -29, 80, -25, -64, 48, 30, -29, -83, 41, -32, 35, -44, 39, 72, 38,
+    34, 47, 33, 29, 35, 53, 33, 38, 50, 28, -66, 29, -36, 39, 26, -32,
+    -25, 28, 27, 30, 25, -29, 26, 27, 56, 43, 28, 39, -35, 28, -28, -29,
+    -40, 32, 31, 30, 74, 33, -32, 57, 26, -28, 49, 28, 58, 54, 66, 30,
+    33, 37, 32, -39, 58, 37, 107, 25, 26, 39, 48, 39, 26, 26, 26, 28,
+    29, 48, 45, 39, 26, 65, -25, 30, -37, 57, 79, 33, 53, 86, 78, -37,
+    36, 71, 41, 52, -25, -45, 35, -48, 30, 31, 32, 61, 39, -32, -26, 31,
+    -52, 49, 35, -30, -35, -32, 40, 41, 26, 38, -34, 38, -33, -67, 38, 30,
+    -38, -38, 29, -102, -41, -47, -32, -32, 46, 26, -37, 25, -28, -27, -33, -28,
+    -41, 26, 28, 45, -30, -80, 30, 35, 36, -30, -54, 31, 34, 55, 38, -50,
+    25, 39, -76, 42, -65, 44, -80, 46, -61, -29, -68, -89, -47, -30, -41, -54,
+    -73, -29, -50, 32, 31, -43, -37, -48, -65, 32, 36, -26, -44, 37, -34, -30,
+    34, -30, 36, 30, 29, 26, -38, -27, 48, 35, 51, 57, 26, 35, 29, -37,
+    44, 33, 40, 30, 66, 68, 29, 82, 51, 35, 66, 37, 84, 52, 37, 32,
+    60, -25, 34, -33, 40, 38, 32, -26, 36, 35, 25, -26, 33, 37, 45, -32,
+    53, -31, 28, 28, 33, 39, -32, -27, 28, 66, -25, -39, 45, 29, 47, 31,
+    29, 33, 49, 37, 36, 31, 39, 48, 29, 57, 49, 37, 28, 47, 37, 27,
+    -31, 29, 25, 42, -29, 43, 51, -30, -27, 25, 41, 35, 41, 25, -42, 25,
+    -50, -64, -37, 28, -52, -68, -35, -25, 36, -33, -32, -43, -26, -29, -33, -41,
+    -30, -51, -44, 32, 27, -25, 25, -44, -27, -26, 31, 28, 41, 31, 41, 28,
+    -25, -36, 30, -26, -26, 26, -32, -33, 25, -31, 26, 27, 30, 27, 26, 33,
+    39, 29, -29, -31, 28, 32, -28, -47, -35, -68, 45, 25, 50, -75, -48, 30,
+    -36, 53, 32, 25, -47, -35, 34, -54, 49, -36, -43, -29, -32, 32, -34, 47,
+    38, 31, 26, 44, -62, 27, -37, 47, 37, -33, 27, 30, -41, -27, 72, 35,
+    34, 51, 31, -25, 39, -26, 25, 35, 57, -28, 25, -29, 34, 39, 29, 37,
+    41, 35, 39, -27, -34, 27, -31, 36, -38, -39, -61, -25, -52, 36, -38, 51,
+    -30, -40, -42, -54, -44, 59, -34, 62, 33, -33, -25, 29, -32, 63, 39, -43,
+    -29, 55, -28, -72, -39, -55, 38, 36, -28, -31, -61, 40, -25, 25, 43, 25,
+    -43, 27, -71, 53, -28, -34, 27, -83, 36, -42, -50, 31, -26, 28, -41, -30,
+    -30, -27, 65, -29, 35, -28, -90, 26, -80, -39, 51, 36, 49, 38, 25, -42,
+    -35, 51, -32, 25, -34, 69, 34, -60, 49, -50, -53, -109, 39, 66, 32, 36,
+    29, 54, 28, -47, 28, 31, 30, -29, 26, 27, 48, 28, 25, -35, 31, 33,
+    33, 49, 35, 35, 26, -31, 47, -28, 31, -26, 37, 36, -45, -27, 41, -40,
+    -42, -33, 26, -53, 35, -27, 42, 36, -25, -30, -35, -46, 46, -37, -36, 45,
+    -42, 33, 57, -38, 40, 41, -41, 33, -37, 32, 28, -47, 29, 58, 44, -40,
+    -30, 29, 33, 29, 25, 43, 25, -28, -27, 42, 27, -26, 43, 28, 27, 25,
+    -36, 32, -31, 27, 27, 25, 33, 37, 55, 34, 27, 33, 31, 31, 27, 33,
+    -28, 26, 34, 26, 37, 34, 30, 39, 27, -25, 38, 31, 38, 35, 28, 28,
+    31, 32, 33, 47, 45, 30, 33, 26, -44, 35, 28, -37, -47, -51, -90, -38,
+    -47, -35, -38, -31, -26, -29, -37, -28, -41, -51, -29, -48, -39, -32, -44, -30,
+    -49, -26, -25, -26, -41, -26, -27, 26, -37, -31, -32, 25, -30, 29, -25, -49,
+    -45, -25, -28, 31, -30, -41, 29, 31, 50, 55, 29, 35, 47, 32, -55, 43,
+    41, -25, -43, 25, 27, 47, -25, 34, 40, 56, 25, 31, 56, 38, 37, 33,
+    79, -39, 27, -37, -61, -45, -32, -57, -63, -40, -56, -41, -34, -33, -62, 34,
+    -63, 27, 28, -50, -32, -29, -48, -34, -34, -43, -43, -26, -25, -33, -42, -32,
+    -31, -35, -27, -36, -38, -27, -25, -28, -40, -46, -39, 25, -33, -25, -32, -48,
+    -36, -36, -25, 47, -28, 35, 27, -32, 30, 31, -25, -25, -31, -31, -37, 25,
+    29, -36, 37, -33, -33, 31, 42, 32, 44, -26, -40, 52, -28, 59, 34, -45,
+    49, 30, 34, -35, -34, -36, 70, 34, -30, 30, 27, 46, -28, -50, -31, -45,
+    -44, -67, -34, -38, 40, -30, -37, -29, 41, 36, -26, -27, 45, -53, 27, -30,
+    -47, -35, -26, -34, 73, -44, 31, 33, 39, -49, 39, 53, -65, 51, -31, -32,
+    52, -29, 26, 28, -26, 27, 28, 34, 52, 32, -31, 27, 30, -28, 41, 41,
+    -45, 31, 25, -37, 36, 50, 41, 28, 26, -27, 27, 38, -25, -30, -34, 25,
+    -36, -34, -32, -30, 25, -26, -34, -25, -38, 34, -25, -25, -32, 56, -39, -34,
+    -44, -33, -27, -32, -31, -42, -29, 33, 33, 32, 30, 44, 39, -26, -28, -34,
+    -26, -60, -28, -27, -28, -55, 25, 25, -33, 31, 35, 35, -33, -34, -46, -37,
+    35, -26, 27, 26, 42, 45, -41, -30, -26, -46, 32, 39, -25, -25, -30, 32,
+    26, 27, 28, 42, -29, -35, -25, -25, -35, 32, 34, -28, -29, -44, -39, 29,
+    50, -26, 34, -26, 28, 27, 36, -43, -45, -28, -25, 41, 38, 52, 27, -58,
+    -50, -27, 29, -42, 39, -27, 36, 50, 25, 62, 25, 31, -41, 48, -33, -39,
+    50, -36, -31, -29, 47, -27, 31, 40, -31, 47, 46, -32, -39, 29, -28, -31,
+    -43, -34, 29, 45, 32, 25, 31, 26, 50, 31, 35, 32, 32, 29, 35, 32,
+    29, 33, 33, 47, 42, 34, 28, 40, 35, 26, 25, 61, 25, -26, -34, 42,
+    33, 38, 34, 42, 71, 77, 43, 36, 26, 28, 36, 45, 53, 30, 25, 26,
+    36, 28, -28, 86, -27, 26, -27, -26, -26, 26, 28, -27, 50, 31, -41, 37,
+    30, -26, 28, -37, -34, -26, -27, -31, -39, -29, -33, -40, -28, -28, 53, -35,
+    32, 27, -47, -27, 37, -34, 25, 26, 29, 32, 30, 25, 29, 42, 32, -25,
+    69, 30, 27, 26, -27, 47, -27, 32, 42, 26, 40, 28, 47, 27, 40, 26,
+    -39, 37, 45, 25, 48, -29, 53, 41, 26, 35, 58, 36, 33, 25, 28, 36,
+    48, -30, -34, 32, 43, -40, 26, 45, 27, 64, -30, -43, 30, -34, 57, 33,
+    27, 35, 52, 26, -28, 35, 30, 27, -32, 55, 34, -28, 30, 64, 40, 26,
+    -28, 30, 29, 30, 26, 26, 44, 25, 47, -30, 36, 39, 32, -38, -25, 28,
+    -25, 36, -25, -48, 25, -25, 31, -34, -26, -53, -41, 42, -26, -33, -49, 27,
+    -29, 39, 76, -33, -51, 25, -25, -38, -31, -29, 40, 59, 43, 55, -29, 33,
+    -47, -65, -25, 26, 41, 33, -28, 31, -26, 39, 28, 42, 29, 33, 40, 34,
+    -26, 31, 51, 29, -54, -36, -25, 51, 73, 26, 44, 28, 30, -31, 38, 34,
+    25, -34, -29, -26, -29, 25, 35, -58, -27, -79, 30, -32, 33, -38, -55, -26,
+    34, 32, -89, 32, -63, -79, -50, 41, -56, 28, 32, -70, 33, -49, 29, -62,
+    -61, -35, 27, -35, 45, 64, -26, 54, 52, 25, 51, 32, -38, -26, -49, -68,
+    58, -28, -41, -26, -27, -28, 26, 34, -36, -25, 39, 39, -33, -27, -29, 40,
+    34, 27, 30, 37, 27, 27, 26, -34, -38, 39, 27, 36, -42, -31, -29, -54,
+    -35, -45, -47, -51, -28, 32, 29, -39, -45, -33, -42, -45, -32, 32, 29, -26,
+    31, -26, 39, 41, 27, -40, -66, 26, 29, -45, -42, -46, 37, 44, -25, -32,
+    41, -34, -28, -32, -26, 29, -25, -37, 26, 25, -33, -25, 46, -32, 25, 48,
+    -37, -26, 44, 39, 36, 40, -47, 32, 27, 27, 36, 69, 33, 42, 31, 29,
+    35, 52, 39, 29, 35, 43, 47, 36, 62, 38, 51, 26, -61, 29, -64, 38,
+    -34, -27, -29, -31, -37, -31, -26, 28, 27, -25, 26, -34, -26, 39, -25, -30,
+    27, 28, 35, 64, -30, 33, 28, 46, 26, 45, -38, 28, 27, 28, 26, 59,
+    39, 25, 26, 30, 41, 39, 49, 34, 27, 41, 42, 28, 25, 33, 27, 27,
+    29, 28, 40, 44, 41, 30, 32, -28, 31, 38, 29, 44, 59, 33, 45, -55,
+    46, 54, 35, 35, 43, 43, 45, 25, -25, 38, 31, 28, 26, -37, 29, 27,
+    34, 29, 26, 40, 28, -27, -27, -38, 36, 26, -41, 30, 51, 29, 47, 35,
+    25, 32, 32, 33, 37, 37, 27, 29, 33, 35, 27, 34, -36, -38, 38, 45,
+    -27, 38, -27, 28, 26, 29, 29, -35, -39, 29, -57, 28, -30, -32, -31, 28,
+    61, -38, 27, 25, 35, 32, 34, -68, 25, -26, -38, -47, -34, 27, -46, -44,
+    -52, -33, 26, 29, 58, -56, -50, -45, -39, 36, -39, -50, -27, -49, -42, -29,
+    -26, -32, -41, 28, 30, 27, -26, 26, -39, -28, 26, 31, -46, -29, -52, 33,
+    -36, 28, 27, 26, -33, -68, 40, -28, 46, 27, 57, -27, -46, -66, 28, -32,
+    27, 36, -40, 29, 30, 61, 33, 27, 34, -35, -29, -29, 37, 37, 28, -31,
+    -40, -38, 33, -28, -36, 42, 32, -30, 31, 30, 55, 26, 27, -32, 37, 30,
+    -29, -32, -29, 26, -41, 33, 28, 43, -26, 33, -31, 32, 32, -34, 28, 28,
+    -48, -41, -52, -28, -27, 27, 25, 41, -41, 51, 28, -42, -45, -41, 41, -33,
+    42, -38, 38, -27, -50, -26, 45, 31, 34, -32, 32, 28, 26, 29, -38, 31,
+    36, 35, 26, 31, -29, -27, 30, 26, 26, 32, 26, 39, 26, 44, 41, 34,
+    68, -25, 29, 26, 25, -45, -30, -27, -34, -29, 35, -44, -38, -28, -30, 44,
+    -34, -38, -29, -31, -26, -36, 26, 27, 39, -27, 27, -36, -37, -33, -34, -34,
+    -40, 32, 35, 29, 38, -38, 39, 40, 31, 25, 29, 39, 58, 27, 47, -44,
+    -47, 35, 29, -29, 29, -39, 34, 29, 25, 25, 27, 39, 56, -31, -28, 33,
+    54, 41, 29, 31, 65, 28, -25, 32, 26, 29, -25, 30, 29, 36, 40, 48,
+    28, 29, -27, 50, -30, 35, -27, 53, 44, -32, 26, 29, -35, 29, 40, 27,
+    32, 34, 39, -63, -49, 32, 39, -60, 26, 32, 26, -31, -25, -42, 34, -26,
+    -39, 35, 32, -37, 31, -30, 30, -31, 43, -44, 27, 31, -54, 27, 31, -42,
+    31, 37, -27, -33, -34, -56, -31, -27, -44, 46, 26, 31, 33, 25, -30, 28,
+    28, 48, 26, 30, -28, -28, -25, 44, -28, -37, -30, 59, -51, -29, -34, 30,
+    29, 30, 39, -36, 27, -28, 41, -40, 30, -51, 29, 25, -48, -25, 35, 25,
+    52, 79, 38, -29, 29, 42, 34, -33, -43, 26, -44, -27, -25, 39, 52, -45,
+    -25, 34, 32, 26, 36, -29, 34, -35, 34, 25, 46, 36, -31, 32, 47, -37,
+    43, 44, -25, 45, -26, -37, 25, 29, -32, -33, 33, 51, -46, 32, -40, 32,
+    28, -89, -44, 32, 26, 37, -35, -59, 33, -28, 43, 26, -72, -33, -26, -29,
+    46, -52, 29, -34, -31, 25, -26, -28, 40, 56, 75, 30, 39, -33, 33, -29,
+    -29, -47, -25, 82, 60, 104, -29, 35, 27, 59, -37, -25, 55, 70, -33, 64,
+    46, -42, 27, -100, 36, 35, 34, -41, -35, 59, 85, -45, -31, -27, 31, -48,
+    39, 29, 32, -25, -41, -29, -32, -33, 35, 51, -29, 25, -34, -37, -31, 34,
+    27, 25, 27, -35, 25, 28, 31, -27, 25, -27, -26, 25, -52, -30, -25, -36,
+    35, -72, 32, 26, 34, 32, 49, 42, 35, -44, -26, 43, 28, 36, -42, -44,
+    42, 45, 30, 51, 45, 33, 25, 33, 36, 27, 28, 32, 37, 32, 40, 60,
+    34, 38, 28, -29, 33, 31, 31, 33, 32, 47, 28, -33, -44, 33, -28, -27,
+    27, 32, -47, 36, 33, 25, -35, 29, -32, 29, -26, -29, 26, -66, -27, 47,
+    -58, -37, -40, 26, -27, -46, -40, -28, -28, -26, -44, -42, -47, -25, -30, 48,
+    -57, -37, 28, -40, -27, 33, -36, -52, -28, -26, -37, -39, 31, -37, 25, -44,
+    -38, -61, 33, 30, -72, -25, -28, -25, -25, -25, -25, -26, 0, -26, -26, 0,
+    -25, -26, -30, 27, 31, -29, 25, 49, 38, 33, 37, 27, 25, -28, -25, -70,
+    33, -26, -27, -28, 27, -53, 48, 51, -35, -71, -31, 51, 31, 34, 26, -47,
+    -59, -48, 31, -33, 42, 31, 29, -38, 44, 26, -38, 37, 53, -28, -28, -33,
+    45, 79, -28, 55, 42, -34, 67, 26, 87, 38, 35, 53, -35, 40, 87, 32,
+    -46, -39, 80, 70, 79, -47, -42, 33, -64, 30, -46, -29, -25, 25, -25, 31,
+    46, -26, -35, -33, -29, -29, -32, -83, -32, -30, -36, -64, -45, -39, 26, -28,
+    -34, -67, -72, -45, -35, -37, -26, -57, -35, 65, -37, -52, -39, -40, -32, 32,
+    49, -30, 39, -43, 34, -29, 29, 60, -30, -71, -38, 30, -44, 37, -28, -42,
+    -36, -31, -45, -26, 29, -33, 56, -43, 29, 44, 33, 34, -38, -28, 25, 36,
+    -44, -31, 31, 29, -27, -25, 32, 45, 25, 50, -38, 32, -62, -33, 46, 36,
+    -45, 27, 31, -30, 42, -39, -43, -54, 34, 26, 26, 50, 26, 35, 31, 37,
+    29, 33, 25, 82, -41, 29, -47, 37, 30, -30, -26, -30, -55, -49, -29, -27,
+    -29, -57, -29, -58, 27, -50, 30, 38, -26, -29, -55, -29, 39, -34, 32, -28,
+    37, -28, -32, 33, -27, 25, 25, 26, -32, -53, 26, 34, -70, 36, 26, -33,
+    -51, -30, 30, 30, 31, 28, -29, 39, -31, -34, -45, -33, -39, -32, -29, -26,
+    53, 30, 35, -30, 25, 32, 52, 57, 26, 30, 35, 34, -27, 55, 56, 36,
+    36, 55, 46, 32, 88, 55, 30, 29, 40, 55, 30, 51, 27, 66, 39, 31,
+    76, 62, -32, 76, -47, -26, 47, 29, 29, 40, -35, -25, 29, 28, 35, -47,
+    33, 33, -38, 26, -45, 36, 33, -30, -50, 27, -41, 32, 57, 39, 53, 43,
+    44, 49, 51, 29, -60, -33, -29, -80, 39, 51, 42, 28, 28, 40, 53, 50,
+    25, -35, 26, 28, 27, 34, -44, 29, 35, -28, 34, -108, 26, 34, 25, 49,
+    -25, 25, -51, 43, -54, 27, -74, 37, 29, 44, 26, 38, 30, 32, 28, 29,
+    26, 31, -33, 49, -40, 46, -45, -39, -50, -30, 52, -41, 43, 51, -34, -66,
+    -39, -30, 44, -42, 53, 39, 29, -33, 40, 80, 42, -62, -33, -36, -44, -52,
+    -41, -57, 40, -47, -54, 44, -30, 28, 27, 31, -59, -70, -39, -35, -38, -43,
+    -32, -26, -42, -54, 25, 34, -50, -89, 26, -74, -45, -29, -47, -34, -29, -37,
+    -30, -66, -49, -46, -48, 33, -46, 27, 25, -26, 35, 32, 30, -45, -51, -32,
+    -43, 32, 25, -43, -34, -47, -58, -37, 33, -33, 57, 25, 27, 28, 38, 29,
+    -28, 36, 58, 30, 59, 31, 48, 31, 44, 37, -25, -28, -32, -32, -32, -28,
+    -31, -29, -26, -27, -25, -29, -29, -27, -27, -27, -30, -25, -27, -25, -30, -28,
+    -27, -28, -30, -27, -30, -30, -32, -28, -26, -25, -26, -27, -26, -27, -25, -31,
+    -33, -30, -25, -28, -25, -32, -26, -26, -31, -31, -25, -29, -26, -27, -31, -30,
+    -32, -25, -32, -30, -28, -28, -28, -25, -26, -31, -28, -32, -27, -30, -25, -31,
+    -27, -30, -28, -25, -26, -25, -26, -26, -25, -25, -30, -26, -27, -26, 31, -25,
+    -26, -26, -27, -25, -27, -26, -25, -26, -26, -30, -25, -29, -25, -28, -26, -27,
+    -26, 29, 25, -26, -25, -25, 26, -25, -25, -37, 53, 56, 40, -47, -26, 30,
+    46, -55, -33, -25, -31, -26, -38, -30, -38, 28, -40, -33, 62, -31, -33, 39,
+    40, -30, 28, -33, 25, 76, -32, -26, 30, -31, -47, 42, 33, 26, 32, 41,
+    -42, 42, 27, 27, 50, 26, 39, 62, -28, 33, 34, -34, -30, 31, -41, -26,
+    -51, -37, 53, -28, 47, -39, -42, -32, -26, -55, -43, -31, 41, -27, -45, -30,
+    -31, -27, -29, -35, -53, 31, -30, -28, 27, -25, -30, -35, -65, -42, -41, -36,
+    69, -47, 31, 52, -27, 25, -30, 29, 27, 45, -36, -31, 31, -43, 29, -38,
+    30, 29, 38, -33, 28, -27, 32, -29, -26, 29, -26, -37, 53, 35, -25, 67,
+    45, -27, 27, -28, 28, 26, 40, 34, 30, -54, 30, -28, -27, -37, 46, -53,
+    -54, -36, -39, -27, -27, -41, 26, -49, -36, -34, 26, -44, -52, 25, 28, -32,
+    40, -42, -55, 40, -35, -29, -34, 28, -26, 53, 51, -28, 30, -42, 27, 57,
+    -39, -26, 27, 41, 31, 32, 29, -33, 43, -28, -29, 55, -35, 29, -28, 46,
+    42, 41, -27, -49, -29, 49, -26, -31, -37, 28, 36, -41, -26, 26, 40, 28,
+    28, -31, -30, 28, 36, 32, -31, 26, -26, 28, 25, 25, 35, -33, -26, 25,
+    27, 28, 25, -28, -30, -42, 66, 34, 26, 44, 33, 66, 30, 35, -28, 27,
+    -34, -27, 69, -25, 49, -25, 42, -28, 29, 26, 28, 31, 32, 26, 25, 46,
+    29, 30, 30, -47, 28, -28, 49, 26, 26, 36, -34, 26, 39, 33, 27, 36,
+    32, -25, 28, 33, 60, 41, 32, -35, 31, 28, 28, 25, 29, 34, 29, 44,
+    29, 30, -32, 34, -30, 28, -25, 36, 36, -33, -26, -30, 44, -31, -33, -34,
+    53, -26, -50, 31, -25, -27, 25, 35, 37, 27, 30, -28, -30, 27, 31, 28,
+    30, -26, -28, -30, 26, 30, -37, 41, 29, -38, -37, 33, 29, 27, -28, -26,
+    25, 47, -29, 33, -46, 31, 48, -30, 28, 37, 33, 29, 27, 26, 33, 32,
+    -36, 30, -30, 25, -29, 27, 26, -26, -34, -41, -35, 32, -33, -28, 28, -41,
+    -25, -25, -36, -25, -52, 31, -25, 29, -31, 26, -29, -42, -33, -30, 32, 28,
+    32, 29, 36, -31, -42, -68, 25, 30, -36, 30, 35, -59, -38, 41, 28, 26,
+    -48, 37, 36, 30, -36, 33, -30, -35, -38, 33, 25, 34, -25, -36, 29, -34,
+    39, -29, 26, 31, -37, 38, -33, 26, -39, -37, 41, 42, 30, -35, -27, 33,
+    -31, -33, -37, 30, 39, 28, 39, 28, -25, -28, 32, 26, 44, 28, 29, 35,
+    42, -46, -49, -27, 27, 26, 27, -26, 40, 26, 26, -42, 37, 28, 33, 25,
+    -47, -49, 46, -37, -37, -33, -37, -34, -43, 58, -30, -30, 25, -25, -25, -25,
+    -31, -44, 53, -41, -58, -30, -32, -43, -25, 44, -34, -50, -31, 26, -30, 43,
+    -78, -31, 34, -38, -48, 28, -26, -29, 28, -43, 28, 31, -38, 56, 33, 31,
+    -38, 52, 39, 41, 47, -26, 26, -37, 28, -30, 38, 38, 29, 30, 27, 35,
+    27, 49, 25, 27, 51, 25, 30, 33, 25, -29, -55, -32, 26, -33, -39, 25,
+    28, -33, -25, -27, 31, 33, 27, -36, -43, 53, -27, 48, -31, 50, 31, -46,
+    26, 26, -35, -25, 27, 40, 31, -26, -30, 31, -32, -37, -26, 30, -26, 68,
+    38, 36, 40, 41, 46, 27, 32, 31, 39, 27, 28, 44, 62, 51, 53, 41,
+    47, 37, 27, -32, 31, 30, 25, 46, 34, 34, 31, 27, 41, 25, 26, 27,
+    44, 27, 47, -30, 25, 36, 29, 31, 32, 27, 32, 71, -34, 25, -28, 26,
+    -48, -31, -46, -35, 35, 26, -26, 49, 27, -30, 29, 26, 29, 37, -29, 47,
+    25, 74, -26, -28, -26, -27, 42, 28, 25, -27, 27, -28, 26, 54, 48, 105,
+    42, 36, -27, 32, 27, 34, 39, 99, 27, 37, 28, 31, 44, 57, 31, 34,
+    25, 68, 58, 29, -70, -35, 47, 33, 25, -42, 25, 51, 38, -33, 34, 42,
+    38, 26, 41, 26, -25, 26, 33, 34, 48, -42, -33, 27, -30, -37, 36, 25,
+    -25, 36, 25, -28, -39, -35, 37, 27, 31, 37, -30, -40, 29, 46, -39, 45,
+    39, -34, 25, -37, -26, -25, 34, 70, 36, 37, 34, 29, -28, -25, 33, 29,
+    29, 41, -33, 54, 60, 41, -28, 35, 34, 30, 29, 39, 55, 60, 64, 36,
+    -31, 51, -30, 31, 49, 39, 29, 37, 30, 25, 30, 47, 56, 28, 43, 62,
+    32, 40, -30, -61, -36, 28, -50, -32, -39, -29, -28, -36, -46, 37, -45, -27,
+    -28, -25, -50, -32, -72, 32, -27, -88, 26, 35, 27, -58, 56, -81, -34, 42,
+    26, 32, 25, 28, 30, 27, 32, -28, 40, -36, 32, -36, 37, 41, -27, 26,
+    -26, 48, 42, 37, -25, 30, 25, -38, -35, 31, 41, -33, 27, 40, -33, 39,
+    31, 28, 25, 37, 50, -30, -26, 25, 39, 40, -29, 55, -29, -34, -85, 25,
+    26, -30, -33, -27, 29, 31, -60, -25, 60, -44, -59, -99, 49, 33, -72, 36,
+    -110, 34, 31, -77, -79, -32, 28, -28, -52, -53, 30, 33, -54, 35, -75, -47,
+    -30, 45, -43, -29, -28, -29, 45, 30, -75, -37, -75, 31, 33, 35, -59, 61,
+    57, -61, 28, -31, 27, 48, 65, 26, 27, 29, -57, 26, 48, 28, 32, -25,
+    33, -44, -38, 84, 53, -34, 42, 25, 46, -32, -46, 49, 34, 42, 29, 40,
+    32, 46, -33, -34, -61, 55, 28, 43, -37, -32, -28, -31, -45, 40, 33, 48,
+    -35, -32, -27, -65, 34, 30, 25, 27, 37, -36, 64, -27, 59, 52, 25, 37,
+    31, -39, -38, -25, -28, 51, 28, -36, -28, -25, -39, -27, -74, 35, 25, -31,
+    29, -92, 27, 28, 29, 35, 28, 29, 28, 40, -25, 26, -32, -43, 30, 40,
+    38, -35, 40, -35, 26, 37, 33, -28, 28, 26, 30, -34, 31, 52, 27, 52,
+    50, 34, 35, 39, 29, 32, 31, 31, 26, 25, 30, 38, -31, 33, 51, 27,
+    28, 55, 29, 32, 30, 37, 29, -35, 25, 34, 28, 38, 32, 25, 40, 41,
+    39, 45, 41, -30, 36, 26, -51, 46, 31, 41, 58, 34, 49, -35, -25, 40,
+    -40, 32, -26, 48, -29, 66, 40, 52, -32, 27, 27, 27, 47, -37, 27, 48,
+    -43, -34, 31, -37, 28, 34, -47, 36, -35, 39, 34, -58, 30, 26, 33, -42,
+    34, 26, -46, -25, -36, -26, 35, 26, -39, 46, 31, 32, -28, 26, 25, 28,
+    35, 31, 26, 37, 43, 47, -38, 35, 40, -27, -27, -28, 27, -30, -30, 41,
+    33, 36, -29, -44, 27, -40, -36, -28, -41, -26, -32, -30, -33, -30, 33, -32,
+    -42, 49, -27, -31, -29, -27, -32, 25, 33, 26, 44, -26, -33, -30, -42, -47,
+    28, -29, -33, 29, 29, 61, 41, -25, -26, 55, -34, -29, 56, 30, 27, -33,
+    27, 49, 34, 52, -26, 33, 28, 32, -37, 34, -25, -33, -26, -25, -36, -32,
+    27, -32, 32, 33, -28, 65, -27, -39, -52, -46, -27, -32, 39, -37, -40, -28,
+    -66, -40, -26, -38, -29, -40, -38, 29, 28, 36, 79, 44, 36, 25, 57, 35,
+    31, 67, 33, 31, 36, 35, -27, 29, 34, -32, -30, 27, -32, 31, 45, 35,
+    28, 30, 31, -30, 41, 44, 36, -26, -45, 29, -27, -34, 26, -36, -37, -35,
+    -36, -29, -57, 39, -26, 38, -34, -31, -29, 39, -30, -42, -30, -28, -31, 46,
+    -37, -29, 65, -30, -56, -28, -29, 52, -38, 31, -40, -67, -35, -32, -32, 36,
+    -43, -33, -42, 40, -28, -51, -31, -31, -37, -50, -33, -44, -39, -56, -32, -25,
+    28, 31, -28, -42, 25, 31, 45, 32, 29, -47, 42, -56, 37, -40, -59, 39,
+    -27, 42, 29, -39, 30, -31, 40, -25, -32, -41, -28, -33, -25, 30, 37, -28,
+    30, -25, -28, -69, -31, 28, -29, -29, -25, 33, -35, 36, 30, -42, -44, -48,
+    -40, -29, -48, -42, -35, 25, -33, -37, -36, -34, -35, -34, -32, -36, -25, -33,
+    -27, -46, -32, -27, -30, -25, -44, -25, 39, -48, -49, -36, -34, -32, -32, -31,
+    -35, -34, -41, -29, -31, 39, 27, -29, -26, -27, -38, -27, -33, -37, -37, -25,
+    51, 42, 25, -26, -68, 36, -25, -27, -40, 30, -26, 31, 49, 39, 29, -56,
+    -27, -41, -43, -55, -33, 30, -46, 31, -25, -29, 44, 31, -27, 44, 31, -30,
+    -29, 50, 50, -46, 34, -28, -31, -34, -55, 60, -29, 29, 35, -42, -51, -27,
+    -25, 26, -27, -34, -48, -33, -35, -27, -32, 41, -27, -29, -36, -44, 32, -26,
+    -57, -44, -27, -27, -77, 39, -35, 30, -64, -50, -36, -42, 37, -31, -41, -27,
+    27, -27, -26, -37, 25, -43, -31, -40, 31, -29, 27, -45, 34, -36, -50, -39,
+    -31, 38, 52, -36, 51, 37, -29, 27, -26, 69, -40, -30, 60, 35, -58, -48,
+    -26, -26, 79, 35, 41, 26, -45, 37, -31, -34, -31, -26, -25, -39, -27, -45,
+    28, -33, 26, -31, 55, -26, 31, -28, 42, -74, 26, -67, 27, -37, -43, -42,
+    -30, -48, 61, -56, 32, 36, 48, -47, -37, -25, -42, 40, -26, 32, -41, 26,
+    -76, -28, -50, -25, -40, 51, -44, 71, -30, 28, -29, 40, 29, 26, 35, 38,
+    -56, 33, -34, -26, 47, -36, 26, 30, 34, 31, -60, -38, 28, -48, -42, 27,
+    -34, -43, 32, 31, 25, 27, -87, -25, -32, -66, 29, 44, 26, -77, -41, 32,
+    -35, 55, 38, 27, -28, 29, 39, 32, 28, 28, -25, 36, 39, 25, 55, 29,
+    32, 31, 30, 37, 44, 32, 27, -36, 32, -27, -39, -33, 29, 29, -33, 33,
+    -29, -44, -51, 41, 30, -27, 25, 34, 55, 36, 45, 30, -31, -26, 36, -29,
+    55, 25, -25, 45, 34, 28, 41, -30, 46, 42, 32, 28, 43, -34, 32, -43,
+    32, 27, 33, 55, -32, -45, 28, 29, 38, 27, 26, 25, 48, 35, 30, 25,
+    25, 33, 25, 27, 27, -56, -27, -33, 48, 32, -33, -30, 30, 37, -28, 27,
+    -28, -34, -41, -36, -41, -40, -25, -25, -27, -40, -44, -26, 31, -37, -31, -27,
+    38, 32, -32, 26, 32, 37, -27, 42, 80, -27, -27, 39, 48, -29, 34, -31,
+    26, 30, 32, 25, 32, 58, -31, -42, 68, -29, 28, 44, 39, 29, 41, 30,
+    26, -27, -31, 63, 38, 25, 36, -37, -35, 76, -38, -26, -28, 48, -26, 74,
+    -29, -46, -32, -39, -50, -34, -38, -55, -38, -35, -28, -29, -60, -29, -53, -29,
+    -39, -26, -62, -26, -41, -43, -40, -58, -47, -28, -35, -30, -33, -36, -29, -49,
+    50, -26, 65, -28, -63, -32, -33, -47, -35, 29, 35, -25, -44, 36, -63, 25,
+    -48, -35, -26, 32, -41, -38, -38, -40, 27, -25, -35, -44, 28, 31, -28, 33,
+    25, 59, -42, -40, 29, -32, -25, -43, -37, 40, -32, -34, -32, -26, -53, 32,
+    -28, 30, -43, -27, -37, -47, -44, 48, -26, -36, 30, -25, -50, -33, -66, -42,
+    90, -55, 30, -45, -27, -58, -40, -31, -70, -38, 57, -32, 43, -64, 35, 36,
+    -25, -54, -47, -30, 29, 44, 75, -52, -28, 61, 51, -25, 32, 25, -36, 61,
+    40, 39, -58, -33, -50, -30, -71, -55, -39, -44, 49, 46, -28, -29, 42, 46,
+    32, 43, 35, 54, -30, -46, 35, -55, 31, -25, -27, -27, -26, 48, 36, -28,
+    64, -35, 25, 40, 32, 25, -29, 31, -31, 39, 36, 40, -45, -37, -44, 47,
+    -31, -25, -40, -30, -30, -47, -27, -35, -35, -60, -39, -41, -41, -40, -37, 34,
+    -32, 30, -49, 38, -26, -29, 59, 36, -41, -36, 31, -38, 44, 35, -49, -43,
+    44, 70, -36, -45, 60, 38, -49, 98, 35, -45, -31, 36, -29, -34, 35, -62,
+    -31, -39, -27, -29, 77, -73, 59, -58, 43, 39, 27, 45, 25, 53, 34, 83,
+    26, 38, 29, 38, 32, -55, 30, 25, 62, 26, -26, 38, -35, 37, 46, -32,
+    44, 37, 30, 43, 38, -44, 33, 27, 25, 50, -30, -27, -27, 39, 49, 28,
+    33, -47, 38, 36, 38, 32, 37, 35, 48, -51, 30, -46, -44, -27, 35, -31,
+    -42, -36, -57, -54, -35, -73, 28, -39, 32, -26, 42, -54, -46, 29, -55, -33,
+    -43, -27, -81, -47, -56, -76, -71, 34, 48, 35, -31, 49, -34, 39, -43, -35,
+    41, 58, 30, 50, 49, 34, 60, 50, 31, 51, -32, -33, -26, 33, -31, -42,
+    37, -29, 33, -39, -35, -31, -40, 33, -25, 30, -29, 34, 33, 32, -25, 42,
+    29, 31, 29, 43, 48, -41, 32, -64, -75, 44, -52, 70, -31, -55, -33, -61,
+    -27, -33, 55, -27, -45, -34, -26, 25, 38, -70, 35, 42, -39, -30, 47, -43,
+    -65, -72, -38, -39, -43, 48, -34, -32, -33, -62, -90, -118, -29, -25, -51, -45,
+    -45, -33, -62, -38, -73, -50, 25, -28, -39, -27, -36, -92, -55, -29, -26, 31,
+    -32, 32, 39, -25, -31, -28, -25, -25, 39, -29, -26, -35, -25, -26, -31, -36,
+    -25, -30, -28, -30, -25, 35, -32, -33, -28, -27, -28, -34, -30, -25, -26, 28,
+    -27, -27, -27, -27, -35, 33, -26, -27, -32, -26, -27, -31, -26, -26, -27, -25,
+    -29, -29, -26, -26, -28, -30, -27, -34, -25, -31, -25, -29, -30, -25, -25, -35,
+    -27, -26, -25, -27, -29, -26, 25, -28, -25, -27, -28, -26, -29, -31, -28, -26,
+    -26, -33, -28, -37, -27, -31, -26, -26, -28, -29, -25, -32, -33, -32, -33, -32,
+    -25, -26, -27, -27, -35, -28, -26, -28, -25, -26, -26, 31, 25, 26, -36, 35,
+    -28, -26, -29, -30, -26, -26, -26, 38, -29, -29, 43, 27, 32, 25, -26, -25,
+    -27, -25, -27, -26, -25, -26, -31, 47, 80, 59, -26, 57, -29, -30, -25, 46,
+    -29, -30, -35, 36, -45, -30, -36, -45, -38, 52, -47, 91, -25, 25, 31, 25,
+    70, -26, 79, 26, 70, -27, -27, -34, 30, 45, -44, -25, 40, 35, -35, -34,
+    29, 38, 60, 27, 34, 26, 37, 26, 25, 46, 28, -28, 64, -32, 25, 35,
+    -37, 29, 27, -34, -40, 44, -26, -30, 32, 72, 46, 26, 29, -33, 89, 29,
+    40, -56, 36, 35, 52, -31, -33, -31, -41, -26, 35, 76, -27, -26, 25, -34,
+    38, 34, -50, -27, 33, -31, 42, 35, 65, -43, 58, 100, 34, 94, -34, -52,
+    67, -33, -28, 30, -25, -32, -37, -28, 30, -29, 85, -29, -40, -39, 25, -28,
+    59, -28, 36, 35, 33, 37, 29, 37, -31, 37, -26, -55, -44, -33, -25, -41,
+    52, 26, -30, 27, 36, 66, -25, 43, -34, 40, 28, -29, 40, -40, 31, -27,
+    35, 47, -36, 28, 36, 30, 43, -35, 39, 28, 60, 31, 33, -44, -28, -75,
+    -32, -29, -61, -46, -43, 27, -28, 27, 47, -36, -29, 32, 36, 63, -46, -28,
+    -37, -32, 26, 37, -30, -34, -25, 67, 25, 33, 41, -31, 28, -27, -37, -44,
+    -33, -31, -28, 25, 43, 34, 32, -33, -39, -30, -25, -28, 32, -34, 28, 41,
+    28, 36, -38, 29, 56, 26, 28, -26, 37, -31, -26, 48, -38, -32, -27, 29,
+    -27, -33, 33, 25, 40, -25, -34, -59, -53, 29, -40, -38, -33, -34, -31, 27,
+    -41, -36, -32, 28, -29, -40, -32, 27, -36, 37, 43, 29, 33, 29, 40, -26,
+    27, -32, 46, -35, -35, 33, -28, -33, 34, -41, -28, -34, 35, -47, -27, -45,
+    -28, -35, -26, 38, -33, -61, 44, 25, -28, 28, -25, -38, -35, 43, -32, -27,
+    -25, -35, -36, 30, 35, 53, 28, -29, 29, 28, 26, 25, 31, -26, 34, 37,
+    25, 33, -42, -36, -32, -27, 26, 28, 29, -37, -37, 31, -29, -45, 31, -51,
+    -26, -40, -36, -38, -28, -53, -31, 28, -32, -29, -28, 25, 32, -29, -41, -27,
+    -26, -25, -25, 34, 25, -27, -27, -29, -25, -31, 25, -27, -26, -30, -27, -25,
+    -25, -25, -25, -25, -25, -28, -28, -25, -25, -32, -30, -26, -30, -25, 26, 30,
+    -27, 26, -29, 26, -27, -31, -27, 25, -30, -28, 27, -28, -25, -27, -27, -29,
+    28, -35, -29, -28, -30, -27, -28, -25, 31, -25, 32, 25, 27, 28, 26, 35,
+    32, 40, 59, 50, 42, 31, 28, 35, 39, -44, 35, 33, 34, 35, -26, -29,
+    32, 25, -31, -32, 32, 37, 30, 28, 27, -50, 40, 42, 26, 41, 27, 25,
+    34, 32, 66, 36, 27, 28, 29, 43, 31, 33, 27, 62, 35, 56, 37, 29,
+    42, 62, 31, 36, 47, 79, 37, 27, -34, 48, 27, 66, 30, -35, 25, -60,
+    27, -38, 28, 27, 27, 25, 62, -28, 39, -32, -48, 31, 27, -46, 31, 34,
+    -25, -29, -25, 36, 33, 35, -40, 40, -39, -61, 52, -36, -43, -31, -35, 30,
+    -53, -32, -40, -38, 38, -35, 39, 53, 38, 25, -39, -35, 26, -42, -35, 32,
+    -25, 27, -33, 25, 29, 27, 34, 27, -29, -25, 31, 36, 29, -28, 39, -27,
+    -25, -37, -43, -25, -28, -52, 33, 26, -26, 29, -53, 29, -60, 40, -26, -34,
+    -45, -34, -46, -46, -34, 27, 26, -27, -47, 27, -31, -25, -29, 25, -30, 33,
+    31, -31, -34, -46, -34, 28, 27, 30, 37, -62, -51, -33, -30, -44, 27, -27,
+    -35, 29, 42, -34, 29, 25, -25, 25, -29, 34, 25, -45, -48, -45, 43, -25,
+    26, -30, -37, 33, 54, 54, 29, -26, 33, 40, 37, 28, 26, 42, 38, 72,
+    54, 35, 41, 63, 40, -81, -26, 63, -32, 31, 25, 27, -55, -33, 25, 46,
+    -42, 38, -53, 33, -44, -25, 26, -35, -53, 28, -66, 25, -53, 66, -76, -65,
+    -64, -50, -38, 32, -25, 30, -33, -40, 40, 33, 40, -40, 48, 58, 36, 48,
+    44, 35, 47, 51, -38, -29, 31, 56, 64, 61, -35, 31, 30, 39, 57, -28,
+    41, -38, 38, 46, -30, 25, 48, 50, 37, 28, 37, -28, -25, -28, 25, 26,
+    -52, 47, -50, 64, 34, 36, 47, 33, 30, 26, 25, 46, 43, 30, 54, 28,
+    -25, 29, 32, 26, 52, 38, -30, 31, 28, 26, -36, 35, 39, 44, -37, -31,
+    -27, -31, -31, -28, -46, -32, -28, -26, 51, 35, -33, 34, 53, -48, 29, 29,
+    -25, 27, 26, -31, -50, -25, 59, 34, 39, 26, 28, 32, -25, -40, 55, 38,
+    51, 49, 27, 25, 52, -79, 32, 38, 25, 28, 42, 26, 26, -27, 31, 27,
+    29, 30, 26, 44, -36, 25, 27, 25, 30, -44, 27, 38, -31, 32, -35, 39,
+    -25, -37, 44, -31, 38, -36, -31, 31, -31, -41, 52, -37, 46, 29, 43, 26,
+    25, 34, -38, 32, -33, 28, 36, 42, -37, 37, 39, -36, 26, 35, 36, 29,
+    45, 32, 27, -59, 46, -25, 25, 27, -39, 27, -69, -65, 27, 50, -26, -25,
+    -29, -32, 26, 48, -53, -51, -65, -60, -33, -28, 38, -38, -31, 50, 37, 28,
+    33, 28, -44, -38, 31, -31, 42, 33, 25, 54, -25, 26, -30, 27, 36, -29,
+    30, 37, -28, 27, 27, 31, -40, -45, 36, 51, 43, 54, 41, 43, 57, 48,
+    29, 50, 26, 28, 30, -26, 35, 33, 28, 30, 42, -33, -29, 26, 43, 33,
+    34, -27, 26, 35, -31, -44, -40, -26, 36, 30, -27, -27, 28, 33, -39, 30,
+    26, 34, -62, -60, 34, 27, -39, -85, 30, -72, -38, -30, -34, -54, 29, 25,
+    -70, -40, -28, -35, 27, 32, -34, 25, -27, 49, 47, -30, 31, -27, -26, -32,
+    -27, -31, 30, -26, -26, -43, 55, 32, -38, 27, 62, 30, -39, -26, -37, -36,
+    33, -33, -26, 28, -49, -25, -55, 54, -26, -66, -52, 37, 44, 29, 30, 51,
+    30, 35, 25, 45, 26, 47, -70, -57, -29, -43, -42, -43, -39, -52, -30, -36,
+    39, 33, 27, 58, 46, 32, -69, -30, -43, -45, 26, -42, -41, -45, -25, -35,
+    -31, -51, 29, -51, -34, -25, -63, -38, -53, -31, -31, 32, 26, 25, 27, -33,
+    29, 36, 25, 51, 30, -38, 35, -25, 34, -46, 37, -38, 28, 58, 35, 33,
+    26, 38, -30, 30, 25, -32, 48, -26, 72, 35, 44, 62, -28, 48, -31, 40,
+    -39, -37, 56, -40, 29, 51, -30, 53, 33, -41, -32, 29, 26, -35, -33, 31,
+    -27, -26, -26, 37, -30, 41, 31, 47, 44, -29, 28, 31, 70, 28, -33, -53,
+    29, 26, 50, 38, -26, -39, -61, -38, -35, -28, -29, -43, 39, 92, -35, 37,
+    -28, 29, -26, -26, -67, 35, 26, -50, 28, 29, 33, -33, 39, 38, -27, 30,
+    41, 32, -31, -37, 27, -33, 45, 46, 26, 27, 39, 30, 27, -38, -27, 27,
+    53, 31, 35, 45, 26, 42, 27, 26, 45, 40, 31, 28, -34, -28, 30, 32,
+    -28, -26, 29, -53, -32, -27, -28, -48, -27, -46, 28, 25, -32, -41, -29, -54,
+    -35, -31, -26, -32, -30, 26, -63, -58, -40, 28, -41, 27, -31, -34, 34, -26,
+    25, 36, 29, -34, -33, -50, -40, -26, 36, 38, -34, -39, 27, 28, -26, -33,
+    26, -57, -50, 42, 25, -59, 30, 30, 57, 33, 31, 43, 33, 41, 29, 55,
+    37, 39, -26, 29, 43, -38, 34, 35, 25, -32, -35, 37, -30, 33, -44, -45,
+    -54, -42, -26, -26, -35, -39, -49, -50, -44, -26, -28, -26, -26, 27, -30, 37,
+    -28, -31, 96, -39, -42, 32, -26, -28, 28, -34, 66, 55, 34, 25, 52, 77,
+    27, 41, 31, 66, 30, -27, -25, 57, 35, 58, 80, 39, 85, 38, 43, 36,
+    27, 49, 31, 60, 25, 51, 65, 31, 25, 71, 31, -61, 40, 27, 33, -26,
+    31, -69, -31, 25, -26, 39, 69, -37, -28, 27, 26, -39, -30, 40, -27, -25,
+    25, -30, -29, -35, -31, -40, -43, -41, -48, -32, -40, -26, -25, -30, -38, 51,
+    -33, -37, -47, -43, 25, -27, 54, -37, -32, 28, 27, -26, 38, 25, -31, -58,
+    25, 37, 29, 28, -35, -27, -46, 42, 28, 40, 32, -41, -28, -29, 28, 28,
+    45, -26, -36, 32, -31, -25, -37, 28, 34, 36, -41, 33, -34, 37, -29, -49,
+    31, 32, -39, 31, -35, -25, 36, -32, -31, -27, -31, 28, -36, -40, 25, 36,
+    -39, 25, -32, 29, -36, 42, -70, -35, -47, -29, -50, -45, -35, -38, 34, 35,
+    29, -38, -31, -42, -31, 33, 43, -33, -40, 50, -30, 38, -30, -28, 26, -36,
+    26, 29, 37, 38, -27, -38, 34, 30, 43, 27, -26, 32, -40, 48, 26, 30,
+    33, 41, -33, -34, 26, 28, 28, 35, 25, -54, -29, -37, 29, -39, -31, 32,
+    -82, 33, -36, -58, -37, 25, -37, -43, -37, -29, -53, -37, -27, -64, -77, -27,
+    -30, 48, 30, -28, -38, 35, 31, -26, 25, 28, 26, -28, 28, 30, 26, 26,
+    -28, 31, 31, -35, 41, 37, 26, -37, 49, 30, -49, 34, -34, 29, -25, -25,
+    40, 26, -25, 26, 44, -29, 25, 27, -28, 26, -45, -28, -26, 43, 25, -25,
+    -37, -37, -25, 39, 26, -28, -25, -37, -34, -25, 25, 31, 36, 32, 27, -27,
+    34, -33, -38, -32, 25, 37, 31, 25, -25, 27, 27, -34, -30, -25, 35, 38,
+    26, 34, 38, 27, 35, -27, 28, -37, 27, 46, 45, 26, -26, 32, 58, 43,
+    -35, -53, 33, -46, -92, -37, 30, -32, -37, -59, -32, -45, -62, -38, -39, -73,
+    -25, -32, 35, -25, 26, -43, -37, 25, 45, 33, 32, 26, 43, 27, 44, 36,
+    26, 39, 35, 59, -31, -35, 40, 27, 27, 37, 29, 58, -33, 57, 36, -31,
+    -27, -31, 37, 27, -43, 25, 26, 26, -54, 34, -29, -35, 29, 40, -33, -30,
+    32, 46, 28, -30, -26, -44, -27, 34, -42, -34, -43, -40, -26, -43, -31, -34,
+    -45, -47, -48, 28, 31, -25, -43, 31, 39, -31, -36, -31, 33, -34, -31, -33,
+    37, -30, -44, 32, 27, -28, 42, 29, 28, -31, 48, -37, -27, 32, 31, 42,
+    36, 29, -44, 42, -40, -33, 43, -49, -25, -35, 30, -49, 39, -36, 41, -25,
+    -35, -33, 58, 43, -25, 39, 26, -30, -77, -47, -55, 28, -32, -39, -70, 58,
+    60, -48, 36, -30, -27, -25, -41, -51, 37, -28, 33, -26, 43, -42, -27, -31,
+    -25, 36, 41, 27, 29, 34, 25, 66, -34, 29, 28, 35, 37, -30, 69, 36,
+    -25, -39, -45, -25, 25, 33, -27, -26, 36, -27, 45, -29, 27, -36, 33, -32,
+    -50, -34, -43, -30, -25, 29, 47, -29, -33, 26, 31, -31, -29, -53, -28, -30,
+    38, -35, -32, -66, -32, 79, 33, 26, -25, -32, -55, 26, -33, 61, -39, 31,
+    26, -54, -25, -26, -45, -29, -40, -46, -37, -38, 36, 56, -44, 33, 36, -37,
+    29, 28, 26, -47, -28, -26, 29, -33, -85, 34, -25, 35, 28, 36, 46, 31,
+    -28, 27, 33, -30, 35, 30, 29, 44, 64, 41, -25, -28, 27, -49, 38, 55,
+    37, -38, 30, 29, -43, 29, -25, 26, 93, 50, 33, -32, 33, 32, 31, 43,
+    32, 70, 96, -27, 73, 36, -25, 28, 42, 33, -40, 34, 31, 45, 37, 31,
+    -31, 25, 25, -33, 25, -25, -42, 41, 29, 27, 32, 29, 29, 44, -29, -28,
+    48, 30, -28, 26, 25, 31, -26, 62, 25, 37, 54, 46, 27, 27, 32, 25,
+    32, 26, 51, 25, 36, 37, 36, 30, 27, 45, -35, 46, 26, 51, 34, -37,
+    25, 54, 27, 60, 39, 41, 29, -26, 50, 55, 36, -33, 28, -27, -29, 27,
+    -25, -25, -28, 25, -27, -75, 48, -33, 45, -25, 27, 48, 34, 33, 30, 29,
+    32, 42, 28, 32, 50, 30, 27, -43, -36, 52, -26, 50, 45, 31, 47, 35,
+    54, -49, -54, 29, -28, 29, 41, -28, 58, 28, -27, 30, -75, 73, 45, 27,
+    39, 30, 86, -91, 48, 26, 65, -26, -42, -30, -29, 34, -38, -33, 71, 51,
+    -34, 39, -40, -33, -27, -53, -35, -32, -40, -32, 29, -66, 26, -28, -29, -44,
+    -29, -26, -25, -34, -28, 31, -32, 32, 33, 36, -26, 29, 35, -47, 27, 40,
+    29, 26, -26, -47, -26, 42, 28, -40, -32, -58, 28, -26, 37, -42, -25, -30,
+    -35, 44, 44, 47, -41, -48, 27, -27, 36, -28, -32, -45, -46, -26, -39, -49,
+    29, 44, -47, -52, -83, 31, -73, 48, -28, 52, -34, -26, 75, -33, 38, 41,
+    27, -29, 33, -35, -35, 47, -50, -37, 30, -39, -36, 43, -31, -33, -40, -45,
+    -52, -49, 31, 29, -38, 36, 51, -66, 26, -30, 25, -30, -28, 37, -52, -39,
+    27, -41, 28, 44, 28, 28, -33, 30, -33, 27, -26, 26, -29, -26, 30, -26,
+    -31, 39, 32, 41, 41, 28, -27, 36, -32, 25, 34, -49, -28, 26, 29, -36,
+    -25, -34, -30, -43, 43, -25, 58, 44, 38, -31, -63, 73, 37, 35, -53, -25,
+    -34, -25, -47, -50, 43, 40, 44, -47, 31, 40, 57, 36, 26, 29, -27, 35,
+    37, -31, -26, 36, 28, -32, 29, 33, 27, 44, 31, -38, 47, -28, -27, -37,
+    50, 46, 42, 25, 25, 28, 40, -31, 39, 41, 33, 39, 44, 43, 25, 50,
+    -29, 32, 63, 36, -25, 43, -29, 34, -37, -42, 56, 26, 42, 29, 26, 36,
+    31, 33, -41, -41, -29, -31, 50, 30, 25, 35, 26, 30, 32, 26, 32, 35,
+    41, 48, 27, 36, 38, 36, -26, 39, -26, 38, -33, -27, -50, -25, 26, 35,
+    29, 35, -36, 31, 25, 38, 37, -29, 30, -32, 25, -30, 44, -25, -25, 40,
+    37, 55, 25, 60, 30, 27, 37, 28, 32, -30, 30, 25, 25, 28, 38, -25,
+    29, 28, -27, -33, -30, 26, 26, 30, 26, 31, 47, 25, -26, 29, 36, 43,
+    43, -38, 37, 25, 34, 37, 29, 47, 32, 25, 28, 29, 35, 41, 41, 41,
+    29, 35, 55, 66, 38, 46, 32, 45, 29, 29, 31, -32, 51, 43, -34, 28,
+    36, 25, 25, -28, 29, 48, 37, 26, 29, 38, 66, 32, 57, 40, -50, -68,
+    38, 41, -41, 25, 28, -39, 41, 39, 30, -29, 34, 37, -45, -35, 60, 35,
+    25, -31, 28, 40, -26, 25, 45, 34, 31, 47, 45, 51, -34, 30, 52, 52,
+    -27, -30, 51, 52, 29, -31, 30, -40, -25, 49, -40, 25, 36, -27, 65, 43,
+    50, -37, -42, 30, -35, -26, 28, 32, 29, 50, 48, 33, 44, 33, 40, -40,
+    29, 29, 59, 37, -29, 66, 37, 29, 34, -35, 27, 27, -40, 31, 36, 45,
+    31, 44, -29, 34, -48, 36, -43, 28, 36, 63, 25, 57, 40, 44, 77, 27,
+    33, -35, 31, 25, -28, 28, 32, 27, -31, 26, 38, 51, 28, 39, 29, 39,
+    -32, 27, 25, -57, -34, 35, -36, 37, -39, -39, 53, -25, -30, -32, -32, 51,
+    33, -39, -30, 76, -39, -48, -41, -46, -30, 37, -32, -25, 64, 28, -72, -42,
+    -30, -55, -58, -33, -43, -25, -58, 69, 71, -60, -34, 33, -49, 29, -54, 36,
+    43, 44, 62, 48, 55, -30, 58, -30, 71, -30, -47, -45, -30, -48, 73, 52,
+    -31, -41, -43, -30, -25, -30, 56, 48, -41, 25, -34, 29, 32, -25, 31, 51,
+    26, 55, 39, -50, -33, 30, -53, 49, -28, -31, 49, -25, 25, 43, -36, -43,
+    -26, 32, 41, -32, -36, -30, 37, -39, -30, -26, -33, 31, -29, 40, 40, -27,
+    77, -40, 51, 28, 58, -46, -40, 47, -30, 40, 42, -38, 32, -31, 56, 49,
+    33, -36, 62, 35, -30, -75, -44, 59, -51, -79, -49, -67, 27, 27, -33, -33,
+    33, 55, -43, -34, -50, -27, 32, -28, -38, -49, -53, -54, -27, 40, 34, -57,
+    -26, -40, 39, 39, -60, 25, -28, -31, 26, 31, -37, 29, -36, 28, 26, -67,
+    -41, -27, 28, -34, 36, -46, -52, -28, 46, -25, 53, 28, 33, 26, 33, -33,
+    -27, 35, -29, -50, 25, 36, -44, 30, -39, -33, 35, -44, -26, 35, 37, -47,
+    -27, -25, -36, -43, 29, -29, -25, 56, 25, 30, 41, 29, 34, 39, 70, -26,
+    43, 29, 50, -33, 25, -42, 38, -34, -26, -26, -29, 33, 53, 47, 69, -37,
+    44, 29, 27, 55, 52, 29, 34, 44, 47, 43, 54, 35, -43, 43, 33, -28,
+    31, 34, -28, 37, 25, 45, 51, -27, -25, -25, 27, 34, 37, -31, 30, -40,
+    31, -37, -31, 27, -28, 36, 39, 28, 45, -33, -40, -30, 32, 41, 31, 36,
+    61, 46, 28, -27, 31, 35, 27, 27, 66, 25, 47, 33, 59, -35, 34, 25,
+    52, 51, -28, -25, 43, 25, 33, 42, 36, 28, 35, 56, 49, 39, 51, 46,
+    -33, 33, -26, 38, 38, 40, 26, 41, 61, -40, 44, 39, 69, -49, -27, -58,
+    -26, -66, -60, -42, -32, 72, -25, 38, -41, -48, -51, -39, -37, -37, -28, -28,
+    -42, -44, -38, -59, -29, -33, -31, -40, 41, -27, -29, -42, 45, 30, -37, 38,
+    70, 27, -35, -34, -33, 41, 40, -70, 39, 29, -31, 33, 31, -36, -33, 29,
+    -31, -45, 40, 76, 58, 26, 32, 31, -37, -46, 45, 60, 39, 33, -34, 56,
+    -25, 32, 40, -37, -25, 27, -25, 25, -63, 37, 25, -39, -25, 68, 28, -38,
+    -32, 26, 26, -42, 83, -27, 39, -77, -46, 30, 36, -65, -28, 38, 48, -25,
+    -33, -45, 36, -46, -26, -31, 52, -43, -32, 26, -59, 52, -63, 26, 42, -40,
+    -27, 34, -38, -41, -30, -56, -34, -41, -26, -47, -62, -53, -45, -30, -28, -47,
+    40, -31, -60, -34, -37, -33, -34, -29, -32, -27, 34, -27, 63, -27, 49, -46,
+    -30, -35, -34, 50, -31, -31, 28, 36, -27, 50, -29, -56, -32, 44, -50, -58,
+    -37, -33, 42, -46, 34, 29, -25, -31, -32, 29, 26, -80, 25, -79, -27, 47,
+    25, -42, 48, -38, -26, -30, -55, -56, -37, -26, -26, -34, -39, -26, -37, -27,
+    -52, 47, -33, 55, -51, -31, -39, -28, 29, -43, -30, -56, -33, -25, -53, -68,
+    -31, -58, -36, -34, -34, -35, -33, -28, -33, -28, -43, -67, -70, -29, -49, -27,
+    -30, -30, -28, -38, 39, 25, -25, -31, -37, 28, -59, 27, 26, 44, 30, 31,
+    31, -39, 46, -27, 26, -46, -62, -36, 58, -34, 46, 31, 31, 28, 26, 38,
+    26, -25, 74, -27, -69, -27, -47, -30, -43, -25, -26, 46, -26, -31, 41, 25,
+    25, 26, -30, -55, 37, 32, -38, 33, -35, 37, 29, -37, -37, -42, 27, 27,
+    -42, 28, -53, -38, -26, 33, -40, 30, -29, -26, 42, -45, -48, -43, -29, -31,
+    -61, -50, 25, -43, 30, -26, -85, -49, -41, -44, -36, -26, -45, -26, -32, -37,
+    -28, -50, -47, 43, 34, 39, 28, 38, 41, 55, 46, 27, 40, 29, 55, 27,
+    32, -27, 26, 58, -38, -25, 25, -30, 47, -30, 30, 59, -46, 35, -29, 27,
+    36, 31, 39, 29, 32, 36, 33, -35, -37, -42, 28, 25, -28, -75, -47, -25,
+    29, 35, 35, -30, -33, 50, -61, -25, -32, -26, 32, 50, 28, 35, -27, 30,
+    -28, -36, 26, -33, -28, 40, -34, -27, -33, -30, 26, 42, -32, -37, 81, 35,
+    25, 34, 35, -34, 29, -41, 48, -25, 37, 44, -25, 25, 36, 31, 52, 27,
+    -29, 25, -29, -26, 34, 42, 30, -30, 54, -26, 31, 44, -27, -26, 33, 30,
+    52, 39, 29, 27, 48, -26, 37, 25, 26, 46, 36, 31, 33, -30, 33, 49,
+    -25, 35, 56, 45, 30, 29, 25, 26, -25, -31, 26, 26, -31, -40, -27, 39,
+    41, 34, 39, 28, -33, -31, 27, 26, 40, 35, -25, -41, 26, 30, -30, -38,
+    -38, -27, -34, -44, -32, -42, -40, -38, -44, -35, -34, -39, -62, -50, -29, -42,
+    -32, -32, -37, -39, -31, -25, -30, -34, -29, -32, -47, -41, -41, -39, -38, -52,
+    -27, -33, -38, -55, -25, -27, -28, -25, -30, -48, -42, -34, -42, -44, -51, -38,
+    -37, -26, -38, -42, -47, -49, -46, -33, -33, -26, -29, -70, -31, -29, -30, -31,
+    -31, -34, 33, -62, -43, -29, 34, -35, -53, -50, -37, -36, -27, -45, -55, -30,
+    -28, -56, 28, -28, -33, -33, -33, -79, -41, 31, -46, -35, -27, -34, -51, -47,
+    -40, -32, -26, -25, -36, -45, -28, -36, -58, 55, 34, 65, -35, -56, -55, 51,
+    -48, 27, -51, 29, 54, 27, -39, 30, 36, 53, 26, 29, -33, -34, -25, -52,
+    -29, -33, -29, -36, -43, -33, -27, -30, -37, -34, -40, -63, -50, -39, -28, 37,
+    -28, -27, -27, -46, -45, -37, -30, -31, -61, -34, -53, -72, -26, -53, -29, -41,
+    -36, -56, 25, -28, -36, 29, -40, 27, 25, -28, -27, -76, -59, -26, -54, 25,
+    -48, -43, -40, -41, 31, -66, 38, -41, -38, -35, -46, -53, 45, -37, -36, -57,
+    -42, -40, -43, 41, -29, -37, -26, -35, 38, -25, 62, -34, 36, 32, -27, -59,
+    58, -45, 36, -77, -32, 26, -26, 42, 45, -65, -49, 35, 30, 55, 25, 32,
+    -42, -54, -39, 28, -39, 45, 36, 31, 53, 39, -25, -46, 43, 27, 25, 43,
+    26, 41, 31, -32, 42, 45, 35, 42, 27, -25, -26, 52, 38, -41, 55, 27,
+    25, -28, 37, 51, -37, 47, -37, 34, 50, -38, -28, 42, 61, 72, -33, 45,
+    -42, -42, -47, 39, 30, -29, -42, -29, -28, 40, -32, 31, 38, 32, 38, 29,
+    43, 35, 28, -41, 25, -31, -36, 33, -42, -57, -41, -49, 25, 28, -29, -30,
+    45, -32, -35, 46, 30, 36, -33, 30, -44, 40, -32, -51, 30, -34, -25, -36,
+    51, 32, 25, 29, 42, -30, -27, 56, -55, 53, -44, -29, 51, 37, 42, 27,
+    40, 38, 48, -34, -37, 25, -31, 29, -36, -51, 31, -29, -32, 27, 29, 31,
+    -35, 47, -33, 25, -27, -33, 30, 31, -42, 26, -30, -33, -39, -39, 39, -48,
+    -30, 42, -36, -30, 31, -45, -25, 58, -29, 32, -42, -34, -52, -34, -29, -26,
+    -68, -37, -32, -26, -33, 25, 31, 40, -30, -52, -32, -41, -50, -48, -50, -37,
+    45, -42, -41, 25, -26, -31, -25, -35, -27, -39, -48, 40, 32, -43, -26, 27,
+    -37, -43, -43, 34, -36, -38, -47, -28, -40, -49, 26, -32, -32, -39, -27, -41,
+    -31, 29, 26, -38, -29, -32, -30, -25, -34, 31, -34, -26, -37, 43, -28, -36,
+    -41, 38, 34, 31, 38, 54, 59, 34, 27, 30, 47, -31, -33, 33, -30, 37,
+    -27, 37, 32, 35, 26, 25, 33, 44, 36, -39, 38, 34, -41, -45, 30, -37,
+    -28, -56, -31, -46, -48, -33, -37, -33, 48, 44, -38, 36, -49, -40, -34, 28,
+    -27, -28, 26, -46, -37, -28, -25, -31, 27, -33, -36, -47, -48, -46, -36, -40,
+    27, -49, -31, -35, -69, -44, -30, -50, -38, -53, -44, -54, -37, -34, -28, -31,
+    -46, -49, -30, -38, -29, -40, -40, -31, 43, -35, -50, -54, -47, -60, -47, 50,
+    -28, -25, -51, -44, -30, -43, -41, 26, -26, -37, -28, 33, -37, -25, 26, 34,
+    -29, -38, -31, -26, -32, -43, -30, -33, 25, -32, -40, -61, 36, -31, 26, -39,
+    -35, 40, 25, -34, -50, -29, 26, -29, -34, 38, -59, 30, -26, -41, 25, 35,
+    46, 51, -88, 25, 27, 34, -45, 31, 27, -39, -34, -32, -28, 25, 49, 25,
+    30, -34, 36, 54, -30, 45, -64, 26, -34, -35, -47, 58, -35, 52, 31, -26,
+    51, 55, -59, -32, -33, -49, -47, 26, -30, 44, -53, -35, -26, -50, -61, -54,
+    -94, 28, -28, -28, 39, 26, -65, -62, -39, -38, -27, 47, -58, -47, -43, 47,
+    -25, -35, -32, -29, 47, -33, 33, -32, 38, 58, -29, 30, 43, 29, -43, -27,
+    -26, 32, 34, -58, -30, -31, 25, -33, -25, -37, 48, -39, 32, -36, 47, 28,
+    -49, 32, -39, 34, -27, -44, -30, 47, 38, -45, 28, -42, -25, -43, 30, 31,
+    31, 44, -26, -47, 33, 27, -36, 45, 41, -64, 27, -29, -33, -27, 36, -28,
+    -35, 33, 63, -30, 46, 31, -26, 35, 33, 26, -47, 31, -29, -28, -34, -37,
+    30, 41, 26, 44, 27, -35, 36, -34, 26, 38, 37, 30, -33, 27, 34, 28,
+    -34, 40, -38, 26, 28, 30, -26, 50, 32, -48, 36, 29, 29, -41, -25, 31,
+    -45, 39, 28, 34, 32, -39, 32, -26, -33, 26, 25, 38, -26, -30, 30, 26,
+    28, 35, -26, -28, -25, -31, -25, 32, 45, 33, 25, 43, 26, -58, -28, 48,
+    51, -58, -37, 25, 63, 60, 27, -41, 39, -39, -47, 54, -36, -30, 29, -40,
+    72, 86, 39, 31, -53, 27, 40, 41, 49, -43, -27, -26, -28, 73, 34, 52,
+    -32, -35, -26, -67, 29, -41, -29, -38, -52, -26, -29, -45, 37, -28, 31, 25,
+    25, 44, 30, 37, 62, 30, 26, 56, 39, -28, 28, 28, -42, 26, -26, 32,
+    36, 25, -46, 33, 42, 35, 52, 31, 32, 45, 46, -25, 47, 39, -39, -28,
+    28, 43, -33, -38, 26, -35, 40, 34, -28, 28, 29, 29, -37, -28, -44, -44,
+    -61, 25, 31, 26, -31, -31, 37, 31, -26, 35, 26, -27, 28, -29, 29, 32,
+    39, -27, -45, -27, -40, -42, 30, -30, -25, 26, -26, 25, -28, -33, 36, -30,
+    -27, -30, -32, -30, 71, 25, -27, 60, 32, -31, -37, 26, 25, -42, -31, -43,
+    -31, 28, -29, 31, -84, -56, -31, -63, -36, 32, -26, 39, -36, -27, 35, 28,
+    -28, -37, -26, -42, 27, -62, 31, 42, 31, 41, 27, 34, -32, 35, 37, 25,
+    31, 28, 35, 27, 30, 33, 26, -28, 26, -29, 33, 30, 36, 40, -41, 43,
+    25, 31, -28, -36, -40, -38, -27, 33, 27, -28, -29, -39, -31, -44, 25, 59,
+    -40, -28, -32, -35, -46, 34, -37, 33, 30, 31, 47, 34, 30, -64, -28, -31,
+    -30, 36, -44, 32, 29, 30, -29, 28, 33, -28, 42, 50, 26, 43, -28, 26,
+    -30, -30, 25, 58, 28, -40, 25, 28, -25, -35, 36, -49, 32, 34, 49, 27,
+    35, 29, 27, 38, -27, 56, 25, 27, -31, 43, -35, -29, -29, -37, -31, 27,
+    -35, 35, 40, 29, 30, 35, -38, -25, 67, -40, 31, 36, 65, 36, 54, 29,
+    33, 60, -28, -35, -29, -31, -46, -33, -26, -39, 46, 46, -57, 30, -53, -43,
+    30, -25, 31, 29, 35, 55, 29, -30, 27, 36, 34, 30, -37, -28, 26, 33,
+    27, 33, 43, 34, 34, 25, 25, -33, 31, 33, 27, 32, 27, 32, 30, -43,
+    -38, 25, -29, 31, -49, -31, -39, 28, -25, -44, -30, -29, -42, -63, 33, -30,
+    61, 40, -29, -25, 28, -41, 37, 37, -29, 32, 46, 25, 36, 35, 54, 37,
+    -41, 28, -30, -26, -53, 28, -62, 28, 48, 63, -34, 29, -74, -43, 26, 27,
+    29, -26, -29, 32, -50, 61, -26, -27, 28, -36, 47, 39, 34, 25, 29, -31,
+    -66, 25, -41, 34, 32, 29, -28, 34, -31, -30, 33, 32, -45, 31, 28, 40,
+    -35, 25, -31, 46, 27, 26, 38, 58, 46, 73, 32, 33, -26, 30, 50, 30,
+    44, -31, 55, 55, 33, 25, 67, 39, -31, -29, 55, 25, 35, 48, 36, 29,
+    -33, -30, 39, 27, 34, 27, 25, -25, 35, -28, 33, 29, 29, -27, 30, 25,
+    32, -27, 30, -25, -29, 26, 34, 38, 28, 41, -30, -28, 42, -30, 32, 33,
+    25, 47, 27, 26, 32, 25, -25, 41, 35, 35, 38, 38, 64, 25, -37, 26,
+    -28, 26, 31, 29, -42, 33, 67, 33, 26, 50, 34, 30, 37, -33, -51, 32,
+    -39, 28, 55, -30, 25, 41, -27, 43, 36, 29, -39, 31, 29, -26, 28, 32,
+    51, -54, -27, -29, -76, -32, 25, -29, -28, 28, -25, -27, 25, -25, -36, 41,
+    -33, 38, 30, 44, -29, 49, 40, 29, 40, -41, -43, -34, 31, 26, 55, -43,
+    31, -30, 33, -26, 46, -30, 38, 37, 38, -27, -30, 33, 34, 37, 42, 47,
+    -25, 38, 64, 29, 47, -40, 27, 26, 35, 33, 30, 25, 31, -28, -38, 28,
+    -27, 28, -28, -69, -31, -33, 26, 33, -25, 25, -45, 32, -31, -53, 35, -31,
+    55, 44, 61, -56, -35, 45, 102, 51, 38, -45, -31, 47, -36, 71, -26, -29,
+    -59, -31, -27, 38, -33, -37, -31, -53, -41, -29, 127, 57, -36, 35, 66, -47,
+    34, 48, 38, 35, 46, 32, 26, 34, 28, -29, -25, -28, 30, -26, 40, -30,
+    -26, 34, 25, 35, 45, -46, -25, 25, 47, 38, 30, 37, 44, 28, 27, 26,
+    -41, 26, 27, -32, 28, -25, 32, 30, 59, 26, 45, -46, 34, 27, -45, 31,
+    36, 28, 41, 25, -28, 37, -29, 44, -27, 27, -28, 29, -29, -41, -39, -52,
+    62, -31, -33, -68, -26, 25, -56, -37, -26, -45, -42, 35, 43, -26, -37, -26,
+    -32, 31, -69, -57, -38, -37, 55, -26, -27, -29, 32, 26, -26, 36, -41, -30,
+    -53, -26, 80, -49, 55, -31, 35, 39, -26, 26, 53, 26, 68, -30, -29, -29,
+    51, 32, 25, 86, 45, -26, 27, 25, 31, 27, 30, 42, 28, 27, 25, -26,
+    28, 26, 30, -25, 27, 32, -31, 43, 35, 31, 29, 27, -34, 25, 27, 49,
+    -51, 38, -39, 25, 38, 25, -25, 46, -29, -34, -30, -32, 49, 28, -27, 26,
+    27, 30, 34, 35, -29, 46, 27, 26, -27, 48, 26, 39, 38, 33, -28, -34,
+    56, 30, -25, 50, -29, 40, 31, 38, 32, 29, 27, -25, -32, 27, 31, 27,
+    30, 32, 30, 25, -38, 29, -29, 28, -26, 28, 43, 32, 53, 29, 48, -28,
+    48, 37, -27, 29, 30, 50, 51, 25, 71, 77, 36, 33, -50, -26, 33, 25,
+    -51, -50, -26, -32, 39, 42, 42, -30, 29, -25, 35, 29, 26, 30, -31, 39,
+    -31, 27, 64, 35, -36, -51, 32, 27, 32, 36, -25, -57, 25, 53, 43, 52,
+    32, 37, 57, 65, 30, -37, -39, -27, 30, -50, -49, -30, -27, 47, 26, -35,
+    -43, -30, 30, -42, -43, -40, 32, 54, 25, -30, 52, -48, 81, 27, 25, -30,
+    54, -31, 33, 47, -26, 29, -63, 40, 37, -25, 65, -63, -37, 42, 41, -32,
+    -31, -39, 30, -26, 30, 51, -46, -60, -33, 25, 36, 50, 26, -32, -44, 53,
+    33, 25, 27, 26, -43, 37, -55, -25, -30, 44, 28, 32, -34, 37, 45, 25,
+    54, 29, -67, 45, 78, 55, 30, -34, 42, 36, 37, 67, 31, 39, -41, -84,
+    33, -35, -54, -34, -29, -25, 27, 41, 26, 25, 25, 37, -30, -29, -34, 30,
+    25, 27, -36, -25, 33, -26, 32, -30, -37, -77, -36, 26, -31, -27, -54, -45,
+    -28, -33, 44, 34, -28, -29, -27, -34, -27, -29, -30, -32, -36, 29, 30, -30,
+    30, 50, -40, 46, 54, -27, -25, -29, -54, 39, -41, -44, 49, 28, -59, 39,
+    -26, 29, -58, 64, 32, -29, 25, 60, 78, 66, 46, 38, 48, 56, -29, 69,
+    25, 29, 112, 28, 57, -30, 31, 40, 37, -30, 43, -48, 33, -52, -41, -35,
+    25, -28, 25, 32, 26, -43, -37, 42, -27, -33, 25, -34, -26, -27, -34, -30,
+    -30, -26, 40, -33, -28, -32, 29, 35, 27, 31, 30, -28, -29, 40, -28, -30,
+    41, -35, -38, 32, -35, -27, 26, 31, -25, -27, -29, -39, -40, -30, -28, 29,
+    -26, 34, 29, 42, -25, -27, -36, -30, 36, -32, -34, 27, 27, 31, -28, -29,
+    -29, 28, 25, 27, -31, 27, -35, 25, 32, -29, -25, -36, 38, -28, -33, 40,
+    -54, -45, -28, -44, -25, -35, 29, 38, -35, -26, -25, -33, -28, 26, 26, 31,
+    -28, 47, 31, 31, -29, -39, -27, -30, -33, -39, 34, -52, 72, -37, -34, -35,
+    -50, -48, -30, -29, 31, -35, -55, -38, 35, 37, -53, -27, 30, -30, 76, 27,
+    44, 46, 29, 36, 27, 47, -45, 39, 28, 30, 61, 40, 44, 27, -31, 45,
+    -57, 49, 29, 33, -39, 47, -27, 32, -35, 26, 49, 26, -38, 36, 44, 34,
+    27, -42, 25, -52, 31, -33, -46, 43, 27, -44, -27, 34, 38, 44, 27, 43,
+    -28, 36, -48, -25, -52, -42, -27, -49, -50, -31, -32, -45, -37, -54, -27, 32,
+    -38, 60, -34, -37, 26, -40, -26, -25, 31, 49, -25, -28, -56, -39, 35, 32,
+    -47, 25, -32, -65, -39, -38, -41, 40, -29, -52, -40, -62, -35, -38, 31, -46,
+    34, -29, 31, 39, 28, -48, 28, 40, -65, -42, 37, 25, -30, -28, 25, 46,
+    35, -59, 26, 32, -28, 25, 26, 31, -25, 44, -31, 33, 28, -31, -26, 26,
+    -37, -78, 31, 34, -41, 36, -31, 25, 30, 25, 34, 61, 27, -87, 43, 28,
+    31, -39, -44, 28, 33, -40, -45, -37, -28, -26, -27, 36, 34, 48, -25, -37,
+    -34, -38, 26, -32, -42, -25, -40, -50, -32, -41, -42, -25, 35, 36, -36, -27,
+    -33, -26, -29, -28, 26, 27, -29, 26, 38, 37, 51, 32, -25, 31, -27, 41,
+    26, 27, 42, 66, 34, 29, 46, 47, 29, -37, -30, -26, 26, 28, 38, -36,
+    36, 39, 29, -28, -35, -28, 56, 39, -54, 30, -39, -29, -60, -31, -39, -49,
+    -37, -45, 29, -61, -26, -50, 29, 70, -31, -33, 52, -42, 28, -48, -87, -33,
+    -54, 28, -25, -25, -26, -30, 42, -30, -30, 46, -26, 83, 25, 32, 42, -25,
+    57, -30, -29, -27, -38, -42, 25, -36, 27, 43, -30, 28, 28, -32, 27, -27,
+    -55, 53, -35, 33, -37, -38, 32, 39, -36, 31, -27, 26, 25, 26, 28, -27,
+    26, 34, 29, -27, -84, -25, -30, -35, -29, -34, 30, 34, 39, 31, -28, -32,
+    -36, 50, 35, 34, 26, 38, 56, 30, 51, 29, 45, 57, -29, 30, 38, 25,
+    -29, -27, 32, 28, 26, 27, 37, 35, 25, 39, -28, 26, -32, 28, 25, 36,
+    -27, 33, -25, -36, -32, -30, -27, 25, -34, -25, 37, -42, -26, 41, -29, 29,
+    -31, 30, 28, -25, 30, 25, -27, 43, -30, 43, 27, -28, 32, -35, 38, 28,
+    27, 26, 25, -54, -28, -52, 28, -38, -55, 36, -57, -41, 38, -47, 38, -27,
+    -26, 27, 31, 26, -54, -38, 25, 28, 28, 25, 36, -28, 28, 46, 39, 40,
+    71, -31, 43, 34, 49, 42, 44, -59, -27, 25, 29, 32, 28, -56, 42, 59,
+    -33, 34, -47, 28, 29, 35, 58, 52, 68, -48, 31, 25, 57, 32, 29, 38,
+    29, -46, 32, 42, -26, 36, 31, -39, 27, -34, 60, 45, 50, 48, 51, -37,
+    26, 32, 55, 69, 25, -29, 34, -29, 34, 33, 30, 41, -25, -42, 35, -35,
+    -48, 32, -27, 32, 31, -36, 29, 59, 37, 26, -39, 40, 29, 39, 30, -26,
+    27, 30, -46, 31, 45, 48, 40, 42, 52, 35, -52, 35, 48, 52, 33, 31,
+    -65, -43, 50, 30, -77, -57, -25, 27, 69, 36, 42, 67, -26, 29, 25, 25,
+    47, 25, 45, -35, 48, 43, 37, 53, 33, -27, 37, 43, 44, 53, 28, 45,
+    47, 31, 30, 30, -31, 30, 29, 40, 38, 48, 74, 34, 29, 30, -72, 29,
+    26, -34, 30, -25, -32, 28, 51, 28, 55, -37, 32, 26, -35, -26, -26, 28,
+    -42, 42, -47, -32, 35, -30, 39, -28, 27, -26, 45, 29, -26, 31, 41, 25,
+    -48, -28, 25, -42, 29, -49, -25, -38, -41, -35, -68, -25, -30, -35, 26, -29,
+    50, 26, -36, 47, 29, -36, -39, 33, 38, -26, 42, -50, -27, 41, -25, 31,
+    36, 25, -31, -35, 26, -45, -29, 34, -29, 47, -29, 37, 29, -36, -29, 35,
+    74, 29, 29, -36, 47, 48, 73, 57, 25, 37, 36, 48, 29, -50, 37, -30,
+    -29, -28, -27, -28, 33, 32, -41, 25, 30, 28, 60, -29, 51, 32, 37, 26,
+    38, 52, 28, 28, -33, -25, -43, 52, 27, 38, 32, 36, -26, -25, 31, -30,
+    -49, 32, -26, 29, 39, -31, 27, 31, -48, -42, -46, 30, -38, 33, 39, 75,
+    31, 35, 31, 34, 29, -44, 47, 35, 33, -32, -34, -27, -34, -34, -40, -60,
+    25, -25, -30, -28, 34, -33, -34, 28, -26, -25, -65, 35, -33, -45, -33, 34,
+    -65, -43, -46, 33, -43, -50, -28, 26, -25, 39, -25, -34, -33, -26, -39, 26,
+    -46, -39, -41, -41, -28, 33, -37, -25, -36, -25, -25, 37, 30, 31, 39, 37,
+    -28, 27, -30, 36, 34, 35, -48, -40, -26, -32, -37, -30, 43, 28, -43, -35,
+    -52, -29, -27, -26, 50, 42, -36, 28, 38, 26, 28, -35, 43, 36, 31, -25,
+    26, 25, 66, 25, 27, 46, 40, -46, 31, -30, 41, 37, 30, 36, 25, 43,
+    69, 41, 27, -25, 26, 29, -42, 48, 47, 26, -41, 30, 43, -34, 31, -30,
+    29, -29, -46, 26, 27, -32, 28, -39, 28, -28, -30, -26, 25, -34, -35, -31,
+    49, 44, -38, -47, -33, 33, -26, 53, -35, -38, -28, -40, -48, -30, -28, 44,
+    -35, -57, -30, -38, -48, -34, -35, -43, -35, -48, -31, -29, -42, 35, -50, -31,
+    27, -30, 48, 29, -41, 39, 25, 29, 34, 59, 41, 29, -34, -36, 32, 38,
+    36, -26, 32, -43, -31, 27, -27, -43, 30, -35, 30, -32, 41, 29, 36, -32,
+    26, -38, -28, -44, -41, -36, -35, -28, -27, 37, -58, -31, 27, -37, -28, -41,
+    -40, 27, -27, -27, -35, -68, -25, -31, -26, 25, -55, -36, -45, -39, -43, -36,
+    -36, -39, -36, 28, 28, -27, -25, -37, -31, -33, -29, -30, -41, 27, -29, -50,
+    -39, -26, -50, 47, -26, 50, -29, -45, 31, 48, 38, 27, -30, 37, -35, 30,
+    39, 66, 25, 31, 38, -52, 28, -37, -27, -48, 28, 37, -33, 27, -33, -30,
+    37, 40, -38, -25, -34, -45, 25, -40, 30, -50, -35, -74, -29, 32, -38, -33,
+    -36, -39, 36, 34, 31, -50, -34, -33, -30, -38, -35, -33, 29, 27, -46, -31,
+    -59, -27, -49, 33, -43, -39, -34, -44, 26, 25, 33, 48, -38, 26, 57, -36,
+    63, 35, -34, -60, -27, -68, 38, -34, -33, -44, -47, 39, 25, -51, 59, -46,
+    33, 30, -28, -39, 31, 43, 58, -44, -31, -30, -36, 43, -40, 29, -30, -30,
+    28, -39, -38, -33, -65, -27, -31, -38, -34, -27, -27, -27, -44, -35, -28, -34,
+    26, -31, 28, -27, -28, -26, -25, -26, -29, 32, -32, -37, -39, -33, -30, -37,
+    -26, -28, -35, -26, -28, -26, -35, -27, -34, -34, -30, -32, -34, -31, 36, -28,
+    -32, -28, -29, -29, -32, -28, -31, -30, -45, -27, -25, -27, -35, -32, -27, -32,
+    -29, -27, -27, 27, -34, -28, 36, 41, 30, -35, -26, -27, 28, 31, 25, -26,
+    -28, 50, -37, -47, 30, 29, -36, -41, -29, -25, 28, 49, 34, -33, -48, 26,
+    26, 33, 48, 42, 29, -50, -32, 38, -34, -39, -28, 31, 27, 29, 35, 25,
+    49, -26, -38, -26, 33, 56, -47, 37, 39, 32, 27, 34, 31, 27, 38, 38,
+    29, 35, 25, -31, -39, 45, 51, 25, 36, 30, 30, 49, -28, 28, 26, -32,
+    42, 30, 41, -26, 31, 33, 35, 29, 38, -25, -30, -35, 48, 29, 26, -34,
+    -35, 25, 26, -28, 29, 42, 27, 27, 42, -31, 28, -37, 28, -28, 39, -33,
+    -34, -32, 31, -25, -34, -28, 35, 29, 38, 29, 41, 30, 56, 26, 42, 33,
+    -28, 27, 32, -27, 37, -28, -38, -33, 39, 30, 36, 29, -33, 26, 29, -29,
+    -41, -43, -27, -33, -27, -32, -38, -25, -33, -48, -39, -34, -41, -27, -37, -35,
+    -27, -25, -55, -31, -28, -28, -31, -34, 25, -48, -33, -30, 35, -26, 29, 34,
+    29, -37, 31, -42, -28, 25, 28, -31, -31, 27, -29, -30, -40, 27, -28, -28,
+    38, -39, -40, -27, -36, -41, -25, -26, -29, -37, -26, -40, -50, -27, -33, -25,
+    -32, -39, -34, -26, -40, -30, -27, -25, -31, -48, -48, -40, -36, -27, -36, -34,
+    -27, -26, -30, 28, -31, -27, -36, -28, -36, 38, -26, -33, -27, -30, -28, -25,
+    -37, -27, -38, -29, -30, -36, -29, -32, -33, -35, -42, -30, -33, -31, -39, -45,
+    -25, -27, -25, 0, -28, -26, 0, -25, -26, -30, 0, -27, -26, -25, -26, -28,
+    -25, -27, -27, -25, -26, -25, -28, -26, -25, -27, -30, -29, -26, -27, -27, -26,
+    -27, -26, -26, -26, -28, -27, -27, -27, -25, -26, -26, -28, -27, -29, -25, -25,
+    -26, -26, -27, -25, -27, -27, -25, -28, -27, -28, -25, -26, -26, -26, -27, -25,
+    -25, -28, 36, 25, 31, 32, 38, 30, 31, 26, 30, 31, 31, -41, 28, -25,
+    -26, -32, -25, -36, 47, -29, -29, -27, 30, -35, -29, -27, -49, -36, 30, -36,
+    -41, -29, -27, 38, -29, -26, 52, -27, 29, -25, 28, 31, 29, -30, 28, -27,
+    29, 49, -27, -25, 42, 38, 51, 25, 35, 30, 27, 27, -33, -33, 41, 75,
+    -27, 30, 42, 43, 27, 37, 33, 25, 33, 39, 29, 26, 43, 36, 27, -34,
+    -45, 46, -39, -51, 68, 32, 26, -40, 37, 29, 30, 26, -27, -38, 40, 28,
+    -27, -27, 30, -28, 37, 33, 40, -26, 36, 27, -26, -32, 48, -25, 35, -27,
+    -30, 25, -27, 52, 41, -32, 31, 34, -26, 35, 36, 33, -50, -34, -28, -48,
+    -27, 33, -43, 41, -31, 39, 34, -26, 25, 30, -25, 31, -27, -66, -48, -28,
+    26, 26, -43, 29, 33, -54, -27, -25, -40, -52, 31, 27, 36, 25, 25, 27,
+    -26, 31, -46, 32, 40, -31, -47, 29, 44, -35, 36, -45, 31, 31, 31, 32,
+    -55, -47, -26, 37, -43, 48, 29, 38, 47, 52, 46, 43, 36, -26, 33, 25,
+    -25, 42, 38, -31, 38, -36, 36, 49, 37, -33, 34, 26, 59, 76, -26, 25,
+    -25, 61, 26, 39, -26, -26, -25, 54, -60, 42, 36, 53, -66, -62, -29, -56,
+    26, -39, -32, -38, -28, -26, -30, -49, -43, -36, -43, 27, -44, -27, -32, -33,
+    32, -29, 27, -31, 33, 26, -37, 32, 42, 26, -26, 25, 28, 25, -25, 27,
+    47, 32, -35, 25, 25, -30, -42, 40, 25, -26, 41, 27, 31, 26, 38, 33,
+    -37, 25, 37, 50, -39, 25, 35, 33, 30, -50, 42, -43, -34, 56, 39, 38,
+    -26, 38, 26, -48, 30, 43, -40, 28, 28, 40, -27, -33, 29, -28, -28, -40,
+    -40, -25, -26, -26, -28, -31, -25, -27, -33, -28, -56, -56, -26, -32, 25, -31,
+    27, -29, 30, 25, -39, -36, 29, 25, 27, 37, -25, -28, -28, -26, -26, 25,
+    -36, 26, -32, -54, -29, 41, -45, 28, 28, -46, 29, -29, 46, -26, 34, -32,
+    28, -31, 34, -28, -41, -55, -41, -27, 33, -33, 26, -30, -25, 53, -33, -32,
+    -26, -46, 28, -25, -25, -28, -31, -38, 39, -40, -25, -26, -45, -33, -34, -32,
+    -36, -53, -25, -33, -35, -30, -60, 50, -26, 33, -44, -37, 32, -42, 44, -46,
+    -59, -27, -41, 38, 35, -33, 30, -40, -47, -34, -53, 28, -43, 27, 28, 32,
+    25, 67, -25, -33, -29, 41, 29, 49, 28, -39, 31, 74, -30, -56, 32, -26,
+    47, 26, 34, 36, 43, 35, 41, 40, 28, -29, 52, -38, 25, 42, 42, -46,
+    27, 36, 25, -30, -39, 32, -38, -38, -41, 45, -43, -25, -78, 44, -31, -57,
+    26, 44, 41, 26, 45, -35, 28, 43, -51, -34, 68, 28, -25, 25, 34, 42,
+    -33, 25, -36, -37, -55, -39, 37, -27, -91, -29, -27, 44, 25, 31, -39, -30,
+    -28, 27, 25, 32, 37, -31, 27, -38, -26, -37, -34, 28, 58, 28, 31, -48,
+    27, -25, 30, 32, 76, 55, -35, -33, 32, 42, 34, 81, -31, -27, 34, -32,
+    58, 43, -44, 27, -36, 37, 48, 40, -25, 30, -43, -39, -43, -27, -58, -28,
+    -29, -30, 41, 48, 44, -34, 39, -36, 30, 28, 46, 62, 26, -31, -28, -30,
+    -31, 30, 48, -31, 35, 33, 25, 30, 28, -66, 30, 44, 26, -62, -33, -65,
+    59, -25, -31, 39, -27, 25, 35, 29, 27, 33, -26, 27, 39, 36, 42, 27,
+    -29, 27, 30, -40, 53, -27, -33, -26, 34, -27, 48, 26, -27, 29, 42, 29,
+    28, -28, -32, 26, 36, -35, 44, 34, 41, 27, -47, 43, 60, -59, 29, -35,
+    -44, -29, -25, 26, -33, -25, -25, 36, 28, 27, -37, 28, -49, -26, 28, 34,
+    -35, 28, -28, 37, 26, 25, 32, 29, 32, 25, 32, 26, 25, 25, 42, -27,
+    30, -34, 60, 38, 29, 55, -30, -27, 36, -29, 26, 30, 27, 31, 45, -26,
+    35, -26, -28, 33, 38, -36, -42, -34, -25, -34, 25, 52, -36, -30, 34, 45,
+    -26, -25, -25, 37, 56, 26, 27, 27, 52, 40, 51, 48, 65, 39, 29, 41,
+    52, 26, 29, 28, 29, -25, 32, -35, 25, 40, 42, 33, 36, 29, 33, 32,
+    29, -58, 27, -26, 31, 50, 37, 26, 42, 44, 28, 26, 31, 25, 32, 33,
+    35, 26, 40, 39, -34, 43, 46, 35, 36, 31, 53, 28, 33, 25, 25, 30,
+    33, 29, 26, 49, 65, 35, 30, 26, 40, 52, 46, 40, 34, 35, 34, -35,
+    41, 29, 41, -25, 34, 71, 32, -31, -41, 28, 37, 27, -62, 30, -40, -56,
+    25, 30, 28, -27, -30, 46, 28, 30, 59, -25, -37, 34, 26, -31, -38, -28,
+    -32, 25, -45, -42, -49, 63, 30, 37, 37, 35, 73, -37, 26, -35, -50, -31,
+    -47, 31, 30, 25, -57, -28, -70, 25, 31, 25, 36, 48, 31, -34, 28, 29,
+    31, 39, -28, -27, -27, -45, -31, -33, 33, 48, -50, -42, -44, 47, 34, -57,
+    -28, -36, -26, 25, -42, 55, -47, 37, -28, -44, 29, 26, -42, -50, -39, -49,
+    49, -54, -26, 46, 74, 105, -43, 43, 68, -30, 45, 45, 30, -36, 27, 38,
+    60, 48, 33, 68, 62, -37, 30, 39, 48, 48, 57, 49, -28, -46, 30, 31,
+    40, -37, -29, 36, 36, -28, -32, 49, -31, -32, 59, -41, 29, -31, -31, -48,
+    -25, 50, 29, -31, 29, -35, 26, -38, 31, 46, -65, -27, -28, 25, 27, 29,
+    -31, -28, 30, -29, 38, 70, 30, 40, -53, 28, 58, 45, -26, 29, 60, 26,
+    -28, 27, -40, -39, 25, 41, 65, 33, 41, -46, 28, 39, 30, 26, 41, 32,
+    25, 30, 34, 42, 38, 28, 30, 39, 29, 39, -54, 29, -31, 27, 44, 49,
+    26, 26, 26, 27, 34, -47, -44, 25, -27, -26, -27, 25, -29, 35, 52, 26,
+    42, 39, 32, -28, -40, 26, 38, -37, 44, 39, 25, -34, 25, 48, 33, 37,
+    -33, -32, 42, 29, -43, 36, -26, -50, 28, -28, 31, -46, 30, 29, 35, -51,
+    34, 29, 27, -34, 27, -28, -33, 26, -30, -29, 30, 26, 25, 34, 32, -40,
+    -34, -44, -32, 27, 26, -44, 38, 25, -56, -30, 33, 44, -50, 45, -65, -29,
+    63, -36, -34, 28, -33, 28, 34, 31, 32, -38, -34, 58, -43, 26, 25, -39,
+    35, 41, 51, 31, -42, 29, -35, -43, -43, -31, -28, 36, -30, 28, 38, -26,
+    28, 30, -27, -25, -27, 36, -31, 29, 36, 28, -45, 30, -25, 43, 56, 47,
+    -30, 42, -30, -27, 25, 50, 35, 32, 39, 26, -27, 34, 30, 34, 29, 26,
+    31, 57, 36, 27, 38, 37, -31, 27, -35, -58, 27, 29, 72, -26, -25, -25,
+    -26, -26, -28, -28, 0, -25, -25, -28, -26, -25, -25, -29, -28, -27, -25, -26,
+    -25, -25, -26, -30, -25, -32, -35, -42, -28, -39, -28, -37, -52, -42, -40, -40,
+    -28, -58, -35, -42, -30, -35, -28, -29, -37, -29, -37, -33, 27, 42, -27, -40,
+    -32, -30, -50, -53, -39, -26, -34, 43, 36, -25, 25, 27, 27, 27, 45, -25,
+    -25, -41, -28, 57, 49, -29, 43, -27, -28, 69, 25, -28, -34, 34, -31, -26,
+    29, 38, 41, 29, -33, -36, -50, 25, 28, 69, -39, 47, 37, -36, -27, -39,
+    -25, 29, 71, -27, -33, -33, -32, 36, 29, -27, -27, -31, -35, -32, 26, 27,
+    -40, 35, 28, 58, -59, -29, 25, 30, 38, -29, 30, 25, 41, 33, 27, -26,
+    25, -57, 37, 49, 39, 53, 36, 26, 30, 29, 31, -30, 48, 44, 34, 30,
+    -44, -47, 25, 38, 29, 25, -30, 25, -30, 28, 57, -35, -26, 28, 25, 26,
+    33, -32, 34, 29, -27, -26, 31, 41, -31, 28, 41, -35, 27, -25, 36, -25,
+    38, -31, 27, -76, -38, 28, -27, -37, 41, -46, -34, -31, -33, -33, -25, -35,
+    -31, 31, -30, 51, 34, 36, 34, -49, 37, 33, -45, -31, -28, 29, -27, 31,
+    32, -29, 42, 28, 39, 34, -33, 28, 34, -42, -36, 53, 26, -28, 33, -27,
+    -45, 35, 25, -35, -28, -40, 32, -73, 36, 25, 26, -39, -44, 28, 37, -34,
+    39, -38, -29, 29, -35, -30, -28, -29, -29, -29, -26, -38, 25, 25, 27, -38,
+    -28, -26, 27, 36, 27, -57, -25, 28, -41, 37, -37, -33, -26, -27, 27, 56,
+    -27, 29, 28, 29, -35, -28, 31, 42, 53, 46, -45, -41, -30, 25, -53, 37,
+    40, -25, -30, 32, -29, 30, 26, 29, -60, 36, -25, -32, -30, 31, 31, -46,
+    -35, 25, 31, 27, -29, -27, -54, -27, 31, -28, -46, -40, -30, 26, -41, 33,
+    28, 30, 30, 59, 26, 28, 27, 30, -31, 27, 29, 41, 35, 45, -28, 30,
+    41, -25, 31, -35, 27, 27, 25, 36, 27, -45, 30, 29, 38, 25, 26, -36,
+    -28, 37, -33, 51, 31, 27, -27, -28, 32, -26, 27, -28, 26, 29, 36, -25,
+    -28, -47, -34, 55, -40, -26, -26, -27, 47, -31, -25, 28, 32, -34, 40, -33,
+    -37, 33, -33, 43, -32, -39, 46, -25, -28, 39, 32, 27, 44, -54, -29, 27,
+    34, 29, 27, -53, 28, -32, 27, 40, -44, -26, -52, -77, 41, 28, 26, -30,
+    25, -48, -63, -34, -66, 29, -25, -46, -45, -34, -30, 29, -44, -30, -28, -33,
+    -25, -33, -26, 37, -39, -37, 29, -39, -29, -50, 73, -37, 29, 28, 29, -35,
+    -31, 29, -36, 26, -27, -27, 41, 27, 42, -29, -30, 40, 32, -26, -36, 55,
+    40, -29, -30, 30, -50, 31, 25, 41, 30, 37, -29, 43, -28, -35, -29, 38,
+    32, -69, 27, 25, 105, 25, 40, 26, 28, 25, 31, 40, 51, -25, -49, 29,
+    -43, 51, 73, 27, 32, 37, -38, -36, -28, -57, 55, -58, -26, 35, -30, 27,
+    37, -79, -27, 25, 79, 59, 42, -29, 52, 30, 33, 26, 39, 28, 29, 36,
+    -34, -33, 37, 27, 31, 30, -31, 27, 25, 29, 34, 32, -29, 31, -25, 33,
+    27, 29, -28, -26, 31, 27, -29, 30, 34, -26, -55, 36, 45, -27, 44, 64,
+    -28, 39, 32, -39, -37, -53, 29, 30, -25, -28, 42, 32, 28, 29, 68, 30,
+    31, -55, 31, -28, -37, -30, -35, -32, 29, 64, 31, -28, -50, -32, -39, 25,
+    -29, -28, -26, 39, -54, -31, -40, 52, 25, 25, -43, -28, -25, 25, 25, 28,
+    27, -31, 35, 29, 27, 39, 38, -28, 31, -45, 27, 37, 37, 33, -32, 27,
+    26, 40, 28, 37, 39, 56, 27, 26, 25, 38, 34, -26, 33, 41, 30, 26,
+    50, -45, 33, -25, 28, -31, 40, -49, 25, 29, 34, 45, 36, 35, -31, 31,
+    -46, 30, 42, -25, -26, 32, -38, 25, -30, -35, 41, -29, 27, -44, 34, 26,
+    29, 29, 31, 28, -40, -33, 28, -29, 32, 34, 34, 37, 27, 25, 31, 34,
+    33, 34, -26, 30, 36, 29, 26, -30, 34, -35, 39, 39, -32, 64, 30, -40,
+    29, -29, 51, 26, 52, 31, 33, 26, 37, 37, 34, 25, 27, 65, -28, 38,
+    52, -28, -29, 28, 26, 33, 29, 47, -33, -41, 37, 39, -37, -26, -40, 50,
+    44, -26, 30, 36, 37, 30, 26, -27, -59, -52, 36, 50, 42, 46, 35, 34,
+    32, 28, -31, 34, -36, 28, 49, -54, 32, -29, 34, 36, -37, -60, -34, 37,
+    58, -47, 25, 28, -53, -31, 30, 39, 64, 49, 39, 61, -39, 66, -39, 54,
+    -27, 59, -28, -32, -25, 44, 39, 30, 60, -37, 37, 25, 35, 41, -67, -35,
+    -32, -34, 31, 34, 25, -44, -34, -28, -41, 25, 29, 42, -45, -33, -28, -36,
+    25, -27, -31, -29, -48, -96, -25, -29, -32, -26, 34, 34, -32, -41, -29, -41,
+    -25, 31, -30, 32, 29, 34, 29, 28, 28, 27, 28, 39, 34, 39, 26, 38,
+    -35, 28, -39, -33, -30, 49, -42, 31, 52, 33, 25, -45, 28, 30, 28, -42,
+    43, -39, 30, -58, 40, 33, -33, 29, -27, -37, 46, -58, -35, -27, 30, 40,
+    -40, -25, 32, -32, -27, 41, 29, 27, 43, -36, -82, -56, -39, -27, -55, -27,
+    45, 30, 28, -26, -34, 59, 34, -62, -59, 32, -31, -32, -32, -26, -50, 33,
+    45, 34, -60, -47, -40, 51, 28, 53, 25, 25, 35, -37, -41, 27, -25, -26,
+    67, -32, -42, -43, -30, -38, 44, -49, 69, -35, 31, 36, -26, 26, 47, 34,
+    -32, 29, 35, -39, 32, 26, -29, 29, -25, 26, 26, 35, -33, -30, 48, 41,
+    -65, -36, 53, 25, 32, -31, -55, -27, -36, -49, 27, -60, -46, -28, -27, 39,
+    -25, -39, -33, -38, -34, 29, -48, -31, -31, 28, 26, -32, 37, -30, 30, -39,
+    -52, -60, -33, 28, 28, 57, -35, -34, -48, -33, -38, 43, 38, 32, 28, -30,
+    -45, 42, 42, -45, 29, 28, 44, 50, 27, -48, -25, 27, -37, -38, 52, -49,
+    -27, -30, 37, 27, 33, -32, -38, -47, 36, -27, -46, 38, 55, 31, -26, -62,
+    -38, 29, -34, 45, -26, 34, -68, -62, 44, -30, -33, -45, -62, 60, 55, 31,
+    -34, -26, -79, 60, 25, 46, 38, 26, -40, -43, -26, 26, 26, -33, 30, 50,
+    35, 27, 29, -68, 26, 43, -27, 28, -25, -27, 32, -30, 44, -26, -25, -32,
+    -35, -55, 38, 27, -52, 26, 30, 31, -33, 28, 31, 56, -36, 26, -36, 50,
+    28, 48, -42, 39, 40, -38, -35, 31, 44, -34, -26, 28, -28, -26, 26, 50,
+    26, 33, 35, -52, 48, 42, -40, 35, 30, 53, 30, 36, 42, -35, -28, 26,
+    -27, 27, -42, 41, 36, 40, 48, 25, 32, 27, 37, 33, 44, -50, 34, 32,
+    27, 36, 35, 31, 27, 33, 37, 52, 49, 43, 26, 53, 25, 34, 27, 31,
+    93, 46, 27, 31, 40, 25, 39, 29, 31, -27, -27, 29, 29, -28, 34, 32,
+    34, -29, -27, -32, 26, -37, -45, -45, -33, 34, 26, -26, 30, -26, 74, 30,
+    -29, 38, 33, 41, 46, 27, 39, 44, 64, -43, -46, 33, 28, 40, 27, 51,
+    -48, -25, 51, 37, -28, -27, 34, 44, 58, -58, -36, -28, 26, 31, -42, -35,
+    36, -35, 46, 52, -51, -30, -60, -32, 57, 39, -44, 28, -38, 29, -25, 40,
+    29, -32, -71, -41, -55, 26, -67, -68, -26, -27, 25, -44, 41, 27, 44, -41,
+    -33, -53, -26, -31, -35, -28, -60, -47, -34, -27, -26, -30, -33, -63, 26, 27,
+    27, -25, -29, 26, -26, -28, -50, -29, 28, -39, 26, 35, -53, -38, -43, -33,
+    59, 38, 33, 42, -25, 58, 25, 28, 25, 39, 54, 33, -62, 65, -42, -35,
+    -47, -26, -26, -32, 63, -25, 50, -29, -30, -28, -33, -32, 44, 26, 77, 48,
+    -27, -39, -32, -43, -36, -28, -34, -30, 43, -62, -43, -42, 61, 31, -35, 32,
+    33, -38, -40, -40, 28, -26, 44, -79, -41, -36, -41, -38, -34, 30, 33, -42,
+    25, -31, 35, 44, 25, -32, -33, 27, -33, 44, -75, -53, -42, 27, 27, -33,
+    -40, 39, 26, 48, -34, -33, 25, 39, 31, 42, 28, 30, -37, -27, -33, -43,
+    33, 32, -30, 39, 33, 41, -29, -42, 37, 32, 37, -27, 38, -33, -44, 48,
+    67, -46, 28, -53, -46, -44, -33, 42, -28, -31, 33, 33, 25, 27, 28, -41,
+    -25, -28, 26, 43, 31, 40, -25, -34, 42, 47, 41, 30, 50, 56, -30, 57,
+    -61, -31, -34, 32, -36, -38, -42, -29, -40, 32, 35, -31, 26, 43, 43, 26,
+    26, 38, 30, -58, -30, 57, -31, 42, -26, 41, 33, 44, 33, -50, 25, -40,
+    -30, -43, 34, 31, 46, 25, -51, -39, 40, -42, 31, 28, 27, 33, 25, -61,
+    55, -43, 25, -46, 36, 26, 33, 30, 33, 39, -38, 29, -26, -40, -29, -35,
+    -33, -27, -27, -37, -41, -29, -28, -32, -26, -26, 30, 28, -34, 25, 33, -51,
+    43, -25, -35, -30, -48, 42, 42, 27, 49, -37, 41, -32, -35, -30, 30, -30,
+    25, -25, 34, -29, -30, -27, -27, 39, -42, 32, -30, -44, -25, -44, -28, -34,
+    -26, 33, -35, -25, -29, -31, -66, 25, -27, -57, -41, -27, 26, -35, -39, 29,
+    36, 35, 27, -26, 26, 39, 40, 29, 38, 27, 50, -32, -87, 25, 26, 25,
+    29, 42, 32, 51, 45, -53, 46, 25, -59, 29, 28, 27, 72, 30, 27, 59,
+    -30, 28, 32, 45, -25, 43, -26, 63, -30, 60, 41, -32, -26, 35, 31, -26,
+    29, -26, 26, 34, 31, -36, -49, 26, 45, 49, 32, 25, -28, 31, -31, 35,
+    -36, 38, 30, -53, 35, 43, -29, -28, -34, 29, -32, 32, 42, -26, 31, 41,
+    38, -33, -27, -38, -31, -26, 32, -25, 34, -61, 58, -28, 39, 40, -35, 33,
+    -32, -37, -25, -31, 34, -26, -27, -25, 27, 49, -57, 26, -28, -35, 31, 38,
+    31, 28, 28, -34, -29, -43, -25, -38, -46, 31, -26, -41, 39, -28, 33, 31,
+    34, 33, 34, 27, 48, -31, -27, -26, -63, 35, -27, -40, 42, 25, 32, -26,
+    34, 29, 25, -27, 33, 29, 28, 29, -35, -32, 36, 35, 26, 41, 28, -58,
+    28, 43, 27, 28, -52, -44, 74, 27, 41, -68, -40, 61, 38, 26, -67, -25,
+    28, 34, 26, -70, -26, -47, 26, -47, -26, 31, 33, 36, 37, 27, -44, 30,
+    35, 30, -69, 35, -66, -39, -54, 33, -60, -54, -68, 25, 38, 27, -53, -62,
+    -43, 39, -69, 53, 37, 72, -54, 36, 88, -41, 25, 28, 33, 35, -63, 77,
+    -45, -47, 52, -31, -33, -34, 42, 25, -41, -30, -64, -31, 33, 30, 25, -25,
+    -41, -26, 30, -30, -30, 29, 27, 37, -31, 31, -30, -25, -34, 29, 30, 34,
+    44, 29, 26, -25, 30, 34, 33, 26, 26, 30, 39, -26, -27, -42, -43, -33,
+    -31, -36, 36, -55, -27, 28, -65, 25, 25, 25, 30, 33, 51, -33, -42, 26,
+    35, 32, 30, -43, 33, 31, 25, 43, 30, 34, -26, 27, -30, 49, 27, 30,
+    46, 25, 26, -26, -28, 30, -26, 40, 48, 27, 35, 36, 30, 36, -26, 54,
+    25, 38, 46, 31, 35, 49, 28, 47, 73, 33, -42, 55, -38, -37, -27, 53,
+    -66, 69, -25, -30, -29, -33, -33, -25, -37, 36, -32, -30, -50, -31, -26, -28,
+    -28, -37, -51, -60, -29, -26, -32, -29, -49, -38, -25, 31, -25, 33, 32, -25,
+    -38, -43, 49, 32, 29, 30, -37, 38, 40, 26, 25, 27, 28, -50, 33, 31,
+    34, -28, 38, 45, 30, -27, 33, 30, 25, 42, 30, 26, 34, -25, 37, -28,
+    35, 27, -33, -27, -31, -29, -42, 31, 31, 28, -29, -47, -35, -36, 37, -44,
+    -25, -34, -26, 45, 26, -36, -45, -30, -27, -77, -26, -27, 36, 26, 31, 30,
+    -25, 36, -31, 36, 33, 28, 35, 26, -39, -29, -26, 31, -33, -31, -48, -41,
+    42, 34, -27, -39, 28, -35, 33, 25, -26, 32, 33, -31, 25, 36, 31, 32,
+    37, 42, 44, 35, 31, 33, -32, -35, 40, -43, -30, 28, -55, 39, -56, -26,
+    -30, 31, -30, 30, -26, -45, 48, 58, 37, -41, 26, -29, 29, 71, 28, 27,
+    36, -32, -58, 26, -51, -28, 27, -36, -58, -33, 25, -51, 37, -30, -28, 25,
+    -39, -46, 33, 27, -57, -27, -28, -26, 27, 29, -63, -25, -39, 50, 27, -32,
+    -44, -29, -28, -33, 25, -25, 28, 35, -30, 46, 26, 26, -31, -55, -26, 34,
+    63, 25, -28, -32, 29, 36, 30, 33, 65, 27, 32, -39, -38, 37, 30, -32,
+    25, -50, -57, 32, 30, 30, -39, 32, 26, 26, 27, 35, 57, 31, -38, 47,
+    -53, 27, -59, 30, 39, -53, -30, -47, 32, 39, -40, -34, -54, -47, 40, 26,
+    67, -28, -28, 47, 33, 28, -33, -26, -31, -33, -37, 26, 27, -33, -31, -40,
+    37, 59, -49, 26, 25, 52, -26, 37, -36, -25, -25, 34, 25, -34, -29, -30,
+    29, 26, -34, 25, -35, 27, 40, 37, 25, -51, -67, -26, -32, 27, 32, 35,
+    26, -30, 35, -26, 28, -32, 30, 32, -33, -25, -26, -61, -29, 27, 31, 25,
+    27, -26, 57, -32, 30, -37, 29, 34, 31, 43, 25, -50, 37, 26, -39, -29,
+    26, 28, 33, 25, 37, 42, -27, -30, 32, -45, 28, 30, -33, 28, 29, 26,
+    27, 26, 46, 30, -45, 27, -32, -33, -58, -52, 26, 42, -65, -25, -27, 25,
+    33, 42, -30, -46, -29, -26, 31, 39, -28, -26, -26, -34, -26, 27, 29, 30,
+    -28, 41, -37, -25, -40, 37, 25, 36, -26, 28, 38, 30, -32, 26, -33, -39,
+    26, 28, 28, -27, 27, -57, -49, -35, 25, 50, -27, -28, -37, 25, -41, 52,
+    31, 28, 25, -38, 40, -54, 29, 27, -39, 31, 34, -46, 25, 31, -30, 37,
+    -43, 25, 33, -30, -36, 27, 58, 37, -32, -29, 26, -27, -30, -27, -57, 26,
+    51, -28, -46, -28, 28, 55, -27, -27, -25, -28, 33, -25, -35, -43, 29, 32,
+    -31, 25, 50, 52, -47, -26, -58, 29, 34, -35, -36, -38, -31, 49, 29, -46,
+    28, -66, -57, 33, 38, -29, -82, 33, 46, 74, 38, 53, -39, -25, 29, 25,
+    45, 27, -25, -33, 31, -39, -26, -26, -34, 58, -27, 29, 66, 40, 26, -52,
+    -26, -58, 38, -59, 67, -29, -31, 33, -39, -30, -88, 91, 74, -26, 35, -30,
+    -38, 70, -27, 38, 26, -29, -43, -25, -25, -60, 51, 28, 43, 57, 38, 66,
+    45, 25, -25, 40, 28, 30, 31, 29, 43, -27, 27, -25, -27, -35, 29, 27,
+    -29, -50, -41, 26, 25, 35, -61, -28, 34, -29, -54, -40, 35, -34, 60, 49,
+    39, -60, -27, 26, -32, 29, 27, 50, 26, -27, -56, -49, 27, 26, 33, -32,
+    -42, -32, 51, -30, -42, -69, -26, 74, 27, 45, -33, -39, 25, -29, 30, -29,
+    -42, -37, -54, -36, -28, -35, -41, 26, 32, -49, 25, -44, -26, 31, -39, 28,
+    -28, -39, 39, 35, 31, 42, 31, 27, 33, 31, -26, 43, 34, 30, -27, 35,
+    35, 28, -32, 42, 44, 66, -26, 46, 26, 42, -45, 30, 29, -32, 32, -35,
+    51, 41, -46, 26, 33, 37, 29, -32, 51, 31, 28, -25, -37, -25, 35, -38,
+    -63, -26, -32, -28, 32, -25, -34, -30, 39, -37, -39, -39, 27, 26, 32, 39,
+    44, 28, 27, -33, -35, 38, 39, -25, 28, 29, 36, 28, 30, 36, 27, 36,
+    40, 27, -38, 41, 33, -26, -37, 25, -33, -38, 28, 29, 42, -26, 57, 26,
+    -28, -25, 30, 29, 32, -27, 37, -40, -30, -30, -39, -41, -26, -48, -27, 36,
+    38, 28, 42, -35, -26, -30, -59, 34, -27, -25, 27, -28, 37, 31, -25, -40,
+    28, 29, 25, -29, -33, -67, 32, 28, 36, 35, 56, 43, 34, -27, -34, 76,
+    27, -45, -33, 52, -25, -47, 34, 27, 26, -32, 25, 32, 37, 33, -28, 35,
+    40, 25, 30, -39, 34, 35, -55, -45, -41, 31, 32, -25, -25, -46, 30, 31,
+    -34, -45, 27, -41, -40, -55, 29, 49, -84, 26, -26, -40, 45, -32, 40, -29,
+    -36, -30, 89, 37, 29, -40, 26, 41, 46, 38, 25, 27, -26, 54, 36, 38,
+    41, 38, 27, -40, 26, 38, -32, -46, 52, 45, 41, 31, 35, 67, 36, -59,
+    -28, 31, 26, 45, -35, 28, 30, 33, 29, -43, 45, 49, 26, 27, -34, 28,
+    29, 37, -49, -26, -32, 33, 28, -47, 26, -27, 43, 60, 26, 25, -30, -37,
+    -39, -32, -25, -41, -33, -31, 34, 31, 27, -40, -28, -33, 58, -27, 47, -62,
+    37, -28, 39, -56, 27, 54, 39, -71, 34, -25, 76, 28, 32, -34, 29, 35,
+    -33, 26, 33, -43, 33, 71, -31, 78, -57, -71, 29, 44, 43, 31, 25, -66,
+    58, 31, -41, 25, 29, 30, -39, -38, 26, 25, -26, -32, 29, 26, -25, 38,
+    29, 29, 25, 26, 32, -26, -43, 26, 32, 31, 33, 33, -46, 30, -29, -25,
+    -27, 33, -43, -30, 34, -30, 26, -27, -26, 25, 26, 72, 34, -27, 34, -26,
+    25, 40, 29, 29, 32, -59, -31, 25, 26, -28, -28, -38, 26, -29, -30, -26,
+    -30, -35, 34, -32, 29, 31, -48, 33, 28, 27, -44, 42, 36, 42, 25, -26,
+    39, -32, 26, -36, -32, 34, 49, 40, 35, 27, 29, 27, 42, 31, 28, 30,
+    -28, 27, 25, 27,
+};
+static const uint8_t op_4_col_steps[40980] = {
+    1, 2, 1, 4, 2, 1, 4, 1, 2, 6, 8, 1, 1, 2, 2, 3,
+    2, 6, 3, 1, 3, 1, 1, 1, 1, 2, 4, 2, 1, 1, 5, 1,
+    1, 1, 1, 1, 1, 5, 5, 2, 4, 3, 1, 4, 1, 2, 5, 3,
+    3, 6, 2, 4, 3, 4, 14, 2, 3, 1, 2, 3, 4, 5, 4, 1,
+    4, 7, 4, 1, 1, 6, 3, 6, 1, 1, 8, 3, 4, 3, 7, 2,
+    1, 2, 3, 2, 5, 1, 1, 2, 1, 5, 1, 2, 1, 2, 1, 4,
+    1, 6, 1, 1, 1, 11, 1, 2, 3, 1, 2, 4, 3, 2, 6, 1,
+    1, 1, 1, 2, 9, 1, 1, 2, 2, 3, 4, 1, 3, 1, 2, 5,
+    2, 1, 4, 1, 10, 5, 2, 3, 2, 6, 1, 2, 1, 5, 1, 1,
+    1, 1, 1, 4, 4, 6, 2, 4, 9, 2, 3, 1, 1, 1, 2, 2,
+    2, 1, 1, 1, 4, 2, 3, 2, 1, 1, 1, 1, 1, 3, 3, 3,
+    1, 1, 5, 3, 5, 5, 1, 1, 1, 2, 7, 2, 2, 1, 1, 2,
+    1, 4, 6, 1, 2, 3, 3, 1, 2, 5, 1, 1, 2, 2, 1, 1,
+    5, 2, 4, 1, 4, 1, 3, 5, 3, 1, 1, 8, 5, 8, 2, 1,
+    2, 1, 2, 1, 3, 3, 1, 2, 2, 1, 3, 2, 3, 2, 6, 2,
+    1, 1, 6, 1, 1, 2, 1, 9, 4, 3, 5, 1, 5, 1, 5, 3,
+    1, 2, 2, 3, 2, 2, 1, 3, 3, 6, 2, 3, 5, 6, 2, 1,
+    1, 1, 1, 4, 4, 2, 1, 1, 3, 4, 1, 2, 5, 2, 5, 2,
+    7, 2, 4, 2, 1, 1, 3, 4, 3, 9, 1, 3, 2, 3, 7, 1,
+    13, 1, 9, 3, 8, 1, 2, 8, 6, 8, 5, 5, 3, 5, 3, 1,
+    5, 4, 3, 2, 6, 6, 5, 3, 7, 11, 3, 1, 3, 1, 1, 4,
+    1, 3, 2, 5, 4, 1, 1, 1, 1, 4, 3, 5, 7, 1, 1, 2,
+    1, 3, 2, 3, 1, 2, 6, 3, 1, 1, 2, 1, 1, 1, 2, 1,
+    2, 1, 4, 2, 2, 2, 2, 2, 2, 3, 2, 1, 1, 1, 1, 1,
+    1, 1, 6, 1, 8, 2, 2, 14, 1, 1, 6, 3, 2, 2, 3, 2,
+    2, 2, 2, 2, 4, 4, 2, 1, 2, 1, 1, 5, 4, 1, 1, 1,
+    6, 12, 1, 4, 3, 9, 6, 3, 1, 6, 2, 4, 3, 1, 1, 3,
+    1, 1, 4, 1, 17, 2, 5, 2, 4, 5, 4, 1, 2, 2, 4, 1,
+    2, 2, 9, 4, 1, 4, 6, 1, 3, 5, 4, 4, 2, 4, 9, 5,
+    5, 1, 2, 2, 2, 3, 1, 1, 2, 4, 8, 1, 1, 4, 2, 1,
+    5, 1, 2, 3, 1, 2, 1, 2, 2, 2, 2, 2, 5, 3, 2, 4,
+    2, 2, 3, 1, 4, 5, 3, 5, 1, 4, 10, 8, 5, 4, 7, 3,
+    1, 4, 3, 2, 1, 3, 2, 4, 2, 1, 8, 2, 1, 1, 16, 3,
+    1, 12, 1, 5, 5, 1, 7, 8, 3, 3, 2, 2, 3, 1, 2, 3,
+    1, 11, 5, 2, 1, 1, 1, 4, 5, 8, 2, 1, 1, 3, 1, 1,
+    2, 1, 2, 1, 2, 1, 2, 2, 3, 1, 8, 2, 1, 1, 1, 3,
+    2, 1, 3, 1, 3, 1, 1, 6, 2, 2, 1, 2, 4, 4, 3, 9,
+    1, 1, 11, 9, 3, 7, 1, 3, 1, 1, 6, 8, 3, 1, 2, 4,
+    19, 2, 2, 4, 1, 10, 1, 6, 13, 4, 1, 3, 2, 4, 6, 5,
+    2, 8, 3, 12, 8, 1, 1, 9, 2, 3, 4, 3, 1, 6, 4, 8,
+    1, 7, 1, 5, 2, 1, 1, 1, 2, 4, 2, 3, 9, 2, 14, 2,
+    2, 6, 2, 2, 2, 6, 3, 2, 6, 14, 1, 2, 2, 16, 4, 1,
+    1, 3, 5, 1, 4, 1, 2, 2, 5, 9, 2, 2, 5, 17, 5, 10,
+    5, 1, 2, 1, 1, 1, 7, 1, 2, 6, 14, 2, 6, 2, 4, 1,
+    2, 1, 4, 2, 4, 2, 1, 2, 4, 6, 1, 10, 3, 1, 5, 8,
+    1, 5, 2, 6, 1, 2, 3, 1, 10, 2, 3, 5, 1, 4, 1, 2,
+    3, 9, 4, 1, 1, 3, 5, 3, 1, 1, 2, 2, 1, 3, 2, 4,
+    1, 4, 2, 1, 1, 6, 4, 3, 6, 5, 2, 1, 1, 3, 5, 4,
+    3, 5, 1, 2, 4, 1, 1, 3, 1, 3, 5, 1, 6, 1, 18, 2,
+    1, 2, 15, 5, 5, 6, 10, 2, 3, 1, 11, 1, 1, 8, 1, 4,
+    1, 7, 2, 7, 4, 6, 2, 3, 5, 4, 2, 5, 2, 3, 2, 2,
+    3, 4, 4, 1, 1, 5, 2, 3, 1, 1, 4, 3, 2, 2, 1, 2,
+    1, 2, 2, 1, 5, 3, 5, 6, 2, 4, 1, 1, 3, 2, 1, 1,
+    3, 4, 2, 2, 3, 10, 4, 8, 2, 5, 1, 4, 1, 3, 1, 7,
+    6, 3, 5, 4, 2, 2, 10, 2, 1, 2, 8, 5, 2, 7, 1, 4,
+    1, 4, 1, 8, 1, 2, 11, 4, 5, 6, 5, 2, 4, 1, 6, 12,
+    5, 1, 4, 9, 3, 4, 8, 2, 7, 2, 5, 1, 2, 1, 2, 12,
+    13, 2, 5, 6, 1, 15, 5, 1, 1, 2, 4, 2, 5, 1, 2, 2,
+    4, 3, 1, 7, 1, 8, 9, 1, 15, 4, 5, 2, 7, 6, 12, 11,
+    2, 4, 6, 4, 6, 2, 8, 2, 3, 3, 7, 3, 10, 7, 1, 11,
+    1, 5, 4, 11, 1, 11, 3, 7, 6, 16, 7, 1, 13, 8, 9, 15,
+    1, 7, 1, 11, 9, 10, 4, 1, 2, 9, 15, 7, 5, 11, 10, 4,
+    5, 1, 1, 2, 1, 2, 11, 6, 7, 2, 1, 2, 1, 18, 3, 7,
+    8, 3, 4, 6, 1, 8, 3, 3, 9, 2, 9, 5, 3, 1, 3, 2,
+    5, 2, 4, 5, 1, 6, 1, 6, 1, 3, 5, 2, 4, 1, 2, 1,
+    1, 1, 1, 3, 1, 1, 3, 2, 10, 2, 1, 2, 1, 1, 1, 3,
+    2, 6, 3, 3, 7, 8, 2, 2, 1, 9, 1, 4, 4, 2, 8, 3,
+    4, 11, 13, 1, 29, 2, 3, 4, 13, 7, 5, 3, 2, 3, 3, 4,
+    1, 2, 1, 6, 1, 4, 1, 5, 7, 2, 3, 2, 2, 14, 2, 7,
+    6, 4, 13, 7, 7, 4, 3, 8, 1, 4, 4, 4, 2, 2, 3, 2,
+    4, 5, 6, 10, 8, 8, 11, 5, 1, 3, 1, 4, 3, 1, 4, 6,
+    3, 4, 6, 17, 13, 3, 11, 10, 1, 11, 1, 9, 3, 2, 7, 4,
+    2, 1, 4, 2, 3, 5, 6, 1, 2, 1, 2, 21, 10, 1, 10, 1,
+    15, 4, 2, 14, 1, 4, 11, 2, 3, 6, 11, 29, 2, 7, 8, 7,
+    10, 22, 9, 4, 15, 6, 7, 6, 16, 8, 4, 1, 3, 8, 8, 6,
+    1, 4, 2, 2, 2, 2, 2, 9, 8, 2, 5, 15, 3, 4, 5, 3,
+    5, 8, 11, 3, 8, 7, 12, 10, 3, 10, 4, 6, 5, 16, 1, 4,
+    5, 1, 2, 1, 8, 3, 6, 11, 12, 2, 8, 4, 1, 12, 3, 2,
+    2, 18, 4, 2, 4, 2, 2, 9, 4, 1, 3, 2, 1, 1, 2, 6,
+    2, 1, 2, 5, 3, 2, 6, 23, 9, 6, 1, 6, 2, 1, 16, 9,
+    9, 3, 2, 5, 9, 7, 2, 6, 1, 18, 4, 5, 1, 15, 5, 1,
+    7, 5, 6, 1, 1, 7, 6, 3, 7, 1, 2, 1, 3, 1, 2, 1,
+    4, 1, 5, 1, 11, 6, 1, 2, 5, 7, 5, 2, 3, 1, 5, 9,
+    7, 4, 2, 22, 12, 17, 23, 9, 11, 18, 4, 1, 4, 8, 4, 3,
+    1, 6, 2, 21, 6, 2, 5, 4, 1, 8, 2, 1, 6, 2, 6, 10,
+    9, 1, 7, 1, 1, 11, 3, 4, 2, 3, 2, 1, 2, 3, 2, 2,
+    2, 2, 2, 4, 2, 1, 3, 2, 1, 4, 4, 2, 6, 4, 1, 1,
+    2, 1, 2, 4, 1, 2, 3, 2, 1, 4, 1, 2, 2, 1, 2, 4,
+    8, 11, 1, 2, 2, 1, 2, 1, 2, 2, 6, 1, 4, 3, 1, 3,
+    2, 3, 2, 8, 6, 5, 1, 3, 1, 1, 4, 1, 5, 4, 1, 19,
+    4, 1, 2, 1, 12, 1, 4, 7, 7, 1, 4, 1, 1, 2, 1, 1,
+    8, 1, 3, 6, 4, 3, 1, 1, 1, 5, 4, 1, 2, 11, 1, 2,
+    3, 2, 1, 2, 1, 2, 8, 1, 2, 3, 4, 3, 2, 3, 10, 8,
+    2, 1, 2, 5, 1, 1, 1, 3, 1, 2, 7, 2, 1, 3, 2, 10,
+    4, 4, 2, 3, 1, 5, 6, 1, 10, 9, 2, 9, 5, 3, 3, 5,
+    12, 1, 9, 3, 6, 13, 1, 1, 7, 5, 1, 6, 7, 1, 7, 1,
+    3, 2, 2, 4, 1, 2, 6, 1, 12, 6, 8, 1, 1, 1, 4, 2,
+    13, 3, 6, 3, 2, 4, 6, 2, 1, 1, 5, 7, 3, 1, 11, 5,
+    5, 2, 4, 2, 3, 1, 16, 28, 7, 1, 2, 2, 9, 9, 19, 6,
+    17, 3, 2, 10, 12, 8, 35, 2, 13, 3, 2, 4, 2, 2, 7, 2,
+    3, 6, 7, 4, 3, 2, 4, 19, 3, 13, 19, 1, 4, 1, 88, 4,
+    2, 22, 7, 20, 3, 9, 7, 19, 32, 17, 20, 7, 4, 31, 4, 2,
+    2, 50, 68, 24, 18, 27, 60, 5, 10, 6, 23, 33, 16, 15, 17, 9,
+    20, 6, 18, 25, 14, 2, 51, 3, 9, 49, 20, 43, 35, 26, 47, 10,
+    5, 26, 3, 14, 6, 4, 1, 22, 80, 23, 3, 11, 7, 21, 79, 9,
+    29, 2, 16, 48, 49, 4, 63, 1, 8, 2, 4, 2, 9, 5, 9, 3,
+    1, 1, 2, 6, 1, 2, 1, 2, 1, 4, 1, 3, 7, 6, 6, 10,
+    4, 1, 12, 3, 10, 1, 6, 3, 3, 1, 11, 3, 6, 1, 3, 4,
+    2, 1, 4, 2, 7, 9, 6, 3, 1, 14, 4, 2, 1, 1, 5, 4,
+    2, 10, 1, 1, 1, 2, 12, 1, 1, 2, 16, 7, 4, 1, 5, 9,
+    2, 7, 1, 4, 15, 3, 13, 3, 9, 22, 4, 3, 13, 8, 1, 17,
+    2, 11, 1, 3, 1, 7, 3, 3, 3, 1, 2, 4, 5, 1, 7, 2,
+    12, 5, 1, 4, 1, 1, 1, 2, 3, 4, 4, 2, 5, 3, 1, 12,
+    3, 6, 1, 2, 2, 3, 1, 2, 2, 7, 1, 3, 10, 10, 14, 5,
+    2, 2, 8, 5, 1, 1, 1, 6, 19, 2, 3, 11, 1, 1, 1, 2,
+    7, 12, 1, 11, 3, 7, 1, 2, 1, 6, 1, 4, 6, 7, 12, 10,
+    4, 1, 5, 13, 2, 1, 1, 5, 11, 3, 3, 8, 9, 3, 8, 11,
+    3, 1, 16, 5, 2, 2, 3, 3, 4, 11, 2, 6, 13, 9, 1, 2,
+    2, 2, 4, 1, 1, 8, 3, 12, 51, 3, 17, 1, 12, 2, 13, 1,
+    2, 4, 16, 3, 6, 5, 1, 1, 6, 15, 17, 3, 2, 23, 5, 3,
+    10, 1, 9, 6, 1, 4, 10, 5, 3, 2, 2, 4, 1, 5, 5, 5,
+    1, 3, 6, 1, 2, 3, 8, 9, 3, 1, 4, 3, 11, 11, 1, 4,
+    4, 7, 3, 17, 10, 13, 20, 26, 2, 4, 2, 1, 5, 2, 17, 2,
+    1, 2, 7, 5, 39, 2, 4, 3, 4, 2, 5, 1, 3, 1, 7, 11,
+    2, 1, 2, 8, 1, 5, 3, 1, 2, 1, 15, 7, 2, 7, 1, 1,
+    3, 10, 9, 3, 7, 6, 4, 8, 4, 8, 2, 19, 6, 4, 3, 6,
+    25, 5, 5, 1, 5, 1, 3, 2, 6, 8, 3, 6, 2, 8, 6, 8,
+    1, 4, 2, 3, 1, 5, 1, 1, 5, 2, 2, 1, 6, 2, 1, 4,
+    1, 1, 1, 2, 1, 5, 5, 2, 3, 3, 7, 2, 6, 1, 1, 4,
+    2, 2, 1, 13, 8, 1, 3, 4, 1, 2, 4, 1, 2, 1, 2, 1,
+    6, 2, 3, 1, 1, 1, 6, 7, 2, 1, 1, 7, 3, 1, 10, 5,
+    3, 5, 8, 3, 2, 4, 4, 5, 1, 3, 7, 3, 17, 3, 4, 2,
+    6, 2, 1, 9, 3, 1, 1, 1, 7, 4, 3, 2, 3, 12, 1, 1,
+    1, 9, 4, 1, 2, 2, 2, 5, 3, 5, 1, 1, 1, 1, 2, 1,
+    4, 1, 1, 5, 5, 2, 3, 1, 2, 2, 6, 2, 3, 2, 4, 4,
+    6, 2, 3, 1, 4, 2, 1, 1, 1, 2, 1, 1, 6, 1, 2, 1,
+    13, 3, 1, 3, 2, 1, 3, 3, 2, 3, 15, 1, 3, 3, 1, 8,
+    8, 4, 5, 3, 5, 1, 13, 3, 2, 2, 16, 1, 3, 1, 2, 3,
+    11, 4, 7, 6, 7, 8, 15, 1, 7, 2, 4, 1, 3, 8, 1, 8,
+    1, 1, 10, 1, 1, 2, 8, 1, 3, 2, 5, 2, 3, 6, 1, 1,
+    2, 1, 1, 2, 7, 12, 2, 5, 3, 4, 5, 7, 9, 11, 4, 1,
+    7, 4, 1, 4, 2, 2, 1, 1, 1, 2, 2, 1, 1, 1, 1, 10,
+    7, 1, 1, 4, 1, 1, 3, 6, 7, 1, 2, 2, 3, 9, 2, 1,
+    1, 2, 4, 1, 5, 8, 1, 1, 7, 3, 11, 5, 10, 5, 2, 6,
+    5, 7, 1, 4, 1, 2, 3, 10, 8, 8, 13, 1, 8, 1, 5, 1,
+    6, 2, 4, 10, 9, 4, 8, 1, 12, 9, 1, 4, 2, 14, 8, 39,
+    24, 1, 2, 13, 6, 12, 9, 1, 11, 12, 5, 10, 2, 10, 14, 11,
+    2, 13, 2, 3, 1, 10, 7, 4, 1, 2, 1, 1, 13, 7, 11, 11,
+    1, 3, 8, 3, 5, 16, 6, 6, 2, 1, 4, 1, 21, 1, 28, 2,
+    1, 5, 4, 24, 2, 10, 2, 1, 15, 4, 11, 3, 5, 6, 5, 12,
+    6, 2, 4, 1, 2, 3, 4, 11, 2, 3, 2, 16, 14, 5, 5, 6,
+    2, 1, 1, 1, 13, 3, 18, 1, 7, 3, 2, 3, 2, 8, 19, 2,
+    1, 2, 1, 7, 1, 5, 2, 4, 6, 4, 3, 2, 1, 5, 5, 1,
+    3, 9, 3, 4, 12, 1, 2, 3, 7, 6, 3, 6, 6, 2, 13, 1,
+    2, 2, 5, 5, 5, 4, 2, 10, 1, 2, 2, 1, 1, 6, 4, 13,
+    5, 3, 3, 1, 5, 4, 3, 3, 3, 2, 1, 2, 1, 4, 3, 2,
+    2, 5, 6, 4, 9, 1, 2, 7, 4, 3, 16, 5, 3, 3, 3, 7,
+    7, 2, 6, 7, 1, 6, 7, 6, 3, 2, 2, 6, 1, 15, 14, 11,
+    4, 19, 27, 1, 3, 3, 2, 14, 8, 4, 12, 10, 1, 4, 1, 2,
+    8, 5, 4, 4, 1, 1, 2, 1, 1, 2, 1, 1, 2, 2, 1, 6,
+    5, 2, 1, 5, 2, 6, 6, 14, 5, 1, 2, 2, 1, 17, 2, 2,
+    26, 2, 4, 5, 4, 18, 5, 2, 2, 9, 3, 7, 9, 27, 21, 3,
+    1, 17, 11, 4, 7, 14, 4, 5, 14, 9, 19, 4, 5, 11, 2, 1,
+    2, 21, 4, 2, 6, 1, 3, 5, 4, 4, 2, 1, 1, 8, 2, 2,
+    7, 7, 8, 6, 7, 1, 3, 2, 4, 1, 5, 3, 7, 1, 11, 3,
+    3, 1, 15, 13, 9, 2, 8, 3, 1, 12, 18, 6, 2, 4, 2, 15,
+    1, 2, 10, 18, 5, 16, 1, 8, 8, 3, 8, 19, 9, 8, 5, 1,
+    13, 2, 1, 5, 1, 5, 1, 4, 6, 1, 16, 2, 4, 5, 16, 9,
+    5, 3, 2, 10, 6, 8, 2, 1, 5, 7, 10, 11, 3, 8, 4, 6,
+    4, 5, 3, 21, 10, 4, 2, 8, 5, 3, 3, 26, 2, 4, 10, 6,
+    2, 8, 9, 11, 5, 5, 1, 2, 6, 10, 1, 2, 12, 3, 2, 1,
+    1, 12, 5, 3, 1, 2, 3, 9, 11, 2, 12, 4, 2, 3, 13, 3,
+    2, 2, 8, 10, 18, 1, 1, 2, 7, 2, 7, 2, 5, 1, 1, 1,
+    1, 3, 11, 1, 7, 1, 3, 3, 3, 8, 4, 2, 4, 3, 3, 7,
+    1, 2, 19, 1, 5, 3, 3, 5, 6, 3, 1, 2, 2, 2, 8, 1,
+    9, 6, 1, 1, 4, 5, 2, 2, 1, 2, 9, 7, 3, 11, 2, 2,
+    1, 3, 5, 8, 1, 3, 1, 3, 3, 1, 7, 1, 2, 1, 2, 4,
+    3, 3, 3, 2, 3, 1, 1, 1, 1, 5, 4, 3, 4, 1, 4, 2,
+    1, 3, 1, 4, 1, 2, 2, 3, 4, 5, 3, 2, 3, 1, 2, 1,
+    1, 2, 1, 7, 6, 5, 2, 3, 14, 2, 2, 9, 5, 4, 3, 3,
+    1, 5, 9, 2, 9, 9, 4, 1, 1, 4, 3, 1, 2, 6, 1, 1,
+    3, 17, 1, 3, 4, 2, 1, 9, 1, 3, 5, 6, 2, 1, 2, 8,
+    1, 1, 1, 3, 7, 1, 2, 3, 4, 1, 1, 1, 3, 6, 1, 4,
+    3, 6, 2, 2, 6, 1, 1, 3, 1, 12, 1, 3, 1, 2, 4, 4,
+    2, 2, 2, 1, 3, 3, 8, 2, 5, 7, 5, 3, 11, 5, 6, 2,
+    4, 3, 7, 5, 2, 2, 4, 3, 3, 1, 3, 2, 1, 2, 3, 1,
+    5, 1, 1, 1, 1, 11, 11, 6, 4, 2, 2, 3, 1, 1, 3, 8,
+    1, 9, 12, 1, 5, 10, 1, 6, 3, 3, 11, 3, 1, 4, 6, 2,
+    1, 2, 1, 10, 2, 5, 3, 2, 3, 14, 9, 4, 6, 2, 1, 1,
+    14, 11, 12, 7, 18, 4, 2, 1, 11, 8, 8, 1, 15, 15, 3, 2,
+    1, 6, 3, 16, 2, 4, 4, 8, 1, 3, 5, 3, 1, 2, 3, 3,
+    5, 1, 5, 6, 8, 2, 2, 14, 4, 3, 4, 1, 1, 2, 3, 7,
+    1, 6, 6, 4, 2, 2, 3, 9, 4, 7, 2, 1, 10, 1, 9, 12,
+    6, 3, 4, 13, 3, 11, 7, 4, 1, 4, 7, 1, 8, 4, 13, 6,
+    9, 11, 1, 1, 4, 4, 4, 5, 2, 5, 4, 11, 1, 2, 1, 6,
+    5, 1, 2, 2, 3, 2, 5, 3, 2, 3, 1, 4, 1, 1, 16, 4,
+    1, 3, 1, 1, 2, 3, 5, 1, 2, 2, 4, 2, 7, 4, 1, 2,
+    2, 1, 3, 3, 1, 1, 2, 5, 1, 2, 4, 1, 3, 4, 1, 22,
+    2, 2, 7, 2, 3, 15, 15, 6, 24, 1, 2, 7, 1, 13, 2, 1,
+    2, 22, 2, 1, 13, 22, 9, 17, 15, 8, 25, 5, 1, 12, 1, 6,
+    2, 4, 1, 3, 9, 6, 1, 4, 1, 2, 1, 8, 6, 2, 2, 6,
+    10, 5, 11, 3, 2, 1, 1, 10, 2, 3, 2, 4, 1, 1, 1, 1,
+    3, 2, 4, 10, 11, 5, 6, 4, 5, 2, 1, 1, 2, 3, 8, 10,
+    1, 3, 1, 2, 4, 3, 8, 8, 37, 19, 13, 3, 3, 2, 1, 3,
+    4, 4, 9, 4, 2, 2, 1, 9, 1, 5, 1, 1, 2, 4, 5, 21,
+    5, 10, 4, 36, 3, 2, 11, 17, 3, 2, 1, 6, 8, 3, 2, 10,
+    3, 3, 4, 1, 4, 2, 1, 10, 4, 3, 7, 1, 14, 3, 2, 3,
+    6, 4, 3, 4, 19, 2, 2, 14, 7, 3, 2, 3, 2, 5, 1, 10,
+    4, 1, 5, 3, 2, 2, 2, 8, 8, 4, 3, 4, 8, 7, 2, 1,
+    1, 6, 1, 4, 1, 1, 1, 3, 1, 2, 3, 1, 3, 13, 6, 4,
+    2, 10, 8, 3, 4, 1, 6, 3, 7, 8, 2, 16, 1, 9, 1, 12,
+    1, 1, 3, 5, 1, 2, 1, 9, 12, 10, 4, 9, 8, 3, 6, 18,
+    2, 8, 5, 3, 2, 10, 5, 5, 5, 7, 4, 18, 1, 1, 6, 1,
+    3, 2, 4, 1, 2, 1, 1, 2, 2, 3, 4, 1, 4, 1, 9, 4,
+    7, 4, 13, 1, 3, 4, 4, 5, 3, 1, 1, 1, 4, 4, 1, 1,
+    2, 1, 8, 3, 3, 15, 1, 3, 3, 2, 6, 15, 2, 5, 4, 10,
+    2, 1, 9, 5, 1, 4, 3, 1, 1, 3, 2, 8, 3, 1, 1, 10,
+    1, 10, 1, 16, 1, 1, 1, 2, 2, 4, 3, 1, 5, 3, 1, 2,
+    6, 1, 4, 1, 4, 1, 1, 1, 3, 6, 1, 1, 1, 1, 1, 1,
+    3, 1, 1, 4, 1, 4, 5, 1, 2, 20, 2, 5, 5, 2, 2, 4,
+    2, 7, 3, 1, 1, 2, 1, 2, 3, 2, 2, 1, 4, 4, 3, 5,
+    4, 3, 1, 2, 5, 3, 3, 2, 2, 4, 27, 2, 4, 6, 3, 3,
+    17, 10, 1, 1, 3, 3, 1, 10, 2, 11, 5, 1, 1, 11, 2, 2,
+    7, 4, 1, 4, 3, 10, 1, 1, 2, 5, 1, 1, 1, 2, 2, 2,
+    8, 2, 2, 1, 1, 2, 1, 1, 3, 3, 4, 2, 2, 6, 3, 1,
+    1, 3, 8, 2, 4, 6, 2, 5, 5, 4, 2, 5, 4, 7, 1, 2,
+    7, 1, 4, 11, 5, 11, 2, 4, 4, 4, 5, 9, 5, 2, 2, 3,
+    2, 6, 1, 1, 6, 2, 12, 1, 6, 4, 18, 3, 1, 3, 2, 5,
+    1, 17, 2, 6, 1, 1, 1, 1, 1, 3, 5, 3, 3, 3, 6, 1,
+    4, 1, 1, 1, 4, 1, 2, 2, 5, 6, 1, 3, 2, 1, 2, 5,
+    5, 5, 8, 6, 2, 2, 8, 7, 6, 1, 1, 4, 9, 3, 3, 13,
+    7, 2, 4, 4, 1, 21, 8, 8, 3, 4, 3, 5, 3, 3, 4, 2,
+    5, 3, 5, 5, 10, 11, 5, 3, 1, 2, 1, 6, 1, 1, 2, 8,
+    1, 5, 2, 3, 2, 2, 2, 2, 4, 1, 2, 1, 1, 3, 1, 1,
+    5, 4, 2, 2, 3, 3, 1, 3, 4, 3, 1, 3, 1, 2, 3, 1,
+    4, 1, 1, 1, 1, 5, 1, 1, 1, 2, 2, 3, 3, 1, 1, 1,
+    6, 1, 5, 1, 2, 1, 1, 2, 1, 1, 3, 2, 3, 1, 2, 2,
+    1, 1, 2, 1, 5, 2, 1, 3, 2, 2, 1, 1, 2, 1, 2, 4,
+    1, 3, 1, 2, 1, 2, 3, 1, 6, 1, 7, 1, 1, 3, 1, 1,
+    1, 5, 5, 1, 7, 1, 5, 2, 2, 3, 2, 2, 3, 1, 4, 3,
+    1, 1, 3, 4, 1, 1, 1, 4, 1, 1, 1, 3, 1, 3, 3, 1,
+    1, 1, 7, 7, 3, 2, 1, 3, 4, 4, 9, 1, 2, 1, 2, 3,
+    4, 1, 1, 2, 2, 1, 9, 1, 1, 3, 6, 1, 5, 1, 2, 3,
+    2, 1, 7, 4, 5, 3, 1, 1, 3, 1, 1, 3, 1, 2, 1, 1,
+    1, 1, 6, 1, 1, 1, 1, 2, 2, 1, 1, 2, 4, 2, 2, 2,
+    1, 1, 2, 2, 3, 1, 2, 2, 2, 1, 2, 2, 3, 1, 2, 1,
+    1, 2, 1, 1, 2, 4, 1, 3, 1, 2, 5, 1, 3, 1, 1, 2,
+    1, 2, 1, 2, 5, 2, 2, 6, 3, 3, 3, 6, 1, 4, 8, 1,
+    1, 3, 5, 1, 1, 4, 1, 3, 1, 2, 1, 2, 1, 1, 4, 1,
+    1, 2, 1, 1, 1, 1, 1, 1, 8, 1, 3, 1, 2, 5, 5, 1,
+    1, 2, 1, 1, 1, 6, 3, 2, 1, 2, 1, 2, 1, 1, 2, 1,
+    3, 1, 2, 1, 2, 1, 1, 3, 4, 2, 2, 1, 1, 2, 1, 2,
+    1, 1, 5, 2, 1, 5, 1, 1, 3, 3, 2, 3, 2, 1, 1, 8,
+    1, 1, 7, 1, 3, 3, 2, 1, 1, 1, 3, 4, 1, 1, 1, 2,
+    4, 5, 3, 2, 2, 2, 1, 2, 1, 1, 3, 3, 4, 3, 2, 3,
+    1, 10, 8, 2, 3, 1, 1, 1, 4, 1, 4, 2, 3, 3, 2, 4,
+    3, 4, 1, 1, 4, 1, 2, 1, 4, 3, 1, 1, 2, 1, 2, 1,
+    3, 2, 2, 7, 4, 1, 2, 4, 1, 3, 2, 1, 3, 5, 3, 4,
+    2, 1, 8, 7, 4, 2, 1, 3, 2, 2, 4, 1, 3, 2, 5, 2,
+    1, 1, 3, 1, 2, 1, 1, 1, 2, 3, 3, 2, 1, 1, 15, 4,
+    6, 1, 4, 2, 1, 2, 4, 1, 2, 1, 1, 2, 3, 3, 4, 2,
+    2, 1, 7, 2, 1, 3, 2, 2, 4, 1, 2, 6, 5, 1, 2, 1,
+    7, 1, 1, 1, 1, 9, 3, 2, 7, 4, 2, 2, 3, 2, 6, 1,
+    1, 2, 2, 5, 2, 1, 1, 3, 1, 2, 3, 5, 4, 4, 2, 2,
+    1, 1, 1, 2, 1, 5, 5, 5, 1, 2, 2, 10, 4, 1, 4, 2,
+    3, 4, 4, 4, 3, 4, 2, 2, 10, 6, 4, 7, 3, 2, 1, 2,
+    6, 1, 6, 1, 4, 4, 1, 1, 1, 2, 3, 1, 1, 1, 1, 2,
+    1, 1, 14, 1, 5, 2, 1, 2, 9, 1, 2, 13, 4, 2, 1, 2,
+    1, 3, 1, 1, 6, 4, 4, 11, 2, 5, 1, 1, 1, 1, 1, 1,
+    1, 1, 2, 1, 3, 5, 7, 4, 1, 4, 2, 3, 1, 5, 2, 2,
+    1, 1, 1, 3, 2, 1, 1, 3, 1, 2, 1, 3, 2, 1, 3, 1,
+    2, 4, 3, 5, 4, 1, 4, 3, 7, 2, 9, 1, 1, 2, 2, 1,
+    1, 1, 3, 4, 6, 1, 2, 6, 2, 2, 5, 6, 4, 2, 6, 4,
+    5, 5, 5, 2, 5, 2, 1, 2, 3, 1, 1, 1, 1, 1, 4, 2,
+    2, 2, 8, 1, 2, 3, 1, 1, 2, 1, 2, 2, 1, 1, 7, 1,
+    8, 2, 1, 7, 1, 4, 13, 10, 1, 1, 7, 3, 3, 1, 1, 3,
+    6, 1, 3, 1, 2, 7, 13, 6, 16, 13, 5, 1, 6, 3, 5, 2,
+    1, 1, 4, 6, 7, 2, 9, 1, 2, 1, 9, 2, 11, 3, 1, 5,
+    1, 5, 6, 14, 3, 19, 1, 2, 1, 5, 3, 13, 1, 4, 9, 3,
+    19, 4, 2, 2, 5, 14, 1, 8, 1, 2, 1, 2, 5, 4, 6, 8,
+    5, 9, 2, 19, 4, 3, 5, 3, 3, 4, 1, 8, 1, 4, 8, 2,
+    5, 1, 5, 1, 5, 7, 9, 7, 12, 1, 8, 3, 1, 5, 7, 1,
+    3, 1, 10, 6, 4, 4, 1, 4, 1, 1, 1, 6, 1, 4, 1, 1,
+    2, 6, 2, 1, 3, 4, 7, 3, 8, 1, 1, 1, 2, 3, 1, 6,
+    6, 1, 19, 3, 3, 5, 1, 10, 1, 14, 5, 1, 1, 2, 7, 1,
+    9, 6, 1, 1, 14, 14, 4, 4, 3, 9, 19, 26, 1, 3, 9, 1,
+    4, 10, 5, 10, 1, 3, 5, 2, 15, 1, 1, 5, 1, 2, 2, 10,
+    1, 1, 2, 3, 1, 3, 4, 1, 2, 1, 4, 2, 5, 8, 1, 5,
+    2, 4, 9, 2, 1, 2, 4, 7, 5, 4, 12, 4, 5, 1, 1, 7,
+    1, 6, 3, 13, 4, 4, 15, 12, 1, 4, 2, 2, 2, 4, 2, 26,
+    2, 4, 2, 1, 9, 30, 3, 3, 8, 9, 11, 8, 5, 2, 8, 1,
+    4, 22, 1, 9, 13, 8, 3, 5, 8, 2, 1, 11, 4, 3, 1, 9,
+    3, 5, 3, 2, 28, 3, 3, 9, 1, 3, 6, 10, 5, 6, 4, 1,
+    1, 4, 19, 8, 1, 10, 1, 15, 6, 1, 2, 0, 1, 1, 1, 1,
+    1, 3, 3, 4, 6, 3, 3, 2, 1, 1, 2, 1, 3, 6, 2, 3,
+    1, 1, 2, 1, 4, 4, 8, 1, 1, 1, 8, 29, 15, 8, 3, 8,
+    1, 16, 2, 8, 1, 1, 5, 1, 8, 6, 8, 3, 7, 8, 1, 5,
+    1, 5, 3, 1, 13, 5, 6, 7, 11, 1, 5, 7, 10, 6, 6, 4,
+    5, 5, 8, 3, 13, 2, 1, 5, 2, 2, 5, 7, 2, 1, 1, 3,
+    3, 3, 1, 2, 3, 3, 2, 1, 2, 5, 1, 5, 3, 3, 3, 1,
+    1, 4, 5, 2, 1, 1, 1, 3, 1, 6, 15, 3, 8, 7, 2, 3,
+    1, 7, 5, 3, 3, 2, 3, 1, 3, 6, 11, 5, 5, 3, 3, 1,
+    4, 9, 22, 5, 1, 1, 2, 2, 7, 1, 2, 2, 11, 1, 2, 6,
+    1, 1, 5, 1, 5, 2, 5, 2, 2, 4, 2, 2, 1, 8, 2, 3,
+    3, 4, 5, 2, 5, 6, 8, 1, 10, 6, 2, 5, 5, 5, 3, 3,
+    8, 8, 1, 1, 2, 7, 3, 5, 3, 6, 1, 8, 4, 17, 2, 2,
+    29, 9, 4, 2, 5, 1, 2, 14, 1, 10, 7, 2, 7, 5, 3, 10,
+    4, 2, 6, 1, 4, 1, 3, 2, 4, 1, 2, 5, 3, 2, 2, 5,
+    6, 14, 5, 12, 4, 9, 1, 9, 1, 5, 6, 14, 1, 6, 1, 5,
+    10, 1, 1, 4, 2, 11, 2, 4, 6, 3, 1, 5, 1, 4, 2, 3,
+    2, 5, 1, 1, 4, 3, 3, 3, 7, 1, 5, 1, 5, 9, 4, 9,
+    6, 2, 2, 4, 1, 1, 7, 1, 9, 2, 3, 4, 9, 3, 1, 1,
+    8, 4, 1, 4, 1, 1, 2, 4, 11, 8, 16, 7, 6, 3, 1, 3,
+    1, 3, 1, 2, 2, 7, 1, 11, 7, 4, 4, 3, 4, 3, 8, 3,
+    4, 1, 8, 5, 3, 6, 3, 8, 2, 14, 3, 3, 1, 9, 3, 6,
+    3, 7, 3, 4, 2, 6, 3, 9, 4, 2, 2, 4, 2, 2, 11, 7,
+    3, 3, 6, 4, 1, 7, 1, 2, 1, 3, 8, 3, 2, 4, 1, 9,
+    10, 2, 4, 2, 1, 12, 18, 3, 3, 9, 2, 6, 2, 8, 1, 29,
+    2, 5, 4, 2, 1, 10, 3, 8, 4, 4, 3, 2, 4, 11, 3, 7,
+    1, 12, 12, 17, 6, 6, 3, 9, 1, 1, 10, 1, 4, 13, 3, 4,
+    1, 8, 3, 2, 2, 7, 1, 8, 2, 14, 3, 1, 10, 5, 1, 7,
+    23, 11, 3, 2, 1, 3, 3, 27, 3, 1, 2, 5, 4, 16, 1, 1,
+    10, 4, 1, 13, 3, 4, 2, 2, 5, 17, 3, 5, 4, 5, 4, 1,
+    1, 2, 7, 3, 2, 3, 1, 1, 1, 1, 2, 8, 4, 10, 1, 5,
+    11, 1, 3, 2, 5, 4, 1, 11, 5, 3, 6, 2, 7, 14, 4, 15,
+    3, 5, 1, 1, 3, 10, 1, 1, 21, 7, 3, 1, 12, 1, 3, 4,
+    4, 9, 3, 2, 1, 4, 1, 4, 8, 6, 6, 9, 2, 2, 5, 8,
+    5, 5, 2, 5, 1, 1, 10, 1, 2, 1, 2, 3, 5, 1, 5, 2,
+    9, 5, 1, 1, 1, 1, 2, 2, 4, 4, 5, 2, 6, 2, 9, 17,
+    12, 2, 14, 2, 3, 6, 2, 2, 1, 4, 3, 2, 3, 1, 3, 2,
+    1, 6, 2, 1, 4, 2, 3, 13, 1, 3, 4, 3, 2, 4, 7, 6,
+    1, 3, 1, 13, 11, 6, 7, 7, 2, 1, 1, 1, 4, 3, 9, 8,
+    1, 17, 2, 2, 18, 3, 4, 4, 1, 10, 1, 8, 7, 6, 4, 2,
+    5, 5, 1, 10, 3, 3, 2, 1, 7, 4, 3, 14, 2, 4, 1, 4,
+    4, 2, 3, 7, 6, 7, 1, 2, 2, 14, 5, 2, 4, 1, 1, 3,
+    6, 2, 1, 1, 2, 11, 1, 2, 2, 3, 4, 1, 10, 2, 3, 2,
+    3, 5, 14, 4, 1, 7, 7, 3, 2, 1, 1, 16, 1, 6, 7, 3,
+    3, 4, 10, 1, 7, 4, 2, 1, 3, 4, 2, 5, 2, 2, 3, 6,
+    3, 1, 9, 1, 8, 9, 2, 14, 8, 14, 10, 6, 4, 1, 13, 7,
+    1, 10, 1, 1, 6, 11, 11, 4, 4, 6, 15, 3, 8, 12, 4, 3,
+    4, 3, 2, 15, 8, 3, 2, 6, 3, 6, 1, 4, 10, 1, 6, 4,
+    1, 2, 3, 5, 1, 1, 1, 2, 5, 2, 8, 6, 10, 6, 5, 10,
+    13, 9, 9, 11, 14, 5, 4, 1, 7, 3, 9, 7, 12, 3, 10, 19,
+    1, 1, 4, 2, 6, 9, 2, 2, 9, 7, 5, 10, 1, 5, 2, 8,
+    8, 9, 3, 5, 6, 1, 15, 1, 8, 1, 3, 4, 1, 2, 5, 1,
+    6, 16, 1, 1, 3, 1, 7, 5, 7, 5, 1, 1, 8, 1, 2, 2,
+    1, 2, 5, 4, 2, 1, 5, 6, 3, 5, 7, 1, 3, 3, 2, 1,
+    11, 2, 19, 8, 8, 2, 8, 3, 8, 16, 2, 2, 3, 3, 1, 4,
+    4, 1, 9, 3, 3, 16, 2, 1, 15, 1, 1, 1, 10, 1, 9, 4,
+    1, 2, 1, 2, 3, 1, 2, 1, 1, 10, 3, 5, 3, 10, 2, 1,
+    7, 1, 4, 1, 5, 2, 5, 10, 3, 7, 2, 1, 2, 9, 1, 2,
+    1, 3, 4, 1, 2, 1, 2, 4, 2, 2, 2, 4, 3, 16, 2, 1,
+    2, 2, 1, 1, 2, 1, 13, 5, 2, 5, 2, 5, 16, 3, 4, 1,
+    1, 11, 6, 11, 2, 19, 3, 6, 1, 3, 4, 6, 7, 1, 3, 1,
+    2, 4, 1, 7, 2, 7, 7, 2, 22, 5, 5, 6, 6, 2, 1, 4,
+    7, 6, 1, 3, 6, 5, 1, 19, 1, 3, 26, 1, 5, 3, 3, 1,
+    3, 1, 6, 2, 6, 1, 10, 5, 3, 2, 18, 3, 3, 6, 2, 2,
+    2, 21, 5, 1, 2, 7, 1, 6, 1, 1, 1, 3, 18, 1, 3, 2,
+    2, 2, 4, 1, 5, 1, 1, 1, 2, 8, 2, 1, 2, 4, 9, 2,
+    2, 1, 2, 18, 3, 17, 2, 1, 12, 2, 1, 3, 2, 1, 1, 3,
+    7, 2, 2, 1, 2, 9, 2, 3, 1, 3, 2, 4, 3, 7, 1, 2,
+    5, 5, 3, 1, 3, 2, 1, 10, 1, 14, 3, 1, 1, 1, 2, 2,
+    3, 4, 1, 1, 4, 7, 1, 1, 1, 1, 1, 3, 1, 1, 3, 1,
+    1, 4, 1, 1, 8, 2, 3, 1, 2, 1, 1, 6, 4, 4, 4, 2,
+    3, 6, 3, 12, 1, 1, 1, 4, 3, 2, 1, 1, 1, 3, 4, 9,
+    3, 9, 3, 8, 2, 3, 3, 2, 2, 1, 3, 3, 1, 2, 2, 5,
+    7, 4, 1, 2, 1, 8, 4, 6, 1, 7, 7, 10, 9, 1, 4, 2,
+    2, 3, 1, 4, 1, 1, 7, 1, 1, 2, 3, 2, 2, 4, 4, 6,
+    2, 13, 5, 2, 4, 1, 8, 16, 3, 1, 4, 4, 10, 3, 6, 1,
+    2, 3, 1, 5, 2, 2, 8, 1, 2, 6, 2, 1, 4, 1, 7, 3,
+    1, 1, 2, 2, 3, 1, 4, 1, 1, 1, 2, 11, 6, 4, 3, 2,
+    1, 1, 4, 2, 1, 8, 3, 4, 2, 3, 2, 1, 1, 3, 3, 5,
+    1, 2, 1, 1, 2, 1, 1, 1, 2, 3, 5, 1, 4, 1, 1, 1,
+    2, 1, 1, 3, 8, 3, 2, 10, 6, 1, 3, 4, 1, 4, 2, 1,
+    5, 3, 2, 1, 1, 1, 8, 7, 4, 1, 2, 5, 1, 2, 6, 1,
+    2, 3, 1, 1, 1, 6, 5, 3, 1, 1, 1, 5, 3, 1, 1, 6,
+    1, 1, 1, 1, 1, 1, 2, 7, 7, 7, 1, 6, 1, 6, 2, 2,
+    5, 1, 2, 1, 4, 5, 1, 2, 1, 1, 2, 2, 4, 1, 5, 4,
+    4, 1, 4, 6, 3, 9, 5, 3, 1, 9, 3, 12, 1, 8, 16, 2,
+    3, 1, 4, 9, 1, 4, 8, 11, 2, 6, 1, 12, 1, 7, 2, 7,
+    3, 4, 5, 3, 1, 4, 6, 3, 2, 1, 1, 1, 1, 2, 1, 10,
+    3, 4, 2, 1, 2, 4, 1, 2, 5, 2, 2, 4, 1, 1, 2, 3,
+    1, 1, 1, 3, 1, 1, 1, 1, 2, 1, 7, 6, 2, 2, 2, 2,
+    3, 3, 1, 5, 4, 2, 4, 1, 1, 10, 9, 2, 12, 1, 2, 11,
+    10, 1, 1, 3, 3, 16, 2, 13, 2, 6, 9, 3, 19, 1, 1, 2,
+    2, 2, 4, 2, 5, 1, 2, 1, 1, 3, 4, 2, 4, 3, 3, 2,
+    1, 9, 4, 6, 1, 2, 6, 2, 3, 3, 1, 1, 1, 4, 2, 2,
+    1, 1, 1, 3, 1, 1, 2, 8, 1, 4, 3, 7, 6, 3, 2, 1,
+    1, 4, 2, 1, 3, 5, 2, 1, 3, 4, 14, 8, 6, 11, 1, 2,
+    17, 3, 3, 3, 5, 3, 8, 6, 3, 2, 1, 19, 5, 3, 3, 10,
+    4, 1, 16, 4, 5, 2, 5, 5, 1, 6, 9, 10, 8, 4, 6, 9,
+    18, 2, 3, 7, 1, 6, 4, 3, 3, 7, 9, 1, 2, 10, 8, 5,
+    1, 3, 6, 2, 8, 6, 1, 2, 6, 1, 6, 5, 17, 6, 4, 2,
+    1, 1, 5, 1, 6, 3, 10, 1, 5, 6, 3, 1, 5, 2, 4, 2,
+    3, 4, 3, 2, 3, 11, 2, 1, 4, 7, 1, 5, 3, 13, 5, 7,
+    5, 3, 1, 5, 7, 15, 12, 4, 4, 1, 3, 2, 6, 1, 1, 1,
+    1, 1, 4, 2, 6, 2, 2, 11, 4, 6, 2, 2, 1, 1, 2, 2,
+    1, 1, 2, 2, 6, 5, 3, 2, 1, 1, 1, 9, 4, 1, 8, 1,
+    5, 1, 2, 3, 1, 2, 2, 3, 1, 1, 1, 8, 19, 1, 1, 8,
+    2, 3, 3, 1, 1, 33, 7, 3, 1, 3, 3, 2, 8, 19, 2, 7,
+    1, 8, 2, 2, 1, 2, 7, 2, 5, 1, 1, 1, 4, 3, 2, 1,
+    5, 4, 2, 5, 1, 1, 1, 3, 2, 5, 1, 1, 1, 3, 4, 5,
+    2, 7, 2, 1, 1, 2, 2, 10, 3, 1, 3, 1, 1, 3, 6, 3,
+    3, 8, 3, 4, 5, 4, 2, 1, 6, 2, 1, 3, 4, 6, 3, 1,
+    1, 1, 4, 2, 2, 1, 2, 2, 1, 1, 5, 3, 2, 1, 1, 5,
+    1, 2, 1, 3, 3, 6, 2, 6, 5, 6, 1, 5, 1, 3, 3, 8,
+    2, 14, 4, 1, 1, 8, 2, 10, 1, 3, 2, 1, 1, 3, 1, 15,
+    5, 3, 4, 1, 19, 5, 5, 8, 1, 8, 3, 2, 6, 7, 1, 2,
+    2, 14, 6, 1, 3, 2, 1, 2, 27, 3, 4, 5, 1, 6, 3, 8,
+    5, 9, 1, 2, 3, 1, 2, 5, 2, 4, 3, 3, 3, 4, 1, 7,
+    1, 3, 7, 4, 2, 5, 5, 1, 2, 4, 7, 1, 7, 1, 2, 8,
+    16, 8, 8, 4, 2, 3, 2, 4, 8, 1, 3, 7, 8, 11, 8, 4,
+    12, 4, 8, 3, 1, 15, 1, 3, 3, 5, 14, 18, 1, 8, 5, 2,
+    15, 5, 2, 2, 3, 12, 3, 1, 5, 9, 2, 3, 1, 5, 3, 2,
+    1, 6, 1, 1, 11, 3, 18, 6, 3, 2, 8, 15, 16, 10, 2, 1,
+    4, 7, 6, 14, 5, 15, 10, 43, 2, 4, 3, 10, 3, 10, 5, 1,
+    9, 6, 2, 2, 6, 3, 16, 9, 2, 3, 2, 1, 2, 1, 3, 1,
+    4, 2, 2, 4, 1, 2, 1, 2, 3, 1, 5, 3, 4, 2, 4, 9,
+    5, 1, 2, 4, 1, 5, 8, 1, 5, 4, 3, 4, 1, 1, 12, 11,
+    5, 6, 2, 5, 2, 3, 5, 4, 1, 1, 3, 1, 4, 4, 7, 19,
+    6, 5, 3, 2, 1, 3, 3, 2, 2, 3, 3, 1, 4, 1, 2, 3,
+    3, 4, 1, 2, 8, 1, 2, 3, 1, 1, 8, 5, 2, 1, 1, 1,
+    3, 2, 14, 3, 2, 2, 5, 2, 1, 1, 1, 5, 2, 2, 1, 1,
+    8, 5, 2, 1, 3, 1, 2, 2, 3, 2, 3, 3, 5, 2, 6, 9,
+    4, 5, 5, 4, 2, 13, 1, 1, 1, 3, 6, 4, 1, 2, 4, 2,
+    5, 1, 5, 2, 2, 6, 1, 1, 1, 3, 2, 1, 3, 25, 7, 3,
+    1, 2, 4, 6, 6, 1, 5, 2, 4, 1, 6, 3, 2, 8, 1, 2,
+    3, 1, 4, 2, 1, 5, 7, 3, 2, 3, 5, 2, 7, 3, 1, 3,
+    2, 2, 7, 1, 5, 3, 1, 2, 1, 17, 1, 2, 5, 1, 8, 1,
+    1, 1, 6, 3, 2, 17, 7, 2, 5, 3, 1, 1, 16, 10, 11, 1,
+    16, 9, 1, 2, 6, 5, 4, 22, 2, 1, 4, 4, 5, 5, 7, 2,
+    7, 1, 5, 5, 3, 2, 5, 3, 2, 8, 11, 2, 5, 4, 3, 4,
+    4, 2, 5, 2, 7, 1, 1, 1, 2, 1, 1, 1, 1, 2, 1, 1,
+    2, 4, 3, 4, 1, 1, 1, 3, 1, 2, 1, 3, 2, 8, 4, 1,
+    2, 3, 6, 3, 4, 2, 1, 7, 1, 12, 2, 2, 2, 1, 9, 9,
+    3, 4, 2, 3, 2, 4, 13, 4, 1, 3, 1, 1, 2, 147, 45, 6,
+    15, 3, 23, 12, 3, 8, 13, 3, 16, 8, 1, 6, 8, 129, 18, 6,
+    5, 22, 4, 17, 13, 26, 43, 1, 21, 6, 3, 6, 51, 7, 73, 4,
+    33, 46, 11, 65, 31, 50, 73, 11, 42, 20, 23, 9, 1, 17, 5, 71,
+    9, 61, 13, 36, 2, 4, 3, 3, 40, 30, 28, 33, 7, 9, 5, 15,
+    44, 9, 1, 8, 4, 17, 7, 3, 4, 1, 4, 6, 7, 14, 6, 1,
+    10, 9, 1, 1, 1, 10, 9, 9, 1, 1, 1, 4, 7, 5, 6, 3,
+    5, 2, 1, 2, 5, 7, 8, 2, 2, 5, 5, 7, 4, 4, 2, 1,
+    4, 6, 1, 1, 1, 2, 9, 7, 7, 1, 2, 2, 9, 11, 11, 16,
+    29, 3, 17, 5, 2, 1, 3, 7, 8, 4, 4, 2, 2, 4, 1, 4,
+    3, 1, 2, 3, 4, 3, 2, 5, 1, 2, 8, 12, 6, 6, 2, 2,
+    2, 5, 2, 4, 2, 1, 5, 5, 7, 1, 6, 2, 2, 1, 8, 2,
+    3, 6, 2, 11, 2, 1, 4, 6, 3, 3, 7, 4, 6, 1, 1, 3,
+    4, 3, 13, 4, 2, 2, 3, 3, 1, 2, 2, 11, 1, 1, 1, 7,
+    1, 1, 8, 6, 14, 5, 4, 2, 2, 5, 3, 1, 7, 1, 2, 5,
+    3, 4, 1, 8, 3, 10, 6, 6, 2, 16, 1, 9, 11, 2, 8, 11,
+    4, 6, 6, 1, 12, 7, 3, 6, 2, 2, 2, 2, 3, 1, 2, 3,
+    2, 11, 1, 9, 5, 8, 6, 2, 1, 4, 24, 3, 10, 1, 1, 7,
+    2, 3, 1, 2, 18, 7, 16, 2, 6, 5, 3, 5, 3, 4, 9, 1,
+    2, 1, 7, 9, 4, 1, 3, 1, 3, 3, 3, 1, 3, 7, 7, 5,
+    3, 2, 2, 8, 3, 9, 4, 1, 1, 5, 1, 4, 2, 1, 9, 1,
+    1, 3, 3, 2, 3, 1, 3, 6, 19, 1, 6, 3, 6, 12, 1, 1,
+    1, 4, 2, 8, 13, 11, 5, 1, 3, 4, 5, 7, 1, 10, 4, 1,
+    1, 1, 3, 2, 8, 2, 1, 1, 3, 2, 3, 1, 2, 4, 6, 5,
+    3, 2, 5, 3, 3, 4, 1, 6, 15, 5, 1, 5, 3, 2, 11, 6,
+    1, 5, 4, 3, 6, 1, 3, 7, 13, 1, 9, 5, 2, 2, 255, 147,
+    185, 64, 143, 2, 255, 42, 2, 2, 12, 18, 16, 2, 17, 17, 4, 6,
+    2, 9, 5, 1, 3, 2, 2, 4, 8, 9, 8, 12, 4, 6, 5, 13,
+    5, 1, 2, 5, 12, 8, 18, 15, 1, 2, 14, 12, 4, 1, 2, 2,
+    10, 8, 9, 3, 13, 12, 8, 4, 25, 1, 4, 2, 1, 13, 9, 1,
+    11, 7, 12, 11, 3, 4, 20, 7, 2, 1, 9, 1, 8, 8, 3, 1,
+    15, 3, 10, 10, 2, 1, 22, 3, 3, 1, 10, 10, 5, 13, 3, 9,
+    12, 12, 5, 10, 11, 3, 4, 7, 7, 3, 2, 2, 5, 12, 16, 4,
+    11, 6, 5, 1, 2, 6, 1, 7, 9, 7, 7, 3, 8, 4, 5, 1,
+    3, 1, 3, 5, 7, 1, 5, 5, 14, 9, 11, 3, 1, 10, 3, 2,
+    1, 2, 13, 6, 2, 1, 5, 3, 9, 3, 7, 12, 18, 11, 2, 3,
+    15, 2, 1, 3, 10, 5, 2, 12, 4, 4, 7, 2, 16, 2, 56, 9,
+    5, 1, 9, 9, 12, 4, 2, 1, 21, 7, 13, 28, 4, 2, 14, 5,
+    6, 3, 3, 15, 12, 4, 5, 3, 7, 10, 8, 6, 2, 3, 2, 7,
+    1, 3, 2, 1, 5, 6, 8, 4, 9, 3, 4, 3, 17, 4, 10, 2,
+    1, 9, 8, 16, 1, 5, 2, 5, 6, 6, 1, 5, 5, 6, 8, 8,
+    11, 8, 2, 5, 46, 48, 1, 2, 8, 6, 1, 7, 7, 3, 15, 35,
+    22, 1, 14, 2, 55, 10, 2, 15, 3, 5, 2, 4, 4, 25, 3, 29,
+    16, 8, 11, 3, 38, 2, 15, 3, 4, 15, 4, 7, 2, 15, 11, 1,
+    11, 4, 5, 8, 5, 14, 10, 3, 3, 12, 18, 9, 29, 36, 6, 68,
+    1, 4, 3, 15, 30, 19, 6, 1, 10, 59, 25, 103, 2, 1, 15, 18,
+    4, 9, 14, 13, 46, 1, 2, 4, 7, 5, 1, 6, 56, 27, 16, 2,
+    32, 11, 21, 4, 1, 25, 10, 16, 8, 4, 7, 1, 6, 16, 8, 6,
+    1, 54, 4, 21, 9, 4, 0, 3, 2, 4, 1, 3, 1, 1, 1, 1,
+    6, 1, 1, 1, 1, 3, 2, 1, 1, 3, 4, 1, 1, 1, 1, 7,
+    1, 1, 3, 1, 1, 3, 1, 12, 3, 2, 7, 9, 2, 4, 3, 5,
+    13, 1, 12, 8, 2, 2, 2, 1, 7, 1, 5, 3, 2, 2, 5, 1,
+    11, 1, 2, 3, 7, 9, 5, 2, 7, 1, 11, 5, 5, 1, 6, 2,
+    1, 8, 1, 2, 3, 2, 9, 1, 22, 15, 1, 2, 5, 3, 3, 5,
+    4, 3, 7, 1, 1, 3, 2, 16, 1, 4, 4, 2, 6, 3, 1, 9,
+    8, 11, 2, 2, 6, 10, 1, 3, 1, 2, 1, 1, 1, 2, 2, 7,
+    1, 6, 3, 9, 4, 4, 1, 1, 8, 3, 2, 1, 3, 1, 1, 10,
+    1, 6, 12, 2, 7, 1, 2, 4, 7, 1, 3, 2, 2, 2, 1, 2,
+    2, 2, 2, 4, 5, 9, 7, 1, 5, 1, 1, 2, 6, 8, 1, 1,
+    2, 8, 1, 7, 5, 4, 5, 1, 3, 3, 2, 11, 6, 2, 2, 1,
+    5, 1, 2, 3, 4, 21, 2, 1, 4, 2, 2, 2, 1, 2, 9, 1,
+    7, 13, 5, 4, 3, 4, 6, 10, 1, 3, 5, 2, 1, 5, 11, 4,
+    2, 4, 7, 11, 6, 3, 1, 3, 6, 8, 1, 2, 13, 19, 4, 2,
+    1, 5, 5, 3, 5, 4, 3, 8, 3, 1, 1, 4, 6, 5, 7, 1,
+    1, 1, 4, 6, 6, 1, 3, 1, 3, 2, 5, 10, 1, 6, 8, 1,
+    4, 1, 2, 5, 10, 2, 5, 1, 7, 2, 2, 1, 2, 2, 3, 3,
+    4, 8, 4, 1, 2, 7, 1, 1, 5, 1, 3, 4, 1, 2, 10, 6,
+    4, 16, 1, 1, 6, 1, 13, 2, 1, 2, 15, 2, 4, 4, 1, 9,
+    3, 16, 3, 2, 5, 5, 1, 10, 2, 16, 1, 2, 13, 5, 2, 7,
+    3, 7, 5, 3, 6, 3, 4, 3, 5, 8, 2, 2, 6, 6, 6, 1,
+    1, 16, 1, 1, 16, 1, 2, 6, 3, 4, 2, 5, 1, 2, 2, 4,
+    1, 2, 1, 7, 10, 1, 7, 3, 1, 3, 4, 2, 2, 5, 1, 2,
+    2, 1, 6, 6, 1, 4, 9, 1, 1, 1, 2, 4, 1, 1, 1, 2,
+    1, 2, 2, 4, 1, 3, 8, 98, 8, 19, 69, 24, 16, 77, 4, 6,
+    38, 110, 81, 114, 4, 11, 10, 42, 255, 2, 44, 24, 3, 186, 5, 10,
+    84, 14, 13, 36, 6, 8, 1, 45, 4, 17, 83, 7, 2, 3, 7, 4,
+    4, 4, 6, 3, 1, 3, 8, 4, 8, 4, 5, 3, 2, 14, 4, 7,
+    5, 4, 9, 25, 4, 1, 8, 2, 6, 1, 1, 2, 8, 3, 5, 12,
+    2, 9, 5, 7, 4, 6, 3, 9, 3, 1, 4, 6, 1, 1, 4, 1,
+    1, 8, 1, 4, 6, 1, 9, 6, 1, 1, 8, 5, 2, 2, 2, 2,
+    1, 4, 8, 3, 5, 3, 1, 10, 5, 8, 8, 2, 2, 1, 8, 6,
+    6, 1, 2, 1, 5, 2, 2, 1, 1, 1, 11, 7, 9, 2, 1, 1,
+    2, 4, 6, 13, 11, 4, 2, 7, 1, 1, 6, 5, 4, 1, 1, 1,
+    2, 1, 3, 1, 3, 1, 2, 1, 8, 5, 1, 1, 1, 2, 5, 1,
+    3, 2, 4, 1, 14, 2, 6, 1, 1, 1, 1, 8, 6, 2, 2, 4,
+    3, 6, 5, 21, 2, 2, 5, 4, 8, 4, 2, 2, 2, 5, 3, 1,
+    4, 4, 1, 2, 2, 3, 5, 3, 13, 3, 3, 6, 2, 1, 1, 6,
+    1, 4, 4, 1, 5, 1, 8, 2, 9, 6, 1, 3, 3, 3, 4, 1,
+    5, 4, 3, 5, 6, 1, 1, 9, 3, 11, 2, 6, 1, 3, 2, 2,
+    7, 9, 1, 6, 21, 5, 1, 2, 1, 2, 1, 1, 1, 1, 5, 17,
+    7, 3, 2, 2, 1, 2, 10, 19, 7, 1, 5, 1, 14, 4, 9, 8,
+    5, 1, 6, 5, 2, 11, 4, 16, 10, 7, 1, 2, 1, 9, 10, 17,
+    2, 5, 8, 10, 1, 15, 7, 11, 2, 2, 3, 1, 13, 2, 8, 1,
+    4, 13, 1, 2, 7, 4, 5, 1, 2, 1, 1, 9, 16, 10, 3, 4,
+    3, 13, 3, 1, 14, 7, 2, 4, 7, 1, 10, 3, 3, 2, 1, 3,
+    1, 4, 2, 2, 6, 3, 3, 1, 6, 1, 2, 11, 4, 2, 5, 2,
+    3, 9, 5, 2, 5, 3, 3, 2, 8, 5, 3, 1, 1, 3, 2, 1,
+    1, 2, 3, 1, 13, 2, 1, 3, 1, 3, 4, 1, 1, 1, 1, 5,
+    2, 3, 1, 2, 2, 2, 4, 2, 2, 4, 8, 1, 5, 3, 1, 1,
+    2, 1, 1, 2, 1, 10, 1, 2, 7, 2, 2, 1, 2, 2, 1, 1,
+    1, 3, 5, 2, 5, 3, 1, 4, 1, 15, 15, 6, 1, 1, 12, 5,
+    9, 4, 3, 2, 4, 1, 2, 11, 1, 2, 18, 1, 4, 1, 6, 1,
+    5, 2, 2, 4, 4, 2, 5, 1, 11, 2, 2, 8, 2, 2, 1, 1,
+    15, 1, 3, 9, 6, 4, 2, 2, 2, 17, 5, 12, 6, 2, 4, 5,
+    10, 7, 2, 1, 3, 1, 2, 7, 4, 5, 1, 1, 6, 3, 4, 2,
+    8, 5, 3, 4, 4, 1, 1, 2, 1, 7, 9, 2, 7, 2, 3, 5,
+    2, 6, 4, 4, 1, 2, 1, 6, 5, 3, 2, 5, 4, 6, 1, 4,
+    3, 2, 7, 1, 5, 16, 6, 2, 7, 10, 7, 2, 6, 1, 1, 2,
+    6, 1, 3, 4, 14, 9, 13, 1, 2, 3, 3, 3, 1, 3, 2, 2,
+    4, 1, 1, 3, 1, 1, 2, 4, 1, 3, 4, 1, 1, 3, 1, 4,
+    2, 1, 12, 17, 1, 4, 5, 1, 3, 5, 2, 3, 3, 7, 9, 2,
+    6, 6, 4, 7, 7, 1, 2, 6, 4, 13, 3, 2, 33, 11, 9, 7,
+    2, 2, 1, 9, 5, 5, 12, 1, 7, 3, 5, 10, 1, 1, 3, 2,
+    6, 5, 10, 2, 7, 7, 5, 10, 7, 3, 2, 3, 1, 8, 3, 6,
+    3, 5, 1, 6, 1, 4, 10, 1, 1, 1, 1, 5, 2, 2, 9, 7,
+    3, 4, 1, 22, 14, 2, 1, 4, 2, 1, 1, 9, 41, 5, 9, 2,
+    6, 13, 6, 2, 2, 2, 7, 4, 1, 3, 3, 16, 1, 18, 1, 4,
+    5, 9, 6, 3, 1, 3, 11, 22, 12, 17, 4, 1, 1, 2, 4, 1,
+    1, 12, 4, 3, 1, 15, 18, 1, 2, 1, 10, 7, 3, 7, 1, 2,
+    5, 2, 1, 1, 1, 1, 6, 2, 3, 1, 2, 4, 1, 1, 5, 2,
+    1, 12, 4, 14, 6, 8, 2, 1, 1, 5, 1, 2, 1, 7, 1, 2,
+    3, 1, 6, 1, 2, 1, 10, 1, 5, 4, 2, 7, 1, 5, 4, 3,
+    9, 2, 1, 6, 1, 2, 1, 3, 2, 1, 15, 13, 7, 3, 1, 2,
+    8, 5, 11, 4, 9, 14, 2, 6, 8, 3, 1, 9, 23, 24, 1, 5,
+    2, 3, 1, 2, 3, 7, 12, 3, 13, 3, 3, 1, 1, 8, 1, 2,
+    8, 4, 2, 2, 1, 6, 5, 6, 3, 4, 1, 2, 1, 1, 1, 3,
+    1, 5, 3, 3, 2, 1, 6, 1, 1, 2, 3, 2, 1, 3, 8, 2,
+    1, 2, 5, 1, 6, 24, 2, 4, 5, 12, 4, 2, 1, 12, 11, 12,
+    18, 14, 12, 8, 1, 1, 11, 3, 2, 1, 9, 1, 3, 6, 1, 4,
+    2, 2, 2, 4, 3, 2, 1, 2, 1, 7, 1, 2, 12, 2, 1, 1,
+    2, 1, 2, 1, 6, 1, 2, 1, 5, 8, 1, 7, 1, 2, 3, 7,
+    3, 7, 7, 1, 3, 1, 7, 4, 2, 1, 6, 2, 3, 18, 7, 6,
+    2, 1, 1, 5, 2, 8, 4, 1, 1, 10, 8, 1, 1, 3, 14, 7,
+    3, 6, 7, 4, 4, 12, 1, 14, 2, 9, 2, 3, 4, 2, 1, 2,
+    3, 7, 2, 1, 2, 1, 4, 3, 3, 10, 9, 5, 2, 1, 4, 2,
+    14, 4, 2, 10, 1, 10, 1, 3, 10, 24, 3, 1, 2, 5, 1, 1,
+    3, 1, 2, 6, 10, 4, 1, 10, 2, 1, 4, 6, 3, 1, 12, 7,
+    5, 8, 4, 3, 1, 3, 1, 5, 5, 10, 6, 20, 7, 6, 16, 9,
+    1, 1, 3, 2, 1, 3, 5, 12, 13, 2, 1, 1, 16, 1, 4, 2,
+    1, 7, 6, 9, 5, 4, 7, 1, 3, 6, 5, 2, 1, 9, 7, 5,
+    7, 3, 4, 22, 2, 16, 3, 2, 4, 1, 7, 7, 6, 1, 10, 13,
+    1, 9, 4, 6, 3, 5, 1, 11, 11, 6, 5, 3, 2, 1, 2, 3,
+    6, 3, 2, 6, 5, 1, 4, 1, 4, 8, 6, 1, 1, 5, 11, 1,
+    10, 2, 1, 2, 1, 1, 1, 2, 7, 15, 10, 6, 1, 4, 16, 1,
+    6, 1, 7, 2, 3, 3, 6, 2, 6, 6, 5, 5, 3, 2, 3, 3,
+    9, 5, 2, 26, 6, 12, 10, 1, 11, 3, 2, 7, 4, 9, 7, 6,
+    11, 2, 12, 1, 3, 1, 5, 3, 4, 15, 4, 3, 7, 1, 3, 1,
+    7, 6, 12, 5, 3, 1, 1, 3, 1, 4, 2, 8, 4, 7, 1, 4,
+    2, 1, 5, 1, 3, 1, 9, 1, 3, 5, 3, 1, 5, 1, 4, 1,
+    4, 1, 12, 9, 2, 2, 1, 8, 3, 3, 6, 1, 1, 6, 5, 3,
+    2, 14, 1, 5, 1, 2, 8, 4, 1, 2, 4, 6, 1, 3, 8, 3,
+    2, 2, 4, 1, 1, 6, 1, 6, 2, 5, 3, 3, 3, 5, 2, 1,
+    1, 2, 2, 2, 1, 3, 4, 1, 8, 3, 4, 6, 6, 4, 2, 4,
+    5, 2, 3, 2, 1, 3, 2, 3, 1, 6, 2, 5, 2, 1, 5, 1,
+    13, 1, 2, 2, 1, 10, 6, 7, 2, 2, 3, 4, 1, 8, 2, 5,
+    11, 2, 2, 1, 2, 5, 2, 2, 4, 6, 2, 3, 7, 6, 10, 2,
+    1, 2, 9, 3, 3, 13, 3, 4, 9, 14, 1, 4, 11, 2, 4, 12,
+    6, 6, 1, 2, 3, 4, 17, 2, 8, 1, 17, 2, 10, 3, 3, 3,
+    10, 14, 1, 9, 1, 4, 4, 3, 1, 1, 1, 1, 6, 2, 2, 4,
+    3, 1, 8, 3, 6, 1, 2, 4, 1, 14, 2, 1, 3, 6, 4, 1,
+    1, 2, 4, 3, 1, 4, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 3, 3, 2, 1, 2, 3, 2, 4, 1, 1, 6, 3, 1, 1,
+    3, 5, 2, 7, 3, 1, 1, 1, 4, 2, 1, 1, 2, 1, 5, 3,
+    1, 9, 2, 2, 1, 2, 2, 1, 6, 5, 1, 3, 5, 3, 3, 7,
+    6, 1, 1, 17, 2, 2, 3, 21, 8, 2, 3, 6, 4, 4, 3, 1,
+    1, 3, 10, 2, 1, 3, 6, 7, 4, 1, 8, 4, 1, 14, 2, 3,
+    1, 1, 6, 2, 3, 5, 3, 5, 3, 0, 5, 5, 2, 2, 1, 1,
+    4, 2, 2, 2, 6, 2, 14, 7, 2, 4, 3, 2, 1, 3, 2, 1,
+    3, 1, 1, 2, 8, 1, 7, 1, 4, 13, 2, 1, 2, 7, 5, 1,
+    18, 15, 1, 1, 27, 2, 4, 3, 3, 2, 1, 10, 1, 8, 2, 1,
+    1, 4, 5, 5, 1, 6, 2, 3, 2, 7, 5, 18, 2, 1, 1, 2,
+    2, 2, 10, 1, 10, 2, 2, 2, 5, 9, 3, 3, 11, 7, 4, 4,
+    4, 2, 7, 3, 2, 9, 1, 1, 3, 4, 8, 4, 4, 3, 1, 7,
+    1, 10, 11, 22, 2, 3, 8, 2, 8, 1, 3, 4, 10, 5, 2, 2,
+    10, 4, 7, 2, 2, 4, 4, 5, 6, 1, 3, 6, 1, 1, 3, 13,
+    1, 3, 3, 3, 1, 1, 11, 1, 4, 4, 5, 3, 3, 1, 1, 1,
+    8, 8, 2, 7, 1, 1, 6, 3, 3, 1, 4, 1, 5, 3, 4, 1,
+    3, 3, 3, 3, 7, 4, 7, 2, 1, 2, 5, 2, 1, 2, 8, 4,
+    1, 3, 3, 9, 1, 1, 1, 18, 2, 2, 8, 3, 2, 8, 4, 2,
+    9, 6, 4, 5, 1, 3, 5, 6, 1, 4, 4, 1, 12, 4, 1, 7,
+    3, 2, 1, 4, 5, 3, 6, 2, 5, 1, 5, 4, 2, 3, 3, 2,
+    1, 3, 6, 11, 1, 1, 3, 4, 5, 2, 1, 1, 4, 1, 6, 3,
+    5, 1, 1, 1, 1, 1, 1, 2, 3, 2, 3, 1, 10, 2, 3, 2,
+    7, 3, 2, 1, 8, 6, 2, 1, 5, 1, 1, 3, 1, 5, 1, 4,
+    4, 3, 3, 1, 1, 10, 6, 1, 1, 2, 7, 1, 6, 7, 1, 2,
+    3, 1, 6, 3, 1, 5, 3, 6, 2, 5, 21, 23, 1, 6, 2, 10,
+    1, 1, 4, 8, 4, 1, 4, 4, 19, 3, 1, 7, 8, 1, 1, 1,
+    5, 5, 3, 4, 1, 12, 10, 1, 1, 8, 2, 3, 1, 1, 5, 10,
+    2, 2, 3, 2, 4, 10, 3, 5, 6, 4, 9, 1, 4, 4, 5, 7,
+    1, 5, 6, 5, 1, 17, 2, 15, 11, 5, 2, 12, 9, 5, 2, 1,
+    1, 8, 2, 2, 3, 3, 1, 5, 3, 1, 3, 1, 2, 2, 2, 3,
+    29, 5, 89, 2, 12, 66, 7, 25, 50, 2, 3, 16, 4, 21, 47, 5,
+    6, 16, 25, 7, 9, 10, 5, 25, 12, 10, 26, 13, 17, 1, 7, 65,
+    2, 76, 7, 43, 11, 72, 86, 26, 67, 18, 2, 20, 6, 16, 31, 5,
+    52, 153, 3, 48, 6, 1, 17, 40, 2, 4, 16, 48, 0, 3, 2, 2,
+    6, 2, 7, 2, 2, 2, 1, 3, 5, 7, 1, 2, 8, 3, 3, 2,
+    3, 12, 9, 2, 4, 5, 3, 2, 4, 1, 5, 3, 8, 2, 2, 11,
+    14, 5, 17, 17, 3, 5, 3, 5, 1, 4, 9, 7, 1, 2, 3, 1,
+    4, 1, 6, 5, 3, 3, 1, 2, 3, 2, 1, 5, 4, 6, 4, 1,
+    2, 4, 1, 6, 11, 1, 8, 4, 1, 3, 6, 3, 7, 6, 3, 4,
+    1, 1, 4, 1, 1, 4, 6, 4, 2, 2, 1, 2, 1, 2, 2, 1,
+    1, 4, 1, 2, 2, 3, 6, 5, 1, 4, 2, 1, 7, 4, 2, 2,
+    2, 3, 1, 1, 2, 8, 4, 6, 2, 1, 9, 9, 1, 16, 1, 2,
+    4, 5, 1, 4, 1, 1, 3, 10, 2, 13, 3, 1, 2, 2, 1, 8,
+    3, 2, 5, 5, 3, 4, 2, 1, 1, 8, 7, 4, 1, 1, 4, 4,
+    9, 3, 1, 1, 3, 4, 1, 3, 10, 12, 5, 4, 1, 4, 13, 9,
+    2, 12, 1, 11, 2, 2, 2, 1, 13, 1, 1, 5, 1, 2, 2, 2,
+    2, 11, 10, 5, 1, 1, 1, 5, 3, 2, 5, 1, 8, 4, 1, 5,
+    1, 9, 8, 1, 3, 2, 1, 3, 3, 8, 4, 4, 3, 4, 10, 1,
+    1, 6, 1, 2, 1, 11, 10, 1, 2, 4, 7, 2, 1, 4, 3, 5,
+    2, 13, 3, 6, 4, 2, 2, 3, 4, 8, 12, 5, 1, 6, 6, 8,
+    4, 1, 4, 27, 2, 1, 2, 5, 13, 1, 1, 1, 4, 1, 4, 8,
+    2, 18, 4, 3, 1, 21, 14, 4, 5, 6, 8, 4, 5, 6, 6, 17,
+    7, 4, 8, 1, 6, 5, 6, 6, 8, 10, 2, 12, 1, 16, 4, 6,
+    2, 1, 2, 4, 8, 1, 2, 4, 6, 1, 2, 2, 1, 8, 3, 3,
+    1, 5, 11, 6, 5, 10, 4, 4, 5, 4, 10, 25, 6, 5, 2, 9,
+    1, 11, 5, 3, 1, 4, 1, 9, 4, 19, 6, 2, 6, 18, 255, 255,
+    255, 255, 255, 186, 80, 103, 30, 210, 255, 143, 81, 136, 180, 0, 2, 8,
+    3, 1, 18, 4, 1, 3, 3, 1, 5, 19, 1, 2, 6, 11, 14, 6,
+    1, 4, 5, 10, 8, 5, 10, 3, 7, 3, 8, 5, 6, 17, 9, 1,
+    7, 11, 3, 3, 13, 8, 3, 5, 1, 2, 22, 2, 5, 15, 1, 6,
+    7, 1, 3, 6, 2, 18, 5, 13, 3, 1, 10, 6, 8, 12, 9, 7,
+    2, 18, 4, 2, 2, 16, 8, 2, 3, 6, 3, 1, 3, 1, 2, 2,
+    3, 1, 9, 1, 9, 2, 26, 32, 7, 4, 2, 34, 8, 5, 10, 2,
+    6, 6, 4, 3, 1, 3, 9, 6, 2, 8, 3, 3, 1, 2, 2, 4,
+    15, 2, 2, 1, 5, 8, 7, 2, 1, 5, 1, 3, 7, 6, 4, 16,
+    34, 3, 5, 4, 12, 4, 16, 2, 7, 1, 4, 4, 1, 3, 1, 15,
+    3, 2, 3, 16, 3, 1, 5, 10, 4, 1, 6, 4, 11, 6, 1, 2,
+    1, 4, 5, 3, 9, 1, 13, 4, 5, 6, 2, 9, 2, 4, 2, 9,
+    5, 7, 3, 2, 11, 14, 2, 2, 4, 1, 5, 14, 3, 15, 5, 12,
+    2, 3, 1, 6, 9, 2, 4, 13, 3, 10, 20, 1, 6, 1, 5, 5,
+    5, 10, 1, 2, 1, 2, 2, 11, 4, 19, 3, 1, 11, 13, 1, 6,
+    1, 7, 1, 1, 4, 4, 7, 3, 4, 1, 5, 2, 1, 5, 3, 2,
+    6, 2, 7, 2, 5, 1, 3, 5, 7, 2, 2, 9, 8, 1, 5, 2,
+    5, 7, 6, 2, 4, 16, 16, 12, 4, 11, 7, 1, 1, 13, 3, 6,
+    4, 1, 1, 4, 2, 1, 12, 3, 2, 1, 1, 7, 4, 1, 19, 3,
+    3, 7, 1, 1, 7, 11, 4, 3, 3, 13, 1, 7, 4, 2, 3, 2,
+    3, 10, 2, 4, 4, 3, 5, 2, 1, 5, 13, 7, 7, 11, 3, 1,
+    27, 3, 5, 1, 3, 2, 5, 2, 15, 7, 6, 2, 3, 4, 1, 4,
+    1, 1, 8, 5, 4, 7, 5, 1, 11, 1, 3, 1, 2, 10, 3, 2,
+    3, 7, 2, 3, 3, 3, 3, 2, 7, 2, 2, 3, 2, 1, 1, 3,
+    3, 4, 5, 1, 3, 3, 5, 2, 2, 1, 6, 1, 3, 11, 4, 6,
+    4, 1, 3, 3, 1, 4, 6, 3, 2, 3, 1, 18, 4, 4, 2, 1,
+    3, 2, 2, 6, 4, 2, 6, 5, 2, 16, 5, 2, 1, 3, 2, 13,
+    3, 1, 2, 12, 2, 4, 3, 3, 1, 3, 2, 5, 2, 1, 10, 3,
+    2, 1, 4, 6, 1, 1, 1, 2, 10, 1, 1, 2, 2, 2, 1, 1,
+    5, 5, 2, 1, 2, 3, 6, 1, 1, 2, 1, 2, 4, 1, 2, 5,
+    3, 2, 5, 2, 2, 6, 25, 8, 8, 1, 2, 10, 1, 3, 9, 2,
+    5, 14, 3, 11, 3, 2, 6, 10, 7, 4, 3, 12, 6, 3, 4, 4,
+    1, 4, 8, 4, 3, 1, 10, 1, 1, 3, 1, 2, 3, 13, 2, 3,
+    4, 3, 7, 2, 2, 4, 3, 6, 11, 1, 2, 1, 2, 9, 2, 1,
+    2, 3, 4, 2, 2, 2, 3, 4, 3, 1, 1, 1, 6, 16, 5, 7,
+    2, 2, 3, 4, 1, 4, 4, 3, 1, 2, 1, 3, 8, 5, 9, 18,
+    3, 2, 1, 2, 1, 5, 8, 3, 1, 7, 2, 1, 3, 3, 1, 3,
+    2, 11, 7, 1, 9, 2, 1, 1, 2, 2, 4, 2, 2, 4, 11, 3,
+    6, 1, 4, 1, 5, 5, 10, 4, 1, 16, 7, 4, 1, 4, 2, 1,
+    7, 24, 12, 3, 2, 14, 3, 2, 9, 5, 1, 17, 1, 2, 6, 4,
+    5, 3, 6, 2, 2, 6, 2, 1, 5, 8, 1, 2, 1, 2, 4, 1,
+    1, 2, 4, 1, 1, 1, 2, 2, 1, 1, 1, 1, 3, 4, 2, 1,
+    6, 1, 2, 1, 1, 3, 1, 2, 1, 5, 2, 1, 2, 1, 2, 4,
+    0, 8, 6, 2, 10, 1, 6, 1, 3, 2, 4, 2, 2, 16, 1, 2,
+    6, 3, 15, 1, 1, 5, 5, 1, 7, 13, 10, 8, 1, 6, 3, 10,
+    5, 1, 1, 8, 1, 1, 3, 6, 2, 2, 1, 4, 9, 3, 6, 6,
+    4, 8, 3, 1, 11, 6, 2, 3, 6, 9, 3, 6, 2, 4, 16, 3,
+    3, 1, 10, 1, 3, 3, 5, 8, 3, 2, 9, 1, 2, 10, 23, 4,
+    10, 17, 15, 2, 2, 10, 3, 7, 8, 6, 1, 5, 12, 5, 8, 6,
+    1, 1, 1, 13, 1, 4, 4, 1, 1, 1, 12, 5, 8, 4, 1, 7,
+    5, 5, 15, 2, 3, 9, 1, 7, 14, 8, 8, 4, 5, 3, 6, 2,
+    1, 11, 2, 1, 4, 1, 1, 2, 1, 3, 10, 4, 7, 3, 11, 2,
+    1, 3, 2, 2, 2, 8, 1, 2, 2, 2, 2, 2, 3, 2, 1, 3,
+    4, 2, 3, 8, 5, 6, 1, 31, 6, 4, 11, 2, 6, 3, 9, 1,
+    4, 5, 8, 1, 11, 2, 8, 4, 6, 18, 4, 7, 12, 8, 1, 5,
+    3, 1, 2, 2, 11, 5, 9, 2, 20, 1, 2, 2, 8, 7, 2, 9,
+    6, 2, 10, 2, 23, 7, 1, 1, 1, 3, 1, 3, 14, 3, 6, 22,
+    2, 5, 21, 13, 2, 5, 4, 9, 6, 2, 8, 6, 3, 2, 1, 4,
+    2, 5, 4, 2, 8, 3, 3, 3, 22, 6, 5, 4, 3, 2, 5, 4,
+    5, 2, 21, 5, 21, 6, 6, 3, 4, 8, 7, 5, 4, 3, 2, 2,
+    10, 1, 9, 1, 10, 15, 1, 6, 5, 7, 1, 10, 1, 3, 4, 1,
+    1, 2, 13, 5, 6, 5, 4, 3, 6, 14, 2, 2, 12, 2, 4, 4,
+    10, 3, 11, 1, 11, 1, 5, 2, 2, 3, 3, 2, 2, 5, 3, 6,
+    2, 4, 1, 2, 2, 9, 2, 1, 2, 5, 3, 11, 2, 2, 2, 7,
+    1, 3, 5, 1, 15, 1, 4, 1, 7, 2, 3, 2, 1, 6, 3, 1,
+    1, 1, 21, 4, 2, 1, 2, 2, 2, 2, 7, 1, 4, 1, 2, 4,
+    8, 2, 3, 3, 2, 2, 1, 1, 3, 10, 12, 1, 1, 4, 2, 1,
+    1, 4, 8, 1, 2, 1, 3, 1, 2, 7, 3, 2, 4, 5, 1, 2,
+    6, 1, 1, 1, 12, 1, 5, 3, 1, 2, 2, 2, 2, 1, 5, 2,
+    3, 4, 2, 5, 11, 1, 2, 5, 1, 10, 4, 7, 2, 4, 3, 2,
+    1, 1, 7, 5, 9, 1, 7, 1, 2, 5, 2, 2, 11, 1, 1, 2,
+    2, 6, 8, 1, 4, 6, 1, 11, 1, 3, 3, 2, 1, 1, 2, 2,
+    1, 3, 6, 5, 2, 5, 1, 6, 2, 1, 3, 2, 1, 2, 4, 1,
+    2, 1, 4, 1, 3, 3, 4, 1, 4, 5, 2, 6, 1, 3, 2, 6,
+    2, 8, 2, 14, 3, 13, 10, 3, 5, 3, 10, 1, 2, 7, 1, 20,
+    3, 2, 26, 11, 5, 7, 7, 3, 2, 4, 6, 1, 2, 1, 6, 2,
+    8, 4, 2, 1, 4, 1, 5, 1, 1, 9, 1, 3, 2, 2, 7, 1,
+    1, 1, 5, 2, 3, 3, 1, 4, 1, 3, 2, 1, 3, 1, 2, 2,
+    3, 2, 5, 1, 4, 3, 3, 5, 9, 1, 1, 3, 2, 2, 2, 1,
+    5, 4, 6, 2, 12, 10, 4, 6, 6, 7, 1, 8, 9, 2, 3, 5,
+    1, 3, 2, 6, 7, 4, 1, 1, 1, 14, 1, 12, 1, 4, 1, 3,
+    2, 11, 3, 6, 3, 4, 6, 1, 3, 1, 2, 1, 9, 6, 4, 12,
+    4, 5, 6, 3, 3, 3, 4, 4, 1, 6, 3, 3, 2, 1, 3, 4,
+    3, 3, 5, 4, 1, 2, 4, 1, 10, 15, 3, 9, 8, 4, 1, 4,
+    6, 1, 2, 10, 5, 5, 5, 2, 4, 1, 1, 5, 2, 4, 1, 3,
+    6, 2, 4, 1, 1, 4, 1, 1, 5, 5, 1, 4, 1, 3, 1, 4,
+    2, 8, 3, 6, 10, 11, 1, 26, 38, 9, 5, 4, 2, 1, 2, 12,
+    2, 2, 3, 9, 3, 20, 2, 11, 1, 2, 1, 3, 4, 3, 1, 7,
+    5, 1, 6, 1, 3, 1, 9, 5, 4, 4, 5, 6, 1, 2, 10, 9,
+    1, 4, 5, 12, 9, 5, 6, 2, 18, 2, 4, 1, 3, 21, 2, 3,
+    1, 8, 12, 9, 1, 5, 1, 1, 1, 3, 4, 12, 1, 1, 23, 23,
+    6, 2, 1, 3, 1, 9, 15, 1, 3, 2, 1, 3, 12, 14, 1, 1,
+    4, 1, 3, 2, 10, 2, 3, 1, 4, 3, 1, 2, 5, 5, 9, 7,
+    2, 1, 8, 8, 3, 9, 1, 10, 11, 4, 7, 10, 3, 4, 4, 4,
+    4, 8, 2, 8, 2, 3, 3, 4, 2, 8, 1, 2, 6, 2, 3, 6,
+    2, 16, 2, 2, 3, 5, 11, 4, 5, 2, 2, 1, 3, 4, 2, 1,
+    1, 1, 4, 11, 1, 1, 6, 15, 9, 2, 3, 3, 2, 5, 2, 15,
+    6, 3, 2, 5, 5, 1, 1, 4, 4, 1, 1, 28, 16, 10, 4, 2,
+    2, 2, 1, 6, 3, 7, 3, 5, 1, 6, 1, 5, 7, 3, 2, 2,
+    1, 3, 2, 4, 3, 4, 2, 8, 5, 3, 8, 2, 7, 3, 9, 2,
+    3, 8, 3, 3, 1, 2, 5, 5, 3, 2, 1, 2, 3, 1, 2, 6,
+    3, 3, 2, 3, 1, 2, 6, 2, 13, 2, 1, 5, 3, 6, 1, 2,
+    2, 3, 1, 4, 4, 1, 3, 4, 1, 1, 5, 1, 4, 3, 4, 5,
+    3, 3, 8, 2, 3, 5, 3, 1, 4, 4, 13, 1, 2, 6, 15, 3,
+    3, 8, 4, 1, 1, 5, 9, 4, 2, 4, 4, 1, 13, 6, 21, 2,
+    3, 2, 3, 3, 5, 6, 4, 6, 3, 6, 4, 1, 1, 1, 7, 13,
+    5, 2, 1, 1, 8, 1, 11, 6, 2, 7, 5, 3, 8, 7, 7, 1,
+    1, 1, 10, 8, 6, 4, 1, 4, 6, 2, 9, 7, 1, 1, 2, 1,
+    4, 2, 4, 6, 1, 3, 13, 6, 1, 8, 2, 2, 4, 1, 1, 1,
+    2, 3, 1, 3, 9, 11, 7, 5, 7, 11, 2, 2, 15, 12, 2, 1,
+    5, 6, 3, 3, 7, 1, 9, 2, 3, 2, 1, 1, 8, 2, 6, 1,
+    1, 9, 11, 7, 5, 5, 5, 2, 1, 8, 3, 11, 1, 5, 15, 7,
+    8, 1, 2, 2, 5, 1, 6, 1, 9, 1, 3, 3, 5, 6, 5, 4,
+    1, 1, 5, 2, 2, 2, 2, 1, 8, 3, 1, 1, 5, 4, 6, 17,
+    9, 5, 8, 1, 4, 8, 3, 3, 5, 5, 3, 3, 2, 1, 3, 3,
+    1, 2, 1, 1, 2, 2, 16, 11, 10, 6, 3, 1, 4, 4, 1, 4,
+    2, 4, 1, 5, 4, 11, 1, 1, 6, 6, 8, 7, 2, 3, 1, 6,
+    2, 1, 15, 2, 1, 8, 1, 7, 2, 18, 3, 2, 7, 1, 2, 3,
+    1, 8, 7, 1, 7, 1, 3, 3, 1, 2, 4, 1, 2, 1, 5, 2,
+    2, 10, 5, 1, 6, 7, 8, 4, 4, 1, 1, 2, 11, 2, 2, 1,
+    4, 3, 4, 2, 2, 2, 5, 19, 2, 3, 5, 1, 5, 4, 4, 1,
+    1, 4, 5, 2, 1, 1, 1, 1, 4, 3, 4, 2, 3, 1, 7, 1,
+    1, 5, 1, 5, 2, 4, 1, 1, 2, 2, 1, 8, 2, 1, 7, 9,
+    2, 5, 2, 3, 9, 1, 5, 9, 4, 1, 5, 4, 3, 5, 4, 6,
+    4, 4, 5, 2, 1, 1, 5, 3, 1, 2, 5, 1, 3, 1, 4, 1,
+    2, 9, 10, 2, 7, 1, 2, 1, 2, 7, 7, 3, 14, 3, 2, 3,
+    1, 1, 4, 5, 7, 1, 2, 7, 5, 3, 2, 3, 11, 3, 3, 2,
+    8, 6, 1, 1, 3, 1, 8, 6, 3, 9, 1, 1, 9, 2, 5, 1,
+    3, 7, 1, 10, 7, 3, 3, 1, 2, 1, 1, 2, 1, 1, 2, 2,
+    2, 7, 14, 9, 1, 1, 4, 11, 3, 3, 6, 29, 3, 17, 11, 17,
+    13, 11, 1, 4, 5, 5, 5, 2, 7, 6, 2, 2, 6, 2, 3, 3,
+    7, 1, 5, 8, 4, 4, 9, 2, 3, 3, 5, 4, 3, 3, 19, 1,
+    6, 2, 4, 4, 2, 1, 2, 1, 2, 10, 6, 1, 1, 4, 6, 3,
+    10, 8, 5, 5, 1, 8, 7, 4, 12, 4, 4, 1, 8, 15, 1, 4,
+    5, 2, 2, 2, 1, 2, 7, 4, 3, 2, 1, 5, 10, 2, 2, 3,
+    6, 1, 1, 1, 5, 3, 5, 4, 6, 9, 1, 3, 8, 5, 18, 13,
+    5, 2, 3, 6, 6, 2, 5, 4, 4, 1, 7, 3, 1, 1, 1, 1,
+    1, 3, 5, 1, 2, 2, 3, 1, 2, 1, 1, 4, 2, 1, 1, 2,
+    2, 12, 6, 1, 3, 1, 2, 1, 2, 2, 1, 3, 2, 4, 2, 7,
+    4, 3, 2, 1, 3, 6, 7, 1, 6, 1, 4, 2, 10, 16, 2, 8,
+    2, 4, 6, 5, 7, 1, 1, 2, 8, 10, 5, 1, 9, 4, 4, 9,
+    3, 2, 13, 10, 1, 3, 6, 3, 2, 6, 5, 9, 6, 6, 4, 4,
+    1, 1, 2, 8, 6, 3, 2, 2, 1, 2, 2, 1, 2, 3, 2, 5,
+    3, 2, 1, 2, 5, 1, 2, 1, 1, 1, 2, 1, 2, 1, 1, 1,
+    1, 2, 1, 2, 1, 4, 4, 2, 2, 1, 2, 1, 2, 2, 1, 4,
+    5, 1, 2, 2, 3, 1, 2, 1, 5, 2, 5, 5, 5, 7, 8, 4,
+    1, 1, 3, 4, 2, 2, 1, 3, 1, 1, 3, 2, 1, 1, 4, 9,
+    2, 4, 5, 6, 3, 5, 3, 8, 4, 8, 4, 3, 6, 3, 1, 1,
+    5, 1, 7, 3, 10, 4, 2, 4, 1, 4, 1, 6, 1, 1, 3, 8,
+    4, 2, 1, 6, 14, 9, 7, 2, 4, 2, 13, 2, 9, 2, 4, 3,
+    6, 1, 9, 6, 13, 12, 5, 7, 6, 1, 4, 4, 7, 8, 14, 11,
+    1, 3, 2, 2, 1, 5, 1, 1, 8, 3, 1, 9, 4, 18, 1, 4,
+    2, 1, 1, 1, 3, 2, 9, 4, 10, 3, 1, 7, 3, 3, 1, 4,
+    8, 12, 8, 3, 3, 2, 1, 21, 1, 4, 2, 3, 13, 1, 1, 6,
+    4, 14, 7, 2, 2, 12, 2, 3, 4, 2, 4, 6, 1, 4, 4, 3,
+    2, 3, 7, 1, 1, 8, 4, 2, 6, 9, 3, 2, 5, 1, 2, 3,
+    1, 2, 9, 4, 5, 2, 2, 2, 5, 3, 9, 1, 3, 3, 8, 3,
+    1, 2, 3, 8, 12, 4, 1, 1, 3, 1, 4, 2, 1, 1, 3, 2,
+    1, 1, 3, 1, 3, 9, 3, 11, 1, 7, 1, 4, 1, 3, 5, 1,
+    2, 5, 3, 1, 5, 2, 1, 2, 1, 1, 2, 20, 3, 1, 1, 5,
+    8, 1, 2, 6, 1, 1, 2, 2, 1, 2, 1, 1, 5, 3, 2, 1,
+    2, 2, 1, 1, 3, 2, 2, 5, 1, 3, 12, 4, 2, 10, 2, 1,
+    1, 2, 1, 7, 5, 8, 4, 1, 1, 1, 3, 1, 5, 2, 5, 5,
+    2, 1, 1, 1, 2, 2, 3, 4, 1, 1, 5, 4, 7, 2, 1, 3,
+    5, 2, 1, 3, 4, 4, 9, 2, 3, 3, 1, 2, 1, 2, 2, 12,
+    3, 1, 3, 6, 2, 1, 3, 3, 2, 1, 2, 9, 2, 3, 1, 1,
+    1, 3, 4, 4, 5, 5, 12, 6, 9, 6, 7, 2, 9, 1, 6, 7,
+    2, 3, 1, 11, 3, 5, 2, 6, 6, 1, 2, 1, 8, 11, 4, 2,
+    7, 2, 3, 4, 1, 4, 1, 1, 16, 4, 3, 1, 2, 10, 1, 4,
+    1, 3, 1, 1, 1, 3, 4, 6, 1, 6, 4, 3, 1, 3, 1, 7,
+    3, 1, 9, 1, 1, 3, 4, 1, 2, 2, 1, 3, 3, 4, 1, 2,
+    1, 2, 1, 1, 1, 1, 1, 3, 1, 2, 1, 1, 1, 2, 1, 3,
+    1, 5, 7, 1, 5, 4, 8, 9, 1, 3, 4, 2, 10, 1, 1, 6,
+    3, 2, 4, 1, 1, 3, 2, 1, 1, 17, 1, 15, 4, 2, 7, 4,
+    2, 2, 21, 7, 1, 1, 2, 5, 5, 7, 1, 9, 1, 2, 6, 2,
+    2, 3, 3, 1, 6, 3, 1, 1, 3, 4, 4, 18, 7, 12, 1, 4,
+    4, 6, 1, 3, 3, 1, 5, 7, 7, 3, 20, 11, 6, 14, 6, 5,
+    7, 1, 7, 9, 3, 1, 15, 1, 8, 2, 6, 1, 5, 15, 7, 4,
+    8, 2, 2, 2, 1, 2, 3, 3, 10, 1, 5, 4, 1, 1, 3, 18,
+    2, 11, 6, 7, 4, 12, 6, 1, 7, 13, 14, 6, 13, 3, 1, 3,
+    5, 1, 3, 4, 2, 1, 1, 5, 17, 6, 8, 21, 35, 20, 1, 1,
+    9, 6, 5, 9, 16, 7, 14, 5, 3, 1, 1, 9, 2, 5, 4, 2,
+    5, 2, 1, 1, 3, 2, 3, 1, 2, 5, 3, 3, 5, 3, 8, 4,
+    2, 12, 2, 2, 12, 9, 2, 4, 4, 5, 6, 1, 1, 3, 8, 1,
+    4, 7, 1, 3, 4, 6, 3, 10, 1, 3, 3, 5, 1, 5, 4, 2,
+    1, 7, 2, 7, 3, 3, 1, 3, 5, 2, 5, 1, 1, 3, 14, 6,
+    4, 5, 2, 3, 4, 6, 2, 6, 1, 3, 2, 3, 3, 2, 3, 7,
+    3, 6, 10, 2, 3, 6, 3, 5, 3, 5, 3, 3, 15, 14, 1, 2,
+    2, 11, 1, 7, 6, 3, 2, 4, 2, 3, 1, 11, 1, 4, 7, 1,
+    10, 2, 16, 1, 2, 2, 4, 1, 2, 1, 9, 15, 3, 1, 1, 6,
+    6, 3, 2, 2, 2, 2, 2, 4, 3, 1, 1, 2, 4, 1, 5, 2,
+    1, 4, 2, 2, 7, 1, 5, 5, 1, 1, 2, 1, 1, 8, 3, 8,
+    7, 3, 1, 1, 1, 6, 3, 1, 4, 14, 9, 6, 2, 1, 4, 2,
+    9, 8, 5, 5, 1, 10, 1, 1, 2, 7, 2, 15, 12, 5, 2, 1,
+    2, 4, 2, 2, 12, 9, 1, 5, 1, 6, 7, 2, 2, 10, 1, 1,
+    6, 10, 1, 3, 1, 2, 9, 2, 10, 1, 3, 11, 9, 2, 3, 6,
+    1, 1, 6, 3, 1, 1, 3, 2, 4, 1, 17, 1, 5, 6, 3, 4,
+    4, 14, 1, 8, 1, 13, 5, 2, 2, 7, 7, 2, 2, 1, 8, 1,
+    3, 1, 1, 1, 2, 3, 3, 2, 1, 10, 3, 2, 1, 7, 1, 12,
+    1, 1, 5, 5, 3, 1, 9, 11, 8, 5, 1, 1, 17, 3, 6, 7,
+    16, 2, 6, 12, 12, 2, 2, 8, 4, 4, 3, 9, 2, 17, 12, 1,
+    6, 2, 3, 11, 1, 6, 9, 1, 7, 5, 5, 6, 2, 4, 14, 9,
+    9, 4, 1, 2, 2, 3, 13, 13, 2, 12, 10, 7, 3, 4, 26, 5,
+    6, 24, 11, 4, 3, 1, 4, 2, 8, 4, 2, 2, 12, 3, 6, 5,
+    7, 1, 12, 5, 18, 1, 2, 4, 3, 10, 3, 9, 32, 1, 3, 5,
+    10, 6, 1, 4, 12, 1, 3, 12, 11, 2, 2, 1, 1, 10, 11, 6,
+    3, 2, 2, 1, 15, 1, 2, 3, 2, 3, 2, 9, 2, 1, 1, 2,
+    4, 3, 1, 4, 1, 8, 12, 5, 8, 1, 1, 5, 8, 2, 2, 2,
+    1, 1, 6, 3, 1, 1, 2, 12, 2, 2, 3, 4, 2, 1, 2, 2,
+    1, 2, 2, 6, 2, 2, 1, 1, 3, 3, 1, 5, 7, 14, 10, 27,
+    5, 7, 2, 3, 2, 1, 3, 3, 4, 4, 9, 5, 9, 1, 8, 1,
+    1, 1, 1, 5, 4, 3, 3, 4, 2, 4, 4, 5, 3, 1, 6, 1,
+    1, 5, 1, 1, 7, 2, 4, 15, 12, 2, 2, 2, 2, 1, 9, 13,
+    7, 2, 3, 3, 2, 13, 3, 2, 28, 9, 3, 8, 9, 7, 6, 2,
+    3, 3, 2, 10, 2, 3, 1, 3, 1, 1, 2, 2, 2, 1, 1, 3,
+    1, 24, 3, 1, 3, 9, 2, 2, 1, 2, 1, 2, 1, 3, 5, 1,
+    1, 1, 10, 5, 12, 2, 5, 1, 2, 1, 4, 1, 3, 1, 1, 1,
+    1, 1, 4, 1, 2, 4, 12, 4, 14, 16, 1, 4, 3, 1, 2, 2,
+    1, 3, 4, 4, 2, 5, 4, 3, 6, 11, 2, 5, 7, 2, 3, 7,
+    4, 8, 1, 8, 1, 1, 5, 2, 1, 8, 8, 5, 3, 9, 4, 1,
+    7, 8, 16, 9, 9, 1, 1, 7, 13, 1, 1, 17, 1, 2, 2, 4,
+    4, 4, 3, 1, 2, 3, 1, 5, 26, 21, 17, 3, 10, 6, 5, 7,
+    3, 6, 7, 8, 3, 3, 1, 2, 5, 4, 6, 8, 8, 2, 3, 6,
+    4, 1, 8, 5, 9, 4, 1, 7, 2, 21, 11, 2, 26, 3, 1, 18,
+    3, 15, 2, 1, 2, 18, 17, 10, 5, 1, 10, 1, 7, 1, 5, 14,
+    2, 1, 5, 8, 6, 2, 2, 5, 9, 2, 3, 23, 1, 22, 10, 9,
+    11, 1, 8, 5, 3, 8, 2, 4, 3, 7, 2, 13, 1, 4, 23, 5,
+    1, 8, 2, 2, 2, 6, 9, 2, 3, 2, 3, 4, 2, 3, 6, 1,
+    10, 3, 2, 1, 6, 4, 3, 1, 2, 2, 1, 12, 1, 6, 1, 2,
+    6, 2, 1, 3, 9, 1, 1, 3, 13, 1, 2, 1, 1, 7, 11, 1,
+    4, 2, 5, 11, 1, 6, 6, 2, 1, 5, 5, 1, 1, 3, 11, 3,
+    1, 1, 5, 5, 2, 6, 1, 1, 4, 3, 4, 6, 5, 3, 6, 2,
+    1, 5, 7, 1, 8, 6, 2, 1, 4, 2, 3, 6, 1, 2, 2, 8,
+    4, 5, 2, 5, 11, 2, 3, 1, 1, 4, 1, 4, 2, 3, 3, 1,
+    2, 2, 1, 7, 3, 3, 4, 2, 1, 1, 1, 14, 1, 2, 3, 1,
+    6, 1, 11, 4, 5, 11, 1, 1, 7, 1, 1, 3, 8, 2, 6, 4,
+    8, 3, 2, 9, 10, 3, 14, 1, 4, 4, 3, 1, 3, 6, 13, 1,
+    1, 3, 17, 2, 3, 1, 4, 4, 4, 7, 3, 4, 5, 1, 1, 3,
+    12, 1, 3, 2, 7, 1, 3, 3, 1, 3, 2, 2, 2, 6, 6, 5,
+    2, 3, 2, 2, 8, 11, 2, 1, 6, 2, 2, 3, 4, 10, 1, 2,
+    8, 10, 7, 1, 4, 7, 1, 1, 5, 6, 9, 7, 2, 4, 4, 3,
+    2, 2, 8, 2, 9, 3, 11, 3, 3, 4, 3, 3, 1, 3, 5, 20,
+    3, 2, 1, 3, 2, 2, 2, 2, 1, 1, 2, 18, 16, 1, 1, 11,
+    3, 3, 2, 10, 4, 9, 17, 2, 1, 7, 8, 5, 15, 3, 10, 21,
+    2, 6, 9, 26, 11, 1, 1, 3, 5, 3, 3, 1, 6, 4, 4, 1,
+    1, 2, 6, 2, 2, 5, 3, 3, 3, 10, 1, 2, 3, 10, 4, 1,
+    1, 3, 1, 0, 1, 3, 12, 9, 8, 1, 12, 7, 2, 6, 8, 9,
+    3, 5, 9, 2, 5, 29, 10, 9, 4, 6, 2, 1, 10, 1, 16, 1,
+    3, 11, 1, 2, 2, 9, 3, 2, 1, 8, 5, 3, 6, 6, 6, 1,
+    1, 3, 2, 6, 4, 3, 9, 1, 4, 5, 13, 5, 9, 13, 15, 1,
+    3, 12, 2, 2, 4, 21, 2, 6, 8, 3, 3, 2, 6, 5, 7, 8,
+    2, 1, 7, 3, 5, 5, 4, 9, 7, 10, 10, 5, 4, 3, 1, 9,
+    15, 6, 1, 1, 5, 5, 1, 2, 11, 3, 1, 9, 1, 10, 21, 7,
+    5, 2, 1, 1, 5, 5, 5, 14, 4, 1, 1, 5, 6, 5, 5, 4,
+    3, 9, 2, 11, 2, 3, 7, 3, 3, 2, 1, 5, 5, 2, 2, 9,
+    7, 1, 7, 7, 3, 2, 5, 4, 2, 5, 8, 5, 8, 14, 2, 15,
+    4, 3, 2, 4, 3, 1, 4, 5, 1, 12, 4, 6, 20, 11, 6, 6,
+    2, 3, 1, 1, 1, 1, 3, 1, 4, 6, 19, 2, 3, 2, 7, 1,
+    1, 2, 12, 8, 1, 2, 11, 3, 1, 2, 3, 5, 5, 4, 5, 9,
+    4, 2, 3, 1, 4, 2, 5, 1, 2, 3, 6, 4, 1, 2, 1, 7,
+    2, 5, 7, 8, 3, 5, 7, 1, 9, 1, 4, 3, 2, 1, 12, 2,
+    7, 2, 9, 6, 5, 3, 5, 8, 1, 1, 10, 8, 12, 4, 1, 1,
+    1, 12, 3, 7, 10, 2, 10, 4, 3, 22, 6, 6, 1, 5, 5, 2,
+    11, 9, 3, 3, 1, 2, 6, 16, 5, 3, 13, 8, 3, 2, 6, 1,
+    11, 6, 18, 6, 2, 2, 6, 2, 2, 17, 3, 2, 3, 1, 9, 21,
+    6, 2, 1, 1, 12, 11, 18, 26, 5, 12, 6, 2, 2, 8, 1, 5,
+    7, 2, 3, 3, 4, 1, 1, 11, 16, 1, 1, 1, 7, 2, 5, 7,
+    2, 6, 4, 2, 1, 3, 2, 4, 20, 5, 2, 1, 1, 3, 1, 3,
+    6, 3, 2, 2, 3, 4, 3, 30, 1, 19, 2, 21, 7, 9, 8, 11,
+    1, 4, 1, 2, 3, 3, 6, 1, 9, 9, 3, 2, 1, 1, 1, 1,
+    6, 5, 1, 1, 5, 2, 4, 1, 2, 3, 3, 8, 5, 1, 1, 1,
+    1, 2, 4, 1, 5, 1, 1, 9, 1, 1, 4, 2, 1, 7, 1, 4,
+    1, 2, 1, 1, 1, 2, 8, 1, 6, 3, 1, 1, 2, 1, 4, 4,
+    1, 4, 3, 1, 5, 6, 1, 2, 5, 2, 1, 2, 5, 2, 2, 4,
+    1, 9, 1, 3, 2, 1, 2, 3, 1, 4, 3, 3, 7, 5, 1, 4,
+    6, 2, 5, 7, 4, 2, 1, 4, 2, 2, 4, 4, 1, 17, 18, 5,
+    24, 1, 10, 5, 4, 18, 3, 2, 4, 8, 2, 8, 4, 2, 1, 1,
+    3, 6, 1, 1, 12, 1, 2, 27, 5, 13, 5, 3, 1, 6, 7, 1,
+    2, 6, 3, 2, 2, 8, 1, 8, 3, 1, 2, 3, 2, 3, 1, 8,
+    1, 5, 2, 1, 1, 7, 5, 2, 8, 2, 1, 5, 5, 8, 1, 16,
+    8, 18, 6, 3, 2, 5, 1, 1, 3, 1, 1, 2, 2, 1, 1, 5,
+    3, 5, 6, 11, 5, 3, 2, 4, 1, 2, 1, 14, 1, 16, 4, 1,
+    3, 2, 1, 13, 3, 5, 6, 3, 5, 5, 3, 1, 2, 1, 5, 3,
+    2, 1, 6, 5, 3, 1, 4, 1, 4, 4, 5, 8, 2, 3, 2, 5,
+    2, 4, 16, 5, 13, 4, 3, 4, 3, 5, 1, 3, 3, 8, 1, 1,
+    1, 3, 4, 1, 13, 10, 1, 8, 1, 3, 5, 1, 1, 4, 5, 1,
+    7, 5, 3, 4, 1, 6, 1, 2, 3, 2, 1, 4, 3, 3, 6, 1,
+    8, 3, 1, 2, 10, 3, 2, 3, 4, 1, 1, 1, 5, 2, 1, 2,
+    2, 4, 4, 3, 2, 3, 4, 4, 1, 1, 3, 3, 3, 1, 4, 2,
+    2, 2, 3, 7, 1, 3, 15, 6, 4, 4, 6, 4, 14, 10, 1, 1,
+    4, 8, 2, 1, 5, 5, 12, 6, 6, 5, 3, 5, 6, 8, 6, 5,
+    1, 13, 6, 6, 34, 1, 16, 5, 5, 4, 1, 17, 1, 6, 3, 2,
+    5, 1, 4, 1, 9, 6, 6, 1, 7, 1, 3, 5, 1, 2, 14, 3,
+    14, 3, 3, 7, 3, 3, 8, 6, 1, 1, 2, 3, 1, 1, 2, 3,
+    2, 1, 1, 1, 2, 7, 1, 2, 1, 1, 3, 2, 1, 11, 3, 1,
+    11, 4, 4, 5, 2, 8, 4, 1, 3, 1, 5, 10, 2, 2, 7, 5,
+    6, 1, 1, 3, 5, 1, 1, 2, 1, 11, 1, 2, 4, 13, 6, 1,
+    2, 1, 2, 1, 5, 1, 4, 1, 2, 10, 6, 2, 1, 4, 2, 1,
+    3, 12, 17, 3, 10, 7, 2, 4, 2, 1, 8, 1, 4, 3, 34, 4,
+    5, 2, 3, 1, 4, 1, 4, 8, 5, 6, 3, 3, 8, 2, 2, 5,
+    1, 15, 2, 5, 7, 1, 18, 1, 12, 1, 2, 3, 8, 5, 3, 2,
+    3, 8, 1, 12, 3, 1, 7, 2, 6, 7, 3, 2, 1, 3, 5, 3,
+    4, 2, 1, 12, 3, 1, 7, 4, 2, 6, 16, 6, 5, 10, 6, 3,
+    1, 5, 1, 4, 1, 6, 9, 4, 1, 4, 1, 1, 2, 10, 5, 9,
+    5, 1, 17, 15, 2, 4, 2, 1, 1, 2, 3, 6, 1, 3, 4, 6,
+    2, 1, 5, 3, 1, 1, 6, 5, 1, 3, 1, 1, 1, 3, 3, 6,
+    10, 5, 3, 1, 4, 1, 1, 14, 1, 1, 6, 1, 1, 1, 2, 16,
+    11, 8, 1, 2, 1, 9, 5, 2, 1, 2, 5, 3, 6, 7, 24, 9,
+    3, 4, 1, 3, 1, 1, 3, 7, 9, 5, 2, 13, 10, 9, 2, 2,
+    21, 12, 6, 2, 8, 15, 14, 5, 8, 8, 2, 2, 2, 11, 5, 3,
+    0, 3, 9, 2, 37, 1, 8, 1, 1, 4, 1, 2, 1, 12, 2, 3,
+    14, 6, 3, 6, 1, 2, 6, 5, 2, 1, 9, 1, 1, 9, 2, 5,
+    13, 16, 3, 15, 2, 6, 3, 13, 3, 2, 4, 1, 3, 7, 2, 2,
+    1, 3, 5, 7, 1, 5, 12, 7, 3, 11, 8, 3, 2, 11, 7, 5,
+    11, 3, 1, 5, 1, 6, 2, 2, 2, 3, 1, 3, 2, 9, 3, 14,
+    6, 1, 7, 6, 7, 1, 9, 1, 4, 10, 6, 3, 1, 2, 3, 9,
+    1, 1, 2, 3, 5, 3, 2, 4, 3, 3, 7, 3, 1, 1, 10, 1,
+    14, 7, 10, 10, 5, 14, 3, 5, 5, 2, 3, 1, 5, 4, 2, 1,
+    1, 2, 6, 2, 3, 1, 1, 1, 3, 2, 8, 2, 3, 6, 7, 5,
+    5, 1, 6, 1, 8, 1, 3, 3, 3, 4, 1, 7, 1, 5, 3, 2,
+    2, 1, 3, 2, 1, 1, 2, 1, 6, 1, 1, 1, 7, 1, 8, 3,
+    2, 2, 2, 1, 4, 5, 4, 1, 4, 2, 3, 1, 2, 2, 1, 2,
+    8, 13, 2, 1, 2, 7, 3, 3, 1, 7, 4, 1, 7, 7, 2, 1,
+    3, 1, 1, 1, 1, 2, 3, 6, 3, 3, 4, 8, 10, 5, 2, 1,
+    5, 4, 1, 2, 3, 1, 8, 9, 3, 2, 3, 13, 3, 1, 6, 2,
+    7, 2, 2, 1, 1, 11, 2, 3, 4, 1, 1, 4, 4, 8, 4, 2,
+    5, 2, 1, 1, 1, 1, 3, 6, 1, 1, 2, 1, 7, 2, 1, 2,
+    1, 8, 14, 8, 1, 2, 1, 3, 3, 6, 1, 3, 1, 1, 2, 15,
+    3, 2, 6, 1, 2, 8, 4, 2, 10, 8, 2, 6, 2, 3, 1, 2,
+    6, 1, 7, 3, 3, 1, 1, 1, 9, 1, 1, 5, 1, 1, 2, 4,
+    2, 6, 1, 4, 5, 1, 3, 9, 2, 5, 1, 2, 2, 3, 6, 2,
+    1, 8, 2, 2, 1, 1, 14, 14, 14, 2, 1, 5, 3, 4, 4, 2,
+    6, 9, 2, 1, 1, 1, 2, 1, 2, 1, 1, 4, 2, 11, 9, 7,
+    9, 2, 8, 3, 6, 3, 2, 1, 26, 4, 15, 3, 1, 6, 2, 1,
+    17, 9, 1, 3, 2, 1, 1, 2, 1, 7, 6, 1, 13, 2, 1, 3,
+    1, 2, 13, 1, 2, 1, 2, 2, 3, 1, 3, 10, 1, 3, 4, 1,
+    2, 2, 4, 5, 1, 1, 1, 6, 6, 3, 3, 1, 1, 5, 1, 2,
+    1, 8, 5, 5, 5, 6, 5, 1, 12, 9, 3, 4, 10, 11, 3, 3,
+    3, 1, 10, 2, 1, 20, 8, 1, 2, 9, 1, 5, 5, 8, 13, 1,
+    1, 5, 8, 3, 2, 8, 3, 9, 23, 4, 9, 2, 1, 6, 2, 7,
+    3, 2, 1, 5, 2, 3, 5, 2, 9, 3, 8, 7, 2, 3, 1, 1,
+    3, 18, 15, 1, 8, 5, 13, 8, 1, 10, 1, 2, 5, 8, 6, 8,
+    9, 7, 11, 3, 2, 12, 2, 5, 5, 1, 1, 1, 10, 3, 3, 1,
+    3, 2, 2, 4, 1, 4, 5, 2, 1, 1, 1, 2, 10, 2, 3, 5,
+    9, 1, 1, 1, 3, 5, 1, 1, 1, 5, 4, 5, 3, 2, 2, 2,
+    2, 6, 1, 7, 3, 2, 3, 1, 5, 3, 3, 3, 3, 10, 3, 4,
+    1, 1, 3, 1, 3, 2, 3, 1, 3, 3, 2, 1, 1, 5, 1, 9,
+    4, 6, 1, 4, 2, 1, 6, 2, 4, 5, 9, 7, 1, 2, 2, 2,
+    7, 9, 1, 3, 2, 6, 2, 1, 1, 4, 1, 7, 1, 1, 4, 3,
+    2, 2, 1, 1, 3, 7, 3, 3, 1, 2, 3, 1, 8, 2, 1, 1,
+    5, 1, 1, 5, 6, 1, 2, 1, 1, 1, 3, 2, 3, 1, 2, 9,
+    1, 1, 2, 3, 2, 1, 4, 2, 2, 1, 2, 1, 1, 1, 2, 2,
+    4, 1, 3, 2, 3, 1, 1, 1, 1, 4, 4, 5, 4, 3, 11, 1,
+    5, 3, 9, 6, 2, 3, 11, 1, 6, 1, 1, 3, 7, 5, 16, 1,
+    2, 9, 1, 1, 2, 1, 4, 1, 1, 8, 3, 10, 4, 8, 3, 3,
+    3, 5, 3, 2, 7, 3, 2, 2, 5, 1, 4, 8, 6, 9, 2, 1,
+    2, 4, 2, 6, 1, 1, 1, 2, 10, 2, 2, 4, 6, 1, 2, 4,
+    3, 3, 1, 2, 2, 5, 7, 2, 2, 2, 3, 2, 2, 2, 12, 1,
+    1, 10, 3, 1, 3, 2, 6, 10, 2, 12, 2, 2, 14, 1, 1, 15,
+    1, 3, 6, 4, 1, 11, 3, 2, 1, 20, 2, 3, 6, 1, 15, 1,
+    10, 4, 14, 2, 2, 9, 9, 1, 2, 4, 13, 3, 2, 5, 1, 1,
+    2, 6, 4, 5, 3, 6, 2, 1, 5, 5, 1, 4, 4, 3, 1, 4,
+    12, 1, 1, 1, 1, 1, 2, 6, 1, 1, 4, 6, 2, 2, 1, 2,
+    2, 3, 4, 1, 6, 5, 8, 1, 2, 3, 3, 2, 21, 2, 3, 4,
+    2, 1, 5, 1, 8, 1, 11, 5, 1, 4, 5, 4, 3, 5, 5, 3,
+    2, 7, 1, 5, 3, 3, 1, 1, 2, 6, 1, 2, 9, 5, 3, 6,
+    5, 9, 2, 1, 2, 1, 1, 2, 1, 1, 2, 2, 1, 1, 7, 1,
+    2, 1, 1, 1, 2, 1, 1, 1, 2, 1, 3, 1, 1, 1, 2, 6,
+    2, 1, 3, 2, 1, 4, 1, 5, 1, 7, 4, 2, 1, 5, 7, 4,
+    10, 5, 6, 4, 10, 1, 3, 3, 1, 1, 1, 3, 7, 1, 5, 2,
+    1, 2, 3, 7, 2, 1, 1, 10, 1, 3, 4, 7, 5, 1, 3, 1,
+    2, 2, 2, 2, 1, 1, 3, 2, 3, 6, 1, 2, 6, 1, 2, 2,
+    2, 1, 6, 2, 3, 2, 1, 3, 1, 5, 2, 1, 10, 3, 4, 2,
+    1, 2, 8, 8, 9, 2, 11, 10, 1, 1, 2, 4, 1, 4, 5, 8,
+    6, 4, 3, 2, 9, 2, 11, 5, 10, 1, 7, 5, 8, 4, 3, 1,
+    2, 5, 14, 15, 1, 7, 2, 5, 7, 1, 2, 1, 1, 7, 1, 9,
+    2, 1, 2, 8, 11, 3, 3, 1, 3, 1, 1, 4, 1, 2, 2, 3,
+    2, 7, 2, 9, 10, 1, 1, 1, 4, 5, 2, 8, 4, 18, 4, 11,
+    10, 2, 17, 8, 2, 9, 3, 3, 3, 1, 6, 9, 3, 3, 12, 2,
+    7, 1, 6, 1, 5, 5, 7, 1, 3, 10, 13, 2, 4, 3, 1, 5,
+    2, 1, 2, 3, 3, 4, 6, 3, 7, 7, 5, 3, 6, 2, 5, 2,
+    8, 1, 19, 3, 1, 12, 2, 5, 4, 7, 5, 2, 2, 7, 9, 2,
+    1, 5, 14, 16, 1, 11, 13, 7, 1, 2, 1, 2, 3, 1, 23, 9,
+    2, 3, 7, 3, 15, 2, 4, 11, 4, 7, 11, 16, 13, 3, 3, 3,
+    4, 10, 8, 2, 11, 2, 2, 19, 1, 4, 3, 9, 19, 2, 7, 3,
+    2, 5, 3, 4, 5, 4, 4, 4, 1, 6, 7, 9, 1, 3, 13, 6,
+    6, 19, 7, 22, 1, 3, 5, 4, 4, 1, 12, 15, 16, 2, 4, 6,
+    1, 2, 6, 5, 1, 1, 8, 2, 14, 1, 2, 4, 2, 11, 4, 1,
+    1, 4, 4, 2, 8, 1, 3, 2, 2, 9, 3, 1, 2, 1, 3, 3,
+    4, 11, 3, 14, 3, 12, 4, 1, 10, 3, 3, 1, 2, 14, 2, 3,
+    9, 8, 4, 3, 11, 4, 1, 6, 6, 7, 5, 7, 1, 4, 3, 1,
+    5, 3, 7, 1, 5, 2, 1, 3, 5, 3, 1, 3, 2, 2, 5, 2,
+    1, 1, 6, 1, 5, 1, 4, 8, 1, 1, 1, 1, 1, 8, 3, 1,
+    1, 9, 6, 2, 3, 4, 4, 2, 1, 4, 1, 2, 1, 4, 2, 3,
+    4, 1, 6, 2, 3, 6, 9, 1, 8, 2, 7, 8, 3, 6, 2, 1,
+    7, 16, 11, 3, 8, 3, 1, 3, 8, 9, 3, 2, 6, 1, 6, 9,
+    1, 4, 2, 5, 2, 1, 3, 2, 2, 3, 1, 1, 2, 4, 5, 10,
+    1, 2, 2, 2, 2, 3, 2, 2, 5, 5, 13, 1, 3, 4, 3, 8,
+    5, 4, 12, 5, 4, 2, 5, 1, 1, 2, 2, 3, 7, 7, 2, 2,
+    3, 3, 6, 1, 2, 1, 21, 9, 2, 3, 5, 4, 1, 7, 27, 6,
+    6, 1, 4, 3, 7, 2, 2, 3, 13, 2, 1, 9, 3, 10, 3, 6,
+    1, 10, 3, 8, 4, 5, 2, 4, 3, 10, 3, 11, 2, 4, 6, 9,
+    15, 1, 17, 3, 2, 5, 2, 2, 11, 14, 2, 6, 4, 1, 1, 3,
+    7, 6, 1, 2, 11, 9, 2, 4, 1, 2, 5, 8, 2, 1, 5, 5,
+    1, 10, 31, 9, 3, 3, 1, 3, 10, 3, 14, 4, 5, 2, 1, 2,
+    2, 2, 1, 1, 4, 4, 2, 6, 1, 4, 3, 2, 1, 3, 6, 1,
+    1, 1, 7, 2, 2, 7, 2, 1, 12, 2, 7, 7, 2, 10, 2, 17,
+    4, 7, 3, 3, 1, 6, 2, 5, 4, 1, 1, 2, 5, 5, 2, 1,
+    8, 1, 4, 1, 2, 3, 1, 30, 5, 6, 8, 1, 6, 2, 7, 2,
+    14, 2, 2, 2, 2, 3, 7, 2, 6, 4, 2, 9, 3, 3, 3, 6,
+    2, 1, 16, 3, 3, 7, 1, 3, 5, 4, 4, 4, 8, 1, 4, 2,
+    7, 2, 1, 3, 1, 5, 5, 8, 3, 2, 2, 1, 1, 10, 3, 1,
+    2, 1, 2, 9, 2, 3, 8, 4, 2, 2, 4, 1, 1, 3, 2, 5,
+    7, 5, 14, 2, 3, 1, 5, 1, 6, 2, 1, 1, 2, 7, 6, 6,
+    3, 6, 1, 2, 5, 3, 6, 1, 4, 4, 6, 6, 1, 11, 6, 4,
+    1, 5, 3, 2, 1, 3, 3, 1, 4, 2, 4, 2, 2, 1, 5, 1,
+    1, 5, 2, 1, 2, 3, 1, 1, 4, 4, 2, 6, 1, 2, 4, 3,
+    7, 6, 3, 3, 1, 1, 1, 1, 2, 1, 2, 11, 6, 9, 2, 9,
+    8, 4, 1, 5, 1, 3, 12, 1, 3, 1, 1, 5, 11, 1, 10, 2,
+    1, 1, 1, 1, 6, 2, 4, 3, 4, 5, 1, 1, 5, 9, 1, 3,
+    4, 8, 1, 4, 5, 3, 3, 2, 1, 2, 2, 5, 5, 1, 3, 1,
+    8, 2, 3, 10, 1, 1, 1, 8, 3, 4, 2, 4, 1, 2, 3, 3,
+    10, 2, 1, 8, 1, 1, 1, 3, 1, 1, 5, 17, 1, 3, 5, 1,
+    1, 1, 1, 4, 4, 4, 1, 1, 3, 1, 4, 2, 5, 2, 3, 2,
+    2, 5, 5, 7, 2, 13, 2, 2, 3, 2, 1, 1, 1, 12, 1, 5,
+    1, 7, 1, 35, 1, 1, 1, 4, 2, 4, 7, 1, 2, 1, 1, 4,
+    2, 1, 1, 8, 8, 2, 14, 12, 10, 4, 3, 1, 2, 1, 3, 1,
+    6, 3, 3, 4, 6, 1, 10, 2, 4, 9, 1, 2, 11, 12, 5, 1,
+    9, 4, 5, 1, 1, 8, 1, 3, 2, 1, 1, 9, 3, 6, 1, 4,
+    7, 1, 2, 10, 7, 1, 3, 1, 2, 3, 1, 1, 9, 1, 3, 3,
+    9, 1, 1, 2, 1, 2, 1, 2, 5, 1, 5, 3, 1, 3, 4, 2,
+    7, 1, 3, 3, 7, 1, 4, 4, 1, 1, 1, 1, 2, 2, 11, 1,
+    8, 15, 5, 2, 6, 10, 7, 23, 6, 5, 1, 1, 5, 1, 5, 4,
+    9, 1, 11, 1, 15, 1, 4, 2, 15, 11, 5, 1, 6, 22, 19, 6,
+    6, 3, 2, 2, 4, 1, 7, 6, 4, 2, 2, 3, 4, 1, 2, 1,
+    2, 1, 2, 4, 1, 2, 3, 1, 1, 6, 5, 2, 7, 9, 11, 2,
+    19, 11, 1, 2, 5, 3, 15, 4, 5, 1, 7, 10, 7, 2, 10, 2,
+    20, 6, 5, 6, 8, 6, 3, 2, 1, 4, 1, 1, 1, 8, 6, 6,
+    2, 5, 2, 1, 1, 3, 8, 18, 3, 7, 6, 2, 2, 8, 3, 9,
+    1, 2, 6, 4, 1, 1, 1, 2, 1, 5, 1, 1, 3, 16, 3, 4,
+    8, 10, 1, 2, 3, 3, 9, 17, 7, 2, 6, 7, 10, 1, 1, 3,
+    11, 9, 14, 31, 2, 2, 7, 1, 1, 9, 6, 9, 3, 1, 1, 1,
+    2, 22, 6, 3, 3, 2, 1, 4, 7, 2, 8, 10, 6, 12, 2, 1,
+    1, 2, 4, 4, 3, 5, 1, 5, 3, 1, 1, 2, 1, 12, 2, 3,
+    4, 5, 3, 1, 2, 2, 6, 2, 1, 5, 3, 2, 6, 1, 2, 5,
+    3, 13, 22, 8, 9, 3, 1, 5, 4, 4, 7, 1, 2, 4, 1, 2,
+    3, 1, 4, 13, 4, 2, 5, 2, 3, 7, 7, 4, 2, 4, 3, 6,
+    10, 8, 5, 5, 9, 6, 3, 9, 9, 4, 1, 1, 8, 1, 2, 1,
+    3, 5, 2, 1, 2, 2, 2, 3, 4, 5, 1, 1, 1, 4, 10, 1,
+    4, 10, 14, 1, 3, 8, 1, 1, 1, 1, 5, 4, 1, 7, 4, 2,
+    5, 1, 14, 3, 1, 9, 3, 4, 1, 1, 1, 2, 2, 1, 1, 1,
+    1, 12, 3, 3, 1, 3, 1, 3, 5, 2, 16, 2, 7, 2, 7, 6,
+    9, 1, 3, 11, 4, 11, 2, 4, 4, 6, 14, 2, 10, 8, 12, 16,
+    1, 14, 3, 5, 1, 8, 3, 3, 1, 2, 3, 4, 3, 6, 1, 3,
+    5, 20, 2, 3, 6, 2, 4, 3, 2, 2, 2, 1, 9, 7, 9, 1,
+    2, 1, 1, 10, 9, 1, 4, 3, 3, 6, 1, 3, 8, 19, 6, 1,
+    3, 7, 5, 5, 5, 6, 2, 5, 8, 2, 7, 2, 7, 5, 12, 13,
+    1, 2, 16, 2, 7, 13, 3, 3, 1, 2, 1, 10, 3, 3, 1, 3,
+    24, 6, 1, 17, 1, 1, 5, 7, 1, 3, 1, 6, 4, 3, 15, 5,
+    2, 5, 10, 4, 5, 1, 1, 12, 2, 4, 6, 4, 2, 4, 4, 4,
+    1, 1, 2, 15, 2, 2, 6, 5, 3, 5, 4, 5, 7, 2, 2, 3,
+    3, 8, 5, 2, 1, 5, 1, 5, 2, 4, 5, 12, 1, 1, 2, 2,
+    21, 3, 1, 5, 9, 14, 9, 6, 2, 7, 11, 5, 6, 2, 5, 12,
+    10, 2, 4, 3, 10, 1, 1, 8, 18, 1, 5, 1, 4, 4, 6, 4,
+    11, 4, 2, 1, 4, 2, 11, 9, 1, 1, 1, 4, 3, 2, 1, 4,
+    1, 4, 2, 11, 1, 2, 3, 10, 12, 5, 5, 1, 8, 14, 5, 4,
+    1, 6, 8, 3, 8, 2, 12, 4, 1, 4, 2, 6, 8, 6, 2, 1,
+    1, 1, 2, 11, 2, 10, 1, 2, 1, 1, 1, 1, 1, 9, 4, 7,
+    2, 5, 2, 2, 7, 6, 2, 3, 7, 4, 2, 6, 5, 2, 2, 1,
+    11, 2, 5, 4, 11, 1, 6, 4, 9, 8, 2, 5, 5, 2, 8, 3,
+    7, 10, 13, 8, 12, 4, 2, 7, 5, 4, 4, 3, 1, 2, 2, 1,
+    4, 2, 11, 9, 2, 16, 4, 6, 5, 2, 2, 3, 6, 1, 2, 1,
+    14, 9, 3, 12, 26, 5, 5, 2, 3, 10, 3, 4, 13, 1, 9, 2,
+    2, 3, 11, 5, 14, 12, 4, 5, 6, 9, 3, 7, 15, 4, 6, 10,
+    7, 10, 9, 4, 16, 12, 5, 1, 9, 3, 5, 10, 1, 13, 7, 2,
+    4, 13, 7, 6, 11, 1, 1, 3, 9, 11, 10, 2, 4, 1, 3, 9,
+    3, 4, 1, 2, 2, 2, 8, 6, 2, 1, 4, 2, 9, 4, 8, 6,
+    5, 2, 10, 7, 7, 3, 5, 2, 17, 2, 1, 2, 1, 16, 7, 3,
+    6, 6, 5, 3, 10, 1, 1, 5, 9, 4, 10, 3, 11, 4, 15, 5,
+    14, 1, 2, 1, 6, 3, 1, 2, 1, 3, 1, 1, 3, 1, 2, 6,
+    1, 2, 2, 1, 2, 6, 1, 1, 4, 1, 1, 3, 2, 3, 1, 3,
+    2, 2, 1, 4, 9, 2, 7, 1, 4, 4, 1, 1, 6, 1, 1, 3,
+    3, 1, 2, 6, 1, 2, 1, 2, 1, 3, 3, 3, 1, 4, 3, 1,
+    6, 4, 2, 2, 3, 1, 13, 3, 1, 1, 6, 1, 1, 2, 7, 3,
+    4, 3, 3, 1, 1, 2, 1, 3, 7, 1, 2, 4, 6, 1, 1, 2,
+    2, 1, 1, 1, 1, 1, 3, 5, 6, 5, 4, 12, 2, 6, 2, 7,
+    6, 2, 7, 4, 14, 5, 1, 6, 5, 7, 6, 3, 3, 1, 2, 1,
+    8, 1, 1, 5, 2, 2, 2, 9, 1, 2, 1, 1, 1, 1, 2, 1,
+    2, 4, 11, 1, 1, 1, 5, 2, 1, 2, 3, 1, 4, 3, 1, 2,
+    1, 1, 3, 3, 7, 1, 6, 1, 1, 1, 2, 7, 3, 2, 1, 4,
+    2, 1, 1, 2, 2, 1, 1, 2, 1, 2, 11, 8, 6, 1, 3, 14,
+    4, 1, 13, 6, 3, 7, 5, 2, 5, 1, 1, 1, 3, 8, 3, 1,
+    2, 1, 2, 3, 1, 2, 1, 1, 8, 6, 1, 3, 4, 2, 3, 2,
+    9, 12, 2, 3, 1, 2, 19, 11, 3, 5, 8, 7, 4, 9, 1, 2,
+    3, 7, 6, 3, 10, 32, 1, 5, 3, 4, 6, 14, 5, 1, 11, 1,
+    3, 1, 5, 3, 11, 12, 3, 2, 1, 21, 2, 7, 4, 2, 13, 3,
+    7, 16, 3, 2, 16, 3, 12, 5, 1, 6, 1, 8, 1, 1, 23, 4,
+    4, 1, 3, 1, 10, 10, 4, 2, 1, 2, 7, 2, 19, 6, 3, 1,
+    1, 4, 2, 9, 5, 3, 2, 9, 11, 13, 5, 4, 1, 12, 1, 6,
+    5, 3, 5, 2, 20, 1, 11, 1, 2, 11, 3, 2, 1, 1, 2, 2,
+    15, 7, 2, 1, 2, 3, 4, 2, 1, 2, 2, 2, 1, 3, 6, 2,
+    1, 14, 5, 3, 6, 5, 1, 4, 5, 6, 9, 4, 1, 5, 2, 2,
+    5, 4, 3, 1, 2, 2, 4, 1, 6, 3, 5, 5, 6, 5, 2, 1,
+    16, 6, 5, 29, 2, 3, 12, 3, 5, 5, 6, 1, 2, 1, 7, 1,
+    1, 3, 1, 3, 1, 1, 2, 2, 7, 5, 5, 1, 3, 1, 6, 1,
+    1, 2, 1, 2, 1, 5, 1, 5, 4, 4, 5, 15, 1, 3, 3, 1,
+    1, 3, 2, 3, 1, 4, 3, 4, 2, 2, 2, 9, 4, 4, 16, 1,
+    4, 3, 5, 3, 5, 14, 3, 15, 16, 10, 9, 2, 3, 1, 8, 3,
+    10, 2, 2, 4, 2, 5, 5, 5, 5, 6, 9, 3, 6, 10, 1, 5,
+    2, 2, 3, 1, 1, 3, 3, 5, 3, 6, 4, 9, 1, 2, 1, 6,
+    2, 1, 1, 5, 11, 7, 4, 8, 15, 2, 4, 3, 1, 3, 3, 2,
+    10, 10, 2, 4, 4, 3, 2, 2, 6, 6, 12, 1, 1, 8, 4, 3,
+    13, 6, 3, 10, 3, 16, 11, 4, 12, 6, 3, 1, 8, 5, 9, 7,
+    7, 1, 13, 5, 1, 3, 3, 1, 15, 4, 22, 2, 1, 6, 6, 1,
+    3, 1, 3, 3, 13, 13, 2, 2, 2, 8, 5, 7, 3, 7, 8, 22,
+    6, 13, 5, 3, 2, 4, 2, 1, 8, 1, 7, 13, 5, 2, 1, 10,
+    1, 1, 2, 2, 3, 1, 3, 1, 2, 2, 1, 3, 13, 3, 2, 6,
+    2, 13, 3, 2, 4, 7, 3, 11, 17, 1, 2, 1, 22, 1, 7, 2,
+    6, 1, 1, 22, 1, 1, 2, 8, 2, 2, 21, 3, 3, 5, 1, 6,
+    1, 8, 4, 2, 1, 4, 12, 6, 8, 3, 8, 8, 2, 1, 4, 1,
+    4, 10, 2, 6, 1, 1, 4, 9, 1, 1, 1, 4, 2, 2, 10, 4,
+    3, 10, 8, 6, 4, 2, 3, 6, 8, 1, 6, 1, 3, 1, 2, 2,
+    1, 7, 9, 6, 4, 7, 2, 1, 2, 1, 3, 1, 15, 1, 8, 3,
+    3, 3, 2, 1, 1, 4, 1, 2, 1, 7, 2, 3, 1, 2, 1, 1,
+    1, 3, 2, 1, 2, 1, 1, 2, 7, 1, 1, 1, 5, 1, 3, 2,
+    2, 4, 4, 6, 1, 1, 1, 1, 1, 1, 8, 4, 2, 2, 3, 3,
+    1, 2, 1, 4, 7, 1, 5, 3, 7, 1, 3, 2, 2, 12, 1, 1,
+    5, 1, 4, 1, 4, 7, 4, 2, 3, 1, 1, 7, 1, 1, 1, 5,
+    7, 1, 1, 9, 2, 17, 1, 3, 1, 3, 8, 5, 2, 6, 1, 2,
+    12, 1, 2, 4, 11, 4, 3, 17, 1, 3, 3, 8, 1, 2, 5, 3,
+    9, 3, 6, 1, 5, 1, 3, 3, 10, 2, 2, 12, 6, 6, 3, 7,
+    1, 14, 15, 3, 3, 8, 1, 2, 7, 2, 3, 5, 2, 37, 1, 6,
+    6, 3, 2, 6, 21, 1, 3, 2, 7, 8, 1, 2, 2, 1, 4, 1,
+    2, 7, 7, 2, 7, 3, 8, 7, 24, 6, 1, 3, 3, 11, 7, 4,
+    4, 1, 8, 3, 4, 3, 30, 3, 3, 1, 2, 2, 4, 3, 3, 3,
+    8, 1, 7, 1, 8, 8, 3, 3, 8, 1, 31, 1, 6, 2, 1, 10,
+    2, 1, 9, 6, 8, 1, 4, 3, 15, 12, 1, 3, 21, 1, 7, 12,
+    3, 8, 6, 7, 3, 1, 1, 3, 5, 21, 3, 3, 5, 6, 6, 1,
+    3, 11, 3, 1, 2, 1, 1, 2, 32, 255, 141, 255, 193, 255, 255, 6,
+    3, 2, 9, 2, 9, 5, 1, 1, 10, 2, 8, 4, 5, 1, 3, 1,
+    6, 3, 12, 2, 3, 5, 4, 1, 2, 2, 2, 2, 2, 2, 2, 3,
+    5, 1, 1, 22, 2, 4, 6, 6, 8, 4, 4, 4, 4, 2, 2, 1,
+    7, 1, 1, 4, 1, 8, 1, 3, 3, 1, 4, 1, 1, 1, 4, 9,
+    2, 6, 2, 12, 1, 9, 4, 1, 7, 3, 2, 5, 10, 2, 3, 3,
+    2, 2, 1, 2, 2, 1, 7, 7, 4, 8, 1, 3, 1, 1, 16, 2,
+    1, 9, 5, 2, 1, 2, 3, 2, 3, 2, 2, 7, 7, 2, 10, 1,
+    1, 2, 2, 3, 2, 2, 4, 2, 1, 1, 2, 1, 7, 15, 1, 2,
+    7, 6, 5, 1, 2, 2, 4, 1, 2, 2, 1, 4, 2, 2, 4, 3,
+    1, 3, 2, 2, 2, 6, 5, 1, 5, 1, 6, 3, 1, 1, 4, 7,
+    1, 3, 2, 6, 1, 1, 4, 1, 6, 5, 2, 3, 1, 6, 2, 11,
+    9, 1, 1, 3, 9, 1, 4, 6, 1, 5, 3, 5, 12, 2, 3, 4,
+    6, 10, 6, 2, 6, 1, 4, 3, 12, 2, 1, 2, 1, 3, 2, 9,
+    3, 3, 3, 10, 12, 3, 3, 2, 3, 5, 5, 8, 7, 3, 11, 3,
+    16, 5, 11, 1, 4, 1, 2, 4, 3, 11, 2, 2, 6, 1, 11, 5,
+    1, 4, 1, 17, 2, 2, 1, 3, 2, 2, 2, 2, 5, 1, 2, 3,
+    3, 6, 5, 3, 1, 1, 3, 2, 2, 2, 4, 2, 1, 2, 2, 1,
+    5, 1, 4, 2, 2, 8, 3, 3, 5, 2, 4, 7, 2, 1, 3, 4,
+    2, 7, 12, 1, 12, 6, 1, 2, 1, 2, 7, 3, 1, 2, 7, 9,
+    1, 2, 7, 3, 3, 3, 2, 12, 8, 2, 7, 14, 4, 3, 1, 6,
+    6, 5, 4, 5, 6, 2, 5, 2, 1, 2, 3, 11, 5, 4, 1, 7,
+    4, 2, 1, 10, 5, 3, 4, 8, 2, 6, 4, 4, 3, 13, 10, 8,
+    1, 2, 2, 3, 2, 1, 1, 1, 1, 10, 5, 3, 7, 6, 6, 2,
+    5, 3, 1, 1, 1, 5, 3, 8, 3, 7, 6, 3, 7, 1, 2, 1,
+    2, 13, 5, 3, 1, 2, 9, 8, 1, 3, 2, 3, 5, 5, 3, 1,
+    8, 1, 3, 11, 5, 8, 7, 3, 3, 1, 3, 1, 1, 1, 10, 4,
+    2, 12, 3, 3, 5, 5, 1, 2, 8, 1, 1, 2, 4, 1, 4, 1,
+    10, 2, 2, 7, 2, 2, 1, 5, 4, 9, 3, 1, 1, 2, 5, 3,
+    5, 5, 12, 6, 2, 1, 2, 5, 7, 12, 1, 6, 7, 1, 2, 18,
+    3, 1, 5, 2, 1, 2, 3, 2, 10, 2, 4, 1, 1, 4, 2, 4,
+    1, 3, 5, 2, 3, 1, 1, 1, 2, 2, 3, 7, 3, 2, 1, 4,
+    3, 4, 4, 1, 1, 4, 8, 4, 7, 1, 1, 1, 6, 2, 4, 1,
+    5, 2, 7, 2, 2, 3, 2, 1, 4, 1, 6, 2, 3, 1, 3, 2,
+    1, 1, 1, 9, 5, 10, 4, 2, 2, 1, 10, 1, 2, 1, 7, 2,
+    3, 4, 1, 1, 2, 2, 3, 2, 1, 3, 6, 10, 4, 2, 2, 11,
+    1, 13, 7, 2, 6, 3, 2, 3, 2, 8, 2, 5, 1, 8, 6, 1,
+    3, 2, 3, 2, 5, 2, 1, 4, 2, 3, 2, 2, 5, 1, 4, 8,
+    3, 1, 7, 8, 2, 6, 1, 3, 1, 2, 2, 1, 1, 1, 6, 3,
+    3, 2, 4, 2, 5, 3, 2, 1, 1, 1, 1, 3, 1, 3, 5, 3,
+    1, 3, 13, 10, 3, 8, 5, 1, 6, 1, 5, 3, 5, 5, 10, 9,
+    6, 8, 2, 4, 2, 13, 4, 7, 4, 2, 2, 3, 7, 3, 5, 8,
+    6, 5, 4, 4, 1, 3, 2, 2, 1, 1, 1, 3, 1, 5, 10, 4,
+    1, 1, 6, 1, 2, 5, 3, 2, 3, 3, 3, 3, 4, 1, 3, 1,
+    2, 2, 7, 1, 8, 2, 2, 7, 3, 2, 8, 1, 1, 2, 9, 1,
+    1, 6, 9, 1, 9, 4, 4, 11, 10, 3, 1, 10, 2, 1, 5, 6,
+    22, 19, 4, 5, 2, 1, 18, 2, 1, 4, 13, 4, 10, 6, 1, 3,
+    1, 14, 6, 10, 1, 8, 3, 9, 4, 9, 3, 1, 10, 5, 3, 1,
+    2, 5, 1, 8, 1, 1, 6, 6, 3, 3, 2, 1, 20, 6, 7, 1,
+    2, 6, 20, 2, 11, 15, 12, 7, 4, 1, 2, 5, 2, 3, 3, 10,
+    4, 6, 4, 2, 9, 2, 16, 2, 1, 6, 5, 6, 7, 2, 3, 7,
+    2, 1, 1, 4, 4, 1, 1, 2, 4, 3, 4, 1, 5, 3, 1, 1,
+    1, 3, 6, 2, 13, 3, 3, 14, 1, 30, 17, 3, 3, 6, 2, 2,
+    3, 11, 18, 3, 10, 2, 6, 8, 2, 7, 2, 3, 3, 4, 10, 3,
+    2, 5, 6, 1, 3, 9, 4, 9, 1, 1, 3, 9, 3, 6, 2, 5,
+    12, 22, 1, 9, 1, 3, 3, 3, 2, 4, 1, 6, 5, 4, 15, 1,
+    2, 12, 1, 2, 14, 2, 3, 6, 7, 14, 1, 1, 4, 3, 2, 1,
+    5, 1, 3, 18, 31, 7, 4, 5, 1, 3, 4, 2, 4, 2, 2, 7,
+    8, 3, 1, 2, 8, 1, 7, 7, 1, 1, 1, 1, 4, 1, 1, 1,
+    1, 6, 1, 2, 2, 3, 1, 1, 1, 2, 2, 2, 3, 5, 3, 5,
+    1, 7, 1, 5, 11, 2, 3, 3, 8, 3, 2, 10, 2, 4, 10, 1,
+    8, 15, 18, 9, 4, 5, 4, 3, 1, 18, 2, 9, 1, 1, 4, 7,
+    1, 7, 2, 2, 6, 1, 6, 8, 4, 3, 1, 7, 4, 12, 1, 2,
+    4, 1, 2, 2, 1, 1, 2, 2, 1, 3, 1, 1, 4, 1, 2, 1,
+    2, 1, 5, 1, 2, 4, 1, 8, 3, 1, 2, 1, 4, 2, 3, 2,
+    1, 1, 4, 1, 2, 2, 3, 3, 2, 4, 2, 2, 3, 2, 4, 3,
+    1, 1, 3, 3, 9, 3, 4, 1, 2, 1, 18, 12, 3, 2, 3, 4,
+    5, 3, 8, 1, 1, 6, 1, 3, 8, 1, 9, 6, 7, 1, 6, 11,
+    12, 14, 1, 5, 2, 1, 1, 4, 1, 13, 3, 3, 6, 8, 2, 2,
+    6, 9, 7, 7, 4, 3, 7, 10, 9, 11, 4, 1, 24, 6, 2, 5,
+    8, 5, 9, 5, 4, 3, 1, 7, 3, 3, 1, 4, 9, 14, 1, 19,
+    9, 21, 3, 3, 3, 1, 3, 2, 9, 13, 2, 5, 5, 4, 2, 9,
+    6, 5, 4, 2, 2, 8, 1, 3, 1, 5, 15, 6, 7, 2, 3, 12,
+    2, 6, 5, 5, 7, 2, 2, 1, 20, 1, 2, 11, 5, 6, 4, 2,
+    3, 10, 6, 4, 5, 4, 1, 7, 2, 6, 18, 6, 2, 1, 2, 10,
+    5, 1, 21, 5, 5, 10, 6, 11, 5, 8, 5, 11, 5, 17, 3, 3,
+    3, 10, 1, 3, 1, 2, 6, 1, 9, 3, 1, 4, 7, 4, 3, 3,
+    4, 1, 7, 4, 4, 2, 2, 4, 16, 10, 11, 5, 22, 5, 2, 15,
+    13, 7, 15, 12, 3, 5, 1, 1, 2, 2, 2, 2, 3, 1, 5, 1,
+    3, 3, 3, 3, 1, 10, 3, 3, 2, 2, 3, 2, 1, 1, 9, 1,
+    2, 5, 4, 6, 1, 1, 2, 2, 2, 3, 3, 1, 3, 4, 6, 7,
+    1, 5, 4, 2, 5, 2, 2, 3, 3, 2, 2, 2, 4, 1, 2, 6,
+    4, 9, 22, 5, 4, 2, 2, 5, 5, 3, 16, 5, 10, 1, 2, 4,
+    2, 4, 5, 1, 3, 5, 1, 4, 4, 1, 5, 4, 14, 1, 10, 1,
+    1, 13, 3, 3, 4, 11, 2, 4, 3, 8, 3, 4, 4, 2, 2, 2,
+    1, 6, 1, 3, 6, 9, 4, 4, 2, 3, 16, 3, 4, 2, 7, 1,
+    5, 4, 1, 8, 7, 3, 7, 15, 13, 10, 14, 8, 3, 5, 1, 3,
+    2, 2, 6, 6, 2, 4, 2, 1, 5, 4, 9, 1, 8, 14, 2, 3,
+    10, 2, 4, 11, 7, 6, 2, 2, 11, 15, 10, 3, 1, 4, 6, 7,
+    4, 18, 1, 8, 7, 7, 6, 2, 10, 7, 2, 4, 20, 6, 7, 9,
+    9, 2, 2, 9, 11, 4, 2, 1, 15, 11, 19, 19, 3, 11, 10, 1,
+    3, 5, 2, 5, 3, 7, 1, 2, 9, 4, 1, 1, 1, 2, 7, 6,
+    2, 2, 2, 2, 1, 9, 1, 4, 3, 3, 9, 1, 1, 1, 6, 1,
+    12, 4, 6, 2, 1, 1, 1, 3, 9, 2, 2, 4, 8, 3, 2, 3,
+    1, 1, 5, 1, 1, 4, 14, 1, 1, 2, 5, 3, 1, 5, 3, 1,
+    5, 1, 16, 1, 4, 2, 3, 5, 13, 7, 10, 3, 3, 7, 6, 9,
+    7, 1, 4, 4, 1, 6, 1, 4, 5, 1, 1, 2, 3, 1, 2, 2,
+    4, 1, 1, 1, 2, 1, 2, 2, 1, 4, 1, 1, 1, 4, 2, 1,
+    2, 1, 6, 5, 2, 2, 7, 1, 7, 5, 2, 4, 8, 1, 2, 8,
+    4, 5, 2, 2, 1, 10, 1, 7, 1, 1, 1, 4, 2, 2, 2, 1,
+    1, 3, 1, 3, 2, 15, 12, 4, 2, 5, 6, 5, 1, 2, 1, 2,
+    7, 8, 7, 1, 2, 9, 3, 8, 10, 2, 6, 2, 26, 3, 1, 3,
+    2, 1, 2, 3, 2, 4, 1, 1, 1, 1, 3, 1, 2, 1, 1, 1,
+    4, 1, 1, 2, 3, 1, 1, 2, 2, 1, 2, 3, 1, 1, 8, 3,
+    2, 4, 3, 1, 1, 2, 6, 1, 2, 2, 2, 2, 1, 1, 2, 2,
+    4, 1, 1, 1, 2, 1, 2, 2, 2, 2, 2, 13, 4, 3, 1, 1,
+    6, 1, 4, 1, 6, 4, 2, 3, 2, 5, 1, 5, 2, 1, 2, 6,
+    15, 6, 3, 12, 1, 3, 1, 1, 3, 1, 7, 3, 2, 6, 3, 5,
+    2, 2, 10, 9, 3, 7, 5, 5, 2, 2, 3, 2, 1, 12, 1, 3,
+    4, 6, 1, 1, 1, 1, 2, 1, 6, 1, 5, 3, 4, 2, 2, 2,
+    4, 3, 2, 5, 1, 4, 3, 6, 4, 2, 1, 1, 2, 4, 3, 2,
+    1, 7, 3, 2, 1, 1, 5, 11, 1, 2, 8, 3, 3, 2, 1, 2,
+    7, 5, 2, 17, 10, 9, 6, 10, 4, 1, 3, 8, 7, 6, 1, 5,
+    3, 17, 8, 2, 1, 5, 2, 2, 6, 11, 1, 1, 5, 1, 6, 1,
+    2, 7, 5, 1, 3, 1, 2, 2, 2, 3, 1, 5, 4, 2, 1, 1,
+    4, 3, 4, 9, 2, 1, 1, 5, 8, 1, 4, 4, 2, 1, 6, 1,
+    4, 9, 1, 6, 4, 1, 4, 1, 1, 6, 2, 2, 1, 1, 3, 5,
+    1, 4, 3, 1, 2, 7, 1, 1, 6, 3, 6, 3, 4, 1, 6, 1,
+    5, 2, 2, 2, 12, 2, 1, 8, 8, 4, 6, 4, 3, 9, 5, 4,
+    2, 12, 3, 1, 1, 4, 1, 3, 4, 1, 9, 20, 11, 2, 2, 6,
+    5, 6, 14, 16, 1, 1, 2, 3, 2, 1, 24, 2, 4, 3, 3, 7,
+    2, 5, 2, 9, 6, 7, 5, 4, 2, 3, 2, 1, 2, 3, 4, 8,
+    1, 23, 17, 3, 5, 3, 3, 3, 6, 1, 1, 2, 4, 1, 8, 7,
+    2, 7, 8, 5, 1, 3, 8, 8, 6, 2, 1, 4, 2, 5, 11, 11,
+    6, 4, 1, 1, 9, 1, 6, 3, 5, 11, 6, 13, 4, 3, 16, 3,
+    6, 4, 8, 6, 16, 2, 2, 1, 16, 5, 2, 2, 3, 3, 1, 2,
+    9, 15, 3, 6, 9, 3, 5, 2, 15, 1, 6, 6, 2, 9, 8, 1,
+    8, 2, 5, 2, 1, 2, 7, 3, 11, 2, 3, 1, 3, 12, 1, 10,
+    3, 11, 4, 3, 11, 1, 4, 1, 14, 3, 1, 14, 2, 2, 3, 9,
+    11, 10, 3, 3, 28, 2, 1, 14, 5, 5, 8, 1, 15, 7, 16, 6,
+    6, 2, 6, 6, 6, 8, 5, 3, 4, 2, 5, 9, 4, 6, 1, 3,
+    3, 8, 7, 2, 4, 3, 2, 7, 14, 1, 5, 3, 4, 2, 1, 5,
+    8, 3, 4, 2, 5, 4, 1, 2, 5, 6, 9, 2, 7, 1, 10, 9,
+    9, 1, 3, 1, 1, 6, 5, 3, 1, 8, 14, 6, 20, 5, 5, 11,
+    26, 4, 6, 7, 12, 7, 7, 11, 10, 10, 2, 1, 2, 2, 5, 1,
+    13, 6, 3, 4, 3, 3, 14, 8, 4, 10, 2, 1, 1, 1, 5, 11,
+    3, 3, 7, 7, 2, 5, 1, 4, 9, 11, 9, 22, 2, 7, 1, 8,
+    3, 4, 8, 4, 0, 13, 1, 3, 6, 9, 4, 20, 10, 14, 11, 1,
+    4, 5, 3, 8, 7, 11, 2, 2, 5, 6, 9, 10, 6, 1, 1, 1,
+    3, 4, 5, 4, 1, 3, 1, 3, 4, 1, 4, 2, 8, 6, 1, 1,
+    4, 10, 4, 4, 1, 4, 4, 1, 2, 1, 1, 5, 1, 2, 4, 14,
+    3, 1, 6, 1, 1, 1, 5, 7, 11, 2, 9, 3, 14, 3, 5, 6,
+    12, 14, 5, 2, 5, 3, 2, 5, 4, 8, 13, 11, 2, 14, 15, 3,
+    5, 2, 7, 1, 7, 3, 7, 4, 4, 1, 7, 13, 3, 17, 8, 13,
+    2, 2, 4, 2, 2, 4, 2, 2, 17, 5, 3, 2, 2, 4, 2, 6,
+    9, 2, 11, 3, 1, 8, 6, 1, 6, 5, 5, 1, 3, 8, 1, 2,
+    3, 9, 2, 8, 6, 1, 3, 2, 2, 2, 8, 17, 6, 3, 18, 2,
+    3, 13, 7, 1, 3, 3, 2, 7, 2, 3, 5, 7, 1, 4, 15, 4,
+    1, 1, 1, 7, 6, 4, 1, 3, 1, 3, 1, 3, 3, 11, 1, 2,
+    1, 2, 4, 4, 1, 1, 2, 2, 4, 3, 1, 1, 1, 9, 11, 5,
+    3, 1, 3, 1, 1, 5, 6, 3, 19, 4, 15, 16, 14, 2, 7, 4,
+    6, 2, 3, 28, 12, 13, 2, 4, 38, 3, 4, 1, 1, 3, 9, 1,
+    3, 10, 7, 12, 8, 1, 5, 9, 1, 2, 7, 7, 21, 1, 12, 18,
+    4, 8, 5, 2, 1, 1, 19, 1, 5, 3, 3, 4, 6, 4, 2, 2,
+    12, 3, 2, 1, 12, 1, 11, 2, 7, 8, 3, 6, 9, 4, 2, 4,
+    3, 1, 18, 6, 11, 20, 13, 4, 3, 5, 5, 2, 2, 5, 7, 13,
+    1, 2, 1, 1, 2, 14, 5, 1, 10, 14, 6, 2, 2, 3, 3, 1,
+    2, 5, 2, 4, 2, 4, 1, 3, 5, 11, 3, 16, 2, 7, 1, 17,
+    1, 8, 9, 4, 12, 15, 10, 5, 2, 7, 1, 10, 1, 3, 7, 2,
+    3, 7, 6, 9, 12, 4, 4, 9, 1, 11, 5, 3, 6, 2, 7, 2,
+    7, 2, 5, 2, 6, 2, 1, 10, 1, 2, 1, 3, 3, 1, 10, 11,
+    1, 1, 1, 1, 2, 13, 3, 4, 2, 1, 5, 2, 9, 2, 1, 12,
+    4, 1, 2, 1, 15, 3, 5, 9, 9, 2, 2, 2, 2, 19, 1, 12,
+    1, 3, 8, 1, 6, 3, 16, 3, 4, 9, 3, 8, 3, 7, 8, 3,
+    1, 1, 3, 1, 8, 11, 6, 3, 6, 1, 8, 8, 3, 8, 3, 6,
+    2, 6, 4, 15, 8, 2, 3, 3, 3, 2, 1, 2, 1, 1, 2, 7,
+    1, 11, 1, 1, 2, 1, 12, 6, 2, 2, 2, 3, 3, 4, 3, 1,
+    4, 3, 5, 8, 1, 4, 2, 2, 3, 3, 3, 1, 2, 5, 7, 1,
+    17, 1, 5, 8, 8, 3, 2, 1, 3, 8, 8, 7, 2, 3, 2, 1,
+    2, 3, 6, 5, 2, 11, 8, 4, 14, 2, 12, 2, 1, 7, 1, 5,
+    12, 4, 24, 1, 2, 6, 4, 10, 1, 3, 3, 7, 3, 13, 8, 4,
+    11, 5, 4, 7, 2, 7, 4, 3, 2, 8, 7, 1, 3, 1, 1, 10,
+    4, 1, 1, 2, 5, 1, 9, 17, 32, 9, 4, 5, 1, 33, 16, 5,
+    9, 6, 19, 1, 1, 4, 11, 5, 4, 1, 2, 5, 2, 2, 1, 1,
+    5, 8, 11, 5, 7, 8, 1, 3, 1, 11, 3, 6, 4, 10, 8, 3,
+    2, 5, 4, 2, 0, 3, 1, 1, 3, 2, 1, 7, 3, 2, 4, 18,
+    8, 1, 3, 5, 4, 4, 3, 7, 8, 1, 2, 5, 1, 1, 3, 5,
+    10, 1, 6, 1, 6, 8, 4, 2, 4, 3, 1, 2, 3, 4, 4, 2,
+    4, 12, 1, 1, 4, 1, 6, 1, 1, 2, 12, 2, 1, 3, 6, 1,
+    3, 3, 1, 3, 1, 4, 1, 4, 7, 1, 2, 6, 3, 3, 5, 1,
+    4, 5, 2, 2, 7, 2, 16, 1, 1, 4, 8, 6, 1, 2, 2, 3,
+    5, 2, 2, 2, 3, 1, 3, 1, 11, 1, 2, 1, 1, 1, 4, 2,
+    1, 1, 1, 16, 1, 3, 3, 1, 22, 2, 1, 3, 2, 5, 2, 13,
+    3, 3, 4, 1, 6, 5, 2, 13, 1, 7, 8, 1, 7, 1, 3, 1,
+    6, 8, 1, 9, 13, 2, 3, 12, 3, 5, 1, 2, 1, 2, 2, 4,
+    1, 3, 13, 8, 1, 6, 6, 3, 1, 4, 1, 1, 1, 1, 4, 2,
+    2, 2, 3, 6, 2, 1, 3, 1, 1, 2, 1, 3, 3, 2, 4, 1,
+    1, 1, 1, 1, 2, 1, 2, 1, 13, 1, 7, 3, 2, 1, 20, 9,
+    2, 2, 2, 4, 12, 7, 6, 8, 10, 2, 4, 33, 1, 5, 6, 4,
+    5, 1, 8, 1, 1, 5, 6, 1, 2, 1, 2, 5, 1, 6, 2, 5,
+    2, 3, 7, 4, 3, 4, 2, 2, 7, 2, 2, 1, 1, 2, 3, 2,
+    4, 2, 3, 1, 3, 4, 4, 7, 7, 6, 8, 4, 15, 3, 10, 13,
+    1, 6, 4, 4, 6, 4, 17, 9, 1, 1, 2, 7, 4, 12, 7, 2,
+    9, 6, 6, 2, 9, 3, 3, 8, 2, 4, 11, 3, 13, 4, 6, 2,
+    1, 5, 2, 9, 1, 10, 5, 6, 5, 2, 3, 3, 2, 4, 7, 6,
+    5, 6, 1, 5, 1, 11, 2, 3, 5, 3, 11, 5, 10, 2, 1, 8,
+    1, 1, 1, 18, 5, 6, 3, 8, 1, 1, 7, 1, 3, 7, 3, 11,
+    1, 4, 4, 3, 2, 7, 1, 1, 6, 1, 3, 3, 5, 4, 4, 5,
+    13, 1, 5, 6, 2, 1, 3, 2, 7, 2, 13, 5, 7, 2, 1, 10,
+    1, 3, 9, 1, 2, 5, 2, 2, 10, 1, 1, 2, 3, 1, 1, 2,
+    7, 3, 2, 1, 1, 1, 2, 3, 15, 5, 2, 2, 6, 4, 17, 1,
+    15, 6, 21, 9, 7, 1, 6, 6, 2, 2, 1, 6, 2, 1, 5, 1,
+    15, 4, 27, 1, 1, 1, 2, 5, 1, 6, 5, 1, 5, 3, 3, 1,
+    2, 4, 1, 2, 1, 2, 8, 1, 3, 2, 6, 5, 2, 9, 15, 2,
+    2, 7, 3, 7, 12, 30, 2, 2, 5, 5, 13, 2, 8, 1, 9, 2,
+    3, 1, 3, 6, 7, 1, 2, 13, 10, 3, 1, 2, 3, 1, 1, 10,
+    3, 4, 7, 6, 1, 2, 5, 13, 5, 4, 2, 3, 5, 2, 1, 1,
+    2, 1, 1, 2, 2, 5, 6, 2, 2, 5, 4, 2, 7, 3, 1, 2,
+    15, 7, 3, 6, 1, 2, 4, 1, 3, 2, 2, 4, 5, 3, 5, 3,
+    8, 1, 2, 8, 1, 1, 8, 2, 6, 3, 11, 1, 2, 1, 4, 7,
+    1, 3, 1, 1, 1, 7, 1, 10, 3, 1, 6, 1, 4, 2, 15, 2,
+    3, 1, 6, 9, 5, 5, 5, 2, 2, 1, 4, 1, 2, 5, 11, 8,
+    2, 1, 7, 3, 5, 8, 1, 1, 2, 1, 1, 1, 4, 3, 1, 3,
+    1, 1, 3, 2, 1, 1, 5, 1, 5, 5, 3, 1, 13, 1, 2, 3,
+    1, 4, 2, 1, 9, 4, 1, 4, 7, 1, 2, 6, 3, 4, 3, 1,
+    8, 26, 1, 25, 25, 1, 5, 8, 16, 14, 11, 3, 8, 14, 4, 4,
+    3, 2, 3, 12, 4, 9, 3, 11, 1, 3, 10, 6, 9, 10, 6, 3,
+    8, 5, 10, 7, 3, 14, 19, 4, 6, 4, 21, 6, 2, 7, 16, 29,
+    1, 1, 12, 3, 3, 10, 2, 1, 1, 8, 3, 3, 7, 10, 1, 13,
+    3, 3, 8, 1, 14, 4, 7, 1, 0, 2, 1, 2, 7, 1, 3, 1,
+    1, 1, 1, 1, 3, 3, 3, 3, 1, 8, 1, 1, 5, 5, 3, 2,
+    2, 2, 1, 2, 1, 10, 3, 13, 3, 1, 4, 4, 1, 2, 4, 9,
+    23, 1, 7, 3, 5, 1, 2, 1, 11, 7, 1, 7, 3, 3, 1, 11,
+    11, 6, 3, 8, 5, 5, 3, 4, 2, 3, 3, 6, 3, 2, 7, 1,
+    1, 1, 2, 5, 3, 3, 1, 4, 3, 9, 5, 20, 2, 2, 1, 8,
+    2, 5, 8, 2, 6, 4, 1, 1, 2, 1, 2, 1, 1, 7, 13, 1,
+    6, 2, 2, 1, 10, 9, 2, 1, 5, 3, 3, 6, 1, 1, 3, 7,
+    14, 1, 3, 4, 2, 2, 1, 2, 3, 1, 2, 3, 2, 5, 8, 1,
+    6, 1, 6, 1, 1, 1, 1, 4, 2, 2, 3, 4, 5, 9, 5, 3,
+    1, 3, 3, 1, 3, 6, 2, 6, 2, 9, 2, 3, 3, 1, 1, 1,
+    11, 4, 3, 2, 7, 5, 2, 3, 1, 10, 1, 1, 1, 2, 3, 1,
+    6, 1, 1, 2, 1, 1, 8, 5, 7, 2, 2, 3, 6, 3, 1, 4,
+    6, 6, 9, 6, 1, 2, 3, 1, 6, 2, 3, 14, 7, 5, 1, 7,
+    4, 1, 3, 5, 7, 1, 3, 3, 9, 1, 3, 1, 16, 2, 6, 5,
+    2, 1, 3, 3, 3, 1, 8, 3, 1, 6, 1, 1, 1, 2, 3, 10,
+    2, 1, 6, 3, 1, 1, 3, 1, 1, 2, 1, 2, 1, 2, 3, 2,
+    1, 22, 4, 4, 1, 14, 6, 6, 10, 2, 8, 12, 1, 7, 1, 6,
+    1, 3, 11, 13, 3, 7, 2, 9, 2, 11, 11, 3, 17, 1, 1, 14,
+    9, 2, 5, 3, 2, 16, 3, 7, 2, 6, 9, 8, 15, 5, 9, 2,
+    1, 30, 1, 4, 2, 1, 2, 12, 4, 3, 1, 4, 12, 11, 1, 1,
+    34, 5, 4, 2, 13, 1, 4, 1, 14, 16, 3, 2, 7, 3, 1, 2,
+    1, 9, 1, 8, 3, 5, 19, 5, 4, 2, 3, 9, 10, 2, 4, 1,
+    1, 9, 3, 7, 4, 12, 11, 11, 22, 1, 3, 5, 3, 2, 2, 12,
+    2, 6, 5, 2, 3, 1, 7, 16, 2, 4, 3, 3, 2, 6, 1, 9,
+    1, 5, 1, 5, 11, 7, 4, 7, 17, 2, 2, 3, 4, 11, 1, 4,
+    2, 3, 1, 2, 17, 9, 3, 7, 4, 1, 10, 2, 8, 10, 8, 1,
+    3, 14, 1, 1, 5, 7, 9, 4, 7, 1, 1, 6, 10, 3, 16, 1,
+    2, 4, 6, 7, 1, 11, 6, 2, 4, 4, 2, 2, 2, 1, 17, 4,
+    4, 1, 3, 5, 1, 9, 1, 7, 6, 1, 5, 2, 9, 5, 3, 3,
+    32, 11, 5, 4, 1, 4, 1, 1, 1, 8, 3, 2, 2, 5, 1, 2,
+    3, 3, 6, 11, 6, 1, 1, 2, 1, 5, 2, 1, 3, 5, 1, 1,
+    5, 4, 3, 3, 2, 1, 4, 2, 1, 10, 3, 1, 2, 2, 1, 3,
+    1, 1, 2, 13, 2, 6, 1, 6, 2, 3, 13, 2, 2, 5, 7, 2,
+    3, 2, 6, 2, 6, 5, 1, 9, 2, 4, 1, 1, 2, 6, 1, 2,
+    4, 1, 5, 1, 1, 3, 3, 3, 3, 2, 2, 2, 3, 2, 1, 1,
+    1, 1, 6, 1, 1, 2, 1, 5, 9, 1, 4, 3, 6, 2, 3, 3,
+    2, 6, 9, 3, 1, 1, 2, 1, 1, 1, 6, 3, 1, 3, 4, 9,
+    2, 5, 2, 2, 2, 2, 5, 8, 1, 2, 4, 1, 5, 10, 2, 3,
+    1, 2, 5, 2, 2, 5, 20, 1, 8, 3, 2, 2, 15, 3, 1, 3,
+    7, 3, 2, 1, 3, 3, 2, 1, 6, 5, 4, 5, 3, 3, 3, 8,
+    7, 6, 3, 3, 3, 1, 7, 2, 2, 2, 3, 1, 3, 2, 17, 4,
+    7, 1, 1, 2, 2, 2, 4, 2, 2, 2, 7, 9, 9, 8, 6, 1,
+    5, 3, 6, 7, 2, 10, 11, 5, 2, 4, 2, 1, 4, 1, 10, 3,
+    4, 5, 3, 3, 3, 9, 7, 1, 2, 6, 2, 1, 4, 21, 4, 5,
+    1, 8, 3, 4, 4, 3, 5, 6, 2, 3, 5, 7, 2, 3, 7, 7,
+    2, 1, 3, 3, 3, 4, 14, 1, 7, 1, 3, 1, 1, 1, 3, 3,
+    1, 2, 1, 1, 3, 2, 1, 1, 8, 1, 8, 2, 3, 1, 3, 3,
+    3, 3, 3, 1, 1, 6, 1, 4, 11, 2, 1, 13, 3, 1, 1, 20,
+    5, 6, 1, 11, 3, 5, 1, 2, 9, 11, 4, 1, 3, 11, 1, 1,
+    7, 3, 12, 8, 2, 15, 5, 7, 1, 8, 3, 8, 10, 3, 2, 4,
+    33, 1, 1, 7, 1, 2, 2, 4, 8, 2, 1, 3, 13, 1, 5, 1,
+    1, 3, 3, 5, 4, 25, 3, 6, 2, 5, 2, 4, 2, 2, 4, 1,
+    2, 11, 8, 3, 1, 2, 9, 3, 4, 1, 10, 1, 3, 1, 3, 1,
+    3, 3, 8, 1, 4, 5, 5, 14, 3, 1, 17, 9, 2, 1, 13, 21,
+    1, 24, 2, 3, 10, 4, 6, 3, 2, 1, 1, 3, 1, 2, 2, 4,
+    5, 2, 1, 1, 7, 3, 6, 4, 2, 1, 3, 2, 1, 1, 2, 5,
+    2, 2, 7, 7, 5, 2, 14, 3, 1, 4, 2, 15, 1, 7, 3, 2,
+    15, 4, 4, 7, 12, 1, 1, 7, 2, 3, 4, 1, 12, 1, 6, 2,
+    3, 4, 1, 4, 5, 1, 1, 6, 2, 4, 4, 4, 1, 10, 5, 3,
+    2, 4, 3, 2, 1, 3, 1, 1, 3, 1, 2, 5, 1, 2, 1, 2,
+    1, 2, 3, 13, 9, 2, 6, 1, 2, 6, 3, 10, 2, 4, 5, 2,
+    2, 2, 2, 4, 1, 1, 4, 2, 10, 1, 1, 2, 2, 2, 7, 4,
+    5, 5, 10, 4, 3, 1, 6, 3, 6, 3, 1, 8, 1, 2, 2, 11,
+    13, 3, 3, 1, 3, 2, 1, 3, 8, 3, 1, 7, 3, 1, 6, 3,
+    2, 1, 1, 10, 2, 1, 4, 2, 5, 4, 1, 5, 5, 2, 3, 29,
+    1, 6, 9, 1, 1, 1, 19, 3, 7, 3, 22, 16, 2, 6, 3, 24,
+    2, 2, 8, 1, 40, 12, 10, 14, 6, 21, 11, 3, 6, 7, 6, 10,
+    8, 5, 1, 2, 2, 9, 3, 4, 5, 3, 1, 1, 5, 7, 1, 6,
+    1, 3, 5, 2, 3, 3, 1, 5, 3, 7, 1, 4, 4, 4, 5, 3,
+    4, 6, 12, 1, 2, 3, 6, 1, 12, 7, 1, 3, 2, 6, 4, 1,
+    3, 4, 4, 4, 5, 4, 4, 2, 2, 4, 4, 7, 3, 8, 11, 1,
+    15, 6, 3, 1, 1, 5, 1, 5, 15, 3, 2, 1, 1, 5, 13, 1,
+    8, 6, 3, 1, 3, 13, 16, 3, 12, 6, 1, 3, 1, 4, 7, 6,
+    4, 10, 1, 1, 10, 14, 1, 16, 1, 2, 13, 9, 2, 6, 1, 3,
+    13, 3, 1, 11, 2, 15, 3, 5, 2, 7, 1, 2, 8, 2, 1, 3,
+    2, 7, 1, 2, 1, 1, 1, 2, 1, 4, 1, 14, 6, 23, 9, 13,
+    5, 2, 9, 3, 6, 4, 1, 1, 4, 9, 7, 2, 3, 1, 1, 13,
+    19, 3, 1, 2, 5, 10, 3, 3, 3, 9, 7, 1, 5, 2, 6, 3,
+    3, 6, 1, 6, 3, 1, 8, 1, 1, 7, 9, 4, 2, 3, 4, 2,
+    2, 1, 12, 2, 1, 1, 5, 3, 1, 4, 8, 1, 3, 2, 3, 1,
+    1, 2, 5, 14, 14, 3, 1, 9, 4, 3, 3, 2, 1, 1, 7, 2,
+    2, 1, 3, 1, 5, 1, 1, 10, 4, 3, 3, 6, 4, 4, 2, 9,
+    2, 6, 5, 1, 12, 11, 13, 2, 1, 2, 5, 1, 4, 1, 3, 16,
+    7, 5, 3, 4, 5, 6, 5, 2, 3, 6, 1, 17, 3, 1, 8, 3,
+    3, 15, 2, 6, 1, 3, 5, 1, 20, 9, 2, 1, 8, 24, 3, 9,
+    6, 38, 2, 10, 2, 10, 27, 6, 5, 4, 2, 17, 3, 7, 8, 2,
+    1, 15, 5, 4, 1, 1, 1, 1, 2, 1, 1, 2, 17, 11, 16, 4,
+    1, 4, 5, 98, 28, 35, 58, 25, 135, 2, 30, 1, 24, 15, 4, 36,
+    4, 14, 36, 124, 166, 255, 19, 16, 15, 204, 189, 5, 1, 6, 12, 5,
+    1, 4, 3, 2, 8, 3, 6, 3, 1, 8, 9, 4, 12, 5, 3, 7,
+    2, 3, 1, 8, 1, 3, 1, 3, 2, 1, 3, 1, 2, 5, 7, 2,
+    14, 1, 1, 3, 2, 3, 2, 3, 1, 3, 1, 3, 10, 1, 4, 11,
+    2, 3, 1, 2, 5, 1, 2, 3, 11, 8, 1, 3, 9, 6, 1, 3,
+    4, 1, 7, 15, 6, 7, 11, 3, 10, 1, 4, 3, 1, 2, 3, 1,
+    5, 3, 6, 9, 11, 2, 3, 10, 1, 3, 3, 9, 5, 7, 2, 2,
+    11, 1, 2, 4, 9, 22, 2, 4, 3, 2, 4, 1, 3, 1, 1, 1,
+    2, 1, 1, 1, 20, 13, 2, 1, 1, 4, 15, 2, 2, 2, 8, 2,
+    2, 1, 5, 4, 19, 9, 6, 7, 2, 1, 2, 2, 1, 1, 1, 1,
+    3, 3, 1, 8, 3, 3, 1, 2, 2, 2, 2, 1, 4, 1, 1, 1,
+    1, 2, 2, 3, 3, 3, 1, 2, 1, 3, 1, 4, 1, 3, 3, 6,
+    2, 8, 1, 11, 2, 1, 7, 9, 1, 5, 4, 4, 9, 8, 2, 1,
+    1, 2, 1, 3, 1, 1, 1, 10, 1, 1, 3, 4, 1, 9, 12, 11,
+    2, 11, 4, 5, 1, 1, 5, 1, 2, 5, 7, 2, 14, 6, 6, 10,
+    5, 9, 1, 2, 2, 6, 3, 8, 2, 2, 1, 2, 12, 2, 2, 3,
+    6, 2, 2, 2, 3, 6, 2, 2, 3, 2, 5, 1, 2, 2, 1, 7,
+    12, 6, 4, 4, 1, 1, 7, 2, 1, 3, 2, 14, 2, 1, 5, 5,
+    1, 8, 4, 3, 1, 1, 7, 1, 1, 9, 3, 1, 8, 2, 2, 4,
+    5, 3, 3, 1, 2, 2, 16, 3, 5, 3, 14, 6, 1, 1, 1, 5,
+    3, 9, 2, 5, 1, 1, 1, 3, 24, 19, 10, 2, 13, 7, 1, 2,
+    6, 9, 12, 5, 16, 9, 6, 7, 1, 2, 1, 5, 3, 2, 4, 4,
+    2, 7, 5, 1, 1, 2, 2, 6, 4, 12, 4, 2, 1, 1, 2, 2,
+    5, 1, 10, 12, 2, 4, 2, 7, 5, 1, 4, 3, 4, 1, 8, 4,
+    3, 2, 2, 8, 1, 5, 2, 0, 5, 5, 3, 1, 2, 3, 3, 1,
+    1, 1, 1, 4, 2, 1, 2, 2, 1, 5, 1, 4, 4, 1, 1, 6,
+    1, 2, 1, 1, 1, 1, 1, 1, 2, 2, 1, 3, 1, 8, 1, 9,
+    1, 3, 1, 2, 13, 1, 2, 6, 2, 1, 3, 2, 1, 2, 1, 2,
+    2, 4, 1, 5, 1, 12, 7, 4, 1, 1, 6, 9, 5, 2, 2, 3,
+    8, 1, 3, 5, 3, 1, 19, 4, 3, 1, 1, 1, 4, 4, 2, 1,
+    2, 5, 4, 1, 2, 3, 2, 2, 3, 3, 5, 1, 6, 1, 6, 5,
+    12, 1, 4, 5, 3, 5, 6, 2, 3, 4, 1, 11, 4, 4, 2, 2,
+    1, 3, 1, 2, 3, 3, 2, 1, 4, 3, 2, 1, 6, 3, 16, 3,
+    7, 8, 2, 5, 2, 2, 4, 4, 3, 1, 6, 3, 5, 1, 6, 2,
+    5, 3, 7, 1, 2, 2, 3, 4, 9, 14, 4, 14, 3, 2, 5, 7,
+    1, 1, 2, 1, 1, 1, 7, 4, 1, 2, 11, 1, 5, 1, 1, 2,
+    3, 2, 3, 1, 1, 2, 1, 3, 1, 5, 1, 2, 9, 5, 1, 9,
+    1, 3, 4, 1, 3, 3, 4, 1, 1, 5, 8, 6, 4, 2, 6, 6,
+    3, 1, 4, 6, 4, 1, 1, 5, 2, 1, 1, 3, 1, 1, 2, 3,
+    3, 8, 10, 5, 3, 3, 1, 12, 5, 3, 4, 7, 1, 5, 13, 2,
+    5, 3, 10, 1, 3, 3, 10, 2, 1, 2, 4, 4, 6, 2, 2, 3,
+    1, 2, 4, 3, 1, 5, 2, 7, 1, 6, 2, 2, 2, 2, 2, 1,
+    1, 1, 4, 2, 3, 10, 9, 4, 14, 9, 13, 11, 1, 1, 4, 1,
+    1, 5, 1, 6, 2, 9, 2, 16, 10, 7, 4, 2, 12, 2, 20, 8,
+    3, 4, 3, 1, 8, 3, 4, 1, 6, 4, 9, 2, 3, 1, 6, 1,
+    1, 8, 4, 4, 1, 1, 2, 14, 1, 4, 2, 1, 6, 1, 9, 1,
+    15, 7, 9, 4, 1, 1, 5, 2, 3, 1, 3, 8, 17, 22, 17, 22,
+    1, 4, 1, 7, 3, 1, 6, 4, 5, 1, 9, 10, 1, 1, 5, 1,
+    7, 2, 4, 2, 2, 3, 5, 1, 7, 3, 1, 1, 2, 4, 3, 5,
+    24, 1, 4, 8, 1, 6, 2, 2, 1, 6, 5, 5, 4, 1, 6, 1,
+    4, 6, 1, 6, 2, 4, 1, 1, 2, 3, 2, 3, 5, 2, 4, 4,
+    4, 6, 3, 2, 3, 1, 2, 2, 1, 1, 6, 1, 3, 1, 5, 2,
+    3, 2, 12, 1, 1, 4, 2, 4, 2, 3, 4, 1, 1, 1, 1, 2,
+    6, 2, 1, 1, 2, 1, 3, 1, 1, 1, 1, 1, 1, 1, 2, 2,
+    5, 1, 1, 4, 1, 1, 5, 2, 2, 3, 2, 1, 1, 4, 6, 6,
+    5, 2, 1, 2, 1, 1, 3, 4, 1, 1, 1, 2, 4, 2, 3, 1,
+    1, 1, 1, 3, 6, 1, 6, 3, 1, 3, 2, 2, 2, 5, 2, 3,
+    2, 3, 1, 2, 4, 2, 1, 1, 2, 1, 1, 1, 3, 2, 1, 1,
+    3, 3, 1, 1, 3, 1, 1, 1, 1, 9, 3, 1, 3, 5, 10, 1,
+    2, 4, 6, 4, 1, 3, 1, 3, 6, 4, 1, 1, 2, 1, 1, 5,
+    1, 2, 3, 2, 4, 3, 2, 6, 2, 2, 3, 1, 3, 3, 3, 2,
+    1, 2, 1, 2, 1, 3, 1, 4, 2, 1, 5, 2, 1, 2, 4, 1,
+    1, 1, 2, 7, 2, 1, 1, 2, 2, 3, 3, 1, 1, 5, 1, 1,
+    1, 2, 1, 4, 5, 6, 1, 3, 4, 3, 1, 2, 1, 8, 5, 1,
+    2, 1, 1, 6, 1, 4, 4, 2, 5, 2, 3, 2, 1, 2, 1, 3,
+    3, 3, 1, 5, 3, 1, 2, 5, 7, 3, 2, 1, 3, 3, 3, 1,
+    1, 1, 2, 1, 5, 1, 1, 2, 1, 1, 2, 2, 1, 3, 2, 2,
+    2, 2, 1, 2, 1, 1, 1, 2, 6, 5, 3, 2, 2, 1, 6, 5,
+    1, 1, 5, 2, 1, 2, 2, 1, 5, 1, 1, 1, 3, 4, 2, 2,
+    1, 4, 2, 1, 3, 3, 3, 4, 2, 7, 1, 4, 4, 2, 5, 1,
+    5, 2, 3, 1, 11, 1, 4, 3, 1, 9, 2, 5, 2, 1, 3, 3,
+    4, 2, 1, 4, 2, 1, 1, 4, 2, 3, 1, 2, 2, 1, 3, 1,
+    1, 2, 1, 5, 2, 2, 1, 1, 1, 1, 1, 1, 2, 1, 2, 1,
+    2, 3, 2, 2, 5, 1, 2, 1, 2, 2, 2, 4, 2, 1, 1, 1,
+    1, 3, 1, 2, 1, 3, 3, 1, 4, 1, 4, 1, 1, 1, 1, 1,
+    1, 1, 3, 3, 1, 5, 2, 2, 1, 2, 2, 1, 1, 1, 3, 2,
+    2, 1, 2, 1, 4, 6, 6, 2, 1, 1, 1, 2, 1, 1, 3, 2,
+    3, 2, 3, 6, 2, 3, 1, 1, 2, 1, 4, 4, 1, 5, 1, 1,
+    1, 2, 2, 2, 3, 1, 1, 2, 5, 1, 2, 5, 3, 1, 1, 8,
+    2, 1, 9, 3, 2, 1, 2, 1, 1, 1, 1, 2, 4, 5, 1, 16,
+    6, 2, 2, 1, 4, 2, 2, 4, 1, 3, 1, 2, 2, 2, 1, 3,
+    1, 1, 1, 1, 1, 4, 8, 1, 1, 1, 1, 4, 1, 1, 3, 1,
+    2, 1, 2, 2, 1, 2, 1, 2, 1, 1, 3, 2, 2, 1, 1, 1,
+    2, 1, 1, 5, 2, 5, 11, 4, 3, 2, 1, 1, 1, 1, 2, 3,
+    6, 5, 3, 1, 2, 4, 1, 5, 1, 2, 1, 2, 1, 1, 2, 2,
+    3, 1, 3, 1, 1, 2, 2, 3, 7, 1, 1, 4, 1, 1, 1, 2,
+    4, 1, 1, 2, 1, 2, 3, 1, 3, 2, 2, 2, 2, 1, 1, 4,
+    1, 3, 2, 2, 1, 1, 3, 1, 2, 1, 1, 1, 1, 3, 2, 6,
+    1, 3, 1, 1, 1, 1, 1, 1, 3, 3, 2, 2, 3, 5, 4, 1,
+    11, 7, 1, 1, 2, 1, 6, 5, 1, 3, 7, 2, 1, 4, 1, 1,
+    1, 12, 8, 5, 3, 1, 4, 11, 1, 2, 1, 1, 1, 3, 2, 2,
+    1, 4, 21, 2, 1, 2, 4, 2, 1, 2, 3, 6, 13, 2, 1, 8,
+    3, 2, 5, 1, 4, 5, 1, 3, 2, 5, 15, 4, 1, 1, 1, 1,
+    4, 2, 1, 3, 1, 2, 6, 1, 3, 4, 3, 4, 1, 1, 1, 1,
+    8, 1, 8, 6, 8, 2, 3, 3, 4, 9, 3, 6, 2, 2, 7, 4,
+    1, 1, 5, 4, 2, 6, 9, 1, 8, 2, 2, 3, 3, 3, 7, 3,
+    5, 1, 8, 3, 3, 12, 4, 11, 7, 3, 2, 1, 5, 3, 2, 2,
+    6, 6, 3, 13, 13, 8, 9, 4, 15, 12, 4, 1, 2, 1, 2, 4,
+    9, 7, 7, 1, 4, 1, 3, 2, 6, 10, 8, 3, 3, 2, 5, 2,
+    1, 1, 5, 6, 3, 2, 2, 5, 4, 2, 8, 1, 1, 2, 1, 5,
+    1, 1, 1, 2, 2, 5, 1, 2, 2, 1, 5, 1, 5, 4, 2, 4,
+    2, 2, 2, 1, 16, 1, 4, 4, 1, 2, 4, 2, 8, 11, 5, 3,
+    11, 11, 5, 7, 3, 8, 6, 6, 2, 1, 1, 1, 2, 1, 1, 1,
+    1, 5, 2, 5, 1, 2, 6, 2, 6, 2, 1, 1, 3, 3, 1, 7,
+    4, 1, 2, 1, 1, 4, 1, 2, 4, 6, 3, 3, 1, 2, 4, 1,
+    1, 3, 4, 1, 3, 1, 6, 2, 1, 1, 2, 4, 1, 1, 1, 1,
+    1, 1, 8, 2, 1, 3, 1, 2, 1, 2, 1, 2, 1, 4, 1, 1,
+    1, 2, 4, 1, 3, 5, 3, 1, 1, 1, 2, 2, 2, 2, 5, 1,
+    2, 14, 2, 2, 3, 5, 12, 4, 16, 2, 20, 5, 9, 7, 1, 9,
+    5, 3, 3, 1, 4, 2, 16, 6, 7, 2, 19, 4, 11, 5, 7, 1,
+    4, 2, 6, 3, 2, 1, 5, 1, 2, 5, 6, 5, 8, 1, 1, 7,
+    6, 2, 2, 2, 5, 2, 1, 2, 1, 2, 5, 6, 3, 1, 2, 2,
+    12, 7, 1, 8, 2, 7, 13, 3, 2, 4, 40, 5, 7, 2, 3, 3,
+    6, 1, 3, 4, 3, 4, 5, 2, 7, 1, 2, 4, 2, 1, 1, 9,
+    1, 4, 15, 1, 1, 4, 2, 2, 12, 10, 3, 19, 6, 5, 2, 1,
+    1, 1, 16, 2, 16, 1, 3, 2, 4, 6, 2, 4, 0, 13, 3, 5,
+    2, 1, 1, 2, 1, 1, 6, 1, 1, 2, 1, 3, 1, 1, 8, 2,
+    2, 1, 2, 1, 2, 2, 4, 11, 2, 3, 1, 2, 1, 4, 3, 2,
+    3, 2, 1, 2, 11, 6, 8, 5, 8, 7, 7, 2, 1, 4, 11, 1,
+    6, 4, 2, 11, 1, 4, 4, 3, 3, 3, 2, 1, 3, 5, 1, 2,
+    3, 1, 14, 2, 6, 8, 1, 3, 2, 10, 2, 2, 10, 1, 7, 2,
+    5, 3, 3, 7, 1, 6, 3, 2, 1, 7, 2, 3, 2, 1, 5, 1,
+    1, 4, 1, 8, 1, 2, 1, 2, 2, 3, 1, 1, 1, 2, 1, 8,
+    3, 2, 6, 8, 1, 3, 7, 5, 2, 8, 4, 2, 2, 2, 1, 21,
+    1, 3, 8, 2, 2, 8, 4, 6, 3, 1, 1, 7, 2, 1, 9, 1,
+    6, 4, 1, 2, 3, 8, 4, 12, 5, 4, 1, 1, 1, 2, 1, 2,
+    2, 2, 4, 1, 1, 2, 2, 2, 2, 4, 4, 2, 2, 4, 2, 4,
+    3, 2, 3, 1, 1, 2, 1, 10, 1, 21, 2, 2, 5, 1, 4, 3,
+    12, 7, 3, 3, 10, 4, 5, 4, 1, 3, 4, 1, 5, 2, 6, 5,
+    6, 6, 1, 20, 3, 3, 4, 3, 5, 2, 2, 4, 3, 2, 1, 2,
+    7, 13, 15, 1, 8, 2, 5, 5, 1, 1, 1, 1, 9, 1, 1, 6,
+    8, 3, 7, 5, 2, 5, 8, 12, 1, 1, 2, 9, 7, 4, 9, 1,
+    1, 1, 1, 9, 1, 2, 3, 6, 2, 14, 7, 3, 6, 4, 4, 3,
+    9, 3, 5, 2, 2, 1, 3, 24, 3, 1, 6, 1, 2, 1, 4, 4,
+    1, 1, 8, 1, 13, 6, 11, 19, 1, 3, 1, 8, 5, 4, 1, 6,
+    15, 5, 12, 8, 7, 4, 2, 2, 2, 1, 9, 7, 11, 7, 1, 2,
+    4, 2, 3, 4, 5, 12, 1, 1, 11, 2, 7, 5, 2, 1, 4, 6,
+    1, 6, 6, 16, 2, 7, 5, 1, 8, 1, 2, 1, 1, 5, 4, 4,
+    5, 3, 7, 3, 5, 1, 1, 2, 1, 5, 1, 3, 4, 10, 4, 1,
+    10, 3, 5, 4, 1, 9, 4, 5, 3, 8, 8, 1, 6, 4, 1, 9,
+    4, 2, 2, 4, 6, 2, 5, 12, 1, 1, 4, 4, 1, 1, 1, 7,
+    5, 2, 1, 5, 4, 1, 13, 7, 2, 1, 2, 8, 4, 5, 1, 5,
+    4, 2, 7, 4, 3, 6, 9, 1, 5, 1, 3, 3, 3, 2, 4, 7,
+    6, 13, 1, 28, 9, 1, 3, 3, 6, 6, 6, 3, 5, 19, 4, 9,
+    17, 3, 2, 2, 10, 2, 5, 9, 2, 7, 1, 8, 2, 2, 1, 4,
+    8, 12, 3, 3, 8, 19, 4, 2, 4, 5, 6, 3, 2, 3, 5, 12,
+    1, 1, 3, 2, 2, 8, 5, 2, 2, 4, 3, 3, 8, 1, 3, 4,
+    1, 18, 2, 1, 6, 9, 1, 3, 12, 1, 1, 4, 1, 9, 1, 1,
+    2, 2, 4, 6, 2, 3, 1, 2, 4, 1, 2, 2, 4, 1, 1, 1,
+    1, 5, 5, 3, 1, 1, 3, 1, 2, 8, 2, 1, 4, 4, 10, 8,
+    8, 2, 1, 1, 5, 1, 6, 5, 3, 4, 2, 1, 6, 2, 11, 1,
+    3, 4, 2, 4, 6, 6, 1, 7, 3, 4, 4, 3, 3, 2, 2, 14,
+    11, 3, 13, 3, 1, 9, 2, 34, 3, 1, 27, 5, 5, 1, 4, 2,
+    4, 4, 2, 1, 2, 3, 7, 1, 1, 4, 2, 2, 1, 4, 3, 12,
+    3, 4, 1, 1, 1, 2, 1, 3, 8, 1, 5, 5, 1, 1, 2, 1,
+    2, 7, 1, 2, 2, 9, 1, 1, 1, 1, 2, 2, 1, 2, 2, 2,
+    1, 3, 12, 3, 7, 5, 3, 9, 4, 1, 7, 5, 4, 4, 7, 2,
+    3, 10, 34, 9, 14, 3, 1, 13, 6, 5, 12, 2, 15, 2, 5, 7,
+    9, 8, 1, 6, 6, 1, 2, 1, 2, 23, 1, 1, 9, 4, 1, 7,
+    4, 3, 3, 1, 2, 3, 2, 4, 8, 5, 11, 4, 2, 5, 8, 3,
+    7, 3, 1, 18, 2, 8, 9, 11, 6, 11, 3, 4, 10, 21, 4, 3,
+    6, 2, 4, 1, 5, 1, 5, 1, 6, 1, 6, 2, 2, 6, 3, 2,
+    1, 2, 12, 8, 1, 5, 5, 1, 2, 3, 11, 5, 3, 1, 7, 5,
+    6, 1, 4, 12, 1, 19, 16, 25, 1, 15, 16, 2, 1, 16, 4, 5,
+    9, 1, 9, 8, 6, 1, 5, 5, 1, 2, 1, 14, 14, 1, 2, 1,
+    1, 5, 5, 11, 3, 1, 2, 1, 2, 1, 2, 4, 4, 2, 3, 1,
+    2, 1, 1, 1, 5, 1, 3, 3, 1, 1, 6, 2, 5, 2, 7, 2,
+    4, 1, 3, 5, 8, 2, 2, 5, 1, 12, 9, 4, 5, 5, 4, 1,
+    1, 6, 1, 6, 4, 3, 3, 3, 4, 6, 6, 3, 3, 1, 4, 2,
+    4, 18, 12, 20, 15, 12, 2, 10, 1, 9, 1, 5, 2, 4, 8, 4,
+    4, 1, 1, 5, 2, 4, 3, 5, 2, 3, 4, 6, 7, 1, 7, 3,
+    3, 5, 3, 1, 10, 3, 3, 1, 1, 3, 1, 6, 5, 3, 5, 1,
+    4, 3, 3, 6, 2, 2, 5, 1, 2, 2, 1, 8, 3, 1, 2, 7,
+    12, 4, 3, 3, 7, 1, 4, 5, 1, 3, 3, 2, 3, 3, 3, 2,
+    5, 4, 3, 1, 6, 2, 6, 1, 2, 16, 11, 2, 1, 2, 4, 3,
+    7, 15, 1, 1, 2, 4, 4, 1, 4, 3, 2, 1, 3, 4, 1, 1,
+    1, 3, 1, 7, 12, 11, 4, 2, 1, 1, 2, 6, 11, 1, 2, 5,
+    2, 4, 9, 2, 1, 10, 2, 4, 1, 5, 1, 11, 4, 1, 8, 12,
+    7, 3, 3, 3, 13, 7, 3, 4, 1, 8, 9, 10, 5, 15, 4, 11,
+    1, 5, 2, 1, 4, 5, 1, 24, 4, 5, 8, 8, 9, 7, 9, 14,
+    12, 28, 3, 1, 2, 3, 3, 2, 1, 3, 4, 1, 1, 1, 15, 1,
+    5, 3, 6, 6, 2, 1, 4, 9, 3, 8, 3, 1, 4, 8, 1, 1,
+    1, 3, 5, 4, 1, 8, 18, 1, 5, 3, 1, 1, 1, 12, 1, 2,
+    9, 3, 4, 3, 2, 2, 4, 4, 2, 3, 1, 4, 5, 1, 2, 2,
+    2, 3, 6, 7, 2, 4, 1, 1, 6, 9, 6, 4, 3, 1, 2, 2,
+    15, 10, 3, 14, 1, 11, 2, 4, 6, 3, 4, 1, 8, 7, 1, 12,
+    6, 3, 2, 14, 1, 2, 5, 5, 6, 8, 3, 2, 5, 1, 1, 3,
+    2, 2, 3, 2, 3, 6, 1, 10, 11, 1, 1, 5, 7, 1, 1, 8,
+    7, 1, 3, 8, 1, 1, 3, 17, 4, 7, 5, 12, 2, 5, 1, 17,
+    7, 1, 3, 11, 3, 3, 2, 1, 5, 11, 4, 6, 2, 2, 3, 8,
+    2, 5, 8, 1, 3, 1, 3, 3, 3, 15, 4, 3, 2, 1, 7, 29,
+    4, 2, 3, 4, 2, 3, 1, 3, 7, 11, 2, 1, 4, 2, 1, 3,
+    6, 4, 3, 1, 5, 6, 4, 2, 1, 8, 1, 3, 11, 5, 1, 2,
+    6, 1, 4, 12, 1, 1, 2, 6, 2, 13, 13, 10, 2, 1, 1, 17,
+    1, 3, 5, 2, 1, 4, 17, 13, 4, 1, 7, 3, 6, 20, 2, 10,
+    2, 5, 3, 1, 11, 3, 7, 3, 2, 1, 2, 7, 6, 1, 1, 1,
+    4, 2, 6, 1, 3, 1, 2, 3, 1, 2, 3, 2, 7, 1, 2, 8,
+    2, 1, 6, 3, 2, 2, 5, 2, 2, 3, 1, 2, 8, 2, 1, 2,
+    2, 4, 3, 2, 1, 3, 7, 1, 10, 3, 2, 1, 1, 6, 1, 2,
+    12, 2, 6, 5, 2, 2, 2, 1, 2, 2, 2, 1, 5, 4, 4, 5,
+    3, 3, 12, 4, 1, 2, 8, 2, 3, 16, 7, 11, 1, 7, 2, 1,
+    2, 1, 3, 2, 3, 2, 6, 1, 3, 4, 2, 2, 1, 2, 3, 4,
+    1, 1, 1, 2, 1, 2, 6, 3, 3, 6, 7, 1, 4, 3, 2, 1,
+    1, 3, 2, 9, 4, 8, 9, 2, 2, 2, 10, 1, 4, 1, 1, 4,
+    1, 7, 8, 3, 5, 17, 3, 3, 1, 3, 2, 14, 1, 21, 4, 5,
+    13, 1, 7, 3, 2, 3, 8, 5, 3, 4, 2, 3, 1, 1, 1, 10,
+    7, 3, 1, 5, 7, 1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 7,
+    5, 1, 1, 1, 2, 139, 16, 250, 6, 143, 39, 132, 255, 19, 10, 255,
+    29, 8, 199, 4, 4, 9, 11, 9, 7, 9, 13, 2, 1, 3, 6, 2,
+    9, 5, 6, 3, 9, 7, 4, 4, 4, 13, 4, 3, 3, 2, 4, 1,
+    1, 6, 1, 6, 1, 1, 3, 8, 1, 2, 1, 5, 11, 2, 3, 20,
+    1, 2, 1, 4, 3, 6, 2, 1, 5, 2, 1, 5, 2, 2, 2, 1,
+    3, 6, 2, 2, 3, 4, 1, 10, 5, 2, 2, 4, 1, 4, 1, 31,
+    2, 9, 11, 2, 2, 4, 4, 1, 7, 1, 1, 2, 1, 1, 3, 2,
+    3, 4, 3, 6, 17, 4, 1, 3, 1, 7, 1, 1, 8, 3, 2, 1,
+    3, 3, 2, 1, 9, 3, 4, 3, 1, 2, 1, 7, 2, 7, 5, 1,
+    4, 3, 2, 3, 4, 2, 12, 1, 1, 3, 1, 11, 2, 1, 4, 4,
+    1, 4, 4, 6, 3, 3, 3, 1, 3, 13, 4, 10, 5, 1, 3, 7,
+    1, 4, 1, 2, 2, 5, 2, 1, 3, 1, 1, 1, 5, 1, 1, 1,
+    1, 5, 3, 1, 6, 2, 4, 2, 1, 1, 1, 3, 3, 7, 1, 4,
+    1, 1, 2, 1, 1, 2, 9, 1, 3, 2, 4, 1, 3, 1, 2, 7,
+    1, 3, 1, 2, 1, 4, 2, 2, 1, 1, 2, 2, 6, 1, 2, 1,
+    6, 1, 1, 1, 13, 9, 1, 3, 1, 1, 3, 9, 2, 1, 1, 3,
+    5, 16, 7, 3, 19, 2, 1, 3, 2, 2, 2, 7, 4, 1, 3, 14,
+    1, 2, 4, 1, 2, 1, 2, 4, 4, 1, 8, 3, 3, 11, 1, 1,
+    3, 2, 8, 2, 1, 2, 1, 1, 3, 4, 2, 14, 1, 1, 3, 2,
+    3, 2, 10, 3, 4, 1, 3, 1, 3, 5, 1, 1, 1, 2, 1, 1,
+    4, 4, 1, 1, 9, 3, 4, 1, 4, 3, 1, 12, 3, 1, 8, 2,
+    2, 4, 8, 1, 2, 6, 2, 1, 2, 2, 1, 3, 4, 1, 4, 1,
+    3, 1, 4, 2, 1, 3, 3, 1, 1, 1, 4, 3, 3, 9, 9, 4,
+    6, 5, 4, 4, 1, 1, 6, 2, 1, 1, 1, 1, 1, 1, 2, 1,
+    1, 6, 1, 1, 1, 3, 2, 4, 6, 1, 1, 1, 1, 1, 5, 2,
+    2, 3, 2, 2, 4, 1, 6, 3, 1, 3, 17, 9, 4, 6, 1, 1,
+    12, 4, 8, 2, 5, 1, 4, 6, 2, 1, 4, 3, 2, 1, 1, 7,
+    3, 1, 1, 3, 1, 2, 6, 2, 4, 3, 3, 3, 3, 1, 1, 7,
+    2, 1, 1, 5, 1, 1, 3, 3, 16, 1, 4, 2, 7, 7, 2, 4,
+    3, 5, 8, 1, 7, 5, 3, 2, 3, 4, 7, 84, 6, 3, 19, 25,
+    4, 18, 15, 19, 9, 25, 8, 22, 7, 15, 31, 8, 2, 7, 2, 39,
+    2, 23, 31, 43, 23, 54, 23, 25, 23, 14, 40, 11, 53, 52, 26, 49,
+    4, 5, 106, 26, 16, 14, 2, 5, 1, 24, 7, 7, 6, 15, 34, 7,
+    4, 17, 17, 1, 22, 42, 48, 11, 5, 9, 32, 16, 58, 74, 30, 2,
+    9, 25, 51, 10, 10, 46, 48, 86, 73, 1, 25, 18, 32, 26, 113, 47,
+    16, 17, 18, 28, 5, 146, 9, 37, 47, 29, 101, 88, 3, 32, 13, 5,
+    98, 82, 53, 13, 32, 90, 9, 15, 8, 0, 2, 2, 1, 19, 2, 4,
+    3, 4, 1, 2, 1, 3, 6, 2, 1, 3, 2, 3, 5, 3, 1, 5,
+    12, 2, 5, 11, 1, 2, 6, 4, 1, 4, 4, 12, 5, 4, 2, 1,
+    11, 9, 27, 3, 14, 1, 4, 4, 7, 3, 1, 11, 6, 3, 3, 5,
+    1, 3, 12, 2, 1, 5, 2, 16, 1, 5, 9, 3, 5, 1, 4, 4,
+    5, 4, 3, 2, 1, 4, 1, 3, 4, 5, 2, 3, 9, 1, 3, 4,
+    1, 5, 10, 9, 1, 3, 4, 4, 3, 2, 2, 3, 1, 4, 1, 8,
+    4, 3, 6, 1, 8, 5, 5, 1, 4, 1, 11, 6, 1, 3, 1, 8,
+    3, 1, 5, 1, 9, 11, 6, 4, 1, 10, 1, 5, 3, 1, 3, 2,
+    1, 3, 2, 1, 6, 7, 1, 2, 6, 16, 2, 3, 3, 1, 1, 3,
+    3, 4, 5, 13, 1, 2, 1, 1, 2, 1, 1, 1, 1, 2, 3, 5,
+    5, 2, 1, 4, 10, 4, 9, 2, 4, 1, 3, 1, 4, 2, 1, 8,
+    3, 3, 2, 1, 1, 24, 3, 6, 5, 5, 3, 4, 5, 5, 4, 5,
+    2, 5, 8, 2, 3, 3, 6, 4, 3, 5, 1, 5, 4, 1, 2, 3,
+    2, 2, 4, 6, 13, 5, 3, 6, 3, 4, 2, 8, 1, 4, 1, 1,
+    1, 2, 2, 2, 3, 6, 2, 1, 2, 6, 3, 10, 5, 18, 1, 3,
+    11, 1, 2, 9, 13, 5, 4, 1, 1, 1, 1, 9, 9, 1, 1, 1,
+    1, 4, 7, 1, 7, 16, 8, 3, 5, 4, 3, 3, 4, 1, 11, 6,
+    7, 5, 4, 2, 5, 4, 2, 1, 4, 3, 5, 1, 11, 12, 17, 5,
+    4, 8, 2, 1, 1, 12, 9, 16, 16, 9, 3, 14, 5, 1, 15, 1,
+    2, 3, 15, 16, 8, 4, 13, 1, 1, 2, 2, 4, 2, 1, 6, 4,
+    5, 4, 1, 3, 8, 1, 1, 8, 1, 6, 12, 9, 18, 1, 5, 5,
+    1, 2, 9, 7, 1, 10, 6, 7, 6, 18, 3, 3, 1, 4, 3, 2,
+    4, 6, 9, 3, 13, 1, 4, 1, 3, 12, 4, 2, 2, 2, 1, 4,
+    5, 2, 13, 5, 2, 1, 1, 6, 2, 10, 8, 1, 1, 3, 6, 5,
+    15, 7, 1, 1, 2, 6, 1, 1, 3, 8, 1, 5, 3, 2, 3, 2,
+    4, 5, 12, 6, 2, 1, 10, 2, 3, 2, 5, 3, 1, 3, 5, 15,
+    6, 8, 3, 11, 7, 4, 1, 7, 1, 22, 22, 2, 1, 7, 1, 1,
+    21, 8, 4, 9, 4, 1, 1, 1, 4, 10, 3, 1, 2, 6, 1, 5,
+    10, 1, 8, 1, 1, 2, 9, 1, 1, 4, 1, 5, 2, 2, 3, 2,
+    1, 5, 1, 6, 8, 1, 1, 10, 1, 2, 9, 3, 14, 1, 4, 1,
+    2, 3, 5, 2, 1, 1, 2, 6, 2, 10, 3, 1, 3, 2, 2, 4,
+    2, 1, 5, 2, 6, 2, 3, 3, 1, 1, 1, 4, 3, 2, 5, 6,
+    10, 3, 8, 2, 12, 1, 4, 6, 1, 3, 8, 5, 12, 7, 1, 5,
+    4, 11, 2, 10, 5, 2, 8, 1, 8, 2, 1, 8, 17, 1, 1, 4,
+    4, 1, 11, 7, 4, 3, 2, 2, 3, 5, 9, 3, 11, 1, 1, 1,
+    1, 1, 2, 2, 1, 2, 1, 4, 1, 5, 9, 2, 1, 5, 3, 2,
+    3, 1, 1, 4, 4, 1, 1, 2, 6, 3, 4, 8, 1, 2, 3, 9,
+    7, 2, 6, 7, 2, 2, 2, 1, 1, 1, 4, 1, 6, 12, 4, 7,
+    1, 4, 3, 3, 3, 2, 5, 1, 3, 4, 2, 1, 1, 1, 3, 4,
+    7, 6, 8, 12, 3, 4, 5, 5, 6, 9, 1, 3, 2, 2, 1, 3,
+    21, 3, 1, 4, 1, 6, 1, 1, 4, 6, 3, 3, 5, 2, 3, 4,
+    2, 7, 1, 1, 1, 4, 3, 4, 1, 1, 1, 4, 2, 1, 2, 6,
+    1, 1, 1, 2, 1, 6, 2, 2, 5, 1, 3, 1, 3, 1, 1, 3,
+    13, 6, 1, 2, 3, 1, 7, 5, 3, 1, 3, 1, 1, 7, 1, 1,
+    5, 5, 1, 18, 1, 1, 1, 4, 1, 2, 7, 3, 3, 1, 2, 2,
+    7, 1, 3, 5, 1, 2, 2, 3, 5, 1, 7, 4, 1, 1, 1, 1,
+    3, 2, 1, 7, 3, 3, 1, 1, 1, 2, 3, 8, 1, 4, 3, 8,
+    5, 1, 1, 3, 1, 7, 2, 2, 2, 5, 2, 7, 1, 4, 2, 5,
+    11, 1, 4, 3, 3, 7, 2, 5, 6, 2, 1, 5, 2, 1, 6, 2,
+    7, 1, 1, 16, 3, 1, 2, 2, 1, 11, 2, 9, 1, 10, 2, 2,
+    5, 8, 5, 3, 2, 1, 3, 1, 1, 3, 1, 7, 3, 3, 2, 1,
+    1, 2, 6, 7, 6, 9, 1, 1, 2, 4, 4, 4, 6, 1, 3, 4,
+    3, 5, 2, 1, 4, 1, 2, 2, 5, 6, 7, 1, 3, 4, 2, 1,
+    1, 3, 5, 6, 3, 1, 2, 2, 1, 5, 4, 1, 4, 1, 1, 1,
+    2, 1, 4, 3, 2, 1, 1, 3, 7, 1, 6, 1, 1, 2, 3, 1,
+    1, 1, 2, 9, 3, 2, 1, 2, 1, 1, 1, 3, 3, 3, 2, 1,
+    1, 7, 6, 10, 5, 1, 1, 3, 4, 7, 1, 1, 7, 1, 4, 4,
+    2, 1, 3, 1, 2, 7, 3, 2, 3, 1, 2, 2, 1, 1, 3, 3,
+    2, 1, 10, 2, 1, 2, 6, 1, 5, 1, 4, 2, 2, 2, 1, 1,
+    5, 1, 2, 1, 11, 1, 1, 1, 6, 1, 1, 1, 4, 1, 2, 1,
+    1, 2, 2, 2, 5, 5, 2, 1, 1, 4, 2, 5, 4, 4, 5, 2,
+    6, 3, 6, 2, 2, 4, 7, 1, 1, 5, 10, 3, 2, 2, 1, 5,
+    3, 1, 1, 2, 3, 3, 3, 5, 4, 2, 1, 1, 9, 1, 9, 3,
+    13, 1, 2, 5, 2, 10, 2, 1, 11, 1, 3, 1, 6, 5, 2, 2,
+    18, 4, 4, 7, 4, 1, 7, 2, 7, 1, 3, 4, 17, 4, 3, 4,
+    1, 5, 2, 2, 2, 1, 2, 1, 1, 8, 4, 4, 1, 1, 8, 1,
+    1, 3, 9, 4, 6, 4, 12, 1, 3, 1, 4, 10, 3, 1, 2, 6,
+    2, 2, 6, 1, 6, 1, 7, 1, 1, 10, 5, 3, 4, 2, 7, 33,
+    5, 2, 3, 12, 1, 1, 10, 1, 3, 14, 3, 15, 2, 4, 4, 6,
+    4, 20, 6, 3, 1, 1, 4, 9, 3, 3, 3, 7, 3, 2, 4, 7,
+    10, 5, 4, 2, 1, 3, 13, 2, 7, 7, 3, 12, 5, 1, 9, 6,
+    4, 12, 5, 3, 2, 4, 12, 3, 10, 4, 3, 4, 4, 3, 8, 2,
+    3, 3, 7, 2, 20, 1, 2, 12, 3, 1, 1, 4, 7, 3, 13, 1,
+    2, 6, 1, 5, 1, 4, 0, 14, 4, 7, 2, 4, 1, 2, 5, 3,
+    1, 1, 3, 6, 4, 1, 1, 2, 2, 5, 1, 1, 4, 2, 4, 7,
+    6, 4, 2, 8, 3, 6, 3, 1, 4, 4, 9, 1, 13, 7, 2, 1,
+    2, 1, 6, 19, 5, 12, 2, 2, 20, 1, 1, 3, 1, 1, 4, 4,
+    5, 5, 1, 2, 5, 1, 1, 4, 2, 1, 2, 2, 1, 3, 1, 3,
+    3, 1, 1, 3, 2, 2, 3, 5, 1, 6, 4, 2, 2, 1, 2, 2,
+    3, 3, 2, 2, 2, 2, 3, 4, 6, 3, 1, 9, 11, 2, 1, 3,
+    2, 3, 5, 1, 5, 1, 2, 6, 6, 8, 8, 6, 2, 1, 4, 6,
+    1, 2, 4, 5, 1, 1, 3, 7, 4, 5, 4, 2, 5, 2, 1, 3,
+    2, 2, 6, 4, 4, 1, 2, 4, 2, 4, 4, 12, 4, 2, 3, 1,
+    6, 5, 6, 1, 11, 3, 7, 7, 1, 1, 1, 2, 3, 3, 1, 2,
+    1, 2, 1, 2, 6, 6, 5, 4, 4, 2, 1, 1, 3, 8, 2, 2,
+    2, 1, 1, 1, 2, 1, 2, 2, 5, 2, 4, 1, 6, 7, 3, 1,
+    1, 2, 1, 1, 2, 2, 1, 1, 3, 1, 4, 8, 4, 1, 1, 2,
+    1, 4, 1, 2, 3, 8, 3, 1, 2, 1, 1, 1, 8, 1, 4, 3,
+    1, 1, 4, 5, 1, 4, 2, 1, 1, 1, 2, 1, 1, 1, 2, 2,
+    1, 1, 5, 13, 2, 4, 3, 3, 9, 1, 1, 3, 2, 3, 7, 2,
+    2, 2, 2, 1, 6, 2, 6, 1, 8, 3, 2, 3, 2, 8, 2, 5,
+    7, 1, 1, 1, 2, 3, 6, 1, 4, 2, 3, 2, 1, 1, 6, 1,
+    3, 2, 2, 1, 2, 3, 6, 1, 1, 2, 1, 1, 1, 1, 6, 2,
+    2, 4, 1, 2, 2, 1, 2, 2, 4, 2, 2, 2, 3, 1, 1, 1,
+    2, 1, 1, 2, 1, 12, 1, 1, 2, 2, 1, 4, 1, 1, 1, 1,
+    3, 1, 1, 3, 1, 1, 1, 1, 7, 9, 5, 4, 4, 6, 8, 4,
+    1, 3, 3, 5, 1, 3, 1, 3, 3, 1, 1, 2, 9, 12, 8, 3,
+    1, 2, 3, 3, 3, 3, 4, 5, 1, 1, 2, 2, 2, 4, 4, 1,
+    1, 7, 1, 1, 6, 1, 1, 6, 8, 1, 4, 1, 1, 1, 1, 2,
+    2, 3, 1, 1, 1, 5, 5, 6, 3, 3, 8, 2, 1, 2, 1, 3,
+    1, 3, 8, 4, 1, 2, 4, 11, 3, 6, 6, 6, 5, 3, 2, 3,
+    1, 2, 1, 8, 1, 3, 1, 3, 1, 3, 3, 2, 8, 5, 1, 5,
+    2, 5, 2, 1, 1, 3, 2, 5, 4, 18, 6, 2, 11, 2, 1, 1,
+    3, 1, 3, 1, 2, 2, 7, 5, 1, 1, 1, 3, 3, 3, 1, 2,
+    6, 5, 9, 6, 2, 2, 1, 1, 4, 2, 5, 5, 2, 1, 2, 2,
+    1, 3, 3, 6, 4, 6, 3, 1, 2, 3, 1, 6, 9, 3, 2, 1,
+    6, 10, 7, 3, 3, 1, 1, 4, 3, 2, 13, 1, 4, 3, 1, 1,
+    3, 1, 8, 9, 1, 1, 2, 5, 10, 16, 1, 16, 2, 11, 18, 6,
+    4, 4, 5, 9, 9, 1, 3, 5, 3, 8, 12, 1, 1, 4, 1, 3,
+    9, 7, 1, 2, 5, 3, 1, 1, 3, 1, 1, 1, 2, 1, 1, 1,
+    3, 2, 7, 4, 5, 3, 1, 5, 3, 1, 1, 2, 2, 1, 9, 8,
+    6, 8, 1, 2, 3, 6, 7, 7, 1, 3, 2, 4, 7, 1, 2, 8,
+    1, 5, 4, 4, 4, 2, 4, 2, 2, 7, 3, 6, 4, 13, 6, 18,
+    15, 2, 3, 9, 2, 1, 2, 2, 3, 1, 7, 2, 5, 1, 6, 4,
+    2, 6, 3, 10, 6, 5, 1, 6, 1, 1, 1, 1, 2, 1, 1, 1,
+    7, 1, 2, 2, 2, 3, 2, 1, 1, 1, 1, 2, 1, 1, 3, 1,
+    1, 1, 1, 2, 3, 2, 1, 5, 1, 3, 4, 2, 1, 2, 1, 8,
+    1, 1, 1, 1, 1, 4, 3, 3, 1, 1, 8, 2, 2, 1, 1, 4,
+    7, 3, 3, 6, 2, 8, 2, 1, 4, 5, 3, 4, 1, 11, 1, 6,
+    2, 15, 1, 12, 1, 1, 1, 9, 4, 1, 5, 15, 2, 3, 3, 1,
+    3, 12, 3, 8, 2, 8, 1, 1, 4, 3, 5, 1, 5, 1, 4, 2,
+    2, 2, 2, 2, 1, 2, 6, 3, 9, 3, 1, 4, 3, 1, 3, 2,
+    1, 5, 5, 5, 1, 2, 1, 2, 2, 2, 1, 4, 1, 4, 10, 1,
+    3, 1, 1, 1, 1, 1, 3, 3, 3, 1, 5, 3, 1, 1, 10, 1,
+    1, 1, 1, 2, 1, 8, 1, 1, 3, 2, 2, 1, 2, 1, 1, 1,
+    3, 4, 2, 4, 4, 2, 1, 1, 4, 1, 1, 1, 2, 5, 3, 5,
+    3, 2, 1, 2, 1, 3, 3, 4, 3, 4, 6, 3, 2, 3, 1, 4,
+    1, 5, 1, 1, 4, 1, 1, 1, 4, 1, 2, 1, 1, 4, 2, 2,
+    9, 3, 1, 1, 1, 2, 4, 1, 2, 1, 5, 13, 6, 2, 3, 4,
+    1, 1, 1, 1, 5, 5, 8, 4, 3, 20, 2, 4, 1, 1, 13, 2,
+    1, 9, 1, 5, 4, 3, 4, 1, 1, 2, 3, 2, 1, 4, 5, 1,
+    4, 5, 2, 9, 2, 3, 1, 11, 1, 1, 1, 5, 2, 3, 1, 7,
+    1, 7, 3, 2, 3, 2, 6, 2, 2, 4, 1, 1, 3, 1, 2, 1,
+    2, 1, 3, 1, 2, 1, 1, 4, 2, 2, 1, 3, 1, 1, 2, 1,
+    1, 11, 1, 1, 5, 1, 3, 4, 3, 1, 1, 1, 3, 30, 1, 8,
+    4, 31, 4, 3, 6, 19, 1, 23, 8, 7, 1, 21, 11, 8, 39, 9,
+    8, 9, 6, 11, 6, 30, 15, 1, 12, 1, 2, 9, 3, 19, 16, 34,
+    10, 10, 5, 7, 8, 2, 1, 12, 19, 2, 5, 20, 5, 11, 1, 30,
+    1, 29, 8, 2, 10, 15, 1, 3, 1, 17, 15, 9, 22, 7, 14, 30,
+    1, 5, 2, 26, 25, 1, 17, 2, 36, 3, 11, 4, 30, 2, 4, 2,
+    19, 6, 6, 1, 4, 2, 3, 33, 6, 9, 15, 15, 14, 18, 23, 3,
+    8, 4, 32, 1, 2, 20, 19, 10, 6, 9, 49, 23, 38, 16, 19, 58,
+    4, 11, 3, 7, 20, 15, 6, 17, 11, 24, 29, 32, 4, 2, 34, 102,
+    248, 2, 189, 150, 34, 36, 0, 2, 2, 1, 2, 7, 10, 1, 4, 1,
+    4, 3, 1, 1, 1, 1, 7, 2, 3, 3, 5, 5, 4, 4, 1, 4,
+    1, 2, 12, 2, 1, 4, 1, 3, 1, 2, 6, 3, 3, 4, 2, 1,
+    2, 2, 7, 1, 5, 4, 2, 3, 1, 2, 1, 3, 1, 1, 6, 6,
+    3, 7, 4, 6, 9, 2, 1, 2, 6, 1, 1, 4, 1, 1, 2, 13,
+    3, 1, 1, 9, 4, 3, 13, 1, 4, 1, 2, 3, 3, 2, 9, 1,
+    1, 6, 7, 2, 4, 3, 2, 2, 1, 8, 1, 2, 5, 9, 1, 1,
+    1, 1, 2, 9, 2, 1, 1, 1, 3, 1, 1, 6, 3, 3, 2, 2,
+    1, 7, 1, 1, 1, 5, 5, 2, 1, 1, 3, 2, 3, 1, 2, 10,
+    2, 5, 2, 2, 8, 3, 7, 5, 4, 1, 1, 5, 3, 1, 4, 3,
+    27, 3, 1, 12, 2, 1, 5, 7, 3, 11, 1, 7, 1, 7, 2, 3,
+    1, 3, 2, 7, 10, 5, 1, 10, 5, 1, 5, 6, 2, 1, 6, 8,
+    6, 6, 2, 1, 1, 9, 3, 25, 13, 2, 4, 4, 2, 2, 7, 2,
+    20, 1, 6, 1, 3, 3, 3, 3, 6, 11, 1, 3, 5, 1, 7, 9,
+    10, 8, 6, 1, 15, 5, 2, 7, 3, 7, 1, 8, 2, 8, 3, 3,
+    9, 4, 4, 3, 5, 4, 2, 2, 2, 2, 2, 1, 2, 1, 3, 1,
+    2, 4, 9, 8, 7, 6, 4, 8, 3, 1, 19, 7, 18, 3, 10, 6,
+    5, 1, 2, 4, 2, 13, 5, 1, 3, 6, 5, 6, 38, 5, 23, 5,
+    10, 12, 23, 22, 4, 2, 9, 4, 2, 7, 1, 1, 3, 1, 14, 22,
+    5, 13, 6, 1, 1, 9, 2, 3, 5, 8, 12, 4, 8, 2, 9, 1,
+    7, 12, 29, 3, 3, 13, 7, 4, 7, 12, 14, 1, 2, 1, 1, 6,
+    7, 1, 23, 5, 3, 2, 55, 33, 63, 32, 8, 43, 48, 10, 25, 16,
+    48, 16, 6, 13, 17, 9, 4, 5, 15, 28, 20, 24, 39, 2, 3, 35,
+    29, 47, 54, 21, 5, 40, 23, 42, 10, 17, 1, 6, 21, 19, 61, 4,
+    13, 15, 11, 46, 14, 22, 4, 22, 5, 4, 19, 5, 41, 39, 13, 1,
+    23, 21, 19, 13, 12, 83, 14, 19, 52, 1, 0, 2, 1, 1, 5, 7,
+    10, 3, 1, 2, 1, 4, 11, 32, 1, 7, 3, 3, 3, 3, 12, 7,
+    5, 2, 7, 27, 1, 6, 1, 7, 3, 13, 12, 1, 17, 3, 4, 4,
+    4, 21, 1, 4, 1, 2, 1, 2, 2, 6, 2, 1, 2, 1, 2, 1,
+    1, 3, 4, 2, 5, 4, 1, 1, 4, 1, 2, 3, 1, 5, 2, 4,
+    6, 4, 8, 2, 2, 2, 1, 3, 3, 9, 2, 2, 1, 4, 3, 3,
+    1, 9, 3, 4, 2, 5, 2, 5, 1, 1, 1, 4, 10, 2, 1, 1,
+    2, 1, 4, 6, 6, 3, 3, 5, 6, 3, 1, 5, 15, 3, 3, 3,
+    7, 12, 1, 9, 3, 4, 1, 2, 1, 1, 17, 6, 2, 5, 3, 4,
+    1, 5, 14, 2, 1, 2, 1, 1, 8, 5, 8, 2, 8, 2, 4, 1,
+    2, 2, 1, 1, 9, 10, 2, 5, 1, 4, 2, 1, 1, 2, 2, 5,
+    2, 2, 1, 4, 7, 14, 2, 1, 2, 9, 3, 4, 3, 3, 1, 2,
+    5, 2, 3, 9, 4, 4, 5, 1, 5, 1, 1, 5, 2, 2, 3, 1,
+    1, 2, 9, 6, 3, 1, 5, 3, 1, 1, 3, 8, 13, 3, 1, 15,
+    4, 1, 1, 5, 1, 10, 6, 1, 1, 2, 2, 1, 2, 1, 5, 1,
+    3, 1, 2, 1, 1, 1, 3, 1, 3, 4, 1, 1, 1, 3, 1, 1,
+    2, 3, 3, 1, 4, 2, 1, 1, 3, 7, 1, 8, 1, 3, 1, 5,
+    4, 2, 1, 3, 11, 3, 18, 3, 3, 5, 1, 4, 15, 1, 4, 3,
+    3, 2, 3, 1, 1, 17, 1, 2, 1, 1, 4, 2, 10, 1, 4, 5,
+    2, 3, 3, 1, 1, 1, 5, 3, 1, 1, 2, 9, 1, 3, 3, 1,
+    3, 2, 2, 1, 3, 2, 4, 3, 2, 1, 2, 7, 1, 1, 2, 3,
+    5, 1, 4, 1, 1, 1, 3, 2, 1, 8, 1, 4, 1, 1, 2, 4,
+    1, 3, 5, 1, 2, 2, 2, 1, 2, 15, 2, 4, 12, 3, 1, 1,
+    3, 4, 2, 2, 1, 5, 1, 2, 1, 2, 1, 8, 1, 1, 4, 17,
+    5, 3, 4, 4, 10, 2, 5, 1, 3, 4, 2, 1, 1, 1, 1, 8,
+    2, 1, 2, 1, 1, 1, 2, 1, 1, 2, 11, 3, 6, 2, 1, 1,
+    1, 4, 2, 6, 5, 2, 6, 3, 2, 5, 1, 3, 4, 3, 1, 2,
+    4, 4, 6, 1, 2, 4, 1, 4, 9, 1, 2, 3, 9, 2, 2, 3,
+    3, 5, 3, 1, 4, 1, 3, 2, 1, 3, 0, 4, 1, 3, 5, 11,
+    16, 6, 20, 14, 1, 13, 2, 21, 9, 4, 1, 1, 29, 9, 2, 18,
+    13, 5, 15, 2, 6, 16, 6, 2, 3, 14, 4, 3, 5, 3, 2, 22,
+    10, 10, 4, 9, 2, 18, 3, 2, 1, 2, 2, 1, 1, 3, 2, 3,
+    4, 1, 2, 7, 9, 9, 4, 2, 2, 4, 3, 6, 2, 1, 8, 2,
+    1, 1, 4, 3, 1, 1, 11, 3, 7, 2, 1, 6, 5, 1, 3, 1,
+    1, 5, 2, 2, 1, 2, 5, 2, 3, 1, 1, 3, 8, 2, 6, 6,
+    3, 2, 3, 2, 5, 7, 5, 3, 1, 4, 4, 2, 8, 3, 4, 12,
+    8, 3, 4, 2, 4, 4, 1, 1, 8, 2, 5, 3, 1, 6, 1, 3,
+    2, 1, 6, 6, 1, 1, 3, 9, 3, 5, 1, 2, 7, 3, 1, 1,
+    1, 6, 1, 1, 2, 1, 1, 1, 3, 2, 10, 1, 4, 1, 4, 1,
+    11, 1, 15, 8, 5, 1, 2, 2, 5, 7, 3, 4, 1, 1, 6, 1,
+    2, 3, 3, 5, 2, 3, 7, 2, 10, 1, 7, 3, 1, 6, 1, 1,
+    6, 3, 1, 1, 1, 1, 4, 1, 2, 1, 1, 10, 2, 3, 1, 1,
+    2, 2, 1, 4, 4, 2, 1, 1, 2, 1, 1, 1, 1, 8, 1, 1,
+    9, 3, 4, 3, 2, 1, 1, 5, 1, 1, 2, 7, 2, 2, 3, 2,
+    1, 1, 3, 1, 5, 1, 3, 3, 3, 2, 1, 6, 4, 5, 1, 4,
+    2, 2, 5, 1, 2, 4, 1, 1, 3, 5, 12, 1, 15, 5, 1, 3,
+    1, 2, 5, 11, 2, 3, 4, 1, 11, 5, 1, 4, 5, 5, 1, 1,
+    4, 4, 11, 1, 3, 1, 3, 1, 1, 1, 8, 20, 3, 5, 9, 6,
+    2, 4, 4, 5, 1, 1, 3, 9, 2, 3, 1, 4, 1, 3, 3, 1,
+    2, 2, 15, 2, 3, 1, 7, 6, 3, 2, 12, 1, 1, 3, 2, 2,
+    3, 1, 3, 3, 5, 6, 2, 2, 4, 1, 11, 1, 1, 1, 8, 1,
+    4, 5, 2, 2, 2, 10, 1, 4, 1, 3, 1, 5, 9, 10, 13, 7,
+    4, 19, 1, 10, 3, 10, 3, 8, 17, 9, 1, 4, 1, 4, 3, 8,
+    2, 5, 4, 7, 3, 5, 1, 1, 9, 3, 2, 2, 7, 2, 13, 6,
+    1, 2, 5, 2, 3, 11, 5, 4, 4, 2, 3, 3, 3, 2, 1, 5,
+    1, 13, 2, 1, 3, 1, 4, 1, 2, 11, 11, 2, 1, 3, 2, 1,
+    3, 2, 6, 1, 7, 2, 1, 3, 1, 18, 5, 1, 5, 8, 3, 7,
+    1, 5, 1, 3, 1, 1, 1, 1, 4, 7, 1, 2, 6, 2, 2, 11,
+    3, 3, 2, 1, 19, 1, 1, 2, 2, 5, 2, 4, 2, 14, 3, 3,
+    5, 1, 2, 5, 6, 3, 2, 1, 7, 2, 1, 2, 4, 3, 1, 2,
+    6, 3, 2, 3, 1, 1, 1, 9, 8, 12, 7, 4, 1, 2, 7, 8,
+    3, 3, 3, 3, 5, 5, 8, 1, 1, 19, 1, 4, 3, 3, 6, 5,
+    7, 5, 3, 7, 3, 2, 6, 5, 5, 2, 5, 3, 5, 1, 1, 2,
+    7, 8, 1, 3, 3, 1, 2, 3, 1, 1, 5, 6, 5, 2, 6, 1,
+    1, 1, 3, 5, 6, 8, 5, 1, 3, 8, 3, 3, 8, 4, 3, 8,
+    8, 3, 1, 3, 5, 6, 2, 2, 1, 1, 5, 1, 4, 9, 7, 21,
+    3, 1, 3, 2, 8, 2, 19, 4, 4, 8, 6, 10, 6, 6, 10, 4,
+    1, 3, 4, 5, 4, 10, 9, 6, 3, 1, 2, 2, 1, 4, 6, 2,
+    3, 2, 2, 7, 6, 1, 4, 1, 3, 3, 6, 4, 7, 4, 2, 9,
+    3, 6, 3, 15, 2, 15, 3, 1, 3, 4, 11, 6, 3, 13, 1, 3,
+    1, 1, 1, 5, 1, 2, 28, 17, 1, 2, 10, 4, 2, 1, 20, 10,
+    8, 4, 17, 4, 9, 1, 6, 7, 3, 14, 16, 6, 7, 9, 2, 3,
+    1, 9, 1, 2, 5, 8, 13, 3, 2, 1, 9, 21, 6, 1, 8, 23,
+    1, 2, 2, 3, 3, 11, 2, 9, 7, 1, 3, 4, 11, 10, 13, 14,
+    4, 4, 3, 2, 1, 2, 8, 3, 8, 4, 3, 1, 1, 9, 3, 10,
+    5, 6, 3, 6, 7, 1, 25, 10, 10, 3, 2, 6, 1, 6, 3, 1,
+    3, 3, 4, 6, 9, 4, 4, 1, 2, 6, 9, 6, 1, 5, 1, 3,
+    18, 1, 11, 8, 1, 3, 8, 2, 2, 7, 1, 2, 1, 1, 6, 4,
+    5, 2, 7, 1, 2, 1, 5, 6, 22, 2, 1, 6, 4, 2, 2, 3,
+    2, 4, 5, 1, 3, 2, 13, 1, 4, 2, 4, 10, 1, 1, 5, 6,
+    15, 2, 3, 5, 6, 2, 3, 7, 4, 1, 2, 1, 7, 1, 3, 1,
+    8, 1, 18, 10, 13, 1, 14, 5, 10, 9, 1, 2, 15, 18, 4, 3,
+    7, 1, 6, 3, 2, 3, 2, 11, 5, 3, 1, 1, 6, 1, 4, 5,
+    2, 1, 1, 2, 1, 3, 1, 3, 6, 5, 5, 4, 1, 1, 3, 20,
+    2, 2, 5, 6, 6, 2, 1, 2, 2, 8, 4, 2, 1, 7, 1, 11,
+    7, 4, 13, 2, 3, 3, 4, 2, 3, 1, 1, 2, 5, 7, 3, 2,
+    2, 4, 3, 1, 5, 4, 1, 7, 2, 5, 2, 2, 2, 4, 1, 5,
+    8, 1, 2, 6, 5, 3, 1, 1, 2, 2, 3, 9, 7, 7, 8, 14,
+    13, 4, 1, 3, 1, 4, 4, 1, 7, 12, 1, 2, 3, 5, 6, 3,
+    1, 6, 1, 5, 1, 2, 6, 1, 9, 1, 1, 9, 2, 3, 5, 8,
+    6, 4, 4, 2, 11, 1, 4, 18, 1, 1, 1, 5, 1, 1, 7, 1,
+    4, 2, 3, 1, 2, 8, 2, 5, 1, 3, 6, 5, 11, 2, 6, 2,
+    2, 2, 2, 1, 3, 1, 8, 2, 23, 2, 1, 3, 2, 2, 23, 4,
+    15, 3, 3, 15, 2, 5, 6, 3, 9, 2, 4, 4, 8, 4, 2, 5,
+    2, 7, 8, 15, 1, 2, 2, 3, 4, 2, 4, 9, 9, 2, 1, 3,
+    3, 1, 2, 1, 5, 3, 2, 2, 2, 7, 2, 3, 3, 1, 5, 3,
+    11, 4, 3, 1, 1, 2, 2, 1, 8, 1, 1, 5, 0, 17, 10, 1,
+    6, 4, 5, 3, 10, 10, 3, 25, 36, 1, 3, 2, 3, 15, 1, 3,
+    5, 1, 6, 6, 1, 11, 1, 2, 1, 2, 1, 2, 3, 3, 3, 2,
+    14, 7, 1, 1, 2, 1, 4, 2, 1, 6, 3, 2, 3, 3, 2, 3,
+    1, 3, 5, 10, 4, 1, 2, 1, 3, 1, 5, 3, 2, 5, 2, 1,
+    3, 1, 1, 2, 2, 1, 3, 9, 2, 5, 7, 2, 2, 3, 4, 5,
+    2, 6, 1, 2, 3, 1, 1, 4, 9, 2, 7, 8, 1, 5, 2, 3,
+    4, 11, 1, 2, 9, 2, 5, 1, 2, 1, 6, 6, 8, 1, 16, 1,
+    5, 12, 2, 1, 1, 5, 1, 1, 1, 5, 1, 6, 1, 2, 2, 1,
+    1, 6, 3, 6, 6, 5, 2, 5, 1, 2, 1, 3, 1, 2, 2, 2,
+    2, 1, 3, 5, 2, 1, 1, 1, 1, 2, 3, 1, 1, 1, 2, 6,
+    1, 4, 1, 1, 2, 1, 1, 1, 14, 10, 6, 1, 6, 13, 8, 17,
+    12, 1, 3, 7, 2, 2, 1, 16, 1, 3, 14, 3, 2, 6, 11, 5,
+    1, 3, 15, 13, 4, 2, 7, 2, 1, 4, 4, 1, 2, 10, 2, 1,
+    3, 4, 1, 5, 3, 4, 3, 2, 3, 1, 5, 7, 3, 2, 3, 3,
+    12, 5, 3, 5, 1, 2, 2, 2, 2, 1, 2, 9, 2, 3, 9, 11,
+    8, 6, 22, 1, 4, 11, 12, 6, 1, 11, 10, 2, 15, 1, 10, 2,
+    7, 2, 3, 4, 1, 6, 1, 1, 7, 1, 1, 1, 5, 3, 23, 6,
+    8, 4, 3, 1, 1, 3, 2, 5, 1, 9, 10, 2, 1, 1, 2, 5,
+    2, 11, 4, 6, 1, 1, 2, 4, 1, 8, 9, 1, 3, 7, 5, 1,
+    1, 4, 5, 3, 8, 2, 15, 5, 2, 1, 8, 24, 1, 2, 7, 5,
+    9, 2, 2, 4, 3, 7, 2, 10, 3, 3, 2, 1, 7, 7, 1, 1,
+    7, 2, 1, 9, 4, 4, 1, 1, 1, 3, 3, 3, 4, 1, 7, 3,
+    5, 5, 1, 5, 18, 1, 6, 1, 1, 2, 15, 1, 5, 8, 2, 2,
+    1, 3, 6, 9, 8, 1, 10, 2, 14, 6, 2, 12, 1, 9, 2, 1,
+    2, 1, 2, 1, 2, 4, 3, 13, 6, 3, 9, 2, 2, 1, 2, 4,
+    8, 1, 4, 3, 4, 1, 3, 2, 2, 2, 10, 1, 2, 1, 8, 3,
+    1, 1, 4, 9, 3, 7, 2, 2, 1, 3, 1, 3, 1, 6, 6, 1,
+    2, 8, 3, 2, 3, 8, 2, 14, 8, 13, 7, 1, 3, 5, 1, 2,
+    7, 1, 6, 3, 4, 1, 6, 6, 4, 2, 3, 1, 3, 2, 1, 2,
+    1, 1, 2, 8, 2, 1, 4, 5, 2, 2, 1, 6, 5, 11, 1, 1,
+    3, 3, 3, 2, 2, 2, 1, 2, 5, 1, 5, 1, 2, 5, 13, 5,
+    1, 6, 5, 1, 5, 1, 2, 5, 10, 6, 4, 2, 1, 8, 1, 6,
+    4, 5, 2, 2, 11, 1, 2, 1, 6, 1, 5, 2, 16, 6, 2, 4,
+    3, 4, 1, 2, 1, 1, 1, 2, 1, 1, 1, 1, 3, 1, 2, 1,
+    2, 1, 1, 1, 1, 2, 1, 1, 3, 1, 1, 1, 1, 1, 3, 1,
+    1, 2, 5, 1, 3, 1, 3, 1, 2, 5, 3, 1, 4, 2, 1, 7,
+    1, 1, 3, 2, 7, 2, 1, 2, 1, 1, 1, 3, 6, 3, 5, 2,
+    4, 1, 2, 1, 2, 4, 1, 3, 2, 6, 11, 1, 1, 5, 2, 3,
+    2, 4, 1, 1, 3, 2, 3, 3, 3, 1, 1, 1, 10, 1, 4, 3,
+    6, 3, 2, 4, 1, 1, 6, 1, 9, 2, 3, 1, 1, 5, 2, 3,
+    1, 1, 2, 3, 2, 5, 3, 4, 4, 1, 3, 3, 5, 9, 1, 1,
+    1, 3, 1, 5, 1, 2, 1, 3, 2, 3, 1, 2, 4, 1, 1, 1,
+    2, 2, 3, 2, 1, 9, 2, 12, 1, 2, 4, 1, 5, 3, 4, 1,
+    9, 1, 2, 2, 6, 2, 3, 2, 4, 3, 6, 3, 2, 2, 1, 2,
+    1, 2, 4, 3, 3, 1, 8, 2, 2, 8, 1, 4, 6, 5, 1, 4,
+    5, 2, 3, 1, 3, 1, 1, 2, 4, 7, 2, 5, 3, 5, 2, 2,
+    8, 1, 1, 3, 2, 8, 1, 2, 2, 3, 5, 3, 3, 1, 1, 1,
+    2, 1, 1, 1, 9, 2, 1, 1, 4, 5, 6, 1, 2, 2, 2, 1,
+    3, 3, 5, 4, 6, 2, 8, 4, 10, 2, 1, 3, 6, 1, 2, 1,
+    9, 6, 10, 7, 4, 3, 2, 8, 1, 2, 3, 2, 2, 5, 4, 5,
+    4, 4, 4, 4, 8, 5, 3, 3, 1, 4, 2, 2, 4, 7, 1, 4,
+    2, 1, 2, 2, 3, 6, 3, 1, 3, 4, 2, 13, 5, 3, 5, 2,
+    2, 2, 1, 1, 1, 1, 1, 1, 2, 6, 6, 3, 3, 2, 2, 1,
+    4, 4, 7, 1, 5, 9, 1, 1, 1, 1, 1, 2, 1, 3, 1, 8,
+    5, 2, 1, 2, 2, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 1,
+    1, 2, 3, 2, 1, 1, 1, 1, 1, 1, 2, 1, 9, 1, 2, 4,
+    5, 1, 5, 2, 1, 2, 3, 2, 4, 6, 7, 7, 2, 1, 2, 6,
+    1, 1, 3, 3, 1, 3, 6, 2, 1, 6, 6, 3, 1, 2, 6, 1,
+    3, 3, 1, 5, 1, 5, 5, 4, 11, 1, 1, 2, 4, 1, 3, 1,
+    1, 2, 1, 3, 1, 1, 1, 3, 6, 1, 4, 1, 1, 2, 2, 4,
+    2, 3, 3, 3, 3, 1, 2, 1, 1, 1, 1, 6, 1, 3, 2, 6,
+    2, 1, 3, 2, 1, 3, 2, 2, 1, 1, 1, 2, 1, 6, 3, 1,
+    1, 8, 2, 2, 11, 11, 2, 9, 11, 1, 4, 1, 5, 3, 3, 1,
+    2, 2, 1, 1, 1, 1, 4, 3, 2, 3, 4, 2, 3, 2, 3, 3,
+    5, 3, 1, 1, 3, 7, 1, 3, 3, 1, 1, 1, 1, 4, 2, 12,
+    8, 5, 1, 4, 1, 2, 7, 2, 2, 1, 1, 1, 1, 1, 1, 1,
+    2, 1, 4, 4, 7, 1, 1, 1, 2, 4, 8, 1, 2, 1, 1, 2,
+    1, 7, 2, 1, 2, 8, 1, 1, 1, 1, 8, 8, 8, 2, 1, 2,
+    3, 1, 1, 1, 5, 8, 2, 11, 2, 2, 3, 9, 1, 7, 2, 3,
+    3, 2, 3, 2, 2, 1, 1, 6, 2, 1, 2, 4, 2, 7, 1, 2,
+    3, 1, 1, 2, 3, 1, 3, 1, 1, 7, 3, 1, 7, 1, 1, 3,
+    3, 1, 10, 5, 1, 6, 8, 8, 1, 5, 5, 1, 1, 2, 2, 2,
+    3, 3, 6, 1, 5, 1, 2, 4, 2, 5, 6, 4, 1, 4, 1, 5,
+    8, 1, 1, 4, 7, 1, 1, 5, 1, 6, 3, 6, 1, 3, 6, 2,
+    3, 2, 6, 11, 4, 3, 7, 8, 7, 3, 3, 6, 1, 3, 3, 5,
+    7, 4, 1, 4, 10, 3, 1, 10, 1, 1, 1, 3, 2, 5, 3, 2,
+    1, 3, 1, 3, 3, 2, 1, 4, 11, 2, 5, 8, 1, 9, 1, 4,
+    4, 4, 1, 4, 3, 3, 3, 2, 1, 9, 10, 3, 8, 3, 1, 11,
+    5, 1, 2, 16, 2, 9, 12, 3, 3, 1, 13, 1, 1, 1, 7, 1,
+    4, 9, 5, 9, 3, 2, 2, 2, 5, 16, 3, 6, 2, 1, 13, 5,
+    2, 5, 1, 1, 2, 3, 3, 3, 2, 2, 8, 2, 3, 3, 1, 7,
+    1, 3, 9, 1, 4, 3, 3, 2, 3, 5, 1, 1, 2, 8, 1, 3,
+    1, 1, 4, 1, 3, 10, 9, 4, 3, 2, 5, 2, 3, 1, 6, 5,
+    5, 1, 6, 1, 5, 1, 1, 3, 6, 3, 11, 17, 4, 4, 4, 0,
+    3, 2, 1, 2, 2, 1, 1, 1, 4, 2, 1, 1, 2, 3, 1, 2,
+    1, 1, 1, 2, 2, 1, 1, 1, 2, 2, 5, 1, 1, 1, 2, 2,
+    2, 3, 4, 1, 2, 11, 2, 2, 1, 2, 1, 2, 5, 3, 3, 2,
+    2, 1, 1, 4, 3, 5, 4, 1, 1, 3, 2, 1, 1, 4, 1, 4,
+    1, 1, 1, 4, 6, 1, 3, 8, 1, 8, 5, 3, 4, 1, 1, 4,
+    7, 1, 3, 5, 3, 3, 3, 1, 7, 1, 1, 1, 4, 2, 1, 2,
+    8, 1, 1, 3, 1, 1, 5, 2, 2, 2, 1, 1, 2, 4, 4, 2,
+    8, 1, 1, 1, 4, 1, 3, 2, 2, 6, 1, 2, 7, 8, 1, 1,
+    1, 2, 2, 2, 3, 4, 1, 2, 1, 1, 1, 1, 1, 4, 1, 2,
+    2, 3, 3, 4, 2, 3, 1, 2, 6, 1, 2, 1, 3, 3, 3, 4,
+    2, 7, 1, 1, 2, 8, 1, 1, 1, 3, 7, 1, 1, 2, 3, 4,
+    3, 1, 3, 2, 5, 1, 2, 2, 11, 4, 1, 3, 2, 1, 2, 1,
+    3, 5, 6, 5, 3, 1, 7, 2, 2, 2, 1, 2, 5, 2, 2, 2,
+    3, 5, 2, 4, 2, 2, 1, 4, 2, 1, 3, 2, 1, 1, 3, 1,
+    1, 5, 2, 1, 1, 4, 4, 5, 5, 10, 2, 1, 3, 1, 2, 3,
+    1, 4, 4, 2, 2, 4, 1, 7, 8, 3, 7, 5, 3, 1, 3, 1,
+    1, 1, 2, 2, 1, 4, 4, 2, 1, 3, 1, 1, 6, 1, 6, 3,
+    1, 11, 5, 8, 1, 3, 5, 6, 1, 1, 1, 9, 1, 1, 1, 7,
+    1, 1, 2, 8, 1, 1, 1, 3, 1, 7, 3, 1, 4, 1, 1, 2,
+    6, 2, 1, 7, 8, 6, 2, 1, 4, 2, 3, 3, 2, 2, 2, 1,
+    1, 5, 3, 8, 1, 1, 2, 1, 3, 5, 1, 7, 5, 11, 11, 1,
+    2, 2, 4, 3, 2, 2, 6, 9, 1, 2, 2, 2, 1, 3, 1, 2,
+    3, 2, 1, 5, 1, 6, 2, 2, 4, 9, 3, 6, 1, 2, 3, 7,
+    7, 1, 3, 2, 1, 1, 6, 2, 5, 2, 5, 4, 4, 5, 4, 2,
+    3, 3, 1, 2, 1, 4, 1, 1, 3, 2, 5, 2, 1, 5, 3, 1,
+    6, 3, 2, 5, 4, 1, 3, 4, 4, 3, 1, 1, 3, 7, 3, 1,
+    6, 2, 2, 1, 1, 1, 9, 3, 1, 4, 2, 1, 1, 1, 2, 1,
+    4, 10, 1, 2, 7, 1, 9, 2, 4, 6, 1, 1, 1, 5, 2, 3,
+    2, 4, 1, 1, 4, 2, 1, 4, 1, 1, 2, 3, 3, 4, 2, 4,
+    5, 2, 1, 2, 1, 2, 1, 1, 5, 1, 4, 1, 2, 1, 3, 9,
+    6, 1, 2, 4, 3, 2, 1, 6, 6, 2, 8, 2, 1, 1, 1, 1,
+    1, 4, 4, 1, 4, 2, 1, 2, 1, 2, 1, 6, 1, 3, 2, 1,
+    1, 1, 2, 1, 1, 2, 1, 1, 3, 5, 3, 1, 8, 1, 2, 2,
+    3, 1, 5, 1, 2, 5, 4, 3, 1, 3, 5, 2, 1, 2, 4, 3,
+    2, 1, 3, 2, 2, 4, 1, 7, 4, 1, 1, 10, 2, 1, 1, 3,
+    2, 1, 4, 3, 5, 1, 2, 2, 3, 1, 14, 2, 4, 3, 5, 2,
+    3, 4, 3, 2, 2, 2, 1, 8, 1, 5, 5, 1, 2, 11, 6, 1,
+    1, 8, 1, 10, 5, 2, 5, 6, 1, 12, 2, 10, 4, 7, 1, 1,
+    3, 22, 12, 3, 2, 14, 5, 4, 1, 1, 10, 1, 1, 4, 1, 6,
+    14, 5, 7, 14, 1, 5, 5, 1, 4, 2, 6, 5, 1, 1, 1, 9,
+    2, 3, 2, 6, 1, 1, 1, 3, 4, 7, 1, 5, 3, 2, 3, 1,
+    1, 2, 1, 1, 6, 12, 2, 1, 3, 8, 1, 2, 6, 2, 1, 1,
+    1, 3, 3, 3, 2, 3, 7, 5, 2, 6, 11, 2, 2, 1, 7, 1,
+    9, 7, 7, 1, 6, 5, 2, 15, 2, 2, 1, 16, 4, 1, 14, 1,
+    5, 13, 3, 1, 3, 3, 3, 7, 5, 6, 1, 6, 1, 1, 1, 5,
+    3, 2, 3, 8, 1, 2, 1, 3, 1, 3, 3, 2, 7, 4, 4, 3,
+    7, 2, 1, 4, 9, 9, 1, 3, 2, 2, 1, 2, 2, 2, 2, 1,
+    3, 6, 6, 2, 4, 2, 11, 2, 9, 10, 2, 4, 2, 4, 2, 7,
+    8, 11, 3, 1, 9, 2, 2, 5, 3, 7, 6, 7, 1, 1, 3, 3,
+    2, 2, 7, 2, 1, 2, 8, 2, 3, 15, 4, 3, 3, 3, 9, 3,
+    2, 2, 3, 5, 2, 2, 3, 6, 3, 1, 1, 1, 10, 7, 3, 1,
+    1, 2, 1, 1, 2, 3, 2, 2, 1, 1, 2, 3, 4, 1, 2, 3,
+    3, 1, 2, 5, 1, 2, 2, 1, 6, 3, 1, 4, 1, 1, 3, 8,
+    1, 2, 5, 1, 4, 3, 1, 3, 1, 2, 1, 1, 1, 3, 8, 1,
+    1, 5, 5, 3, 10, 16, 9, 1, 1, 4, 2, 4, 4, 11, 3, 10,
+    5, 1, 2, 6, 2, 5, 3, 13, 5, 1, 6, 3, 3, 1, 1, 2,
+    4, 1, 3, 1, 6, 1, 28, 14, 1, 1, 1, 5, 3, 4, 8, 5,
+    1, 8, 6, 2, 16, 4, 1, 6, 10, 3, 23, 9, 8, 4, 2, 1,
+    2, 4, 1, 1, 7, 12, 1, 11, 4, 1, 16, 7, 1, 2, 1, 1,
+    2, 4, 2, 2, 7, 5, 1, 2, 1, 4, 3, 1, 2, 1, 4, 2,
+    1, 3, 5, 6, 2, 2, 6, 10, 5, 4, 3, 1, 1, 1, 1, 6,
+    6, 2, 7, 5, 2, 3, 7, 5, 3, 2, 6, 3, 9, 3, 7, 9,
+    5, 1, 5, 10, 1, 1, 4, 8, 3, 6, 2, 2, 2, 5, 8, 11,
+    1, 3, 4, 25, 1, 8, 1, 12, 7, 2, 9, 1, 2, 12, 1, 2,
+    7, 1, 14, 1, 5, 1, 14, 4, 14, 7, 2, 2, 1, 2, 10, 6,
+    2, 1, 1, 7, 4, 4, 1, 4, 3, 1, 15, 4, 22, 5, 1, 2,
+    1, 4, 1, 13, 5, 1, 18, 2, 4, 8, 10, 8, 11, 3, 5, 1,
+    5, 1, 3, 1, 12, 4, 4, 9, 3, 7, 3, 2, 3, 2, 11, 1,
+    4, 4, 1, 8, 4, 2, 1, 1, 1, 11, 3, 5, 3, 6, 2, 2,
+    1, 6, 3, 3, 8, 2, 7, 1, 6, 1, 3, 10, 4, 4, 2, 2,
+    8, 2, 6, 8, 7, 4, 4, 10, 2, 6, 4, 11, 1, 1, 2, 27,
+    13, 4, 6, 3, 2, 2, 1, 3, 6, 1, 5, 3, 4, 2, 3, 5,
+    1, 3, 9, 4, 3, 5, 1, 1, 1, 19, 5, 3, 1, 1, 2, 1,
+    1, 4, 8, 1, 1, 2, 12, 3, 4, 5, 9, 3, 1, 2, 1, 5,
+    7, 1, 1, 3, 10, 2, 7, 1, 1, 3, 7, 2, 1, 2, 8, 2,
+    4, 18, 4, 13, 2, 3, 4, 1, 1, 12, 12, 4, 3, 1, 17, 7,
+    2, 4, 1, 20, 1, 1, 7, 1, 8, 3, 2, 3, 9, 3, 2, 5,
+    3, 1, 4, 1, 3, 1, 1, 4, 2, 2, 2, 23, 3, 2, 2, 8,
+    1, 1, 7, 2, 1, 2, 12, 6, 2, 5, 14, 18, 8, 1, 2, 2,
+    5, 16, 12, 4, 15, 13, 21, 3, 7, 1, 6, 12, 3, 11, 6, 5,
+    1, 3, 2, 3, 3, 3, 1, 15, 7, 5, 2, 1, 2, 2, 2, 3,
+    11, 6, 10, 2, 10, 5, 31, 14, 1, 1, 1, 3, 14, 18, 4, 8,
+    7, 1, 9, 28, 7, 22, 4, 2, 6, 5, 1, 1, 3, 1, 2, 10,
+    2, 9, 2, 1, 5, 4, 2, 8, 1, 1, 2, 2, 15, 3, 1, 5,
+    6, 3, 5, 4, 1, 1, 14, 2, 1, 2, 1, 1, 18, 8, 6, 3,
+    2, 1, 2, 7, 3, 1, 6, 2, 1, 12, 14, 5, 1, 26, 9, 1,
+    10, 3, 4, 1, 4, 1, 2, 1, 9, 3, 15, 1, 5, 7, 7, 8,
+    2, 5, 9, 4, 4, 2, 4, 4, 5, 6, 4, 5, 5, 14, 1, 1,
+    1, 2, 1, 1, 6, 2, 2, 5, 2, 4, 2, 1, 1, 2, 1, 1,
+    2, 1, 3, 1, 2, 2, 1, 3, 1, 3, 1, 2, 5, 1, 1, 2,
+    7, 1, 1, 2, 1, 3, 4, 1, 1, 1, 1, 2, 1, 3, 2, 1,
+    1, 1, 1, 2, 2, 3, 2, 10, 1, 1, 1, 4, 1, 4, 2, 1,
+    1, 2, 9, 4, 6, 7, 1, 2, 1, 1, 2, 1, 1, 6, 4, 1,
+    2, 4, 1, 6, 3, 6, 6, 5, 1, 1, 6, 9, 12, 3, 4, 2,
+    3, 7, 1, 1, 4, 1, 5, 2, 13, 3, 4, 1, 2, 2, 1, 2,
+    4, 5, 3, 3, 2, 1, 3, 2, 3, 1, 3, 1, 6, 1, 3, 11,
+    5, 4, 5, 1, 3, 6, 6, 3, 5, 1, 4, 3, 15, 1, 1, 2,
+    9, 4, 2, 2, 2, 3, 1, 11, 6, 1, 6, 2, 10, 13, 5, 1,
+    1, 1, 4, 5, 1, 2, 7, 3, 2, 7, 1, 16, 7, 4, 8, 5,
+    8, 1, 3, 1, 5, 4, 3, 13, 1, 3, 5, 7, 10, 7, 1, 9,
+    7, 14, 2, 5, 10, 7, 3, 1, 21, 2, 16, 15, 6, 4, 8, 13,
+    1, 1, 3, 3, 7, 34, 4, 9, 3, 4, 4, 33, 7, 6, 1, 1,
+    13, 13, 9, 1, 2, 7, 2, 2, 1, 1, 10, 10, 9, 4, 7, 5,
+    3, 1, 2, 3, 2, 3, 1, 1, 1, 3, 4, 1, 1, 4, 6, 7,
+    4, 4, 6, 2, 9, 6, 4, 12, 3, 2, 6, 1, 1, 4, 15, 5,
+    12, 1, 2, 2, 1, 3, 3, 2, 4, 3, 15, 1, 7, 4, 4, 1,
+    3, 13, 10, 5, 16, 5, 1, 15, 1, 6, 1, 1, 2, 2, 5, 6,
+    1, 2, 3, 11, 2, 1, 1, 3, 6, 3, 4, 22, 13, 16, 1, 1,
+    14, 3, 3, 13, 2, 2, 4, 5, 3, 4, 4, 5, 1, 1, 3, 1,
+    11, 1, 2, 3, 20, 1, 1, 3, 6, 1, 2, 2, 1, 1, 2, 3,
+    5, 2, 1, 1, 6, 2, 1, 1, 1, 1, 8, 2, 1, 1, 2, 1,
+    3, 1, 3, 5, 3, 2, 1, 5, 5, 2, 5, 2, 2, 6, 1, 2,
+    1, 4, 8, 10, 3, 12, 1, 3, 7, 3, 2, 1, 3, 2, 2, 5,
+    3, 4, 8, 4, 10, 5, 2, 22, 3, 5, 3, 5, 2, 2, 1, 1,
+    3, 5, 10, 2, 3, 2, 3, 1, 14, 1, 5, 1, 1, 1, 6, 9,
+    3, 3, 2, 3, 5, 2, 1, 3, 1, 1, 1, 3, 3, 4, 1, 2,
+    1, 5, 5, 9, 1, 6, 1, 4, 3, 1, 9, 6, 6, 1, 4, 1,
+    1, 6, 2, 1, 2, 6, 5, 1, 9, 2, 14, 14, 3, 1, 25, 18,
+    20, 1, 1, 4, 9, 4, 3, 1, 13, 2, 2, 10, 4, 36, 31, 4,
+    2, 4, 16, 7, 5, 6, 3, 7, 3, 3, 1, 7, 2, 1, 1, 2,
+    1, 4, 1, 7, 1, 5, 4, 5, 3, 12, 3, 4, 9, 4, 4, 13,
+    4, 3, 4, 1, 1, 10, 4, 3, 2, 2, 2, 2, 6, 10, 4, 8,
+    9, 6, 7, 2, 6, 5, 5, 3, 8, 2, 4, 5, 10, 2, 13, 9,
+    3, 6, 1, 6, 9, 1, 10, 4, 8, 8, 6, 6, 2, 8, 2, 2,
+    0, 2, 2, 1, 5, 1, 2, 4, 7, 2, 4, 2, 1, 8, 2, 4,
+    3, 3, 8, 19, 7, 10, 4, 1, 1, 5, 6, 3, 11, 1, 1, 1,
+    1, 1, 8, 9, 4, 4, 4, 1, 4, 3, 2, 2, 3, 7, 3, 1,
+    3, 3, 1, 2, 3, 1, 2, 6, 6, 5, 2, 2, 4, 1, 3, 4,
+    2, 3, 1, 4, 2, 5, 2, 6, 5, 1, 4, 1, 7, 3, 2, 5,
+    9, 6, 16, 4, 1, 9, 12, 4, 2, 1, 18, 5, 4, 3, 1, 2,
+    3, 3, 8, 6, 3, 8, 4, 1, 4, 2, 7, 6, 7, 1, 1, 3,
+    22, 1, 8, 1, 1, 1, 1, 4, 1, 9, 4, 1, 3, 3, 1, 6,
+    1, 3, 4, 7, 1, 3, 2, 8, 2, 5, 9, 2, 1, 5, 1, 1,
+    1, 11, 5, 6, 2, 2, 12, 3, 3, 5, 5, 7, 4, 9, 1, 1,
+    2, 2, 8, 1, 5, 1, 2, 1, 1, 2, 1, 12, 2, 3, 3, 2,
+    1, 2, 1, 2, 4, 3, 4, 1, 2, 5, 1, 2, 8, 2, 3, 3,
+    2, 1, 7, 3, 4, 5, 1, 3, 7, 1, 1, 9, 4, 8, 2, 9,
+    2, 4, 2, 9, 6, 4, 5, 9, 11, 2, 8, 1, 4, 2, 2, 4,
+    1, 2, 4, 2, 11, 10, 1, 3, 2, 8, 10, 2, 3, 5, 1, 4,
+    4, 3, 4, 10, 5, 12, 4, 13, 3, 1, 3, 7, 2, 2, 1, 3,
+    6, 4, 1, 2, 2, 7, 1, 1, 1, 3, 2, 1, 4, 6, 6, 1,
+    1, 6, 1, 4, 1, 16, 3, 1, 1, 1, 3, 2, 4, 1, 1, 8,
+    8, 1, 1, 4, 6, 3, 1, 10, 4, 1, 9, 1, 4, 5, 13, 6,
+    5, 8, 2, 2, 6, 5, 13, 3, 1, 7, 12, 2, 9, 12, 7, 2,
+    13, 2, 14, 1, 15, 3, 1, 4, 5, 9, 4, 3, 1, 5, 4, 1,
+    1, 1, 22, 1, 4, 5, 9, 4, 5, 13, 10, 4, 3, 7, 9, 5,
+    1, 8, 2, 5, 7, 11, 1, 1, 4, 9, 7, 24, 7, 3, 3, 11,
+    4, 3, 3, 3, 19, 22, 2, 8, 2, 2, 19, 10, 9, 13, 1, 3,
+    8, 8, 6, 4, 2, 7, 3, 1, 7, 1, 5, 3, 24, 2, 11, 6,
+    16, 3, 16, 2, 8, 6, 5, 2, 3, 6, 1, 15, 5, 2, 10, 3,
+    1, 1, 2, 4, 2, 2, 2, 4, 4, 2, 1, 4, 1, 4, 7, 4,
+    1, 2, 1, 4, 1, 1, 2, 5, 3, 4, 3, 1, 2, 1, 9, 2,
+    3, 2, 1, 3, 1, 1, 11, 1, 3, 2, 2, 1, 6, 1, 1, 1,
+    2, 3, 6, 4, 1, 2, 4, 1, 6, 3, 2, 1, 1, 1, 5, 3,
+    5, 3, 2, 1, 5, 8, 2, 1, 1, 2, 2, 7, 11, 10, 1, 2,
+    2, 6, 6, 4, 4, 3, 1, 1, 3, 1, 7, 2, 5, 12, 8, 6,
+    10, 1, 1, 2, 2, 1, 2, 3, 1, 1, 4, 4, 2, 2, 2, 4,
+    2, 2, 4, 8, 7, 2, 1, 2, 1, 1, 1, 1, 2, 1, 3, 1,
+    2, 3, 1, 5, 4, 2, 5, 8, 1, 1, 1, 1, 3, 6, 3, 5,
+    4, 1, 3, 5, 5, 8, 1, 10, 1, 5, 1, 3, 4, 8, 13, 2,
+    3, 1, 1, 4, 3, 7, 1, 2, 6, 2, 5, 4, 1, 9, 2, 1,
+    16, 4, 6, 15, 5, 1, 2, 1, 7, 8, 4, 1, 4, 2, 9, 10,
+    2, 2, 1, 3, 2, 1, 3, 1, 1, 2, 3, 3, 4, 5, 1, 5,
+    1, 3, 5, 2, 17, 6, 13, 18, 3, 3, 1, 15, 1, 10, 13, 5,
+    6, 2, 4, 1, 12, 10, 1, 5, 2, 3, 3, 14, 5, 8, 7, 4,
+    2, 1, 5, 4, 5, 16, 7, 5, 3, 3, 1, 2, 26, 9, 2, 1,
+    4, 1, 2, 4, 15, 6, 11, 9, 3, 3, 1, 2, 9, 2, 4, 9,
+    5, 7, 1, 1, 1, 7, 7, 1, 7, 3, 7, 9, 5, 4, 2, 2,
+    1, 17, 6, 2, 2, 1, 4, 4, 2, 3, 2, 17, 1, 11, 2, 1,
+    5, 10, 2, 2, 3, 4, 7, 5, 5, 8, 3, 2, 1, 13, 9, 3,
+    1, 3, 1, 5, 3, 4, 4, 9, 20, 1, 6, 1, 9, 2, 5, 1,
+    16, 2, 1, 4, 7, 14, 5, 4, 3, 13, 4, 5, 2, 2, 1, 2,
+    2, 1, 3, 9, 1, 2, 2, 3, 3, 3, 1, 2, 5, 10, 6, 1,
+    19, 6, 5, 1, 11, 9, 24, 3, 1, 3, 6, 4, 7, 5, 7, 5,
+    6, 1, 1, 2, 5, 9, 1, 4, 7, 7, 1, 5, 3, 1, 5, 1,
+    19, 4, 5, 6, 4, 3, 6, 5, 1, 2, 1, 3, 3, 7, 5, 1,
+    2, 2, 2, 9, 14, 4, 3, 5, 1, 1, 4, 2, 2, 8, 5, 6,
+    7, 8, 6, 8, 7, 1, 2, 2, 1, 2, 8, 5, 6, 4, 1, 1,
+    2, 1, 3, 2, 2, 2, 1, 1, 4, 4, 1, 1, 3, 2, 1, 1,
+    1, 3, 1, 7, 1, 1, 1, 2, 1, 2, 1, 4, 3, 3, 2, 4,
+    2, 4, 4, 2, 3, 2, 1, 3, 1, 8, 6, 1, 4, 6, 1, 1,
+    2, 1, 5, 3, 3, 5, 6, 5, 8, 7, 2, 1, 4, 1, 5, 4,
+    2, 2, 8, 1, 6, 4, 5, 3, 11, 1, 1, 15, 2, 1, 3, 1,
+    2, 1, 3, 3, 9, 2, 1, 10, 10, 1, 6, 1, 1, 8, 1, 10,
+    14, 3, 3, 1, 4, 3, 2, 7, 4, 4, 3, 5, 3, 6, 1, 1,
+    3, 4, 1, 4, 1, 3, 1, 3, 2, 7, 2, 1, 5, 3, 1, 9,
+    2, 1, 3, 5, 2, 10, 1, 7, 5, 3, 4, 7, 1, 2, 1, 3,
+    9, 4, 3, 1, 1, 2, 2, 4, 4, 10, 3, 3, 4, 1, 16, 9,
+    2, 4, 7, 9, 1, 1, 4, 1, 13, 5, 1, 1, 2, 2, 4, 3,
+    8, 5, 6, 34, 10, 9, 4, 10, 3, 11, 6, 2, 8, 13, 6, 1,
+    6, 2, 1, 2, 2, 1, 1, 7, 1, 2, 7, 1, 1, 3, 3, 2,
+    1, 1, 4, 1, 2, 8, 4, 1, 1, 9, 1, 9, 2, 11, 1, 3,
+    4, 1, 10, 12, 17, 5, 1, 2, 9, 14, 7, 2, 7, 1, 4, 2,
+    1, 8, 6, 9, 1, 6, 17, 1, 15, 3, 9, 1, 3, 2, 3, 1,
+    5, 16, 7, 4, 8, 13, 2, 6, 8, 7, 6, 2, 4, 4, 6, 9,
+    1, 1, 10, 13, 15, 5, 1, 2, 11, 2, 5, 25, 4, 9, 5, 3,
+    5, 4, 2, 27, 4, 4, 7, 6, 12, 6, 1, 1, 1, 1, 8, 2,
+    1, 6, 6, 2, 7, 1, 10, 3, 1, 1, 1, 5, 4, 1, 1, 3,
+    5, 11, 2, 3, 4, 1, 4, 4, 4, 5, 11, 3, 8, 1, 14, 4,
+    1, 3, 11, 15, 5, 2, 4, 3, 1, 1, 1, 4, 1, 1, 3, 3,
+    1, 1, 4, 3, 8, 7, 3, 2, 4, 13, 2, 12, 5, 19, 1, 4,
+    4, 3, 5, 6, 6, 1, 3, 3, 3, 14, 4, 1, 1, 5, 4, 2,
+    2, 1, 2, 4, 14, 2, 1, 1, 8, 5, 4, 5, 4, 4, 6, 3,
+    4, 3, 3, 1, 1, 2, 7, 1, 1, 1, 2, 2, 3, 4, 2, 1,
+    2, 6, 4, 6, 5, 10, 11, 15, 11, 5, 11, 9, 2, 3, 5, 17,
+    3, 3, 13, 9, 6, 13, 6, 9, 3, 1, 3, 2, 21, 1, 2, 14,
+    2, 2, 15, 8, 3, 3, 5, 7, 18, 1, 5, 4, 1, 9, 10, 7,
+    4, 7, 3, 9, 8, 10, 4, 2, 10, 1, 2, 1, 7, 16, 5, 1,
+    1, 4, 2, 4, 13, 2, 5, 4, 1, 17, 3, 1, 2, 6, 9, 28,
+    5, 1, 1, 3, 6, 6, 6, 5, 1, 1, 5, 9, 5, 10, 5, 8,
+    2, 2, 4, 3, 17, 3, 9, 4, 5, 6, 6, 1, 7, 4, 6, 1,
+    1, 3, 1, 3, 6, 11, 7, 2, 2, 1, 7, 8, 1, 10, 5, 2,
+    183, 72, 204, 255, 45, 48, 255, 56, 66, 34, 255, 65, 119, 74, 38, 112,
+    44, 12, 32, 7, 24, 43, 8, 50, 6, 118, 8, 26, 3, 27, 45, 1,
+    27, 17, 3, 43, 32, 36, 20, 31, 27, 51, 80, 19, 25, 8, 17, 10,
+    18, 15, 7, 14, 5, 10, 2, 5, 7, 18, 13, 1, 37, 30, 29, 9,
+    39, 26, 0, 2, 1, 2, 6, 9, 10, 10, 9, 3, 9, 3, 2, 1,
+    1, 5, 1, 3, 4, 5, 2, 2, 10, 3, 1, 12, 11, 4, 8, 2,
+    9, 7, 1, 4, 1, 5, 9, 1, 11, 3, 2, 3, 3, 2, 11, 4,
+    17, 13, 2, 1, 3, 2, 3, 2, 4, 5, 9, 1, 3, 1, 3, 3,
+    8, 3, 2, 10, 4, 3, 3, 2, 1, 2, 9, 6, 8, 2, 1, 2,
+    2, 2, 5, 6, 5, 2, 6, 3, 6, 13, 2, 6, 4, 21, 1, 2,
+    2, 12, 1, 2, 1, 6, 10, 10, 22, 1, 9, 1, 2, 5, 5, 4,
+    1, 2, 3, 6, 8, 6, 9, 2, 4, 3, 6, 17, 1, 2, 13, 7,
+    2, 7, 4, 2, 6, 3, 3, 3, 6, 1, 3, 1, 4, 5, 3, 1,
+    1, 8, 3, 7, 6, 3, 3, 7, 6, 9, 8, 4, 2, 2, 1, 4,
+    2, 2, 3, 1, 8, 6, 2, 2, 4, 9, 7, 2, 7, 1, 5, 2,
+    1, 1, 6, 1, 3, 5, 13, 1, 7, 4, 9, 3, 2, 4, 2, 1,
+    3, 4, 5, 3, 1, 1, 1, 2, 1, 8, 2, 4, 1, 3, 3, 1,
+    1, 8, 6, 5, 3, 1, 1, 3, 1, 3, 1, 1, 4, 17, 2, 3,
+    1, 12, 3, 1, 5, 2, 5, 3, 2, 2, 1, 5, 19, 3, 15, 2,
+    3, 1, 10, 5, 3, 1, 1, 6, 6, 6, 2, 5, 2, 3, 6, 1,
+    17, 1, 1, 1, 1, 3, 2, 12, 1, 1, 2, 9, 2, 8, 5, 1,
+    1, 9, 3, 2, 4, 6, 1, 5, 1, 2, 2, 1, 7, 3, 2, 1,
+    1, 4, 4, 3, 1, 1, 1, 6, 7, 1, 3, 1, 5, 2, 3, 8,
+    6, 1, 3, 4, 6, 6, 3, 5, 5, 3, 3, 2, 4, 5, 13, 2,
+    8, 20, 3, 3, 4, 3, 2, 9, 20, 6, 4, 1, 2, 7, 8, 9,
+    2, 1, 7, 12, 4, 7, 5, 4, 7, 5, 2, 3, 3, 1, 1, 1,
+    2, 3, 6, 1, 5, 4, 18, 1, 1, 4, 4, 14, 0, 5, 2, 6,
+    1, 3, 1, 6, 1, 1, 2, 1, 1, 1, 1, 6, 1, 4, 1, 6,
+    2, 1, 1, 9, 1, 4, 1, 3, 2, 1, 2, 9, 1, 2, 2, 5,
+    5, 3, 1, 1, 2, 2, 3, 1, 3, 1, 5, 1, 3, 1, 14, 2,
+    3, 4, 4, 5, 3, 1, 1, 6, 4, 1, 1, 6, 6, 2, 1, 2,
+    5, 2, 3, 1, 8, 2, 1, 2, 3, 1, 2, 4, 2, 2, 3, 1,
+    2, 2, 5, 2, 5, 4, 2, 3, 3, 1, 2, 3, 2, 7, 7, 3,
+    3, 1, 1, 2, 3, 1, 6, 3, 2, 1, 5, 1, 6, 4, 5, 1,
+    5, 8, 7, 1, 15, 4, 1, 4, 7, 2, 3, 1, 10, 5, 1, 6,
+    1, 1, 2, 5, 7, 13, 1, 8, 1, 2, 1, 8, 1, 9, 2, 4,
+    5, 3, 6, 3, 5, 9, 2, 4, 1, 1, 1, 3, 1, 2, 3, 6,
+    4, 4, 3, 4, 2, 2, 7, 5, 1, 6, 7, 10, 2, 1, 1, 3,
+    1, 1, 1, 2, 1, 3, 2, 1, 2, 2, 7, 5, 4, 2, 1, 1,
+    2, 2, 3, 5, 3, 1, 7, 7, 20, 7, 5, 2, 7, 2, 2, 1,
+    6, 5, 15, 1, 1, 4, 1, 4, 3, 4, 3, 1, 1, 3, 1, 6,
+    2, 1, 3, 2, 3, 10, 3, 3, 8, 1, 2, 4, 6, 1, 9, 8,
+    4, 3, 3, 2, 11, 6, 8, 7, 10, 4, 4, 2, 6, 2, 4, 7,
+    2, 6, 4, 1, 4, 5, 2, 1, 3, 7, 3, 2, 2, 3, 4, 1,
+    9, 3, 2, 4, 1, 3, 6, 9, 2, 2, 2, 11, 2, 8, 10, 1,
+    8, 7, 11, 3, 9, 4, 6, 3, 8, 2, 6, 8, 5, 3, 1, 1,
+    2, 7, 1, 9, 2, 1, 5, 3, 6, 1, 6, 3, 23, 3, 8, 4,
+    7, 10, 4, 1, 1, 3, 17, 4, 7, 5, 3, 2, 4, 11, 14, 9,
+    1, 6, 6, 9, 1, 7, 3, 10, 16, 2, 4, 2, 14, 8, 4, 4,
+    1, 3, 3, 3, 2, 4, 4, 1, 32, 8, 2, 2, 1, 3, 3, 2,
+    1, 8, 7, 5, 1, 7, 4, 3, 5, 2, 4, 4, 2, 8, 3, 2,
+    7, 3, 1, 12, 1, 2, 3, 2, 6, 7, 2, 2, 1, 16, 2, 4,
+    9, 1, 26, 2, 1, 3, 1, 1, 6, 5, 7, 3, 4, 5, 2, 5,
+    14, 5, 2, 13, 2, 8, 2, 2, 4, 12, 2, 2, 5, 11, 2, 6,
+    6, 12, 4, 3, 3, 8, 4, 1, 3, 8, 1, 2, 13, 2, 6, 10,
+    3, 15, 2, 3, 2, 2, 3, 6, 2, 3, 3, 3, 1, 4, 1, 8,
+    5, 1, 5, 6, 1, 5, 8, 1, 4, 1, 2, 3, 3, 1, 1, 4,
+    2, 2, 5, 5, 2, 7, 2, 1, 2, 2, 6, 4, 2, 10, 1, 2,
+    3, 8, 1, 4, 3, 3, 3, 1, 1, 1, 4, 1, 5, 1, 1, 3,
+    1, 1, 2, 1, 1, 2, 1, 1, 1, 2, 1, 1, 1, 2, 4, 5,
+    1, 10, 2, 2, 10, 1, 3, 14, 1, 1, 5, 5, 6, 2, 1, 7,
+    5, 4, 2, 1, 1, 2, 3, 8, 8, 2, 1, 1, 3, 10, 3, 12,
+    8, 1, 1, 4, 2, 3, 4, 2, 5, 7, 7, 2, 3, 2, 4, 5,
+    9, 1, 6, 2, 4, 2, 2, 1, 1, 8, 4, 1, 5, 2, 1, 7,
+    4, 11, 3, 4, 3, 2, 7, 7, 2, 17, 17, 1, 2, 1, 1, 2,
+    2, 4, 3, 10, 2, 8, 2, 19, 6, 1, 3, 11, 16, 3, 9, 1,
+    2, 3, 1, 5, 7, 1, 9, 8, 3, 5, 11, 2, 6, 3, 21, 2,
+    2, 4, 2, 1, 3, 7, 9, 1, 1, 4, 1, 3, 1, 1, 9, 1,
+    1, 4, 6, 2, 4, 3, 1, 4, 3, 3, 2, 10, 12, 3, 1, 2,
+    9, 1, 7, 4, 4, 3, 1, 1, 1, 3, 22, 6, 2, 1, 2, 3,
+    7, 4, 1, 1, 6, 12, 8, 6, 3, 3, 2, 2, 7, 4, 2, 9,
+    1, 5, 1, 1, 5, 3, 1, 1, 1, 7, 3, 1, 3, 3, 19, 1,
+    2, 12, 10, 3, 1, 5, 2, 1, 2, 2, 7, 8, 7, 9, 6, 2,
+    3, 5, 3, 1, 17, 14, 5, 4, 10, 4, 6, 7, 5, 9, 1, 2,
+    4, 12, 3, 8, 8, 1, 1, 3, 6, 1, 4, 4, 2, 103, 31, 74,
+    204, 77, 22, 6, 255, 227, 18, 23, 21, 26, 9, 23, 44, 14, 2, 69,
+    190, 116, 40, 8, 1, 2, 2, 1, 3, 1, 3, 4, 2, 4, 5, 3,
+    4, 1, 1, 2, 2, 4, 2, 1, 2, 1, 1, 6, 2, 1, 2, 4,
+    10, 4, 7, 12, 5, 4, 2, 17, 8, 2, 2, 6, 13, 3, 7, 3,
+    1, 6, 4, 3, 6, 1, 2, 1, 1, 3, 4, 2, 1, 2, 1, 1,
+    3, 14, 2, 10, 5, 1, 1, 3, 3, 3, 1, 7, 4, 1, 4, 1,
+    1, 3, 3, 1, 3, 1, 15, 2, 1, 1, 1, 8, 6, 19, 7, 6,
+    4, 6, 1, 2, 2, 1, 2, 4, 5, 3, 7, 1, 3, 1, 3, 5,
+    5, 1, 2, 3, 2, 6, 8, 4, 1, 4, 10, 3, 1, 6, 3, 4,
+    7, 5, 2, 6, 1, 10, 7, 3, 1, 1, 1, 6, 1, 1, 1, 7,
+    3, 2, 4, 2, 4, 2, 1, 7, 2, 4, 4, 5, 8, 2, 1, 1,
+    1, 2, 2, 12, 3, 1, 2, 3, 1, 1, 1, 2, 2, 2, 4, 2,
+    3, 3, 2, 2, 8, 1, 1, 2, 5, 1, 7, 7, 8, 14, 16, 11,
+    1, 7, 3, 2, 1, 7, 16, 1, 3, 12, 12, 7, 2, 4, 1, 2,
+    6, 1, 4, 16, 2, 13, 1, 2, 12, 13, 5, 1, 4, 6, 1, 3,
+    1, 13, 8, 7, 2, 3, 3, 1, 14, 5, 7, 4, 3, 1, 21, 4,
+    1, 1, 4, 1, 11, 1, 4, 5, 3, 2, 2, 1, 5, 2, 7, 16,
+    3, 2, 6, 11, 3, 1, 1, 3, 2, 4, 1, 13, 3, 4, 1, 5,
+    6, 1, 1, 1, 4, 3, 1, 5, 5, 1, 1, 2, 3, 9, 3, 10,
+    3, 27, 1, 3, 1, 2, 4, 1, 16, 18, 19, 8, 3, 3, 3, 1,
+    15, 3, 17, 6, 1, 2, 8, 8, 7, 5, 1, 6, 5, 4, 2, 10,
+    1, 1, 3, 6, 5, 2, 2, 11, 4, 7, 2, 7, 5, 1, 3, 3,
+    1, 3, 11, 1, 7, 16, 2, 2, 6, 2, 2, 4, 4, 2, 1, 16,
+    3, 15, 17, 1, 7, 12, 4, 11, 3, 0, 7, 11, 7, 2, 25, 14,
+    3, 3, 8, 8, 6, 3, 30, 13, 10, 1, 11, 20, 9, 3, 9, 34,
+    9, 7, 2, 3, 8, 6, 5, 1, 1, 1, 2, 7, 1, 9, 2, 3,
+    6, 6, 6, 2, 1, 2, 4, 3, 2, 3, 5, 4, 2, 5, 4, 8,
+    2, 6, 4, 5, 2, 3, 7, 2, 3, 13, 2, 1, 1, 4, 3, 3,
+    1, 2, 8, 4, 11, 5, 2, 8, 6, 1, 4, 4, 9, 1, 2, 6,
+    9, 6, 9, 6, 14, 2, 7, 5, 1, 5, 3, 4, 1, 2, 5, 6,
+    1, 6, 2, 3, 3, 5, 1, 9, 2, 1, 4, 1, 5, 3, 2, 2,
+    9, 5, 5, 1, 4, 2, 1, 2, 2, 4, 1, 1, 1, 1, 1, 2,
+    5, 6, 1, 2, 2, 2, 2, 4, 1, 7, 1, 1, 2, 3, 3, 5,
+    5, 7, 8, 9, 6, 7, 8, 3, 12, 10, 4, 3, 14, 5, 5, 2,
+    13, 2, 1, 6, 1, 3, 8, 6, 2, 9, 4, 3, 6, 5, 1, 3,
+    2, 1, 2, 5, 1, 2, 2, 2, 9, 3, 4, 2, 2, 11, 1, 1,
+    6, 1, 21, 1, 4, 1, 1, 1, 6, 5, 2, 11, 2, 5, 23, 2,
+    1, 1, 4, 3, 3, 4, 2, 1, 2, 7, 1, 5, 4, 1, 18, 5,
+    5, 3, 5, 23, 7, 14, 14, 5, 2, 2, 1, 5, 10, 4, 1, 2,
+    1, 1, 9, 9, 4, 1, 3, 11, 17, 1, 3, 2, 2, 1, 3, 2,
+    1, 3, 1, 2, 5, 5, 2, 4, 1, 2, 1, 2, 1, 1, 1, 1,
+    1, 1, 2, 3, 1, 7, 5, 13, 5, 16, 6, 3, 17, 19, 8, 1,
+    4, 3, 8, 5, 7, 2, 12, 2, 12, 3, 1, 6, 9, 9, 13, 8,
+    18, 6, 10, 10, 1, 2, 5, 3, 11, 4, 4, 1, 7, 2, 3, 7,
+    7, 1, 12, 9, 3, 4, 2, 1, 3, 9, 13, 2, 1, 5, 5, 2,
+    5, 6, 3, 2, 4, 2, 7, 1, 3, 8, 13, 4, 1, 2, 6, 2,
+    4, 1, 3, 9, 2, 1, 3, 2, 3, 3, 1, 1, 9, 1, 1, 2,
+    2, 1, 1, 8, 6, 1, 3, 1, 4, 3, 2, 3, 2, 3, 6, 16,
+    2, 7, 4, 6, 12, 2, 3, 1, 5, 3, 9, 2, 8, 6, 1, 2,
+    8, 3, 4, 4, 2, 1, 1, 7, 3, 1, 11, 4, 14, 1, 4, 1,
+    3, 2, 1, 5, 6, 3, 4, 3, 2, 2, 3, 3, 1, 9, 4, 2,
+    6, 1, 4, 7, 5, 3, 6, 2, 5, 6, 2, 7, 1, 3, 3, 10,
+    1, 3, 37, 1, 1, 1, 3, 10, 4, 11, 2, 12, 2, 1, 3, 4,
+    2, 4, 1, 1, 10, 1, 1, 1, 11, 1, 1, 3, 6, 5, 12, 2,
+    2, 7, 3, 1, 3, 2, 1, 2, 1, 2, 1, 1, 2, 3, 3, 2,
+    1, 1, 1, 2, 1, 5, 8, 1, 1, 5, 1, 1, 3, 4, 2, 4,
+    3, 9, 2, 1, 1, 3, 4, 1, 1, 1, 1, 1, 2, 7, 3, 1,
+    1, 2, 1, 4, 3, 1, 2, 12, 1, 5, 1, 1, 3, 2, 2, 1,
+    1, 3, 1, 1, 2, 5, 3, 5, 2, 7, 1, 3, 1, 2, 6, 5,
+    2, 5, 6, 2, 2, 6, 1, 4, 1, 9, 1, 1, 2, 1, 1, 3,
+    5, 1, 3, 3, 1, 1, 3, 8, 6, 3, 3, 17, 2, 2, 1, 3,
+    2, 1, 3, 2, 8, 4, 1, 3, 2, 1, 1, 8, 2, 2, 2, 14,
+    4, 2, 4, 3, 5, 1, 1, 1, 3, 8, 5, 6, 2, 4, 1, 3,
+    11, 3, 4, 3, 3, 15, 1, 3, 4, 1, 9, 1, 1, 1, 1, 2,
+    2, 7, 5, 1, 1, 5, 1, 1, 2, 4, 3, 5, 2, 1, 2, 5,
+    2, 2, 1, 1, 1, 5, 1, 1, 1, 1, 3, 10, 1, 1, 1, 1,
+    1, 3, 2, 3, 6, 3, 1, 2, 4, 3, 3, 1, 2, 7, 8, 2,
+    2, 6, 4, 1, 2, 1, 3, 3, 16, 5, 3, 1, 5, 4, 6, 3,
+    10, 2, 7, 7, 4, 2, 4, 1, 2, 10, 7, 1, 4, 5, 2, 1,
+    2, 1, 1, 4, 4, 1, 6, 12, 4, 1, 2, 1, 1, 6, 1, 1,
+    8, 1, 2, 3, 7, 4, 2, 2, 6, 3, 10, 3, 2, 9, 14, 2,
+    13, 1, 2, 2, 6, 3, 1, 3, 3, 3, 1, 3, 4, 2, 2, 3,
+    1, 4, 1, 1, 3, 1, 1, 3, 5, 3, 1, 4, 1, 11, 7, 3,
+    8, 12, 8, 2, 2, 3, 1, 3, 6, 3, 3, 3, 10, 8, 1, 8,
+    7, 1, 5, 1, 4, 13, 3, 7, 13, 13, 4, 3, 2, 4, 4, 1,
+    3, 1, 9, 3, 2, 6, 1, 3, 7, 6, 14, 2, 6, 2, 3, 2,
+    4, 4, 2, 2, 9, 4, 1, 2, 1, 3, 1, 1, 1, 5, 1, 5,
+    2, 1, 2, 1, 1, 1, 6, 1, 1, 3, 4, 14, 2, 3, 1, 1,
+    3, 1, 3, 1, 7, 6, 2, 4, 2, 6, 3, 1, 2, 1, 3, 2,
+    9, 3, 9, 2, 1, 1, 7, 8, 3, 1, 1, 1, 2, 2, 3, 1,
+    3, 4, 1, 8, 5, 3, 5, 1, 5, 5, 15, 1, 4, 1, 9, 4,
+    5, 6, 6, 2, 1, 9, 2, 4, 3, 6, 2, 2, 3, 2, 4, 1,
+    2, 1, 2, 1, 5, 1, 2, 1, 2, 1, 4, 2, 1, 1, 1, 2,
+    1, 1, 2, 1, 6, 1, 2, 4, 1, 6, 1, 2, 2, 6, 1, 9,
+    3, 3, 4, 1, 1, 2, 2, 3, 1, 2, 2, 7, 5, 2, 1, 9,
+    3, 1, 5, 5, 2, 6, 2, 1, 3, 6, 1, 1, 3, 3, 2, 4,
+    3, 4, 2, 1, 1, 6, 2, 3, 7, 1, 1, 1, 5, 1, 3, 5,
+    10, 4, 8, 1, 5, 6, 10, 1, 1, 3, 1, 8, 7, 8, 7, 9,
+    2, 2, 14, 2, 9, 1, 3, 1, 1, 1, 5, 2, 2, 6, 3, 1,
+    2, 4, 1, 1, 1, 3, 1, 2, 1, 2, 3, 5, 4, 2, 10, 4,
+    2, 5, 1, 1, 10, 1, 4, 3, 2, 5, 4, 2, 2, 2, 4, 3,
+    4, 4, 2, 5, 3, 5, 1, 4, 7, 1, 2, 9, 2, 6, 10, 9,
+    5, 4, 1, 28, 1, 8, 1, 4, 3, 8, 6, 1, 6, 1, 13, 1,
+    1, 6, 1, 1, 3, 1, 4, 4, 6, 4, 11, 7, 48, 4, 4, 6,
+    4, 2, 11, 4, 3, 2, 2, 11, 10, 5, 1, 5, 8, 17, 5, 6,
+    3, 8, 11, 3, 9, 2, 2, 1, 17, 5, 6, 3, 12, 5, 14, 12,
+    3, 14, 2, 6, 2, 1, 1, 4, 2, 1, 1, 5, 4, 20, 2, 2,
+    11, 3, 7, 1, 4, 5, 3, 5, 3, 5, 3, 6, 1, 2, 1, 3,
+    9, 11, 1, 10, 2, 8, 1, 3, 2, 6, 5, 2, 1, 3, 1, 10,
+    7, 8, 1, 3, 14, 8, 1, 1, 5, 5, 2, 12, 7, 1, 4, 5,
+    1, 2, 2, 1, 3, 4, 8, 1, 4, 1, 1, 2, 3, 9, 3, 3,
+    13, 16, 1, 10, 14, 21, 4, 1, 1, 5, 5, 5, 12, 5, 6, 8,
+    8, 1, 1, 1, 1, 6, 1, 4, 1, 1, 18, 1, 3, 2, 4, 8,
+    1, 6, 19, 1, 8, 3, 2, 3, 1, 4, 5, 7, 5, 3, 7, 1,
+    1, 3, 3, 3, 1, 5, 2, 5, 1, 14, 17, 15, 2, 1, 1, 6,
+    7, 2, 1, 4, 1, 1, 3, 4, 5, 3, 1, 7, 1, 1, 6, 3,
+    5, 4, 3, 5, 11, 8, 3, 6, 26, 1, 10, 14, 5, 9, 4, 7,
+    1, 2, 2, 1, 11, 1, 1, 6, 2, 1, 9, 7, 2, 3, 2, 4,
+    2, 8, 1, 1, 3, 1, 6, 5, 2, 9, 5, 1, 2, 2, 2, 8,
+    1, 5, 4, 1, 1, 1, 1, 2, 4, 2, 1, 3, 1, 4, 3, 8,
+    2, 3, 1, 1, 1, 1, 1, 2, 5, 2, 3, 1, 5, 1, 2, 2,
+    2, 1, 2, 3, 2, 1, 3, 1, 1, 1, 3, 12, 2, 2, 1, 1,
+    1, 2, 4, 3, 1, 3, 2, 2, 6, 2, 5, 4, 4, 3, 6, 1,
+    1, 5, 5, 3, 6, 3, 10, 3, 5, 23, 1, 5, 1, 2, 1, 3,
+    1, 8, 1, 4, 12, 4, 3, 4, 17, 15, 6, 5, 1, 11, 5, 9,
+    6, 3, 3, 11, 5, 25, 2, 5, 2, 4, 2, 14, 6, 1, 2, 7,
+    5, 3, 1, 2, 7, 4, 9, 12, 11, 5, 10, 3, 4, 6, 3, 10,
+    3, 2, 3, 1, 3, 2, 3, 7, 2, 2, 4, 2, 8, 2, 6, 1,
+    1, 7, 1, 9, 12, 1, 2, 12, 2, 3, 9, 2, 8, 2, 3, 1,
+    2, 1, 5, 1, 2, 6, 2, 1, 3, 2, 4, 2, 2, 1, 1, 4,
+    1, 7, 19, 5, 4, 2, 2, 1, 4, 2, 1, 11, 5, 3, 4, 4,
+    11, 6, 3, 11, 2, 7, 7, 4, 8, 2, 7, 2, 10, 1, 4, 3,
+    4, 5, 8, 2, 8, 5, 1, 17, 8, 5, 1, 1, 2, 1, 4, 7,
+    2, 1, 10, 3, 19, 4, 2, 3, 12, 3, 6, 7, 3, 3, 3, 5,
+    9, 9, 1, 4, 3, 9, 4, 6, 4, 2, 2, 3, 1, 2, 3, 1,
+    2, 1, 1, 1, 7, 1, 3, 3, 6, 1, 1, 7, 4, 6, 2, 1,
+    1, 1, 5, 3, 6, 1, 5, 5, 1, 8, 1, 13, 3, 1, 1, 10,
+    13, 3, 14, 11, 1, 8, 11, 2, 2, 3, 9, 3, 2, 1, 1, 6,
+    1, 2, 3, 3, 1, 1, 1, 1, 3, 1, 2, 1, 7, 1, 1, 3,
+    8, 1, 1, 1, 1, 3, 3, 1, 4, 1, 1, 1, 1, 4, 2, 4,
+    3, 3, 14, 4, 2, 3, 2, 8, 9, 1, 6, 1, 2, 3, 2, 5,
+    3, 5, 6, 12, 5, 7, 2, 3, 4, 27, 7, 1, 7, 10, 2, 5,
+    2, 10, 4, 5, 2, 4, 3, 9, 1, 3, 2, 3, 2, 7, 5, 1,
+    2, 6, 5, 3, 2, 2, 5, 1, 1, 2, 6, 1, 6, 1, 2, 1,
+    1, 1, 1, 3, 1, 5, 2, 1, 1, 1, 7, 2, 2, 5, 1, 7,
+    1, 1, 3, 2, 12, 2, 3, 1, 1, 2, 4, 2, 14, 1, 1, 1,
+    6, 8, 8, 8, 4, 2, 2, 7, 3, 2, 1, 1, 9, 1, 5, 6,
+    4, 4, 5, 20, 4, 7, 1, 3, 3, 4, 3, 1, 1, 1, 2, 1,
+    2, 9, 1, 1, 4, 1, 2, 2, 2, 2, 4, 2, 4, 3, 2, 1,
+    14, 8, 7, 2, 1, 2, 2, 1, 12, 5, 6, 1, 4, 13, 2, 2,
+    1, 2, 3, 11, 8, 2, 2, 5, 4, 9, 8, 6, 14, 2, 6, 7,
+    2, 9, 3, 4, 5, 1, 2, 6, 4, 6, 4, 2, 3, 4, 9, 1,
+    13, 6, 10, 6, 5, 3, 8, 1, 4, 9, 6, 2, 10, 1, 14, 9,
+    5, 16, 8, 6, 4, 7, 2, 6, 1, 6, 1, 1, 4, 18, 7, 4,
+    5, 16, 16, 3, 8, 16, 6, 3, 8, 7, 1, 9, 8, 4, 1, 12,
+    4, 8, 1, 1, 2, 3, 2, 14, 1, 4, 6, 1, 5, 1, 6, 2,
+    2, 2, 2, 4, 4, 2, 3, 3, 3, 16, 7, 5, 1, 1, 1, 10,
+    3, 6, 3, 3, 14, 7, 3, 1, 9, 4, 17, 16, 5, 2, 2, 14,
+    3, 5, 5, 9, 3, 2, 1, 2, 3, 4, 10, 4, 6, 8, 19, 5,
+    4, 2, 2, 1, 1, 5, 1, 2, 4, 2, 1, 5, 2, 2, 1, 11,
+    1, 5, 3, 3, 1, 6, 2, 1, 1, 1, 2, 1, 5, 2, 3, 3,
+    7, 1, 1, 1, 2, 1, 1, 4, 4, 1, 3, 5, 2, 1, 1, 7,
+    3, 6, 1, 9, 1, 2, 3, 2, 1, 4, 2, 3, 2, 1, 1, 14,
+    18, 3, 7, 5, 7, 7, 2, 3, 4, 5, 5, 5, 3, 4, 7, 2,
+    2, 3, 3, 4, 14, 2, 10, 3, 3, 1, 2, 1, 2, 5, 1, 3,
+    5, 5, 3, 10, 4, 6, 2, 14, 1, 5, 2, 1, 3, 3, 1, 1,
+    3, 5, 4, 5, 2, 1, 1, 10, 2, 1, 8, 4, 2, 2, 9, 13,
+    2, 3, 7, 4, 3, 1, 2, 1, 11, 8, 10, 12, 10, 11, 12, 5,
+    16, 1, 4, 11, 16, 2, 14, 5, 1, 1, 10, 6, 4, 1, 5, 5,
+    4, 1, 6, 11, 2, 2, 1, 6, 3, 1, 2, 1, 1, 11, 4, 2,
+    6, 1, 2, 8, 6, 4, 2, 1, 31, 2, 4, 10, 2, 17, 3, 8,
+    2, 2, 2, 3, 6, 5, 2, 1, 5, 9, 5, 6, 11, 7, 7, 2,
+    1, 7, 8, 2, 3, 19, 2, 2, 9, 6, 3, 1, 2, 3, 24, 13,
+    1, 2, 2, 2, 12, 5, 1, 1, 3, 8, 1, 2, 4, 4, 1, 2,
+    1, 1, 9, 2, 1, 1, 5, 12, 2, 2, 9, 5, 18, 28, 13, 34,
+    2, 11, 13, 16, 16, 5, 6, 7, 2, 7, 16, 5, 4, 10, 2, 5,
+    6, 4, 1, 7, 3, 15, 2, 3, 1, 6, 6, 7, 1, 2, 3, 9,
+    4, 1, 3, 11, 1, 5, 9, 7, 4, 3, 5, 12, 15, 1, 3, 4,
+    12, 3, 1, 8, 5, 2, 3, 3, 9, 6, 4, 4, 2, 4, 4, 3,
+    1, 2, 7, 4, 2, 2, 1, 4, 2, 1, 1, 1, 1, 2, 5, 1,
+    4, 7, 1, 1, 1, 5, 4, 4, 7, 1, 2, 3, 5, 2, 4, 2,
+    3, 1, 5, 4, 9, 4, 1, 2, 5, 1, 2, 1, 5, 4, 2, 3,
+    2, 1, 2, 2, 1, 4, 2, 1, 1, 14, 3, 3, 5, 3, 8, 3,
+    4, 2, 3, 1, 1, 9, 6, 4, 5, 1, 6, 8, 5, 12, 14, 1,
+    1, 4, 11, 5, 4, 5, 1, 1, 1, 1, 2, 3, 2, 4, 3, 5,
+    3, 3, 2, 5, 8, 1, 1, 6, 2, 3, 3, 3, 2, 2, 2, 1,
+    4, 1, 2, 2, 3, 1, 4, 1, 3, 2, 2, 2, 3, 2, 2, 2,
+    5, 1, 13, 2, 11, 12, 1, 4, 4, 7, 17, 6, 3, 5, 14, 17,
+    11, 11, 3, 5, 1, 6, 1, 9, 5, 1, 7, 10, 1, 2, 2, 10,
+    5, 4, 5, 1, 6, 9, 1, 8, 2, 2, 6, 3, 4, 6, 4, 4,
+    7, 3, 3, 5, 2, 4, 6, 4, 3, 16, 17, 8, 12, 2, 5, 10,
+    9, 10, 4, 5, 7, 7, 7, 9, 2, 8, 9, 2, 1, 4, 4, 25,
+    12, 3, 9, 21, 5, 21, 8, 1, 1, 4, 2, 1, 6, 2, 3, 11,
+    3, 12, 1, 1,
+};
+static const uint16_t op_4_row_lengths[128] = {
+    538, 424, 305, 0, 347, 74, 305, 368, 293, 370, 311, 399, 634, 331, 370, 336,
+    331, 481, 375, 380, 64, 338, 8, 236, 116, 401, 37, 375, 344, 335, 399, 389,
+    62, 354, 6, 9, 275, 400, 299, 403, 355, 375, 397, 0, 387, 351, 331, 353,
+    302, 386, 333, 391, 411, 382, 336, 429, 333, 318, 374, 330, 352, 8, 404, 390,
+    345, 304, 453, 284, 295, 313, 380, 328, 364, 379, 337, 322, 25, 380, 407, 656,
+    398, 389, 342, 346, 388, 14, 455, 72, 39, 352, 409, 420, 504, 479, 129, 8,
+    336, 68, 448, 386, 340, 364, 370, 491, 486, 571, 396, 328, 345, 345, 368, 361,
+    376, 303, 12, 54, 362, 398, 371, 22, 358, 321, 440, 399, 359, 388, 327, 321,
+};
+static const int32_t op_4_folded_bias[128] = {
+    -71140, -114820, 46213, -197, 152319, -263136, -150204, 481175,
+    -15602, 326801, 324732, 337445, -735964, 125162, -260974, 41479,
+    -12808, -89324, 371272, 490434, 6190, 122565, -19891, -641721,
+    -398294, 59248, -126014, 181261, 58268, 205263, 164083, 211015,
+    -175821, 245201, -3387, -26809, -262758, -71320, 207240, 93467,
+    25310, 256137, 286497, -249, 441661, 327445, 368099, -7045,
+    164439, 109567, -8470, -180144, -66478, 12657, 71073, 292172,
+    272076, 164568, 38720, 81498, -305332, -13230, -361495, -9912,
+    300348, 56019, -354468, -9879, 113981, 40159, 113034, 108062,
+    178623, -226303, 209988, -92570, -86530, 143940, -296676, 487274,
+    344503, -191735, 244390, 349579, 263812, -40084, 93588, -260830,
+    -103213, 161141, 538510, 233767, -369484, -450900, -336526, -26667,
+    67321, -142890, 467145, 106675, 19092, 167886, 260962, 643320,
+    -313816, -1107043, -24577, 427327, 351341, 141878, -26630, 503571,
+    -437176, -364038, -30665, -183447, 119516, 382131, 378474, -70669,
+    -22796, 241361, 115352, 84566, 204903, -24807, 97936, 245927,
+};
+static const sparse_matrix_t op_4_filter = {op_4_values, op_4_col_steps, op_4_row_lengths};
+
+static constexpr fully_connected_params_t op_5_params = {
+    .batches = 1,
+    .input_size = 128,
+    .output_size = 50,
+    .input_offset = 128,
+    .filter_offset = 0,
+    .output_offset = -128,
+    .multiplier = 1952948935,
+    .shift = -9,
+    .act_min = -128,
+    .act_max = 127,
+};
+
+static constexpr fully_connected_params_t op_6_params = {
+    .batches = 1,
+    .input_size = 50,
+    .output_size = 10,
+    .input_offset = 128,
+    .filter_offset = 0,
+    .output_offset = -4,
+    .multiplier = 1812906312,
+    .shift = -9,
+    .act_min = -128,
+    .act_max = 127,
+};
+
+// Activations, offsets planned by the generator
+alignas(16) static uint8_t model_arena[7488];
+
+model_generated_input_t* model_generated_input() {
+    return (model_generated_input_t*)(model_arena + 0);
+}
+
+const model_generated_output_t* model_generated_output() {
+    return (model_generated_output_t*)(model_arena + 0);
+}
+
+void model_generated_invoke() {
+    kernel_quantize_int8((float*)(model_arena + 0), (int8_t*)(model_arena + 6208), 784, 0.003921568859368563f, -128);
+    kernel_conv2d_pool_int8(&op_1_params, &op_1_pool_params, (int8_t*)(model_arena + 6208), tensor_11, op_1_folded_bias, (int8_t*)(model_arena + 4608), (int8_t*)(model_arena + 0));
+    kernel_conv2d_pool_int8(&op_2_params, &op_2_pool_params, (int8_t*)(model_arena + 0), tensor_9, op_2_folded_bias, (int8_t*)(model_arena + 6208), (int8_t*)(model_arena + 4608));
+    // sequential/flatten/Reshape: reshape in place
+    kernel_fully_connected_sparse_int8(&op_4_params, (int8_t*)(model_arena + 4608), &op_4_filter, op_4_folded_bias, (int8_t*)(model_arena + 0));
+    kernel_fully_connected_int8(&op_5_params, (int8_t*)(model_arena + 0), tensor_5, tensor_4, (int8_t*)(model_arena + 128));
+    kernel_fully_connected_int8(&op_6_params, (int8_t*)(model_arena + 128), tensor_3, tensor_2, (int8_t*)(model_arena + 0));
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+// Generated by train/generate_inference.py from tmnist_model_pruned.tflite, do not edit
+
+#include <stdint.h>
+
+#define MODEL_GENERATED_BATCH 1
+#define MODEL_GENERATED_INPUT_SIZE 784
+#define MODEL_GENERATED_OUTPUT_SIZE 10
+#define MODEL_GENERATED_ARENA_SIZE 7488
+#define MODEL_GENERATED_INPUT_INT8 0
+#define MODEL_GENERATED_OUTPUT_INT8 1
+#define MODEL_GENERATED_INPUT_SCALE 1.0f
+#define MODEL_GENERATED_INPUT_ZERO_POINT 0
+#define MODEL_GENERATED_OUTPUT_LOGITS 1
+#define MODEL_GENERATED_OUTPUT_SCALE 0.3441958427429199f
+#define MODEL_GENERATED_OUTPUT_ZERO_POINT -4
+
+typedef float model_generated_input_t;
+typedef int8_t model_generated_output_t;
+
+model_generated_input_t* model_generated_input();
+const model_generated_output_t* model_generated_output();
+void model_generated_invoke();
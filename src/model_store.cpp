@@ -0,0 +1,242 @@
+#include "model_store.h"
+#include <string.h>
+#ifndef ARDUINO
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+uint32_t model_store_crc32(uint32_t crc, const uint8_t* data, size_t size) {
+    static uint32_t table[256];
+    if (!table[1]) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) {
+                c = c & 1 ? 0xedb88320 ^ (c >> 1) : c >> 1;
+            }
+            table[i] = c;
+        }
+    }
+    crc = ~crc;
+    for (size_t i = 0; i < size; i++) {
+        crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+/**
+ * @brief Check a mapped header and the model behind it
+ */
+static bool model_store_validate(model_store_t* store, const uint8_t* mapped, size_t capacity) {
+    model_store_header_t header;
+    memcpy(&header, mapped, sizeof(header));
+    if (header.magic != MODEL_STORE_MAGIC || header.size == 0 ||
+        header.size > capacity - MODEL_STORE_HEADER_SIZE) {
+        return false;
+    }
+    const uint8_t* data = mapped + MODEL_STORE_HEADER_SIZE;
+    if (model_store_crc32(0, data, header.size) != header.crc) {
+        return false;
+    }
+    store->data = data;
+    store->size = header.size;
+    store->crc = header.crc;
+    return true;
+}
+
+#ifdef ARDUINO
+
+static const esp_partition_t* model_store_partition(const char* name) {
+    return esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, name);
+}
+
+bool model_store_open(model_store_t* store, const char* name) {
+    memset(store, 0, sizeof(*store));
+    const esp_partition_t* partition = model_store_partition(name);
+    if (!partition || partition->size < MODEL_STORE_HEADER_SIZE) {
+        return false;
+    }
+    // Map only the header first, the partition is mostly larger than the model
+    model_store_header_t header;
+    if (esp_partition_read(partition, 0, &header, sizeof(header)) != ESP_OK ||
+        header.magic != MODEL_STORE_MAGIC ||
+        header.size > partition->size - MODEL_STORE_HEADER_SIZE) {
+        return false;
+    }
+    const void* mapped;
+    if (esp_partition_mmap(partition, 0, MODEL_STORE_HEADER_SIZE + header.size, SPI_FLASH_MMAP_DATA,
+                           &mapped, &store->handle) != ESP_OK) {
+        return false;
+    }
+    if (!model_store_validate(store, (const uint8_t*)mapped, partition->size)) {
+        spi_flash_munmap(store->handle);
+        memset(store, 0, sizeof(*store));
+        return false;
+    }
+    return true;
+}
+
+void model_store_close(model_store_t* store) {
+    if (store->data) {
+        spi_flash_munmap(store->handle);
+    }
+    memset(store, 0, sizeof(*store));
+}
+
+uint32_t model_store_capacity(const char* name) {
+    const esp_partition_t* partition = model_store_partition(name);
+    return partition && partition->size > MODEL_STORE_HEADER_SIZE
+               ? partition->size - MODEL_STORE_HEADER_SIZE
+               : 0;
+}
+
+/**
+ * @brief Erase the sectors up to end that are not erased yet
+ *
+ * A body chunk spans one or two sectors, erasing a 4 KiB sector takes tens of
+ * milliseconds, well within the watchdog of the calling task.
+ */
+static bool model_writer_erase(model_writer_t* writer, uint32_t end) {
+    while (writer->erased < end) {
+        if (esp_partition_erase_range(writer->partition, writer->erased, SPI_FLASH_SEC_SIZE) !=
+            ESP_OK) {
+            return false;
+        }
+        writer->erased += SPI_FLASH_SEC_SIZE;
+    }
+    return true;
+}
+
+bool model_writer_begin(model_writer_t* writer, const char* name, uint32_t size) {
+    memset(writer, 0, sizeof(*writer));
+    writer->size = size;
+    writer->partition = model_store_partition(name);
+    if (!writer->partition || size == 0 || size > model_store_capacity(name)) {
+        writer->failed = true;
+        return false;
+    }
+    // Erasing the sector of the header invalidates the stored model
+    if (!model_writer_erase(writer, MODEL_STORE_HEADER_SIZE)) {
+        writer->failed = true;
+    }
+    return !writer->failed;
+}
+
+bool model_writer_write(model_writer_t* writer, const uint8_t* data, size_t size) {
+    if (writer->failed || size > writer->size - writer->written ||
+        !model_writer_erase(writer, MODEL_STORE_HEADER_SIZE + writer->written + size)) {
+        writer->failed = true;
+        return false;
+    }
+    if (esp_partition_write(writer->partition, MODEL_STORE_HEADER_SIZE + writer->written, data,
+                            size) != ESP_OK) {
+        writer->failed = true;
+        return false;
+    }
+    writer->crc = model_store_crc32(writer->crc, data, size);
+    writer->written += size;
+    return true;
+}
+
+bool model_writer_finish(model_writer_t* writer, uint32_t crc) {
+    if (writer->failed || writer->written != writer->size || writer->crc != crc) {
+        writer->failed = true;
+        return false;
+    }
+    model_store_header_t header = {MODEL_STORE_MAGIC, writer->size, crc, 0};
+    if (esp_partition_write(writer->partition, 0, &header, sizeof(header)) != ESP_OK) {
+        writer->failed = true;
+    }
+    return !writer->failed;
+}
+
+#else
+
+bool model_store_open(model_store_t* store, const char* name) {
+    memset(store, 0, sizeof(*store));
+    int fd = open(name, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < MODEL_STORE_HEADER_SIZE) {
+        close(fd);
+        return false;
+    }
+    // The mapping stays valid after the descriptor is closed
+    void* mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+    if (!model_store_validate(store, (const uint8_t*)mapping, st.st_size)) {
+        munmap(mapping, st.st_size);
+        memset(store, 0, sizeof(*store));
+        return false;
+    }
+    store->mapping = mapping;
+    store->mapping_size = st.st_size;
+    return true;
+}
+
+void model_store_close(model_store_t* store) {
+    if (store->mapping) {
+        munmap(store->mapping, store->mapping_size);
+    }
+    memset(store, 0, sizeof(*store));
+}
+
+uint32_t model_store_capacity(const char* name) {
+    (void)name;
+    // A file grows with the model
+    return UINT32_MAX - MODEL_STORE_HEADER_SIZE;
+}
+
+bool model_writer_begin(model_writer_t* writer, const char* name, uint32_t size) {
+    memset(writer, 0, sizeof(*writer));
+    writer->size = size;
+    writer->file = fopen(name, "wb");
+    if (!writer->file || size == 0) {
+        writer->failed = true;
+        return false;
+    }
+    // Zero header until the model is complete
+    model_store_header_t header = {};
+    if (fwrite(&header, sizeof(header), 1, writer->file) != 1) {
+        writer->failed = true;
+    }
+    return !writer->failed;
+}
+
+bool model_writer_write(model_writer_t* writer, const uint8_t* data, size_t size) {
+    if (writer->failed || size > writer->size - writer->written ||
+        fwrite(data, 1, size, writer->file) != size) {
+        writer->failed = true;
+        return false;
+    }
+    writer->crc = model_store_crc32(writer->crc, data, size);
+    writer->written += size;
+    return true;
+}
+
+bool model_writer_finish(model_writer_t* writer, uint32_t crc) {
+    if (!writer->failed && writer->written == writer->size && writer->crc == crc) {
+        model_store_header_t header = {MODEL_STORE_MAGIC, writer->size, crc, 0};
+        if (fseek(writer->file, 0, SEEK_SET) != 0 ||
+            fwrite(&header, sizeof(header), 1, writer->file) != 1) {
+            writer->failed = true;
+        }
+    } else {
+        writer->failed = true;
+    }
+    if (writer->file) {
+        if (fclose(writer->file) != 0) {
+            writer->failed = true;
+        }
+        writer->file = nullptr;
+    }
+    return !writer->failed;
+}
+
+#endif
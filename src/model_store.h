@@ -0,0 +1,87 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#ifdef ARDUINO
+#include <esp_partition.h>
+#include <esp_spi_flash.h>
+#else
+#include <stdio.h>
+#endif
+
+/**
+ * Model flatbuffer kept outside the firmware
+ *
+ * On the ESP32 the model lives in a data partition and is memory mapped, so
+ * tflite::GetModel() reads it from flash without a copy. On the host a file
+ * with the same layout is mapped instead. The layout is a header followed by
+ * the model bytes, the header is written last so an interrupted upload never
+ * looks valid.
+ */
+
+#define MODEL_STORE_MAGIC 0x4c444d54  // "TMDL"
+#define MODEL_STORE_HEADER_SIZE 16    // Keeps the flatbuffer 16 byte aligned
+#define MODEL_STORE_PARTITION "model"
+
+typedef struct {
+    uint32_t magic;
+    uint32_t size;  // Model bytes after the header
+    uint32_t crc;   // CRC-32 of the model bytes
+    uint32_t reserved;
+} model_store_header_t;
+
+typedef struct {
+    const uint8_t* data;  // Model flatbuffer
+    uint32_t size;
+    uint32_t crc;
+#ifdef ARDUINO
+    spi_flash_mmap_handle_t handle;
+#else
+    void* mapping;
+    size_t mapping_size;
+#endif
+} model_store_t;
+
+typedef struct {
+    uint32_t size;  // Announced model size
+    uint32_t written;
+    uint32_t crc;
+    bool failed;
+#ifdef ARDUINO
+    const esp_partition_t* partition;
+    uint32_t erased;  // Partition bytes erased so far, sectors are erased as writes reach them
+#else
+    FILE* file;
+#endif
+} model_writer_t;
+
+/**
+ * @brief CRC-32 as computed by zlib, pass 0 to start
+ */
+uint32_t model_store_crc32(uint32_t crc, const uint8_t* data, size_t size);
+
+/**
+ * @brief Map the stored model and check its CRC
+ *
+ * @param name Partition label on the ESP32, file path on the host
+ * @return false when there is no valid model
+ */
+bool model_store_open(model_store_t* store, const char* name);
+void model_store_close(model_store_t* store);
+
+/**
+ * @brief Bytes available for the model, 0 when the store does not exist
+ */
+uint32_t model_store_capacity(const char* name);
+
+/**
+ * @brief Replace the stored model chunk by chunk
+ *
+ * Begin invalidates the stored model, finish compares the CRC of all chunks
+ * with the expected one and only then writes the header. Flash is erased one
+ * sector at a time ahead of the writes, so no call blocks for the whole
+ * partition.
+ */
+bool model_writer_begin(model_writer_t* writer, const char* name, uint32_t size);
+bool model_writer_write(model_writer_t* writer, const uint8_t* data, size_t size);
+bool model_writer_finish(model_writer_t* writer, uint32_t crc);
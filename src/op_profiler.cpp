@@ -0,0 +1,66 @@
+#include "op_profiler.h"
+#include <string.h>
+
+void cycle_stats_add(cycle_stats_t* stats, uint32_t cycles) {
+    if (stats->count == 0 || cycles < stats->min) {
+        stats->min = cycles;
+    }
+    if (cycles > stats->max) {
+        stats->max = cycles;
+    }
+    stats->count++;
+    stats->total += cycles;
+}
+
+uint32_t op_profiler_t::BeginEvent(const char* tag) {
+    int index = next_op++;
+    if (index < OP_PROFILER_MAX_OPS) {
+        ops[index].tag = tag;
+        op_starts[index] = cycles();
+    }
+    return index;
+}
+
+void op_profiler_t::EndEvent(uint32_t event_handle) {
+    uint32_t end = cycles();
+    if (event_handle >= OP_PROFILER_MAX_OPS) {
+        return;
+    }
+    cycle_stats_add(&ops[event_handle].cycles, end - op_starts[event_handle]);
+    if ((int)event_handle >= ops_seen) {
+        ops_seen = event_handle + 1;
+    }
+}
+
+void op_profiler_t::begin_reading() {
+    reading_total = 0;
+}
+
+/**
+ * @brief Count the reading when it invoked the model
+ */
+void op_profiler_t::end_reading() {
+    if (reading_total > 0) {
+        cycle_stats_add(&readings, reading_total);
+    }
+}
+
+void op_profiler_t::begin_invoke() {
+    next_op = 0;
+    invoke_start = cycles();
+}
+
+void op_profiler_t::end_invoke() {
+    uint32_t invoke_cycles = cycles() - invoke_start;
+    cycle_stats_add(&invokes, invoke_cycles);
+    reading_total += invoke_cycles;
+}
+
+void op_profiler_t::reset() {
+    memset(ops, 0, sizeof(ops));
+    ops_seen = 0;
+    next_op = 0;
+    reading_total = 0;
+    invokes = {};
+    readings = {};
+}
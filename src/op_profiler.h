@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stdint.h>
+#include "tensorflow/lite/micro/micro_profiler_interface.h"
+
+// Nodes of the graph, later ones are not profiled
+#define OP_PROFILER_MAX_OPS 16
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+} cycle_stats_t;
+
+void cycle_stats_add(cycle_stats_t* stats, uint32_t cycles);
+
+typedef struct {
+    const char* tag;  // Operator name, e.g. CONV_2D
+    cycle_stats_t cycles;
+} op_profile_t;
+
+/**
+ * @brief Cycles of every operator, gathered over all invocations
+ *
+ * Pass to the MicroInterpreter constructor. The interpreter reports one event
+ * per operator in execution order, so the n-th event after begin_invoke() is
+ * node n. Invoke and reading totals include the interpreter overhead between
+ * operators and work without operator events, as with the generated model.
+ */
+class op_profiler_t : public tflite::MicroProfilerInterface {
+   public:
+    explicit op_profiler_t(uint32_t (*cycles)()) : cycles(cycles) { reset(); }
+
+    uint32_t BeginEvent(const char* tag) override;
+    void EndEvent(uint32_t event_handle) override;
+
+    void begin_reading();
+    void end_reading();
+    void begin_invoke();
+    void end_invoke();
+    void reset();
+
+    int op_count() const { return ops_seen; }
+    const op_profile_t& op(int index) const { return ops[index]; }
+    const cycle_stats_t& invoke_cycles() const { return invokes; }
+    // Readings that ran the model at least once
+    const cycle_stats_t& reading_cycles() const { return readings; }
+
+   private:
+    uint32_t (*cycles)();
+    op_profile_t ops[OP_PROFILER_MAX_OPS];
+    uint32_t op_starts[OP_PROFILER_MAX_OPS];
+    int ops_seen;
+    int next_op;
+    uint32_t invoke_start;
+    uint32_t reading_total;
+    cycle_stats_t invokes;
+    cycle_stats_t readings;
+};
@@ -0,0 +1,58 @@
+#include "perceptual_hash.h"
+#include <stdlib.h>
+
+#define DIGIT_SIZE 28
+#define HASH_BLOCKS 8
+
+uint64_t perceptual_hash_digit(const uint8_t* pixels) {
+    // Block edges at i * 28 / 8, blocks are 3 or 4 pixels wide
+    static const uint8_t edges[HASH_BLOCKS + 1] = {0, 3, 7, 10, 14, 17, 21, 24, 28};
+    uint16_t column_sums[HASH_BLOCKS];
+    uint32_t means[HASH_BLOCKS * HASH_BLOCKS];
+    uint32_t total = 0;
+
+    for (int block_y = 0; block_y < HASH_BLOCKS; block_y++) {
+        for (int block_x = 0; block_x < HASH_BLOCKS; block_x++) {
+            column_sums[block_x] = 0;
+        }
+        for (int y = edges[block_y]; y < edges[block_y + 1]; y++) {
+            const uint8_t* row = pixels + y * DIGIT_SIZE;
+            for (int block_x = 0; block_x < HASH_BLOCKS; block_x++) {
+                for (int x = edges[block_x]; x < edges[block_x + 1]; x++) {
+                    column_sums[block_x] += row[x];
+                }
+            }
+        }
+        const int h = edges[block_y + 1] - edges[block_y];
+        for (int block_x = 0; block_x < HASH_BLOCKS; block_x++) {
+            const int w = edges[block_x + 1] - edges[block_x];
+            // Scaled to a 4x4 block so blocks of different size compare
+            means[block_y * HASH_BLOCKS + block_x] = column_sums[block_x] * 16 / (w * h);
+            total += means[block_y * HASH_BLOCKS + block_x];
+        }
+    }
+
+    const uint32_t mean = total / (HASH_BLOCKS * HASH_BLOCKS);
+    uint64_t hash = 0;
+    for (int i = 0; i < HASH_BLOCKS * HASH_BLOCKS; i++) {
+        hash |= (uint64_t)(means[i] > mean) << i;
+    }
+    return hash;
+}
+
+int perceptual_hash_changed_pixels(const uint8_t* a, const uint8_t* b) {
+    int changed = 0;
+    for (int i = 0; i < DIGIT_SIZE * DIGIT_SIZE; i++) {
+        changed += abs(a[i] - b[i]) > PERCEPTUAL_HASH_PIXEL_LEVEL;
+    }
+    return changed;
+}
+
+bool perceptual_hash_same_digit(uint64_t hash_a,
+                                const uint8_t* a,
+                                uint64_t hash_b,
+                                const uint8_t* b,
+                                int max_distance) {
+    return perceptual_hash_distance(hash_a, hash_b) <= max_distance &&
+           perceptual_hash_changed_pixels(a, b) <= PERCEPTUAL_HASH_MAX_CHANGED;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Average hash of a 28x28 digit
+ *
+ * The digit is reduced to 8x8 block means, every bit tells whether a block
+ * is brighter than the whole digit. Noise and lighting barely change it, but
+ * neighbouring digits of one font (5 and 6, 0 and 8) differ by a bit or two,
+ * so a hash within distance only nominates a match for
+ * perceptual_hash_same_digit().
+ */
+uint64_t perceptual_hash_digit(const uint8_t* pixels);
+
+/**
+ * @brief Number of differing bits of two hashes
+ */
+static inline int perceptual_hash_distance(uint64_t a, uint64_t b) {
+    return __builtin_popcountll(a ^ b);
+}
+
+// Pixel difference that counts as a change, above sensor noise and slow lighting drift
+#define PERCEPTUAL_HASH_PIXEL_LEVEL 64
+// Changed pixels of the same digit, one stroke or segment of a 28x28 digit is several times more
+#define PERCEPTUAL_HASH_MAX_CHANGED 12
+
+/**
+ * @brief Number of pixels of two 28x28 digits differing by more than PERCEPTUAL_HASH_PIXEL_LEVEL
+ */
+int perceptual_hash_changed_pixels(const uint8_t* a, const uint8_t* b);
+
+/**
+ * @brief Whether two 28x28 digits show the same digit
+ *
+ * Hashes within max_distance are confirmed by their pixels. A shifted digit
+ * fails the pixel check and is classified again, which costs time but never
+ * takes the old digit for a new one.
+ */
+bool perceptual_hash_same_digit(uint64_t hash_a,
+                                const uint8_t* a,
+                                uint64_t hash_b,
+                                const uint8_t* b,
+                                int max_distance);
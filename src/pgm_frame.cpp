@@ -0,0 +1,58 @@
+#include "pgm_frame.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/**
+ * @brief Read next header number, skipping whitespace and comments
+ */
+static bool pgm_read_number(FILE* file, unsigned int* value) {
+    int c = fgetc(file);
+    while (c != EOF && (isspace(c) || c == '#')) {
+        if (c == '#') {
+            while (c != EOF && c != '\n') {
+                c = fgetc(file);
+            }
+        }
+        c = fgetc(file);
+    }
+    if (c == EOF || !isdigit(c)) {
+        return false;
+    }
+    *value = 0;
+    while (c != EOF && isdigit(c)) {
+        *value = *value * 10 + (c - '0');
+        c = fgetc(file);
+    }
+    // Exactly one whitespace character ends the number
+    return c != EOF && isspace(c);
+}
+
+bool pgm_load(const char* path, gray_frame_t* frame) {
+    *frame = {};
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return false;
+    }
+    unsigned int width, height, max_value;
+    bool valid = fgetc(file) == 'P' && fgetc(file) == '5' && pgm_read_number(file, &width) &&
+                 pgm_read_number(file, &height) && pgm_read_number(file, &max_value) &&
+                 width > 0 && height > 0 && max_value > 0 && max_value < 256;
+    if (valid) {
+        size_t size = (size_t)width * height;
+        frame->buf = (uint8_t*)malloc(size);
+        valid = frame->buf && fread(frame->buf, 1, size, file) == size;
+        frame->width = width;
+        frame->height = height;
+    }
+    fclose(file);
+    if (!valid) {
+        pgm_free(frame);
+    }
+    return valid;
+}
+
+void pgm_free(gray_frame_t* frame) {
+    free(frame->buf);
+    *frame = {};
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "reading.h"
+
+/**
+ * @brief Load a binary 8-bit PGM (P5) file as a grayscale frame
+ *
+ * Frames saved from the camera can be read by the native build this way.
+ *
+ * @param path File to load
+ * @param frame Filled with a malloc'd buffer, release with pgm_free()
+ * @return false when the file is missing or not an 8-bit P5 image
+ */
+bool pgm_load(const char* path, gray_frame_t* frame);
+void pgm_free(gray_frame_t* frame);
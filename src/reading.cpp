@@ -0,0 +1,717 @@
+#include "reading.h"
+#include <string.h>
+#include <algorithm>
+#ifndef ARDUINO
+#include <chrono>
+#endif
+#include "model_data.h"
+#include "perceptual_hash.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+#include "tflm_conv.h"
+
+config_t config;
+std::unique_ptr<model_interpreter_t> interpreter;
+uint8_t* tensor_arena;
+tensor_lut_t input_lut;
+integral_image_t frame_integral = {};
+template_set_t digit_templates;
+cascade_stats_t cascade_stats = {};
+digit_cache_t digit_cache;
+odometer_t odometer;
+bool model_outputs_logits = MODEL_OUTPUT_LOGITS;
+
+#ifdef ARDUINO
+uint32_t readingMicros() {
+    return micros();
+}
+
+static uint32_t profilerCycles() {
+    return ESP.getCycleCount();
+}
+#else
+uint32_t readingMicros() {
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::microseconds>(now).count();
+}
+
+// Nanoseconds stand in for CPU cycles in the native build
+static uint32_t profilerCycles() {
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+#endif
+op_profiler_t op_profiler(profilerCycles);
+
+#ifndef MODEL_GENERATED
+/**
+ * @brief Model compiled into the firmware for this build
+ */
+const tflite::Model* firmwareModel() {
+#if MODEL_BATCH > 1
+    return tflite::GetModel(tmnist_model_batch_tflite);
+#elif defined(MODEL_INT8_IO)
+    return tflite::GetModel(tmnist_model_int8_tflite);
+#else
+    return tflite::GetModel(tmnist_model_tflite);
+#endif
+}
+
+/**
+ * @brief Operations of the model of this build
+ */
+const tflite::MicroOpResolver& modelResolver() {
+#ifdef MODEL_INT8_IO
+    static tflite::MicroMutableOpResolver<5> resolver;
+#else
+    static tflite::MicroMutableOpResolver<10> resolver;
+#endif
+    static bool registered = false;
+    if (registered) {
+        return resolver;
+    }
+    registered = true;
+#ifdef MODEL_INT8_IO
+    // Fully integer model reads and writes int8 tensors, no conversion ops
+    resolver.AddConv2D(conv2d_specialized_registration());
+    resolver.AddMaxPool2D();
+    resolver.AddReshape();
+    resolver.AddFullyConnected();
+    resolver.AddSoftmax();
+#else
+    resolver.AddReadVariable();
+    resolver.AddQuantize();
+    resolver.AddFullyConnected();
+    resolver.AddSoftmax();
+    resolver.AddDequantize();
+    resolver.AddConv2D(conv2d_specialized_registration());
+    resolver.AddMaxPool2D();
+    resolver.AddReshape();
+    // Global average pooling model of the notebook, uploaded to /api/model: separable
+    // convolutions are a depthwise and a 1x1 convolution, global pooling is a mean
+    resolver.AddDepthwiseConv2D();
+    resolver.AddMean();
+#endif
+    return resolver;
+}
+
+/**
+ * @brief Whether a model ends at the logits instead of a Softmax
+ *
+ * A trailing Dequantize only changes the type, the op before it decides.
+ */
+bool modelOutputsLogits(const tflite::Model* model) {
+    const tflite::SubGraph* subgraph = model->subgraphs()->Get(0);
+    for (int i = (int)subgraph->operators()->size() - 1; i >= 0; i--) {
+        const tflite::Operator* op = subgraph->operators()->Get(i);
+        const tflite::OperatorCode* code = model->operator_codes()->Get(op->opcode_index());
+        tflite::BuiltinOperator builtin = tflite::GetBuiltinCode(code);
+        if (builtin != tflite::BuiltinOperator_DEQUANTIZE) {
+            return builtin != tflite::BuiltinOperator_SOFTMAX;
+        }
+    }
+    return false;
+}
+#endif
+
+/**
+ * @brief Whether model input and output are the digit tensors of this build
+ *
+ * MODEL_INT8_IO builds resolve no Quantize/Dequantize ops and need int8 tensors, other builds
+ * take int8 or float tensors as long as both are the same type.
+ */
+bool modelTensorsFit(const TfLiteTensor* input, const TfLiteTensor* output) {
+#ifdef MODEL_INT8_IO
+    if (input->type != kTfLiteInt8) {
+        return false;
+    }
+#endif
+    if (input->type != output->type ||
+        (input->type != kTfLiteInt8 && input->type != kTfLiteFloat32)) {
+        return false;
+    }
+    size_t element_bytes = input->type == kTfLiteInt8 ? sizeof(int8_t) : sizeof(float);
+    return input->bytes == MODEL_BATCH * 28 * 28 * element_bytes &&
+           output->bytes == MODEL_BATCH * 10 * element_bytes;
+}
+
+/**
+ * @brief Prepare conversion of pixels to the model input
+ */
+void initInputLut() {
+    TfLiteTensor* input = interpreter->input(0);
+    if (input->type == kTfLiteInt8) {
+        tensor_lut_init(&input_lut, TENSOR_FORMAT_INT8, input->params.scale, input->params.zero_point);
+    } else {
+        tensor_lut_init(&input_lut, TENSOR_FORMAT_FLOAT32, 1.0f, 0);
+    }
+}
+
+/**
+ * @brief Build config from parsed JSON, resets the state of the previous config
+ *
+ * @param doc Parsed config.json
+ * @param frame_width Width of the frames that will be read
+ * @param frame_height Height of the frames that will be read
+ * @return config_t Config with precomputed resampling tables, empty on error
+ */
+config_t configFromJson(JsonDocument& doc, unsigned int frame_width, unsigned int frame_height) {
+    // Value-initialized, flags like use_integral are only ever set below
+    config_t config{};
+    // Parse rectangles
+    for (JsonObject rectangle : doc["rectangles"].as<JsonArray>()) {
+        unsigned rectangle_x = rectangle["x"];
+        unsigned rectangle_y = rectangle["y"];
+        unsigned rectangle_width = rectangle["width"];
+        unsigned rectangle_height = rectangle["height"];
+        float rectangle_angle = rectangle["angle"] | 0.0f;
+        rectangle_t parsed = {.x = rectangle_x,
+                              .y = rectangle_y,
+                              .width = rectangle_width,
+                              .height = rectangle_height,
+                              .angle = rectangle_angle,
+                              .has_matrix = false};
+        // Optional full affine transform
+        JsonArray matrix = rectangle["matrix"];
+        if (matrix.size() == 6) {
+            parsed.has_matrix = true;
+            for (int i = 0; i < 6; i++) {
+                parsed.matrix[i] = matrix[i];
+            }
+        }
+        config.rectangles.push_back(parsed);
+    }
+
+    // Parse register window, replaces rectangles when present
+    JsonObject window = doc["window"];
+    JsonArray corners = window["corners"];
+    config.window.enabled = corners.size() == 4;
+    if (config.window.enabled) {
+        for (int i = 0; i < 4; i++) {
+            config.window.corners[2 * i] = corners[i][0];
+            config.window.corners[2 * i + 1] = corners[i][1];
+        }
+        config.window.digits = window["digits"] | 1;
+        // Every cell takes 28x28 remap entries of DRAM
+        if (config.window.digits < 1 || config.window.digits > WINDOW_MAX_DIGITS) {
+            READING_LOG("Window digits must be 1 to %d\n", WINDOW_MAX_DIGITS);
+            return {};
+        }
+    }
+
+    // Parse contrast normalization
+    config.auto_contrast = doc["auto_contrast"] | false;
+    const char* polarity = doc["polarity"] | "auto";
+    if (strcmp(polarity, "keep") == 0) {
+        config.polarity = POLARITY_KEEP;
+    } else if (strcmp(polarity, "invert") == 0) {
+        config.polarity = POLARITY_INVERT;
+    } else {
+        config.polarity = POLARITY_AUTO;
+    }
+
+    // Parse cascade, templates of the previous rectangles no longer apply
+    config.cascade = doc["cascade"] | false;
+    config.cascade_threshold = doc["cascade_threshold"] | 0.5f;
+    template_set_reset(&digit_templates);
+    cascade_stats = {};
+
+    // Parse digit cache, cached results belong to the previous rectangles
+    config.cache = doc["cache"] | false;
+    config.cache_distance = doc["cache_distance"] | 6;
+    digit_cache.entries.clear();
+    digit_cache.previews.clear();
+    digit_cache.hits = 0;
+    digit_cache.misses = 0;
+
+    // Parse odometer mode, digits are ordered most significant first
+    config.odometer = doc["odometer"] | false;
+    config.odometer_refresh = doc["odometer_refresh"] | 60;
+    odometer = {};
+
+    // Parse confidence, every reading is logged unless a minimum is set
+    config.confidence_temperature = doc["confidence_temperature"] | 1.0f;
+    if (config.confidence_temperature <= 0) {
+        config.confidence_temperature = 1.0f;
+    }
+    config.min_confidence = doc["min_confidence"] | 0.0f;
+    config.retries = doc["retries"] | 2;
+
+    if (config.window.enabled) {
+        // Rectify the whole window into a strip of 28x28 cells with one homography
+        float matrix[9];
+        if (!homography_from_quad(matrix, config.window.corners, 28 * config.window.digits, 28)) {
+            READING_LOG("Invalid window corners\n");
+            return {};
+        }
+        size_t entries = config.window.digits * 28 * 28;
+        config.remap_offsets.resize(entries);
+        config.remap_weights.resize(entries);
+        remap_init_homography(config.remap_offsets.data(), config.remap_weights.data(), matrix,
+                              config.window.digits, 28, 28, frame_width, frame_height);
+        config.rectangles.clear();
+        config.coefs.resize(config.window.digits);
+        for (size_t i = 0; i < config.window.digits; i++) {
+            scale_coefs_init_remap(&config.coefs[i], &config.remap_offsets[i * 28 * 28],
+                                   &config.remap_weights[i * 28 * 28], 28, 28);
+        }
+        READING_LOG("Window remap table: %u bytes\n",
+                    (unsigned int)(entries * (sizeof(uint32_t) + sizeof(uint16_t))));
+        return config;
+    }
+
+    // Precompute source taps and weights, captures then only gather and blend
+    // Union of all axis-aligned rectangles, the area covered by the integral image
+    unsigned int left = frame_width, top = frame_height, right = 0, bottom = 0;
+    config.coefs.resize(config.rectangles.size());
+    for (size_t i = 0; i < config.rectangles.size(); i++) {
+        rectangle_t& rectangle = config.rectangles[i];
+        if (rectangle.angle != 0 && !rectangle.has_matrix) {
+            affine_from_rectangle(rectangle.matrix, rectangle.x, rectangle.y, rectangle.width,
+                                  rectangle.height, rectangle.angle, 28, 28);
+            rectangle.has_matrix = true;
+        }
+        if (rectangle.has_matrix) {
+            scale_coefs_init_affine(&config.coefs[i], rectangle.matrix, 28, 28, frame_width,
+                                    frame_height);
+        } else {
+            // Taps and box bins read the whole rectangle, it has to lie inside the frame
+            if (rectangle.width == 0 || rectangle.height == 0 || rectangle.x >= frame_width ||
+                rectangle.y >= frame_height || rectangle.width > frame_width - rectangle.x ||
+                rectangle.height > frame_height - rectangle.y) {
+                READING_LOG("Rectangle %u is outside the %ux%u frame\n", (unsigned int)i,
+                            frame_width, frame_height);
+                return {};
+            }
+            scale_coefs_init(&config.coefs[i], rectangle.width, rectangle.height, 28, 28);
+            left = std::min(left, rectangle.x);
+            top = std::min(top, rectangle.y);
+            right = std::max(right, rectangle.x + rectangle.width);
+            bottom = std::max(bottom, rectangle.y + rectangle.height);
+            config.use_integral |= config.coefs[i].mode == SCALE_MODE_BOX;
+        }
+    }
+    READING_LOG("Resampling tables: %u bytes\n",
+                (unsigned int)(config.coefs.size() * sizeof(scale_coefs_t)));
+
+    // Integral image memory is kept across captures and only grows
+    if (config.use_integral) {
+        if (integral_image_reserve(&frame_integral, left, top, right - left, bottom - top)) {
+            READING_LOG("Integral image: %u bytes\n",
+                        (unsigned int)(frame_integral.capacity * sizeof(uint32_t)));
+        } else {
+            // Box mode reads the integral image, sample large rectangles bilinear instead
+            READING_LOG("Failed to allocate integral image, sampling all rectangles bilinear\n");
+            config.use_integral = false;
+            for (scale_coefs_t& coefs : config.coefs) {
+                if (coefs.mode == SCALE_MODE_BOX) {
+                    coefs.mode = SCALE_MODE_BILINEAR;
+                }
+            }
+        }
+    }
+    return config;
+}
+
+/**
+ * @brief Compute integral image of the rectangle area of given frame
+ *
+ * @param frame Grayscale frame
+ * @return const integral_image_t* Integral image, NULL when no rectangle uses it
+ */
+const integral_image_t* buildIntegral(const gray_frame_t* frame) {
+    if (!config.use_integral) {
+        return nullptr;
+    }
+    integral_image_build(&frame_integral, frame->buf, frame->width);
+    return &frame_integral;
+}
+
+/**
+ * @brief Prepare resampling jobs of all rectangles of given frame
+ *
+ * @param frame Grayscale frame
+ * @param frame_jobs Jobs with their output buffers
+ * @param with_previews Also produce 8-bit previews
+ * @param integral Integral image of the frame, NULL to read the frame directly
+ */
+void prepareJobs(const gray_frame_t* frame,
+                 frame_jobs_t& frame_jobs,
+                 bool with_previews,
+                 const integral_image_t* integral) {
+    size_t count = config.coefs.size();
+    TfLiteTensor* input = interpreter->input(0);
+    size_t input_bytes = input->bytes / MODEL_BATCH;
+    // When all digits fit one batch they are resampled straight into their slot of the input
+    // tensor. Invoke() may reuse the tensor, so not for the odometer, which can run it twice.
+    bool in_tensor = count <= MODEL_BATCH && !config.odometer;
+    frame_jobs.jobs.resize(count);
+    frame_jobs.inputs.resize(in_tensor ? 0 : count * input_bytes);
+    uint8_t* inputs = in_tensor ? (uint8_t*)input->data.raw : frame_jobs.inputs.data();
+    // Contrast normalization keeps the raw output in the preview until the digit is done,
+    // the cascade and the cache work on the previews
+    bool previews = with_previews || config.auto_contrast || config.cascade || config.cache;
+    frame_jobs.previews.resize(previews ? count * 28 * 28 : 0);
+    frame_jobs.contrasts.resize(config.auto_contrast ? count : 0);
+    frame_jobs.digits.assign(count, -1);
+    frame_jobs.scores.assign(count, 0.0f);
+    frame_jobs.runner_ups.assign(count, -1);
+    frame_jobs.logits.assign(count * RANKING_CLASSES, 0.0f);
+    frame_jobs.sources.assign(count, DIGIT_MODEL);
+
+    for (size_t i = 0; i < count; i++) {
+        if (config.auto_contrast) {
+            frame_jobs.contrasts[i].polarity = config.polarity;
+        }
+        // Window cells sample in absolute frame coordinates and have no rectangle
+        rectangle_t rectangle = i < config.rectangles.size() ? config.rectangles[i] : rectangle_t{};
+        frame_jobs.jobs[i] = {
+            .src =
+                {
+                    .pixels = frame->buf,
+                    .w = frame->width,
+                    .h = frame->height,
+                    .offsetX = rectangle.x,
+                    .offsetY = rectangle.y,
+                    .sectionWidth = rectangle.width,
+                    .sectionHeight = rectangle.height,
+                },
+            .coefs = &config.coefs[i],
+            .dst =
+                {
+                    .data = inputs + i * input_bytes,
+                    .lut = &input_lut,
+                    .preview =
+                        frame_jobs.previews.empty() ? nullptr : &frame_jobs.previews[i * 28 * 28],
+                    .contrast = config.auto_contrast ? &frame_jobs.contrasts[i] : nullptr,
+                },
+            .integral = integral,
+        };
+    }
+}
+
+/**
+ * @brief Run model on all digits not classified yet, MODEL_BATCH digits per Invoke()
+ *
+ * Digits are copied into the input tensor and the last batch is padded with
+ * zeros. Digits prepareJobs() resampled straight into the tensor are run in
+ * place in a single Invoke(), slots of classified digits are run along.
+ *
+ * @param model_interpreter Interpreter to run, its batch size is taken from the input shape
+ * @param frame_jobs Resampled digits, digit, score, runner-up and logits are set where the digit is -1
+ * @return true on success
+ */
+bool inferDigits(model_interpreter_t* model_interpreter, frame_jobs_t& frame_jobs) {
+    TfLiteTensor* input = model_interpreter->input(0);
+    size_t batch = input->dims->data[0];
+    size_t sample_bytes = input->bytes / batch;
+    std::vector<size_t> pending;
+    for (size_t i = 0; i < frame_jobs.digits.size(); i++) {
+        if (frame_jobs.digits[i] < 0) {
+            pending.push_back(i);
+        }
+    }
+
+    // Digits resampled into this tensor already sit in the slot of their rectangle
+    bool in_tensor = !frame_jobs.jobs.empty() && frame_jobs.jobs[0].dst.data == input->data.raw;
+    for (size_t first = 0; first < pending.size(); first += batch) {
+        size_t samples = std::min(batch, pending.size() - first);
+        if (!in_tensor) {
+            for (size_t i = 0; i < samples; i++) {
+                memcpy(input->data.raw + i * sample_bytes,
+                       frame_jobs.jobs[pending[first + i]].dst.data, sample_bytes);
+            }
+            memset(input->data.raw + samples * sample_bytes, 0, (batch - samples) * sample_bytes);
+        }
+
+        // Run inference
+        op_profiler.begin_invoke();
+        if (model_interpreter->Invoke() != kTfLiteOk) {
+            READING_LOG("Failed to invoke tflite\n");
+            return false;
+        }
+        op_profiler.end_invoke();
+
+        // Obtain a pointer to the output tensor
+        TfLiteTensor* output = model_interpreter->output(0);
+
+        for (size_t i = 0; i < samples; i++) {
+            size_t index = pending[first + i];
+            size_t slot = in_tensor ? index : i;
+            digit_ranking_t ranking;
+            if (output->type == kTfLiteInt8 && model_outputs_logits) {
+                digit_ranking_logits_int8(output->data.int8 + slot * 10, output->params.scale,
+                                          config.confidence_temperature, &ranking);
+            } else if (model_outputs_logits) {
+                digit_ranking_logits_float(output->data.f + slot * 10, config.confidence_temperature,
+                                           &ranking);
+            } else if (output->type == kTfLiteInt8) {
+                digit_ranking_probabilities_int8(output->data.int8 + slot * 10,
+                                                 output->params.zero_point,
+                                                 config.confidence_temperature, &ranking);
+            } else {
+                digit_ranking_probabilities_float(output->data.f + slot * 10,
+                                                  config.confidence_temperature, &ranking);
+            }
+            frame_jobs.digits[index] = ranking.top1;
+            frame_jobs.scores[index] = ranking.confidence;
+            frame_jobs.runner_ups[index] = ranking.top2;
+            memcpy(&frame_jobs.logits[index * RANKING_CLASSES], ranking.relative, sizeof(ranking.relative));
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Classify digits by their learned templates where confident enough
+ *
+ * @param frame_jobs Resampled digits with previews, digits and scores are filled on a match
+ * @return size_t Number of digits classified
+ */
+size_t matchDigits(frame_jobs_t& frame_jobs) {
+    size_t matched = 0;
+    for (size_t i = 0; i < frame_jobs.jobs.size(); i++) {
+        if (frame_jobs.digits[i] >= 0) {
+            continue;
+        }
+        float confidence;
+        int digit = template_set_match(&digit_templates, frame_jobs.jobs[i].dst.preview, &confidence);
+        if (digit >= 0 && confidence >= config.cascade_threshold) {
+            frame_jobs.digits[i] = digit;
+            frame_jobs.scores[i] = confidence;
+            frame_jobs.sources[i] = DIGIT_TEMPLATE;
+            matched++;
+        }
+    }
+    return matched;
+}
+
+/**
+ * @brief Take digits whose rectangle looks the same as when it was last classified
+ *
+ * @param frame_jobs Resampled digits with previews, digits and scores are filled on a hit
+ * @param hashes Filled with the hash of every digit
+ * @return size_t Number of cache hits
+ */
+size_t lookupCache(frame_jobs_t& frame_jobs, std::vector<uint64_t>& hashes) {
+    size_t count = frame_jobs.jobs.size();
+    if (digit_cache.entries.size() != count) {
+        digit_cache.entries.assign(count, {.hash = 0, .digit = -1, .score = 0});
+        digit_cache.previews.assign(count * 28 * 28, 0);
+    }
+    hashes.resize(count);
+    size_t hits = 0;
+    size_t lookups = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (frame_jobs.digits[i] >= 0) {
+            continue;
+        }
+        lookups++;
+        hashes[i] = perceptual_hash_digit(frame_jobs.jobs[i].dst.preview);
+        const digit_cache_entry_t& entry = digit_cache.entries[i];
+        if (entry.digit >= 0 &&
+            perceptual_hash_same_digit(entry.hash, &digit_cache.previews[i * 28 * 28], hashes[i],
+                                       frame_jobs.jobs[i].dst.preview, config.cache_distance)) {
+            frame_jobs.digits[i] = entry.digit;
+            frame_jobs.scores[i] = entry.score;
+            frame_jobs.sources[i] = DIGIT_CACHE;
+            hits++;
+        }
+    }
+    digit_cache.hits += hits;
+    digit_cache.misses += lookups - hits;
+    return hits;
+}
+
+/**
+ * @brief Remember freshly classified digits with their hash
+ *
+ * Hits keep the hash and preview of the original classification, so slow
+ * drift still ends in a miss once it adds up.
+ */
+void storeCache(const frame_jobs_t& frame_jobs, const std::vector<uint64_t>& hashes) {
+    for (size_t i = 0; i < frame_jobs.digits.size(); i++) {
+        if (frame_jobs.sources[i] == DIGIT_MODEL || frame_jobs.sources[i] == DIGIT_TEMPLATE) {
+            digit_cache.entries[i] = {
+                .hash = hashes[i], .digit = frame_jobs.digits[i], .score = frame_jobs.scores[i]};
+            memcpy(&digit_cache.previews[i * 28 * 28], frame_jobs.jobs[i].dst.preview, 28 * 28);
+        }
+    }
+}
+
+/**
+ * @brief Learn templates from confident model results and update cascade statistics
+ *
+ * @param frame_jobs Classified digits of one reading
+ * @param reading Work of the reading
+ */
+void updateCascade(const frame_jobs_t& frame_jobs, const reading_stats_t& reading) {
+    size_t count = frame_jobs.digits.size();
+    size_t fast = reading.fast;
+    uint32_t match_us = reading.match_us;
+    uint32_t model_us = reading.model_us;
+    size_t slow = 0;
+    for (size_t i = 0; i < count; i++) {
+        // Template results are not learned again, that would only reinforce mistakes
+        if (frame_jobs.sources[i] == DIGIT_MODEL && frame_jobs.scores[i] >= CASCADE_LEARN_SCORE) {
+            template_set_learn(&digit_templates, frame_jobs.digits[i], frame_jobs.jobs[i].dst.preview);
+        }
+        slow += frame_jobs.sources[i] == DIGIT_MODEL;
+    }
+
+    cascade_stats_t& stats = cascade_stats;
+    if (slow > 0) {
+        float us_per_digit = (float)model_us / slow;
+        stats.model_us_per_digit = stats.model_us_per_digit == 0
+                                       ? us_per_digit
+                                       : stats.model_us_per_digit * 0.9f + us_per_digit * 0.1f;
+    }
+    stats.readings++;
+    stats.digits += fast + slow;
+    stats.fast_digits += fast;
+    stats.saved_us += fast * stats.model_us_per_digit - match_us;
+    stats.last_digits = count;
+    stats.last_fast_digits = fast;
+    stats.last_match_us = match_us;
+    stats.last_model_us = model_us;
+    READING_LOG("Cascade: %u of %u digits by template, matching %u us, model %u us\n",
+                (unsigned int)fast, (unsigned int)(fast + slow), match_us, model_us);
+}
+
+/**
+ * @brief Classify all digits still set to -1: digit cache, then templates, then the model
+ *
+ * @param frame_jobs Resampled digits
+ * @param hashes Hash of every digit looked up in the cache
+ * @param reading Work of the reading, accumulated
+ * @return true on success
+ */
+bool classifyDigits(frame_jobs_t& frame_jobs, std::vector<uint64_t>& hashes, reading_stats_t& reading) {
+    // Unchanged rectangles keep their digit, then confident template matches skip the model
+    uint32_t start = readingMicros();
+    reading.cached += config.cache ? lookupCache(frame_jobs, hashes) : 0;
+    reading.fast += config.cascade ? matchDigits(frame_jobs) : 0;
+    reading.match_us += readingMicros() - start;
+    start = readingMicros();
+    if (!inferDigits(interpreter.get(), frame_jobs)) {
+        return false;
+    }
+    reading.model_us += readingMicros() - start;
+    return true;
+}
+
+/**
+ * @brief Classify the digits of a mechanical counter from the least significant one
+ *
+ * A digit only moves when the one to its right rolls over, so a digit left of
+ * the rightmost is only classified after a carry or when its kept value is
+ * stale. Everything else keeps the value of the previous reading.
+ *
+ * @param frame_jobs Resampled digits, most significant first
+ * @param hashes Hash of every digit looked up in the cache
+ * @param reading Work of the reading, accumulated
+ * @return true on success
+ */
+bool readOdometer(frame_jobs_t& frame_jobs, std::vector<uint64_t>& hashes, reading_stats_t& reading) {
+    size_t count = frame_jobs.digits.size();
+    if (odometer.digits.size() != count) {
+        odometer.digits.assign(count, {.digit = -1, .score = 0, .age = 0});
+    }
+    // Stale digits stay -1 and are classified together with the rightmost one
+    for (size_t i = 0; i + 1 < count; i++) {
+        const odometer_digit_t& kept = odometer.digits[i];
+        if (kept.digit >= 0 && kept.score >= ODOMETER_MIN_SCORE && kept.age < config.odometer_refresh) {
+            frame_jobs.digits[i] = kept.digit;
+            frame_jobs.scores[i] = kept.score;
+            frame_jobs.sources[i] = DIGIT_KEPT;
+        }
+    }
+
+    bool carry = true;
+    for (size_t i = count; i-- > 0;) {
+        if (carry && frame_jobs.sources[i] == DIGIT_KEPT) {
+            frame_jobs.digits[i] = -1;
+            frame_jobs.sources[i] = DIGIT_MODEL;
+        }
+        if (frame_jobs.digits[i] < 0 && !classifyDigits(frame_jobs, hashes, reading)) {
+            return false;
+        }
+        odometer_digit_t& kept = odometer.digits[i];
+        if (frame_jobs.sources[i] == DIGIT_KEPT) {
+            kept.age++;
+            carry = false;
+            continue;
+        }
+        // Rolled over, e.g. 9 -> 0, so the next digit may have moved too
+        carry = kept.digit >= 0 && frame_jobs.digits[i] < kept.digit;
+        kept = {.digit = frame_jobs.digits[i], .score = frame_jobs.scores[i], .age = 0};
+        odometer.classified++;
+    }
+    odometer.readings++;
+    return true;
+}
+
+/**
+ * @brief Read all digits of given frame
+ *
+ * @param frame Grayscale frame
+ * @param with_previews Keep 8-bit previews of all digits in frame_jobs
+ * @param frame_jobs Filled with digits, scores and sources of all rectangles
+ * @param reading Filled with the work and the time of every stage
+ * @return true on success
+ */
+bool readFrame(const gray_frame_t* frame,
+               bool with_previews,
+               frame_jobs_t& frame_jobs,
+               reading_stats_t& reading) {
+    reading = {};
+    uint32_t start = readingMicros();
+    const integral_image_t* integral = buildIntegral(frame);
+    reading.integral_us = readingMicros() - start;
+
+    // Crop, resample and normalize all rectangles in one walk over the frame
+    start = readingMicros();
+    prepareJobs(frame, frame_jobs, with_previews, integral);
+    scale_multi_to_tensor(frame_jobs.jobs.data(), frame_jobs.jobs.size());
+    reading.scale_us = readingMicros() - start;
+
+    std::vector<uint64_t> hashes;
+    op_profiler.begin_reading();
+    bool success = config.odometer ? readOdometer(frame_jobs, hashes, reading)
+                                   : classifyDigits(frame_jobs, hashes, reading);
+    if (!success) {
+        return false;
+    }
+    op_profiler.end_reading();
+    if (config.cache) {
+        storeCache(frame_jobs, hashes);
+        READING_LOG("Digit cache: %u of %u digits unchanged\n", (unsigned int)reading.cached,
+                    (unsigned int)frame_jobs.digits.size());
+    }
+    if (config.cascade) {
+        updateCascade(frame_jobs, reading);
+    }
+    if (config.odometer) {
+        READING_LOG("Odometer: %.2f digits classified per reading\n",
+                    (float)odometer.classified / odometer.readings);
+    }
+    return true;
+}
+
+/**
+ * @brief Least confident model digit of a finished reading
+ *
+ * Only model probabilities share one scale. Template scores are match margins, cached and kept
+ * digits passed their own thresholds and would be reused unchanged by another capture.
+ */
+reading_confidence_t readingConfidence(const frame_jobs_t& frame_jobs) {
+    reading_confidence_t least = {.confidence = 1.0f, .position = 0, .runner_up = -1};
+    for (size_t i = 0; i < frame_jobs.scores.size(); i++) {
+        if (frame_jobs.sources[i] == DIGIT_MODEL && frame_jobs.scores[i] < least.confidence) {
+            least = {.confidence = frame_jobs.scores[i],
+                     .position = i,
+                     .runner_up = frame_jobs.runner_ups[i]};
+        }
+    }
+    return least;
+}
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <ArduinoJson.h>
+#include <memory>
+#include <vector>
+#include "digit_ranking.h"
+#include "dram_allocator.h"
+#include "generated_interpreter.h"
+#include "image_manipulation.h"
+#include "op_profiler.h"
+#include "template_matcher.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+
+/**
+ * Reading of all digits of a frame
+ *
+ * Resampling, digit cache, template cascade, odometer mode and the model, with
+ * the state they keep between readings. Nothing here depends on the camera or
+ * the web server, so the native build runs the same code on frames from files.
+ */
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#define READING_LOG(...) Serial.printf(__VA_ARGS__)
+#else
+#define READING_LOG(...) fprintf(stderr, __VA_ARGS__)
+#endif
+
+// Digits per Invoke(), the model input has this batch dimension
+#ifndef MODEL_BATCH
+#define MODEL_BATCH 1
+#endif
+#ifdef MODEL_GENERATED
+// Straight-line code from train/generate_inference.py instead of the interpreter
+typedef generated_interpreter_t model_interpreter_t;
+static_assert(MODEL_GENERATED_BATCH == MODEL_BATCH, "Regenerate model code for MODEL_BATCH");
+#else
+typedef tflite::MicroInterpreter model_interpreter_t;
+#endif
+// Generated code ends at the logits, interpreter builds check the model when it is loaded
+#if defined(MODEL_GENERATED) && MODEL_GENERATED_OUTPUT_LOGITS
+#define MODEL_OUTPUT_LOGITS 1
+#else
+#define MODEL_OUTPUT_LOGITS 0
+#endif
+// Activations grow with the batch, weights and bookkeeping do not
+#define ARENA_SIZE_FOR(batch) (1024 * 8 + (batch) * 1024 * 24)
+#define ARENA_SIZE ARENA_SIZE_FOR(MODEL_BATCH)
+// Templates are learned from model results with at least this probability
+#define CASCADE_LEARN_SCORE 0.9f
+// Kept digits below this score are classified again
+#define ODOMETER_MIN_SCORE 0.5f
+// Digit cells of a register window, bounds the remap tables
+#define WINDOW_MAX_DIGITS 16
+
+// Grayscale frame, a camera frame buffer on the device or a PGM file on the host
+struct gray_frame_t {
+    uint8_t* buf;
+    unsigned int width;
+    unsigned int height;
+};
+
+// Config structs
+struct rectangle_t {
+    unsigned int x;
+    unsigned int y;
+    unsigned int width;
+    unsigned int height;
+    float angle;      // Clockwise rotation around the center in degrees
+    bool has_matrix;  // Sample through matrix instead of the fields above
+    float matrix[6];  // Affine transform from output pixel to frame pixel
+};
+struct window_t {
+    bool enabled;
+    float corners[8];     // Corners of the register window, clockwise from top-left
+    unsigned int digits;  // Number of equal-width digit cells in the window
+};
+struct config_t {
+    std::vector<rectangle_t> rectangles;
+    window_t window;
+    // Resampling tables of digits, built once when the config is loaded
+    std::vector<scale_coefs_t, dram_allocator_t<scale_coefs_t>> coefs;
+    std::vector<uint32_t, dram_allocator_t<uint32_t>> remap_offsets;
+    std::vector<uint16_t, dram_allocator_t<uint16_t>> remap_weights;
+    // Some rectangles read box sums from the frame integral image
+    bool use_integral;
+    // Stretch contrast and normalize polarity of every digit
+    bool auto_contrast;
+    polarity_t polarity;
+    // Try learned digit templates first, run the model below this confidence
+    bool cascade;
+    float cascade_threshold;
+    // Reuse the last digit of a rectangle while its hash stays within this distance
+    bool cache;
+    int cache_distance;
+    // Read right to left, a digit is only classified after a carry or when its value is stale
+    bool odometer;
+    unsigned int odometer_refresh;  // Readings before a kept digit is classified again
+    // Softmax temperature of model confidences, the corpus report fits it
+    float confidence_temperature;
+    // Background readings with a less confident model digit are captured again instead of logged
+    float min_confidence;
+    unsigned int retries;
+};
+
+// Resampling jobs of all rectangles with their output buffers
+struct frame_jobs_t {
+    std::vector<scale_job_t> jobs;
+    std::vector<uint8_t> inputs;    // One input tensor worth of data per rectangle
+    std::vector<uint8_t> previews;  // 8-bit preview per rectangle, empty when not needed
+    std::vector<contrast_t> contrasts;  // Normalization per rectangle, empty when disabled
+    std::vector<int> digits;            // Recognized digit per rectangle, -1 until classified
+    std::vector<float> scores;          // Model or template confidence of each digit
+    std::vector<int> runner_ups;        // Second choice of the model, -1 when the model did not run
+    std::vector<float> logits;          // Logits relative to top1, RANKING_CLASSES per model digit
+    std::vector<uint8_t> sources;       // digit_source_t of each digit
+};
+
+// Where a digit of the current reading came from
+enum digit_source_t { DIGIT_MODEL, DIGIT_TEMPLATE, DIGIT_CACHE, DIGIT_KEPT };
+
+// Work of one reading, summed over all classification passes
+struct reading_stats_t {
+    size_t cached;
+    size_t fast;
+    uint32_t integral_us;
+    uint32_t scale_us;  // Resampling and normalization of all rectangles
+    uint32_t match_us;
+    uint32_t model_us;
+};
+
+// Least confident model digit of a reading
+struct reading_confidence_t {
+    float confidence;  // Lowest probability of all model digits, 1 without any
+    size_t position;
+    int runner_up;  // Second choice of the model at position, -1 when unknown
+};
+
+// Last value of one odometer position
+struct odometer_digit_t {
+    int digit;  // -1 when never classified
+    float score;
+    unsigned int age;  // Readings since it was last classified
+};
+struct odometer_t {
+    std::vector<odometer_digit_t> digits;
+    uint32_t readings;
+    uint32_t classified;  // Digits classified over all readings
+};
+
+// Last result of one rectangle, reused while its hash stays close
+struct digit_cache_entry_t {
+    uint64_t hash;
+    int digit;  // -1 when empty
+    float score;
+};
+struct digit_cache_t {
+    std::vector<digit_cache_entry_t> entries;
+    std::vector<uint8_t> previews;  // 28x28 preview of every entry, confirms hash hits
+    uint32_t hits;
+    uint32_t misses;
+};
+
+// Fast path counters of the template cascade
+struct cascade_stats_t {
+    uint32_t readings;
+    uint32_t digits;
+    uint32_t fast_digits;
+    float model_us_per_digit;  // Running mean of model time per digit
+    float saved_us;            // Model time avoided minus template matching time, all readings
+    // Last reading
+    uint32_t last_digits;
+    uint32_t last_fast_digits;
+    uint32_t last_match_us;
+    uint32_t last_model_us;
+};
+
+// State of the reading, kept between frames
+extern config_t config;
+extern std::unique_ptr<model_interpreter_t> interpreter;
+extern uint8_t* tensor_arena;
+extern tensor_lut_t input_lut;
+extern integral_image_t frame_integral;
+extern template_set_t digit_templates;
+extern cascade_stats_t cascade_stats;
+extern digit_cache_t digit_cache;
+extern odometer_t odometer;
+// Model output is logits to rank directly, otherwise softmax probabilities
+extern bool model_outputs_logits;
+// Cycles per operator of the interpreter, per Invoke() and per reading
+extern op_profiler_t op_profiler;
+
+/**
+ * @brief Microseconds of a free running clock
+ */
+uint32_t readingMicros();
+
+#ifndef MODEL_GENERATED
+const tflite::Model* firmwareModel();
+const tflite::MicroOpResolver& modelResolver();
+bool modelOutputsLogits(const tflite::Model* model);
+#endif
+bool modelTensorsFit(const TfLiteTensor* input, const TfLiteTensor* output);
+void initInputLut();
+config_t configFromJson(JsonDocument& doc, unsigned int frame_width, unsigned int frame_height);
+const integral_image_t* buildIntegral(const gray_frame_t* frame);
+void prepareJobs(const gray_frame_t* frame,
+                 frame_jobs_t& frame_jobs,
+                 bool with_previews,
+                 const integral_image_t* integral);
+bool inferDigits(model_interpreter_t* model_interpreter, frame_jobs_t& frame_jobs);
+size_t matchDigits(frame_jobs_t& frame_jobs);
+size_t lookupCache(frame_jobs_t& frame_jobs, std::vector<uint64_t>& hashes);
+void storeCache(const frame_jobs_t& frame_jobs, const std::vector<uint64_t>& hashes);
+void updateCascade(const frame_jobs_t& frame_jobs, const reading_stats_t& reading);
+bool classifyDigits(frame_jobs_t& frame_jobs, std::vector<uint64_t>& hashes, reading_stats_t& reading);
+bool readOdometer(frame_jobs_t& frame_jobs, std::vector<uint64_t>& hashes, reading_stats_t& reading);
+bool readFrame(const gray_frame_t* frame,
+               bool with_previews,
+               frame_jobs_t& frame_jobs,
+               reading_stats_t& reading);
+reading_confidence_t readingConfidence(const frame_jobs_t& frame_jobs);
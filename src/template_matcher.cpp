@@ -0,0 +1,75 @@
+#include "template_matcher.h"
+#include <string.h>
+
+void template_set_reset(template_set_t* set) {
+    memset(set->samples, 0, sizeof(set->samples));
+}
+
+/**
+ * @brief Blend a digit classified by the model into its template
+ */
+void template_set_learn(template_set_t* set, int digit, const uint8_t* pixels) {
+    if (digit < 0 || digit >= TEMPLATE_CLASSES) {
+        return;
+    }
+    uint8_t* mean = set->pixels[digit];
+    if (set->samples[digit] < TEMPLATE_MAX_WEIGHT) {
+        set->samples[digit]++;
+    }
+    const int weight = set->samples[digit];
+    if (weight == 1) {
+        memcpy(mean, pixels, TEMPLATE_PIXELS);
+        return;
+    }
+    for (int i = 0; i < TEMPLATE_PIXELS; i++) {
+        mean[i] = (mean[i] * (weight - 1) + pixels[i] + weight / 2) / weight;
+    }
+}
+
+/**
+ * @brief Closest learned template
+ *
+ * Confidence is the smaller of the margin to the second closest template,
+ * 1 - best / second, and the closeness 1 - mean difference / TEMPLATE_MAX_MEAN_DIFF.
+ *
+ * @param confidence Set to 0..1, 0 when no template is learned yet
+ * @return int Digit of the closest template, -1 when none is learned
+ */
+int template_set_match(const template_set_t* set, const uint8_t* pixels, float* confidence) {
+    int best = -1;
+    uint32_t best_distance = UINT32_MAX;
+    uint32_t second_distance = UINT32_MAX;
+    for (int digit = 0; digit < TEMPLATE_CLASSES; digit++) {
+        if (set->samples[digit] < TEMPLATE_MIN_SAMPLES) {
+            continue;
+        }
+        const uint8_t* mean = set->pixels[digit];
+        uint32_t distance = 0;
+        for (int i = 0; i < TEMPLATE_PIXELS && distance < second_distance; i++) {
+            distance += mean[i] > pixels[i] ? mean[i] - pixels[i] : pixels[i] - mean[i];
+        }
+        if (distance < best_distance) {
+            second_distance = best_distance;
+            best_distance = distance;
+            best = digit;
+        } else if (distance < second_distance) {
+            second_distance = distance;
+        }
+    }
+    *confidence = 0;
+    if (best < 0) {
+        return -1;
+    }
+    float closeness = 1.0f - (float)best_distance / (TEMPLATE_PIXELS * TEMPLATE_MAX_MEAN_DIFF);
+    float margin = 1.0f;
+    if (second_distance == 0) {
+        margin = 0;  // Two identical templates
+    } else if (second_distance != UINT32_MAX) {
+        margin = 1.0f - (float)best_distance / second_distance;
+    }
+    *confidence = closeness < margin ? closeness : margin;
+    if (*confidence < 0) {
+        *confidence = 0;
+    }
+    return best;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdint.h>
+
+#define TEMPLATE_CLASSES 10
+#define TEMPLATE_PIXELS (28 * 28)
+// Samples of a digit before its template takes part in matching
+#define TEMPLATE_MIN_SAMPLES 3
+// Weight of a new sample is 1 / min(samples, TEMPLATE_MAX_WEIGHT)
+#define TEMPLATE_MAX_WEIGHT 8
+// Mean absolute pixel difference at which a match has no confidence left
+#define TEMPLATE_MAX_MEAN_DIFF 32
+
+/**
+ * @brief Running mean image of every digit, learned from classified 28x28 previews
+ *
+ * Meter digits come from one font, so once a few readings went through the
+ * model each digit is recognized again by its sum of absolute differences.
+ */
+typedef struct {
+    uint8_t pixels[TEMPLATE_CLASSES][TEMPLATE_PIXELS];
+    uint16_t samples[TEMPLATE_CLASSES];
+} template_set_t;
+
+void template_set_reset(template_set_t* set);
+void template_set_learn(template_set_t* set, int digit, const uint8_t* pixels);
+int template_set_match(const template_set_t* set, const uint8_t* pixels, float* confidence);
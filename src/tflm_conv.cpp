@@ -0,0 +1,132 @@
+#include "tflm_conv.h"
+
+#include "kernels.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/kernels/internal/tensor_ctypes.h"
+#include "tensorflow/lite/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+#include "tensorflow/lite/micro/kernels/micro_ops.h"
+
+namespace {
+
+TfLiteRegistration reference;
+
+typedef struct {
+    void* reference;  // user_data of the reference kernel
+    bool specialized;
+    conv_params_t params;
+    int32_t* folded_bias;
+    int32_t* multipliers;
+    int32_t* shifts;
+} op_data_t;
+
+void* init(TfLiteContext* context, const char* buffer, size_t length) {
+    op_data_t* data = (op_data_t*)context->AllocatePersistentBuffer(context, sizeof(op_data_t));
+    if (data == nullptr) {
+        return nullptr;
+    }
+    data->reference = reference.init(context, buffer, length);
+    data->specialized = false;
+    return data;
+}
+
+/**
+ * @brief Same requantization parameters as PopulateConvolutionQuantizationParams()
+ */
+TfLiteStatus prepare_specialized(TfLiteContext* context, TfLiteNode* node, op_data_t* data) {
+    const TfLiteConvParams* options = (const TfLiteConvParams*)node->builtin_data;
+    const TfLiteTensor* input = tflite::GetInput(context, node, 0);
+    const TfLiteTensor* filter = tflite::GetInput(context, node, 1);
+    const TfLiteTensor* bias = node->inputs->size > 2 ? tflite::GetInput(context, node, 2) : nullptr;
+    TfLiteTensor* output = tflite::GetOutput(context, node, 0);
+    if (input->type != kTfLiteInt8 || filter->type != kTfLiteInt8 ||
+        options->padding != kTfLitePaddingValid || options->dilation_width_factor != 1 ||
+        options->dilation_height_factor != 1) {
+        return kTfLiteOk;
+    }
+
+    conv_params_t* p = &data->params;
+    p->batches = input->dims->data[0];
+    p->input_h = input->dims->data[1];
+    p->input_w = input->dims->data[2];
+    p->input_c = input->dims->data[3];
+    p->filter_h = filter->dims->data[1];
+    p->filter_w = filter->dims->data[2];
+    p->output_h = output->dims->data[1];
+    p->output_w = output->dims->data[2];
+    p->output_c = output->dims->data[3];
+    p->stride_h = options->stride_height;
+    p->stride_w = options->stride_width;
+    p->pad_h = 0;
+    p->pad_w = 0;
+    p->input_offset = -input->params.zero_point;
+    p->output_offset = output->params.zero_point;
+    if (!kernel_conv2d_has_specialized(p)) {
+        return kTfLiteOk;
+    }
+    TF_LITE_ENSURE_STATUS(tflite::CalculateActivationRangeQuantized(
+        context, options->activation, output, &p->act_min, &p->act_max));
+
+    const int channels = p->output_c;
+    data->multipliers = (int32_t*)context->AllocatePersistentBuffer(context, channels * sizeof(int32_t));
+    data->shifts = (int32_t*)context->AllocatePersistentBuffer(context, channels * sizeof(int32_t));
+    data->folded_bias = (int32_t*)context->AllocatePersistentBuffer(context, channels * sizeof(int32_t));
+    TF_LITE_ENSURE(context, data->multipliers && data->shifts && data->folded_bias);
+
+    const TfLiteAffineQuantization* quantization =
+        (const TfLiteAffineQuantization*)filter->quantization.params;
+    TF_LITE_ENSURE(context, quantization != nullptr && quantization->scale != nullptr);
+    const bool per_channel = quantization->scale->size > 1;
+    for (int c = 0; c < channels; c++) {
+        const double filter_scale = quantization->scale->data[per_channel ? c : 0];
+        const double multiplier = (double)input->params.scale * filter_scale / (double)output->params.scale;
+        int shift;
+        tflite::QuantizeMultiplier(multiplier, &data->multipliers[c], &shift);
+        data->shifts[c] = shift;
+    }
+    p->multipliers = data->multipliers;
+    p->shifts = data->shifts;
+
+    kernel_conv2d_fold_bias(p, tflite::GetTensorData<int8_t>(filter),
+                            bias ? tflite::GetTensorData<int32_t>(bias) : nullptr, data->folded_bias);
+    data->specialized = true;
+    return kTfLiteOk;
+}
+
+TfLiteStatus prepare(TfLiteContext* context, TfLiteNode* node) {
+    op_data_t* data = (op_data_t*)node->user_data;
+    node->user_data = data->reference;
+    const TfLiteStatus status = reference.prepare(context, node);
+    node->user_data = data;
+    TF_LITE_ENSURE_STATUS(status);
+    return prepare_specialized(context, node, data);
+}
+
+TfLiteStatus invoke(TfLiteContext* context, TfLiteNode* node) {
+    op_data_t* data = (op_data_t*)node->user_data;
+    if (!data->specialized) {
+        node->user_data = data->reference;
+        const TfLiteStatus status = reference.invoke(context, node);
+        node->user_data = data;
+        return status;
+    }
+    const TfLiteEvalTensor* input = tflite::micro::GetEvalInput(context, node, 0);
+    const TfLiteEvalTensor* filter = tflite::micro::GetEvalInput(context, node, 1);
+    TfLiteEvalTensor* output = tflite::micro::GetEvalOutput(context, node, 0);
+    kernel_conv2d_specialized_int8(&data->params, tflite::micro::GetTensorData<int8_t>(input),
+                                   tflite::micro::GetTensorData<int8_t>(filter), data->folded_bias,
+                                   tflite::micro::GetTensorData<int8_t>(output));
+    return kTfLiteOk;
+}
+
+}  // namespace
+
+TfLiteRegistration conv2d_specialized_registration() {
+    reference = tflite::Register_CONV_2D();
+    TfLiteRegistration registration = reference;
+    registration.init = init;
+    registration.prepare = prepare;
+    registration.invoke = invoke;
+    return registration;
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "tensorflow/lite/c/common.h"
+
+/**
+ * @brief CONV_2D registration running the specialized kernels of kernels.h
+ *
+ * Wraps the reference CONV_2D of TFLM: layers matching
+ * kernel_conv2d_has_specialized() run the hand-tuned kernels with the bias
+ * folded at prepare time, everything else is forwarded to the reference.
+ * Register with resolver.AddConv2D(conv2d_specialized_registration()).
+ */
+TfLiteRegistration conv2d_specialized_registration();
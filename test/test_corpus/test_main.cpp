@@ -0,0 +1,117 @@
+#include <stdio.h>
+#include <unity.h>
+#include "corpus.h"
+
+// Checked-in set of synthetic frames, tests run from the project directory
+static const char* root = "test/corpus";
+
+void test_correct_digits() {
+    TEST_ASSERT_EQUAL(5, corpusCorrectDigits("01234", "01234"));
+    TEST_ASSERT_EQUAL(3, corpusCorrectDigits("01234", "91284"));
+    // A missed or extra rectangle shifts every digit, nothing counts as read
+    TEST_ASSERT_EQUAL(0, corpusCorrectDigits("01234", "0123"));
+    TEST_ASSERT_EQUAL(0, corpusCorrectDigits("01234", ""));
+}
+
+void test_percentile() {
+    std::vector<uint32_t> values;
+    for (uint32_t i = 20; i >= 1; i--) {
+        values.push_back(i * 10);
+    }
+    TEST_ASSERT_EQUAL(100, corpusPercentile(values, 50));
+    TEST_ASSERT_EQUAL(190, corpusPercentile(values, 95));
+    TEST_ASSERT_EQUAL(200, corpusPercentile(values, 100));
+    TEST_ASSERT_EQUAL(10, corpusPercentile(values, 0));
+    TEST_ASSERT_EQUAL(0, corpusPercentile(std::vector<uint32_t>(), 50));
+}
+
+void test_load() {
+    std::vector<corpus_set_t> sets;
+    TEST_ASSERT_TRUE(corpusLoad(root, sets));
+    TEST_ASSERT_EQUAL(1, sets.size());
+    TEST_ASSERT_EQUAL_STRING("counter", sets[0].name.c_str());
+    TEST_ASSERT_EQUAL(5, sets[0].frames.size());
+    TEST_ASSERT_EQUAL_STRING("frame_01.pgm", sets[0].frames[0].file.c_str());
+    TEST_ASSERT_EQUAL_STRING("0123", sets[0].frames[0].truth.c_str());
+
+    // A set directory is a corpus of its own
+    std::vector<corpus_set_t> set;
+    TEST_ASSERT_TRUE(corpusLoad("test/corpus/counter/", set));
+    TEST_ASSERT_EQUAL(1, set.size());
+    TEST_ASSERT_EQUAL_STRING("counter", set[0].name.c_str());
+    TEST_ASSERT_EQUAL(5, set[0].frames.size());
+
+    std::vector<corpus_set_t> missing;
+    TEST_ASSERT_FALSE(corpusLoad("test/corpus/missing", missing));
+    TEST_ASSERT_TRUE(missing.empty());
+}
+
+/**
+ * @brief Replay sets and parse the report
+ */
+static void run(const std::vector<corpus_set_t>& sets, JsonDocument& report) {
+    FILE* file = tmpfile();
+    TEST_ASSERT_NOT_NULL(file);
+    TEST_ASSERT_TRUE(corpusRun(sets, file));
+    rewind(file);
+    std::string text;
+    char chunk[1024];
+    size_t length;
+    while ((length = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        text.append(chunk, length);
+    }
+    fclose(file);
+    TEST_ASSERT_FALSE(deserializeJson(report, text));
+}
+
+void test_run() {
+    tensor_arena = (uint8_t*)malloc(ARENA_SIZE);
+#ifdef MODEL_GENERATED
+    interpreter.reset(new generated_interpreter_t());
+#else
+    interpreter.reset(new tflite::MicroInterpreter(firmwareModel(), modelResolver(), tensor_arena,
+                                                   ARENA_SIZE, nullptr, &op_profiler));
+    model_outputs_logits = modelOutputsLogits(firmwareModel());
+#endif
+    TEST_ASSERT_EQUAL(kTfLiteOk, interpreter->AllocateTensors());
+    initInputLut();
+
+    std::vector<corpus_set_t> sets;
+    TEST_ASSERT_TRUE(corpusLoad(root, sets));
+    DynamicJsonDocument report(16384);
+    run(sets, report);
+    TEST_ASSERT_EQUAL(5, report["frames"].as<int>());
+    TEST_ASSERT_EQUAL(20, report["digits"].as<int>());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f, report["digit_accuracy"].as<float>());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f, report["reading_accuracy"].as<float>());
+    // No cascade or cache, the model reads every digit
+    TEST_ASSERT_EQUAL(20, report["model_digits"].as<int>());
+    TEST_ASSERT_GREATER_THAN(0.0f, report["confidence_temperature"].as<float>());
+    TEST_ASSERT_EQUAL_STRING("counter", report["sets"][0]["name"].as<const char*>());
+    TEST_ASSERT_TRUE(report["sets"][0]["errors"].isNull());
+    for (const char* stage : {"integral", "scale", "match", "model", "total"}) {
+        JsonObject latency = report["latency_us"][stage];
+        TEST_ASSERT_FALSE(latency.isNull());
+        TEST_ASSERT_LESS_OR_EQUAL(latency["p95"].as<uint32_t>(), latency["p50"].as<uint32_t>());
+    }
+
+    // A wrong truth shows up as an error with what was read
+    sets[0].frames[1].truth = "2346";
+    report.clear();
+    run(sets, report);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 19.0f / 20, report["digit_accuracy"].as<float>());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 4.0f / 5, report["reading_accuracy"].as<float>());
+    JsonArray errors = report["sets"][0]["errors"];
+    TEST_ASSERT_EQUAL(1, errors.size());
+    TEST_ASSERT_EQUAL_STRING("frame_02.pgm", errors[0]["frame"].as<const char*>());
+    TEST_ASSERT_EQUAL_STRING("2345", errors[0]["read"].as<const char*>());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_correct_digits);
+    RUN_TEST(test_percentile);
+    RUN_TEST(test_load);
+    RUN_TEST(test_run);
+    return UNITY_END();
+}
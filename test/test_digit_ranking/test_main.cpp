@@ -0,0 +1,104 @@
+#include <math.h>
+#include <unity.h>
+#include "digit_ranking.h"
+
+void test_top_two() {
+    const int8_t logits[RANKING_CLASSES] = {-20, 5, 40, -3, 12, 39, 0, -128, 7, 1};
+    digit_ranking_t ranking;
+    digit_ranking_logits_int8(logits, 0.25f, 1.0f, &ranking);
+    TEST_ASSERT_EQUAL(2, ranking.top1);
+    TEST_ASSERT_EQUAL(5, ranking.top2);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.25f, ranking.margin);
+}
+
+void test_flat_output_is_not_confident() {
+    // All-zero output of a broken model, used to pass as digit 0 with score 0 hidden by max 0
+    const float probabilities[RANKING_CLASSES] = {};
+    digit_ranking_t ranking;
+    digit_ranking_probabilities_float(probabilities, 1.0f, &ranking);
+    TEST_ASSERT_EQUAL(0, ranking.top1);
+    TEST_ASSERT_EQUAL(1, ranking.top2);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, ranking.margin);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.1f, ranking.confidence);
+
+    const int8_t logits[RANKING_CLASSES] = {-4, -4, -4, -4, -4, -4, -4, -4, -4, -4};
+    digit_ranking_logits_int8(logits, 0.5f, 1.0f, &ranking);
+    TEST_ASSERT_EQUAL(0, ranking.top1);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.1f, ranking.confidence);
+}
+
+void test_confidence_is_softmax_of_logits() {
+    const int8_t logits[RANKING_CLASSES] = {10, 2, 2, 2, 2, 2, 2, 2, 2, 2};
+    const float scale = 0.5f;
+    digit_ranking_t ranking;
+    digit_ranking_logits_int8(logits, scale, 1.0f, &ranking);
+    float expected = 1.0f / (1.0f + 9 * expf(-8 * scale));
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, expected, ranking.confidence);
+
+    // Higher temperature spreads the probability, the ranking stays
+    digit_ranking_logits_int8(logits, scale, 2.0f, &ranking);
+    TEST_ASSERT_EQUAL(0, ranking.top1);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, 1.0f / (1.0f + 9 * expf(-8 * scale / 2)), ranking.confidence);
+
+    // Dequantized logits of a float output model rank the same
+    float dequantized[RANKING_CLASSES];
+    for (int i = 0; i < RANKING_CLASSES; i++) {
+        dequantized[i] = (logits[i] + 3) * scale;
+    }
+    digit_ranking_logits_float(dequantized, 1.0f, &ranking);
+    TEST_ASSERT_EQUAL(0, ranking.top1);
+    TEST_ASSERT_FLOAT_WITHIN(1e-5f, expected, ranking.confidence);
+}
+
+void test_probabilities_keep_their_value() {
+    const float probabilities[RANKING_CLASSES] = {0.02f, 0.0f, 0.03f, 0.9f, 0.0f, 0.05f, 0, 0, 0, 0};
+    digit_ranking_t ranking;
+    digit_ranking_probabilities_float(probabilities, 1.0f, &ranking);
+    TEST_ASSERT_EQUAL(3, ranking.top1);
+    TEST_ASSERT_EQUAL(5, ranking.top2);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 0.9f, ranking.confidence);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, logf(0.9f / 0.05f), ranking.margin);
+
+    // Softmax output quantized with scale 1/256 and zero point -128
+    const int8_t quantized[RANKING_CLASSES] = {-123, -128, -120, 102, -128, -115, -128, -128, -128, -128};
+    digit_ranking_probabilities_int8(quantized, -128, 1.0f, &ranking);
+    TEST_ASSERT_EQUAL(3, ranking.top1);
+    TEST_ASSERT_EQUAL(5, ranking.top2);
+    // Six empty classes count half a step each
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 230.0f / (5 + 8 + 230 + 13 + 6 * 0.5f), ranking.confidence);
+}
+
+void test_fit_temperature() {
+    // Top1 ahead of one other class by 4, right in 8 of 10 samples
+    float relative[10 * RANKING_CLASSES];
+    int labels[10];
+    for (int n = 0; n < 10; n++) {
+        for (int i = 0; i < RANKING_CLASSES; i++) {
+            relative[n * RANKING_CLASSES + i] = -100.0f;
+        }
+        relative[n * RANKING_CLASSES + 3] = 0.0f;
+        relative[n * RANKING_CLASSES + 8] = -4.0f;
+        labels[n] = n < 8 ? 3 : 8;
+    }
+    // Maximum likelihood gives top1 probability 0.8, so 4 / T = log(0.8 / 0.2)
+    float temperature = digit_ranking_fit_temperature(relative, labels, 10);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 4.0f / logf(4.0f), temperature);
+
+    // The fitted temperature reproduces the observed accuracy
+    const int8_t logits[RANKING_CLASSES] = {-128, -128, -128, 0, -128, -128, -128, -128, -4, -128};
+    digit_ranking_t ranking;
+    digit_ranking_logits_int8(logits, 1.0f, temperature, &ranking);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 0.8f, ranking.confidence);
+
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 1.0f, digit_ranking_fit_temperature(relative, labels, 0));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_top_two);
+    RUN_TEST(test_flat_output_is_not_confident);
+    RUN_TEST(test_confidence_is_softmax_of_logits);
+    RUN_TEST(test_probabilities_keep_their_value);
+    RUN_TEST(test_fit_temperature);
+    return UNITY_END();
+}
@@ -0,0 +1,273 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+#include <unity.h>
+#include "kernels.h"
+
+#define ITERATIONS 200
+
+/**
+ * @brief Random layer of given shape, requantization similar to the TMNIST model
+ */
+struct conv_layer_t {
+    conv_params_t params;
+    int8_t* input;
+    int8_t* filter;
+    int32_t* bias;
+    int32_t* folded_bias;
+    int32_t* multipliers;
+    int32_t* shifts;
+
+    conv_layer_t(int input_h, int input_w, int input_c, int filter_size, int output_c) {
+        params = {};
+        params.batches = 1;
+        params.input_h = input_h;
+        params.input_w = input_w;
+        params.input_c = input_c;
+        params.filter_h = filter_size;
+        params.filter_w = filter_size;
+        params.output_h = input_h - filter_size + 1;
+        params.output_w = input_w - filter_size + 1;
+        params.output_c = output_c;
+        params.stride_h = 1;
+        params.stride_w = 1;
+        params.input_offset = 128;
+        params.output_offset = -128;
+        params.act_min = -128;
+        params.act_max = 127;
+
+        int filter_bytes = output_c * filter_size * filter_size * input_c;
+        input = new int8_t[input_h * input_w * input_c];
+        filter = new int8_t[filter_bytes];
+        bias = new int32_t[output_c];
+        folded_bias = new int32_t[output_c];
+        multipliers = new int32_t[output_c];
+        shifts = new int32_t[output_c];
+        for (int i = 0; i < input_h * input_w * input_c; i++) {
+            input[i] = rand() % 256 - 128;
+        }
+        for (int i = 0; i < filter_bytes; i++) {
+            filter[i] = rand() % 256 - 128;
+        }
+        for (int i = 0; i < output_c; i++) {
+            bias[i] = rand() % 20000 - 10000;
+            multipliers[i] = (1 << 30) + rand() % (1 << 30);
+            shifts[i] = -(8 + rand() % 4);
+        }
+        params.multipliers = multipliers;
+        params.shifts = shifts;
+        kernel_conv2d_fold_bias(&params, filter, bias, folded_bias);
+    }
+
+    int output_size() const { return params.output_h * params.output_w * params.output_c; }
+};
+
+static void check_layer(const char* name, conv_layer_t& layer) {
+    TEST_ASSERT_TRUE(kernel_conv2d_has_specialized(&layer.params));
+    int8_t* reference = new int8_t[layer.output_size()];
+    int8_t* specialized = new int8_t[layer.output_size()];
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++) {
+        kernel_conv2d_int8(&layer.params, layer.input, layer.filter, layer.bias, reference);
+    }
+    auto middle = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++) {
+        kernel_conv2d_specialized_int8(&layer.params, layer.input, layer.filter, layer.folded_bias,
+                                       specialized);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    printf("%s: reference %lld ns, specialized %lld ns\n", name,
+           (long long)std::chrono::duration_cast<std::chrono::nanoseconds>(middle - start).count() /
+               ITERATIONS,
+           (long long)std::chrono::duration_cast<std::chrono::nanoseconds>(end - middle).count() /
+               ITERATIONS);
+    TEST_ASSERT_EQUAL_INT8_ARRAY(reference, specialized, layer.output_size());
+    delete[] reference;
+    delete[] specialized;
+}
+
+void test_conv_4x4x1() {
+    conv_layer_t layer(28, 28, 1, 4, 32);
+    check_layer("conv 4x4x1->32", layer);
+}
+
+void test_conv_3x3x32() {
+    conv_layer_t layer(12, 12, 32, 3, 64);
+    check_layer("conv 3x3x32->64", layer);
+}
+
+static void check_fused(conv_layer_t& layer, bool specialized) {
+    conv_params_t params = layer.params;
+    if (!specialized) {
+        params.stride_w = 2;  // Not specialized, runs the reference convolution
+        params.output_w = (params.input_w - params.filter_w) / 2 + 1;
+    }
+    pool_params_t pool = {};
+    pool.batches = 1;
+    pool.input_h = params.output_h;
+    pool.input_w = params.output_w;
+    pool.channels = params.output_c;
+    pool.filter_h = 2;
+    pool.filter_w = 2;
+    pool.output_h = params.output_h / 2;
+    pool.output_w = params.output_w / 2;
+    pool.stride_h = 2;
+    pool.stride_w = 2;
+    pool.act_min = -128;
+    pool.act_max = 127;
+    TEST_ASSERT_TRUE(kernel_conv2d_pool_can_fuse(&params, &pool));
+    TEST_ASSERT_EQUAL(specialized, kernel_conv2d_has_specialized(&params));
+
+    const int conv_size = params.output_h * params.output_w * params.output_c;
+    const int pool_size = pool.output_h * pool.output_w * pool.channels;
+    int8_t* conv_output = new int8_t[conv_size];
+    int8_t* reference = new int8_t[pool_size];
+    int8_t* fused = new int8_t[pool_size];
+    int8_t* scratch = new int8_t[kernel_conv2d_pool_scratch_size(&params, &pool)];
+    kernel_conv2d_int8(&params, layer.input, layer.filter, layer.bias, conv_output);
+    kernel_max_pool_int8(&pool, conv_output, reference);
+    kernel_conv2d_pool_int8(&params, &pool, layer.input, layer.filter,
+                            specialized ? layer.folded_bias : layer.bias, scratch, fused);
+    TEST_ASSERT_EQUAL_INT8_ARRAY(reference, fused, pool_size);
+    delete[] conv_output;
+    delete[] reference;
+    delete[] fused;
+    delete[] scratch;
+}
+
+void test_conv_pool_fused() {
+    conv_layer_t first(28, 28, 1, 4, 32);
+    check_fused(first, true);
+    check_fused(first, false);
+    conv_layer_t second(12, 12, 32, 3, 64);
+    check_fused(second, true);
+    check_fused(second, false);
+}
+
+/**
+ * @brief Batched dense layer, tiles of digits sharing each weight row vs one digit at a time
+ */
+void test_fully_connected_batches() {
+    const int input_size = 300, output_size = 24, batches = KERNEL_FC_BATCH_TILE + 3;
+    fully_connected_params_t params = {};
+    params.batches = batches;
+    params.input_size = input_size;
+    params.output_size = output_size;
+    params.input_offset = 128;
+    params.filter_offset = 3;
+    params.output_offset = -128;
+    params.multiplier = 1500000000;
+    params.shift = -8;
+    params.act_min = -128;
+    params.act_max = 127;
+
+    std::vector<int8_t> input(batches * input_size), filter(output_size * input_size);
+    std::vector<int32_t> bias(output_size);
+    for (auto& value : input) {
+        value = rand() % 256 - 128;
+    }
+    for (auto& value : filter) {
+        value = rand() % 255 - 127;
+    }
+    for (auto& value : bias) {
+        value = rand() % 20000 - 10000;
+    }
+
+    std::vector<int8_t> reference(batches * output_size), result(batches * output_size);
+    fully_connected_params_t single = params;
+    single.batches = 1;
+    for (int batch = 0; batch < batches; batch++) {
+        kernel_fully_connected_int8(&single, &input[batch * input_size], filter.data(), bias.data(),
+                                    &reference[batch * output_size]);
+    }
+    kernel_fully_connected_int8(&params, input.data(), filter.data(), bias.data(), result.data());
+    TEST_ASSERT_EQUAL_INT8_ARRAY(reference.data(), result.data(), reference.size());
+}
+
+/**
+ * @brief Dense layer of the TMNIST shape with 90% of the weights zero, sparse vs dense kernel
+ */
+void test_fully_connected_sparse() {
+    const int input_size = 1600, output_size = 128;
+    fully_connected_params_t params = {};
+    params.batches = 2;
+    params.input_size = input_size;
+    params.output_size = output_size;
+    params.input_offset = 128;
+    params.output_offset = -128;
+    params.multiplier = 1500000000;
+    params.shift = -10;
+    params.act_min = -128;
+    params.act_max = 127;
+
+    std::vector<int8_t> input(params.batches * input_size);
+    std::vector<int8_t> dense(output_size * input_size);
+    std::vector<int32_t> bias(output_size), folded_bias(output_size);
+    for (auto& value : input) {
+        value = rand() % 256 - 128;
+    }
+    for (int i = 0; i < output_size * input_size; i++) {
+        // Last rows have long empty runs to exercise the gap bridging
+        const int keep = i / input_size < output_size - 4 ? 10 : 300;
+        dense[i] = rand() % keep == 0 ? rand() % 255 - 127 : 0;
+    }
+
+    std::vector<int8_t> values;
+    std::vector<uint8_t> steps;
+    std::vector<uint16_t> lengths(output_size);
+    for (int out_c = 0; out_c < output_size; out_c++) {
+        bias[out_c] = rand() % 20000 - 10000;
+        folded_bias[out_c] = bias[out_c];
+        const size_t start = values.size();
+        int previous = 0;
+        for (int col = 0; col < input_size; col++) {
+            const int8_t value = dense[out_c * input_size + col];
+            if (!value) {
+                continue;
+            }
+            folded_bias[out_c] += value * params.input_offset;
+            for (; col - previous > 255; previous += 255) {
+                values.push_back(0);
+                steps.push_back(255);
+            }
+            values.push_back(value);
+            steps.push_back(col - previous);
+            previous = col;
+        }
+        lengths[out_c] = values.size() - start;
+    }
+    const sparse_matrix_t sparse = {values.data(), steps.data(), lengths.data()};
+
+    std::vector<int8_t> reference(params.batches * output_size), result(params.batches * output_size);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++) {
+        kernel_fully_connected_int8(&params, input.data(), dense.data(), bias.data(), reference.data());
+    }
+    auto middle = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++) {
+        kernel_fully_connected_sparse_int8(&params, input.data(), &sparse, folded_bias.data(),
+                                           result.data());
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    printf("fully connected 1600->128, %u of %u weights: dense %lld ns, sparse %lld ns\n",
+           (unsigned int)values.size(), (unsigned int)dense.size(),
+           (long long)std::chrono::duration_cast<std::chrono::nanoseconds>(middle - start).count() /
+               ITERATIONS,
+           (long long)std::chrono::duration_cast<std::chrono::nanoseconds>(end - middle).count() /
+               ITERATIONS);
+    TEST_ASSERT_EQUAL_INT8_ARRAY(reference.data(), result.data(), reference.size());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_conv_4x4x1);
+    RUN_TEST(test_conv_3x3x32);
+    RUN_TEST(test_conv_pool_fused);
+    RUN_TEST(test_fully_connected_batches);
+    RUN_TEST(test_fully_connected_sparse);
+    return UNITY_END();
+}
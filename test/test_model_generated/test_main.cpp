@@ -0,0 +1,121 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unity.h>
+#include "generated_interpreter.h"
+#include "kernels.h"
+#include "model_data.h"
+#include "model_generated.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+#define ARENA_SIZE 1024 * 32
+#define SAMPLES 64
+
+static uint8_t tensor_arena[ARENA_SIZE];
+
+/**
+ * @brief Fill both inputs with the same pseudo-random image
+ *
+ * Smooth blobs plus noise, so activations do not all saturate.
+ */
+static void fill_input(TfLiteTensor* input, unsigned int seed) {
+    srand(seed);
+    int cx = rand() % 28, cy = rand() % 28, radius = 3 + rand() % 10;
+    model_generated_input_t* generated = model_generated_input();
+    for (int i = 0; i < MODEL_GENERATED_INPUT_SIZE; i++) {
+        int dx = i % 28 - cx, dy = i / 28 - cy;
+        int value = dx * dx + dy * dy < radius * radius ? 200 : 20;
+        value += rand() % 56;
+        input->data.f[i] = value / 255.0f;
+        generated[i] = value / 255.0f;
+    }
+}
+
+static const tflite::MicroOpResolver& resolver() {
+    static tflite::MicroMutableOpResolver<8> resolver;
+    static bool registered = false;
+    if (!registered) {
+        resolver.AddReadVariable();
+        resolver.AddQuantize();
+        resolver.AddFullyConnected();
+        resolver.AddSoftmax();
+        resolver.AddDequantize();
+        resolver.AddConv2D();
+        resolver.AddMaxPool2D();
+        resolver.AddReshape();
+        registered = true;
+    }
+    return resolver;
+}
+
+/**
+ * @brief Output of the full model from the generated code
+ *
+ * Generated code ends at the logits, the Softmax and Dequantize it leaves out
+ * are applied here with the parameters TFLM computes for them.
+ */
+static void generated_probabilities(float* probabilities) {
+#if MODEL_GENERATED_OUTPUT_LOGITS
+    softmax_params_t params = {.batches = 1, .size = MODEL_GENERATED_OUTPUT_SIZE};
+    int left_shift;
+    tflite::PreprocessSoftmaxScaling(1.0, MODEL_GENERATED_OUTPUT_SCALE, 5, &params.input_multiplier,
+                                     &left_shift);
+    params.input_left_shift = left_shift;
+    params.diff_min = -tflite::CalculateInputRadius(5, left_shift);
+    int8_t softmax[MODEL_GENERATED_OUTPUT_SIZE];
+    kernel_softmax_int8(&params, model_generated_output(), softmax);
+    kernel_dequantize_int8(softmax, probabilities, MODEL_GENERATED_OUTPUT_SIZE, 1.0f / 256, -128);
+#else
+    memcpy(probabilities, model_generated_output(), MODEL_GENERATED_OUTPUT_SIZE * sizeof(float));
+#endif
+}
+
+void test_outputs_bit_exact() {
+    const tflite::Model* model = tflite::GetModel(tmnist_model_tflite);
+    tflite::MicroInterpreter interpreter(model, resolver(), tensor_arena, ARENA_SIZE);
+    TEST_ASSERT_EQUAL(kTfLiteOk, interpreter.AllocateTensors());
+    TfLiteTensor* input = interpreter.input(0);
+    TfLiteTensor* output = interpreter.output(0);
+    TEST_ASSERT_EQUAL(kTfLiteFloat32, input->type);
+    TEST_ASSERT_EQUAL(MODEL_GENERATED_INPUT_SIZE * sizeof(model_generated_input_t), input->bytes);
+    TEST_ASSERT_EQUAL(MODEL_GENERATED_OUTPUT_SIZE * sizeof(float), output->bytes);
+
+    for (unsigned int sample = 0; sample < SAMPLES; sample++) {
+        fill_input(input, sample);
+        TEST_ASSERT_EQUAL(kTfLiteOk, interpreter.Invoke());
+        model_generated_invoke();
+        float probabilities[MODEL_GENERATED_OUTPUT_SIZE];
+        generated_probabilities(probabilities);
+        TEST_ASSERT_EQUAL_MEMORY(output->data.raw, probabilities, output->bytes);
+    }
+}
+
+/**
+ * @brief Fused convolution and pooling never hold the 25x25x32 activation
+ */
+void test_arena_used_bytes() {
+    const tflite::Model* model = tflite::GetModel(tmnist_model_tflite);
+    tflite::MicroInterpreter interpreter(model, resolver(), tensor_arena, ARENA_SIZE);
+    TEST_ASSERT_EQUAL(kTfLiteOk, interpreter.AllocateTensors());
+    generated_interpreter_t generated;
+    TEST_ASSERT_EQUAL(kTfLiteOk, generated.AllocateTensors());
+
+    char message[96];
+    snprintf(message, sizeof(message), "arena used: interpreter %u bytes, generated %u bytes",
+             (unsigned int)interpreter.arena_used_bytes(), (unsigned int)generated.arena_used_bytes());
+    TEST_MESSAGE(message);
+    // Largest remaining activations are the 3136 byte float input (784 bytes with MODEL_INT8_IO)
+    // and the 4608 byte 12x12x32 pool output
+    TEST_ASSERT_LESS_THAN(8 * 1024, generated.arena_used_bytes());
+    TEST_ASSERT_LESS_THAN(interpreter.arena_used_bytes() / 2, generated.arena_used_bytes());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_outputs_bit_exact);
+    RUN_TEST(test_arena_used_bytes);
+    return UNITY_END();
+}
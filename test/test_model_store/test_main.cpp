@@ -0,0 +1,130 @@
+#include <stdio.h>
+#include <string.h>
+#include <unity.h>
+#include <chrono>
+#include "model_data.h"
+#include "model_store.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+#define ARENA_SIZE 1024 * 32
+// Body chunk size of the web server, uploads arrive in pieces like this
+#define CHUNK_SIZE 1436
+
+static const char* path = "/tmp/tmnist_model_store.bin";
+static uint8_t tensor_arena[ARENA_SIZE];
+
+static const tflite::MicroOpResolver& resolver() {
+    static tflite::MicroMutableOpResolver<8> resolver;
+    static bool registered = false;
+    if (!registered) {
+        resolver.AddReadVariable();
+        resolver.AddQuantize();
+        resolver.AddFullyConnected();
+        resolver.AddSoftmax();
+        resolver.AddDequantize();
+        resolver.AddConv2D();
+        resolver.AddMaxPool2D();
+        resolver.AddReshape();
+        registered = true;
+    }
+    return resolver;
+}
+
+/**
+ * @brief Store the compiled-in model chunk by chunk, as the upload endpoint does
+ */
+static bool write_model(uint32_t size, uint32_t crc) {
+    model_writer_t writer;
+    if (!model_writer_begin(&writer, path, tmnist_model_tflite_len)) {
+        return false;
+    }
+    for (uint32_t offset = 0; offset < size; offset += CHUNK_SIZE) {
+        uint32_t chunk = size - offset < CHUNK_SIZE ? size - offset : CHUNK_SIZE;
+        model_writer_write(&writer, tmnist_model_tflite + offset, chunk);
+    }
+    return model_writer_finish(&writer, crc);
+}
+
+static uint32_t model_crc() {
+    return model_store_crc32(0, tmnist_model_tflite, tmnist_model_tflite_len);
+}
+
+void test_crc32() {
+    const char* check = "123456789";
+    TEST_ASSERT_EQUAL_HEX32(0xcbf43926, model_store_crc32(0, (const uint8_t*)check, 9));
+    // Chunks continue the CRC of the previous ones
+    uint32_t crc = model_store_crc32(0, (const uint8_t*)check, 4);
+    TEST_ASSERT_EQUAL_HEX32(0xcbf43926, model_store_crc32(crc, (const uint8_t*)check + 4, 5));
+}
+
+void test_mapped_model_matches_firmware() {
+    TEST_ASSERT_TRUE(write_model(tmnist_model_tflite_len, model_crc()));
+
+    auto start = std::chrono::steady_clock::now();
+    model_store_t store;
+    TEST_ASSERT_TRUE(model_store_open(&store, path));
+    const tflite::Model* model = tflite::GetModel(store.data);
+    auto end = std::chrono::steady_clock::now();
+    char message[96];
+    snprintf(message, sizeof(message), "open, CRC check and GetModel of %u bytes: %lld us",
+             (unsigned int)store.size,
+             (long long)std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+    TEST_MESSAGE(message);
+
+    TEST_ASSERT_EQUAL(tmnist_model_tflite_len, store.size);
+    TEST_ASSERT_EQUAL_MEMORY(tmnist_model_tflite, store.data, store.size);
+    TEST_ASSERT_EQUAL(0, (uintptr_t)store.data % 16);
+
+    // Same outputs as the model compiled into the firmware
+    static uint8_t firmware_arena[ARENA_SIZE];
+    tflite::MicroInterpreter mapped(model, resolver(), tensor_arena, ARENA_SIZE);
+    tflite::MicroInterpreter firmware(tflite::GetModel(tmnist_model_tflite), resolver(),
+                                      firmware_arena, ARENA_SIZE);
+    TEST_ASSERT_EQUAL(kTfLiteOk, mapped.AllocateTensors());
+    TEST_ASSERT_EQUAL(kTfLiteOk, firmware.AllocateTensors());
+    for (size_t i = 0; i < mapped.input(0)->bytes / sizeof(float); i++) {
+        mapped.input(0)->data.f[i] = firmware.input(0)->data.f[i] = (i * 37 % 255) / 255.0f;
+    }
+    TEST_ASSERT_EQUAL(kTfLiteOk, mapped.Invoke());
+    TEST_ASSERT_EQUAL(kTfLiteOk, firmware.Invoke());
+    TEST_ASSERT_EQUAL_MEMORY(firmware.output(0)->data.raw, mapped.output(0)->data.raw,
+                             firmware.output(0)->bytes);
+    model_store_close(&store);
+}
+
+void test_crc_mismatch_rejected() {
+    TEST_ASSERT_FALSE(write_model(tmnist_model_tflite_len, model_crc() ^ 1));
+    model_store_t store;
+    TEST_ASSERT_FALSE(model_store_open(&store, path));
+}
+
+void test_truncated_upload_rejected() {
+    TEST_ASSERT_FALSE(write_model(tmnist_model_tflite_len / 2, model_crc()));
+    model_store_t store;
+    TEST_ASSERT_FALSE(model_store_open(&store, path));
+}
+
+void test_corrupted_model_rejected() {
+    TEST_ASSERT_TRUE(write_model(tmnist_model_tflite_len, model_crc()));
+    FILE* file = fopen(path, "r+b");
+    TEST_ASSERT_NOT_NULL(file);
+    fseek(file, MODEL_STORE_HEADER_SIZE + tmnist_model_tflite_len / 2, SEEK_SET);
+    fputc(0x55 ^ tmnist_model_tflite[tmnist_model_tflite_len / 2], file);
+    fclose(file);
+    model_store_t store;
+    TEST_ASSERT_FALSE(model_store_open(&store, path));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_crc32);
+    RUN_TEST(test_mapped_model_matches_firmware);
+    RUN_TEST(test_crc_mismatch_rejected);
+    RUN_TEST(test_truncated_upload_rejected);
+    RUN_TEST(test_corrupted_model_rejected);
+    int failures = UNITY_END();
+    remove(path);
+    return failures;
+}
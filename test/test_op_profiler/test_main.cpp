@@ -0,0 +1,81 @@
+#include <unity.h>
+#include "op_profiler.h"
+
+// Fake cycle counter, every read advances it by the step
+static uint32_t now = 0;
+static uint32_t step = 0;
+
+static uint32_t fake_cycles() {
+    now += step;
+    return now;
+}
+
+/**
+ * @brief One Invoke() of a two operator graph, as the interpreter reports it
+ */
+static void invoke(op_profiler_t& profiler, uint32_t conv_cycles, uint32_t pool_cycles) {
+    step = 0;
+    profiler.begin_invoke();
+    uint32_t conv = profiler.BeginEvent("CONV_2D");
+    now += conv_cycles;
+    profiler.EndEvent(conv);
+    uint32_t pool = profiler.BeginEvent("MAX_POOL_2D");
+    now += pool_cycles;
+    profiler.EndEvent(pool);
+    // Interpreter overhead between the operators and after the last one
+    now += 10;
+    profiler.end_invoke();
+}
+
+void test_ops_by_node() {
+    op_profiler_t profiler(fake_cycles);
+    invoke(profiler, 100, 20);
+    invoke(profiler, 300, 40);
+    TEST_ASSERT_EQUAL(2, profiler.op_count());
+    TEST_ASSERT_EQUAL_STRING("CONV_2D", profiler.op(0).tag);
+    TEST_ASSERT_EQUAL_STRING("MAX_POOL_2D", profiler.op(1).tag);
+    const cycle_stats_t& conv = profiler.op(0).cycles;
+    TEST_ASSERT_EQUAL(2, conv.count);
+    TEST_ASSERT_EQUAL(100, conv.min);
+    TEST_ASSERT_EQUAL(300, conv.max);
+    TEST_ASSERT_EQUAL(400, conv.total);
+    TEST_ASSERT_EQUAL(2, profiler.invoke_cycles().count);
+    TEST_ASSERT_EQUAL(130, profiler.invoke_cycles().min);
+    TEST_ASSERT_EQUAL(350, profiler.invoke_cycles().max);
+}
+
+void test_reading_totals() {
+    op_profiler_t profiler(fake_cycles);
+    profiler.begin_reading();
+    invoke(profiler, 100, 20);
+    invoke(profiler, 100, 20);
+    profiler.end_reading();
+    // Every digit came from the cache, the model did not run
+    profiler.begin_reading();
+    profiler.end_reading();
+    TEST_ASSERT_EQUAL(1, profiler.reading_cycles().count);
+    TEST_ASSERT_EQUAL(260, profiler.reading_cycles().total);
+
+    profiler.reset();
+    TEST_ASSERT_EQUAL(0, profiler.op_count());
+    TEST_ASSERT_EQUAL(0, profiler.reading_cycles().count);
+}
+
+void test_nodes_beyond_limit_ignored() {
+    op_profiler_t profiler(fake_cycles);
+    step = 1;
+    profiler.begin_invoke();
+    for (int i = 0; i < OP_PROFILER_MAX_OPS + 4; i++) {
+        profiler.EndEvent(profiler.BeginEvent("RESHAPE"));
+    }
+    profiler.end_invoke();
+    TEST_ASSERT_EQUAL(OP_PROFILER_MAX_OPS, profiler.op_count());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_ops_by_node);
+    RUN_TEST(test_reading_totals);
+    RUN_TEST(test_nodes_beyond_limit_ignored);
+    return UNITY_END();
+}
@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unity.h>
+#include "perceptual_hash.h"
+
+// Default cache_distance of config.json
+#define CACHE_DISTANCE 6
+
+// Segments a..g of every digit, bit 0 is a
+static const uint8_t segments[10] = {0x3f, 0x06, 0x5b, 0x4f, 0x66, 0x6d, 0x7d, 0x07, 0x7f, 0x6f};
+
+// Rectangle x0, y0, x1, y1 of segments a..g, digit box is x 7..21, y 3..25
+static const int segment_rects[7][4] = {
+    {7, 3, 21, 6},    // a
+    {18, 3, 21, 14},  // b
+    {18, 14, 21, 25}, // c
+    {7, 22, 21, 25},  // d
+    {7, 14, 10, 25},  // e
+    {7, 3, 10, 14},   // f
+    {7, 13, 21, 16},  // g
+};
+
+/**
+ * @brief Light seven-segment digit on black with 3 pixel strokes, shifted right by dx
+ */
+static void draw_digit(uint8_t* pixels, int digit, int dx) {
+    memset(pixels, 0, 28 * 28);
+    for (int segment = 0; segment < 7; segment++) {
+        if (!(segments[digit] & (1 << segment))) {
+            continue;
+        }
+        const int* rect = segment_rects[segment];
+        for (int y = rect[1]; y < rect[3]; y++) {
+            memset(pixels + y * 28 + rect[0] + dx, 255, rect[2] - rect[0]);
+        }
+    }
+}
+
+static void add_noise(uint8_t* pixels, unsigned int seed) {
+    srand(seed);
+    for (int i = 0; i < 28 * 28; i++) {
+        int value = pixels[i] + rand() % 41 - 20;
+        pixels[i] = value < 0 ? 0 : value > 255 ? 255 : value;
+    }
+}
+
+void test_different_digits_never_match() {
+    uint8_t a[28 * 28], b[28 * 28];
+    for (int i = 0; i < 10; i++) {
+        for (int j = 0; j < 10; j++) {
+            if (i == j) {
+                continue;
+            }
+            draw_digit(a, i, 0);
+            draw_digit(b, j, 0);
+            add_noise(b, i * 10 + j);
+            char message[64];
+            snprintf(message, sizeof(message), "%d vs %d: %d bits, %d pixels", i, j,
+                     perceptual_hash_distance(perceptual_hash_digit(a), perceptual_hash_digit(b)),
+                     perceptual_hash_changed_pixels(a, b));
+            TEST_ASSERT_FALSE_MESSAGE(perceptual_hash_same_digit(perceptual_hash_digit(a), a,
+                                                                 perceptual_hash_digit(b), b,
+                                                                 CACHE_DISTANCE),
+                                      message);
+        }
+    }
+}
+
+void test_noisy_digit_matches() {
+    uint8_t a[28 * 28], b[28 * 28];
+    for (int digit = 0; digit < 10; digit++) {
+        for (unsigned int seed = 0; seed < 8; seed++) {
+            draw_digit(a, digit, 0);
+            draw_digit(b, digit, 0);
+            add_noise(a, seed);
+            add_noise(b, seed + 100);
+            TEST_ASSERT_TRUE(perceptual_hash_same_digit(perceptual_hash_digit(a), a,
+                                                        perceptual_hash_digit(b), b,
+                                                        CACHE_DISTANCE));
+        }
+    }
+}
+
+/**
+ * @brief A shifted digit is classified again rather than risking a wrong hit
+ */
+void test_shifted_digit_misses() {
+    uint8_t a[28 * 28], b[28 * 28];
+    draw_digit(a, 5, 0);
+    draw_digit(b, 5, 1);
+    TEST_ASSERT_GREATER_THAN(PERCEPTUAL_HASH_MAX_CHANGED, perceptual_hash_changed_pixels(a, b));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_different_digits_never_match);
+    RUN_TEST(test_noisy_digit_matches);
+    RUN_TEST(test_shifted_digit_misses);
+    return UNITY_END();
+}
@@ -0,0 +1,185 @@
+#include <stdio.h>
+#include <string.h>
+#include <unity.h>
+#include "perceptual_hash.h"
+#include "pgm_frame.h"
+#include "reading.h"
+
+#define FRAME_WIDTH 480
+#define FRAME_HEIGHT 320
+
+static const char* path = "/tmp/tmnist_reading_test.pgm";
+
+/**
+ * @brief Light frame with a dark vertical stroke in each of four cells
+ */
+static void write_frame() {
+    static uint8_t pixels[FRAME_WIDTH * FRAME_HEIGHT];
+    memset(pixels, 200, sizeof(pixels));
+    for (int cell = 0; cell < 4; cell++) {
+        for (int y = 105; y < 150; y++) {
+            memset(&pixels[y * FRAME_WIDTH + 120 + cell * 60], 30, 8);
+        }
+    }
+    FILE* file = fopen(path, "wb");
+    fprintf(file, "P5\n# saved frame\n%d %d\n255\n", FRAME_WIDTH, FRAME_HEIGHT);
+    fwrite(pixels, 1, sizeof(pixels), file);
+    fclose(file);
+}
+
+void test_pgm_load() {
+    write_frame();
+    gray_frame_t frame;
+    TEST_ASSERT_TRUE(pgm_load(path, &frame));
+    TEST_ASSERT_EQUAL(FRAME_WIDTH, frame.width);
+    TEST_ASSERT_EQUAL(FRAME_HEIGHT, frame.height);
+    TEST_ASSERT_EQUAL(200, frame.buf[0]);
+    TEST_ASSERT_EQUAL(30, frame.buf[105 * FRAME_WIDTH + 120]);
+    pgm_free(&frame);
+    TEST_ASSERT_NULL(frame.buf);
+
+    // ASCII PGM is not supported
+    FILE* file = fopen(path, "wb");
+    fprintf(file, "P2\n2 1\n255\n0 255\n");
+    fclose(file);
+    TEST_ASSERT_FALSE(pgm_load(path, &frame));
+    TEST_ASSERT_FALSE(pgm_load("/tmp/tmnist_missing.pgm", &frame));
+}
+
+void test_read_frame() {
+    tensor_arena = (uint8_t*)malloc(ARENA_SIZE);
+    interpreter.reset(new tflite::MicroInterpreter(firmwareModel(), modelResolver(), tensor_arena,
+                                                   ARENA_SIZE, nullptr, &op_profiler));
+    TEST_ASSERT_EQUAL(kTfLiteOk, interpreter->AllocateTensors());
+    initInputLut();
+
+    StaticJsonDocument<1024> doc;
+    TEST_ASSERT_FALSE(deserializeJson(doc,
+                                      "{\"cache\": true, \"rectangles\": ["
+                                      "{\"x\": 100, \"y\": 100, \"width\": 56, \"height\": 56},"
+                                      "{\"x\": 160, \"y\": 100, \"width\": 56, \"height\": 56},"
+                                      "{\"x\": 220, \"y\": 100, \"width\": 56, \"height\": 56},"
+                                      "{\"x\": 280, \"y\": 100, \"width\": 56, \"height\": 56}]}"));
+    config = configFromJson(doc, FRAME_WIDTH, FRAME_HEIGHT);
+    TEST_ASSERT_EQUAL(4, config.coefs.size());
+
+    write_frame();
+    gray_frame_t frame;
+    TEST_ASSERT_TRUE(pgm_load(path, &frame));
+    frame_jobs_t first;
+    reading_stats_t reading;
+    TEST_ASSERT_TRUE(readFrame(&frame, false, first, reading));
+    TEST_ASSERT_EQUAL(4, first.digits.size());
+    for (int digit : first.digits) {
+        TEST_ASSERT_TRUE(digit >= 0 && digit <= 9);
+    }
+    TEST_ASSERT_EQUAL(0, reading.cached);
+
+    // Same frame again, every digit comes from the cache
+    frame_jobs_t second;
+    TEST_ASSERT_TRUE(readFrame(&frame, false, second, reading));
+    TEST_ASSERT_EQUAL(4, reading.cached);
+    TEST_ASSERT_TRUE(first.digits == second.digits);
+    pgm_free(&frame);
+}
+
+/**
+ * @brief Pseudo-random preview standing for one digit, previews of different digits never match
+ */
+static void digit_preview(uint8_t* preview, int digit) {
+    uint32_t state = digit * 2654435761u + 1;
+    for (int i = 0; i < 28 * 28; i++) {
+        state = state * 1664525 + 1013904223;
+        preview[i] = state >> 24;
+    }
+}
+
+void test_odometer_rollover() {
+    StaticJsonDocument<1024> doc;
+    TEST_ASSERT_FALSE(deserializeJson(doc,
+                                      "{\"odometer\": true, \"cache\": true, \"rectangles\": ["
+                                      "{\"x\": 100, \"y\": 100, \"width\": 56, \"height\": 56},"
+                                      "{\"x\": 160, \"y\": 100, \"width\": 56, \"height\": 56},"
+                                      "{\"x\": 220, \"y\": 100, \"width\": 56, \"height\": 56},"
+                                      "{\"x\": 280, \"y\": 100, \"width\": 56, \"height\": 56}]}"));
+    config = configFromJson(doc, FRAME_WIDTH, FRAME_HEIGHT);
+    static uint8_t pixels[FRAME_WIDTH * FRAME_HEIGHT];
+    gray_frame_t frame = {pixels, FRAME_WIDTH, FRAME_HEIGHT};
+
+    // The cache stands in for the model: it holds the true digit of every position, so
+    // each digit the odometer asks for is answered right and counted as classified
+    digit_cache.entries.assign(4, {.hash = 0, .digit = -1, .score = 0});
+    digit_cache.previews.assign(4 * 28 * 28, 0);
+    const int first = 995, last = 1015;
+    for (int value = first; value <= last; value++) {
+        char text[5];
+        snprintf(text, sizeof(text), "%04d", value);
+        char previous[5];
+        snprintf(previous, sizeof(previous), "%04d", value - 1);
+
+        frame_jobs_t frame_jobs;
+        prepareJobs(&frame, frame_jobs, true, nullptr);
+        for (int i = 0; i < 4; i++) {
+            uint8_t* preview = &digit_cache.previews[i * 28 * 28];
+            digit_preview(preview, text[i] - '0');
+            digit_cache.entries[i] = {
+                .hash = perceptual_hash_digit(preview), .digit = text[i] - '0', .score = 1};
+            memcpy(frame_jobs.jobs[i].dst.preview, preview, 28 * 28);
+        }
+        std::vector<uint64_t> hashes;
+        reading_stats_t reading = {};
+        uint32_t classified = odometer.classified;
+        TEST_ASSERT_TRUE(readOdometer(frame_jobs, hashes, reading));
+
+        // A position is classified when every digit right of it rolled over from 9 to 0
+        bool carry = true;
+        for (int i = 3; i >= 0; i--) {
+            TEST_ASSERT_EQUAL(text[i] - '0', frame_jobs.digits[i]);
+            bool expected = value == first || carry;
+            TEST_ASSERT_EQUAL(expected, frame_jobs.sources[i] != DIGIT_KEPT);
+            carry = carry && text[i] == '0' && previous[i] == '9';
+        }
+        TEST_ASSERT_EQUAL(reading.cached, odometer.classified - classified);
+    }
+
+    // 20 steps: one digit each, plus 3 more at 999 -> 1000 and 1 more at 1009 -> 1010
+    TEST_ASSERT_EQUAL(last - first + 1, odometer.readings);
+    TEST_ASSERT_EQUAL(4 + 20 + 3 + 1, odometer.classified);
+    float per_reading = (float)(odometer.classified - 4) / (odometer.readings - 1);
+    printf("Odometer: %.2f digits classified per reading\n", per_reading);
+    TEST_ASSERT_TRUE(per_reading >= 1.0f && per_reading <= 2.0f);
+}
+
+/**
+ * @brief Parse a config with one rectangle
+ */
+static size_t rectangle_coefs(int x, int y, int width, int height) {
+    StaticJsonDocument<256> doc;
+    char json[200];
+    snprintf(json, sizeof(json),
+             "{\"rectangles\": [{\"x\": %d, \"y\": %d, \"width\": %d, \"height\": %d}]}", x, y,
+             width, height);
+    TEST_ASSERT_FALSE(deserializeJson(doc, json));
+    return configFromJson(doc, FRAME_WIDTH, FRAME_HEIGHT).coefs.size();
+}
+
+void test_rectangle_bounds() {
+    TEST_ASSERT_EQUAL(1, rectangle_coefs(0, 0, 480, 320));
+    TEST_ASSERT_EQUAL(1, rectangle_coefs(424, 264, 56, 56));
+    // Past the right and bottom edge, starting outside and empty
+    TEST_ASSERT_EQUAL(0, rectangle_coefs(425, 100, 56, 56));
+    TEST_ASSERT_EQUAL(0, rectangle_coefs(100, 300, 56, 56));
+    TEST_ASSERT_EQUAL(0, rectangle_coefs(500, 100, 56, 56));
+    TEST_ASSERT_EQUAL(0, rectangle_coefs(100, 100, 0, 56));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_pgm_load);
+    RUN_TEST(test_read_frame);
+    RUN_TEST(test_odometer_rollover);
+    RUN_TEST(test_rectangle_bounds);
+    int failures = UNITY_END();
+    remove(path);
+    return failures;
+}
@@ -0,0 +1,172 @@
+#include <stdlib.h>
+#include <vector>
+#include <unity.h>
+#include "image_manipulation.h"
+
+// Free space around the section, the float path reads one pixel past its end
+#define MARGIN 4
+
+/**
+ * @brief Largest difference between the fixed-point and the float path on a random section
+ *
+ * Outputs left of or above the first source pixel center are skipped, the float
+ * path extrapolates there while the fixed-point taps clamp to the section. That
+ * is the first row and column, and more of them when upscaling past 2x.
+ */
+static int max_difference(unsigned int section_w,
+                          unsigned int section_h,
+                          unsigned int out_w,
+                          unsigned int out_h) {
+    unsigned int frame_w = section_w + 2 * MARGIN;
+    unsigned int frame_h = section_h + 2 * MARGIN;
+    std::vector<uint8_t> frame(frame_w * frame_h);
+    srand(section_w * 1000 + section_h);
+    for (uint8_t& pixel : frame) {
+        pixel = rand() & 0xff;
+    }
+    in_image_t src = {frame.data(), frame_w, frame_h, MARGIN, MARGIN, section_w, section_h};
+    std::vector<uint8_t> reference(out_w * out_h), fixed(out_w * out_h);
+    out_image_t reference_image = {reference.data(), out_w, out_h};
+    out_image_t fixed_image = {fixed.data(), out_w, out_h};
+    scale_coefs_t coefs;
+    scale_coefs_init(&coefs, section_w, section_h, out_w, out_h);
+
+    scale_reference(&src, &reference_image, out_w, out_h);
+    scale_fixed(&src, &fixed_image, &coefs);
+    int max_diff = 0;
+    for (unsigned int y = (out_h + 2 * section_h - 1) / (2 * section_h); y < out_h; y++) {
+        for (unsigned int x = (out_w + 2 * section_w - 1) / (2 * section_w); x < out_w; x++) {
+            int diff = abs(reference[y * out_w + x] - fixed[y * out_w + x]);
+            max_diff = diff > max_diff ? diff : max_diff;
+        }
+    }
+    return max_diff;
+}
+
+void test_same_size() {
+    TEST_ASSERT_LESS_OR_EQUAL(1, max_difference(28, 28, 28, 28));
+}
+
+void test_downscale() {
+    TEST_ASSERT_LESS_OR_EQUAL(1, max_difference(56, 56, 28, 28));
+    TEST_ASSERT_LESS_OR_EQUAL(1, max_difference(40, 50, 28, 28));
+}
+
+void test_odd_sizes() {
+    TEST_ASSERT_LESS_OR_EQUAL(1, max_difference(37, 53, 28, 28));
+    TEST_ASSERT_LESS_OR_EQUAL(1, max_difference(29, 31, 28, 28));
+    TEST_ASSERT_LESS_OR_EQUAL(1, max_difference(45, 33, 27, 19));
+}
+
+void test_upscale() {
+    TEST_ASSERT_LESS_OR_EQUAL(1, max_difference(20, 15, 28, 28));
+    TEST_ASSERT_LESS_OR_EQUAL(1, max_difference(13, 9, 28, 28));
+    TEST_ASSERT_LESS_OR_EQUAL(1, max_difference(7, 27, 28, 28));
+    TEST_ASSERT_LESS_OR_EQUAL(1, max_difference(3, 3, 28, 28));
+}
+
+/**
+ * @brief Box mode through the integral image against the rounded mean of each bin summed directly
+ */
+static void check_box(unsigned int section_w, unsigned int section_h) {
+    unsigned int frame_w = section_w + 2 * MARGIN;
+    unsigned int frame_h = section_h + 2 * MARGIN;
+    std::vector<uint8_t> frame(frame_w * frame_h);
+    srand(section_w * 1000 + section_h);
+    for (uint8_t& pixel : frame) {
+        pixel = rand() & 0xff;
+    }
+    in_image_t src = {frame.data(), frame_w, frame_h, MARGIN, MARGIN, section_w, section_h};
+    scale_coefs_t coefs;
+    scale_coefs_init(&coefs, section_w, section_h, 28, 28);
+    TEST_ASSERT_EQUAL(SCALE_MODE_BOX, coefs.mode);
+    integral_image_t integral = {};
+    TEST_ASSERT_TRUE(integral_image_reserve(&integral, MARGIN, MARGIN, section_w, section_h));
+    integral_image_build(&integral, frame.data(), frame_w);
+    uint8_t box[28 * 28];
+    out_image_t box_image = {box, 28, 28};
+    scale_box(&src, &box_image, &coefs, &integral);
+
+    for (unsigned int y = 0; y < 28; y++) {
+        // Every bin covers at least one pixel, also on an axis that is upscaled
+        unsigned int y0 = y * section_h / 28, y1 = (y + 1) * section_h / 28;
+        y1 = y1 > y0 ? y1 : y0 + 1;
+        for (unsigned int x = 0; x < 28; x++) {
+            unsigned int x0 = x * section_w / 28, x1 = (x + 1) * section_w / 28;
+            x1 = x1 > x0 ? x1 : x0 + 1;
+            uint32_t sum = 0;
+            for (unsigned int row = y0; row < y1; row++) {
+                for (unsigned int column = x0; column < x1; column++) {
+                    sum += frame[(row + MARGIN) * frame_w + column + MARGIN];
+                }
+            }
+            uint32_t area = (x1 - x0) * (y1 - y0);
+            TEST_ASSERT_EQUAL((sum + area / 2) / area, box[y * 28 + x]);
+        }
+    }
+    integral_image_free(&integral);
+}
+
+void test_box() {
+    check_box(112, 84);
+    check_box(97, 203);
+    // Only the height is box filtered, the width is upscaled
+    check_box(20, 120);
+}
+
+void test_box_uncovered() {
+    const unsigned int section = 112, frame_w = section + 2 * MARGIN;
+    std::vector<uint8_t> frame(frame_w * frame_w);
+    srand(section);
+    for (uint8_t& pixel : frame) {
+        pixel = rand() & 0xff;
+    }
+    in_image_t src = {frame.data(), frame_w, frame_w, MARGIN, MARGIN, section, section};
+    scale_coefs_t coefs;
+    scale_coefs_init(&coefs, section, section, 28, 28);
+    uint8_t bilinear[28 * 28], box[28 * 28];
+    out_image_t bilinear_image = {bilinear, 28, 28};
+    out_image_t box_image = {box, 28, 28};
+    scale_fixed(&src, &bilinear_image, &coefs);
+
+    // Table one pixel short of the section, box bins would read past it
+    integral_image_t integral = {};
+    TEST_ASSERT_TRUE(integral_image_reserve(&integral, MARGIN, MARGIN, section - 1, section));
+    integral_image_build(&integral, frame.data(), frame_w);
+    scale_box(&src, &box_image, &coefs, &integral);
+    TEST_ASSERT_EQUAL_MEMORY(bilinear, box, sizeof(box));
+    scale(&src, &box_image, &coefs, nullptr);
+    TEST_ASSERT_EQUAL_MEMORY(bilinear, box, sizeof(box));
+    integral_image_free(&integral);
+}
+
+void test_affine_bounds() {
+    scale_coefs_t coefs;
+    // Inside a 64x64 frame, the unclamped walk is safe
+    const float inside[6] = {1, 0, 10, 0, 1, 10};
+    scale_coefs_init_affine(&coefs, inside, 28, 28, 64, 64);
+    TEST_ASSERT_FALSE(coefs.affine.clamp);
+
+    // Last column lands on x = 0 in float, the rounded Q16 steps overshoot it to x < 0
+    const float edge[6] = {-2.0f / 3, 0, 18, 0, 1, 10};
+    scale_coefs_init_affine(&coefs, edge, 28, 28, 64, 64);
+    TEST_ASSERT_TRUE(coefs.affine.x + 27 * coefs.affine.ux < 0);
+    TEST_ASSERT_TRUE(coefs.affine.clamp);
+
+    // Right neighbour of the last tap must stay in the frame too
+    const float right[6] = {1, 0, 36, 0, 1, 10};
+    scale_coefs_init_affine(&coefs, right, 28, 28, 64, 64);
+    TEST_ASSERT_TRUE(coefs.affine.clamp);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_same_size);
+    RUN_TEST(test_downscale);
+    RUN_TEST(test_odd_sizes);
+    RUN_TEST(test_upscale);
+    RUN_TEST(test_box);
+    RUN_TEST(test_box_uncovered);
+    RUN_TEST(test_affine_bounds);
+    return UNITY_END();
+}
@@ -0,0 +1,128 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unity.h>
+#include "template_matcher.h"
+
+// Segments a..g of every digit, bit 0 is a
+static const uint8_t segments[10] = {0x3f, 0x06, 0x5b, 0x4f, 0x66, 0x6d, 0x7d, 0x07, 0x7f, 0x6f};
+
+// Rectangle x0, y0, x1, y1 of segments a..g, digit box is x 7..21, y 3..25
+static const int segment_rects[7][4] = {
+    {7, 3, 21, 6},    // a
+    {18, 3, 21, 14},  // b
+    {18, 14, 21, 25}, // c
+    {7, 22, 21, 25},  // d
+    {7, 14, 10, 25},  // e
+    {7, 3, 10, 14},   // f
+    {7, 13, 21, 16},  // g
+};
+
+/**
+ * @brief Light seven-segment digit on black, segment e drawn with its own brightness
+ */
+static void draw_digit(uint8_t* pixels, int digit, uint8_t segment_e = 255) {
+    memset(pixels, 0, TEMPLATE_PIXELS);
+    for (int segment = 0; segment < 7; segment++) {
+        if (!(segments[digit] & (1 << segment))) {
+            continue;
+        }
+        const int* rect = segment_rects[segment];
+        for (int y = rect[1]; y < rect[3]; y++) {
+            memset(pixels + y * 28 + rect[0], segment == 4 ? segment_e : 255, rect[2] - rect[0]);
+        }
+    }
+}
+
+static void add_noise(uint8_t* pixels, unsigned int seed) {
+    srand(seed);
+    for (int i = 0; i < TEMPLATE_PIXELS; i++) {
+        int value = pixels[i] + rand() % 41 - 20;
+        pixels[i] = value < 0 ? 0 : value > 255 ? 255 : value;
+    }
+}
+
+/**
+ * @brief Learn noisy samples of a digit
+ */
+static void learn(template_set_t* set, int digit, int samples) {
+    uint8_t pixels[TEMPLATE_PIXELS];
+    for (int i = 0; i < samples; i++) {
+        draw_digit(pixels, digit);
+        add_noise(pixels, digit * 100 + i);
+        template_set_learn(set, digit, pixels);
+    }
+}
+
+void test_no_match_before_min_samples() {
+    static template_set_t set;
+    template_set_reset(&set);
+    uint8_t pixels[TEMPLATE_PIXELS];
+    draw_digit(pixels, 3);
+    float confidence = 1;
+    TEST_ASSERT_EQUAL(-1, template_set_match(&set, pixels, &confidence));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, confidence);
+
+    learn(&set, 3, TEMPLATE_MIN_SAMPLES - 1);
+    confidence = 1;
+    TEST_ASSERT_EQUAL(-1, template_set_match(&set, pixels, &confidence));
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.0f, confidence);
+
+    learn(&set, 3, 1);
+    TEST_ASSERT_EQUAL(3, template_set_match(&set, pixels, &confidence));
+    TEST_ASSERT_TRUE(confidence > 0);
+}
+
+void test_matches_right_digit() {
+    static template_set_t set;
+    template_set_reset(&set);
+    for (int digit = 0; digit < TEMPLATE_CLASSES; digit++) {
+        learn(&set, digit, TEMPLATE_MAX_WEIGHT);
+    }
+    uint8_t pixels[TEMPLATE_PIXELS];
+    for (int digit = 0; digit < TEMPLATE_CLASSES; digit++) {
+        draw_digit(pixels, digit);
+        add_noise(pixels, 1000 + digit);
+        float confidence;
+        TEST_ASSERT_EQUAL(digit, template_set_match(&set, pixels, &confidence));
+        TEST_ASSERT_TRUE(confidence > 0);
+    }
+}
+
+void test_similar_templates_are_not_confident() {
+    // 8 and 9 only differ in segment e
+    static template_set_t set;
+    template_set_reset(&set);
+    learn(&set, 8, TEMPLATE_MAX_WEIGHT);
+    learn(&set, 9, TEMPLATE_MAX_WEIGHT);
+    uint8_t pixels[TEMPLATE_PIXELS];
+    float confidence;
+
+    // Half lit segment e is as far from both, the match must not pass any cascade threshold
+    draw_digit(pixels, 8, 128);
+    add_noise(pixels, 2000);
+    int digit = template_set_match(&set, pixels, &confidence);
+    TEST_ASSERT_TRUE(digit == 8 || digit == 9);
+    TEST_ASSERT_TRUE(confidence < 0.1f);
+
+    // A clean 8 still wins, but with less confidence than next to a dissimilar 1
+    draw_digit(pixels, 8);
+    add_noise(pixels, 2001);
+    TEST_ASSERT_EQUAL(8, template_set_match(&set, pixels, &confidence));
+    float similar = confidence;
+    static template_set_t dissimilar;
+    template_set_reset(&dissimilar);
+    learn(&dissimilar, 8, TEMPLATE_MAX_WEIGHT);
+    learn(&dissimilar, 1, TEMPLATE_MAX_WEIGHT);
+    TEST_ASSERT_EQUAL(8, template_set_match(&dissimilar, pixels, &confidence));
+    printf("Clean 8 next to 9: %.3f, next to 1: %.3f\n", similar, confidence);
+    TEST_ASSERT_TRUE(similar < confidence);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_no_match_before_min_samples);
+    RUN_TEST(test_matches_right_digit);
+    RUN_TEST(test_similar_templates_are_not_confident);
+    return UNITY_END();
+}
@@ -0,0 +1,426 @@
+#!/usr/bin/env python3
+"""Derive model variants from a quantized TFLite model and export them as C arrays.
+
+The firmware variants are the same trained weights in a different graph, so they
+are rewritten from tmnist_model.tflite instead of converting the Keras model again:
+
+    --int8-io   drop the Quantize/Dequantize ops at the ends of the graph, the
+                firmware writes and reads the int8 tensors (-D MODEL_INT8_IO)
+    --logits    drop the Softmax at the end, the output are the int8 logits
+    --batch N   batch dimension of the activations (-D MODEL_BATCH=N)
+    --prune S   zero the smallest magnitude share S of the large fully connected
+                weights, generate_inference.py then emits a sparse kernel
+
+Pure Python, no TensorFlow or flatbuffers package needed:
+
+    python3 edit_model.py tmnist_model.tflite tmnist_model_int8.tflite --int8-io --logits \\
+        --export ../src/model_int8_data.cc --name tmnist_model_int8_tflite
+
+Signature definitions are not carried over, TFLM does not use them.
+"""
+
+import argparse
+import struct
+
+from generate_inference import (
+    OP_DEQUANTIZE,
+    OP_FULLY_CONNECTED,
+    OP_QUANTIZE,
+    OP_RESHAPE,
+    OP_SOFTMAX,
+    TENSOR_INT8,
+    Table,
+)
+
+# Builtin options tables as struct formats of their fields, "v" is a vector of int32
+OPTIONS_FIELDS = {
+    1: "biibiib",  # Conv2DOptions
+    2: "biiibii",  # DepthwiseConv2DOptions
+    5: "biiiib",  # Pool2DOptions
+    8: "bbBBb",  # FullyConnectedOptions
+    9: "f",  # SoftmaxOptions
+    17: "v",  # ReshapeOptions
+    27: "B",  # ReducerOptions
+}
+
+# Only fully connected weights of at least this many elements are pruned
+PRUNE_MIN_WEIGHTS = 16384
+
+BUFFER_ALIGNMENT = 16
+
+
+def present(table, field):
+    return table._offset(field) != 0
+
+
+def read_fields(table, fields):
+    """{field: value} of the fields present in a table, fields as in OPTIONS_FIELDS."""
+    values = {}
+    for field, fmt in enumerate(fields):
+        if present(table, field):
+            values[field] = table.vector(field, "i") if fmt == "v" else table.scalar(field, fmt)
+    return values
+
+
+def read_model(data):
+    model = Table(data, struct.unpack_from("<I", data, 0)[0])
+    subgraphs = model.tables(2)
+    if len(subgraphs) != 1:
+        raise ValueError("Only single subgraph models are supported")
+    subgraph = subgraphs[0]
+
+    tensors = []
+    for table in subgraph.tables(0):
+        if present(table, 6) or present(table, 9):
+            raise ValueError("Sparse and variant tensors are not supported")
+        tensor = read_fields(table, "vbI")
+        tensor[0] = table.vector(0, "i")
+        tensor["name"] = table.string(3)
+        tensor["shape_signature"] = table.vector(7, "i") if present(table, 7) else None
+        tensor.update({field: table.scalar(field, "B") for field in (5, 8) if present(table, field)})
+        quantization = table.table(4)
+        if quantization:
+            tensor["quantization"] = {
+                "min": quantization.vector(0, "f"),
+                "max": quantization.vector(1, "f"),
+                "scale": quantization.vector(2, "f"),
+                "zero_point": quantization.vector(3, "q"),
+                "quantized_dimension": quantization.scalar(6, "i"),
+            }
+        tensors.append(tensor)
+
+    operators = []
+    for table in subgraph.tables(3):
+        if table.fields > 5:
+            raise ValueError("Custom options and intermediates are not supported")
+        options_type = table.scalar(3, "B")
+        operator = {
+            "opcode_index": table.scalar(0, "I"),
+            "inputs": table.vector(1, "i"),
+            "outputs": table.vector(2, "i"),
+            "options_type": options_type,
+            "options": None,
+        }
+        if options_type:
+            if options_type not in OPTIONS_FIELDS:
+                raise ValueError("Builtin options type %d is not supported" % options_type)
+            operator["options"] = read_fields(table.table(4), OPTIONS_FIELDS[options_type])
+        operators.append(operator)
+
+    codes = []
+    for table in model.tables(1):
+        if present(table, 1):
+            raise ValueError("Custom operators are not supported")
+        codes.append(read_fields(table, "bxii"))
+
+    buffers = []
+    for table in model.tables(4):
+        if table.fields > 1:
+            raise ValueError("Buffers outside the flatbuffer are not supported")
+        buffers.append(bytes(table.raw(0)))
+
+    return {
+        "version": model.scalar(0, "I"),
+        "codes": codes,
+        "tensors": tensors,
+        "inputs": subgraph.vector(1, "i"),
+        "outputs": subgraph.vector(2, "i"),
+        "operators": operators,
+        "subgraph_name": subgraph.string(4) if present(subgraph, 4) else None,
+        "description": model.string(3) if present(model, 3) else None,
+        "buffers": buffers,
+        "metadata": [(table.string(0), table.scalar(1, "I")) for table in model.tables(6)],
+    }
+
+
+class Writer:
+    """Flatbuffer written front to back, every object is placed after the one referencing it."""
+
+    def __init__(self):
+        self.data = bytearray()
+
+    def pad(self, alignment, extra=0):
+        self.data += bytes(-(len(self.data) + extra) % alignment)
+
+    def patch(self, pos, target):
+        struct.pack_into("<I", self.data, pos, target - pos)
+
+    def table(self, fields):
+        """fields: (index, struct format or None, value), value is a writer callable for None."""
+        fields = sorted(fields, key=lambda field: field[0])
+        layout = []
+        size = 4
+        for index, fmt, value in fields:
+            width = struct.calcsize("<" + fmt) if fmt else 4
+            size += -size % width
+            layout.append((index, fmt, value, size))
+            size += width
+        count = fields[-1][0] + 1 if fields else 0
+        offsets = [0] * count
+        for index, _, _, offset in layout:
+            offsets[index] = offset
+
+        self.pad(2)
+        vtable = len(self.data)
+        self.data += struct.pack("<%dH" % (2 + count), 4 + 2 * count, size, *offsets)
+        self.pad(4)
+        start = len(self.data)
+        self.data += bytes(size)
+        struct.pack_into("<i", self.data, start, start - vtable)
+        children = []
+        for index, fmt, value, offset in layout:
+            if fmt:
+                struct.pack_into("<" + fmt, self.data, start + offset, value)
+            else:
+                children.append((start + offset, value))
+        for pos, write in children:
+            self.patch(pos, write())
+        return start
+
+    def vector(self, fmt, values, alignment=4):
+        alignment = max(alignment, struct.calcsize("<" + fmt))
+        self.pad(alignment, 4)
+        start = len(self.data)
+        self.data += struct.pack("<I%d%s" % (len(values), fmt), len(values), *values)
+        return start
+
+    def bytes(self, data, alignment=BUFFER_ALIGNMENT):
+        self.pad(alignment, 4)
+        start = len(self.data)
+        self.data += struct.pack("<I", len(data)) + data
+        return start
+
+    def string(self, text):
+        start = self.bytes(text.encode(), 4)
+        self.data += b"\0"
+        return start
+
+    def tables(self, writers):
+        self.pad(4)
+        start = len(self.data)
+        self.data += struct.pack("<I", len(writers)) + bytes(4 * len(writers))
+        for i, write in enumerate(writers):
+            self.patch(start + 4 + 4 * i, write())
+        return start
+
+
+def write_model(model):
+    writer = Writer()
+
+    def child(method, *args):
+        return lambda: method(*args)
+
+    def scalars(values, fields):
+        return [
+            (field, None, child(writer.vector, "i", value)) if fmt == "v" else (field, fmt, value)
+            for field, value in values.items()
+            for fmt in [fields[field]]
+        ]
+
+    def quantization(params):
+        fields = [(6, "i", params["quantized_dimension"])] if params["quantized_dimension"] else []
+        for field, fmt, key in ((0, "f", "min"), (1, "f", "max"), (2, "f", "scale"), (3, "q", "zero_point")):
+            if params[key]:
+                fields.append((field, None, child(writer.vector, fmt, params[key])))
+        return writer.table(fields)
+
+    def tensor(tensor):
+        fields = scalars({k: v for k, v in tensor.items() if k in (1, 2)}, "vbI")
+        fields += [(field, "B", tensor[field]) for field in (5, 8) if field in tensor]
+        fields.append((0, None, child(writer.vector, "i", tensor[0])))
+        fields.append((3, None, child(writer.string, tensor["name"])))
+        if "quantization" in tensor:
+            fields.append((4, None, child(quantization, tensor["quantization"])))
+        if tensor["shape_signature"] is not None:
+            fields.append((7, None, child(writer.vector, "i", tensor["shape_signature"])))
+        return writer.table(fields)
+
+    def operator(op):
+        fields = [
+            (0, "I", op["opcode_index"]),
+            (1, None, child(writer.vector, "i", op["inputs"])),
+            (2, None, child(writer.vector, "i", op["outputs"])),
+        ]
+        if op["options_type"]:
+            options = scalars(op["options"], OPTIONS_FIELDS[op["options_type"]])
+            fields.append((3, "B", op["options_type"]))
+            fields.append((4, None, child(writer.table, options)))
+        return writer.table(fields)
+
+    def subgraph():
+        fields = [
+            (0, None, child(writer.tables, [child(tensor, t) for t in model["tensors"]])),
+            (1, None, child(writer.vector, "i", model["inputs"])),
+            (2, None, child(writer.vector, "i", model["outputs"])),
+            (3, None, child(writer.tables, [child(operator, op) for op in model["operators"]])),
+        ]
+        if model["subgraph_name"] is not None:
+            fields.append((4, None, child(writer.string, model["subgraph_name"])))
+        return writer.table(fields)
+
+    def buffer(data):
+        return writer.table([(0, None, child(writer.bytes, data))] if data else [])
+
+    def metadata(name, index):
+        return writer.table([(0, None, child(writer.string, name)), (1, "I", index)])
+
+    fields = [
+        (0, "I", model["version"]),
+        (1, None, child(writer.tables, [child(writer.table, scalars(c, "bxii")) for c in model["codes"]])),
+        (2, None, child(writer.tables, [subgraph])),
+        (4, None, child(writer.tables, [child(buffer, data) for data in model["buffers"]])),
+        (6, None, child(writer.tables, [child(metadata, *m) for m in model["metadata"]])),
+    ]
+    if model["description"] is not None:
+        fields.append((3, None, child(writer.string, model["description"])))
+
+    writer.data += struct.pack("<I4s", 0, b"TFL3")
+    writer.patch(0, writer.table(fields))
+    writer.pad(BUFFER_ALIGNMENT)
+    return bytes(writer.data)
+
+
+def builtin_code(model, op):
+    code = model["codes"][op["opcode_index"]]
+    return max(code.get(0, 0), code.get(3, 0))
+
+
+def remove_operator(model, op, tensor_from, tensor_to):
+    """Drop an operator at the end of the graph, graph IO moves from one of its tensors to the other."""
+    model["operators"].remove(op)
+    for io in (model["inputs"], model["outputs"]):
+        io[:] = [tensor_to if index == tensor_from else index for index in io]
+
+
+def int8_io(model):
+    for op in list(model["operators"]):
+        code = builtin_code(model, op)
+        if code == OP_QUANTIZE and op["inputs"][0] in model["inputs"]:
+            remove_operator(model, op, op["inputs"][0], op["outputs"][0])
+        elif code == OP_DEQUANTIZE and op["outputs"][0] in model["outputs"]:
+            remove_operator(model, op, op["outputs"][0], op["inputs"][0])
+    for index in model["inputs"] + model["outputs"]:
+        if model["tensors"][index].get(1, 0) != TENSOR_INT8:
+            raise ValueError("%s: graph IO is not int8 after removing the (de)quantization" %
+                             model["tensors"][index]["name"])
+
+
+def logits(model):
+    for op in list(model["operators"]):
+        if builtin_code(model, op) == OP_SOFTMAX and op["outputs"][0] in model["outputs"]:
+            remove_operator(model, op, op["outputs"][0], op["inputs"][0])
+
+
+def batch(model, size):
+    for tensor in model["tensors"]:
+        if not model["buffers"][tensor.get(2, 0)] and tensor[0]:
+            tensor[0][0] = size
+    for op in model["operators"]:
+        if builtin_code(model, op) != OP_RESHAPE:
+            continue
+        if op["options"] and op["options"].get(0, [-1])[0] != -1:
+            op["options"][0][0] = size
+        if len(op["inputs"]) > 1:
+            shape = model["tensors"][op["inputs"][1]]
+            data = bytearray(model["buffers"][shape.get(2, 0)])
+            if struct.unpack_from("<i", data)[0] != -1:
+                struct.pack_into("<i", data, 0, size)
+                model["buffers"][shape[2]] = bytes(data)
+
+
+def prune(model, sparsity):
+    """Zero the share sparsity of int8 weights closest to the zero point, per weight matrix."""
+    pruned = []
+    for op in model["operators"]:
+        if builtin_code(model, op) != OP_FULLY_CONNECTED:
+            continue
+        tensor = model["tensors"][op["inputs"][1]]
+        weights = model["buffers"][tensor.get(2, 0)]
+        if tensor.get(1, 0) != TENSOR_INT8 or len(weights) < PRUNE_MIN_WEIGHTS:
+            continue
+        zero_point = tensor["quantization"]["zero_point"][0]
+        values = struct.unpack("<%db" % len(weights), weights)
+        order = sorted(range(len(values)), key=lambda i: abs(values[i] - zero_point))
+        values = list(values)
+        for i in order[: int(len(values) * sparsity)]:
+            values[i] = zero_point
+        model["buffers"][tensor[2]] = struct.pack("<%db" % len(values), *values)
+        pruned.append(tensor["name"])
+    return pruned
+
+
+def remove_unused(model):
+    """Drop tensors, buffers and operator codes no operator or graph IO refers to."""
+    used = set(model["inputs"] + model["outputs"])
+    for op in model["operators"]:
+        used.update(i for i in op["inputs"] + op["outputs"] if i >= 0)
+    tensor_index = {old: new for new, old in enumerate(sorted(used))}
+    model["tensors"] = [model["tensors"][old] for old in sorted(used)]
+    model["inputs"] = [tensor_index[i] for i in model["inputs"]]
+    model["outputs"] = [tensor_index[i] for i in model["outputs"]]
+    for op in model["operators"]:
+        op["inputs"] = [tensor_index[i] if i >= 0 else i for i in op["inputs"]]
+        op["outputs"] = [tensor_index[i] for i in op["outputs"]]
+
+    # Buffer 0 stays the empty sentinel
+    used = {0} | {tensor.get(2, 0) for tensor in model["tensors"]} | {m[1] for m in model["metadata"]}
+    buffer_index = {old: new for new, old in enumerate(sorted(used))}
+    model["buffers"] = [model["buffers"][old] for old in sorted(used)]
+    for tensor in model["tensors"]:
+        tensor[2] = buffer_index[tensor.get(2, 0)]
+    model["metadata"] = [(name, buffer_index[index]) for name, index in model["metadata"]]
+
+    used = sorted({op["opcode_index"] for op in model["operators"]})
+    code_index = {old: new for new, old in enumerate(used)}
+    model["codes"] = [model["codes"][old] for old in used]
+    for op in model["operators"]:
+        op["opcode_index"] = code_index[op["opcode_index"]]
+
+
+def export_c_array(data, path, name):
+    """Same format as export_model() of tmnist-conv2d.ipynb."""
+    with open(path, "w") as f:
+        f.write('#include "model_data.h"\n\n')
+        f.write("unsigned const char %s[] = {\n" % name)
+        for i in range(0, len(data), 16):
+            chunk = ", ".join("0x%02x" % b for b in data[i : i + 16])
+            end = "};\n" if i + 16 >= len(data) else ",\n"
+            f.write("    " + chunk + end)
+        f.write("unsigned int %s_len = %d;\n" % (name, len(data)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("model", help="Quantized .tflite model")
+    parser.add_argument("output", help="Rewritten .tflite model")
+    parser.add_argument("--int8-io", action="store_true", help="int8 input and output tensors")
+    parser.add_argument("--logits", action="store_true", help="Drop the final Softmax")
+    parser.add_argument("--batch", type=int, help="Batch dimension")
+    parser.add_argument("--prune", type=float, help="Share of fully connected weights to zero")
+    parser.add_argument("--export", help="Also write the model as C array to this file")
+    parser.add_argument("--name", default="tmnist_model_tflite", help="Name of the C array")
+    args = parser.parse_args()
+
+    with open(args.model, "rb") as f:
+        model = read_model(f.read())
+    if args.int8_io:
+        int8_io(model)
+    if args.logits:
+        logits(model)
+    if args.batch:
+        batch(model, args.batch)
+    if args.prune:
+        for name in prune(model, args.prune):
+            print(f"Pruned {args.prune:.0%} of {name}")
+    remove_unused(model)
+
+    data = write_model(model)
+    with open(args.output, "wb") as f:
+        f.write(data)
+    if args.export:
+        export_c_array(data, args.export, args.name)
+    print(f"Model: {len(data)} bytes, {len(model['operators'])} operators, {len(model['tensors'])} tensors")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,771 @@
+#!/usr/bin/env python3
+"""Generate straight-line C++ inference code from a quantized TFLite model.
+
+The TMNIST graph is fixed, so instead of letting MicroInterpreter parse the
+flatbuffer, resolve ops and plan the arena at runtime, this script does all of
+that ahead of time. It emits src/model_generated.{h,cpp} with the weights,
+precomputed requantization multipliers, a statically planned arena and one
+direct kernel call per operator (kernels in src/kernels.cpp). A convolution
+followed by max pooling becomes a single fused call, so the full convolution
+output never takes arena space. A Softmax (and Dequantize) at the end of the
+graph is dropped, the firmware ranks digits on the int8 logits.
+
+Pure Python, no TensorFlow or flatbuffers package needed:
+
+    python3 generate_inference.py tmnist_model.tflite ../src
+"""
+
+import argparse
+import math
+import os
+import struct
+
+# Subset of the TFLite schema used by the graph
+TENSOR_FLOAT32 = 0
+TENSOR_INT32 = 2
+TENSOR_INT8 = 9
+
+OP_CONV_2D = 3
+OP_DEQUANTIZE = 6
+OP_FULLY_CONNECTED = 9
+OP_MAX_POOL_2D = 17
+OP_RESHAPE = 22
+OP_SOFTMAX = 25
+OP_QUANTIZE = 114
+
+PADDING_SAME = 0
+
+ACTIVATION_NONE = 0
+ACTIVATION_RELU = 1
+ACTIVATION_RELU_N1_TO_1 = 2
+ACTIVATION_RELU6 = 3
+
+ARENA_ALIGNMENT = 16
+
+# Fully connected weights with at least this share of zeros are stored as sparse_matrix_t
+SPARSE_MIN_ZEROS = 0.5
+
+
+class Table:
+    """Read-only view of a flatbuffer table."""
+
+    def __init__(self, data, pos):
+        self.data = data
+        self.pos = pos
+        self.vtable = pos - struct.unpack_from("<i", data, pos)[0]
+        self.fields = (struct.unpack_from("<H", data, self.vtable)[0] - 4) // 2
+
+    def _offset(self, field):
+        if field >= self.fields:
+            return 0
+        return struct.unpack_from("<H", self.data, self.vtable + 4 + 2 * field)[0]
+
+    def scalar(self, field, fmt, default=0):
+        offset = self._offset(field)
+        if not offset:
+            return default
+        return struct.unpack_from("<" + fmt, self.data, self.pos + offset)[0]
+
+    def _indirect(self, field):
+        offset = self._offset(field)
+        if not offset:
+            return None
+        pos = self.pos + offset
+        return pos + struct.unpack_from("<I", self.data, pos)[0]
+
+    def table(self, field):
+        pos = self._indirect(field)
+        return Table(self.data, pos) if pos is not None else None
+
+    def tables(self, field):
+        pos = self._indirect(field)
+        if pos is None:
+            return []
+        count = struct.unpack_from("<I", self.data, pos)[0]
+        items = pos + 4
+        return [
+            Table(self.data, items + 4 * i + struct.unpack_from("<I", self.data, items + 4 * i)[0])
+            for i in range(count)
+        ]
+
+    def vector(self, field, fmt):
+        pos = self._indirect(field)
+        if pos is None:
+            return []
+        count = struct.unpack_from("<I", self.data, pos)[0]
+        return list(struct.unpack_from("<%d%s" % (count, fmt), self.data, pos + 4))
+
+    def raw(self, field):
+        pos = self._indirect(field)
+        if pos is None:
+            return b""
+        count = struct.unpack_from("<I", self.data, pos)[0]
+        return self.data[pos + 4 : pos + 4 + count]
+
+    def string(self, field):
+        return self.raw(field).decode()
+
+
+class Tensor:
+    def __init__(self, index, table, buffers):
+        self.index = index
+        self.name = table.string(3)
+        self.shape = table.vector(0, "i")
+        self.type = table.scalar(1, "b")
+        self.data = buffers[table.scalar(2, "I")].raw(0)
+        quantization = table.table(4)
+        self.scales = quantization.vector(2, "f") if quantization else []
+        self.zero_points = quantization.vector(3, "q") if quantization else []
+        self.offset = None  # Arena offset, None for constant tensors
+        self.alias = None  # Tensor sharing the same memory (reshape)
+
+    @property
+    def size(self):
+        return math.prod(self.shape)
+
+    @property
+    def bytes(self):
+        return self.size * (4 if self.type in (TENSOR_FLOAT32, TENSOR_INT32) else 1)
+
+    @property
+    def scale(self):
+        return self.scales[0]
+
+    @property
+    def zero_point(self):
+        return self.zero_points[0]
+
+
+class Operator:
+    def __init__(self, table, codes, tensors):
+        self.code = codes[table.scalar(0, "I")]
+        self.inputs = [tensors[i] if i >= 0 else None for i in table.vector(1, "i")]
+        self.outputs = [tensors[i] for i in table.vector(2, "i")]
+        self.options = table.table(4)
+        self.pool = None  # MAX_POOL_2D fused into this CONV_2D
+
+
+class Scratch:
+    """Arena buffer used by a single operator."""
+
+    def __init__(self, index, size):
+        self.index = index
+        self.name = "scratch_%d" % index
+        self.size = size
+        self.bytes = size
+        self.data = b""
+        self.offset = None
+        self.alias = None
+
+
+def load_model(path):
+    with open(path, "rb") as file:
+        data = file.read()
+    model = Table(data, struct.unpack_from("<I", data, 0)[0])
+    codes = []
+    for code in model.tables(1):
+        # Old models only fill the deprecated 8-bit code
+        codes.append(max(code.scalar(0, "b"), code.scalar(3, "i")))
+    buffers = model.tables(4)
+    subgraphs = model.tables(2)
+    if len(subgraphs) != 1:
+        raise ValueError("Only single subgraph models are supported")
+    subgraph = subgraphs[0]
+    tensors = [Tensor(i, t, buffers) for i, t in enumerate(subgraph.tables(0))]
+    operators = [Operator(o, codes, tensors) for o in subgraph.tables(3)]
+    inputs = [tensors[i] for i in subgraph.vector(1, "i")]
+    outputs = [tensors[i] for i in subgraph.vector(2, "i")]
+    return tensors, operators, inputs, outputs
+
+
+def to_float32(value):
+    return struct.unpack("<f", struct.pack("<f", value))[0]
+
+
+def round_away(value):
+    """std::round, halfway cases away from zero."""
+    return math.copysign(math.floor(abs(value) + 0.5), value)
+
+
+def quantize_multiplier(real_multiplier):
+    """QuantizeMultiplier() of tensorflow/lite/kernels/internal/quantization_util.cc."""
+    if real_multiplier == 0.0:
+        return 0, 0
+    q, shift = math.frexp(real_multiplier)
+    q_fixed = int(round_away(q * (1 << 31)))
+    if q_fixed == (1 << 31):
+        q_fixed //= 2
+        shift += 1
+    if shift < -31:
+        shift = 0
+        q_fixed = 0
+    if shift > 30:
+        shift = 30
+        q_fixed = (1 << 31) - 1
+    return q_fixed, shift
+
+
+def has_specialized_conv(input_c, filter_h, filter_w, output_c, stride_h, stride_w, pad_h, pad_w):
+    """kernel_conv2d_has_specialized() of src/kernels.cpp."""
+    if stride_h != 1 or stride_w != 1 or pad_h != 0 or pad_w != 0:
+        return False
+    if filter_h == 4 and filter_w == 4:
+        return input_c == 1
+    if filter_h == 3 and filter_w == 3:
+        return input_c % 4 == 0 and output_c % 2 == 0
+    return False
+
+
+def activation_range(activation, output):
+    """CalculateActivationRangeQuantized() for int8 outputs."""
+
+    def quantize(value):
+        return output.zero_point + int(round_away(to_float32(value / output.scale)))
+
+    if activation == ACTIVATION_RELU:
+        return max(-128, quantize(0.0)), 127
+    if activation == ACTIVATION_RELU6:
+        return max(-128, quantize(0.0)), min(127, quantize(6.0))
+    if activation == ACTIVATION_RELU_N1_TO_1:
+        return max(-128, quantize(-1.0)), min(127, quantize(1.0))
+    return -128, 127
+
+
+def padding(padding_type, stride, in_size, filter_size, out_size):
+    if padding_type != PADDING_SAME:
+        return 0
+    return max(0, ((out_size - 1) * stride + filter_size - in_size) // 2)
+
+
+def pool_geometry(op):
+    """(filter_h, filter_w, stride_h, stride_w, pad_h, pad_w) of a MAX_POOL_2D operator."""
+    options = op.options
+    padding_type = options.scalar(0, "b")
+    stride_w = options.scalar(1, "i")
+    stride_h = options.scalar(2, "i")
+    filter_w = options.scalar(3, "i")
+    filter_h = options.scalar(4, "i")
+    _, input_h, input_w, _ = op.inputs[0].shape
+    _, output_h, output_w, _ = op.outputs[0].shape
+    pad_h = padding(padding_type, stride_h, input_h, filter_h, output_h)
+    pad_w = padding(padding_type, stride_w, input_w, filter_w, output_w)
+    return filter_h, filter_w, stride_h, stride_w, pad_h, pad_w
+
+
+def check_int8(*tensors):
+    for tensor in tensors:
+        if tensor.type != TENSOR_INT8:
+            raise ValueError("%s: only int8 tensors are supported" % tensor.name)
+
+
+class Generator:
+    def __init__(self, tensors, operators, inputs, outputs):
+        self.tensors = tensors
+        self.operators = operators
+        self.inputs = inputs
+        self.outputs = outputs
+        self.constants = []  # Emitted constant tensors
+        self.definitions = []  # Parameter structs
+        self.calls = []  # Body of model_generated_invoke()
+        self.sparse_bytes = 0  # Size of the sparse_matrix_t arrays
+        # Output is logits, a model exported without Softmax or after strip_softmax()
+        last = [op for op in operators if op.code != OP_DEQUANTIZE][-1:]
+        self.logits = bool(last) and last[0].code != OP_SOFTMAX
+
+    def constant(self, tensor):
+        if tensor not in self.constants:
+            self.constants.append(tensor)
+        return "tensor_%d" % tensor.index
+
+    def pointer(self, tensor, ctype):
+        tensor = tensor.alias or tensor
+        return "(%s*)(model_arena + %d)" % (ctype, tensor.offset)
+
+    @property
+    def weight_bytes(self):
+        return sum(tensor.bytes for tensor in self.constants) + self.sparse_bytes
+
+    def sparse_matrix(self, index, filter, bias, input_offset):
+        """Emit filter as sparse_matrix_t op_<index>_filter and the bias with the input offset folded in."""
+        output_size, input_size = filter.shape
+        weights = struct.unpack("<%db" % filter.size, filter.data)
+        biases = struct.unpack("<%di" % output_size, bias.data) if bias else [0] * output_size
+        values = []
+        steps = []
+        lengths = []
+        folded = []
+        for row in range(output_size):
+            start = len(values)
+            previous = 0
+            row_weights = weights[row * input_size : (row + 1) * input_size]
+            for col, value in enumerate(row_weights):
+                if value == 0:
+                    continue
+                while col - previous > 255:
+                    values.append(0)
+                    steps.append(255)
+                    previous += 255
+                values.append(value)
+                steps.append(col - previous)
+                previous = col
+            lengths.append(len(values) - start)
+            folded.append(biases[row] + input_offset * sum(row_weights))
+
+        def array(ctype, name, items, per_line):
+            lines = ["static const %s %s[%d] = {" % (ctype, name, len(items))]
+            for i in range(0, len(items), per_line):
+                lines.append("    " + ", ".join(map(str, items[i : i + per_line])) + ",")
+            lines.append("};")
+            return "\n".join(lines) + "\n"
+
+        prefix = "op_%d" % index
+        self.definitions.append(
+            "// %s %s, %d of %d weights non-zero\n" % (filter.name, filter.shape, len(values), filter.size)
+            + array("int8_t", prefix + "_values", values, 16)
+            + array("uint8_t", prefix + "_col_steps", steps, 16)
+            + array("uint16_t", prefix + "_row_lengths", lengths, 16)
+            + array("int32_t", prefix + "_folded_bias", folded, 8)
+            + "static const sparse_matrix_t %s_filter = {%s_values, %s_col_steps, %s_row_lengths};\n"
+            % (prefix, prefix, prefix, prefix)
+        )
+        self.sparse_bytes += len(values) * 2 + len(lengths) * 2 + len(folded) * 4
+
+    def strip_softmax(self):
+        """End the graph at the logits, without a final SOFTMAX and the DEQUANTIZE after it.
+
+        Softmax keeps the order of the digits, so argmax does not need it, and
+        the confidence is computed from the logits (src/digit_ranking.cpp).
+        """
+        ops = self.operators
+        tail = ops[-2:] if len(ops) >= 2 and ops[-1].code == OP_DEQUANTIZE else ops[-1:]
+        if not tail or tail[0].code != OP_SOFTMAX or tail[-1].outputs[0] is not self.outputs[0]:
+            return
+        del ops[-len(tail) :]
+        self.outputs = [tail[0].inputs[0]]
+        self.logits = True
+
+    def fuse(self):
+        """Merge each CONV_2D feeding only a MAX_POOL_2D into one kernel_conv2d_pool_int8() call.
+
+        The convolution output is then never stored as a whole, only a band of
+        pool filter height rows in a scratch buffer. Conditions mirror
+        kernel_conv2d_pool_can_fuse().
+        """
+        consumers = {}
+        for op in self.operators:
+            for tensor in op.inputs:
+                if tensor is not None:
+                    consumers[tensor.index] = consumers.get(tensor.index, 0) + 1
+        fused = []
+        for op in self.operators:
+            previous = fused[-1] if fused else None
+            if (
+                op.code == OP_MAX_POOL_2D
+                and previous is not None
+                and previous.code == OP_CONV_2D
+                and previous.pool is None
+                and previous.outputs[0] is op.inputs[0]
+                and consumers[op.inputs[0].index] == 1
+                and op.inputs[0] not in self.outputs
+                and previous.options.scalar(0, "b") != PADDING_SAME
+            ):
+                filter_h, filter_w, stride_h, stride_w, pad_h, pad_w = pool_geometry(op)
+                _, input_h, input_w, channels = op.inputs[0].shape
+                _, output_h, output_w, _ = op.outputs[0].shape
+                if (
+                    pad_h == 0
+                    and pad_w == 0
+                    and (output_h - 1) * stride_h + filter_h <= input_h
+                    and (output_w - 1) * stride_w + filter_w <= input_w
+                ):
+                    previous.pool = op
+                    scratch = Scratch(len(self.tensors), filter_h * input_w * channels)
+                    self.tensors.append(scratch)
+                    previous.outputs = [op.outputs[0], scratch]
+                    continue
+            fused.append(op)
+        self.operators = fused
+
+    def plan(self):
+        """Place activations in one arena, tensors alive at the same time never overlap."""
+        for op in self.operators:
+            if op.code == OP_RESHAPE:
+                op.outputs[0].alias = op.inputs[0].alias or op.inputs[0]
+
+        first_use = {}
+        last_use = {}
+        for tensor in self.inputs:
+            first_use[tensor.index] = 0
+        for step, op in enumerate(self.operators):
+            for tensor in op.inputs + op.outputs:
+                if tensor is None or tensor.data:
+                    continue
+                tensor = tensor.alias or tensor
+                first_use.setdefault(tensor.index, step)
+                last_use[tensor.index] = step
+        for tensor in self.outputs:
+            last_use[(tensor.alias or tensor).index] = len(self.operators)
+
+        # Greedy placement, largest first, like the TFLM greedy memory planner
+        placed = []
+        planned = [self.tensors[i] for i in first_use]
+        for tensor in sorted(planned, key=lambda t: -t.bytes):
+            offset = 0
+            for other in sorted(placed, key=lambda t: t.offset):
+                overlaps_in_time = not (
+                    last_use[other.index] < first_use[tensor.index]
+                    or last_use[tensor.index] < first_use[other.index]
+                )
+                if overlaps_in_time and offset + tensor.bytes > other.offset and offset < other.offset + other.bytes:
+                    offset = other.offset + other.bytes
+                    offset = (offset + ARENA_ALIGNMENT - 1) // ARENA_ALIGNMENT * ARENA_ALIGNMENT
+            tensor.offset = offset
+            placed.append(tensor)
+        self.arena_bytes = max((t.offset + t.bytes for t in placed), default=0)
+
+    def emit_quantize(self, index, op):
+        input, output = op.inputs[0], op.outputs[0]
+        if input.type != TENSOR_FLOAT32:
+            raise ValueError("%s: only float input is supported" % op.inputs[0].name)
+        check_int8(output)
+        self.calls.append(
+            "kernel_quantize_int8(%s, %s, %d, %sf, %d);"
+            % (self.pointer(input, "float"), self.pointer(output, "int8_t"), input.size,
+               repr(output.scale), output.zero_point)
+        )
+
+    def emit_dequantize(self, index, op):
+        input, output = op.inputs[0], op.outputs[0]
+        check_int8(input)
+        self.calls.append(
+            "kernel_dequantize_int8(%s, %s, %d, %sf, %d);"
+            % (self.pointer(input, "int8_t"), self.pointer(output, "float"), input.size,
+               repr(input.scale), input.zero_point)
+        )
+
+    def emit_conv_2d(self, index, op):
+        input, filter, bias = op.inputs[:3]
+        output = op.pool.inputs[0] if op.pool else op.outputs[0]
+        check_int8(input, filter, output)
+        options = op.options
+        padding_type = options.scalar(0, "b")
+        stride_w = options.scalar(1, "i")
+        stride_h = options.scalar(2, "i")
+        activation = options.scalar(3, "b")
+        if options.scalar(4, "i", 1) != 1 or options.scalar(5, "i", 1) != 1:
+            raise ValueError("%s: dilation is not supported" % output.name)
+        batches, input_h, input_w, input_c = input.shape
+        output_c, filter_h, filter_w, _ = filter.shape
+        _, output_h, output_w, _ = output.shape
+
+        multipliers = []
+        shifts = []
+        for filter_scale in filter.scales:
+            # PopulateConvolutionQuantizationParams() computes per channel in double
+            multiplier, shift = quantize_multiplier(input.scale * filter_scale / output.scale)
+            multipliers.append(multiplier)
+            shifts.append(shift)
+        if len(multipliers) == 1:
+            multipliers *= output_c
+            shifts *= output_c
+        act_min, act_max = activation_range(activation, output)
+        pad_h = padding(padding_type, stride_h, input_h, filter_h, output_h)
+        pad_w = padding(padding_type, stride_w, input_w, filter_w, output_w)
+
+        self.definitions.append(
+            "static const int32_t op_%d_multipliers[%d] = {%s};\n"
+            "static const int32_t op_%d_shifts[%d] = {%s};\n"
+            "static constexpr conv_params_t op_%d_params = {\n"
+            "    .batches = %d,\n"
+            "    .input_h = %d,\n"
+            "    .input_w = %d,\n"
+            "    .input_c = %d,\n"
+            "    .filter_h = %d,\n"
+            "    .filter_w = %d,\n"
+            "    .output_h = %d,\n"
+            "    .output_w = %d,\n"
+            "    .output_c = %d,\n"
+            "    .stride_h = %d,\n"
+            "    .stride_w = %d,\n"
+            "    .pad_h = %d,\n"
+            "    .pad_w = %d,\n"
+            "    .input_offset = %d,\n"
+            "    .output_offset = %d,\n"
+            "    .act_min = %d,\n"
+            "    .act_max = %d,\n"
+            "    .multipliers = op_%d_multipliers,\n"
+            "    .shifts = op_%d_shifts,\n"
+            "};\n"
+            % (index, output_c, ", ".join(map(str, multipliers)), index, output_c, ", ".join(map(str, shifts)),
+               index, batches, input_h, input_w, input_c, filter_h, filter_w, output_h, output_w, output_c,
+               stride_h, stride_w, pad_h, pad_w, -input.zero_point,
+               output.zero_point, act_min, act_max, index, index)
+        )
+        specialized = has_specialized_conv(input_c, filter_h, filter_w, output_c, stride_h, stride_w, pad_h, pad_w)
+        if specialized:
+            # kernel_conv2d_fold_bias() done at generation time
+            values = struct.unpack("<%db" % filter.size, filter.data)
+            per_channel = filter.size // output_c
+            biases = struct.unpack("<%di" % output_c, bias.data) if bias else [0] * output_c
+            folded = [
+                biases[c] - input.zero_point * sum(values[c * per_channel : (c + 1) * per_channel])
+                for c in range(output_c)
+            ]
+            self.definitions.append(
+                "static const int32_t op_%d_folded_bias[%d] = {%s};\n"
+                % (index, output_c, ", ".join(map(str, folded)))
+            )
+            bias_name = "op_%d_folded_bias" % index
+        else:
+            bias_name = self.constant(bias) if bias else "nullptr"
+
+        if op.pool:
+            self.pool_definition("op_%d_pool_params" % index, op.pool)
+            pool_output, scratch = op.outputs
+            self.calls.append(
+                "kernel_conv2d_pool_int8(&op_%d_params, &op_%d_pool_params, %s, %s, %s, %s, %s);"
+                % (index, index, self.pointer(input, "int8_t"), self.constant(filter), bias_name,
+                   self.pointer(scratch, "int8_t"), self.pointer(pool_output, "int8_t"))
+            )
+        elif specialized:
+            self.calls.append(
+                "kernel_conv2d_specialized_int8(&op_%d_params, %s, %s, %s, %s);"
+                % (index, self.pointer(input, "int8_t"), self.constant(filter), bias_name,
+                   self.pointer(output, "int8_t"))
+            )
+        else:
+            self.calls.append(
+                "kernel_conv2d_int8(&op_%d_params, %s, %s, %s, %s);"
+                % (index, self.pointer(input, "int8_t"), self.constant(filter), bias_name,
+                   self.pointer(output, "int8_t"))
+            )
+
+    def pool_definition(self, name, op):
+        input, output = op.inputs[0], op.outputs[0]
+        check_int8(input, output)
+        filter_h, filter_w, stride_h, stride_w, pad_h, pad_w = pool_geometry(op)
+        activation = op.options.scalar(5, "b")
+        batches, input_h, input_w, channels = input.shape
+        _, output_h, output_w, _ = output.shape
+        act_min, act_max = activation_range(activation, output)
+        self.definitions.append(
+            "static constexpr pool_params_t %s = {\n"
+            "    .batches = %d,\n"
+            "    .input_h = %d,\n"
+            "    .input_w = %d,\n"
+            "    .channels = %d,\n"
+            "    .filter_h = %d,\n"
+            "    .filter_w = %d,\n"
+            "    .output_h = %d,\n"
+            "    .output_w = %d,\n"
+            "    .stride_h = %d,\n"
+            "    .stride_w = %d,\n"
+            "    .pad_h = %d,\n"
+            "    .pad_w = %d,\n"
+            "    .act_min = %d,\n"
+            "    .act_max = %d,\n"
+            "};\n"
+            % (name, batches, input_h, input_w, channels, filter_h, filter_w, output_h, output_w, stride_h,
+               stride_w, pad_h, pad_w, act_min, act_max)
+        )
+
+    def emit_max_pool_2d(self, index, op):
+        self.pool_definition("op_%d_params" % index, op)
+        self.calls.append(
+            "kernel_max_pool_int8(&op_%d_params, %s, %s);"
+            % (index, self.pointer(op.inputs[0], "int8_t"), self.pointer(op.outputs[0], "int8_t"))
+        )
+
+    def emit_reshape(self, index, op):
+        # Output shares memory with the input, nothing to do at runtime
+        self.calls.append("// %s: reshape in place" % op.outputs[0].name)
+
+    def emit_fully_connected(self, index, op):
+        input, filter, bias = op.inputs[:3]
+        output = op.outputs[0]
+        check_int8(input, filter, output)
+        activation = op.options.scalar(0, "b") if op.options else ACTIVATION_NONE
+        output_size, input_size = filter.shape
+        batches = input.size // input_size
+        # GetQuantizedConvolutionMultipler() multiplies the scales in float first
+        multiplier, shift = quantize_multiplier(to_float32(input.scale * filter.scale) / output.scale)
+        act_min, act_max = activation_range(activation, output)
+        self.definitions.append(
+            "static constexpr fully_connected_params_t op_%d_params = {\n"
+            "    .batches = %d,\n"
+            "    .input_size = %d,\n"
+            "    .output_size = %d,\n"
+            "    .input_offset = %d,\n"
+            "    .filter_offset = %d,\n"
+            "    .output_offset = %d,\n"
+            "    .multiplier = %d,\n"
+            "    .shift = %d,\n"
+            "    .act_min = %d,\n"
+            "    .act_max = %d,\n"
+            "};\n"
+            % (index, batches, input_size, output_size, -input.zero_point, -filter.zero_point,
+               output.zero_point, multiplier, shift, act_min, act_max)
+        )
+        zeros = filter.data.count(0) / filter.size
+        if zeros >= SPARSE_MIN_ZEROS and filter.zero_point == 0:
+            self.sparse_matrix(index, filter, bias, -input.zero_point)
+            self.calls.append(
+                "kernel_fully_connected_sparse_int8(&op_%d_params, %s, &op_%d_filter, op_%d_folded_bias, %s);"
+                % (index, self.pointer(input, "int8_t"), index, index, self.pointer(output, "int8_t"))
+            )
+            return
+        self.calls.append(
+            "kernel_fully_connected_int8(&op_%d_params, %s, %s, %s, %s);"
+            % (index, self.pointer(input, "int8_t"), self.constant(filter),
+               self.constant(bias) if bias else "nullptr", self.pointer(output, "int8_t"))
+        )
+
+    def emit_softmax(self, index, op):
+        input, output = op.inputs[0], op.outputs[0]
+        check_int8(input, output)
+        beta = op.options.scalar(0, "f", 1.0) if op.options else 1.0
+        # CalculateSoftmaxParams() with 5 integer bits for the scaled differences
+        real_multiplier = min(beta * input.scale * (1 << (31 - 5)), (1 << 31) - 1.0)
+        multiplier, left_shift = quantize_multiplier(real_multiplier)
+        radius = math.floor(1.0 * ((1 << 5) - 1) * (1 << (31 - 5)) / (1 << left_shift))
+        size = input.shape[-1]
+        self.definitions.append(
+            "static constexpr softmax_params_t op_%d_params = {\n"
+            "    .batches = %d,\n"
+            "    .size = %d,\n"
+            "    .input_multiplier = %d,\n"
+            "    .input_left_shift = %d,\n"
+            "    .diff_min = %d,\n"
+            "};\n" % (index, input.size // size, size, multiplier, left_shift, -radius)
+        )
+        self.calls.append(
+            "kernel_softmax_int8(&op_%d_params, %s, %s);"
+            % (index, self.pointer(input, "int8_t"), self.pointer(output, "int8_t"))
+        )
+
+    def generate(self, fuse=True, logits=True):
+        if logits:
+            self.strip_softmax()
+        if fuse:
+            self.fuse()
+        self.plan()
+        emitters = {
+            OP_QUANTIZE: self.emit_quantize,
+            OP_DEQUANTIZE: self.emit_dequantize,
+            OP_CONV_2D: self.emit_conv_2d,
+            OP_MAX_POOL_2D: self.emit_max_pool_2d,
+            OP_RESHAPE: self.emit_reshape,
+            OP_FULLY_CONNECTED: self.emit_fully_connected,
+            OP_SOFTMAX: self.emit_softmax,
+        }
+        for index, op in enumerate(self.operators):
+            if op.code not in emitters:
+                raise ValueError("Operator %d is not supported" % op.code)
+            emitters[op.code](index, op)
+
+    def header(self, model_name):
+        input, output = self.inputs[0], self.outputs[0]
+        ctypes = {TENSOR_FLOAT32: "float", TENSOR_INT8: "int8_t"}
+        return """#pragma once
+
+// Generated by train/generate_inference.py from {model}, do not edit
+
+#include <stdint.h>
+
+#define MODEL_GENERATED_BATCH {batch}
+#define MODEL_GENERATED_INPUT_SIZE {input_size}
+#define MODEL_GENERATED_OUTPUT_SIZE {output_size}
+#define MODEL_GENERATED_ARENA_SIZE {arena}
+#define MODEL_GENERATED_INPUT_INT8 {input_int8}
+#define MODEL_GENERATED_OUTPUT_INT8 {output_int8}
+#define MODEL_GENERATED_INPUT_SCALE {input_scale}f
+#define MODEL_GENERATED_INPUT_ZERO_POINT {input_zero_point}
+#define MODEL_GENERATED_OUTPUT_LOGITS {logits}
+#define MODEL_GENERATED_OUTPUT_SCALE {output_scale}f
+#define MODEL_GENERATED_OUTPUT_ZERO_POINT {output_zero_point}
+
+typedef {input_type} model_generated_input_t;
+typedef {output_type} model_generated_output_t;
+
+model_generated_input_t* model_generated_input();
+const model_generated_output_t* model_generated_output();
+void model_generated_invoke();
+""".format(
+            model=model_name,
+            batch=input.shape[0],
+            input_size=input.size // input.shape[0],
+            output_size=output.size // output.shape[0],
+            arena=self.arena_bytes,
+            input_int8=int(input.type == TENSOR_INT8),
+            output_int8=int(output.type == TENSOR_INT8),
+            input_scale=repr(input.scale) if input.scales else "1.0",
+            input_zero_point=input.zero_point if input.zero_points else 0,
+            logits=int(self.logits),
+            output_scale=repr(output.scale) if output.scales else "1.0",
+            output_zero_point=output.zero_point if output.zero_points else 0,
+            input_type=ctypes[input.type],
+            output_type=ctypes[output.type],
+        )
+
+    def source(self, model_name):
+        lines = [
+            "// Generated by train/generate_inference.py from %s, do not edit" % model_name,
+            "",
+            '#include "model_generated.h"',
+            '#include "kernels.h"',
+            "",
+        ]
+        for tensor in self.constants:
+            ctype, fmt = ("int32_t", "i") if tensor.type == TENSOR_INT32 else ("int8_t", "b")
+            values = struct.unpack("<%d%s" % (tensor.size, fmt), tensor.data)
+            lines.append("// %s %s" % (tensor.name, tensor.shape))
+            lines.append("alignas(4) static const %s tensor_%d[%d] = {" % (ctype, tensor.index, tensor.size))
+            per_line = 8 if ctype == "int32_t" else 16
+            for i in range(0, len(values), per_line):
+                lines.append("    " + ", ".join(str(v) for v in values[i : i + per_line]) + ",")
+            lines.append("};")
+            lines.append("")
+        for definition in self.definitions:
+            lines.append(definition)
+        lines.append("// Activations, offsets planned by the generator")
+        lines.append("alignas(%d) static uint8_t model_arena[%d];" % (ARENA_ALIGNMENT, self.arena_bytes))
+        lines.append("")
+        ctypes = {TENSOR_FLOAT32: "float", TENSOR_INT8: "int8_t"}
+        lines.append("model_generated_input_t* model_generated_input() {")
+        lines.append("    return %s;" % self.pointer(self.inputs[0], "model_generated_input_t"))
+        lines.append("}")
+        lines.append("")
+        lines.append("const model_generated_output_t* model_generated_output() {")
+        lines.append("    return %s;" % self.pointer(self.outputs[0], "model_generated_output_t"))
+        lines.append("}")
+        lines.append("")
+        lines.append("void model_generated_invoke() {")
+        for call in self.calls:
+            lines.append("    " + call)
+        lines.append("}")
+        return "\n".join(lines) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("model", help="Quantized .tflite model")
+    parser.add_argument("output", help="Directory for model_generated.{h,cpp}")
+    parser.add_argument("--no-fuse", action="store_true", help="Keep convolution and pooling separate")
+    parser.add_argument("--keep-softmax", action="store_true", help="Output probabilities instead of logits")
+    args = parser.parse_args()
+
+    unfused = Generator(*load_model(args.model))
+    unfused.generate(fuse=False, logits=not args.keep_softmax)
+    generator = Generator(*load_model(args.model))
+    generator.generate(fuse=not args.no_fuse, logits=not args.keep_softmax)
+    model_name = os.path.basename(args.model)
+    with open(os.path.join(args.output, "model_generated.h"), "w") as file:
+        file.write(generator.header(model_name))
+    with open(os.path.join(args.output, "model_generated.cpp"), "w") as file:
+        file.write(generator.source(model_name))
+    print("Arena: %d bytes (%d bytes without conv/pool fusion)" % (generator.arena_bytes, unfused.arena_bytes))
+    print("Weights: %d bytes" % generator.weight_bytes)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+"""Pack a .tflite model into an image of the model flash partition.
+
+The image is the 16 byte header of src/model_store.h followed by the model.
+Flash it once, or upload the bare .tflite to a running device:
+
+    python3 pack_model.py tmnist_model.tflite model.bin
+    esptool.py write_flash 0x290000 model.bin
+    curl --data-binary @tmnist_model.tflite "http://<ip>/api/model?crc=<crc>"
+
+The same image is what the host build maps as the partition stand-in.
+"""
+
+import argparse
+import struct
+import zlib
+
+MAGIC = 0x4C444D54  # "TMDL"
+PARTITION_SIZE = 0x60000  # partitions.csv
+HEADER_SIZE = 16
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("model", help=".tflite model")
+    parser.add_argument("output", help="Partition image")
+    args = parser.parse_args()
+
+    with open(args.model, "rb") as f:
+        model = f.read()
+    if HEADER_SIZE + len(model) > PARTITION_SIZE:
+        raise SystemExit(f"Model of {len(model)} bytes does not fit the {PARTITION_SIZE} byte partition")
+    crc = zlib.crc32(model)
+    with open(args.output, "wb") as f:
+        f.write(struct.pack("<IIII", MAGIC, len(model), crc, 0))
+        f.write(model)
+    print(f"Model: {len(model)} bytes, crc={crc:08x}")
+
+
+if __name__ == "__main__":
+    main()